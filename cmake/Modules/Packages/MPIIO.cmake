@@ -0,0 +1,2 @@
+# let core restart code call into the MPIIO package for ".mpiio" files
+target_compile_definitions(lammps PRIVATE -DLMP_MPIIO)
@@ -108,6 +108,14 @@ bool AtomT::alloc(const int nall) {
                                       UCL_READ_ONLY)==UCL_SUCCESS);
   gpu_bytes+=x_cast.device.row_bytes()+type_cast.device.row_bytes();
   #endif
+  #ifdef GPU_DELTA_X
+  success=success && (dx_q.alloc(_max_atoms*3,*dev,UCL_WRITE_ONLY,
+                                 UCL_READ_ONLY)==UCL_SUCCESS);
+  success=success && (x_mirror.alloc(_max_atoms*3,*dev,
+                                     UCL_NOT_PINNED)==UCL_SUCCESS);
+  gpu_bytes+=dx_q.device.row_bytes();
+  _delta_valid=false;
+  #endif
 
   if (_charge && !_host_view) {
     success=success && (q.alloc(_max_atoms,*dev,UCL_WRITE_ONLY,
@@ -311,10 +319,15 @@ bool AtomT::init(const int nall, const bool charge, const bool rot,
 
   _time_cast=0.0;
 
-  #ifdef GPU_CAST
+  #if defined(GPU_CAST) || defined(GPU_DELTA_X)
   compile_kernels(*dev);
   #endif
 
+  #ifdef GPU_DELTA_X
+  _delta_step=false;
+  _delta_valid=false;
+  #endif
+
   return success && alloc(ef_nall);
 }
 
@@ -341,6 +354,10 @@ void AtomT::clear_resize() {
   x_cast.clear();
   type_cast.clear();
   #endif
+  #ifdef GPU_DELTA_X
+  dx_q.clear();
+  x_mirror.clear();
+  #endif
 
   #ifdef USE_CUDPP
   if (_gpu_nbor==1) cudppDestroyPlan(sort_plan);
@@ -385,6 +402,13 @@ void AtomT::clear() {
     _compiled=false;
   }
   #endif
+  #ifdef GPU_DELTA_X
+  if (_compiled) {
+    k_delta_x.clear();
+    delete atom_program;
+    _compiled=false;
+  }
+  #endif
 }
 
 template <class numtyp, class acctyp>
@@ -436,7 +460,7 @@ void AtomT::sort_neighbor(const int USE_CUDPP_ARG(num_atoms)) {
   #endif
 }
 
-#ifdef GPU_CAST
+#if defined(GPU_CAST) || defined(GPU_DELTA_X)
 #if defined(USE_OPENCL)
 #include "atom_cl.h"
 #elif defined(USE_CUDART)
@@ -450,7 +474,12 @@ void AtomT::compile_kernels(UCL_Device &dev) {
   std::string flags = "";
   atom_program=new UCL_Program(dev);
   atom_program->load_string(atom,flags.c_str(),nullptr,stderr);
+  #ifdef GPU_CAST
   k_cast_x.set_function(*atom_program,"kernel_cast_x");
+  #endif
+  #ifdef GPU_DELTA_X
+  k_delta_x.set_function(*atom_program,"kernel_delta_x");
+  #endif
   _compiled=true;
 }
 
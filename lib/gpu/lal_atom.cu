@@ -33,3 +33,18 @@ __kernel void kernel_cast_x(__global numtyp4 *restrict x_type,
     x_type[ii]=xt;
   } // if ii
 }
+
+__kernel void kernel_delta_x(__global numtyp4 *restrict x_type,
+                             const __global short *restrict dx_q,
+                             const numtyp scale, const int nall) {
+  int ii=GLOBAL_ID_X;
+
+  if (ii<nall) {
+    numtyp4 xt=x_type[ii];
+    int i=ii*3;
+    xt.x+=dx_q[i]*scale;
+    xt.y+=dx_q[i+1]*scale;
+    xt.z+=dx_q[i+2]*scale;
+    x_type[ii]=xt;
+  } // if ii
+}
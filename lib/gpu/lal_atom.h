@@ -50,6 +50,13 @@ using namespace ucl_cudadr;
 
 #include "lal_precision.h"
 
+#if defined(GPU_DELTA_X) && defined(_DOUBLE_DOUBLE)
+#error "GPU_DELTA_X requires a single or mixed precision build"
+#endif
+#if defined(GPU_DELTA_X) && defined(GPU_CAST)
+#error "GPU_DELTA_X cannot be combined with GPU_CAST"
+#endif
+
 namespace LAMMPS_AL {
 
 struct EllipsoidBonus {
@@ -307,14 +314,56 @@ class Atom {
   typedef struct { double x,y,z; } vec3d;
   typedef struct { numtyp x,y,z,w; } vec4d_t;
 
+  #ifdef GPU_DELTA_X
+  /// Quantize displacements since the last transfer into 16-bit deltas
+  /** The host mirror is advanced by the quantized value so the encoding
+    * is closed-loop and quantization error does not accumulate **/
+  inline void cast_x_delta(double **host_ptr) {
+    const double *host_x=host_ptr[0];
+    double maxd=0.0;
+    #if (LAL_USE_OMP == 1)
+    #pragma omp parallel for schedule(static) reduction(max:maxd)
+    #endif
+    for (int i=0; i<_nall*3; i++) {
+      double d=fabs(host_x[i]-x_mirror[i]);
+      if (d>maxd) maxd=d;
+    }
+    _dx_scale=static_cast<numtyp>(maxd/32766.0);
+    if (_dx_scale!=(numtyp)0.0) {
+      const double iscale=32766.0/maxd;
+      const numtyp scale=_dx_scale;
+      short *dq=dx_q.host.begin();
+      #if (LAL_USE_OMP == 1)
+      #pragma omp parallel for schedule(static)
+      #endif
+      for (int i=0; i<_nall*3; i++) {
+        double d=host_x[i]-x_mirror[i];
+        short q=static_cast<short>(d*iscale+((d>=0.0) ? 0.5 : -0.5));
+        dq[i]=q;
+        x_mirror[i]+=static_cast<numtyp>(q*scale);
+      }
+    }
+    _delta_step=true;
+  }
+  #endif
+
   /// Cast positions and types to write buffer
-  inline void cast_x_data(double **host_ptr, const int *host_type) {
+  /** If ago is non-zero and delta compression is enabled, only quantized
+    * displacements since the previous transfer are staged for the copy **/
+  inline void cast_x_data(double **host_ptr, const int *host_type,
+                          const int ago=0) {
+    (void) ago;
     if (_x_avail==false) {
       double t=MPI_Wtime();
       #ifdef GPU_CAST
       memcpy(x_cast.host.begin(),host_ptr[0],_nall*3*sizeof(double));
       memcpy(type_cast.host.begin(),host_type,_nall*sizeof(int));
       #else
+      #ifdef GPU_DELTA_X
+      if (ago!=0 && _delta_valid) {
+        cast_x_delta(host_ptr);
+      } else {
+      #endif
       vec3d *host_p=reinterpret_cast<vec3d*>(&(host_ptr[0][0]));
       vec4d_t *xp=reinterpret_cast<vec4d_t*>(&(x[0]));
       #if (LAL_USE_OMP == 1)
@@ -326,6 +375,19 @@ class Atom {
         xp[i].z=host_p[i].z;
         xp[i].w=host_type[i];
       }
+      #ifdef GPU_DELTA_X
+        #if (LAL_USE_OMP == 1)
+        #pragma omp parallel for schedule(static)
+        #endif
+        for (int i=0; i<_nall; i++) {
+          x_mirror[i*3]=xp[i].x;
+          x_mirror[i*3+1]=xp[i].y;
+          x_mirror[i*3+2]=xp[i].z;
+        }
+        _delta_step=false;
+        _delta_valid=true;
+      }
+      #endif
       #endif
       _time_cast+=MPI_Wtime()-t;
     }
@@ -343,6 +405,17 @@ class Atom {
       int GX=static_cast<int>(ceil(static_cast<double>(_nall)/block_size));
       k_cast_x.set_size(GX,block_size);
       k_cast_x.run(&x, &x_cast, &type_cast, &_nall);
+      #elif defined(GPU_DELTA_X)
+      if (_delta_step) {
+        if (_dx_scale!=(numtyp)0.0) {
+          dx_q.update_device(_nall*3,true);
+          int block_size=64;
+          int GX=static_cast<int>(ceil(static_cast<double>(_nall)/block_size));
+          k_delta_x.set_size(GX,block_size);
+          k_delta_x.run(&x, &dx_q, &_dx_scale, &_nall);
+        }
+      } else
+        x.update_device(_nall*4,true);
       #else
       x.update_device(_nall*4,true);
       #endif
@@ -352,8 +425,9 @@ class Atom {
   }
 
   /// Calls cast_x_data and add_x_data and times the routines
-  inline void cast_copy_x(double **host_ptr, int *host_type) {
-    cast_x_data(host_ptr,host_type);
+  inline void cast_copy_x(double **host_ptr, int *host_type,
+                          const int ago=0) {
+    cast_x_data(host_ptr,host_type,ago);
     add_x_data(host_ptr,host_type);
   }
 
@@ -535,6 +609,13 @@ class Atom {
   UCL_Vector<int,int> type_cast;
   #endif
 
+  #ifdef GPU_DELTA_X
+  /// Quantized per-step coordinate displacements
+  UCL_Vector<short,short> dx_q;
+  /// Host mirror of the device coordinates for delta encoding
+  UCL_H_Vec<numtyp> x_mirror;
+  #endif
+
   /// Cell list identifiers for device nbor builds
   UCL_D_Vec<unsigned> dev_cell_id;
   /// Cell list identifiers for device nbor builds
@@ -561,6 +642,14 @@ class Atom {
   void compile_kernels(UCL_Device &dev);
   #endif
 
+  #ifdef GPU_DELTA_X
+  UCL_Program *atom_program;
+  UCL_Kernel k_delta_x;
+  void compile_kernels(UCL_Device &dev);
+  numtyp _dx_scale;
+  bool _delta_step, _delta_valid;
+  #endif
+
   bool _compiled;
 
   // True if data has been copied to device already
@@ -339,7 +339,7 @@ int** BaseAmoebaT::precompute(const int ago, const int inum_full, const int nall
     atom->cast_q_data(host_q);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     atom->cast_q_data(host_q);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
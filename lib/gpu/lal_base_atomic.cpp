@@ -227,7 +227,7 @@ void BaseAtomicT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   hd_balancer.start_timer();
   atom->add_x_data(host_x,host_type);
 
@@ -285,7 +285,7 @@ int **BaseAtomicT::compute(const int ago, const int inum_full,
       return nullptr;
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
   }
@@ -230,7 +230,7 @@ void BaseChargeT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   atom->cast_q_data(host_q);
   hd_balancer.start_timer();
   atom->add_x_data(host_x,host_type);
@@ -295,7 +295,7 @@ int** BaseChargeT::compute(const int ago, const int inum_full,
     atom->cast_q_data(host_q);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     atom->cast_q_data(host_q);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
@@ -231,7 +231,7 @@ void BaseDipoleT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   atom->cast_q_data(host_q);
   atom->cast_mu_data(host_mu[0]);
   hd_balancer.start_timer();
@@ -300,7 +300,7 @@ int** BaseDipoleT::compute(const int ago, const int inum_full,
     atom->cast_mu_data(host_mu[0]);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     atom->cast_q_data(host_q);
     atom->cast_mu_data(host_mu[0]);
     hd_balancer.start_timer();
@@ -233,7 +233,7 @@ void BaseDPDT::compute(const int f_ago, const int inum_full, const int nall,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   atom->cast_v_data(host_v,tag);
   hd_balancer.start_timer();
   atom->add_x_data(host_x,host_type);
@@ -301,7 +301,7 @@ int** BaseDPDT::compute(const int ago, const int inum_full,
     atom->cast_v_data(host_v,tag);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     atom->cast_v_data(host_v,tag);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
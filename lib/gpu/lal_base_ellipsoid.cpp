@@ -409,7 +409,7 @@ int* BaseEllipsoidT::compute(const int f_ago, const int inum_full,
   else
     list=ilist;
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   atom->cast_quat_data(ellipsoid,bonus);
   hd_balancer.start_timer();
   atom->add_x_data(host_x,host_type);
@@ -465,7 +465,7 @@ int** BaseEllipsoidT::compute(const int ago, const int inum_full,
     atom->cast_quat_data(ellipsoid,bonus);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     atom->cast_quat_data(ellipsoid,bonus);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
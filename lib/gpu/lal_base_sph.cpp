@@ -230,7 +230,7 @@ void BaseSPHT::compute(const int f_ago, const int inum_full, const int nall,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   atom->cast_v_data(host_v,tag);
   hd_balancer.start_timer();
   atom->add_x_data(host_x,host_type);
@@ -290,7 +290,7 @@ int** BaseSPHT::compute(const int ago, const int inum_full, const int nall,
     atom->cast_v_data(host_v,tag);
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     atom->cast_v_data(host_v,tag);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
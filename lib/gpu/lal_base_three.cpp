@@ -299,7 +299,7 @@ void BaseThreeT::compute(const int f_ago, const int inum_full, const int nall,
       return;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   hd_balancer.start_timer();
   atom->add_x_data(host_x,host_type);
 
@@ -373,7 +373,7 @@ int ** BaseThreeT::compute(const int ago, const int inum_full, const int nall,
       return nullptr;
     hd_balancer.start_timer();
   } else {
-    atom->cast_x_data(host_x,host_type);
+    atom->cast_x_data(host_x,host_type,ago);
     hd_balancer.start_timer();
     atom->add_x_data(host_x,host_type);
   }
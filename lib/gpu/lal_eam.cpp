@@ -365,7 +365,7 @@ void EAMT::compute(const int f_ago, const int inum_full, const int nlocal,
       return;
   }
 
-  this->atom->cast_x_data(host_x,host_type);
+  this->atom->cast_x_data(host_x,host_type,ago);
   this->atom->add_x_data(host_x,host_type);
 
   loop(eflag,vflag);
@@ -442,7 +442,7 @@ int** EAMT::compute(const int ago, const int inum_full, const int nall,
     if (!success)
       return nullptr;
   } else {
-    this->atom->cast_x_data(host_x,host_type);
+    this->atom->cast_x_data(host_x,host_type,ago);
     this->atom->add_x_data(host_x,host_type);
   }
   *ilist=this->nbor->host_ilist.begin();
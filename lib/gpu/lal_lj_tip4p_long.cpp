@@ -314,7 +314,7 @@ void LJTIP4PLongT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  this->atom->cast_x_data(host_x,host_type);
+  this->atom->cast_x_data(host_x,host_type,ago);
   this->atom->cast_q_data(host_q);
   this->hd_balancer.start_timer();
   this->atom->add_x_data(host_x,host_type);
@@ -374,7 +374,7 @@ int** LJTIP4PLongT::compute(const int ago, const int inum_full,
     this->atom->cast_q_data(host_q);
     this->hd_balancer.start_timer();
   } else {
-    this->atom->cast_x_data(host_x,host_type);
+    this->atom->cast_x_data(host_x,host_type,ago);
     this->atom->cast_q_data(host_q);
     this->hd_balancer.start_timer();
     this->atom->add_x_data(host_x,host_type);
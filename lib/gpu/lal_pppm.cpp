@@ -237,7 +237,7 @@ void PPPMT::_precompute(const int ago, const int nlocal, const int nall,
       _max_an_bytes=bytes;
   }
 
-  atom->cast_x_data(host_x,host_type);
+  atom->cast_x_data(host_x,host_type,ago);
   atom->cast_q_data(host_q);
   atom->add_x_data(host_x,host_type);
   atom->add_q_data();
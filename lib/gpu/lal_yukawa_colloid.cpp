@@ -183,7 +183,7 @@ void YukawaColloidT::compute(const int f_ago, const int inum_full,
       return;
   }
 
-  this->atom->cast_x_data(host_x,host_type);
+  this->atom->cast_x_data(host_x,host_type,ago);
   this->cast_rad_data(rad);
   this->hd_balancer.start_timer();
   this->atom->add_x_data(host_x,host_type);
@@ -257,7 +257,7 @@ int** YukawaColloidT::compute(const int ago, const int inum_full,
     this->cast_rad_data(rad);
     this->hd_balancer.start_timer();
   } else {
-    this->atom->cast_x_data(host_x,host_type);
+    this->atom->cast_x_data(host_x,host_type,ago);
     this->cast_rad_data(rad);
     this->hd_balancer.start_timer();
     this->atom->add_x_data(host_x,host_type);
@@ -318,6 +318,8 @@ class lammps(object):
     self.lib.lammps_extract_atom.argtypes = [c_void_p, c_char_p]
     self.lib.lammps_extract_atom_datatype.argtypes = [c_void_p, c_char_p]
     self.lib.lammps_extract_atom_datatype.restype = c_int
+    self.lib.lammps_extract_atom_epoch.argtypes = [c_void_p]
+    self.lib.lammps_extract_atom_epoch.restype = c_int64
 
     self.lib.lammps_extract_fix.argtypes = [c_void_p, c_char_p, c_int, c_int, c_int, c_int]
 
@@ -332,6 +334,8 @@ class lammps(object):
     self.lib.lammps_fix_external_set_virial_global.argtypes = [c_void_p, c_char_p, POINTER(c_double)]
     self.lib.lammps_fix_external_set_energy_peratom.argtypes = [c_void_p, c_char_p, POINTER(c_double)]
     self.lib.lammps_fix_external_set_virial_peratom.argtypes = [c_void_p, c_char_p, POINTER(POINTER(c_double))]
+    self.lib.lammps_fix_external_set_results.argtypes = \
+      [c_void_p, c_char_p, c_double, POINTER(c_double), POINTER(c_double), POINTER(POINTER(c_double))]
 
     self.lib.lammps_fix_external_set_vector_length.argtypes = [c_void_p, c_char_p, c_int]
     self.lib.lammps_fix_external_set_vector.argtypes = [c_void_p, c_char_p, c_int, c_double]
@@ -1130,6 +1134,26 @@ class lammps(object):
     if ptr: return ptr
     else:   return None
 
+  # -------------------------------------------------------------------------
+  # extract per-atom buffer validity epoch
+
+  def extract_atom_epoch(self):
+    """Retrieve the validity epoch of per-atom data pointers
+
+    This is a wrapper around the :cpp:func:`lammps_extract_atom_epoch`
+    function of the C-library interface.  The returned counter is
+    incremented whenever the per-atom arrays of this MPI rank are
+    reallocated or reordered.  Pointers (and NumPy views derived from
+    them) obtained from :py:meth:`lammps.extract_atom() <lammps.lammps.extract_atom()>`
+    remain valid, and keep referring to the same atoms in the same order,
+    for as long as this value is unchanged.  This allows re-using a view
+    across multiple timesteps without per-call copies, re-extracting only
+    after the epoch has changed.
+
+    :return: per-atom buffer validity epoch of this rank
+    :rtype: int
+    """
+    return self.lib.lammps_extract_atom_epoch(self.lmp)
 
   # -------------------------------------------------------------------------
 
@@ -2356,6 +2380,56 @@ class lammps(object):
     with ExceptionCheck(self):
       return self.lib.lammps_fix_external_set_virial_peratom(self.lmp, fix_id.encode(), c_virial)
 
+  # -------------------------------------------------------------------------
+
+  def fix_external_set_results(self, fix_id, eng, virial=None, eatom=None, vatom=None):
+    """Set all energy and virial contributions for a fix external instance in one call.
+
+    .. versionadded:: TBD
+
+    This is a wrapper around the :cpp:func:`lammps_fix_external_set_results` function
+    of the C-library interface.  Passing ``None`` for the *virial*, *eatom*, or
+    *vatom* argument skips setting the corresponding quantity.
+
+    :param fix_id:  Fix-ID of a fix external instance
+    :type: string
+    :param eng:     total energy to be added by fix external
+    :type: float
+    :param virial:  list of 6 floating point numbers with the virial to be added or None
+    :type: float
+    :param eatom:   list of potential energy values for local atoms to be added or None
+    :type: float
+    :param vatom:   list of nlocal lists with 6 floating point numbers to be added or None
+    :type: float
+    """
+
+    cvirial = (6*c_double)(*virial) if virial is not None else None
+
+    ceatom = None
+    c_vatom = None
+    if eatom is not None or vatom is not None:
+      nlocal = self.extract_setting('nlocal')
+      if eatom is not None:
+        if len(eatom) < nlocal:
+          raise Exception('per-atom energy list length must be at least nlocal')
+        ceatom = (nlocal*c_double)(*eatom)
+      if vatom is not None:
+        if len(vatom) < nlocal:
+          raise Exception('per-atom virial first dimension must be at least nlocal')
+        if len(vatom[0]) != 6:
+          raise Exception('per-atom virial second dimension must be 6')
+        vbuf = (c_double * 6)
+        vptr = POINTER(c_double)
+        c_vatom = (vptr * nlocal)()
+        for i in range(nlocal):
+          c_vatom[i] = vbuf()
+          for j in range(6):
+            c_vatom[i][j] = vatom[i][j]
+
+    with ExceptionCheck(self):
+      return self.lib.lammps_fix_external_set_results(self.lmp, fix_id.encode(), eng,
+                                                      cvirial, ceatom, c_vatom)
+
   # -------------------------------------------------------------------------
   def fix_external_set_vector_length(self, fix_id, length):
     """Set the vector length for a global vector stored with fix external for analysis
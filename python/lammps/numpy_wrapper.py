@@ -74,6 +74,16 @@ class numpy_wrapper:
        *nelem* parameter the size of the returned NumPy can be overridden.
        There is no check whether the number of elements chosen is valid.
 
+    .. note::
+
+       The returned arrays are zero-copy views into the LAMMPS per-atom
+       storage.  A view remains valid, and keeps referring to the same
+       atoms in the same order, for as long as
+       :py:meth:`lammps.extract_atom_epoch() <lammps.lammps.extract_atom_epoch()>`
+       returns an unchanged value.  Code driving LAMMPS over many steps
+       can thus hold on to a view and only call this method again after
+       the epoch has changed, instead of re-extracting on every access.
+
     :param name: name of the property
     :type name:  string
     :param dtype: type of the returned data (see :ref:`py_datatype_constants`)
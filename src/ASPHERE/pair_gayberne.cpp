@@ -53,6 +53,9 @@ PairGayBerne::PairGayBerne(LAMMPS *lmp) : Pair(lmp)
 
   single_enable = 0;
   writedata = 1;
+
+  amat = bmat = gmat = nullptr;
+  nmax_mat = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -80,6 +83,10 @@ PairGayBerne::~PairGayBerne()
     delete [] lshape;
     delete [] setwell;
   }
+
+  memory->destroy(amat);
+  memory->destroy(bmat);
+  memory->destroy(gmat);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -89,15 +96,17 @@ void PairGayBerne::compute(int eflag, int vflag)
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double evdwl,one_eng,rsq,r2inv,r6inv,forcelj,factor_lj;
   double fforce[3],ttor[3],rtor[3],r12[3];
-  double a1[3][3],b1[3][3],g1[3][3],a2[3][3],b2[3][3],g2[3][3],temp[3][3];
+  double (*a1)[3] = nullptr,(*b1)[3] = nullptr,(*g1)[3] = nullptr;
+  double (*a2)[3],(*b2)[3],(*g2)[3];
   int *ilist,*jlist,*numneigh,**firstneigh;
-  double *iquat,*jquat;
 
   evdwl = 0.0;
   ev_init(eflag,vflag);
 
-  AtomVecEllipsoid::Bonus *bonus = avec->bonus;
-  int *ellipsoid = atom->ellipsoid;
+  // refresh packed per-atom rotation matrix chains from the bonus quats
+
+  precompute_mats();
+
   double **x = atom->x;
   double **f = atom->f;
   double **tor = atom->torque;
@@ -118,12 +127,9 @@ void PairGayBerne::compute(int eflag, int vflag)
     itype = type[i];
 
     if (form[itype][itype] == ELLIPSE_ELLIPSE) {
-      iquat = bonus[ellipsoid[i]].quat;
-      MathExtra::quat_to_mat_trans(iquat,a1);
-      MathExtra::diag_times3(well[itype],a1,temp);
-      MathExtra::transpose_times3(a1,temp,b1);
-      MathExtra::diag_times3(shape2[itype],a1,temp);
-      MathExtra::transpose_times3(a1,temp,g1);
+      a1 = (double (*)[3]) amat[i];
+      b1 = (double (*)[3]) bmat[i];
+      g1 = (double (*)[3]) gmat[i];
     }
 
     jlist = firstneigh[i];
@@ -163,12 +169,9 @@ void PairGayBerne::compute(int eflag, int vflag)
           break;
 
         case SPHERE_ELLIPSE:
-          jquat = bonus[ellipsoid[j]].quat;
-          MathExtra::quat_to_mat_trans(jquat,a2);
-          MathExtra::diag_times3(well[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,b2);
-          MathExtra::diag_times3(shape2[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,g2);
+          a2 = (double (*)[3]) amat[j];
+          b2 = (double (*)[3]) bmat[j];
+          g2 = (double (*)[3]) gmat[j];
           one_eng = gayberne_lj(j,i,a2,b2,g2,r12,rsq,fforce,rtor);
           ttor[0] = ttor[1] = ttor[2] = 0.0;
           break;
@@ -179,12 +182,9 @@ void PairGayBerne::compute(int eflag, int vflag)
           break;
 
         default:
-          jquat = bonus[ellipsoid[j]].quat;
-          MathExtra::quat_to_mat_trans(jquat,a2);
-          MathExtra::diag_times3(well[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,b2);
-          MathExtra::diag_times3(shape2[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,g2);
+          a2 = (double (*)[3]) amat[j];
+          b2 = (double (*)[3]) bmat[j];
+          g2 = (double (*)[3]) gmat[j];
           one_eng = gayberne_analytic(i,j,a1,a2,b1,b2,g1,g2,r12,rsq,
                                       fforce,ttor,rtor);
           break;
@@ -228,6 +228,49 @@ void PairGayBerne::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   build rotation matrix chains for all owned + ghost ellipsoidal atoms:
+     A = rotation matrix from the bonus quaternion
+     B = A_transpose * diag(well) * A
+     G = A_transpose * diag(shape2) * A
+   packed into flat per-atom rows so the pair loop reads them with unit
+   stride, once per atom per step instead of once per neighbor pair
+------------------------------------------------------------------------- */
+
+void PairGayBerne::precompute_mats()
+{
+  AtomVecEllipsoid::Bonus *bonus = avec->bonus;
+  int *ellipsoid = atom->ellipsoid;
+  int *type = atom->type;
+  int nall = atom->nlocal + atom->nghost;
+
+  if (atom->nmax > nmax_mat) {
+    nmax_mat = atom->nmax;
+    memory->destroy(amat);
+    memory->destroy(bmat);
+    memory->destroy(gmat);
+    memory->create(amat,nmax_mat,9,"pair:amat");
+    memory->create(bmat,nmax_mat,9,"pair:bmat");
+    memory->create(gmat,nmax_mat,9,"pair:gmat");
+  }
+
+  double temp[3][3];
+
+  for (int i = 0; i < nall; i++) {
+    int itype = type[i];
+    if (form[itype][itype] != ELLIPSE_ELLIPSE) continue;
+    double *iquat = bonus[ellipsoid[i]].quat;
+    auto a = (double (*)[3]) amat[i];
+    auto b = (double (*)[3]) bmat[i];
+    auto g = (double (*)[3]) gmat[i];
+    MathExtra::quat_to_mat_trans(iquat,a);
+    MathExtra::diag_times3(well[itype],a,temp);
+    MathExtra::transpose_times3(a,temp,b);
+    MathExtra::diag_times3(shape2[itype],a,temp);
+    MathExtra::transpose_times3(a,temp,g);
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
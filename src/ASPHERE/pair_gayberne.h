@@ -59,7 +59,12 @@ class PairGayBerne : public Pair {
   int *setwell;
   class AtomVecEllipsoid *avec;
 
+  double **amat, **bmat, **gmat;    // per-atom rotation matrix chains, packed
+                                    // as flat 9-value rows for unit-stride access
+  int nmax_mat;                     // allocated size of amat/bmat/gmat
+
   void allocate();
+  void precompute_mats();
   double gayberne_analytic(const int i, const int j, double a1[3][3], double a2[3][3],
                            double b1[3][3], double b2[3][3], double g1[3][3], double g2[3][3],
                            double *r12, const double rsq, double *fforce, double *ttor,
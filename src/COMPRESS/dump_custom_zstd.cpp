@@ -23,6 +23,7 @@
 #include "file_writer.h"
 #include "domain.h"
 #include "error.h"
+#include "memory.h"
 #include "update.h"
 
 #include <cstring>
@@ -31,12 +32,22 @@
 using namespace LAMMPS_NS;
 
 DumpCustomZstd::DumpCustomZstd(LAMMPS *lmp, int narg, char **arg) :
-  DumpCustom(lmp, narg, arg)
+  DumpCustom(lmp, narg, arg), compression_level(0), checksum_flag(1),
+  seekable_flag(0), distributed_flag(0), rankcctx(nullptr), cbuf(nullptr),
+  maxcbuf(0)
 {
   if (!compressed)
     error->all(FLERR,"Dump custom/zstd only writes compressed files");
 }
 
+/* ---------------------------------------------------------------------- */
+
+DumpCustomZstd::~DumpCustomZstd()
+{
+  if (rankcctx) ZSTD_freeCCtx(rankcctx);
+  memory->destroy(cbuf);
+}
+
 /* ----------------------------------------------------------------------
    generic opening of a dump file
    ASCII or binary or compressed
@@ -123,14 +134,57 @@ void DumpCustomZstd::write_header(bigint ndump)
     header += fmt::format("ITEM: ATOMS {}\n", columns);
 
     (void) writer.write(header.c_str(), header.length());
+
+    // in distributed mode the per-atom chunks arrive as complete zstd
+    // frames, so the header must be finished as its own frame
+
+    if (distributed_flag) writer.endFrame();
   }
 }
 
+/* ----------------------------------------------------------------------
+   in distributed mode, compress my formatted chunk into an independent
+   zstd frame, in place in sbuf; the frames gathered from all procs are
+   written back to back, which is a valid concatenated zstd stream
+------------------------------------------------------------------------- */
+
+int DumpCustomZstd::convert_string(int n, double *mybuf)
+{
+  int m = DumpCustom::convert_string(n, mybuf);
+  if (!distributed_flag || m <= 0) return m;
+
+  if (!rankcctx) {
+    rankcctx = ZSTD_createCCtx();
+    if (!rankcctx) error->one(FLERR, "Could not create Zstd context");
+  }
+  ZSTD_CCtx_setParameter(rankcctx, ZSTD_c_compressionLevel, compression_level);
+  ZSTD_CCtx_setParameter(rankcctx, ZSTD_c_checksumFlag, checksum_flag);
+
+  bigint bound = (bigint) ZSTD_compressBound(m);
+  if (bound > maxcbuf) {
+    maxcbuf = bound;
+    memory->grow(cbuf, maxcbuf, "dump:cbuf");
+  }
+
+  size_t clen = ZSTD_compress2(rankcctx, cbuf, (size_t) maxcbuf, sbuf, m);
+  if (ZSTD_isError(clen))
+    error->one(FLERR, "Zstd compression failed: {}", ZSTD_getErrorName(clen));
+
+  if ((bigint) clen > maxsbuf) {
+    maxsbuf = clen;
+    memory->grow(sbuf, maxsbuf, "dump:sbuf");
+  }
+  memcpy(sbuf, cbuf, clen);
+  return (int) clen;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void DumpCustomZstd::write_data(int n, double *mybuf)
 {
-  if (buffer_flag == 1) {
+  if (distributed_flag) {
+    writer.writeCompressedFrame(mybuf, n);
+  } else if (buffer_flag == 1) {
     (void) writer.write(mybuf, n);
   } else {
     constexpr size_t VBUFFER_SIZE = 256;
@@ -165,8 +219,12 @@ void DumpCustomZstd::write_data(int n, double *mybuf)
 
 void DumpCustomZstd::write()
 {
+  if (distributed_flag && buffer_flag == 0)
+    error->all(FLERR,"Dump_modify distributed requires buffering (dump_modify buffer yes)");
+
   DumpCustom::write();
   if (filewriter) {
+    if (seekable_flag && !distributed_flag && writer.isopen()) writer.endFrame();
     if (multifile) {
       writer.close();
     } else {
@@ -186,11 +244,28 @@ int DumpCustomZstd::modify_param(int narg, char **arg)
     try {
       if (strcmp(arg[0], "checksum") == 0) {
         if (narg < 2) error->all(FLERR, "Illegal dump_modify command");
-        writer.setChecksum(utils::logical(FLERR, arg[1], false, lmp) == 1);
+        checksum_flag = utils::logical(FLERR, arg[1], false, lmp);
+        writer.setChecksum(checksum_flag == 1);
         return 2;
       } else if (strcmp(arg[0], "compression_level") == 0) {
         if (narg < 2) error->all(FLERR, "Illegal dump_modify command");
-        writer.setCompressionLevel(utils::inumeric(FLERR, arg[1], false, lmp));
+        compression_level = utils::inumeric(FLERR, arg[1], false, lmp);
+        writer.setCompressionLevel(compression_level);
+        return 2;
+      } else if (strcmp(arg[0], "threads") == 0) {
+        if (narg < 2) error->all(FLERR, "Illegal dump_modify command");
+        writer.setThreads(utils::inumeric(FLERR, arg[1], false, lmp));
+        return 2;
+      } else if (strcmp(arg[0], "seekable") == 0) {
+        if (narg < 2) error->all(FLERR, "Illegal dump_modify command");
+        seekable_flag = utils::logical(FLERR, arg[1], false, lmp);
+        writer.setSeekable(seekable_flag == 1);
+        return 2;
+      } else if (strcmp(arg[0], "distributed") == 0) {
+        if (narg < 2) error->all(FLERR, "Illegal dump_modify command");
+        if (writer.isopen())
+          error->all(FLERR, "Dump_modify distributed can not be changed while file is open");
+        distributed_flag = utils::logical(FLERR, arg[1], false, lmp);
         return 2;
       }
     } catch (FileWriterException &e) {
@@ -34,12 +34,23 @@ namespace LAMMPS_NS {
 class DumpCustomZstd : public DumpCustom {
  public:
   DumpCustomZstd(class LAMMPS *, int, char **);
+  ~DumpCustomZstd() override;
 
  protected:
   ZstdFileWriter writer;
 
+  int compression_level;    // mirrors the writer settings for use by
+  int checksum_flag;        // per-rank compression in distributed mode
+  int seekable_flag;        // 1 = end one zstd frame per snapshot
+  int distributed_flag;     // 1 = each rank compresses its own chunk
+
+  ZSTD_CCtx *rankcctx;    // per-rank compression context
+  char *cbuf;             // per-rank compression output buffer
+  bigint maxcbuf;         // size of cbuf
+
   void openfile() override;
   void write_header(bigint) override;
+  int convert_string(int, double *) override;
   void write_data(int, double *) override;
   void write() override;
 
@@ -20,11 +20,20 @@
 #include "zstd_file_writer.h"
 #include "fmt/format.h"
 #include <cstdio>
+#include <limits>
 
 using namespace LAMMPS_NS;
 
+// magic numbers of the zstd seekable format: the seek table is stored
+// in a skippable frame at the end of the file, which regular zstd
+// decompressors ignore
+
+static constexpr uint32_t SKIPPABLE_MAGIC = 0x184D2A5EU;
+static constexpr uint32_t SEEKABLE_MAGIC = 0x8F92EAB1U;
+
 ZstdFileWriter::ZstdFileWriter() :
-    compression_level(0), checksum_flag(1), cctx(nullptr), fp(nullptr)
+    compression_level(0), checksum_flag(1), nthreads(0), seekable_flag(0), cctx(nullptr),
+    fp(nullptr), frame_csize(0), frame_dsize(0), table_valid(true)
 {
   out_buffer_size = ZSTD_CStreamOutSize();
   out_buffer = new char[out_buffer_size];
@@ -65,6 +74,23 @@ void ZstdFileWriter::open(const std::string &path, bool append)
 
   ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, compression_level);
   ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, checksum_flag);
+
+  if (nthreads > 0) {
+    size_t ret = ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, nthreads);
+    if (ZSTD_isError(ret)) {
+      ZSTD_freeCCtx(cctx);
+      cctx = nullptr;
+      fclose(fp);
+      fp = nullptr;
+      throw FileWriterException(
+          "Multi-threaded compression requires a libzstd with multithreading support");
+    }
+  }
+
+  frame_csize = frame_dsize = 0;
+  table_csize.clear();
+  table_dsize.clear();
+  table_valid = true;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -80,8 +106,10 @@ size_t ZstdFileWriter::write(const void *buffer, size_t length)
     ZSTD_outBuffer output = {out_buffer, out_buffer_size, 0};
     ZSTD_compressStream2(cctx, &output, &input, mode);
     fwrite(out_buffer, sizeof(char), output.pos, fp);
+    frame_csize += output.pos;
   } while (input.pos < input.size);
 
+  frame_dsize += length;
   return length;
 }
 
@@ -91,17 +119,102 @@ void ZstdFileWriter::flush()
 {
   if (!isopen()) return;
 
+  // without pending frame data there is nothing buffered in the
+  // compression context, so only flush the stdio buffer
+
+  if (frame_dsize > 0) {
+    size_t remaining;
+    ZSTD_inBuffer input = {nullptr, 0, 0};
+    ZSTD_EndDirective mode = ZSTD_e_flush;
+
+    do {
+      ZSTD_outBuffer output = {out_buffer, out_buffer_size, 0};
+      remaining = ZSTD_compressStream2(cctx, &output, &input, mode);
+      fwrite(out_buffer, sizeof(char), output.pos, fp);
+      frame_csize += output.pos;
+    } while (remaining);
+  }
+
+  fflush(fp);
+}
+
+/* ----------------------------------------------------------------------
+   finish the current zstd frame, so the data written since the last
+   frame end can be decompressed independently, and record its
+   compressed and decompressed size for the seek table
+------------------------------------------------------------------------- */
+
+void ZstdFileWriter::endFrame()
+{
+  if (!isopen() || frame_dsize == 0) return;
+
   size_t remaining;
   ZSTD_inBuffer input = {nullptr, 0, 0};
-  ZSTD_EndDirective mode = ZSTD_e_flush;
+  ZSTD_EndDirective mode = ZSTD_e_end;
 
   do {
     ZSTD_outBuffer output = {out_buffer, out_buffer_size, 0};
     remaining = ZSTD_compressStream2(cctx, &output, &input, mode);
     fwrite(out_buffer, sizeof(char), output.pos, fp);
+    frame_csize += output.pos;
   } while (remaining);
 
-  fflush(fp);
+  constexpr uint64_t U32MAX = std::numeric_limits<uint32_t>::max();
+  if (frame_csize > U32MAX || frame_dsize > U32MAX) table_valid = false;
+  table_csize.push_back((uint32_t) frame_csize);
+  table_dsize.push_back((uint32_t) frame_dsize);
+  frame_csize = frame_dsize = 0;
+}
+
+/* ----------------------------------------------------------------------
+   write a complete externally compressed zstd frame verbatim and record
+   its sizes for the seek table; the decompressed size is taken from the
+   frame header
+------------------------------------------------------------------------- */
+
+void ZstdFileWriter::writeCompressedFrame(const void *buffer, size_t length)
+{
+  if (!isopen()) return;
+
+  endFrame();
+  fwrite(buffer, sizeof(char), length, fp);
+
+  unsigned long long dsize = ZSTD_getFrameContentSize(buffer, length);
+  constexpr uint64_t U32MAX = std::numeric_limits<uint32_t>::max();
+  if (dsize == ZSTD_CONTENTSIZE_UNKNOWN || dsize == ZSTD_CONTENTSIZE_ERROR || dsize > U32MAX ||
+      length > U32MAX)
+    table_valid = false;
+  table_csize.push_back((uint32_t) length);
+  table_dsize.push_back((uint32_t) dsize);
+}
+
+/* ----------------------------------------------------------------------
+   append the seek table as a skippable frame per the zstd seekable
+   format, so tools supporting it can decompress single frames randomly
+   while regular zstd decompressors skip the table
+------------------------------------------------------------------------- */
+
+void ZstdFileWriter::write_seek_table()
+{
+  auto put32 = [this](uint32_t v) {
+    unsigned char b[4];
+    b[0] = v & 0xff;
+    b[1] = (v >> 8) & 0xff;
+    b[2] = (v >> 16) & 0xff;
+    b[3] = (v >> 24) & 0xff;
+    fwrite(b, sizeof(char), 4, fp);
+  };
+
+  auto nframes = (uint32_t) table_csize.size();
+  put32(SKIPPABLE_MAGIC);
+  put32(nframes * 8 + 9);
+  for (uint32_t i = 0; i < nframes; i++) {
+    put32(table_csize[i]);
+    put32(table_dsize[i]);
+  }
+  put32(nframes);
+  fputc(0, fp);    // seek table descriptor: no per-frame checksums
+  put32(SEEKABLE_MAGIC);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -110,15 +223,9 @@ void ZstdFileWriter::close()
 {
   if (!ZstdFileWriter::isopen()) return;
 
-  size_t remaining;
-  ZSTD_inBuffer input = {nullptr, 0, 0};
-  ZSTD_EndDirective mode = ZSTD_e_end;
+  ZstdFileWriter::endFrame();
 
-  do {
-    ZSTD_outBuffer output = {out_buffer, out_buffer_size, 0};
-    remaining = ZSTD_compressStream2(cctx, &output, &input, mode);
-    fwrite(out_buffer, sizeof(char), output.pos, fp);
-  } while (remaining);
+  if (seekable_flag && table_valid && !table_csize.empty()) write_seek_table();
 
   ZSTD_freeCCtx(cctx);
   cctx = nullptr;
@@ -158,4 +265,21 @@ void ZstdFileWriter::setChecksum(bool enabled)
   checksum_flag = enabled ? 1 : 0;
 }
 
+/* ---------------------------------------------------------------------- */
+
+void ZstdFileWriter::setThreads(int nthreads_caller)
+{
+  if (isopen()) throw FileWriterException("Thread count can not be changed while file is open");
+  if (nthreads_caller < 0) throw FileWriterException("Thread count must be non-negative");
+  nthreads = nthreads_caller;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ZstdFileWriter::setSeekable(bool enabled)
+{
+  if (isopen()) throw FileWriterException("Seekable flag can not be changed while file is open");
+  seekable_flag = enabled ? 1 : 0;
+}
+
 #endif
@@ -22,7 +22,9 @@
 
 #include "file_writer.h"
 
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <zstd.h>
 
 #if ZSTD_VERSION_NUMBER < 10400
@@ -34,12 +36,23 @@ namespace LAMMPS_NS {
 class ZstdFileWriter : public FileWriter {
   int compression_level;
   int checksum_flag;
+  int nthreads;
+  int seekable_flag;
 
   ZSTD_CCtx *cctx;
   FILE *fp;
   char *out_buffer;
   size_t out_buffer_size;
 
+  // per-frame accounting for the seekable-format seek table
+  // table_valid turns false if a frame size does not fit into 32 bits
+
+  uint64_t frame_csize, frame_dsize;
+  std::vector<uint32_t> table_csize, table_dsize;
+  bool table_valid;
+
+  void write_seek_table();
+
  public:
   ZstdFileWriter();
   ~ZstdFileWriter() override;
@@ -49,8 +62,13 @@ class ZstdFileWriter : public FileWriter {
   size_t write(const void *buffer, size_t length) override;
   bool isopen() const override;
 
+  void endFrame();
+  void writeCompressedFrame(const void *buffer, size_t length);
+
   void setCompressionLevel(int level);
   void setChecksum(bool enabled);
+  void setThreads(int nthreads);
+  void setSeekable(bool enabled);
 };
 }    // namespace LAMMPS_NS
 
@@ -190,6 +190,8 @@ void AngleDipole::init_style()
 {
   if (!atom->mu_flag || !atom->torque_flag)
     error->all(FLERR, "Angle style dipole requires atom attributes mu and torque");
+
+  atom->add_ghost_field("mu");
 }
 
 /* ----------------------------------------------------------------------
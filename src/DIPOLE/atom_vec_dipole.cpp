@@ -49,6 +49,10 @@ AtomVecDipole::AtomVecDipole(LAMMPS *lmp) : AtomVec(lmp)
   fields_data_atom = {"id", "type", "q", "x", "mu3"};
   fields_data_vel = {"id", "v"};
 
+  // ghost mu is only communicated when a dipole-aware style requests it
+
+  fields_ghost_lazy = {"mu", "mu3"};
+
   setup_fields();
 }
 
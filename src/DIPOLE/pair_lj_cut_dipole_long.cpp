@@ -436,6 +436,8 @@ void PairLJCutDipoleLong::init_style()
   if (!atom->q_flag || !atom->mu_flag || !atom->torque_flag)
     error->all(FLERR,"Pair dipole/long requires atom attributes q, mu, torque");
 
+  atom->add_ghost_field("mu");
+
   if (strcmp(update->unit_style,"electron") == 0)
     error->all(FLERR,"Cannot (yet) use 'electron' units with dipoles");
 
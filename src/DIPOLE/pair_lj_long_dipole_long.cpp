@@ -229,6 +229,8 @@ void PairLJLongDipoleLong::init_style()
   if (!atom->mu_flag || !atom->torque_flag)
     error->all(FLERR,"Pair lj/long/dipole/long requires atom attributes mu, torque");
 
+  atom->add_ghost_field("mu");
+
   neighbor->add_request(this);
 
   cut_coulsq = cut_coul * cut_coul;
@@ -412,6 +412,8 @@ void PairLJSFDipoleSF::init_style()
   if (!atom->q_flag || !atom->mu_flag || !atom->torque_flag)
     error->all(FLERR,"Pair dipole/sf requires atom attributes q, mu, torque");
 
+  atom->add_ghost_field("mu");
+
   neighbor->add_request(this);
 }
 
@@ -29,17 +29,65 @@
 #include "update.h"
 
 #include <cmath>
+#include <cstring>
 
 using namespace LAMMPS_NS;
 
 static constexpr double EPSILON = 1.0e-10;
 
+/* ----------------------------------------------------------------------
+   Saru counter-based PRNG, keyed on the (ordered) tags of the two atoms,
+   the user seed, and the timestep, so both owners of a pair draw the same
+   number regardless of processor or thread.  specifically implemented for
+   steps = 1; high = 1.0; low = -1.0: returns uniformly distributed random
+   numbers u in [-1.0;1.0] using the inherent LCG, then multiplies u with
+   sqrt(3) to "match" with a normal random distribution.  Afshar et al.
+   multiplies u in [-0.5;0.5] with sqrt(12).  same generator and same
+   stream as the GPU package DPD styles (see src/GPU/pair_dpd_gpu.cpp).
+   PRNG period = 3666320093*2^32 ~ 2^64 ~ 10^19
+------------------------------------------------------------------------- */
+
+static constexpr double SQRT3 = 1.7320508075688772935274463;
+static constexpr double TWO_N32 = 0.232830643653869628906250e-9;  // 2^-32
+
+#define LCGA 0x4beb5d59    // Full period 32 bit LCG
+#define LCGC 0x2600e1f7
+#define oWeylPeriod 0xda879add    // Prime period 3666320093
+#define oWeylOffset 0x8009d14b
+
+static inline double saru(unsigned int seed1, unsigned int seed2,
+                          unsigned int seed, unsigned int timestep)
+{
+  unsigned int seed3 = seed + timestep;
+  seed3 ^= (seed1 << 7) ^ (seed2 >> 6);
+  seed2 += (seed1 >> 4) ^ (seed3 >> 15);
+  seed1 ^= (seed2 << 9) + (seed3 << 8);
+  seed3 ^= 0xA5366B4D * ((seed2 >> 11) ^ (seed1 << 1));
+  seed2 += 0x72BE1579 * ((seed1 << 4) ^ (seed3 >> 16));
+  seed1 ^= 0x3F38A6ED * ((seed3 >> 5) ^ (((signed int) seed2) >> 22));
+  seed2 += seed1 * seed3;
+  seed1 += seed3 ^ (seed2 >> 2);
+  seed2 ^= ((signed int) seed2) >> 17;
+  unsigned int state = 0x79dedea3 * (seed1 ^ (((signed int) seed1) >> 14));
+  unsigned int wstate = (state + seed2) ^ (((signed int) state) >> 8);
+  state = state + (wstate * (wstate ^ 0xdddf97f5));
+  wstate = 0xABCB96F7 + (wstate >> 1);
+  state = LCGA * state + LCGC;
+  wstate = wstate + oWeylOffset + ((((signed int) wstate) >> 31) & oWeylPeriod);
+  unsigned int v = (state ^ (state >> 26)) + wstate;
+  unsigned int s = (signed int) ((v ^ (v >> 20)) * 0x6957f5a7);
+  return SQRT3 * (s * TWO_N32 * 2.0 - 1.0);
+}
+
 /* ---------------------------------------------------------------------- */
 
 PairDPD::PairDPD(LAMMPS *lmp) : Pair(lmp)
 {
   writedata = 1;
   random = nullptr;
+  saru_flag = 0;
+  randpool = nullptr;
+  maxrand = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -59,6 +107,7 @@ PairDPD::~PairDPD()
   }
 
   if (random) delete random;
+  memory->destroy(randpool);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -78,10 +127,12 @@ void PairDPD::compute(int eflag, int vflag)
   double **v = atom->v;
   double **f = atom->f;
   int *type = atom->type;
+  tagint *tag = atom->tag;
   int nlocal = atom->nlocal;
   double *special_lj = force->special_lj;
   int newton_pair = force->newton_pair;
   double dtinvsqrt = 1.0/sqrt(update->dt);
+  int timestep = (int) update->ntimestep;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -102,6 +153,25 @@ void PairDPD::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    // generate random numbers for all neighbors of atom i in one batch:
+    // the Saru hash carries no sequential state, so this loop vectorizes
+
+    if (saru_flag) {
+      if (jnum > maxrand) {
+        maxrand = jnum;
+        memory->grow(randpool,maxrand,"pair:randpool");
+      }
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj] & NEIGHMASK;
+        unsigned int tag1 = tag[i], tag2 = tag[j];
+        if (tag1 > tag2) {
+          tag1 = tag[j];
+          tag2 = tag[i];
+        }
+        randpool[jj] = saru(tag1,tag2,seed,timestep);
+      }
+    }
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_dpd = special_lj[sbmask(j)];
@@ -123,7 +193,8 @@ void PairDPD::compute(int eflag, int vflag)
         delvz = vztmp - v[j][2];
         dot = delx*delvx + dely*delvy + delz*delvz;
         wd = 1.0 - r/cut[itype][jtype];
-        randnum = random->gaussian();
+        if (saru_flag) randnum = randpool[jj];
+        else randnum = random->gaussian();
 
         // conservative force = a0 * wd
         // drag force = -gamma * wd^2 * (delx dot delv) / r
@@ -194,12 +265,18 @@ void PairDPD::allocate()
 
 void PairDPD::settings(int narg, char **arg)
 {
-  if (narg != 3) error->all(FLERR,"Illegal pair_style command");
+  if (narg < 3 || narg > 4) error->all(FLERR,"Illegal pair_style command");
 
   temperature = utils::numeric(FLERR,arg[0],false,lmp);
   cut_global = utils::numeric(FLERR,arg[1],false,lmp);
   seed = utils::inumeric(FLERR,arg[2],false,lmp);
 
+  saru_flag = 0;
+  if (narg == 4) {
+    if (strcmp(arg[3],"saru") == 0) saru_flag = 1;
+    else error->all(FLERR,"Unknown pair_style dpd keyword: {}",arg[3]);
+  }
+
   // initialize Marsaglia RNG with processor-unique seed
 
   if (seed <= 0) error->all(FLERR,"Illegal pair_style command");
@@ -348,6 +425,7 @@ void PairDPD::write_restart_settings(FILE *fp)
   fwrite(&temperature,sizeof(double),1,fp);
   fwrite(&cut_global,sizeof(double),1,fp);
   fwrite(&seed,sizeof(int),1,fp);
+  fwrite(&saru_flag,sizeof(int),1,fp);
   fwrite(&mix_flag,sizeof(int),1,fp);
 }
 
@@ -361,11 +439,13 @@ void PairDPD::read_restart_settings(FILE *fp)
     utils::sfread(FLERR,&temperature,sizeof(double),1,fp,nullptr,error);
     utils::sfread(FLERR,&cut_global,sizeof(double),1,fp,nullptr,error);
     utils::sfread(FLERR,&seed,sizeof(int),1,fp,nullptr,error);
+    utils::sfread(FLERR,&saru_flag,sizeof(int),1,fp,nullptr,error);
     utils::sfread(FLERR,&mix_flag,sizeof(int),1,fp,nullptr,error);
   }
   MPI_Bcast(&temperature,1,MPI_DOUBLE,0,world);
   MPI_Bcast(&cut_global,1,MPI_DOUBLE,0,world);
   MPI_Bcast(&seed,1,MPI_INT,0,world);
+  MPI_Bcast(&saru_flag,1,MPI_INT,0,world);
   MPI_Bcast(&mix_flag,1,MPI_INT,0,world);
 
   // initialize Marsaglia RNG with processor-unique seed
@@ -45,6 +45,9 @@ class PairDPD : public Pair {
   double cut_global, temperature;
   double special_sqrt[4];
   int seed;
+  int saru_flag;        // 1 if using per-pair Saru RNG instead of RanMars
+  double *randpool;     // per-neighbor random number buffer for Saru RNG
+  int maxrand;          // allocated size of randpool
   double **cut;
   double **a0, **gamma;
   double **sigma;
@@ -141,9 +141,9 @@ void FixDrude::build_drudeid() {
     }
   }
   // Loop on procs to fill my atoms' sets of bond partners
-  comm->ring(core_drude_vec.size(), sizeof(tagint),
-             (char *) core_drude_vec.data(),
-             4, ring_build_partner, nullptr, (void *)this, 1);
+  comm->ring_gather(core_drude_vec.size(), sizeof(tagint),
+                    (char *) core_drude_vec.data(),
+                    ring_build_partner, (void *)this, 1);
 
   // Build the list of my Drudes' tags
   // The only bond partners of a Drude particle is its core,
@@ -157,9 +157,9 @@ void FixDrude::build_drudeid() {
   // At this point each of my Drudes knows its core.
   // Send my list of Drudes to other procs and myself
   // so that each core finds its Drude.
-  comm->ring(drude_vec.size(), sizeof(tagint),
-             (char *) drude_vec.data(),
-             3, ring_search_drudeid, nullptr, (void *)this, 1);
+  comm->ring_gather(drude_vec.size(), sizeof(tagint),
+                    (char *) drude_vec.data(),
+                    ring_search_drudeid, (void *)this, 1);
   delete [] partner_set;
 }
 
@@ -329,13 +329,13 @@ void FixDrude::rebuild_special() {
     }
   }
   // Remove Drude particles from the special lists of each proc
-  comm->ring(drude_vec.size(), sizeof(tagint),
-             (char *) drude_vec.data(),
-             9, ring_remove_drude, nullptr, (void *)this, 1);
+  comm->ring_gather(drude_vec.size(), sizeof(tagint),
+                    (char *) drude_vec.data(),
+                    ring_remove_drude, (void *)this, 1);
   // Add back Drude particles in the lists just after their core
-  comm->ring(core_drude_vec.size(), sizeof(tagint),
-             (char *) core_drude_vec.data(),
-             10, ring_add_drude, nullptr, (void *)this, 1);
+  comm->ring_gather(core_drude_vec.size(), sizeof(tagint),
+                    (char *) core_drude_vec.data(),
+                    ring_add_drude, (void *)this, 1);
 
   // Check size of special list
   nspecmax_loc = 0;
@@ -360,9 +360,9 @@ void FixDrude::rebuild_special() {
       core_special_vec.push_back(special[i][j]);
   }
   // Copy core's list into their drude list
-  comm->ring(core_special_vec.size(), sizeof(tagint),
-             (char *) core_special_vec.data(),
-             11, ring_copy_drude, nullptr, (void *)this, 1);
+  comm->ring_gather(core_special_vec.size(), sizeof(tagint),
+                    (char *) core_special_vec.data(),
+                    ring_copy_drude, (void *)this, 1);
 }
 
 /* ----------------------------------------------------------------------
@@ -26,7 +26,7 @@
 #include "domain.h"
 #include "input.h"
 #include "variable.h"
-#include "random_mars.h"
+#include "random_counter.h"
 #include "memory.h"
 #include "error.h"
 #include "group.h"
@@ -70,10 +70,12 @@ void FixLangevinEff::post_force_no_tally()
   double **f = atom->f;
   double *ervel = atom->ervel;
   double *erforce = atom->erforce;
+  tagint *tag = atom->tag;
   int *spin = atom->spin;
   int *type = atom->type;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
+  bigint step = update->ntimestep;
   double mefactor = domain->dimension/4.0;
   double sqrtmefactor = sqrt(mefactor);
 
@@ -159,9 +161,9 @@ void FixLangevinEff::post_force_no_tally()
         if (tstyle == ATOM) tsqrt = sqrt(tforce[i]);
         gamma1 = gfactor1[type[i]] * gfactor3;
         gamma2 = gfactor2[type[i]] * tsqrt;
-        fran[0] = gamma2*(random->uniform()-0.5);
-        fran[1] = gamma2*(random->uniform()-0.5);
-        fran[2] = gamma2*(random->uniform()-0.5);
+        fran[0] = gamma2*(random->uniform(step,tag[i],0)-0.5);
+        fran[1] = gamma2*(random->uniform(step,tag[i],1)-0.5);
+        fran[2] = gamma2*(random->uniform(step,tag[i],2)-0.5);
         f[i][0] += gamma1*v[i][0] + fran[0];
         f[i][1] += gamma1*v[i][1] + fran[1];
         f[i][2] += gamma1*v[i][2] + fran[2];
@@ -169,7 +171,7 @@ void FixLangevinEff::post_force_no_tally()
         fsum[1] += fran[1];
         fsum[2] += fran[2];
         if (abs(spin[i])==1) {
-          fran[3] = sqrtmefactor*gamma2*(random->uniform()-0.5);
+          fran[3] = sqrtmefactor*gamma2*(random->uniform(step,tag[i],3)-0.5);
           erforce[i] += mefactor*gamma1*ervel[i]+fran[3];
           fsum[3] += fran[3];
         }
@@ -183,9 +185,9 @@ void FixLangevinEff::post_force_no_tally()
         gamma1 = gfactor1[type[i]] * gfactor3;
         gamma2 = gfactor2[type[i]] * tsqrt;
         temperature->remove_bias(i,v[i]);
-        fran[0] = gamma2*(random->uniform()-0.5);
-        fran[1] = gamma2*(random->uniform()-0.5);
-        fran[2] = gamma2*(random->uniform()-0.5);
+        fran[0] = gamma2*(random->uniform(step,tag[i],0)-0.5);
+        fran[1] = gamma2*(random->uniform(step,tag[i],1)-0.5);
+        fran[2] = gamma2*(random->uniform(step,tag[i],2)-0.5);
         if (v[i][0] != 0.0)
           f[i][0] += gamma1*v[i][0] + fran[0];
         if (v[i][1] != 0.0)
@@ -196,7 +198,7 @@ void FixLangevinEff::post_force_no_tally()
         fsum[1] += fran[1];
         fsum[2] += fran[2];
         if (abs(spin[i])==1) {
-          fran[3] = sqrtmefactor*gamma2*(random->uniform()-0.5);
+          fran[3] = sqrtmefactor*gamma2*(random->uniform(step,tag[i],3)-0.5);
           if (ervel[i] != 0.0) erforce[i] += mefactor*gamma1*ervel[i]+fran[3];
           fsum[3] += fran[3];
         }
@@ -248,9 +250,11 @@ void FixLangevinEff::post_force_tally()
   double mefactor = domain->dimension/4.0;
   double sqrtmefactor = sqrt(mefactor);
 
+  tagint *tag = atom->tag;
   int *type = atom->type;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
+  bigint step = update->ntimestep;
 
   double delta = update->ntimestep - update->beginstep;
   delta /= update->endstep - update->beginstep;
@@ -328,14 +332,14 @@ void FixLangevinEff::post_force_tally()
         if (tstyle == ATOM) tsqrt = sqrt(tforce[i]);
         gamma1 = gfactor1[type[i]] * gfactor3;
         gamma2 = gfactor2[type[i]] * tsqrt;
-        flangevin[i][0] = gamma1*v[i][0] + gamma2*(random->uniform()-0.5);
-        flangevin[i][1] = gamma1*v[i][1] + gamma2*(random->uniform()-0.5);
-        flangevin[i][2] = gamma1*v[i][2] + gamma2*(random->uniform()-0.5);
+        flangevin[i][0] = gamma1*v[i][0] + gamma2*(random->uniform(step,tag[i],0)-0.5);
+        flangevin[i][1] = gamma1*v[i][1] + gamma2*(random->uniform(step,tag[i],1)-0.5);
+        flangevin[i][2] = gamma1*v[i][2] + gamma2*(random->uniform(step,tag[i],2)-0.5);
         f[i][0] += flangevin[i][0];
         f[i][1] += flangevin[i][1];
         f[i][2] += flangevin[i][2];
         if (abs(spin[i])==1) {
-          erforcelangevin[i] = mefactor*gamma1*ervel[i]+sqrtmefactor*gamma2*(random->uniform()-0.5);
+          erforcelangevin[i] = mefactor*gamma1*ervel[i]+sqrtmefactor*gamma2*(random->uniform(step,tag[i],3)-0.5);
           erforce[i] += erforcelangevin[i];
         }
       }
@@ -348,9 +352,9 @@ void FixLangevinEff::post_force_tally()
         gamma1 = gfactor1[type[i]] * gfactor3;
         gamma2 = gfactor2[type[i]] * tsqrt;
         temperature->remove_bias(i,v[i]);
-        flangevin[i][0] = gamma1*v[i][0] + gamma2*(random->uniform()-0.5);
-        flangevin[i][1] = gamma1*v[i][1] + gamma2*(random->uniform()-0.5);
-        flangevin[i][2] = gamma1*v[i][2] + gamma2*(random->uniform()-0.5);
+        flangevin[i][0] = gamma1*v[i][0] + gamma2*(random->uniform(step,tag[i],0)-0.5);
+        flangevin[i][1] = gamma1*v[i][1] + gamma2*(random->uniform(step,tag[i],1)-0.5);
+        flangevin[i][2] = gamma1*v[i][2] + gamma2*(random->uniform(step,tag[i],2)-0.5);
         if (v[i][0] != 0.0) f[i][0] += flangevin[i][0];
         else flangevin[i][0] = 0.0;
         if (v[i][1] != 0.0) f[i][1] += flangevin[i][1];
@@ -358,7 +362,7 @@ void FixLangevinEff::post_force_tally()
         if (v[i][2] != 0.0) f[i][2] += flangevin[i][2];
         else flangevin[i][2] = 0.0;
         if (abs(spin[i])==1) {
-          erforcelangevin[i] = mefactor*gamma1*ervel[i]+sqrtmefactor*gamma2*(random->uniform()-0.5);
+          erforcelangevin[i] = mefactor*gamma1*ervel[i]+sqrtmefactor*gamma2*(random->uniform(step,tag[i],3)-0.5);
           if (ervel[i] != 0.0) erforce[i] += erforcelangevin[i];
           else erforcelangevin[i] = 0.0;
         }
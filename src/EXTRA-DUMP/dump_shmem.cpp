@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "dump_shmem.h"
+
+#include "atom.h"
+#include "domain.h"
+#include "error.h"
+#include "update.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+// binary layout of the shared-memory ring buffer segment.
+// all integers are in host byte order, all data values are doubles.
+// the segment starts with one SegmentHeader padded to SHMEM_HEADER_SIZE,
+// followed by nslots frame slots of slotsize bytes each.  frame N lives
+// in slot N % nslots and begins with a FrameHeader followed by
+// natoms*size_one packed doubles in the same order as a text dump file.
+// the per-slot seq field is 2*N+1 while frame N is being written and
+// 2*N+2 once it is complete; readers must check it before and after
+// copying a frame to detect frames overwritten while being read.
+
+static constexpr char SHMEM_MAGIC[8] = {'L', 'M', 'P', 'S', 'H', 'M', '0', '1'};
+static constexpr int SHMEM_HEADER_SIZE = 4096;
+static constexpr int SHMEM_COLUMNS_MAX = 1024;
+
+namespace {
+struct SegmentHeader {
+  char magic[8];                   // "LMPSHM01"
+  int32_t headersize;              // byte offset of the first frame slot
+  int32_t nslots;                  // # of frame slots
+  int64_t slotsize;                // size of one frame slot in bytes
+  int32_t size_one;                // # of values per atom
+  int32_t pad;
+  char columns[SHMEM_COLUMNS_MAX];    // space separated column labels
+  uint64_t head;                   // # of published frames
+};
+
+struct FrameHeader {
+  uint64_t seq;           // seqlock, see layout comment above
+  int64_t ntimestep;
+  int64_t natoms;
+  int32_t triclinic;
+  int32_t size_one;
+  double boxlo[3], boxhi[3];
+  double xy, xz, yz;
+};
+}    // namespace
+
+/* ---------------------------------------------------------------------- */
+
+DumpShmem::DumpShmem(LAMMPS *_lmp, int narg, char **args) :
+    DumpCustom(_lmp, narg, args), nslots(8), shm_base(nullptr), shm_size(0), slotsize(0),
+    nwritten(0), dataoffset(0), frame_open(0)
+{
+#ifdef _WIN32
+  error->all(FLERR, "Dump style shmem is not supported on Windows");
+#endif
+
+  buffer_allow = 0;
+  buffer_flag = 0;
+
+  if (filename[0] != '/')
+    error->all(FLERR, "Dump shmem segment name must start with a '/' character");
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpShmem::~DumpShmem()
+{
+#ifndef _WIN32
+  if (shm_base) {
+    munmap(shm_base, shm_size);
+    shm_base = nullptr;
+    if (filewriter) shm_unlink(filename);
+  }
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpShmem::init_style()
+{
+  if (binary) error->all(FLERR, "Dump style shmem does not support binary output");
+  if (multifile) error->all(FLERR, "Dump style shmem does not support multi-file output");
+  if (multiproc) error->all(FLERR, "Dump style shmem does not support multi-processor output");
+  if (async_flag) error->all(FLERR, "Dump style shmem does not support asynchronous output");
+  if (strlen(columns) >= SHMEM_COLUMNS_MAX)
+    error->all(FLERR, "Too many columns for dump style shmem");
+
+  DumpCustom::init_style();
+}
+
+/* ----------------------------------------------------------------------
+   create and map the shared-memory segment instead of opening a file.
+   slots are sized for the current total atom count plus some headroom,
+   so that readers can rely on a fixed frame stride.
+------------------------------------------------------------------------- */
+
+void DumpShmem::openfile()
+{
+#ifndef _WIN32
+  if (!filewriter || shm_base) return;
+
+  bigint maxatoms = atom->natoms + atom->natoms / 10 + 1000;
+  slotsize = sizeof(FrameHeader) + (size_t) maxatoms * size_one * sizeof(double);
+  slotsize = (slotsize + 63) & ~(size_t) 63;
+  shm_size = SHMEM_HEADER_SIZE + (size_t) nslots * slotsize;
+
+  int fd = shm_open(filename, O_CREAT | O_RDWR, 0600);
+  if (fd < 0)
+    error->one(FLERR, "Cannot create shared memory segment {}: {}", filename,
+               utils::getsyserror());
+  if (ftruncate(fd, (off_t) shm_size) < 0) {
+    close(fd);
+    error->one(FLERR, "Cannot size shared memory segment {}: {}", filename, utils::getsyserror());
+  }
+  shm_base = mmap(nullptr, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (shm_base == MAP_FAILED) {
+    shm_base = nullptr;
+    error->one(FLERR, "Cannot map shared memory segment {}: {}", filename, utils::getsyserror());
+  }
+
+  auto seg = (SegmentHeader *) shm_base;
+  memset(seg, 0, SHMEM_HEADER_SIZE);
+  memcpy(seg->magic, SHMEM_MAGIC, sizeof(SHMEM_MAGIC));
+  seg->headersize = SHMEM_HEADER_SIZE;
+  seg->nslots = nslots;
+  seg->slotsize = (int64_t) slotsize;
+  seg->size_one = size_one;
+  strncpy(seg->columns, columns, SHMEM_COLUMNS_MAX - 1);
+  seg->head = 0;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   begin a new frame in the next ring slot.  the slot stays marked as
+   incomplete (odd seq) until the frame is published in write().
+------------------------------------------------------------------------- */
+
+void DumpShmem::write_header(bigint ndump)
+{
+  if (!filewriter) return;
+  if (!shm_base) openfile();
+
+  const size_t nbytes = sizeof(FrameHeader) + (size_t) ndump * size_one * sizeof(double);
+  if (nbytes > slotsize)
+    error->one(FLERR,
+               "Frame of {} atoms does not fit into dump shmem slot; "
+               "the segment is sized when the dump is initialized",
+               ndump);
+
+  auto frame = (FrameHeader *) (void *) ((char *) shm_base + SHMEM_HEADER_SIZE +
+                                         (size_t)(nwritten % nslots) * slotsize);
+  frame->seq = 2 * (uint64_t) nwritten + 1;
+  std::atomic_thread_fence(std::memory_order_release);
+
+  frame->ntimestep = update->ntimestep;
+  frame->natoms = ndump;
+  frame->triclinic = domain->triclinic;
+  frame->size_one = size_one;
+  frame->boxlo[0] = boxxlo;
+  frame->boxlo[1] = boxylo;
+  frame->boxlo[2] = boxzlo;
+  frame->boxhi[0] = boxxhi;
+  frame->boxhi[1] = boxyhi;
+  frame->boxhi[2] = boxzhi;
+  if (domain->triclinic) {
+    frame->xy = boxxy;
+    frame->xz = boxxz;
+    frame->yz = boxyz;
+  } else
+    frame->xy = frame->xz = frame->yz = 0.0;
+
+  dataoffset = sizeof(FrameHeader);
+  frame_open = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpShmem::write_data(int n, double *mybuf)
+{
+  if (!frame_open) return;
+
+  auto slot = (char *) shm_base + SHMEM_HEADER_SIZE + (size_t)(nwritten % nslots) * slotsize;
+  const size_t nbytes = (size_t) n * size_one * sizeof(double);
+  memcpy(slot + dataoffset, mybuf, nbytes);
+  dataoffset += nbytes;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpShmem::write()
+{
+  Dump::write();
+
+  // publish the completed frame: mark the slot sequence number as
+  // complete (even), then advance the ring head so readers see it
+
+  if (filewriter && frame_open) {
+    auto seg = (SegmentHeader *) shm_base;
+    auto frame = (FrameHeader *) (void *) ((char *) shm_base + SHMEM_HEADER_SIZE +
+                                           (size_t)(nwritten % nslots) * slotsize);
+    std::atomic_thread_fence(std::memory_order_release);
+    frame->seq = 2 * (uint64_t) nwritten + 2;
+    std::atomic_thread_fence(std::memory_order_release);
+    nwritten++;
+    seg->head = (uint64_t) nwritten;
+    frame_open = 0;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpShmem::modify_param(int narg, char **arg)
+{
+  int n = DumpCustom::modify_param(narg, arg);
+  if (n > 0) return n;
+
+  if (strcmp(arg[0], "nslots") == 0) {
+    if (narg < 2) utils::missing_cmd_args(FLERR, "dump_modify nslots", error);
+    if (shm_base)
+      error->all(FLERR, "Cannot change dump shmem nslots after the segment was created");
+    nslots = utils::inumeric(FLERR, arg[1], false, lmp);
+    if (nslots <= 0) error->all(FLERR, "Invalid dump_modify nslots argument: {}", nslots);
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,53 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+// clang-format off
+DumpStyle(shmem,DumpShmem);
+// clang-format on
+#else
+
+#ifndef LMP_DUMP_SHMEM_H
+#define LMP_DUMP_SHMEM_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+class DumpShmem : public DumpCustom {
+ public:
+  DumpShmem(class LAMMPS *, int, char **);
+  ~DumpShmem() override;
+
+ protected:
+  int nslots;           // # of frame slots in the ring buffer
+  void *shm_base;       // base address of mapped segment, null before creation
+  size_t shm_size;      // total size of mapped segment in bytes
+  size_t slotsize;      // size of one frame slot in bytes
+  bigint nwritten;      // # of frames published so far
+  size_t dataoffset;    // write position in current slot during a frame
+  int frame_open;       // 1 between write_header() and frame publication
+
+  void init_style() override;
+  void write() override;
+  void openfile() override;
+  void write_header(bigint) override;
+  void write_data(int, double *) override;
+
+  int modify_param(int, char **) override;
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
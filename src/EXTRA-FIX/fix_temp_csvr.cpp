@@ -27,7 +27,7 @@
 #include "group.h"
 #include "input.h"
 #include "modify.h"
-#include "random_mars.h"
+#include "random_counter.h"
 #include "update.h"
 #include "variable.h"
 
@@ -40,7 +40,6 @@ using namespace FixConst;
 enum{NOBIAS,BIAS};
 enum{CONSTANT,EQUAL};
 
-static constexpr int PRNGSIZE = 98+2+3;
 /* ---------------------------------------------------------------------- */
 
 FixTempCSVR::FixTempCSVR(LAMMPS *lmp, int narg, char **arg) :
@@ -78,7 +77,10 @@ FixTempCSVR::FixTempCSVR(LAMMPS *lmp, int narg, char **arg) :
   if (t_period <= 0.0) error->all(FLERR,"Illegal fix temp/csvr command");
   if (seed <= 0) error->all(FLERR,"Illegal fix temp/csvr command");
 
-  random = new RanMars(lmp,seed + comm->me);
+  // counter-based RNG keyed on the timestep: the number of procs does not
+  // matter (only rank 0 draws) and no state must be saved across restarts
+
+  random = new RanCounter(lmp,seed);
 
   // create a new compute temp style
   // id = fix-ID + temp, compute group = fix group
@@ -170,6 +172,7 @@ void FixTempCSVR::end_of_step()
 
   double lamda;
   if (comm->me == 0) {
+    random->rewind(update->ntimestep,0);
     lamda = resamplekin(ekin_old, ekin_new);
   }
   MPI_Bcast(&lamda,1,MPI_DOUBLE,0,world);
@@ -327,22 +330,15 @@ double FixTempCSVR::compute_scalar()
 
 void FixTempCSVR::write_restart(FILE *fp)
 {
-  int nsize = PRNGSIZE*comm->nprocs+2; // pRNG state per proc + nprocs + energy
-  double *list = nullptr;
-  if (comm->me == 0) {
-    list = new double[nsize];
-    list[0] = energy;
-    list[1] = comm->nprocs;
-  }
-  double state[PRNGSIZE];
-  random->get_state(state);
-  MPI_Gather(state,PRNGSIZE,MPI_DOUBLE,list+2,PRNGSIZE,MPI_DOUBLE,0,world);
+  // only the accumulated energy must be saved: the counter-based RNG is a
+  // pure function of seed and timestep, so a restarted run continues the
+  // exact same noise stream without any stored generator state
 
   if (comm->me == 0) {
-    int size = nsize * sizeof(double);
+    double energy_restart = energy;
+    int size = sizeof(double);
     fwrite(&size,sizeof(int),1,fp);
-    fwrite(list,sizeof(double),nsize,fp);
-    delete[] list;
+    fwrite(&energy_restart,sizeof(double),1,fp);
   }
 }
 
@@ -355,11 +351,6 @@ void FixTempCSVR::restart(char *buf)
   auto list = (double *) buf;
 
   energy = list[0];
-  int nprocs = (int) list[1];
-  if (nprocs != comm->nprocs) {
-    if (comm->me == 0)
-      error->warning(FLERR,"Different number of procs. Cannot restore RNG state.");
-  } else random->set_state(list+2+comm->me*PRNGSIZE);
 }
 
 /* ----------------------------------------------------------------------
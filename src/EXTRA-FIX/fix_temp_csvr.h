@@ -49,7 +49,7 @@ class FixTempCSVR : public Fix {
   class Compute *temperature;
   int tflag;
 
-  class RanMars *random;
+  class RanCounter *random;
 
  private:
   double resamplekin(double, double);
@@ -137,6 +137,8 @@ void PairLJCutDipoleLongGPU::init_style()
   if (!atom->q_flag || !atom->mu_flag || !atom->torque_flag)
     error->all(FLERR, "Pair dipole/cut/gpu requires atom attributes q, mu, torque");
 
+  atom->add_ghost_field("mu");
+
   if (strcmp(update->unit_style, "electron") == 0)
     error->all(FLERR, "Cannot (yet) use 'electron' units with dipoles");
 
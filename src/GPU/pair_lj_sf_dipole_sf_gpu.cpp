@@ -130,6 +130,8 @@ void PairLJSFDipoleSFGPU::init_style()
   if (!atom->q_flag || !atom->mu_flag || !atom->torque_flag)
     error->all(FLERR, "Pair dipole/sf/gpu requires atom attributes q, mu, torque");
 
+  atom->add_ghost_field("mu");
+
   if (strcmp(update->unit_style, "electron") == 0)
     error->all(FLERR, "Cannot (yet) use 'electron' units with dipoles");
 
@@ -38,24 +38,38 @@ FixHeatFlow::FixHeatFlow(LAMMPS *lmp, int narg, char **arg) : Fix(lmp, narg, arg
   comm_forward = 1;
   comm_reverse = 1;
 
+  int iarg;
   int ntypes = atom->ntypes;
   if (strcmp(arg[3], "constant") == 0) {
-    if (narg != 5) error->all(FLERR, "Illegal fix heat/flow constant command");
+    if (narg < 5) error->all(FLERR, "Illegal fix heat/flow constant command");
     cp_style = CONSTANT;
     cp = utils::numeric(FLERR, arg[4], false, lmp);
     if (cp < 0.0) error->all(FLERR, "Illegal fix heat/flow constant command value");
+    iarg = 5;
   } else if (strcmp(arg[3], "type") == 0) {
-    if (narg != 4 + ntypes) error->all(FLERR, "Illegal fix heat/flow type command");
+    if (narg < 4 + ntypes) error->all(FLERR, "Illegal fix heat/flow type command");
     cp_style = TYPE;
     memory->create(cp_type, ntypes + 1, "fix_heat_flow:cp_type");
     for (int i = 1; i <= ntypes; i++) {
       cp_type[i] = utils::numeric(FLERR, arg[3 + i], false, lmp);
       if (cp_type[i] < 0.0) error->all(FLERR, "Illegal fix heat/flow type command value");
     }
+    iarg = 4 + ntypes;
   } else {
     error->all(FLERR, "Unknown fix heat/flow keyword {}", arg[3]);
   }
 
+  while (iarg < narg) {
+    if (strcmp(arg[iarg], "nevery") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix heat/flow nevery", error);
+      nevery = utils::inumeric(FLERR, arg[iarg + 1], false, lmp);
+      if (nevery <= 0) error->all(FLERR, "Illegal fix heat/flow nevery value {}", arg[iarg + 1]);
+      iarg += 2;
+    } else {
+      error->all(FLERR, "Unknown fix heat/flow keyword {}", arg[iarg]);
+    }
+  }
+
   if (cp_style == NONE) error->all(FLERR, "Must specify specific heat in fix heat/flow");
   dynamic_group_allow = 1;
 }
@@ -81,6 +95,12 @@ void FixHeatFlow::init()
     error->all(FLERR, "Fix heat/flow requires atom style with temperature property");
   if (!atom->heatflow_flag)
     error->all(FLERR, "Fix heat/flow requires atom style with heatflow property");
+
+  // pair granular evaluates its heat models at a single cadence,
+  // so all instances of this fix must agree on the sub-cycling interval
+  for (const auto &ifix : modify->get_fix_by_style("heat/flow"))
+    if (ifix->nevery != nevery)
+      error->all(FLERR, "All fix heat/flow instances must use the same nevery value");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -103,11 +123,12 @@ void FixHeatFlow::setup_pre_force(int /*vflag*/)
 
 void FixHeatFlow::pre_force(int /*vflag*/)
 {
-  // send updated temperatures to ghosts if first instance of fix
-  // then clear heatflow for next force calculation
+  // send updated temperatures to ghosts if first instance of fix and
+  // heat flow is evaluated this step, then clear heatflow for next
+  // force calculation
   double *heatflow = atom->heatflow;
   if (first_flag) {
-    comm->forward_comm(this);
+    if (update->ntimestep % nevery == 0) comm->forward_comm(this);
     for (int i = 0; i < atom->nmax; i++) heatflow[i] = 0.0;
   }
 }
@@ -117,6 +138,10 @@ void FixHeatFlow::pre_force(int /*vflag*/)
 void FixHeatFlow::final_integrate()
 {
   // update temperature of atoms in group
+  // with sub-cycling, skip off-steps and integrate flux over nevery steps
+
+  if (update->ntimestep % nevery) return;
+  double dt_thermal = dt * nevery;
 
   double *temperature = atom->temperature;
   double *heatflow = atom->heatflow;
@@ -132,10 +157,10 @@ void FixHeatFlow::final_integrate()
 
   if (rmass) {
     for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) temperature[i] += dt * heatflow[i] / (calc_cp(i) * rmass[i]);
+      if (mask[i] & groupbit) temperature[i] += dt_thermal * heatflow[i] / (calc_cp(i) * rmass[i]);
   } else {
     for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) temperature[i] += dt * heatflow[i] / (calc_cp(i) * mass[type[i]]);
+      if (mask[i] & groupbit) temperature[i] += dt_thermal * heatflow[i] / (calc_cp(i) * mass[type[i]]);
   }
 }
 
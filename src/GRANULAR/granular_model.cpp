@@ -53,6 +53,7 @@ GranularModel::GranularModel(LAMMPS *lmp) : Pointers(lmp)
 {
   limit_damping = 0;
   beyond_contact = 0;
+  heat_update = 1;
   nondefault_history_transfer = 0;
   classic_model = 0;
   contact_type = PAIR;
@@ -493,7 +494,7 @@ void GranularModel::calculate_forces()
     if (contact_type == PAIR) sub3(torquesj, tortwist, torquesj);
   }
 
-  if (heat_defined) {
+  if (heat_defined && heat_update) {
     dq = heat_model->calculate_heat();
   }
 }
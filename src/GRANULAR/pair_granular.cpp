@@ -72,6 +72,7 @@ PairGranular::PairGranular(LAMMPS *lmp) : Pair(lmp)
   beyond_contact = 0;
   nondefault_history_transfer = 0;
   heat_flag = 0;
+  heat_every = 1;
 
   // create dummy fix as placeholder for FixNeighHistory
   // this is so final order of Modify:fix will conform to input script
@@ -120,11 +121,14 @@ void PairGranular::compute(int eflag, int vflag)
 
   bool touchflag = false;
   const bool history_update = update->setupflag == 0;
+  const bool heat_update = heat_flag && (update->ntimestep % heat_every == 0);
 
   class GranularModel* model;
 
-  for (int i = 0; i < nmodels; i++)
+  for (int i = 0; i < nmodels; i++) {
     models_list[i]->history_update = history_update;
+    models_list[i]->heat_update = heat_update;
+  }
 
   ev_init(eflag,vflag);
 
@@ -194,14 +198,41 @@ void PairGranular::compute(int eflag, int vflag)
       jtype = type[j];
       model = models_list[types_indices[itype][jtype]];
 
-      // Reset model and copy initial geometric data
-      model->xi = x[i];
-      model->xj = x[j];
-      model->radi = radius[i];
-      model->radj = radius[j];
-      if (use_history) model->touch = touch[jj];
+      if (!model->beyond_contact) {
+
+        // inline overlap test, equivalent to check_contact() for models
+        // without beyond-contact interactions: avoids the model state
+        // stores and virtual submodel call for non-touching neighbors,
+        // which are the common case with a finite neighbor skin
+
+        double dxij[3], rsq, radsum;
+        sub3(x[i], x[j], dxij);
+        rsq = lensq3(dxij);
+        radsum = radius[i] + radius[j];
+        touchflag = (rsq < radsum * radsum);
+
+        if (touchflag) {
+          model->xi = x[i];
+          model->xj = x[j];
+          model->radi = radius[i];
+          model->radj = radius[j];
+          copy3(dxij, model->dx);
+          model->rsq = rsq;
+          model->radsum = radsum;
+          model->Reff = radius[i] * radius[j] / radsum;
+          model->touch = true;
+        }
+      } else {
 
-      touchflag = model->check_contact();
+        // Reset model and copy initial geometric data
+        model->xi = x[i];
+        model->xj = x[j];
+        model->radi = radius[i];
+        model->radj = radius[j];
+        if (use_history) model->touch = touch[jj];
+
+        touchflag = model->check_contact();
+      }
 
       if (!touchflag) {
         // unset non-touching neighbors
@@ -240,7 +271,7 @@ void PairGranular::compute(int eflag, int vflag)
         model->history = history;
       }
 
-      if (heat_flag) {
+      if (heat_update) {
         model->Ti = temperature[i];
         model->Tj = temperature[j];
       }
@@ -264,7 +295,7 @@ void PairGranular::compute(int eflag, int vflag)
         add3(torque[j], torquesj, torque[j]);
       }
 
-      if (heat_flag) {
+      if (heat_update) {
         dq = model->dq;
         heatflow[i] += dq;
         if (force->newton_pair || j < nlocal) heatflow[j] -= dq;
@@ -410,6 +441,11 @@ void PairGranular::init_style()
       error->all(FLERR,"Heat conduction in pair granular requires atom style with temperature property");
     if (!atom->heatflow_flag)
       error->all(FLERR,"Heat conduction in pair granular requires atom style with heatflow property");
+
+    // adopt thermal sub-cycling interval declared by fix heat/flow, if any
+    heat_every = 1;
+    auto fixlist = modify->get_fix_by_style("heat/flow");
+    if (fixlist.size() > 0) heat_every = fixlist[0]->nevery;
   }
 
   // allocate history and initialize models
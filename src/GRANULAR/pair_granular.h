@@ -72,6 +72,7 @@ class PairGranular : public Pair {
  private:
   int size_history;
   int heat_flag;
+  int heat_every;    // evaluate heat models every this many steps (fix heat/flow nevery)
 
   // granular models
   int nmodels, maxmodels;
@@ -356,17 +356,17 @@ void FixIntel::init()
     _single_buffers->set_torque_flag(_torque_flag);
     _single_buffers->zero_ev();
     _single_buffers->grow_ncache(off_mode, comm->nthreads);
-    _single_buffers->free_list_ptrs();
+    _single_buffers->invalidate_list_ptrs();
   } else if (_precision_mode == PREC_MODE_MIXED) {
     _mixed_buffers->set_torque_flag(_torque_flag);
     _mixed_buffers->zero_ev();
     _mixed_buffers->grow_ncache(off_mode, comm->nthreads);
-    _mixed_buffers->free_list_ptrs();
+    _mixed_buffers->invalidate_list_ptrs();
   } else {
     _double_buffers->set_torque_flag(_torque_flag);
     _double_buffers->zero_ev();
     _double_buffers->grow_ncache(off_mode, comm->nthreads);
-    _double_buffers->free_list_ptrs();
+    _double_buffers->invalidate_list_ptrs();
   }
 
   _need_reduce = 0;
@@ -514,6 +514,35 @@ void FixIntel::pair_init_check(const bool cdmessage)
       utils::logmesg(lmp,"AVX512 CD Optimizations: Disabled\n");
       #endif
     }
+
+    // report force styles in this setup that will not use INTEL kernels,
+    // so slow paths are visible up front instead of in the final timings
+
+    std::string slow;
+    if (_pair_hybrid_flag) {
+      auto hybrid = dynamic_cast<PairHybrid *>(force->pair);
+      if (hybrid)
+        for (int i = 0; i < hybrid->nstyles; i++)
+          if (!utils::strmatch(hybrid->keywords[i],"/intel$"))
+            slow += fmt::format(" pair:{}",hybrid->keywords[i]);
+    }
+    if (force->bond && !utils::strmatch(force->bond_style,"/intel$") &&
+        strcmp(force->bond_style,"zero") != 0)
+      slow += fmt::format(" bond:{}",force->bond_style);
+    if (force->angle && !utils::strmatch(force->angle_style,"/intel$") &&
+        strcmp(force->angle_style,"zero") != 0)
+      slow += fmt::format(" angle:{}",force->angle_style);
+    if (force->dihedral && !utils::strmatch(force->dihedral_style,"/intel$") &&
+        strcmp(force->dihedral_style,"zero") != 0)
+      slow += fmt::format(" dihedral:{}",force->dihedral_style);
+    if (force->improper && !utils::strmatch(force->improper_style,"/intel$") &&
+        strcmp(force->improper_style,"zero") != 0)
+      slow += fmt::format(" improper:{}",force->improper_style);
+    if (force->kspace && !utils::strmatch(force->kspace_style,"/intel$"))
+      slow += fmt::format(" kspace:{}",force->kspace_style);
+    if (slow.size())
+      utils::logmesg(lmp,"Styles without INTEL acceleration:{}\n",slow);
+
     utils::logmesg(lmp, "----------------------------------------------------------\n");
   }
   _print_pkg_info = 0;
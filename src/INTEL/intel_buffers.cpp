@@ -292,6 +292,18 @@ void IntelBuffers<flt_t, acc_t>::free_list_ptrs()
   _n_list_ptrs = 1;
 }
 
+/* ----------------------------------------------------------------------
+   unbind per-list scratch from NeighList objects that may be deleted
+   between runs, but keep the allocations warm for reuse by grow_data3()
+------------------------------------------------------------------------- */
+
+template <class flt_t, class acc_t>
+void IntelBuffers<flt_t, acc_t>::invalidate_list_ptrs()
+{
+  for (int list_num = 1; list_num < _n_list_ptrs; list_num++)
+    _neigh_list_ptrs[list_num].list_ptr = nullptr;
+}
+
 /* ---------------------------------------------------------------------- */
 
 template <class flt_t, class acc_t>
@@ -302,16 +314,21 @@ void IntelBuffers<flt_t, acc_t>::grow_data3(NeighList *list, int *&numneighhalf,
   for (list_num = 0; list_num < _n_list_ptrs; list_num++)
     if (_neigh_list_ptrs[list_num].list_ptr == (void*)list) break;
   if (list_num == _n_list_ptrs) {
-    if (_n_list_ptrs == _max_list_ptrs) {
-      _max_list_ptrs *= 2;
-      auto new_list = new IntelNeighListPtrs[_max_list_ptrs];
-      for (int i = 0; i < _n_list_ptrs; i++) new_list[i] = _neigh_list_ptrs[i];
-      delete []_neigh_list_ptrs;
-      _neigh_list_ptrs = new_list;
+    // reuse a slot unbound by invalidate_list_ptrs() along with its storage
+    for (list_num = 1; list_num < _n_list_ptrs; list_num++)
+      if (_neigh_list_ptrs[list_num].list_ptr == nullptr) break;
+    if (list_num == _n_list_ptrs) {
+      if (_n_list_ptrs == _max_list_ptrs) {
+        _max_list_ptrs *= 2;
+        auto new_list = new IntelNeighListPtrs[_max_list_ptrs];
+        for (int i = 0; i < _n_list_ptrs; i++) new_list[i] = _neigh_list_ptrs[i];
+        delete []_neigh_list_ptrs;
+        _neigh_list_ptrs = new_list;
+      }
+      _neigh_list_ptrs[list_num].size = 0;
+      _n_list_ptrs++;
     }
     _neigh_list_ptrs[list_num].list_ptr = (void *)list;
-    _neigh_list_ptrs[list_num].size = 0;
-    _n_list_ptrs++;
   }
   if (size > _neigh_list_ptrs[list_num].size) {
     if (_neigh_list_ptrs[list_num].size) {
@@ -167,6 +167,7 @@ class IntelBuffers {
   }
   void grow_data3(NeighList *list, int *&numneighhalf, int *&cnumneigh);
   void free_list_ptrs();
+  void invalidate_list_ptrs();
 
   inline atom_t * get_x(const int offload = 1) {
     #ifdef _LMP_INTEL_OFFLOAD
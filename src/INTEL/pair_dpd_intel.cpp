@@ -489,6 +489,9 @@ void PairDPDIntel::settings(int narg, char **arg) {
 
 void PairDPDIntel::init_style()
 {
+  if (saru_flag)
+    error->all(FLERR, "Pair style dpd/intel does not support the saru keyword");
+
   PairDPD::init_style();
   if (force->newton_pair == 0)
     neighbor->find_request(this)->enable_full();
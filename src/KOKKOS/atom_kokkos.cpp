@@ -48,6 +48,9 @@ AtomKokkos::AtomKokkos(LAMMPS *lmp) : Atom(lmp)
 
   nprop_atom = 0;
   fix_prop_atom = nullptr;
+
+  snapshot_instance_init = 0;
+  snapshot_pending = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -154,6 +157,8 @@ void AtomKokkos::update_property_atom()
 
 void AtomKokkos::sync(const ExecutionSpace space, unsigned int mask)
 {
+  if (space == Host && (mask & X_MASK)) fence_host_snapshot();
+
   if (space == Device && lmp->kokkos->auto_sync) {
     avecKK->modified(Host, mask);
     for (int n = 0; n < nprop_atom; n++) fix_prop_atom[n]->modified(Host, mask);
@@ -180,9 +185,48 @@ void AtomKokkos::modified(const ExecutionSpace space, unsigned int mask)
 
 void AtomKokkos::sync_overlapping_device(const ExecutionSpace space, unsigned int mask)
 {
+  if (space == Host && (mask & X_MASK)) fence_host_snapshot();
+
   avecKK->sync_overlapping_device(space, mask);
   for (int n = 0; n < nprop_atom; n++) fix_prop_atom[n]->sync_overlapping_device(space, mask);
 }
+
+/* ----------------------------------------------------------------------
+   start copying coordinates to the host on a side execution space
+   instance without blocking, so the transfer overlaps device work.
+   used ahead of output steps: once positions are final for the step,
+   the copy runs concurrently with the force computation and the sync
+   at the output is a no-op.  any consumer that syncs coordinates to
+   the host first waits on the in-flight copy via fence_host_snapshot()
+------------------------------------------------------------------------- */
+
+void AtomKokkos::start_host_snapshot()
+{
+  if (!k_x.need_sync<LMPHostType>()) return;
+
+  if (!snapshot_instance_init) {
+    auto instances = Kokkos::Experimental::partition_space(LMPDeviceType(),1);
+    snapshot_instance = instances[0];
+    snapshot_instance_init = 1;
+  }
+
+  // order the copy after all kernels that produced x, then issue it
+  // asynchronously and mark x as in sync so the later sync is a no-op
+
+  LMPDeviceType().fence();
+  Kokkos::deep_copy(snapshot_instance,k_x.h_view,k_x.d_view);
+  k_x.clear_sync_state();
+  snapshot_pending = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void AtomKokkos::fence_host_snapshot()
+{
+  if (!snapshot_pending) return;
+  snapshot_instance.fence();
+  snapshot_pending = 0;
+}
 /* ---------------------------------------------------------------------- */
 
 void AtomKokkos::allocate_type_arrays()
@@ -338,6 +382,7 @@ int AtomKokkos::add_custom(const char *name, int flag, int cols, int ghost)
   if (index < 0)
     error->all(FLERR,"Invalid call to AtomKokkos::add_custom()");
 
+  register_custom(name, index, flag, cols);
   return index;
 }
 
@@ -352,23 +397,27 @@ void AtomKokkos::remove_custom(int index, int flag, int cols)
   if (flag == 0 && cols == 0) {
     memory->destroy(ivector[index]);
     ivector[index] = nullptr;
+    deregister_custom(ivname[index]);
     delete[] ivname[index];
     ivname[index] = nullptr;
 
   } else if (flag == 1 && cols == 0) {
     dvector[index] = nullptr;
+    deregister_custom(dvname[index]);
     delete[] dvname[index];
     dvname[index] = nullptr;
 
   } else if (flag == 0 && cols) {
     memory->destroy(iarray[index]);
     iarray[index] = nullptr;
+    deregister_custom(ianame[index]);
     delete[] ianame[index];
     ianame[index] = nullptr;
 
   } else if (flag == 1 && cols) {
     memory->destroy(darray[index]);
     darray[index] = nullptr;
+    deregister_custom(daname[index]);
     delete[] daname[index];
     daname[index] = nullptr;
   }
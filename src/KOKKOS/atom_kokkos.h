@@ -164,6 +164,8 @@ class AtomKokkos : public Atom {
   void sync(const ExecutionSpace space, unsigned int mask);
   void modified(const ExecutionSpace space, unsigned int mask);
   void sync_overlapping_device(const ExecutionSpace space, unsigned int mask);
+  void start_host_snapshot();
+  void fence_host_snapshot();
   void sort() override;
   int add_custom(const char *, int, int, int border = 0) override;
   void remove_custom(int, int, int) override;
@@ -173,6 +175,12 @@ class AtomKokkos : public Atom {
   void map_set_host();
 
  private:
+  // asynchronous coordinate copy to host ahead of output steps
+
+  LMPDeviceType snapshot_instance;
+  int snapshot_instance_init;
+  int snapshot_pending;
+
   void sort_device();
   class AtomVec *new_avec(const std::string &, int, int &) override;
 };
@@ -73,6 +73,10 @@ CommKokkos::CommKokkos(LAMMPS *lmp) : CommBrick(lmp)
   }
   memoryKK->create_kokkos(k_sendlist,sendlist,maxswap,BUFMIN,"comm:sendlist");
 
+  memory->create(maxsendindex,maxswap,"comm:maxsendindex");
+  for (int i = 0; i < maxswap; i++) maxsendindex[i] = -1;
+  fc_requests = new MPI_Request[maxswap];
+
   max_buf_pair = 0;
   k_buf_send_pair = DAT::tdual_xfloat_1d("comm:k_buf_send_pair",1);
   k_buf_recv_pair = DAT::tdual_xfloat_1d("comm:k_recv_send_pair",1);
@@ -92,6 +96,8 @@ CommKokkos::~CommKokkos()
   buf_send = nullptr;
   memoryKK->destroy_kokkos(k_buf_recv,buf_recv);
   buf_recv = nullptr;
+  memory->destroy(maxsendindex);
+  delete [] fc_requests;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -110,6 +116,7 @@ void CommKokkos::init()
   forward_pair_comm_classic = lmp->kokkos->forward_pair_comm_classic;
   reverse_pair_comm_classic = lmp->kokkos->reverse_pair_comm_classic;
   forward_fix_comm_classic = lmp->kokkos->forward_fix_comm_classic;
+  reverse_fix_comm_classic = lmp->kokkos->reverse_fix_comm_classic;
   reverse_comm_classic = lmp->kokkos->reverse_comm_classic;
   exchange_comm_on_host = lmp->kokkos->exchange_comm_on_host;
   forward_comm_on_host = lmp->kokkos->forward_comm_on_host;
@@ -203,30 +210,62 @@ void CommKokkos::forward_comm_device()
     k_pbc.sync<DeviceType>();
     n = atomKK->avecKK->pack_comm_self_fused(totalsend,k_sendlist,k_sendnum_scan,
                     k_firstrecv,k_pbc_flag,k_pbc,k_g2l);
-  } else {
+  } else if (comm_x_only) {
+
+    // pipelined halo exchange: receives land directly in x, so defer each
+    // wait until a later swap packs or copies atoms that receive delivers
+    // (sendlist indices <= maxsendindex), letting independent transfers,
+    // e.g. the two swaps of each dimension, be in flight concurrently
+
+    int iwait = 0;
 
     for (int iswap = 0; iswap < nswap; iswap++) {
+
+      // complete earlier receives this swap's sendlist depends on
+      // firstrecv increases monotonically with the swap index
+
+      while (iwait < iswap && firstrecv[iwait] <= maxsendindex[iswap]) {
+        if (sendproc[iwait] != me && size_forward_recv[iwait])
+          MPI_Wait(&fc_requests[iwait],MPI_STATUS_IGNORE);
+        iwait++;
+      }
+
       if (sendproc[iswap] != me) {
-        if (comm_x_only) {
-          if (size_forward_recv[iswap]) {
-            buf = atomKK->k_x.view<DeviceType>().data() +
-              firstrecv[iswap]*atomKK->k_x.view<DeviceType>().extent(1);
-            MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
-                      recvproc[iswap],0,world,&request);
-          }
+        if (size_forward_recv[iswap]) {
+          buf = atomKK->k_x.view<DeviceType>().data() +
+            firstrecv[iswap]*atomKK->k_x.view<DeviceType>().extent(1);
+          MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
+                    recvproc[iswap],0,world,&fc_requests[iswap]);
+        }
+        auto k_sendlist_iswap = Kokkos::subview(k_sendlist,iswap,Kokkos::ALL);
+        n = atomKK->avecKK->pack_comm_kokkos(sendnum[iswap],k_sendlist_iswap,
+                                   k_buf_send,pbc_flag[iswap],pbc[iswap]);
+        DeviceType().fence();
+        if (n) {
+          MPI_Send(k_buf_send.view<DeviceType>().data(),
+                   n,MPI_DOUBLE,sendproc[iswap],0,world);
+        }
+      } else {
+        if (sendnum[iswap]) {
           auto k_sendlist_iswap = Kokkos::subview(k_sendlist,iswap,Kokkos::ALL);
-          n = atomKK->avecKK->pack_comm_kokkos(sendnum[iswap],k_sendlist_iswap,
-                                     k_buf_send,pbc_flag[iswap],pbc[iswap]);
+          n = atomKK->avecKK->pack_comm_self(sendnum[iswap],k_sendlist_iswap,
+                                   firstrecv[iswap],pbc_flag[iswap],pbc[iswap]);
           DeviceType().fence();
-          if (n) {
-            MPI_Send(k_buf_send.view<DeviceType>().data(),
-                     n,MPI_DOUBLE,sendproc[iswap],0,world);
-          }
+        }
+      }
+    }
 
-          if (size_forward_recv[iswap])
-            MPI_Wait(&request,MPI_STATUS_IGNORE);
+    // complete any receives still in flight
 
-        } else if (ghost_velocity) {
+    for (; iwait < nswap; iwait++)
+      if (sendproc[iwait] != me && size_forward_recv[iwait])
+        MPI_Wait(&fc_requests[iwait],MPI_STATUS_IGNORE);
+
+  } else {
+
+    for (int iswap = 0; iswap < nswap; iswap++) {
+      if (sendproc[iswap] != me) {
+        if (ghost_velocity) {
           if (size_forward_recv[iswap]) {
             MPI_Irecv(k_buf_recv.view<DeviceType>().data(),
                       size_forward_recv[iswap],MPI_DOUBLE,
@@ -463,8 +502,78 @@ void CommKokkos::forward_comm_device(Fix *fix, int size)
 
 void CommKokkos::reverse_comm(Fix *fix, int size)
 {
-  k_sendlist.sync<LMPHostType>();
-  CommBrick::reverse_comm(fix, size);
+  if (fix->execution_space == Host || !fix->reverse_comm_device || reverse_fix_comm_classic) {
+    k_sendlist.sync<LMPHostType>();
+    CommBrick::reverse_comm(fix, size);
+  } else {
+    k_sendlist.sync<LMPDeviceType>();
+    reverse_comm_device<LMPDeviceType>(fix,size);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void CommKokkos::reverse_comm_device(Fix *fix, int size)
+{
+  int iswap,n,nsize;
+  MPI_Request request;
+  DAT::tdual_xfloat_1d k_buf_tmp;
+
+  if (size) nsize = size;
+  else nsize = fix->comm_reverse;
+  KokkosBase* fixKKBase = dynamic_cast<KokkosBase*>(fix);
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+    int n = MAX(max_buf_fix,nsize*sendnum[iswap]);
+    n = MAX(n,nsize*recvnum[iswap]);
+    if (n > max_buf_fix)
+      grow_buf_fix(n);
+  }
+
+  for (iswap = nswap-1; iswap >= 0; iswap--) {
+
+    // pack buffer
+
+    n = fixKKBase->pack_reverse_comm_kokkos(recvnum[iswap],firstrecv[iswap],k_buf_send_fix);
+    DeviceType().fence();
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+
+    if (sendproc[iswap] != me) {
+      double* buf_send_fix;
+      double* buf_recv_fix;
+      if (lmp->kokkos->gpu_aware_flag) {
+        buf_send_fix = k_buf_send_fix.view<DeviceType>().data();
+        buf_recv_fix = k_buf_recv_fix.view<DeviceType>().data();
+      } else {
+        k_buf_send_fix.modify<DeviceType>();
+        k_buf_send_fix.sync<LMPHostType>();
+        buf_send_fix = k_buf_send_fix.h_view.data();
+        buf_recv_fix = k_buf_recv_fix.h_view.data();
+      }
+
+      if (sendnum[iswap])
+        MPI_Irecv(buf_recv_fix,nsize*sendnum[iswap],MPI_DOUBLE,
+                  sendproc[iswap],0,world,&request);
+      if (recvnum[iswap])
+        MPI_Send(buf_send_fix,n,MPI_DOUBLE,recvproc[iswap],0,world);
+      if (sendnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+
+      if (!lmp->kokkos->gpu_aware_flag) {
+        k_buf_recv_fix.modify<LMPHostType>();
+        k_buf_recv_fix.sync<DeviceType>();
+      }
+      k_buf_tmp = k_buf_recv_fix;
+    } else k_buf_tmp = k_buf_send_fix;
+
+    // unpack buffer
+
+    auto k_sendlist_iswap = Kokkos::subview(k_sendlist,iswap,Kokkos::ALL);
+    fixKKBase->unpack_reverse_comm_kokkos(sendnum[iswap],k_sendlist_iswap,k_buf_tmp);
+    DeviceType().fence();
+  }
 }
 
 
@@ -1078,6 +1187,15 @@ void CommKokkos::borders()
     lmp->kokkos->auto_sync = prev_auto_sync;
     k_sendlist.modify<LMPHostType>();
     atomKK->modified(Host,ALL_MASK);
+
+    // record max atom index in each sendlist for pipelined forward comm
+
+    for (int iswap = 0; iswap < nswap; iswap++) {
+      int maxindex = -1;
+      for (int i = 0; i < sendnum[iswap]; i++)
+        maxindex = MAX(maxindex,sendlist[iswap][i]);
+      maxsendindex[iswap] = maxindex;
+    }
   }
 
   if (comm->nprocs == 1 && !ghost_velocity && !forward_comm_classic)
@@ -1342,6 +1460,11 @@ void CommKokkos::borders_device() {
       }
       // set all pointers & counters
 
+      // atoms in this sendlist came from [nfirst,nlast), so nlast-1 bounds
+      // the largest index the pipelined forward comm must have received
+
+      maxsendindex[iswap] = nsend ? nlast-1 : -1;
+
       smax = MAX(smax,nsend);
       rmax = MAX(rmax,nrecv);
       sendnum[iswap] = nsend;
@@ -1545,6 +1668,11 @@ void CommKokkos::grow_swap(int n)
 
   memory->grow(maxsendlist,n,"comm:maxsendlist");
   for (int i=0;i<maxswap;i++) maxsendlist[i]=size;
+
+  memory->grow(maxsendindex,n,"comm:maxsendindex");
+  for (int i=0;i<maxswap;i++) maxsendindex[i]=-1;
+  delete [] fc_requests;
+  fc_requests = new MPI_Request[n];
 }
 
 /* ----------------------------------------------------------------------
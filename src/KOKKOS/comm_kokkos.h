@@ -29,6 +29,7 @@ class CommKokkos : public CommBrick {
   bool forward_pair_comm_classic;
   bool reverse_pair_comm_classic;
   bool forward_fix_comm_classic;
+  bool reverse_fix_comm_classic;
   bool reverse_comm_classic;
   bool exchange_comm_on_host;
   bool forward_comm_on_host;
@@ -64,6 +65,7 @@ class CommKokkos : public CommBrick {
   template<class DeviceType> void forward_comm_device(Pair *pair);
   template<class DeviceType> void reverse_comm_device(Pair *pair);
   template<class DeviceType> void forward_comm_device(Fix *fix, int size=0);
+  template<class DeviceType> void reverse_comm_device(Fix *fix, int size=0);
   template<class DeviceType> void exchange_device();
   template<class DeviceType> void borders_device();
 
@@ -83,6 +85,9 @@ class CommKokkos : public CommBrick {
   DAT::tdual_int_1d k_sendnum_scan;
   int totalsend;
 
+  int *maxsendindex;             // max atom index in each swap's sendlist
+  MPI_Request *fc_requests;      // in-flight recvs for pipelined forward comm
+
   int max_buf_pair,max_buf_fix;
   DAT::tdual_xfloat_1d k_buf_send_pair, k_buf_send_fix;
   DAT::tdual_xfloat_1d k_buf_recv_pair, k_buf_recv_fix;
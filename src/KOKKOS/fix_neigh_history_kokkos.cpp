@@ -135,7 +135,10 @@ void FixNeighHistoryKokkos<DeviceType>::pre_exchange_no_newton()
     Kokkos::deep_copy(h_resize, d_resize);
 
     if (h_resize()) {
-      maxpartner += 8;
+      // d_resize holds the largest partner count any atom needed:
+      //   grow to it in one step so the kernel reruns at most once,
+      //   instead of incrementing by 8 per device round trip
+      maxpartner = (h_resize() + 7) / 8 * 8;
       memoryKK->grow_kokkos(k_partner,partner,atom->nmax,maxpartner,"neighbor_history:partner");
       memoryKK->grow_kokkos(k_valuepartner,valuepartner,atom->nmax,dnum*maxpartner,"neighbor_history:valuepartner");
     }
@@ -169,7 +172,7 @@ void FixNeighHistoryKokkos<DeviceType>::operator()(TagFixNeighHistoryPreExchange
         for (int k = 0; k < dnum; k++)
           d_valuepartner(i,dnum*m+k) = d_firstvalue(i,dnum*jj+k);
       } else {
-        d_resize() = 1;
+        Kokkos::atomic_max(&d_resize(),m+1);
       }
       if (j < nlocal_neigh) {
         m = Kokkos::atomic_fetch_add(&d_npartner[j],1);
@@ -178,7 +181,7 @@ void FixNeighHistoryKokkos<DeviceType>::operator()(TagFixNeighHistoryPreExchange
           for (int k = 0; k < dnum; k++)
             d_valuepartner(j,dnum*m+k) = -d_firstvalue(i,dnum*jj+k);
         } else {
-          d_resize() = 1;
+          Kokkos::atomic_max(&d_resize(),m+1);
         }
       }
     }
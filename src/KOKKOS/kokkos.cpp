@@ -56,6 +56,7 @@ KokkosLMP::KokkosLMP(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   forward_pair_comm_changed = 0;
   reverse_pair_comm_changed = 0;
   forward_fix_comm_changed = 0;
+  reverse_fix_comm_changed = 0;
   reverse_comm_changed = 0;
   sort_changed = atom_map_changed = 0;
 
@@ -187,6 +188,25 @@ KokkosLMP::KokkosLMP(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   if ((me == 0) && (ngpus > 0))
     utils::logmesg(lmp, "  will use up to {} GPU(s) per node\n", ngpus);
 
+  // each MPI rank drives exactly one GPU, so requesting more GPUs per node
+  // than there are ranks on the node leaves the excess GPUs idle
+
+#if !defined(MPI_STUBS)
+  if (ngpus > 1) {
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(world,MPI_COMM_TYPE_SHARED,me,MPI_INFO_NULL,&node_comm);
+    int node_ranks;
+    MPI_Comm_size(node_comm,&node_ranks);
+    MPI_Comm_free(&node_comm);
+    if (node_ranks < ngpus && me == 0)
+      error->warning(FLERR,"Running with fewer MPI ranks per node ({}) than requested "
+                     "GPUs ({}): excess GPUs will be idle. The KOKKOS package drives "
+                     "one GPU per MPI rank; with a GPU-aware MPI library, halo exchange "
+                     "between ranks on the same node uses direct peer-to-peer copies",
+                     node_ranks,ngpus);
+  }
+#endif
+
 #ifdef LMP_KOKKOS_GPU
   if (ngpus <= 0)
     error->all(FLERR,"Kokkos has been compiled with GPU-enabled backend but no GPUs are requested");
@@ -217,13 +237,16 @@ KokkosLMP::KokkosLMP(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   neigh_thread = 0;
   neigh_thread_set = 0;
   neigh_transpose = 0;
+  neigh_ahead = 0;
+  graph_flag = 0;
   if (ngpus > 0) {
     neighflag = FULL;
     neighflag_qeq = FULL;
     newtonflag = 0;
 
     exchange_comm_classic = forward_comm_classic = reverse_comm_classic = 0;
-    forward_pair_comm_classic = reverse_pair_comm_classic = forward_fix_comm_classic = 0;
+    forward_pair_comm_classic = reverse_pair_comm_classic = 0;
+    forward_fix_comm_classic = reverse_fix_comm_classic = 0;
     sort_classic = 0;
     atom_map_classic = 0;
 
@@ -239,7 +262,8 @@ KokkosLMP::KokkosLMP(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
     newtonflag = 1;
 
     exchange_comm_classic = forward_comm_classic = reverse_comm_classic = 1;
-    forward_pair_comm_classic = reverse_pair_comm_classic = forward_fix_comm_classic = 1;
+    forward_pair_comm_classic = reverse_pair_comm_classic = 1;
+    forward_fix_comm_classic = reverse_fix_comm_classic = 1;
     sort_classic = 1;
     atom_map_classic = 1;
 
@@ -422,17 +446,20 @@ void KokkosLMP::accelerator(int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal package kokkos command");
       if (strcmp(arg[iarg+1],"no") == 0) {
         exchange_comm_classic = forward_comm_classic = reverse_comm_classic = 1;
-        forward_pair_comm_classic = reverse_pair_comm_classic = forward_fix_comm_classic = 1;
+        forward_pair_comm_classic = reverse_pair_comm_classic = 1;
+        forward_fix_comm_classic = reverse_fix_comm_classic = 1;
 
         exchange_comm_on_host = forward_comm_on_host = reverse_comm_on_host = 0;
       } else if (strcmp(arg[iarg+1],"host") == 0) {
         exchange_comm_classic = forward_comm_classic = reverse_comm_classic = 0;
-        forward_pair_comm_classic = reverse_pair_comm_classic = forward_fix_comm_classic = 1;
+        forward_pair_comm_classic = reverse_pair_comm_classic = 1;
+        forward_fix_comm_classic = reverse_fix_comm_classic = 1;
 
         exchange_comm_on_host = forward_comm_on_host = reverse_comm_on_host = 1;
       } else if (strcmp(arg[iarg+1],"device") == 0) {
         exchange_comm_classic = forward_comm_classic = reverse_comm_classic = 0;
-        forward_pair_comm_classic = reverse_pair_comm_classic = forward_fix_comm_classic = 0;
+        forward_pair_comm_classic = reverse_pair_comm_classic = 0;
+        forward_fix_comm_classic = reverse_fix_comm_classic = 0;
 
         exchange_comm_on_host = forward_comm_on_host = reverse_comm_on_host = 0;
       } else error->all(FLERR,"Illegal package kokkos command");
@@ -485,6 +512,14 @@ void KokkosLMP::accelerator(int narg, char **arg)
       else error->all(FLERR,"Illegal package kokkos command");
       forward_fix_comm_changed = 0;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"comm/fix/reverse") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal package kokkos command");
+      if (strcmp(arg[iarg+1],"no") == 0) reverse_fix_comm_classic = 1;
+      else if (strcmp(arg[iarg+1],"host") == 0) reverse_fix_comm_classic = 1;
+      else if (strcmp(arg[iarg+1],"device") == 0) reverse_fix_comm_classic = 0;
+      else error->all(FLERR,"Illegal package kokkos command");
+      reverse_fix_comm_changed = 0;
+      iarg += 2;
     } else if (strcmp(arg[iarg],"comm/reverse") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal package kokkos command");
       else if (strcmp(arg[iarg+1],"no") == 0) reverse_comm_classic = 1;
@@ -531,6 +566,14 @@ void KokkosLMP::accelerator(int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal package kokkos command");
       neigh_transpose = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"neigh/ahead") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal package kokkos command");
+      neigh_ahead = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"graph") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal package kokkos command");
+      graph_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
     } else error->all(FLERR,"Illegal package kokkos command");
   }
 
@@ -562,6 +605,10 @@ void KokkosLMP::accelerator(int narg, char **arg)
       forward_fix_comm_classic = 1;
       forward_fix_comm_changed = 1;
     }
+    if (reverse_fix_comm_classic == 0) {
+      reverse_fix_comm_classic = 1;
+      reverse_fix_comm_changed = 1;
+    }
     if (reverse_comm_classic == 0 && reverse_comm_on_host == 0) {
       reverse_comm_classic = 1;
       reverse_comm_changed = 1;
@@ -602,6 +649,10 @@ void KokkosLMP::accelerator(int narg, char **arg)
       forward_fix_comm_classic = 0;
       forward_fix_comm_changed = 0;
     }
+    if (reverse_fix_comm_changed) {
+      reverse_fix_comm_classic = 0;
+      reverse_fix_comm_changed = 0;
+    }
     if (reverse_comm_changed) {
       reverse_comm_classic = 0;
       reverse_comm_changed = 0;
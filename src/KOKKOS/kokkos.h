@@ -32,6 +32,7 @@ class KokkosLMP : protected Pointers {
   int forward_pair_comm_classic;
   int reverse_pair_comm_classic;
   int forward_fix_comm_classic;
+  int reverse_fix_comm_classic;
   int reverse_comm_classic;
   int sort_classic;
   int atom_map_classic;
@@ -43,6 +44,7 @@ class KokkosLMP : protected Pointers {
   int forward_pair_comm_changed;
   int reverse_pair_comm_changed;
   int forward_fix_comm_changed;
+  int reverse_fix_comm_changed;
   int reverse_comm_changed;
   int sort_changed;
   int atom_map_changed;
@@ -52,6 +54,8 @@ class KokkosLMP : protected Pointers {
   int neigh_thread;
   int neigh_thread_set;
   int neigh_transpose;
+  int neigh_ahead;
+  int graph_flag;
   int newtonflag;
   int allow_overlap;
   double binsize;
@@ -44,6 +44,10 @@ NeighborKokkos::NeighborKokkos(LAMMPS *lmp) : Neighbor(lmp),
   anglelist = nullptr;
   dihedrallist = nullptr;
   improperlist = nullptr;
+
+  dtv_ahead = 0.0;
+  ahead_pending = 0;
+  ahead_flagall = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -192,6 +196,26 @@ int NeighborKokkos::check_distance_kokkos()
     }
   } else deltasq = triggersq;
 
+  // one-step-lookahead mode: return the verdict prepared on the previous
+  // step and immediately start the device check whose result decides the
+  // next step, so the nonblocking allreduce overlaps a full timestep
+  // instead of stalling every rank until the slowest one has drained its
+  // device queue.  the lookahead check tests positions advanced by one
+  // step of the current velocities, so a rebuild still triggers no later
+  // than the blocking check would (up to the velocity change of a single
+  // step).  requires a check every step and a static box, since the
+  // stored trigger distance would go stale across steps
+
+  int lookahead = lmp->kokkos->neigh_ahead && !boxcheck && every == 1;
+
+  if (lookahead && ahead_pending) {
+    check_distance_ahead_wait();
+    int flagall = ahead_flagall;
+    if (!flagall) check_distance_ahead<DeviceType>();
+    if (flagall && ago == MAX(every,delay)) ndanger++;
+    return flagall;
+  }
+
   atomKK->sync(ExecutionSpaceFromDevice<DeviceType>::space,X_MASK);
   x = atomKK->k_x;
   xhold.sync<DeviceType>();
@@ -205,10 +229,67 @@ int NeighborKokkos::check_distance_kokkos()
 
   int flagall;
   MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
+  if (lookahead && !flagall) check_distance_ahead<DeviceType>();
   if (flagall && ago == MAX(every,delay)) ndanger++;
   return flagall;
 }
 
+/* ----------------------------------------------------------------------
+   start the distance check deciding the next step's rebuild: reduce on
+   the device into a device-resident flag and combine it across procs
+   with a nonblocking allreduce which is harvested one step later
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void NeighborKokkos::check_distance_ahead()
+{
+  atomKK->sync(ExecutionSpaceFromDevice<DeviceType>::space,X_MASK|V_MASK);
+  x = atomKK->k_x;
+  v = atomKK->k_v;
+  xhold.sync<DeviceType>();
+  dtv_ahead = update->dt;
+  int nlocal = atom->nlocal;
+  if (includegroup) nlocal = atom->nfirst;
+
+  if (!k_ahead_flag.d_view.data())
+    k_ahead_flag = DAT::tdual_int_scalar("neigh:ahead_flag");
+
+  copymode = 1;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType, TagNeighborCheckDistanceAhead<DeviceType> >(0,nlocal),*this,k_ahead_flag.d_view);
+  copymode = 0;
+  Kokkos::deep_copy(k_ahead_flag.h_view,k_ahead_flag.d_view);
+
+  ahead_flagall = k_ahead_flag.h_view();
+#if !defined(MPI_STUBS)
+  if (nprocs > 1)
+    MPI_Iallreduce(MPI_IN_PLACE,&ahead_flagall,1,MPI_INT,MPI_MAX,world,&ahead_request);
+#endif
+  ahead_pending = 1;
+}
+
+/* ----------------------------------------------------------------------
+   retire a lookahead verdict: after the wait, ahead_flagall holds the
+   global max over all procs
+------------------------------------------------------------------------- */
+
+void NeighborKokkos::check_distance_ahead_wait()
+{
+#if !defined(MPI_STUBS)
+  if (nprocs > 1) MPI_Wait(&ahead_request,MPI_STATUS_IGNORE);
+#endif
+  ahead_pending = 0;
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void NeighborKokkos::operator()(TagNeighborCheckDistanceAhead<DeviceType>, const int &i, int &flag) const {
+  const X_FLOAT delx = x.view<DeviceType>()(i,0) + dtv_ahead*v.view<DeviceType>()(i,0) - xhold.view<DeviceType>()(i,0);
+  const X_FLOAT dely = x.view<DeviceType>()(i,1) + dtv_ahead*v.view<DeviceType>()(i,1) - xhold.view<DeviceType>()(i,1);
+  const X_FLOAT delz = x.view<DeviceType>()(i,2) + dtv_ahead*v.view<DeviceType>()(i,2) - xhold.view<DeviceType>()(i,2);
+  const X_FLOAT rsq = delx*delx + dely*dely + delz*delz;
+  if (rsq > deltasq) flag = 1;
+}
+
 template<class DeviceType>
 KOKKOS_INLINE_FUNCTION
 void NeighborKokkos::operator()(TagNeighborCheckDistance<DeviceType>, const int &i, int &flag) const {
@@ -243,6 +324,12 @@ void NeighborKokkos::build_kokkos(int topoflag)
   ncalls++;
   lastcall = update->ntimestep;
 
+  // a lookahead verdict in flight refers to the positions held before
+  // this rebuild and must be retired; builds are collective, so all
+  // procs discard it together
+
+  if (ahead_pending) check_distance_ahead_wait();
+
   int nlocal = atom->nlocal;
   int nall = nlocal + atom->nghost;
 
@@ -25,6 +25,9 @@ namespace LAMMPS_NS {
 template<class DeviceType>
 struct TagNeighborCheckDistance{};
 
+template<class DeviceType>
+struct TagNeighborCheckDistanceAhead{};
+
 template<class DeviceType>
 struct TagNeighborXhold{};
 
@@ -42,6 +45,10 @@ class NeighborKokkos : public Neighbor {
   KOKKOS_INLINE_FUNCTION
   void operator()(TagNeighborCheckDistance<DeviceType>, const int&, int&) const;
 
+  template<class DeviceType>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagNeighborCheckDistanceAhead<DeviceType>, const int&, int&) const;
+
   template<class DeviceType>
   KOKKOS_INLINE_FUNCTION
   void operator()(TagNeighborXhold<DeviceType>, const int&) const;
@@ -69,8 +76,20 @@ class NeighborKokkos : public Neighbor {
 
   DAT::tdual_x_array x;
   DAT::tdual_x_array xhold;
+  DAT::tdual_v_array v;
 
   X_FLOAT deltasq;
+  X_FLOAT dtv_ahead;
+
+  // one-step-lookahead distance check, see check_distance_kokkos()
+
+  DAT::tdual_int_scalar k_ahead_flag;
+  int ahead_pending;
+  int ahead_flagall;
+  MPI_Request ahead_request;
+
+  template<class DeviceType> void check_distance_ahead();
+  void check_distance_ahead_wait();
 
   void init_cutneighsq_kokkos(int) override;
   void create_kokkos_list(int) override;
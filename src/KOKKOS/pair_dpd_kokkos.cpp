@@ -78,6 +78,9 @@ PairDPDKokkos<DeviceType>::~PairDPDKokkos() {
 template<class DeviceType>
 void PairDPDKokkos<DeviceType>::init_style()
 {
+  if (saru_flag)
+    error->all(FLERR,"Pair style dpd/kk does not support the saru keyword");
+
   PairDPD::init_style();
 
 #ifdef DPD_USE_RAN_MARS
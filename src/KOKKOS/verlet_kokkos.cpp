@@ -18,6 +18,7 @@
 #include "comm.h"
 #include "atom_kokkos.h"
 #include "atom_masks.h"
+#include "error.h"
 #include "force.h"
 #include "pair.h"
 #include "bond.h"
@@ -33,6 +34,68 @@
 
 using namespace LAMMPS_NS;
 
+// thin wrappers around the CUDA/HIP graph APIs used for captured-graph
+// execution of steady-state timesteps: all kernel launches of one step are
+// recorded into a device graph once and replayed with a single launch on
+// subsequent steps.  other backends have no graph support and fall back
+// to kernel-by-kernel launches
+
+#if defined(KOKKOS_ENABLE_CUDA)
+#define LMP_KOKKOS_GRAPH
+typedef cudaStream_t lmp_graph_stream_t;
+typedef cudaGraph_t lmp_graph_t;
+typedef cudaGraphExec_t lmp_graph_exec_t;
+static lmp_graph_stream_t device_graph_stream() {
+  return LMPDeviceType().cuda_stream();
+}
+static bool device_graph_begin(lmp_graph_stream_t stream) {
+  return cudaStreamBeginCapture(stream,cudaStreamCaptureModeThreadLocal) == cudaSuccess;
+}
+static bool device_graph_end(lmp_graph_stream_t stream, lmp_graph_t *graph,
+                             lmp_graph_exec_t *graph_exec) {
+  if (cudaStreamEndCapture(stream,graph) != cudaSuccess) return false;
+  if (cudaGraphInstantiateWithFlags(graph_exec,*graph,0) != cudaSuccess) {
+    cudaGraphDestroy(*graph);
+    return false;
+  }
+  return true;
+}
+static void device_graph_launch(lmp_graph_stream_t stream, lmp_graph_exec_t graph_exec) {
+  cudaGraphLaunch(graph_exec,stream);
+}
+static void device_graph_free(lmp_graph_t graph, lmp_graph_exec_t graph_exec) {
+  cudaGraphExecDestroy(graph_exec);
+  cudaGraphDestroy(graph);
+}
+#elif defined(KOKKOS_ENABLE_HIP)
+#define LMP_KOKKOS_GRAPH
+typedef hipStream_t lmp_graph_stream_t;
+typedef hipGraph_t lmp_graph_t;
+typedef hipGraphExec_t lmp_graph_exec_t;
+static lmp_graph_stream_t device_graph_stream() {
+  return LMPDeviceType().hip_stream();
+}
+static bool device_graph_begin(lmp_graph_stream_t stream) {
+  return hipStreamBeginCapture(stream,hipStreamCaptureModeThreadLocal) == hipSuccess;
+}
+static bool device_graph_end(lmp_graph_stream_t stream, lmp_graph_t *graph,
+                             lmp_graph_exec_t *graph_exec) {
+  if (hipStreamEndCapture(stream,graph) != hipSuccess) return false;
+  if (hipGraphInstantiateWithFlags(graph_exec,*graph,0) != hipSuccess) {
+    hipGraphDestroy(*graph);
+    return false;
+  }
+  return true;
+}
+static void device_graph_launch(lmp_graph_stream_t stream, lmp_graph_exec_t graph_exec) {
+  hipGraphLaunch(graph_exec,stream);
+}
+static void device_graph_free(lmp_graph_t graph, lmp_graph_exec_t graph_exec) {
+  hipGraphExecDestroy(graph_exec);
+  hipGraphDestroy(graph);
+}
+#endif
+
 template<class ViewA, class ViewB>
 struct ForceAdder {
   ViewA a;
@@ -66,6 +129,16 @@ VerletKokkos::VerletKokkos(LAMMPS *lmp, int narg, char **arg) :
   Verlet(lmp, narg, arg)
 {
   atomKK = (AtomKokkos *) atom;
+
+  graph_enabled = graph_capturing = graph_valid = 0;
+  graph_handle = graph_exec_handle = nullptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+VerletKokkos::~VerletKokkos()
+{
+  graph_invalidate();
 }
 
 /* ----------------------------------------------------------------------
@@ -283,6 +356,21 @@ void VerletKokkos::run(int n)
 
   f_merge_copy = DAT::t_f_array("VerletKokkos::f_merge_copy",atomKK->k_f.extent(0));
 
+  // opt-in captured-graph execution of steady-state timesteps:
+  // all kernels of one eligible step are recorded into a device graph and
+  // the whole step is then replayed with a single launch while the step
+  // stays steady, removing the per-kernel launch latency which dominates
+  // small latency-bound steps.  any disturbance discards the recording
+
+  graph_capturing = graph_valid = graph_warmup = 0;
+  graph_enabled = 0;
+  if (lmp->kokkos->graph_flag) {
+    graph_enabled = graph_run_capturable();
+    if (!graph_enabled && comm->me == 0)
+      error->warning(FLERR,"Cannot capture timestep kernels into a device graph "
+                     "for this run: reverting to kernel-by-kernel launches");
+  }
+
   atomKK->sync(Device,ALL_MASK);
 
   timer->init_timeout();
@@ -303,10 +391,42 @@ void VerletKokkos::run(int n)
     if (n_post_integrate) modify->post_integrate();
     timer->stamp(Timer::MODIFY);
 
+    // check if kernels can be fused, must come after initial_integrate
+    // and before the forward communication so a steady-state step can be
+    // identified before its first kernel is launched or captured
+
+    fuse_check(i,n);
+
     // regular communication vs neighbor list rebuild
 
     nflag = neighbor->decide();
 
+    // replay, record, or discard the captured steady-state step
+
+    if (graph_enabled) {
+      if (nflag == 0 && graph_step_capturable()) {
+        if (graph_valid) {
+
+          // replay the recorded step with a single graph launch and skip
+          // the launch-by-launch loop body.  per-category timings do not
+          // exist for a replayed step, so charge it to the pair timer
+
+          timer->stamp();
+          graph_replay();
+          timer->stamp(Timer::PAIR);
+          continue;
+        }
+
+        // let the first eligible step after any disturbance run normally:
+        // it flushes pending host-device syncs which must not be captured
+
+        if (graph_warmup++) graph_begin_capture();
+      } else {
+        graph_invalidate();
+        graph_warmup = 0;
+      }
+    }
+
     if (nflag == 0) {
       timer->stamp();
       comm->forward_comm();
@@ -360,9 +480,11 @@ void VerletKokkos::run(int n)
       }
     }
 
-    // check if kernels can be fused, must come after initial_integrate
+    // if this step ends with output, positions are final now: start
+    // copying them to the host asynchronously so the transfer overlaps
+    // the force computation and the sync at the output does not stall
 
-    fuse_check(i,n);
+    if (ntimestep == output->next) atomKK->start_host_snapshot();
 
     // force computations
     // important for pair to come before bonded contributions
@@ -509,6 +631,15 @@ void VerletKokkos::run(int n)
     if (n_end_of_step) modify->end_of_step();
     timer->stamp(Timer::MODIFY);
 
+    // finish recording the captured step: instantiate the graph, then
+    // launch it once since captured kernel launches did not execute
+
+    if (graph_capturing) {
+      timer->stamp();
+      graph_end_capture();
+      timer->stamp(Timer::PAIR);
+    }
+
     // all output
 
     if (ntimestep == output->next) {
@@ -520,6 +651,8 @@ void VerletKokkos::run(int n)
     }
   }
 
+  graph_invalidate();
+
   atomKK->sync(Host,ALL_MASK);
   lmp->kokkos->auto_sync = 1;
 }
@@ -636,3 +769,120 @@ void VerletKokkos::fuse_check(int i, int n)
   else if (timer->has_timeout()) fuse_integrate = 0;
   else if (!((ModifyKokkos*)modify)->check_fuse_integrate()) fuse_integrate = 0;
 }
+
+/* ----------------------------------------------------------------------
+   check run-constant requirements for capturing steady-state steps:
+   all device work of a step must form one uninterrupted, MPI- and
+   fence-free sequence of kernel launches.  this limits capture to
+   single-rank, newton off runs where the forward communication is the
+   fused on-device self copy, every force style runs on the device, and
+   no fixes beyond the (fusable) integration fix act during a steady step
+------------------------------------------------------------------------- */
+
+int VerletKokkos::graph_run_capturable()
+{
+#if !defined(LMP_KOKKOS_GRAPH)
+  return 0;
+#else
+  if (comm->nprocs > 1) return 0;
+  if (comm->style != Comm::BRICK) return 0;
+  if (comm->ghost_velocity) return 0;
+  if (force->newton) return 0;
+  if (lmp->kokkos->forward_comm_classic || lmp->kokkos->forward_comm_on_host) return 0;
+
+  if (!pair_compute_flag) return 0;
+  if (force->pair->execution_space != Device) return 0;
+  if (atomKK->molecular) {
+    if (force->bond && force->bond->execution_space != Device) return 0;
+    if (force->angle && force->angle->execution_space != Device) return 0;
+    if (force->dihedral && force->dihedral->execution_space != Device) return 0;
+    if (force->improper && force->improper->execution_space != Device) return 0;
+  }
+
+  // kspace solvers use FFTs with their own synchronization
+
+  if (force->kspace) return 0;
+
+  if (modify->n_post_integrate || modify->n_pre_force ||
+      modify->n_pre_reverse || modify->n_post_force_any) return 0;
+
+  return 1;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   check per-step requirements for capturing or replaying the graph:
+   fuse_integrate == 1 excludes output, end-of-step, timeout, and final
+   steps, and energy/virial steps reduce on the host between kernels
+------------------------------------------------------------------------- */
+
+int VerletKokkos::graph_step_capturable()
+{
+  if (!fuse_integrate) return 0;
+  if (eflag || vflag) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   start recording this step's kernel launches into a device graph
+------------------------------------------------------------------------- */
+
+void VerletKokkos::graph_begin_capture()
+{
+#if defined(LMP_KOKKOS_GRAPH)
+  graph_capturing = device_graph_begin(device_graph_stream());
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   stop recording and instantiate the graph for replay
+   since captured launches do not execute, launch the graph once so the
+   capturing step performs its work.  if capture or instantiation failed,
+   give up on graph execution for the rest of this run
+------------------------------------------------------------------------- */
+
+void VerletKokkos::graph_end_capture()
+{
+#if defined(LMP_KOKKOS_GRAPH)
+  graph_capturing = 0;
+  lmp_graph_t graph;
+  lmp_graph_exec_t graph_exec;
+  if (device_graph_end(device_graph_stream(),&graph,&graph_exec)) {
+    graph_handle = (void *) graph;
+    graph_exec_handle = (void *) graph_exec;
+    graph_valid = 1;
+    device_graph_launch(device_graph_stream(),graph_exec);
+  } else {
+    graph_enabled = 0;
+    if (comm->me == 0)
+      error->warning(FLERR,"Capturing timestep kernels into a device graph failed: "
+                     "reverting to kernel-by-kernel launches");
+  }
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   re-execute the recorded step with a single graph launch
+------------------------------------------------------------------------- */
+
+void VerletKokkos::graph_replay()
+{
+#if defined(LMP_KOKKOS_GRAPH)
+  device_graph_launch(device_graph_stream(),(lmp_graph_exec_t) graph_exec_handle);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   discard the recorded step, e.g. after reneighboring changed the atom
+   counts, communication lists, or neighbor list views baked into it
+------------------------------------------------------------------------- */
+
+void VerletKokkos::graph_invalidate()
+{
+#if defined(LMP_KOKKOS_GRAPH)
+  if (graph_valid)
+    device_graph_free((lmp_graph_t) graph_handle,(lmp_graph_exec_t) graph_exec_handle);
+#endif
+  graph_valid = 0;
+  graph_handle = graph_exec_handle = nullptr;
+}
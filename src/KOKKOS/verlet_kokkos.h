@@ -31,6 +31,7 @@ namespace LAMMPS_NS {
 class VerletKokkos : public Verlet {
  public:
   VerletKokkos(class LAMMPS *, int, char **);
+  ~VerletKokkos() override;
 
   void setup(int) override;
   void setup_minimal(int) override;
@@ -49,6 +50,18 @@ class VerletKokkos : public Verlet {
   int fuse_force_clear,fuse_integrate;
 
   void fuse_check(int, int);
+
+  // captured-graph replay of steady-state steps, see graph_run_capturable()
+
+  int graph_enabled,graph_capturing,graph_valid,graph_warmup;
+  void *graph_handle,*graph_exec_handle;
+
+  int graph_run_capturable();
+  int graph_step_capturable();
+  void graph_begin_capture();
+  void graph_end_capture();
+  void graph_replay();
+  void graph_invalidate();
 };
 }
 
@@ -26,8 +26,10 @@
 #include "domain.h"
 #include "error.h"
 #include "force.h"
+#include "group.h"
 #include "math_const.h"
 #include "memory.h"
+#include "neighbor.h"
 #include "pair.h"
 
 #include <cmath>
@@ -44,10 +46,12 @@ Ewald::Ewald(LAMMPS *lmp) : KSpace(lmp),
   ek(nullptr), sfacrl(nullptr), sfacim(nullptr), sfacrl_all(nullptr), sfacim_all(nullptr),
   cs(nullptr), sn(nullptr), sfacrl_A(nullptr), sfacim_A(nullptr), sfacrl_A_all(nullptr),
   sfacim_A_all(nullptr), sfacrl_B(nullptr), sfacim_B(nullptr), sfacrl_B_all(nullptr),
-  sfacim_B_all(nullptr)
+  sfacim_B_all(nullptr), sfacrl_static(nullptr), sfacim_static(nullptr)
 {
   group_allocate_flag = 0;
   kmax_created = 0;
+  dgroupbit = 0;
+  sfac_static_flag = 0;
   ewaldflag = 1;
   group_group_enable = 1;
 
@@ -131,6 +135,21 @@ void Ewald::init()
     error->all(FLERR,"KSpace style is incompatible with Pair style");
   double cutoff = *p_cutoff;
 
+  // find group of moving atoms for incremental structure factor updates
+
+  dgroupbit = 0;
+  sfac_static_flag = 0;
+  if (dgroup.size()) {
+    if (triclinic)
+      error->all(FLERR,"Cannot (yet) use kspace_modify dynamic/group with triclinic box");
+    int igroup = group->find(dgroup);
+    if (igroup < 0)
+      error->all(FLERR,"Cannot find kspace_modify dynamic/group group ID {}",dgroup);
+    if (group->dynamic[igroup])
+      error->all(FLERR,"Kspace_modify dynamic/group group cannot be dynamic");
+    dgroupbit = group->bitmask[igroup];
+  }
+
   // compute qsum & qsqsum and warn if not charge-neutral
 
   scale = 1.0;
@@ -332,6 +351,10 @@ void Ewald::setup()
     coeffs();
   else
     coeffs_triclinic();
+
+  // box size or k-vectors changed, cached static structure factor is stale
+
+  sfac_static_flag = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -382,15 +405,32 @@ void Ewald::compute(int eflag, int vflag)
     memory->create3d_offset(cs,-kmax,kmax,3,nmax,"ewald:cs");
     memory->create3d_offset(sn,-kmax,kmax,3,nmax,"ewald:sn");
     kmax_created = kmax;
+    sfac_static_flag = 0;
   }
 
   // partial structure factors on each processor
   // total structure factor by summing over procs
+  // with a dynamic group, only the phases of moving atoms are recomputed
+  //   and the cached sums of all other atoms are added back on
+  // any step that may have reassigned local atom indices does a full pass
+  //   and refreshes the cached static-atom sums
 
-  if (triclinic == 0)
-    eik_dot_r();
-  else
-    eik_dot_r_triclinic();
+  if (dgroupbit && sfac_static_flag && neighbor->ago != 0) {
+    eik_dot_r_partial(1,sfacrl,sfacim);
+    for (k = 0; k < kcount; k++) {
+      sfacrl[k] += sfacrl_static[k];
+      sfacim[k] += sfacim_static[k];
+    }
+  } else {
+    if (triclinic == 0)
+      eik_dot_r();
+    else
+      eik_dot_r_triclinic();
+    if (dgroupbit) {
+      eik_dot_r_partial(0,sfacrl_static,sfacim_static);
+      sfac_static_flag = 1;
+    }
+  }
 
   MPI_Allreduce(sfacrl,sfacrl_all,kcount,MPI_DOUBLE,MPI_SUM,world);
   MPI_Allreduce(sfacim,sfacim_all,kcount,MPI_DOUBLE,MPI_SUM,world);
@@ -673,6 +713,221 @@ void Ewald::eik_dot_r()
   }
 }
 
+/* ----------------------------------------------------------------------
+   partial structure factor for the moving group or its static complement
+   dynamicflag = 1: recompute phases of atoms in the dynamic group and
+     sum their contribution, used on steps with unchanged atom indices
+   dynamicflag = 0: sum the contribution of all other atoms from the
+     phases the preceding full eik_dot_r() pass left in cs/sn
+------------------------------------------------------------------------- */
+
+void Ewald::eik_dot_r_partial(int dynamicflag, double *sfr, double *sfi)
+{
+  int i,k,l,m,n,ic;
+  double cstr1,sstr1,cstr2,sstr2,cstr3,sstr3,cstr4,sstr4;
+  double sqk,clpm,slpm;
+
+  double **x = atom->x;
+  double *q = atom->q;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  const int want = dynamicflag ? dgroupbit : 0;
+
+  n = 0;
+
+  // (k,0,0), (0,l,0), (0,0,m)
+
+  for (ic = 0; ic < 3; ic++) {
+    sqk = unitk[ic]*unitk[ic];
+    if (sqk <= gsqmx) {
+      cstr1 = 0.0;
+      sstr1 = 0.0;
+      for (i = 0; i < nlocal; i++) {
+        if ((mask[i] & dgroupbit) != want) continue;
+        if (dynamicflag) {
+          cs[0][ic][i] = 1.0;
+          sn[0][ic][i] = 0.0;
+          cs[1][ic][i] = cos(unitk[ic]*x[i][ic]);
+          sn[1][ic][i] = sin(unitk[ic]*x[i][ic]);
+          cs[-1][ic][i] = cs[1][ic][i];
+          sn[-1][ic][i] = -sn[1][ic][i];
+        }
+        cstr1 += q[i]*cs[1][ic][i];
+        sstr1 += q[i]*sn[1][ic][i];
+      }
+      sfr[n] = cstr1;
+      sfi[n++] = sstr1;
+    }
+  }
+
+  for (m = 2; m <= kmax; m++) {
+    for (ic = 0; ic < 3; ic++) {
+      sqk = m*unitk[ic] * m*unitk[ic];
+      if (sqk <= gsqmx) {
+        cstr1 = 0.0;
+        sstr1 = 0.0;
+        for (i = 0; i < nlocal; i++) {
+          if ((mask[i] & dgroupbit) != want) continue;
+          if (dynamicflag) {
+            cs[m][ic][i] = cs[m-1][ic][i]*cs[1][ic][i] -
+              sn[m-1][ic][i]*sn[1][ic][i];
+            sn[m][ic][i] = sn[m-1][ic][i]*cs[1][ic][i] +
+              cs[m-1][ic][i]*sn[1][ic][i];
+            cs[-m][ic][i] = cs[m][ic][i];
+            sn[-m][ic][i] = -sn[m][ic][i];
+          }
+          cstr1 += q[i]*cs[m][ic][i];
+          sstr1 += q[i]*sn[m][ic][i];
+        }
+        sfr[n] = cstr1;
+        sfi[n++] = sstr1;
+      }
+    }
+  }
+
+  // 1 = (k,l,0), 2 = (k,-l,0)
+
+  for (k = 1; k <= kxmax; k++) {
+    for (l = 1; l <= kymax; l++) {
+      sqk = (k*unitk[0] * k*unitk[0]) + (l*unitk[1] * l*unitk[1]);
+      if (sqk <= gsqmx) {
+        cstr1 = 0.0;
+        sstr1 = 0.0;
+        cstr2 = 0.0;
+        sstr2 = 0.0;
+        for (i = 0; i < nlocal; i++) {
+          if ((mask[i] & dgroupbit) != want) continue;
+          cstr1 += q[i]*(cs[k][0][i]*cs[l][1][i] - sn[k][0][i]*sn[l][1][i]);
+          sstr1 += q[i]*(sn[k][0][i]*cs[l][1][i] + cs[k][0][i]*sn[l][1][i]);
+          cstr2 += q[i]*(cs[k][0][i]*cs[l][1][i] + sn[k][0][i]*sn[l][1][i]);
+          sstr2 += q[i]*(sn[k][0][i]*cs[l][1][i] - cs[k][0][i]*sn[l][1][i]);
+        }
+        sfr[n] = cstr1;
+        sfi[n++] = sstr1;
+        sfr[n] = cstr2;
+        sfi[n++] = sstr2;
+      }
+    }
+  }
+
+  // 1 = (0,l,m), 2 = (0,l,-m)
+
+  for (l = 1; l <= kymax; l++) {
+    for (m = 1; m <= kzmax; m++) {
+      sqk = (l*unitk[1] * l*unitk[1]) + (m*unitk[2] * m*unitk[2]);
+      if (sqk <= gsqmx) {
+        cstr1 = 0.0;
+        sstr1 = 0.0;
+        cstr2 = 0.0;
+        sstr2 = 0.0;
+        for (i = 0; i < nlocal; i++) {
+          if ((mask[i] & dgroupbit) != want) continue;
+          cstr1 += q[i]*(cs[l][1][i]*cs[m][2][i] - sn[l][1][i]*sn[m][2][i]);
+          sstr1 += q[i]*(sn[l][1][i]*cs[m][2][i] + cs[l][1][i]*sn[m][2][i]);
+          cstr2 += q[i]*(cs[l][1][i]*cs[m][2][i] + sn[l][1][i]*sn[m][2][i]);
+          sstr2 += q[i]*(sn[l][1][i]*cs[m][2][i] - cs[l][1][i]*sn[m][2][i]);
+        }
+        sfr[n] = cstr1;
+        sfi[n++] = sstr1;
+        sfr[n] = cstr2;
+        sfi[n++] = sstr2;
+      }
+    }
+  }
+
+  // 1 = (k,0,m), 2 = (k,0,-m)
+
+  for (k = 1; k <= kxmax; k++) {
+    for (m = 1; m <= kzmax; m++) {
+      sqk = (k*unitk[0] * k*unitk[0]) + (m*unitk[2] * m*unitk[2]);
+      if (sqk <= gsqmx) {
+        cstr1 = 0.0;
+        sstr1 = 0.0;
+        cstr2 = 0.0;
+        sstr2 = 0.0;
+        for (i = 0; i < nlocal; i++) {
+          if ((mask[i] & dgroupbit) != want) continue;
+          cstr1 += q[i]*(cs[k][0][i]*cs[m][2][i] - sn[k][0][i]*sn[m][2][i]);
+          sstr1 += q[i]*(sn[k][0][i]*cs[m][2][i] + cs[k][0][i]*sn[m][2][i]);
+          cstr2 += q[i]*(cs[k][0][i]*cs[m][2][i] + sn[k][0][i]*sn[m][2][i]);
+          sstr2 += q[i]*(sn[k][0][i]*cs[m][2][i] - cs[k][0][i]*sn[m][2][i]);
+        }
+        sfr[n] = cstr1;
+        sfi[n++] = sstr1;
+        sfr[n] = cstr2;
+        sfi[n++] = sstr2;
+      }
+    }
+  }
+
+  // 1 = (k,l,m), 2 = (k,-l,m), 3 = (k,l,-m), 4 = (k,-l,-m)
+
+  for (k = 1; k <= kxmax; k++) {
+    for (l = 1; l <= kymax; l++) {
+      for (m = 1; m <= kzmax; m++) {
+        sqk = (k*unitk[0] * k*unitk[0]) + (l*unitk[1] * l*unitk[1]) +
+          (m*unitk[2] * m*unitk[2]);
+        if (sqk <= gsqmx) {
+          cstr1 = 0.0;
+          sstr1 = 0.0;
+          cstr2 = 0.0;
+          sstr2 = 0.0;
+          cstr3 = 0.0;
+          sstr3 = 0.0;
+          cstr4 = 0.0;
+          sstr4 = 0.0;
+          for (i = 0; i < nlocal; i++) {
+            if ((mask[i] & dgroupbit) != want) continue;
+            clpm = cs[l][1][i]*cs[m][2][i] - sn[l][1][i]*sn[m][2][i];
+            slpm = sn[l][1][i]*cs[m][2][i] + cs[l][1][i]*sn[m][2][i];
+            cstr1 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
+            sstr1 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
+
+            clpm = cs[l][1][i]*cs[m][2][i] + sn[l][1][i]*sn[m][2][i];
+            slpm = -sn[l][1][i]*cs[m][2][i] + cs[l][1][i]*sn[m][2][i];
+            cstr2 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
+            sstr2 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
+
+            clpm = cs[l][1][i]*cs[m][2][i] + sn[l][1][i]*sn[m][2][i];
+            slpm = sn[l][1][i]*cs[m][2][i] - cs[l][1][i]*sn[m][2][i];
+            cstr3 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
+            sstr3 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
+
+            clpm = cs[l][1][i]*cs[m][2][i] - sn[l][1][i]*sn[m][2][i];
+            slpm = -sn[l][1][i]*cs[m][2][i] - cs[l][1][i]*sn[m][2][i];
+            cstr4 += q[i]*(cs[k][0][i]*clpm - sn[k][0][i]*slpm);
+            sstr4 += q[i]*(sn[k][0][i]*clpm + cs[k][0][i]*slpm);
+          }
+          sfr[n] = cstr1;
+          sfi[n++] = sstr1;
+          sfr[n] = cstr2;
+          sfi[n++] = sstr2;
+          sfr[n] = cstr3;
+          sfi[n++] = sstr3;
+          sfr[n] = cstr4;
+          sfi[n++] = sstr4;
+        }
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   style-specific kspace_modify option
+------------------------------------------------------------------------- */
+
+int Ewald::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0],"dynamic/group") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal kspace_modify dynamic/group command");
+    if (strcmp(arg[1],"none") == 0) dgroup.clear();
+    else dgroup = arg[1];
+    return 2;
+  }
+  return 0;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void Ewald::eik_dot_r_triclinic()
@@ -1140,6 +1395,9 @@ void Ewald::allocate()
   sfacim = new double[kmax3d];
   sfacrl_all = new double[kmax3d];
   sfacim_all = new double[kmax3d];
+
+  sfacrl_static = new double[kmax3d];
+  sfacim_static = new double[kmax3d];
 }
 
 /* ----------------------------------------------------------------------
@@ -1160,6 +1418,11 @@ void Ewald::deallocate()
   delete [] sfacim;
   delete [] sfacrl_all;
   delete [] sfacim_all;
+
+  delete [] sfacrl_static;
+  delete [] sfacim_static;
+  sfacrl_static = nullptr;
+  sfacim_static = nullptr;
 }
 
 /* ----------------------------------------------------------------------
@@ -1235,7 +1498,7 @@ double Ewald::memory_usage()
 {
   double bytes = 3 * kmax3d * sizeof(int);
   bytes += (double)(1 + 3 + 6) * kmax3d * sizeof(double);
-  bytes += (double)4 * kmax3d * sizeof(double);
+  bytes += (double)6 * kmax3d * sizeof(double);
   bytes += (double)nmax*3 * sizeof(double);
   bytes += (double)2 * (2*kmax+1)*3*nmax * sizeof(double);
   return bytes;
@@ -33,6 +33,7 @@ class Ewald : public KSpace {
   void settings(int, char **) override;
   void compute(int, int) override;
   double memory_usage() override;
+  int modify_param(int, char **) override;
 
   void compute_group_group(int, int, int) override;
 
@@ -75,6 +76,14 @@ class Ewald : public KSpace {
   void slabcorr_groups(int, int, int);
   void allocate_groups();
   void deallocate_groups();
+
+  // incremental structure factor update for mostly-static systems
+
+  std::string dgroup;                        // group of moving atoms, empty = disabled
+  int dgroupbit;                             // its group mask bit
+  int sfac_static_flag;                      // 1 if cached static-atom sums are current
+  double *sfacrl_static, *sfacim_static;     // structure factor of non-moving atoms
+  void eik_dot_r_partial(int, double *, double *);
 };
 
 }    // namespace LAMMPS_NS
@@ -27,6 +27,7 @@
 #include "modify.h"
 #include "neighbor.h"
 #include "pair.h"
+#include "pppm.h"
 #include "timer.h"
 #include "update.h"
 
@@ -59,6 +60,11 @@ FixTuneKspace::FixTuneKspace(LAMMPS *lmp, int narg, char **arg) :
 
   ewald_time = pppm_time = msm_time = 0.0;
 
+  pppm_scan_stage = 0;
+  pppm_scan_index = -1;
+  pending_mesh[0] = pending_mesh[1] = pending_mesh[2] = 0;
+  target_accuracy = 0.0;
+
   // parse arguments
 
   nevery = utils::inumeric(FLERR,arg[3],false,lmp);
@@ -164,6 +170,20 @@ void FixTuneKspace::pre_exchange()
     }
     update_pair_style(pair_style,pair_cut_coul);
     update_kspace_style(kspace_style,acc_str);
+
+    // if PPPM won, scan its interpolation order, differentiation mode,
+    // and grid size before optimizing the real-space cutoff
+
+    if (kspace_style == "pppm") {
+      target_accuracy = force->kspace->accuracy;
+      for (int diff = 0; diff <= 1; diff++)
+        for (int ord = 3; ord <= 7; ord++)
+          pppm_trials.push_back({ord,diff,0,0,0,0,0,0,0.0,0.0});
+      pppm_scan_stage = 1;
+      pppm_scan_index = -1;
+    }
+  } else if (pppm_scan_stage) {
+    scan_pppm_params(time);
   } else {
     adjust_rcut(time);
   }
@@ -218,6 +238,7 @@ void FixTuneKspace::store_old_kspace_settings()
   old_differentiation_flag = force->kspace->differentiation_flag;
   old_slabflag = force->kspace->slabflag;
   old_slab_volfactor = force->kspace->slab_volfactor;
+  old_order = force->kspace->order;
 }
 
 /* ----------------------------------------------------------------------
@@ -273,6 +294,22 @@ void FixTuneKspace::update_kspace_style(const std::string &new_kspace_style,
   force->kspace->slabflag = old_slabflag;
   force->kspace->slab_volfactor = old_slab_volfactor;
 
+  // a tuned interpolation order or explicit grid only transfers
+  // between PPPM solvers; other styles interpret them differently
+
+  if (utils::strmatch(new_kspace_style,"^pppm") &&
+      utils::strmatch(kspace_style,"^pppm")) {
+    force->kspace->order = old_order;
+    if (pending_mesh[0] > 0) {
+      auto sx = std::to_string(pending_mesh[0]);
+      auto sy = std::to_string(pending_mesh[1]);
+      auto sz = std::to_string(pending_mesh[2]);
+      char *margs[4] = {(char *)"mesh",(char *)sx.c_str(),
+                        (char *)sy.c_str(),(char *)sz.c_str()};
+      force->kspace->modify_params(4,margs);
+    }
+  }
+
   // initialize new kspace style, pair style, molecular styles
 
   force->init();
@@ -387,6 +424,112 @@ void FixTuneKspace::adjust_rcut(double time)
   update_kspace_style(kspace_style,acc_str);
 }
 
+/* ----------------------------------------------------------------------
+   scan PPPM interpolation order, ik vs ad differentiation, and grid
+   size around the accuracy-derived estimate; apply the timed optimum
+------------------------------------------------------------------------- */
+
+void FixTuneKspace::scan_pppm_params(double time)
+{
+  if (pppm_scan_index >= 0) pppm_trials[pppm_scan_index].time = time;
+  pppm_scan_index++;
+
+  if (pppm_scan_stage == 1 && pppm_scan_index == (int)pppm_trials.size()) {
+
+    // order/diff scan complete: also time one coarser and one finer grid
+    // around the accuracy-derived grid of the best candidate so far
+
+    int best = 0;
+    for (int i = 1; i < (int)pppm_trials.size(); i++)
+      if (pppm_trials[i].time < pppm_trials[best].time) best = i;
+    const PPPMTrial trial = pppm_trials[best];
+
+    for (double scale : {0.8, 1.25}) {
+      PPPMTrial t = trial;
+      t.nx = closest_factorable((int)(trial.nx_used*scale));
+      t.ny = closest_factorable((int)(trial.ny_used*scale));
+      t.nz = closest_factorable((int)(trial.nz_used*scale));
+      t.time = 0.0;
+      if (t.nx != trial.nx_used || t.ny != trial.ny_used || t.nz != trial.nz_used)
+        pppm_trials.push_back(t);
+    }
+    pppm_scan_stage = 2;
+  }
+
+  if (pppm_scan_index < (int)pppm_trials.size()) {
+    apply_pppm_trial(pppm_scan_index);
+    return;
+  }
+
+  // all trials timed: report the scan and switch to the fastest
+  // candidate whose estimated accuracy still meets the target
+
+  int best = -1;
+  for (int i = 0; i < (int)pppm_trials.size(); i++) {
+    if (pppm_trials[i].accuracy > 1.05*target_accuracy) continue;
+    if (best < 0 || pppm_trials[i].time < pppm_trials[best].time) best = i;
+  }
+  if (best < 0) best = 0;
+
+  if (comm->me == 0) {
+    utils::logmesg(lmp,"PPPM parameter scan:\n"
+                   "  order diff  grid              est. accuracy  time/step\n");
+    for (int i = 0; i < (int)pppm_trials.size(); i++) {
+      const PPPMTrial &t = pppm_trials[i];
+      utils::logmesg(lmp,"  {:5} {:>4}  {:4} {:4} {:4}  {:13.6g} {:10.6g}{}\n",
+                     t.order,t.diff ? "ad" : "ik",t.nx_used,t.ny_used,t.nz_used,
+                     t.accuracy,t.time,(i == best) ? "  *" : "");
+    }
+  }
+
+  apply_pppm_trial(best);
+  pppm_scan_stage = 0;
+  pppm_scan_index = -1;
+  pppm_trials.clear();
+}
+
+/* ----------------------------------------------------------------------
+   rebuild the PPPM solver with the settings of one scan trial and
+   record the grid and estimated accuracy it ends up with
+------------------------------------------------------------------------- */
+
+void FixTuneKspace::apply_pppm_trial(int i)
+{
+  PPPMTrial &trial = pppm_trials[i];
+
+  store_old_kspace_settings();
+  old_differentiation_flag = trial.diff;
+  old_order = trial.order;
+  pending_mesh[0] = trial.nx;
+  pending_mesh[1] = trial.ny;
+  pending_mesh[2] = trial.nz;
+  update_kspace_style("pppm",acc_str);
+
+  trial.nx_used = force->kspace->nx_pppm;
+  trial.ny_used = force->kspace->ny_pppm;
+  trial.nz_used = force->kspace->nz_pppm;
+  auto pppm = dynamic_cast<PPPM *>(force->kspace);
+  trial.accuracy = pppm ? pppm->final_accuracy() : force->kspace->accuracy;
+}
+
+/* ----------------------------------------------------------------------
+   smallest grid size >= n whose prime factors are all 2, 3, or 5,
+   as required by PPPM::factorable()
+------------------------------------------------------------------------- */
+
+int FixTuneKspace::closest_factorable(int n)
+{
+  if (n < 2) n = 2;
+  while (true) {
+    int m = n;
+    while (m % 2 == 0) m /= 2;
+    while (m % 3 == 0) m /= 3;
+    while (m % 5 == 0) m /= 5;
+    if (m == 1) return n;
+    n++;
+  }
+}
+
 /* ----------------------------------------------------------------------
    bracket a minimum using parabolic extrapolation
 ------------------------------------------------------------------------- */
@@ -22,6 +22,8 @@ FixStyle(tune/kspace,FixTuneKspace);
 
 #include "fix.h"
 
+#include <vector>
+
 namespace LAMMPS_NS {
 
 class FixTuneKspace : public Fix {
@@ -36,6 +38,8 @@ class FixTuneKspace : public Fix {
   void update_pair_style(const std::string &, double);
   void update_kspace_style(const std::string &, const std::string &);
   void adjust_rcut(double);
+  void scan_pppm_params(double);
+  void apply_pppm_trial(int);
   void mnbrak();
   void brent0();
   void brent1();
@@ -59,6 +63,26 @@ class FixTuneKspace : public Fix {
   int old_differentiation_flag;
   int old_slabflag;
   double old_slab_volfactor;
+  int old_order;
+
+  // candidate PPPM settings timed by the order/diff/grid scan
+
+  struct PPPMTrial {
+    int order;                        // interpolation (stencil) order
+    int diff;                         // 0 = ik differentiation, 1 = ad
+    int nx, ny, nz;                   // requested global grid, 0 = accuracy-derived
+    int nx_used, ny_used, nz_used;    // global grid actually selected
+    double accuracy;                  // estimated accuracy (force units)
+    double time;                      // measured CPU time per step
+  };
+
+  std::vector<PPPMTrial> pppm_trials;
+  int pppm_scan_stage;      // 0 = off, 1 = order/diff scan, 2 = grid scan
+  int pppm_scan_index;      // trial currently being timed, -1 = none yet
+  int pending_mesh[3];      // explicit grid to impose on rebuilds, 0 = accuracy-derived
+  double target_accuracy;   // accuracy (force units) trials must meet
+
+  static int closest_factorable(int);
 
   int niter_adjust_rcut;
   double ax_brent, bx_brent, cx_brent, dx_brent;
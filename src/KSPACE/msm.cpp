@@ -54,7 +54,8 @@ MSM::MSM(LAMMPS *lmp)
     peratom_allocate_flag(0),levels(0),world_levels(nullptr),qgrid(nullptr),egrid(nullptr),
     v0grid(nullptr), v1grid(nullptr),v2grid(nullptr),v3grid(nullptr),v4grid(nullptr),v5grid(nullptr),
     g_direct(nullptr),v0_direct(nullptr),v1_direct(nullptr),v2_direct(nullptr),v3_direct(nullptr),
-    v4_direct(nullptr),v5_direct(nullptr),g_direct_top(nullptr),v0_direct_top(nullptr),
+    v4_direct(nullptr),v5_direct(nullptr),direct_ixlo(nullptr),direct_ixhi(nullptr),
+    g_direct_top(nullptr),v0_direct_top(nullptr),
     v1_direct_top(nullptr),v2_direct_top(nullptr),v3_direct_top(nullptr),v4_direct_top(nullptr),
     v5_direct_top(nullptr),phi1d(nullptr),dphi1d(nullptr),procneigh_levels(nullptr),gcall(nullptr),
     gc(nullptr),gcall_buf1(nullptr),gcall_buf2(nullptr),gc_buf1(nullptr),gc_buf2(nullptr),
@@ -107,6 +108,8 @@ MSM::~MSM()
   memory->destroy(v3_direct);
   memory->destroy(v4_direct);
   memory->destroy(v5_direct);
+  memory->destroy(direct_ixlo);
+  memory->destroy(direct_ixhi);
   memory->destroy(v0_direct_top);
   memory->destroy(v1_direct_top);
   memory->destroy(v2_direct_top);
@@ -1535,13 +1538,15 @@ void MSM::direct(int n)
   double ***v3gridn = v3grid[n];
   double ***v4gridn = v4grid[n];
   double ***v5gridn = v5grid[n];
-  double *g_directn = g_direct[n];
-  double *v0_directn = v0_direct[n];
-  double *v1_directn = v1_direct[n];
-  double *v2_directn = v2_direct[n];
-  double *v3_directn = v3_direct[n];
-  double *v4_directn = v4_direct[n];
-  double *v5_directn = v5_direct[n];
+  const double * _noalias const g_directn = g_direct[n];
+  const double * _noalias const v0_directn = v0_direct[n];
+  const double * _noalias const v1_directn = v1_direct[n];
+  const double * _noalias const v2_directn = v2_direct[n];
+  const double * _noalias const v3_directn = v3_direct[n];
+  const double * _noalias const v4_directn = v4_direct[n];
+  const double * _noalias const v5_directn = v5_direct[n];
+  const int * _noalias const ixlo_n = direct_ixlo[n];
+  const int * _noalias const ixhi_n = direct_ixhi[n];
 
   // zero out electric potential
 
@@ -1564,7 +1569,7 @@ void MSM::direct(int n)
   double qtmp,qtmp2,gtmp;
   double esum,v0sum,v1sum,v2sum,v3sum,v4sum,v5sum;
   double **qk,**ek;
-  double *qkj,*ekj;
+  int irow,ilo,ihi;
 
   int nx = nxhi_direct - nxlo_direct + 1;
   int ny = nyhi_direct - nylo_direct + 1;
@@ -1614,10 +1619,13 @@ void MSM::direct(int n)
           zk = (iz + nzhi_direct)*ny;
           for (iy = jmin; iy <= jmax; iy++) {
             jj = icy+iy;
-            qkj = qk[jj];
-            ekj = ek[jj];
-            zyk = (zk + iy + nyhi_direct)*nx;
-            for (ix = imin; ix <= imax; ix++) {
+            const double * _noalias const qkj = qk[jj];
+            double * _noalias const ekj = ek[jj];
+            irow = zk + iy + nyhi_direct;
+            zyk = irow*nx;
+            ilo = MAX(imin,ixlo_n[irow]);
+            ihi = MIN(imax,ixhi_n[irow]);
+            for (ix = ilo; ix <= ihi; ix++) {
               ii = icx+ix;
               qtmp2 = qkj[ii]; // charge on outer grid point
               k = zyk + ix + nxhi_direct;
@@ -1646,10 +1654,13 @@ void MSM::direct(int n)
         zk = (iz + nzhi_direct)*ny;
         for (iy = 1; iy <= jmax; iy++) {
           jj = icy+iy;
-          qkj = qk[jj];
-          ekj = ek[jj];
-          zyk = (zk + iy + nyhi_direct)*nx;
-          for (ix = imin; ix <= imax; ix++) {
+          const double * _noalias const qkj = qk[jj];
+          double * _noalias const ekj = ek[jj];
+          irow = zk + iy + nyhi_direct;
+          zyk = irow*nx;
+          ilo = MAX(imin,ixlo_n[irow]);
+          ihi = MIN(imax,ixhi_n[irow]);
+          for (ix = ilo; ix <= ihi; ix++) {
             ii = icx+ix;
             qtmp2 = qkj[ii];
             k = zyk + ix + nxhi_direct;
@@ -1677,10 +1688,12 @@ void MSM::direct(int n)
         zk = (iz + nzhi_direct)*ny;
         iy = 0;
         jj = icy+iy;
-        qkj = qk[jj];
-        ekj = ek[jj];
-        zyk = (zk + iy + nyhi_direct)*nx;
-        for (ix = 1; ix <= imax; ix++) {
+        const double * _noalias const qkj = qk[jj];
+        double * _noalias const ekj = ek[jj];
+        irow = zk + iy + nyhi_direct;
+        zyk = irow*nx;
+        ihi = MIN(imax,ixhi_n[irow]);
+        for (ix = 1; ix <= ihi; ix++) {
           ii = icx+ix;
           qtmp2 = qkj[ii];
           k = zyk + ix + nxhi_direct;
@@ -1766,8 +1779,11 @@ void MSM::direct_peratom(int n)
   double ***v4gridn = v4grid[n];
   double ***v5gridn = v5grid[n];
 
+  const int * _noalias const ixlo_n = direct_ixlo[n];
+  const int * _noalias const ixhi_n = direct_ixhi[n];
+
   int icx,icy,icz,ix,iy,iz,zk,zyk,k;
-  int ii,jj,kk;
+  int ii,jj,kk,irow,ilo,ihi;
   int imin,imax,jmin,jmax,kmax;
   double qtmp;
 
@@ -1814,8 +1830,11 @@ void MSM::direct_peratom(int n)
           zk = (iz + nzhi_direct)*ny;
           for (iy = jmin; iy <= jmax; iy++) {
             jj = icy+iy;
-            zyk = (zk + iy + nyhi_direct)*nx;
-            for (ix = imin; ix <= imax; ix++) {
+            irow = zk + iy + nyhi_direct;
+            zyk = irow*nx;
+            ilo = MAX(imin,ixlo_n[irow]);
+            ihi = MIN(imax,ixhi_n[irow]);
+            for (ix = ilo; ix <= ihi; ix++) {
               ii = icx+ix;
               k = zyk + ix + nxhi_direct;
               v0gridn[kk][jj][ii] += v0_direct[n][k] * qtmp;
@@ -1835,8 +1854,11 @@ void MSM::direct_peratom(int n)
         zk = (iz + nzhi_direct)*ny;
         for (iy = 1; iy <= jmax; iy++) {
           jj = icy+iy;
-          zyk = (zk + iy + nyhi_direct)*nx;
-          for (ix = imin; ix <= imax; ix++) {
+          irow = zk + iy + nyhi_direct;
+          zyk = irow*nx;
+          ilo = MAX(imin,ixlo_n[irow]);
+          ihi = MIN(imax,ixhi_n[irow]);
+          for (ix = ilo; ix <= ihi; ix++) {
             ii = icx+ix;
             k = zyk + ix + nxhi_direct;
             v0gridn[kk][jj][ii] += v0_direct[n][k] * qtmp;
@@ -1855,8 +1877,10 @@ void MSM::direct_peratom(int n)
         zk = (iz + nzhi_direct)*ny;
         iy = 0;
         jj = icy+iy;
-        zyk = (zk + iy + nyhi_direct)*nx;
-        for (ix = 1; ix <= imax; ix++) {
+        irow = zk + iy + nyhi_direct;
+        zyk = irow*nx;
+        ihi = MIN(imax,ixhi_n[irow]);
+        for (ix = 1; ix <= ihi; ix++) {
           ii = icx+ix;
           k = zyk + ix + nxhi_direct;
           v0gridn[kk][jj][ii] += v0_direct[n][k] * qtmp;
@@ -3102,6 +3126,16 @@ void MSM::get_g_direct()
   if (g_direct) memory->destroy(g_direct);
   memory->create(g_direct,levels,nmax_direct,"msm:g_direct");
 
+  // x extent of nonzero weights for each (iz,iy) row of the direct stencil
+  // the stencil is a cube, but the interaction is zero beyond 2 cutoffs,
+  //   so only the rows' spherical cross sections need to be summed over
+
+  int nrows = (2*nzhi_direct+1)*(2*nyhi_direct+1);
+  if (direct_ixlo) memory->destroy(direct_ixlo);
+  if (direct_ixhi) memory->destroy(direct_ixhi);
+  memory->create(direct_ixlo,levels,nrows,"msm:direct_ixlo");
+  memory->create(direct_ixhi,levels,nrows,"msm:direct_ixhi");
+
   double a = cutoff;
 
   int n,zk,zyk,k,ix,iy,iz;
@@ -3122,7 +3156,14 @@ void MSM::get_g_direct()
       zk = (iz + nzhi_direct)*ny;
       for (iy = nylo_direct; iy <= nyhi_direct; iy++) {
         ydiff = iy/delyinv[n];
-        zyk = (zk + iy + nyhi_direct)*nx;
+        int irow = zk + iy + nyhi_direct;
+        zyk = irow*nx;
+
+        // empty interval if the entire row is beyond 2 cutoffs
+
+        direct_ixlo[n][irow] = nxhi_direct+1;
+        direct_ixhi[n][irow] = nxlo_direct-1;
+
         for (ix = nxlo_direct; ix <= nxhi_direct; ix++) {
           xdiff = ix/delxinv[n];
 
@@ -3146,7 +3187,16 @@ void MSM::get_g_direct()
 
           rho = sqrt(rsq)/(two_n*a);
           k = zyk + ix + nxhi_direct;
-          g_direct[n][k] = gamma(rho)/(two_n*a) - gamma(rho/2.0)/(2.0*two_n*a);
+
+          // gamma(rho) and gamma(rho/2)/2 telescope exactly beyond 2 cutoffs
+
+          if (rho >= 2.0) {
+            g_direct[n][k] = 0.0;
+          } else {
+            g_direct[n][k] = gamma(rho)/(two_n*a) - gamma(rho/2.0)/(2.0*two_n*a);
+            direct_ixlo[n][irow] = MIN(direct_ixlo[n][irow],ix);
+            direct_ixhi[n][irow] = MAX(direct_ixhi[n][irow],ix);
+          }
         }
       }
     }
@@ -3216,7 +3266,11 @@ void MSM::get_virial_direct()
           rsq = dx*dx + dy*dy + dz*dz;
           k = zyk + ix + nxhi_direct;
           r = sqrt(rsq);
-          if (r == 0) {
+          rho = r/(two_n*a);
+
+          // weights telescope exactly beyond 2 cutoffs, same as get_g_direct()
+
+          if (r == 0 || rho >= 2.0) {
             v0_direct[n][k] = 0.0;
             v1_direct[n][k] = 0.0;
             v2_direct[n][k] = 0.0;
@@ -3224,7 +3278,6 @@ void MSM::get_virial_direct()
             v4_direct[n][k] = 0.0;
             v5_direct[n][k] = 0.0;
           } else {
-            rho = r/(two_n*a);
             dg = -(dgamma(rho)/(two_nsq*a_sq) -
               dgamma(rho/2.0)/(4.0*two_nsq*a_sq))/r;
             v0_direct[n][k] = dg * dx * dx;
@@ -71,6 +71,7 @@ class MSM : public KSpace {
   double **g_direct;
   double **v0_direct, **v1_direct, **v2_direct;
   double **v3_direct, **v4_direct, **v5_direct;
+  int **direct_ixlo, **direct_ixhi;    // x extent of nonzero weights per stencil row
   double *g_direct_top;
   double *v0_direct_top, *v1_direct_top, *v2_direct_top;
   double *v3_direct_top, *v4_direct_top, *v5_direct_top;
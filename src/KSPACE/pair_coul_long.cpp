@@ -23,6 +23,7 @@
 #include "ewald_const.h"
 #include "force.h"
 #include "kspace.h"
+#include "math_special.h"
 #include "memory.h"
 #include "neigh_list.h"
 #include "neighbor.h"
@@ -66,7 +67,7 @@ void PairCoulLong::compute(int eflag, int vflag)
   double qtmp, xtmp, ytmp, ztmp, delx, dely, delz, ecoul, fpair;
   double fraction, table;
   double r, r2inv, forcecoul, factor_coul;
-  double grij, expm2, prefactor, t, erfc;
+  double grij, expm2, prefactor, erfc;
   int *ilist, *jlist, *numneigh, **firstneigh;
   double rsq;
 
@@ -115,9 +116,8 @@ void PairCoulLong::compute(int eflag, int vflag)
         if (!ncoultablebits || rsq <= tabinnersq) {
           r = sqrt(rsq);
           grij = g_ewald * r;
-          expm2 = exp(-grij * grij);
-          t = 1.0 / (1.0 + EWALD_P * grij);
-          erfc = t * (A1 + t * (A2 + t * (A3 + t * (A4 + t * A5)))) * expm2;
+          expm2 = MathSpecial::expmsq(grij);
+          erfc = MathSpecial::my_erfcx(grij) * expm2;
           prefactor = qqrd2e * scale[itype][jtype] * qtmp * q[j] / r;
           forcecoul = prefactor * (erfc + EWALD_F * grij * expm2);
           if (factor_coul < 1.0) forcecoul -= (1.0 - factor_coul) * prefactor;
@@ -327,7 +327,7 @@ void PairCoulLong::read_restart_settings(FILE *fp)
 double PairCoulLong::single(int i, int j, int /*itype*/, int /*jtype*/, double rsq,
                             double factor_coul, double /*factor_lj*/, double &fforce)
 {
-  double r2inv, r, grij, expm2, t, erfc, prefactor;
+  double r2inv, r, grij, expm2, erfc, prefactor;
   double fraction, table, forcecoul, phicoul;
   int itable;
 
@@ -335,9 +335,8 @@ double PairCoulLong::single(int i, int j, int /*itype*/, int /*jtype*/, double r
   if (!ncoultablebits || rsq <= tabinnersq) {
     r = sqrt(rsq);
     grij = g_ewald * r;
-    expm2 = exp(-grij * grij);
-    t = 1.0 / (1.0 + EWALD_P * grij);
-    erfc = t * (A1 + t * (A2 + t * (A3 + t * (A4 + t * A5)))) * expm2;
+    expm2 = MathSpecial::expmsq(grij);
+    erfc = MathSpecial::my_erfcx(grij) * expm2;
     prefactor = force->qqrd2e * atom->q[i] * atom->q[j] / r;
     forcecoul = prefactor * (erfc + EWALD_F * grij * expm2);
     if (factor_coul < 1.0) forcecoul -= (1.0 - factor_coul) * prefactor;
@@ -24,6 +24,7 @@
 #include "ewald_const.h"
 #include "force.h"
 #include "kspace.h"
+#include "math_special.h"
 #include "memory.h"
 #include "neigh_list.h"
 #include "neighbor.h"
@@ -84,7 +85,7 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
   double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fpair;
   double fraction,table;
   double r,r2inv,r6inv,forcecoul,forcelj,factor_coul,factor_lj;
-  double grij,expm2,prefactor,t,erfc;
+  double grij,expm2,prefactor,erfc;
   double philj,switch1,switch2;
   int *ilist,*jlist,*numneigh,**firstneigh;
   double rsq;
@@ -119,6 +120,14 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    // hoist coefficient rows of atom i's type, so the inner loop
+    //   indexes each row directly instead of chasing row pointers
+
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+    const double *lj3_i = lj3[itype];
+    const double *lj4_i = lj4[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -137,9 +146,8 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
           if (!ncoultablebits || rsq <= tabinnersq) {
             r = sqrt(rsq);
             grij = g_ewald * r;
-            expm2 = exp(-grij*grij);
-            t = 1.0 / (1.0 + EWALD_P*grij);
-            erfc = t * (A1+t*(A2+t*(A3+t*(A4+t*A5)))) * expm2;
+            expm2 = MathSpecial::expmsq(grij);
+            erfc = MathSpecial::my_erfcx(grij) * expm2;
             prefactor = qqrd2e * qtmp*q[j]/r;
             forcecoul = prefactor * (erfc + EWALD_F*grij*expm2);
             if (factor_coul < 1.0) forcecoul -= (1.0-factor_coul)*prefactor;
@@ -162,13 +170,13 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
         if (rsq < cut_ljsq) {
           r6inv = r2inv*r2inv*r2inv;
           jtype = type[j];
-          forcelj = r6inv * (lj1[itype][jtype]*r6inv - lj2[itype][jtype]);
+          forcelj = r6inv * (lj1_i[jtype]*r6inv - lj2_i[jtype]);
           if (rsq > cut_lj_innersq) {
             switch1 = (cut_ljsq-rsq) * (cut_ljsq-rsq) *
               (cut_ljsq + 2.0*rsq - 3.0*cut_lj_innersq) * denom_lj_inv;
             switch2 = 12.0*rsq * (cut_ljsq-rsq) *
               (rsq-cut_lj_innersq) * denom_lj_inv;
-            philj = r6inv * (lj3[itype][jtype]*r6inv - lj4[itype][jtype]);
+            philj = r6inv * (lj3_i[jtype]*r6inv - lj4_i[jtype]);
             forcelj = forcelj*switch1 + philj*switch2;
           }
         } else forcelj = 0.0;
@@ -196,7 +204,7 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
           } else ecoul = 0.0;
 
           if (rsq < cut_ljsq) {
-            evdwl = r6inv*(lj3[itype][jtype]*r6inv-lj4[itype][jtype]);
+            evdwl = r6inv*(lj3_i[jtype]*r6inv-lj4_i[jtype]);
             if (rsq > cut_lj_innersq) {
               switch1 = (cut_ljsq-rsq) * (cut_ljsq-rsq) *
                 (cut_ljsq + 2.0*rsq - 3.0*cut_lj_innersq) * denom_lj_inv;
@@ -390,7 +398,7 @@ void PairLJCharmmCoulLong::compute_outer(int eflag, int vflag)
   double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fpair;
   double fraction,table;
   double r,r2inv,r6inv,forcecoul,forcelj,factor_coul,factor_lj;
-  double grij,expm2,prefactor,t,erfc;
+  double grij,expm2,prefactor,erfc;
   double philj,switch1,switch2;
   double rsw;
   int *ilist,*jlist,*numneigh,**firstneigh;
@@ -445,9 +453,8 @@ void PairLJCharmmCoulLong::compute_outer(int eflag, int vflag)
           if (!ncoultablebits || rsq <= tabinnersq) {
             r = sqrt(rsq);
             grij = g_ewald * r;
-            expm2 = exp(-grij*grij);
-            t = 1.0 / (1.0 + EWALD_P*grij);
-            erfc = t * (A1+t*(A2+t*(A3+t*(A4+t*A5)))) * expm2;
+            expm2 = MathSpecial::expmsq(grij);
+            erfc = MathSpecial::my_erfcx(grij) * expm2;
             prefactor = qqrd2e * qtmp*q[j]/r;
             forcecoul = prefactor * (erfc + EWALD_F*grij*expm2 - 1.0);
             if (rsq > cut_in_off_sq) {
@@ -899,7 +906,7 @@ double PairLJCharmmCoulLong::single(int i, int j, int itype, int jtype,
                                     double factor_coul, double factor_lj,
                                     double &fforce)
 {
-  double r2inv,r6inv,r,grij,expm2,t,erfc,prefactor;
+  double r2inv,r6inv,r,grij,expm2,erfc,prefactor;
   double switch1,switch2,fraction,table,forcecoul,forcelj,phicoul,philj;
   int itable;
 
@@ -908,9 +915,8 @@ double PairLJCharmmCoulLong::single(int i, int j, int itype, int jtype,
     if (!ncoultablebits || rsq <= tabinnersq) {
       r = sqrt(rsq);
       grij = g_ewald * r;
-      expm2 = exp(-grij*grij);
-      t = 1.0 / (1.0 + EWALD_P*grij);
-      erfc = t * (A1+t*(A2+t*(A3+t*(A4+t*A5)))) * expm2;
+      expm2 = MathSpecial::expmsq(grij);
+      erfc = MathSpecial::my_erfcx(grij) * expm2;
       prefactor = force->qqrd2e * atom->q[i]*atom->q[j]/r;
       forcecoul = prefactor * (erfc + EWALD_F*grij*expm2);
       if (factor_coul < 1.0) forcecoul -= (1.0-factor_coul)*prefactor;
@@ -27,14 +27,17 @@
 #include "domain.h"
 #include "error.h"
 #include "fft3d_wrap.h"
+#include "fix_store_atom.h"
 #include "force.h"
 #include "grid3d.h"
 #include "math_const.h"
 #include "math_special.h"
 #include "memory.h"
+#include "modify.h"
 #include "neighbor.h"
 #include "pair.h"
 #include "remap_wrap.h"
+#include "update.h"
 
 #include <cmath>
 #include <cstring>
@@ -113,6 +116,18 @@ PPPM::PPPM(LAMMPS *lmp) : KSpace(lmp),
 
   nmax = 0;
   part2grid = nullptr;
+  rho1d_atom = nullptr;
+  maxcol_rho1d = 0;
+
+  extrapolate_every = 0;
+  extrapolate_tol = 0.0;
+  extrapolate_hold = 0;
+  solve_prev = solve_last = -1;
+  natoms_extrap = -1;
+  id_fix_extrap = nullptr;
+  fix_extrap = nullptr;
+  fsolve = nullptr;
+  nmax_extrap = 0;
 
   // define acons coefficients for estimation of kspace errors
   // see JCP 109, pg 7698 for derivation of coefficients
@@ -174,7 +189,13 @@ PPPM::~PPPM()
   if (peratom_allocate_flag) PPPM::deallocate_peratom();
   if (group_allocate_flag) PPPM::deallocate_groups();
   memory->destroy(part2grid);
+  memory->destroy(rho1d_atom);
   memory->destroy(acons);
+
+  if (id_fix_extrap && modify->get_fix_by_id(id_fix_extrap))
+    modify->delete_fix(id_fix_extrap);
+  delete [] id_fix_extrap;
+  memory->destroy(fsolve);
 }
 
 /* ----------------------------------------------------------------------
@@ -213,6 +234,22 @@ void PPPM::init()
   if (order < 2 || order > MAXORDER)
     error->all(FLERR,"PPPM order cannot be < 2 or > {}",MAXORDER);
 
+  // force extrapolation stores per-atom kspace force snapshots
+  //   in an internal fix so they migrate with the atoms
+  // invalidate any stored history, grid or charges may have changed
+
+  if (extrapolate_every > 1) {
+    if (strcmp(force->kspace_style,"pppm") != 0)
+      error->all(FLERR,"kspace_modify extrapolate requires kspace_style pppm");
+    if (!id_fix_extrap) {
+      id_fix_extrap = utils::strdup("pppm_extrapolate");
+      fix_extrap = dynamic_cast<FixStoreAtom *>(
+        modify->add_fix(fmt::format("{} all STORE/ATOM 6 0 0 0",id_fix_extrap)));
+    }
+    solve_prev = solve_last = -1;
+    extrapolate_hold = 0;
+  }
+
   // compute two charge force
 
   two_charge();
@@ -552,31 +589,63 @@ void PPPM::setup_triclinic()
 
 void PPPM::reset_grid()
 {
-  // free all arrays previously allocated
-
-  deallocate();
-  if (peratom_allocate_flag) deallocate_peratom();
-  if (group_allocate_flag) deallocate_groups();
-
   // reset portion of global grid that each proc owns
+  // the x-pencil FFT decomposition depends only on the global grid,
+  //   which does not change here
 
   set_grid_local();
 
-  // reallocate K-space dependent memory
-  // check if grid communication is now overlapping if not allowed
-  // don't invoke allocate peratom() or group(), will be allocated when needed
+  // determine the new owned/ghost grid extents with a trial grid object
+  // if they are identical to the current ones on every proc, all
+  //   allocations and FFT/remap plans are still valid: skip the costly
+  //   reallocation and replanning, so repeated load balancing that
+  //   oscillates around the same partition reuses the existing plans
 
-  allocate();
+  auto gctrial = new Grid3d(lmp,world,nx_pppm,ny_pppm,nz_pppm);
+  gctrial->set_distance(0.5*neighbor->skin + qdist);
+  gctrial->set_stencil_atom(-nlower,nupper);
+  gctrial->set_shift_atom(shiftatom_lo,shiftatom_hi);
+  gctrial->set_zfactor(slab_volfactor);
 
-  if (!overlap_allowed && !gc->ghost_adjacent())
-    error->all(FLERR,"PPPM grid stencil extends beyond nearest neighbor processor");
+  int xlo_in,xhi_in,ylo_in,yhi_in,zlo_in,zhi_in;
+  int xlo_out,xhi_out,ylo_out,yhi_out,zlo_out,zhi_out;
+  gctrial->setup_grid(xlo_in,xhi_in,ylo_in,yhi_in,zlo_in,zhi_in,
+                      xlo_out,xhi_out,ylo_out,yhi_out,zlo_out,zhi_out);
 
-  // pre-compute Green's function denomiator expansion
-  // pre-compute 1d charge distribution coefficients
+  int same = (xlo_in == nxlo_in) && (xhi_in == nxhi_in) &&
+    (ylo_in == nylo_in) && (yhi_in == nyhi_in) &&
+    (zlo_in == nzlo_in) && (zhi_in == nzhi_in) &&
+    (xlo_out == nxlo_out) && (xhi_out == nxhi_out) &&
+    (ylo_out == nylo_out) && (yhi_out == nyhi_out) &&
+    (zlo_out == nzlo_out) && (zhi_out == nzhi_out);
+  int sameall;
+  MPI_Allreduce(&same,&sameall,1,MPI_INT,MPI_MIN,world);
+  delete gctrial;
 
-  compute_gf_denom();
-  if (differentiation_flag == 1) compute_sf_precoeff();
-  compute_rho_coeff();
+  if (!sameall) {
+
+    // free all arrays previously allocated
+
+    deallocate();
+    if (peratom_allocate_flag) deallocate_peratom();
+    if (group_allocate_flag) deallocate_groups();
+
+    // reallocate K-space dependent memory
+    // check if grid communication is now overlapping if not allowed
+    // don't invoke allocate peratom() or group(), will be allocated when needed
+
+    allocate();
+
+    if (!overlap_allowed && !gc->ghost_adjacent())
+      error->all(FLERR,"PPPM grid stencil extends beyond nearest neighbor processor");
+
+    // pre-compute Green's function denomiator expansion
+    // pre-compute 1d charge distribution coefficients
+
+    compute_gf_denom();
+    if (differentiation_flag == 1) compute_sf_precoeff();
+    compute_rho_coeff();
+  }
 
   // pre-compute volume-dependent coeffs for portion of grid I now own
 
@@ -609,6 +678,21 @@ void PPPM::compute(int eflag, int vflag)
 
   if (qsqsum == 0.0) return;
 
+  // extrapolation mode: if stored solves are recent enough and no
+  //   energy/virial is needed, predict the kspace forces and return
+  // otherwise do the full solve and snapshot pre-solve forces so the
+  //   kspace contribution can be isolated afterwards
+
+  int extrapolate = 0;
+  if (extrapolate_every > 1) {
+    if (extrapolate_ready(eflag,vflag)) {
+      extrapolate_apply();
+      return;
+    }
+    extrapolate = 1;
+    extrapolate_snapshot();
+  }
+
   // convert atoms from box to lamda coords
 
   if (triclinic == 0) boxlo = domain->boxlo;
@@ -619,10 +703,13 @@ void PPPM::compute(int eflag, int vflag)
 
   // extend size of per-atom arrays if necessary
 
-  if (atom->nmax > nmax) {
+  if (atom->nmax > nmax || !rho1d_atom || 3*order > maxcol_rho1d) {
     memory->destroy(part2grid);
+    memory->destroy(rho1d_atom);
     nmax = atom->nmax;
+    maxcol_rho1d = 3*order;
     memory->create(part2grid,nmax,3,"pppm:part2grid");
+    memory->create(rho1d_atom,nmax,maxcol_rho1d,"pppm:rho1d_atom");
   }
 
   // find grid points for all my particles
@@ -648,22 +735,26 @@ void PPPM::compute(int eflag, int vflag)
 
   // all procs communicate E-field values
   // to fill ghost cells surrounding their 3d bricks
+  // when also doing per-atom energy/virial, batch that grid data into
+  //   the same exchange so each neighbor gets one message, not two
 
-  if (differentiation_flag == 1)
-    gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD,1,sizeof(FFT_SCALAR),
-                     gc_buf1,gc_buf2,MPI_FFT_SCALAR);
-  else
-    gc->forward_comm(Grid3d::KSPACE,this,FORWARD_IK,3,sizeof(FFT_SCALAR),
-                     gc_buf1,gc_buf2,MPI_FFT_SCALAR);
-
-  // extra per-atom energy/virial communication
-
-  if (evflag_atom) {
-    if (differentiation_flag == 1 && vflag_atom)
-      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD_PERATOM,6,sizeof(FFT_SCALAR),
+  if (differentiation_flag == 1) {
+    if (evflag_atom && vflag_atom) {
+      const int which[2] = {FORWARD_AD,FORWARD_AD_PERATOM};
+      const int nper[2] = {1,6};
+      gc->forward_comm_list(Grid3d::KSPACE,this,2,which,nper,sizeof(FFT_SCALAR),
+                            gc_buf1,gc_buf2,MPI_FFT_SCALAR);
+    } else
+      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD,1,sizeof(FFT_SCALAR),
                        gc_buf1,gc_buf2,MPI_FFT_SCALAR);
-    else if (differentiation_flag == 0)
-      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_IK_PERATOM,7,sizeof(FFT_SCALAR),
+  } else {
+    if (evflag_atom) {
+      const int which[2] = {FORWARD_IK,FORWARD_IK_PERATOM};
+      const int nper[2] = {3,7};
+      gc->forward_comm_list(Grid3d::KSPACE,this,2,which,nper,sizeof(FFT_SCALAR),
+                            gc_buf1,gc_buf2,MPI_FFT_SCALAR);
+    } else
+      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_IK,3,sizeof(FFT_SCALAR),
                        gc_buf1,gc_buf2,MPI_FFT_SCALAR);
   }
 
@@ -731,6 +822,10 @@ void PPPM::compute(int eflag, int vflag)
   // convert atoms back from lamda to box coords
 
   if (triclinic) domain->lamda2x(atom->nlocal);
+
+  // extrapolation mode: record per-atom kspace forces of this solve
+
+  if (extrapolate) extrapolate_store();
 }
 
 /* ----------------------------------------------------------------------
@@ -934,9 +1029,10 @@ void PPPM::allocate_peratom()
 
   // use same GC ghost grid object for peratom grid communication
   // but need to reallocate a larger gc_buf1 and gc_buf2
+  // sized for the batched exchange of E-field plus peratom data
 
-  if (differentiation_flag) npergrid = 6;
-  else npergrid = 7;
+  if (differentiation_flag) npergrid = 7;
+  else npergrid = 10;
 
   memory->destroy(gc_buf1);
   memory->destroy(gc_buf2);
@@ -1867,6 +1963,17 @@ void PPPM::make_rho()
 
     compute_rho1d(dx,dy,dz);
 
+    // cache the weights for reuse by the field interpolation,
+    // which runs on the same coordinates later in the step
+    // cache is only allocated by PPPM::compute(), not by
+    // the compute() methods of derived classes
+
+    if (rho1d_atom) {
+      memcpy(&rho1d_atom[i][0],&rho1d[0][nlower],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d_atom[i][order],&rho1d[1][nlower],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d_atom[i][2*order],&rho1d[2][nlower],order*sizeof(FFT_SCALAR));
+    }
+
     z0 = delvolinv * q[i];
     for (n = nlower; n <= nupper; n++) {
       mz = n+nz;
@@ -2363,11 +2470,21 @@ void PPPM::fieldforce_ik()
     nx = part2grid[i][0];
     ny = part2grid[i][1];
     nz = part2grid[i][2];
-    dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
-    dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
-    dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
 
-    compute_rho1d(dx,dy,dz);
+    // reuse the stencil weights cached by make_rho(), else recompute them
+    // derived classes invoke this method from compute() methods
+    //   which do not allocate the cache
+
+    if (rho1d_atom) {
+      memcpy(&rho1d[0][nlower],&rho1d_atom[i][0],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d[1][nlower],&rho1d_atom[i][order],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d[2][nlower],&rho1d_atom[i][2*order],order*sizeof(FFT_SCALAR));
+    } else {
+      dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+      dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+      dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+      compute_rho1d(dx,dy,dz);
+    }
 
     ekx = eky = ekz = ZEROF;
     for (n = nlower; n <= nupper; n++) {
@@ -2437,7 +2554,11 @@ void PPPM::fieldforce_ad()
     dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
     dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
 
-    compute_rho1d(dx,dy,dz);
+    if (rho1d_atom) {
+      memcpy(&rho1d[0][nlower],&rho1d_atom[i][0],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d[1][nlower],&rho1d_atom[i][order],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d[2][nlower],&rho1d_atom[i][2*order],order*sizeof(FFT_SCALAR));
+    } else compute_rho1d(dx,dy,dz);
     compute_drho1d(dx,dy,dz);
 
     ekx = eky = ekz = ZEROF;
@@ -2506,11 +2627,17 @@ void PPPM::fieldforce_peratom()
     nx = part2grid[i][0];
     ny = part2grid[i][1];
     nz = part2grid[i][2];
-    dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
-    dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
-    dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
 
-    compute_rho1d(dx,dy,dz);
+    if (rho1d_atom) {
+      memcpy(&rho1d[0][nlower],&rho1d_atom[i][0],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d[1][nlower],&rho1d_atom[i][order],order*sizeof(FFT_SCALAR));
+      memcpy(&rho1d[2][nlower],&rho1d_atom[i][2*order],order*sizeof(FFT_SCALAR));
+    } else {
+      dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+      dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+      dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+      compute_rho1d(dx,dy,dz);
+    }
 
     u = v0 = v1 = v2 = v3 = v4 = v5 = ZEROF;
     for (n = nlower; n <= nupper; n++) {
@@ -2911,6 +3038,147 @@ void PPPM::slabcorr()
   for (int i = 0; i < nlocal; i++) f[i][2] += ffact * q[i]*(dipole_all - qsum*x[i][2]);
 }
 
+/* ----------------------------------------------------------------------
+   parse PPPM-specific kspace_modify keywords
+------------------------------------------------------------------------- */
+
+int PPPM::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0],"extrapolate") == 0) {
+    if (narg < 3) error->all(FLERR,"Illegal kspace_modify command");
+    extrapolate_every = utils::inumeric(FLERR,arg[1],false,lmp);
+    extrapolate_tol = utils::numeric(FLERR,arg[2],false,lmp);
+    if (extrapolate_every < 0)
+      error->all(FLERR,"Invalid kspace_modify extrapolate interval: {}",extrapolate_every);
+    if (extrapolate_tol < 0.0)
+      error->all(FLERR,"Invalid kspace_modify extrapolate tolerance: {}",extrapolate_tol);
+    return 3;
+  }
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   check if kspace forces for the current step can be extrapolated
+   all tests are identical on all procs, so the decision is global
+------------------------------------------------------------------------- */
+
+int PPPM::extrapolate_ready(int eflag, int vflag)
+{
+  // full solve if energy/virial is requested, during setup or
+  //   minimization, if the error monitor demanded per-step solves,
+  //   if fewer than 2 solves are stored, or if atom count changed
+
+  if (eflag || vflag) return 0;
+  if (update->whichflag != 1 || update->setupflag) return 0;
+  if (extrapolate_hold) return 0;
+  if (solve_prev < 0 || solve_last < 0) return 0;
+  if (atom->natoms != natoms_extrap) return 0;
+
+  const bigint step = update->ntimestep;
+  if (step <= solve_last) return 0;
+  if (step - solve_last >= extrapolate_every) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   add linearly extrapolated kspace forces from the 2 stored solves
+------------------------------------------------------------------------- */
+
+void PPPM::extrapolate_apply()
+{
+  double **sf = fix_extrap->astore;
+  double **f = atom->f;
+  const int nlocal = atom->nlocal;
+  const double alpha =
+    (double) (update->ntimestep - solve_last) / (double) (solve_last - solve_prev);
+
+  for (int i = 0; i < nlocal; i++) {
+    f[i][0] += sf[i][3] + alpha*(sf[i][3] - sf[i][0]);
+    f[i][1] += sf[i][4] + alpha*(sf[i][4] - sf[i][1]);
+    f[i][2] += sf[i][5] + alpha*(sf[i][5] - sf[i][2]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   snapshot per-atom forces before a full solve
+   the post-solve difference is the kspace contribution by itself
+------------------------------------------------------------------------- */
+
+void PPPM::extrapolate_snapshot()
+{
+  if (atom->nmax > nmax_extrap) {
+    memory->destroy(fsolve);
+    nmax_extrap = atom->nmax;
+    memory->create(fsolve,nmax_extrap,3,"pppm:fsolve");
+  }
+
+  double **f = atom->f;
+  const int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++) {
+    fsolve[i][0] = f[i][0];
+    fsolve[i][1] = f[i][1];
+    fsolve[i][2] = f[i][2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   record the kspace forces of a completed full solve
+   also run the error monitor against the previous history
+------------------------------------------------------------------------- */
+
+void PPPM::extrapolate_store()
+{
+  double **sf = fix_extrap->astore;
+  double **f = atom->f;
+  const int nlocal = atom->nlocal;
+  const bigint step = update->ntimestep;
+
+  // stored history is usable only if it is older than this step
+  //   and the atom count did not change in between
+
+  const int usable = (solve_prev >= 0 && solve_last >= 0 &&
+                      solve_last < step && atom->natoms == natoms_extrap);
+
+  // error monitor: relative RMS deviation of what extrapolation would
+  //   have predicted for this step vs the solve just performed
+  // too large an error suspends extrapolation (per-step solves) until
+  //   the measured error drops back below half the tolerance
+
+  if (extrapolate_tol > 0.0 && usable) {
+    const double alpha = (double) (step - solve_last) / (double) (solve_last - solve_prev);
+    double err[2] = {0.0,0.0};
+    for (int i = 0; i < nlocal; i++)
+      for (int j = 0; j < 3; j++) {
+        const double fk = f[i][j] - fsolve[i][j];
+        const double fp = sf[i][j+3] + alpha*(sf[i][j+3] - sf[i][j]);
+        err[0] += (fp-fk)*(fp-fk);
+        err[1] += fk*fk;
+      }
+    double err_all[2];
+    MPI_Allreduce(err,err_all,2,MPI_DOUBLE,MPI_SUM,world);
+    const double relerr = (err_all[1] > 0.0) ? sqrt(err_all[0]/err_all[1]) : 0.0;
+    if (!extrapolate_hold && relerr > extrapolate_tol) extrapolate_hold = 1;
+    else if (extrapolate_hold && relerr < 0.5*extrapolate_tol) extrapolate_hold = 0;
+  }
+
+  // shift the stored solves and record the new one
+  // without usable history the previous slot is invalidated, so 2 new
+  //   full solves happen before extrapolation resumes
+
+  const int shift = (solve_last >= 0 && solve_last < step &&
+                     atom->natoms == natoms_extrap);
+
+  for (int i = 0; i < nlocal; i++)
+    for (int j = 0; j < 3; j++) {
+      if (shift) sf[i][j] = sf[i][j+3];
+      sf[i][j+3] = f[i][j] - fsolve[i][j];
+    }
+
+  solve_prev = shift ? solve_last : -1;
+  solve_last = step;
+  natoms_extrap = atom->natoms;
+}
+
 /* ----------------------------------------------------------------------
    perform and time the 1d FFTs required for N timesteps
 ------------------------------------------------------------------------- */
@@ -2978,6 +3246,7 @@ int PPPM::timing_3d(int n, double &time3d)
 double PPPM::memory_usage()
 {
   double bytes = (double)nmax*3 * sizeof(double);
+  bytes += (double)nmax*3*order * sizeof(FFT_SCALAR);
 
   int nbrick = (nxhi_out-nxlo_out+1) * (nyhi_out-nylo_out+1) *
     (nzhi_out-nzlo_out+1);
@@ -37,8 +37,10 @@ class PPPM : public KSpace {
   int timing_1d(int, double &) override;
   int timing_3d(int, double &) override;
   double memory_usage() override;
+  double final_accuracy();
 
   void compute_group_group(int, int, int) override;
+  int modify_param(int, char **) override;
 
  protected:
   int me, nprocs;
@@ -71,6 +73,10 @@ class PPPM : public KSpace {
 
   double *gf_b;
   FFT_SCALAR **rho1d, **rho_coeff, **drho1d, **drho_coeff;
+  FFT_SCALAR **rho1d_atom;    // per-atom stencil weights from make_rho()
+                              // only allocated by PPPM::compute(); readers
+                              // fall back to compute_rho1d() if null
+  int maxcol_rho1d;           // allocated columns of rho1d_atom, >= 3*order
   double *sf_precoeff1, *sf_precoeff2, *sf_precoeff3;
   double *sf_precoeff4, *sf_precoeff5, *sf_precoeff6;
   double sf_coeff[6];    // coefficients for calculating ad self-forces
@@ -95,6 +101,20 @@ class PPPM : public KSpace {
   int nmax;
 
   double *boxlo;
+
+  // force extrapolation between full kspace solves
+
+  int extrapolate_every;      // full solve interval, 0/1 = solve every step
+  double extrapolate_tol;     // rel force error which forces per-step solves
+  int extrapolate_hold;       // 1 if error monitor suspended extrapolation
+  bigint solve_prev;          // timestep of older stored solve, -1 if none
+  bigint solve_last;          // timestep of latest stored solve, -1 if none
+  bigint natoms_extrap;       // atom count the stored history is valid for
+  char *id_fix_extrap;        // ID of internal STORE/ATOM fix
+  class FixStoreAtom *fix_extrap;    // stores 2 per-atom kspace force snapshots
+  double **fsolve;            // pre-solve forces, to isolate kspace terms
+  int nmax_extrap;            // allocated size of fsolve
+
   // TIP4P settings
   int typeH, typeO;    // atom types of TIP4P water H and O atoms
   double qdist;        // distance from O site to negative charge
@@ -105,7 +125,6 @@ class PPPM : public KSpace {
   void adjust_gewald();
   virtual double newton_raphson_f();
   double derivf();
-  double final_accuracy();
 
   virtual void allocate();
   virtual void allocate_peratom();
@@ -140,6 +159,13 @@ class PPPM : public KSpace {
   void compute_rho_coeff();
   virtual void slabcorr();
 
+  // force extrapolation between full kspace solves
+
+  int extrapolate_ready(int, int);
+  void extrapolate_apply();
+  void extrapolate_snapshot();
+  void extrapolate_store();
+
   // grid communication
 
   void pack_forward_grid(int, void *, int, int *) override;
@@ -186,33 +186,35 @@ void PPPMCG::compute(int eflag, int vflag)
 
   // all procs communicate E-field values
   // to fill ghost cells surrounding their 3d bricks
-
-  if (differentiation_flag == 1)
-    gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD,1,sizeof(FFT_SCALAR),
-                     gc_buf1,gc_buf2,MPI_FFT_SCALAR);
-  else
-    gc->forward_comm(Grid3d::KSPACE,this,FORWARD_IK,3,sizeof(FFT_SCALAR),
-                     gc_buf1,gc_buf2,MPI_FFT_SCALAR);
-
-  // extra per-atom energy/virial communication
-
-  if (evflag_atom) {
-    if (differentiation_flag == 1 && vflag_atom)
-      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD_PERATOM,6,sizeof(FFT_SCALAR),
+  // when also doing per-atom energy/virial, batch that grid data into
+  //   the same exchange so each neighbor gets one message, not two
+
+  if (differentiation_flag == 1) {
+    if (evflag_atom && vflag_atom) {
+      const int which[2] = {FORWARD_AD,FORWARD_AD_PERATOM};
+      const int nper[2] = {1,6};
+      gc->forward_comm_list(Grid3d::KSPACE,this,2,which,nper,sizeof(FFT_SCALAR),
+                            gc_buf1,gc_buf2,MPI_FFT_SCALAR);
+    } else
+      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_AD,1,sizeof(FFT_SCALAR),
                        gc_buf1,gc_buf2,MPI_FFT_SCALAR);
-    else if (differentiation_flag == 0)
-      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_IK_PERATOM,7,sizeof(FFT_SCALAR),
+  } else {
+    if (evflag_atom) {
+      const int which[2] = {FORWARD_IK,FORWARD_IK_PERATOM};
+      const int nper[2] = {3,7};
+      gc->forward_comm_list(Grid3d::KSPACE,this,2,which,nper,sizeof(FFT_SCALAR),
+                            gc_buf1,gc_buf2,MPI_FFT_SCALAR);
+    } else
+      gc->forward_comm(Grid3d::KSPACE,this,FORWARD_IK,3,sizeof(FFT_SCALAR),
                        gc_buf1,gc_buf2,MPI_FFT_SCALAR);
   }
 
   // calculate the force on my particles
+  // per-atom energy/virial are interpolated in the same pass, including
+  //   the 0.5 prefactor and the self-energy correction
 
   fieldforce();
 
-  // extra per-atom energy/virial communication
-
-  if (evflag_atom) fieldforce_peratom();
-
   // sum global energy across procs and add in volume-dependent term
 
   const double qscale = qqrd2e * scale;
@@ -236,30 +238,6 @@ void PPPMCG::compute(int eflag, int vflag)
     for (int i = 0; i < 6; i++) virial[i] = 0.5*qscale*volume*virial_all[i];
   }
 
-  // per-atom energy/virial
-  // energy includes self-energy correction
-
-  if (evflag_atom) {
-    const double * const q = atom->q;
-
-    if (eflag_atom) {
-      for (int j = 0; j < num_charged; j++) {
-        const int i = is_charged[j];
-        eatom[i] *= 0.5;
-        eatom[i] -= g_ewald*q[i]*q[i]/MY_PIS + MY_PI2*q[i]*qsum /
-          (g_ewald*g_ewald*volume);
-        eatom[i] *= qscale;
-      }
-    }
-
-    if (vflag_atom) {
-      for (int n = 0; n < num_charged; n++) {
-        const int i = is_charged[n];
-        for (int j = 0; j < 6; j++) vatom[i][j] *= 0.5*qscale;
-      }
-    }
-  }
-
   // 2d slab correction
 
   if (slabflag == 1) slabcorr();
@@ -372,17 +350,23 @@ void PPPMCG::fieldforce_ik()
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
   FFT_SCALAR ekx,eky,ekz;
+  FFT_SCALAR u,v0,v1,v2,v3,v4,v5;
 
   // loop over my charges, interpolate electric field from nearby grid points
   // (nx,ny,nz) = global coords of grid pt to "lower left" of charge
   // (dx,dy,dz) = distance to "lower left" grid pt
   // (mx,my,mz) = global coords of moving stencil pt
   // ek = 3 components of E-field on particle
+  // per-atom energy/virial are accumulated from the same stencil sweep
 
   double *q = atom->q;
   double **x = atom->x;
   double **f = atom->f;
 
+  const double qscale = qqrd2e * scale;
+
+  u = v0 = v1 = v2 = v3 = v4 = v5 = ZEROF;
+
   for (int j = 0; j < num_charged; j++) {
     i = is_charged[j];
 
@@ -396,6 +380,7 @@ void PPPMCG::fieldforce_ik()
     compute_rho1d(dx,dy,dz);
 
     ekx = eky = ekz = ZEROF;
+    if (evflag_atom) u = v0 = v1 = v2 = v3 = v4 = v5 = ZEROF;
     for (n = nlower; n <= nupper; n++) {
       mz = n+nz;
       z0 = rho1d[2][n];
@@ -408,16 +393,39 @@ void PPPMCG::fieldforce_ik()
           ekx -= x0*vdx_brick[mz][my][mx];
           eky -= x0*vdy_brick[mz][my][mx];
           ekz -= x0*vdz_brick[mz][my][mx];
+          if (eflag_atom) u += x0*u_brick[mz][my][mx];
+          if (vflag_atom) {
+            v0 += x0*v0_brick[mz][my][mx];
+            v1 += x0*v1_brick[mz][my][mx];
+            v2 += x0*v2_brick[mz][my][mx];
+            v3 += x0*v3_brick[mz][my][mx];
+            v4 += x0*v4_brick[mz][my][mx];
+            v5 += x0*v5_brick[mz][my][mx];
+          }
         }
       }
     }
 
     // convert E-field to force
 
-    const double qfactor = qqrd2e * scale * q[i];
+    const double qfactor = qscale * q[i];
     f[i][0] += qfactor*ekx;
     f[i][1] += qfactor*eky;
     if (slabflag != 2) f[i][2] += qfactor*ekz;
+
+    // per-atom energy/virial, incl. 0.5 prefactor and self-energy correction
+
+    if (eflag_atom)
+      eatom[i] += qscale * (0.5*q[i]*u - g_ewald*q[i]*q[i]/MY_PIS -
+                            MY_PI2*q[i]*qsum / (g_ewald*g_ewald*volume));
+    if (vflag_atom) {
+      vatom[i][0] += 0.5*qscale*q[i]*v0;
+      vatom[i][1] += 0.5*qscale*q[i]*v1;
+      vatom[i][2] += 0.5*qscale*q[i]*v2;
+      vatom[i][3] += 0.5*qscale*q[i]*v3;
+      vatom[i][4] += 0.5*qscale*q[i]*v4;
+      vatom[i][5] += 0.5*qscale*q[i]*v5;
+    }
   }
 }
 
@@ -428,8 +436,9 @@ void PPPMCG::fieldforce_ik()
 void PPPMCG::fieldforce_ad()
 {
   int i,l,m,n,nx,ny,nz,mx,my,mz;
-  FFT_SCALAR dx,dy,dz;
+  FFT_SCALAR dx,dy,dz,x0;
   FFT_SCALAR ekx,eky,ekz;
+  FFT_SCALAR u,v0,v1,v2,v3,v4,v5;
   double s1,s2,s3;
   double sf = 0.0;
   double *prd;
@@ -455,6 +464,10 @@ void PPPMCG::fieldforce_ad()
   double **x = atom->x;
   double **f = atom->f;
 
+  const double qscale = qqrd2e * scale;
+
+  u = v0 = v1 = v2 = v3 = v4 = v5 = ZEROF;
+
   for (int j = 0; j < num_charged; j++) {
     i = is_charged[j];
 
@@ -469,6 +482,7 @@ void PPPMCG::fieldforce_ad()
     compute_drho1d(dx,dy,dz);
 
     ekx = eky = ekz = ZEROF;
+    if (evflag_atom) u = v0 = v1 = v2 = v3 = v4 = v5 = ZEROF;
     for (n = nlower; n <= nupper; n++) {
       mz = n+nz;
       for (m = nlower; m <= nupper; m++) {
@@ -478,6 +492,18 @@ void PPPMCG::fieldforce_ad()
           ekx += drho1d[0][l]*rho1d[1][m]*rho1d[2][n]*u_brick[mz][my][mx];
           eky += rho1d[0][l]*drho1d[1][m]*rho1d[2][n]*u_brick[mz][my][mx];
           ekz += rho1d[0][l]*rho1d[1][m]*drho1d[2][n]*u_brick[mz][my][mx];
+          if (evflag_atom) {
+            x0 = rho1d[0][l]*rho1d[1][m]*rho1d[2][n];
+            if (eflag_atom) u += x0*u_brick[mz][my][mx];
+            if (vflag_atom) {
+              v0 += x0*v0_brick[mz][my][mx];
+              v1 += x0*v1_brick[mz][my][mx];
+              v2 += x0*v2_brick[mz][my][mx];
+              v3 += x0*v3_brick[mz][my][mx];
+              v4 += x0*v4_brick[mz][my][mx];
+              v5 += x0*v5_brick[mz][my][mx];
+            }
+          }
         }
       }
     }
@@ -487,7 +513,7 @@ void PPPMCG::fieldforce_ad()
 
     // convert E-field to force and subtract self forces
 
-    const double qfactor = qqrd2e * scale;
+    const double qfactor = qscale;
 
     s1 = x[i][0]*hx_inv;
     s2 = x[i][1]*hy_inv;
@@ -507,70 +533,19 @@ void PPPMCG::fieldforce_ad()
     sf += sf_coeff[5]*sin(4*MY_PI*s3);
     sf *= 2*q[i]*q[i];
     if (slabflag != 2) f[i][2] += qfactor*(ekz*q[i] - sf);
-  }
-}
 
-/* ----------------------------------------------------------------------
-   interpolate from grid to get per-atom energy/virial
-------------------------------------------------------------------------- */
-
-void PPPMCG::fieldforce_peratom()
-{
-  int i,l,m,n,nx,ny,nz,mx,my,mz;
-  FFT_SCALAR dx,dy,dz,x0,y0,z0;
-  FFT_SCALAR u,v0,v1,v2,v3,v4,v5;
-
-  // loop over my charges, interpolate from nearby grid points
-  // (nx,ny,nz) = global coords of grid pt to "lower left" of charge
-  // (dx,dy,dz) = distance to "lower left" grid pt
-  // (mx,my,mz) = global coords of moving stencil pt
-
-  double *q = atom->q;
-  double **x = atom->x;
-
-  for (int j = 0; j < num_charged; j++) {
-    i = is_charged[j];
-
-    nx = part2grid[i][0];
-    ny = part2grid[i][1];
-    nz = part2grid[i][2];
-    dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
-    dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
-    dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
-
-    compute_rho1d(dx,dy,dz);
-
-    u = v0 = v1 = v2 = v3 = v4 = v5 = ZEROF;
-    for (n = nlower; n <= nupper; n++) {
-      mz = n+nz;
-      z0 = rho1d[2][n];
-      for (m = nlower; m <= nupper; m++) {
-        my = m+ny;
-        y0 = z0*rho1d[1][m];
-        for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
-          x0 = y0*rho1d[0][l];
-          if (eflag_atom) u += x0*u_brick[mz][my][mx];
-          if (vflag_atom) {
-            v0 += x0*v0_brick[mz][my][mx];
-            v1 += x0*v1_brick[mz][my][mx];
-            v2 += x0*v2_brick[mz][my][mx];
-            v3 += x0*v3_brick[mz][my][mx];
-            v4 += x0*v4_brick[mz][my][mx];
-            v5 += x0*v5_brick[mz][my][mx];
-          }
-        }
-      }
-    }
+    // per-atom energy/virial, incl. 0.5 prefactor and self-energy correction
 
-    if (eflag_atom) eatom[i] += q[i]*u;
+    if (eflag_atom)
+      eatom[i] += qscale * (0.5*q[i]*u - g_ewald*q[i]*q[i]/MY_PIS -
+                            MY_PI2*q[i]*qsum / (g_ewald*g_ewald*volume));
     if (vflag_atom) {
-      vatom[i][0] += q[i]*v0;
-      vatom[i][1] += q[i]*v1;
-      vatom[i][2] += q[i]*v2;
-      vatom[i][3] += q[i]*v3;
-      vatom[i][4] += q[i]*v4;
-      vatom[i][5] += q[i]*v5;
+      vatom[i][0] += 0.5*qscale*q[i]*v0;
+      vatom[i][1] += 0.5*qscale*q[i]*v1;
+      vatom[i][2] += 0.5*qscale*q[i]*v2;
+      vatom[i][3] += 0.5*qscale*q[i]*v3;
+      vatom[i][4] += 0.5*qscale*q[i]*v4;
+      vatom[i][5] += 0.5*qscale*q[i]*v5;
     }
   }
 }
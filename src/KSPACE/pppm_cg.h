@@ -41,7 +41,6 @@ class PPPMCG : public PPPM {
   void make_rho() override;
   void fieldforce_ik() override;
   void fieldforce_ad() override;
-  void fieldforce_peratom() override;
   void slabcorr() override;
   void make_rho_groups(int, int, int) override;
 };
@@ -81,13 +81,16 @@ void remap_3d(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
                 MPI_FFT_SCALAR,plan->recv_proc[irecv],0,
                 plan->comm,&plan->request[irecv]);
 
-    // send all messages to other procs
+    // pack and send all messages to other procs
+    // nonblocking sends from per-message slots of sendbuf let the
+    //   packing of later messages overlap the transfer of earlier ones
 
     for (isend = 0; isend < plan->nsend; isend++) {
       plan->pack(&in[plan->send_offset[isend]],
-                 plan->sendbuf,&plan->packplan[isend]);
-      MPI_Send(plan->sendbuf,plan->send_size[isend],MPI_FFT_SCALAR,
-               plan->send_proc[isend],0,plan->comm);
+                 &plan->sendbuf[plan->send_bufloc[isend]],&plan->packplan[isend]);
+      MPI_Isend(&plan->sendbuf[plan->send_bufloc[isend]],plan->send_size[isend],
+                MPI_FFT_SCALAR,plan->send_proc[isend],0,plan->comm,
+                &plan->sendrequest[isend]);
     }
 
     // copy in -> scratch -> out for self data
@@ -110,6 +113,10 @@ void remap_3d(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
                    &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
     }
 
+    // wait for all sends to drain before sendbuf can be reused
+
+    if (plan->nsend) MPI_Waitall(plan->nsend,plan->sendrequest,MPI_STATUS_IGNORE);
+
   // use All2Allv collective for remap communication
 
   } else {
@@ -308,11 +315,14 @@ struct remap_plan_3d *remap_3d_create_plan(
     plan->send_offset = (int *) malloc(nsend*sizeof(int));
     plan->send_size = (int *) malloc(nsend*sizeof(int));
     plan->send_proc = (int *) malloc(nsend*sizeof(int));
+    plan->send_bufloc = (int *) malloc(nsend*sizeof(int));
+    plan->sendrequest = (MPI_Request *) malloc(nsend*sizeof(MPI_Request));
     plan->packplan = (struct pack_plan_3d *)
       malloc(nsend*sizeof(struct pack_plan_3d));
 
     if (plan->send_offset == nullptr || plan->send_size == nullptr ||
-        plan->send_proc == nullptr || plan->packplan == nullptr) return nullptr;
+        plan->send_proc == nullptr || plan->send_bufloc == nullptr ||
+        plan->sendrequest == nullptr || plan->packplan == nullptr) return nullptr;
   }
 
   // store send info, with self as last entry
@@ -574,13 +584,16 @@ struct remap_plan_3d *remap_3d_create_plan(
   free(inarray);
   free(outarray);
 
-  // find biggest send message (not including self) and malloc space for it
+  // malloc space for all send messages (not including self) at once,
+  // so every message has its own slot and all sends can be in flight
 
   plan->sendbuf = nullptr;
 
   size = 0;
-  for (nsend = 0; nsend < plan->nsend; nsend++)
-    size = MAX(size,plan->send_size[nsend]);
+  for (nsend = 0; nsend < plan->nsend; nsend++) {
+    plan->send_bufloc[nsend] = size;
+    size += plan->send_size[nsend];
+  }
 
   if (size) {
     plan->sendbuf = (FFT_SCALAR *) malloc(size*sizeof(FFT_SCALAR));
@@ -651,6 +664,8 @@ void remap_3d_destroy_plan(struct remap_plan_3d *plan)
     free(plan->send_offset);
     free(plan->send_size);
     free(plan->send_proc);
+    free(plan->send_bufloc);
+    free(plan->sendrequest);
     free(plan->packplan);
     if (plan->sendbuf) free(plan->sendbuf);
   }
@@ -27,6 +27,8 @@ struct remap_plan_3d {
   int *send_offset;                   // extraction loc for each send
   int *send_size;                     // size of each send message
   int *send_proc;                     // proc to send each message to
+  int *send_bufloc;                   // offset in sendbuf for each send
+  MPI_Request *sendrequest;           // MPI request for each posted send
   struct pack_plan_3d *packplan;      // pack plan for each send message
   int *recv_offset;                   // insertion loc for each recv
   int *recv_size;                     // size of each recv message
@@ -93,18 +93,32 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void AngleLepton::eval()
 {
   std::vector<Lepton::CompiledExpression> angleforce;
   std::vector<Lepton::CompiledExpression> anglepot;
-  std::vector<bool> has_ref;
+  std::vector<double *> theta_force, theta_pot;
   try {
     for (const auto &expr : expressions) {
       auto parsed = Lepton::Parser::parse(LeptonUtils::substitute(expr, lmp));
       angleforce.emplace_back(parsed.differentiate("theta").createCompiledExpression());
-      has_ref.push_back(true);
+      if (EFLAG) anglepot.emplace_back(parsed.createCompiledExpression());
+    }
+
+    // cache pointers to the expression variables after all expressions are
+    //   created, so growing the vectors cannot move the storage they point to
+    // avoids a per-angle string lookup of the variable in the loop
+    // a null pointer means the expression is constant in that variable
+
+    for (auto &expr : angleforce) {
       try {
-        angleforce.back().getVariableReference("theta");
+        theta_force.push_back(&expr.getVariableReference("theta"));
       } catch (Lepton::Exception &) {
-        has_ref.back() = false;
+        theta_force.push_back(nullptr);
+      }
+    }
+    for (auto &expr : anglepot) {
+      try {
+        theta_pot.push_back(&expr.getVariableReference("theta"));
+      } catch (Lepton::Exception &) {
+        theta_pot.push_back(nullptr);
       }
-      if (EFLAG) anglepot.emplace_back(parsed.createCompiledExpression());
     }
   } catch (std::exception &e) {
     error->all(FLERR, e.what());
@@ -156,7 +170,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void AngleLepton::eval()
 
     const double dtheta = acos(c) - theta0[type];
     const int idx = type2expression[type];
-    if (has_ref[idx]) angleforce[idx].getVariableReference("theta") = dtheta;
+    if (theta_force[idx]) *theta_force[idx] = dtheta;
     const double a = -angleforce[idx].evaluate() * s;
     const double a11 = a * c / rsq1;
     const double a12 = -a / (r1 * r2);
@@ -192,11 +206,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void AngleLepton::eval()
 
     double eangle = 0.0;
     if (EFLAG) {
-      try {
-        anglepot[idx].getVariableReference("theta") = dtheta;
-      } catch (Lepton::Exception &) {
-        ;    // ignore -> constant force
-      }
+      if (theta_pot[idx]) *theta_pot[idx] = dtheta;
       eangle = anglepot[idx].evaluate() - offset[type];
     }
     if (EVFLAG)
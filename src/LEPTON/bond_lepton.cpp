@@ -85,18 +85,32 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void BondLepton::eval()
 {
   std::vector<Lepton::CompiledExpression> bondforce;
   std::vector<Lepton::CompiledExpression> bondpot;
-  std::vector<bool> has_ref;
+  std::vector<double *> r_force, r_pot;
   try {
     for (const auto &expr : expressions) {
       auto parsed = Lepton::Parser::parse(LeptonUtils::substitute(expr, lmp));
       bondforce.emplace_back(parsed.differentiate("r").createCompiledExpression());
-      has_ref.push_back(true);
+      if (EFLAG) bondpot.emplace_back(parsed.createCompiledExpression());
+    }
+
+    // cache pointers to the expression variables after all expressions are
+    //   created, so growing the vectors cannot move the storage they point to
+    // avoids a per-bond string lookup of the variable in the loop
+    // a null pointer means the expression is constant in that variable
+
+    for (auto &expr : bondforce) {
       try {
-        bondforce.back().getVariableReference("r");
+        r_force.push_back(&expr.getVariableReference("r"));
       } catch (Lepton::Exception &) {
-        has_ref.back() = false;
+        r_force.push_back(nullptr);
+      }
+    }
+    for (auto &expr : bondpot) {
+      try {
+        r_pot.push_back(&expr.getVariableReference("r"));
+      } catch (Lepton::Exception &) {
+        r_pot.push_back(nullptr);
       }
-      if (EFLAG) bondpot.emplace_back(parsed.createCompiledExpression());
     }
   } catch (std::exception &e) {
     error->all(FLERR, e.what());
@@ -126,7 +140,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void BondLepton::eval()
 
     double fbond = 0.0;
     if (r > 0.0) {
-      if (has_ref[idx]) bondforce[idx].getVariableReference("r") = dr;
+      if (r_force[idx]) *r_force[idx] = dr;
       fbond = -bondforce[idx].evaluate() / r;
     }
 
@@ -146,11 +160,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void BondLepton::eval()
 
     double ebond = 0.0;
     if (EFLAG) {
-      try {
-        bondpot[idx].getVariableReference("r") = dr;
-      } catch (Lepton::Exception &) {
-        ;    // ignore -> constant potential
-      }
+      if (r_pot[idx]) *r_pot[idx] = dr;
       ebond = bondpot[idx].evaluate() - offset[type];
     }
     if (EVFLAG) ev_tally(i1, i2, nlocal, NEWTON_BOND, ebond, fbond, delx, dely, delz);
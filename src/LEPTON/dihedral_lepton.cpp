@@ -93,18 +93,32 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void DihedralLepton::eval()
 {
   std::vector<Lepton::CompiledExpression> dihedralforce;
   std::vector<Lepton::CompiledExpression> dihedralpot;
-  std::vector<bool> has_ref;
+  std::vector<double *> phi_force, phi_pot;
   try {
     for (const auto &expr : expressions) {
       auto parsed = Lepton::Parser::parse(LeptonUtils::substitute(expr, lmp));
       dihedralforce.emplace_back(parsed.differentiate("phi").createCompiledExpression());
-      has_ref.push_back(true);
+      if (EFLAG) dihedralpot.emplace_back(parsed.createCompiledExpression());
+    }
+
+    // cache pointers to the expression variables after all expressions are
+    //   created, so growing the vectors cannot move the storage they point to
+    // avoids a per-dihedral string lookup of the variable in the loop
+    // a null pointer means the expression is constant in that variable
+
+    for (auto &expr : dihedralforce) {
       try {
-        dihedralforce.back().getVariableReference("phi");
+        phi_force.push_back(&expr.getVariableReference("phi"));
       } catch (Lepton::Exception &) {
-        has_ref.back() = false;
+        phi_force.push_back(nullptr);
+      }
+    }
+    for (auto &expr : dihedralpot) {
+      try {
+        phi_pot.push_back(&expr.getVariableReference("phi"));
+      } catch (Lepton::Exception &) {
+        phi_pot.push_back(nullptr);
       }
-      if (EFLAG) dihedralpot.emplace_back(parsed.createCompiledExpression());
     }
   } catch (std::exception &e) {
     error->all(FLERR, e.what());
@@ -286,7 +300,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void DihedralLepton::eval()
     }
 
     const int idx = type2expression[type];
-    if (has_ref[idx]) dihedralforce[idx].getVariableReference("phi") = phi;
+    if (phi_force[idx]) *phi_force[idx] = phi;
     double m_du_dphi = -dihedralforce[idx].evaluate();
 
     // ----- Step 4: Calculate the force direction in real space -----
@@ -330,11 +344,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_BOND> void DihedralLepton::eval()
 
     double edihedral = 0.0;
     if (EFLAG) {
-      try {
-        dihedralpot[idx].getVariableReference("phi") = phi;
-      } catch (Lepton::Exception &) {
-        ;    // ignore -> constant potential
-      }
+      if (phi_pot[idx]) *phi_pot[idx] = phi;
       edihedral = dihedralpot[idx].evaluate();
     }
     if (EVFLAG)
@@ -106,18 +106,32 @@ template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void PairLepton::eval()
 
   std::vector<Lepton::CompiledExpression> pairforce;
   std::vector<Lepton::CompiledExpression> pairpot;
-  std::vector<bool> has_ref;
+  std::vector<double *> r_force, r_pot;
   try {
     for (const auto &expr : expressions) {
       auto parsed = Lepton::Parser::parse(LeptonUtils::substitute(expr, lmp), functions);
       pairforce.emplace_back(parsed.differentiate("r").createCompiledExpression());
-      has_ref.push_back(true);
+      if (EFLAG) pairpot.emplace_back(parsed.createCompiledExpression());
+    }
+
+    // cache pointers to the expression variables after all expressions are
+    //   created, so growing the vectors cannot move the storage they point to
+    // avoids a per-pair string lookup of the variable in the inner loop
+    // a null pointer means the expression is constant in that variable
+
+    for (auto &expr : pairforce) {
       try {
-        pairforce.back().getVariableReference("r");
+        r_force.push_back(&expr.getVariableReference("r"));
       } catch (Lepton::Exception &) {
-        has_ref.back() = false;
+        r_force.push_back(nullptr);
+      }
+    }
+    for (auto &expr : pairpot) {
+      try {
+        r_pot.push_back(&expr.getVariableReference("r"));
+      } catch (Lepton::Exception &) {
+        r_pot.push_back(nullptr);
       }
-      if (EFLAG) pairpot.emplace_back(parsed.createCompiledExpression());
     }
   } catch (std::exception &e) {
     error->all(FLERR, e.what());
@@ -149,7 +163,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void PairLepton::eval()
       if (rsq < cutsq[itype][jtype]) {
         const double r = sqrt(rsq);
         const int idx = type2expression[itype][jtype];
-        if (has_ref[idx]) pairforce[idx].getVariableReference("r") = r;
+        if (r_force[idx]) *r_force[idx] = r;
         const double fpair = -pairforce[idx].evaluate() / r * factor_lj;
 
         fxtmp += delx * fpair;
@@ -163,11 +177,7 @@ template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void PairLepton::eval()
 
         double evdwl = 0.0;
         if (EFLAG) {
-          try {
-            pairpot[idx].getVariableReference("r") = r;
-          } catch (Lepton::Exception &) {
-            ;    // ignore -> constant potential
-          }
+          if (r_pot[idx]) *r_pot[idx] = r;
           evdwl = pairpot[idx].evaluate() - offset[itype][jtype];
           evdwl *= factor_lj;
         }
@@ -81,30 +81,39 @@ template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void PairLeptonCoul::eval()
 
   std::vector<Lepton::CompiledExpression> pairforce;
   std::vector<Lepton::CompiledExpression> pairpot;
-  std::vector<std::array<bool, 3>> has_ref;
+  std::vector<std::array<double *, 3>> vars_force, vars_pot;
   try {
     for (const auto &expr : expressions) {
       auto parsed = Lepton::Parser::parse(LeptonUtils::substitute(expr, lmp), functions);
       pairforce.emplace_back(parsed.differentiate("r").createCompiledExpression());
-      has_ref.push_back({true, true, true});
-      try {
-        pairforce.back().getVariableReference("r");
-      } catch (Lepton::Exception &) {
-        has_ref.back()[0] = false;
-      }
       if (EFLAG) pairpot.emplace_back(parsed.createCompiledExpression());
+    }
 
-      // check if there are references to charges
-
-      try {
-        pairforce.back().getVariableReference("qi");
-      } catch (Lepton::Exception &) {
-        has_ref.back()[1] = false;
+    // cache pointers to the r, qi, qj expression variables after all
+    //   expressions are created, so growing the vectors cannot move the
+    //   storage they point to
+    // avoids per-pair string lookups of the variables in the inner loop
+    // a null pointer means the expression is constant in that variable
+
+    const char *varnames[] = {"r", "qi", "qj"};
+    for (auto &expr : pairforce) {
+      vars_force.push_back({nullptr, nullptr, nullptr});
+      for (int k = 0; k < 3; ++k) {
+        try {
+          vars_force.back()[k] = &expr.getVariableReference(varnames[k]);
+        } catch (Lepton::Exception &) {
+          ;    // ignore -> constant in this variable
+        }
       }
-      try {
-        pairforce.back().getVariableReference("qj");
-      } catch (Lepton::Exception &) {
-        has_ref.back()[2] = false;
+    }
+    for (auto &expr : pairpot) {
+      vars_pot.push_back({nullptr, nullptr, nullptr});
+      for (int k = 0; k < 3; ++k) {
+        try {
+          vars_pot.back()[k] = &expr.getVariableReference(varnames[k]);
+        } catch (Lepton::Exception &) {
+          ;    // ignore -> constant in this variable
+        }
       }
     }
   } catch (std::exception &e) {
@@ -137,9 +146,10 @@ template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void PairLeptonCoul::eval()
       if (rsq < cutsq[itype][jtype]) {
         const double r = sqrt(rsq);
         const int idx = type2expression[itype][jtype];
-        if (has_ref[idx][0]) pairforce[idx].getVariableReference("r") = r;
-        if (has_ref[idx][1]) pairforce[idx].getVariableReference("qi") = q2e * q[i];
-        if (has_ref[idx][2]) pairforce[idx].getVariableReference("qj") = q2e * q[j];
+        const auto &vf = vars_force[idx];
+        if (vf[0]) *vf[0] = r;
+        if (vf[1]) *vf[1] = q2e * q[i];
+        if (vf[2]) *vf[2] = q2e * q[j];
         const double fpair = -pairforce[idx].evaluate() / r * factor_coul;
 
         fxtmp += delx * fpair;
@@ -153,13 +163,10 @@ template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void PairLeptonCoul::eval()
 
         double ecoul = 0.0;
         if (EFLAG) {
-          try {
-            pairpot[idx].getVariableReference("r") = r;
-          } catch (Lepton::Exception &) {
-            ;    // ignore -> constant potential
-          }
-          if (has_ref[idx][1]) pairpot[idx].getVariableReference("qi") = q2e * q[i];
-          if (has_ref[idx][2]) pairpot[idx].getVariableReference("qj") = q2e * q[j];
+          const auto &vp = vars_pot[idx];
+          if (vp[0]) *vp[0] = r;
+          if (vp[1]) *vp[1] = q2e * q[i];
+          if (vp[2]) *vp[2] = q2e * q[j];
 
           ecoul = pairpot[idx].evaluate();
           ecoul *= factor_coul;
@@ -183,6 +183,15 @@ void PairEAM::compute(int eflag, int vflag)
 
   // rho = density at each atom
   // loop over neighbors of my atoms
+  // with newton off there is no reverse communication of ghost densities
+  //   and rho[i] is complete when the j-loop of atom i ends: pairs (k,i)
+  //   with k < i were accumulated in earlier iterations (half newtoff
+  //   lists store atoms in ascending order) and all pairs (i,j) with
+  //   j > i are accumulated in atom i's own loop
+  // in that case fuse the embedding evaluation into this sweep while
+  //   rho[i] is still in cache and skip the separate pass below
+
+  const int fused = !newton_pair;
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
@@ -193,6 +202,8 @@ void PairEAM::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    const int *t2r_i = type2rhor[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
@@ -212,41 +223,22 @@ void PairEAM::compute(int eflag, int vflag)
         coeff = rhor_spline[type2rhor[jtype][itype]][m];
         rho[i] += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
         if (newton_pair || j < nlocal) {
-          coeff = rhor_spline[type2rhor[itype][jtype]][m];
+          coeff = rhor_spline[t2r_i[jtype]][m];
           rho[j] += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
         }
       }
     }
-  }
 
-  // communicate and sum densities
+    if (fused) embed_one(i,eflag,beyond_rhomax);
+  }
 
-  if (newton_pair) comm->reverse_comm(this);
+  // communicate and sum densities, then evaluate the embedding term
+  // skipped when the embedding was fused into the density sweep above
 
-  // fp = derivative of embedding energy at each atom
-  // phi = embedding energy at each atom
-  // if rho > rhomax (e.g. due to close approach of two atoms),
-  //   will exceed table, so add linear term to conserve energy
+  if (!fused) {
+    if (newton_pair) comm->reverse_comm(this);
 
-  for (ii = 0; ii < inum; ii++) {
-    i = ilist[ii];
-    p = rho[i]*rdrho + 1.0;
-    m = static_cast<int> (p);
-    m = MAX(1,MIN(m,nrho-1));
-    p -= m;
-    p = MIN(p,1.0);
-    coeff = frho_spline[type2frho[type[i]]][m];
-    fp[i] = (coeff[0]*p + coeff[1])*p + coeff[2];
-    if (eflag) {
-      phi = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
-      if (rho[i] > rhomax) {
-        phi += fp[i] * (rho[i]-rhomax);
-        beyond_rhomax = 1;
-      }
-      phi *= scale[type[i]][type[i]];
-      if (eflag_global) eng_vdwl += phi;
-      if (eflag_atom) eatom[i] += phi;
-    }
+    for (ii = 0; ii < inum; ii++) embed_one(ilist[ii],eflag,beyond_rhomax);
   }
 
   // communicate derivative of embedding function
@@ -268,6 +260,13 @@ void PairEAM::compute(int eflag, int vflag)
     jnum = numneigh[i];
     numforce[i] = 0;
 
+    // hoist coefficient rows of atom i's type, so the inner loop
+    //   indexes each row directly instead of chasing row pointers
+
+    const int *t2r_i = type2rhor[itype];
+    const int *t2z_i = type2z2r[itype];
+    const double *scale_i = scale[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
@@ -298,11 +297,11 @@ void PairEAM::compute(int eflag, int vflag)
         //   hence embed' = Fi(sum rho_ij) rhojp + Fj(sum rho_ji) rhoip
         // scale factor can be applied by thermodynamic integration
 
-        coeff = rhor_spline[type2rhor[itype][jtype]][m];
+        coeff = rhor_spline[t2r_i[jtype]][m];
         rhoip = (coeff[0]*p + coeff[1])*p + coeff[2];
         coeff = rhor_spline[type2rhor[jtype][itype]][m];
         rhojp = (coeff[0]*p + coeff[1])*p + coeff[2];
-        coeff = z2r_spline[type2z2r[itype][jtype]][m];
+        coeff = z2r_spline[t2z_i[jtype]][m];
         z2p = (coeff[0]*p + coeff[1])*p + coeff[2];
         z2 = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
 
@@ -310,7 +309,7 @@ void PairEAM::compute(int eflag, int vflag)
         phi = z2*recip;
         phip = z2p*recip - phi*recip;
         psip = fp[i]*rhojp + fp[j]*rhoip + phip;
-        fpair = -scale[itype][jtype]*psip*recip;
+        fpair = -scale_i[jtype]*psip*recip;
 
         f[i][0] += delx*fpair;
         f[i][1] += dely*fpair;
@@ -321,7 +320,7 @@ void PairEAM::compute(int eflag, int vflag)
           f[j][2] -= delz*fpair;
         }
 
-        if (eflag) evdwl = scale[itype][jtype]*phi;
+        if (eflag) evdwl = scale_i[jtype]*phi;
         if (evflag) ev_tally(i,j,nlocal,newton_pair,evdwl,0.0,fpair,delx,dely,delz);
       }
     }
@@ -340,6 +339,36 @@ void PairEAM::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   fp = derivative of embedding energy of atom i
+   phi = embedding energy of atom i
+   if rho > rhomax (e.g. due to close approach of two atoms),
+     will exceed table, so add linear term to conserve energy
+------------------------------------------------------------------------- */
+
+void PairEAM::embed_one(int i, int eflag, int &beyond_rhomax)
+{
+  int *type = atom->type;
+
+  double p = rho[i]*rdrho + 1.0;
+  int m = static_cast<int> (p);
+  m = MAX(1,MIN(m,nrho-1));
+  p -= m;
+  p = MIN(p,1.0);
+  double *coeff = frho_spline[type2frho[type[i]]][m];
+  fp[i] = (coeff[0]*p + coeff[1])*p + coeff[2];
+  if (eflag) {
+    double phi = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
+    if (rho[i] > rhomax) {
+      phi += fp[i] * (rho[i]-rhomax);
+      beyond_rhomax = 1;
+    }
+    phi *= scale[type[i]][type[i]];
+    if (eflag_global) eng_vdwl += phi;
+    if (eflag_atom) eatom[i] += phi;
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -106,6 +106,7 @@ class PairEAM : public Pair {
   Fs *fs;
 
   virtual void allocate();
+  void embed_one(int, int, int &);
   virtual void array2spline();
   void interpolate(int, double, double *, double **);
 
@@ -75,6 +75,15 @@ PairSW::~PairSW()
 /* ---------------------------------------------------------------------- */
 
 void PairSW::compute(int eflag, int vflag)
+{
+  // single-element systems use a specialized kernel with the element
+  // mapping and parameter table lookups hoisted out of the loops
+
+  if (nelements == 1) eval<1>(eflag,vflag);
+  else eval<0>(eflag,vflag);
+}
+
+template <int ONETYPE> void PairSW::eval(int eflag, int vflag)
 {
   int i,j,k,ii,jj,kk,inum,jnum,jnumm1;
   int itype,jtype,ktype,ijparam,ikparam,ijkparam;
@@ -101,12 +110,16 @@ void PairSW::compute(int eflag, int vflag)
 
   double fxtmp,fytmp,fztmp;
 
+  const int oneparam = ONETYPE ? elem3param[0][0][0] : 0;
+  itype = jtype = ktype = 0;
+  ijparam = ikparam = ijkparam = oneparam;
+
   // loop over full neighbor list of my atoms
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     itag = tag[i];
-    itype = map[type[i]];
+    if (!ONETYPE) itype = map[type[i]];
     xtmp = x[i][0];
     ytmp = x[i][1];
     ztmp = x[i][2];
@@ -127,8 +140,10 @@ void PairSW::compute(int eflag, int vflag)
       delz = ztmp - x[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
 
-      jtype = map[type[j]];
-      ijparam = elem3param[itype][jtype][jtype];
+      if (!ONETYPE) {
+        jtype = map[type[j]];
+        ijparam = elem3param[itype][jtype][jtype];
+      }
       if (rsq >= params[ijparam].cutsq) {
         continue;
       } else {
@@ -173,8 +188,10 @@ void PairSW::compute(int eflag, int vflag)
     }
     for (jj = 0; jj < jnumm1; jj++) {
       j = neighshort[jj];
-      jtype = map[type[j]];
-      ijparam = elem3param[itype][jtype][jtype];
+      if (!ONETYPE) {
+        jtype = map[type[j]];
+        ijparam = elem3param[itype][jtype][jtype];
+      }
       delr1[0] = x[j][0] - xtmp;
       delr1[1] = x[j][1] - ytmp;
       delr1[2] = x[j][2] - ztmp;
@@ -185,9 +202,11 @@ void PairSW::compute(int eflag, int vflag)
 
       for (kk = jj+1; kk < numshort; kk++) {
         k = neighshort[kk];
-        ktype = map[type[k]];
-        ikparam = elem3param[itype][ktype][ktype];
-        ijkparam = elem3param[itype][jtype][ktype];
+        if (!ONETYPE) {
+          ktype = map[type[k]];
+          ikparam = elem3param[itype][ktype][ktype];
+          ijkparam = elem3param[itype][jtype][ktype];
+        }
 
         delr2[0] = x[k][0] - xtmp;
         delr2[1] = x[k][1] - ytmp;
@@ -57,6 +57,7 @@ class PairSW : public Pair {
   int params_mapped;          // whether parameters have been read and mapped to elements
 
   void settings(int, char **) override;
+  template <int ONETYPE> void eval(int, int);
   virtual void allocate();
   virtual void read_file(char *);
   virtual void setup_params();
@@ -83,32 +83,41 @@ void PairTersoff::compute(int eflag, int vflag)
 {
   ev_init(eflag,vflag);
 
+  // single-element systems use a specialized kernel with the element
+  // mapping and parameter table lookups hoisted out of the loops
+
+  if (nelements == 1) dispatch<1>(eflag);
+  else dispatch<0>(eflag);
+}
+
+template <int ONETYPE> void PairTersoff::dispatch(int eflag)
+{
   if (shift_flag) {
     if (evflag) {
       if (eflag) {
-        if (vflag_either) eval<1,1,1,1>();
-        else eval<1,1,1,0>();
+        if (vflag_either) eval<1,1,1,1,ONETYPE>();
+        else eval<1,1,1,0,ONETYPE>();
       } else {
-        if (vflag_either) eval<1,1,0,1>();
-        else eval<1,1,0,0>();
+        if (vflag_either) eval<1,1,0,1,ONETYPE>();
+        else eval<1,1,0,0,ONETYPE>();
       }
-    } else eval<1,0,0,0>();
+    } else eval<1,0,0,0,ONETYPE>();
 
   } else {
 
     if (evflag) {
       if (eflag) {
-        if (vflag_either) eval<0,1,1,1>();
-        else eval<0,1,1,0>();
+        if (vflag_either) eval<0,1,1,1,ONETYPE>();
+        else eval<0,1,1,0,ONETYPE>();
       } else {
-        if (vflag_either) eval<0,1,0,1>();
-        else eval<0,1,0,0>();
+        if (vflag_either) eval<0,1,0,1,ONETYPE>();
+        else eval<0,1,0,0,ONETYPE>();
       }
-    } else eval<0,0,0,0>();
+    } else eval<0,0,0,0,ONETYPE>();
   }
 }
 
-template <int SHIFT_FLAG, int EVFLAG, int EFLAG, int VFLAG_EITHER>
+template <int SHIFT_FLAG, int EVFLAG, int EFLAG, int VFLAG_EITHER, int ONETYPE>
 void PairTersoff::eval()
 {
   int i,j,k,ii,jj,kk,inum,jnum;
@@ -140,12 +149,16 @@ void PairTersoff::eval()
 
   double fxtmp,fytmp,fztmp;
 
+  const int oneparam = ONETYPE ? elem3param[0][0][0] : 0;
+  itype = jtype = ktype = 0;
+  iparam_ij = iparam_ijk = oneparam;
+
   // loop over full neighbor list of my atoms
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     itag = tag[i];
-    itype = map[type[i]];
+    if (!ONETYPE) itype = map[type[i]];
     xtmp = x[i][0];
     ytmp = x[i][1];
     ztmp = x[i][2];
@@ -193,8 +206,10 @@ void PairTersoff::eval()
         if (x[j][2] == ztmp && x[j][1] == ytmp && x[j][0] < xtmp) continue;
       }
 
-      jtype = map[type[j]];
-      iparam_ij = elem3param[itype][jtype][jtype];
+      if (!ONETYPE) {
+        jtype = map[type[j]];
+        iparam_ij = elem3param[itype][jtype][jtype];
+      }
       if (rsq >= params[iparam_ij].cutsq) continue;
 
       repulsive(&params[iparam_ij],rsq,fpair,EFLAG,evdwl);
@@ -220,8 +235,10 @@ void PairTersoff::eval()
 
     for (jj = 0; jj < numshort; jj++) {
       j = neighshort[jj];
-      jtype = map[type[j]];
-      iparam_ij = elem3param[itype][jtype][jtype];
+      if (!ONETYPE) {
+        jtype = map[type[j]];
+        iparam_ij = elem3param[itype][jtype][jtype];
+      }
 
       delr1[0] = x[j][0] - xtmp;
       delr1[1] = x[j][1] - ytmp;
@@ -244,8 +261,10 @@ void PairTersoff::eval()
       for (kk = 0; kk < numshort; kk++) {
         if (jj == kk) continue;
         k = neighshort[kk];
-        ktype = map[type[k]];
-        iparam_ijk = elem3param[itype][jtype][ktype];
+        if (!ONETYPE) {
+          ktype = map[type[k]];
+          iparam_ijk = elem3param[itype][jtype][ktype];
+        }
 
         delr2[0] = x[k][0] - xtmp;
         delr2[1] = x[k][1] - ytmp;
@@ -284,8 +303,10 @@ void PairTersoff::eval()
       for (kk = 0; kk < numshort; kk++) {
         if (jj == kk) continue;
         k = neighshort[kk];
-        ktype = map[type[k]];
-        iparam_ijk = elem3param[itype][jtype][ktype];
+        if (!ONETYPE) {
+          ktype = map[type[k]];
+          iparam_ijk = elem3param[itype][jtype][ktype];
+        }
 
         delr2[0] = x[k][0] - xtmp;
         delr2[1] = x[k][1] - ytmp;
@@ -34,7 +34,8 @@ class PairTersoff : public Pair {
   void init_style() override;
   double init_one(int, int) override;
 
-  template <int SHIFT_FLAG, int EVFLAG, int EFLAG, int VFLAG_ATOM> void eval();
+  template <int ONETYPE> void dispatch(int);
+  template <int SHIFT_FLAG, int EVFLAG, int EFLAG, int VFLAG_ATOM, int ONETYPE> void eval();
 
   static constexpr int NPARAMS_PER_LINE = 17;
 
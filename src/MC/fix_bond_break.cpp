@@ -104,6 +104,9 @@ FixBondBreak::FixBondBreak(LAMMPS *lmp, int narg, char **arg) :
 
   maxbreak = 0;
 
+  maxinfluenced = 0;
+  influenced = checked = nullptr;
+
   // copy = special list for one atom
   // size = ms^2 + ms is sufficient
   // b/c in rebuild_special_one() neighs of all 1-2s are added,
@@ -131,6 +134,8 @@ FixBondBreak::~FixBondBreak()
   memory->destroy(finalpartner);
   memory->destroy(distsq);
   memory->destroy(broken);
+  memory->destroy(influenced);
+  memory->destroy(checked);
   delete [] copy;
 }
 
@@ -414,11 +419,15 @@ void FixBondBreak::check_ghosts()
 }
 
 /* ----------------------------------------------------------------------
-   double loop over my atoms and broken bonds
-   influenced = 1 if atom's topology is affected by any broken bond
-     yes if is one of 2 atoms in bond
-     yes if both atom IDs appear in atom's special list
-     else no
+   flag my atoms whose topology is affected by any broken bond
+   influenced = 1 if atom is one of the 2 atoms in a broken bond
+     or if both bond atom IDs appear in atom's special list
+   any atom whose special lists or angles/dihedrals/impropers reference
+     the broken bond is within 2 bonds of one of its atoms, so enumerate
+     the candidates by walking the current 1-2 lists outward from each
+     broken bond instead of testing every owned atom against every bond,
+     making the cost scale with the # of broken bonds, not system size
+   ghost copies carry current 1-2 lists from the preceding forward comm
    if influenced:
      check for angles/dihedrals/impropers to break due to specific broken bonds
      rebuild the atom's special list of 1-2,1-3,1-4 neighs
@@ -426,11 +435,10 @@ void FixBondBreak::check_ghosts()
 
 void FixBondBreak::update_topology()
 {
-  int i,j,k,n,influence,influenced,found;
+  int i,j,k,kk,m,n,p;
   tagint id1,id2;
   tagint *slist;
 
-  tagint *tag = atom->tag;
   int **nspecial = atom->nspecial;
   tagint **special = atom->special;
   int nlocal = atom->nlocal;
@@ -444,34 +452,40 @@ void FixBondBreak::update_topology()
   //  printf(" %d %d,",broken[i][0],broken[i][1]);
   //printf("\n");
 
-  for (i = 0; i < nlocal; i++) {
-    influenced = 0;
-    slist = special[i];
-
-    for (j = 0; j < nbreak; j++) {
-      id1 = broken[j][0];
-      id2 = broken[j][1];
-
-      influence = 0;
-      if (tag[i] == id1 || tag[i] == id2) influence = 1;
-      else {
-        n = nspecial[i][2];
-        found = 0;
-        for (k = 0; k < n; k++)
-          if (slist[k] == id1 || slist[k] == id2) found++;
-        if (found == 2) influence = 1;
+  if (atom->nmax > maxinfluenced) {
+    maxinfluenced = atom->nmax;
+    memory->destroy(influenced);
+    memory->destroy(checked);
+    memory->create(influenced,maxinfluenced,"bond/break:influenced");
+    memory->create(checked,maxinfluenced,"bond/break:checked");
+  }
+  for (i = 0; i < nlocal; i++) influenced[i] = 0;
+  for (i = 0; i < nlocal; i++) checked[i] = -1;
+
+  for (j = 0; j < nbreak; j++) {
+    id1 = broken[j][0];
+    id2 = broken[j][1];
+
+    for (m = 0; m < 2; m++) {
+      i = atom->map(broken[j][m]);
+      if (i < 0) continue;
+      influence_one(i,j,id1,id2);
+      slist = special[i];
+      for (k = 0; k < nspecial[i][0]; k++) {
+        n = atom->map(slist[k]);
+        if (n < 0) continue;
+        influence_one(n,j,id1,id2);
+        for (kk = 0; kk < nspecial[n][0]; kk++) {
+          p = atom->map(special[n][kk]);
+          if (p >= 0) influence_one(p,j,id1,id2);
+        }
       }
-      if (!influence) continue;
-      influenced = 1;
-
-      if (angleflag) break_angles(i,id1,id2);
-      if (dihedralflag) break_dihedrals(i,id1,id2);
-      if (improperflag) break_impropers(i,id1,id2);
     }
-
-    if (influenced) rebuild_special_one(i);
   }
 
+  for (i = 0; i < nlocal; i++)
+    if (influenced[i]) rebuild_special_one(i);
+
   int newton_bond = force->newton_bond;
 
   int all;
@@ -492,6 +506,35 @@ void FixBondBreak::update_topology()
   }
 }
 
+/* ----------------------------------------------------------------------
+   test candidate atom I against broken bond J = ID1,ID2 once, and if
+     influenced break its angles/dihedrals/impropers and flag it
+   same influence criterion as the former scan over all owned atoms
+   candidates can be enumerated more than once per bond, so the breaking
+     of topological entities is guarded by the checked stamp
+------------------------------------------------------------------------- */
+
+void FixBondBreak::influence_one(int i, int j, tagint id1, tagint id2)
+{
+  if (i >= atom->nlocal || checked[i] == j) return;
+  checked[i] = j;
+
+  if (atom->tag[i] != id1 && atom->tag[i] != id2) {
+    tagint *slist = atom->special[i];
+    int n = atom->nspecial[i][2];
+    int found = 0;
+    for (int k = 0; k < n; k++)
+      if (slist[k] == id1 || slist[k] == id2) found++;
+    if (found != 2) return;
+  }
+
+  influenced[i] = 1;
+
+  if (angleflag) break_angles(i,id1,id2);
+  if (dihedralflag) break_dihedrals(i,id1,id2);
+  if (improperflag) break_impropers(i,id1,id2);
+}
+
 /* ----------------------------------------------------------------------
    re-build special list of atom M
    does not affect 1-2 neighs (already include effects of new bond)
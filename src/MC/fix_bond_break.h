@@ -57,6 +57,9 @@ class FixBondBreak : public Fix {
   int nbreak, maxbreak;
   tagint **broken;
 
+  int *influenced, *checked;
+  int maxinfluenced;
+
   tagint *copy;
 
   class RanMars *random;
@@ -68,6 +71,7 @@ class FixBondBreak : public Fix {
 
   void check_ghosts();
   void update_topology();
+  void influence_one(int, int, tagint, tagint);
   void break_angles(int, tagint, tagint);
   void break_dihedrals(int, tagint, tagint);
   void break_impropers(int, tagint, tagint);
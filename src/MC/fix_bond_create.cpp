@@ -185,6 +185,9 @@ FixBondCreate::FixBondCreate(LAMMPS *lmp, int narg, char **arg) :
   maxcreate = 0;
   created = nullptr;
 
+  maxinfluenced = 0;
+  influenced = nullptr;
+
   // copy = special list for one atom
   // size = ms^2 + ms is sufficient
   // b/c in rebuild_special_one() neighs of all 1-2s are added,
@@ -217,6 +220,7 @@ FixBondCreate::~FixBondCreate()
   memory->destroy(finalpartner);
   memory->destroy(distsq);
   memory->destroy(created);
+  memory->destroy(influenced);
   delete [] copy;
 }
 
@@ -656,23 +660,25 @@ void FixBondCreate::check_ghosts()
 }
 
 /* ----------------------------------------------------------------------
-   double loop over my atoms and created bonds
-   influenced = 1 if atom's topology is affected by any created bond
-     yes if is one of 2 atoms in bond
-     yes if either atom ID appears in as 1-2 or 1-3 in atom's special list
-     else no
-   if influenced by any created bond:
+   flag my atoms whose topology is affected by any created bond
+   influenced = 1 if atom is one of the 2 atoms in a created bond
+     or if either bond atom ID appears as 1-2 or 1-3 in atom's special list
+   any such atom is within 2 bonds of a created bond atom, so enumerate
+     the candidates by walking the current 1-2 lists outward from each
+     created bond instead of testing every owned atom against every bond,
+     making the cost scale with the # of created bonds, not system size
+   ghost copies carry current 1-2 lists from the preceding forward comm
+   if influenced:
      rebuild the atom's special list of 1-2,1-3,1-4 neighs
      check for angles/dihedrals/impropers to create due modified special list
 ------------------------------------------------------------------------- */
 
 void FixBondCreate::update_topology()
 {
-  int i,j,k,n,influence,influenced;
+  int i,j,k,kk,m,n,p;
   tagint id1,id2;
   tagint *slist;
 
-  tagint *tag = atom->tag;
   int **nspecial = atom->nspecial;
   tagint **special = atom->special;
   int nlocal = atom->nlocal;
@@ -682,31 +688,38 @@ void FixBondCreate::update_topology()
   nimpropers = 0;
   overflow = 0;
 
-  for (i = 0; i < nlocal; i++) {
-    influenced = 0;
-    slist = special[i];
-
-    for (j = 0; j < ncreate; j++) {
-      id1 = created[j][0];
-      id2 = created[j][1];
-
-      influence = 0;
-      if (tag[i] == id1 || tag[i] == id2) influence = 1;
-      else {
-        n = nspecial[i][1];
-        for (k = 0; k < n; k++)
-          if (slist[k] == id1 || slist[k] == id2) {
-            influence = 1;
-            break;
-          }
+  if (atom->nmax > maxinfluenced) {
+    maxinfluenced = atom->nmax;
+    memory->destroy(influenced);
+    memory->create(influenced,maxinfluenced,"bond/create:influenced");
+  }
+  for (i = 0; i < nlocal; i++) influenced[i] = 0;
+
+  for (j = 0; j < ncreate; j++) {
+    id1 = created[j][0];
+    id2 = created[j][1];
+
+    for (m = 0; m < 2; m++) {
+      i = atom->map(created[j][m]);
+      if (i < 0) continue;
+      influence_one(i,id1,id2);
+      slist = special[i];
+      for (k = 0; k < nspecial[i][0]; k++) {
+        n = atom->map(slist[k]);
+        if (n < 0) continue;
+        influence_one(n,id1,id2);
+        for (kk = 0; kk < nspecial[n][0]; kk++) {
+          p = atom->map(special[n][kk]);
+          if (p >= 0) influence_one(p,id1,id2);
+        }
       }
-      if (!influence) continue;
-      influenced = 1;
     }
+  }
 
-    // rebuild_special_one() first, since used by create_angles, etc
+  // rebuild_special_one() first, since used by create_angles, etc
 
-    if (influenced) {
+  for (i = 0; i < nlocal; i++) {
+    if (influenced[i]) {
       rebuild_special_one(i);
       if (angleflag) create_angles(i);
       if (dihedralflag) create_dihedrals(i);
@@ -739,6 +752,27 @@ void FixBondCreate::update_topology()
   }
 }
 
+/* ----------------------------------------------------------------------
+   test candidate atom I against created bond ID1,ID2 and flag it
+   same influence criterion as the former scan over all owned atoms
+------------------------------------------------------------------------- */
+
+void FixBondCreate::influence_one(int i, tagint id1, tagint id2)
+{
+  if (i >= atom->nlocal || influenced[i]) return;
+
+  if (atom->tag[i] != id1 && atom->tag[i] != id2) {
+    tagint *slist = atom->special[i];
+    int n = atom->nspecial[i][1];
+    int k;
+    for (k = 0; k < n; k++)
+      if (slist[k] == id1 || slist[k] == id2) break;
+    if (k == n) return;
+  }
+
+  influenced[i] = 1;
+}
+
 /* ----------------------------------------------------------------------
    re-build special list of atom M
    does not affect 1-2 neighs (already include effects of new bond)
@@ -72,6 +72,9 @@ class FixBondCreate : public Fix {
   int ncreate, maxcreate;
   tagint **created;
 
+  int *influenced;
+  int maxinfluenced;
+
   tagint *copy;
 
   class RanMars *random;
@@ -83,6 +86,7 @@ class FixBondCreate : public Fix {
 
   void check_ghosts();
   void update_topology();
+  void influence_one(int, tagint, tagint);
   void rebuild_special_one(int);
   void create_angles(int);
   void create_dihedrals(int);
@@ -70,9 +70,9 @@ enum { NONE, MOVEATOM, MOVEMOL };    // movemode
 FixGCMC::FixGCMC(LAMMPS *lmp, int narg, char **arg) :
     Fix(lmp, narg, arg), region(nullptr), idregion(nullptr), full_flag(false),
     groupstrings(nullptr), grouptypestrings(nullptr), grouptypebits(nullptr), grouptypes(nullptr),
-    local_gas_list(nullptr), molcoords(nullptr), molq(nullptr), molimage(nullptr),
-    random_equal(nullptr), random_unequal(nullptr), fixrigid(nullptr), fixshake(nullptr),
-    idrigid(nullptr), idshake(nullptr)
+    local_gas_list(nullptr), grid_head(nullptr), grid_next(nullptr), molcoords(nullptr),
+    molq(nullptr), molimage(nullptr), random_equal(nullptr), random_unequal(nullptr),
+    fixrigid(nullptr), fixshake(nullptr), idrigid(nullptr), idshake(nullptr)
 {
   if (narg < 11) utils::missing_cmd_args(FLERR, "fix gcmc", error);
 
@@ -222,6 +222,10 @@ FixGCMC::FixGCMC(LAMMPS *lmp, int narg, char **arg) :
 
   gcmc_nmax = 0;
   local_gas_list = nullptr;
+
+  grid_valid = 0;
+  grid_maxcell = 0;
+  grid_maxatom = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -398,6 +402,8 @@ FixGCMC::~FixGCMC()
   delete random_unequal;
 
   memory->destroy(local_gas_list);
+  memory->destroy(grid_head);
+  memory->destroy(grid_next);
   memory->destroy(molcoords);
   memory->destroy(molq);
   memory->destroy(molimage);
@@ -2234,17 +2240,19 @@ void FixGCMC::attempt_molecule_insertion_full()
 
 /* ----------------------------------------------------------------------
    compute particle's interaction energy with the rest of the system by
-   looping over all atoms in the sub-domain including ghosts.
+   looping over the cells of the occupancy grid within the maximum pair
+   cutoff of the trial position, instead of over all atoms in the
+   sub-domain including ghosts.
 ------------------------------------------------------------------------- */
 
 double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
 {
   double delx,dely,delz,rsq;
+  int icell[3],cello[3],celhi[3];
 
   double **x = atom->x;
   int *type = atom->type;
   tagint *molecule = atom->molecule;
-  int nall = atom->nlocal + atom->nghost;
   pair = force->pair;
   cutsq = force->pair->cutsq;
 
@@ -2254,32 +2262,109 @@ double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
 
   double total_energy = 0.0;
 
-  for (int j = 0; j < nall; j++) {
+  if (!grid_valid) grid_build();
+
+  // cells are at least one max pair cutoff wide, so all atoms within
+  // the cutoff of coord are in the 27-cell stencil around its cell
+  // clamp the stencil since coord may lie outside the binned region
 
-    if (i == j) continue;
-    if (exchmode == EXCHMOL || movemode == MOVEMOL)
-      if (imolecule == molecule[j]) continue;
+  for (int k = 0; k < 3; k++) {
+    icell[k] = static_cast<int>((coord[k]-grid_lo[k])*grid_invsize[k]);
+    cello[k] = MAX(icell[k]-1,0);
+    celhi[k] = MIN(icell[k]+1,grid_nbin[k]-1);
+  }
+
+  for (int kz = cello[2]; kz <= celhi[2]; kz++) {
+    for (int ky = cello[1]; ky <= celhi[1]; ky++) {
+      for (int kx = cello[0]; kx <= celhi[0]; kx++) {
+        int jcell = (kz*grid_nbin[1] + ky)*grid_nbin[0] + kx;
+        for (int j = grid_head[jcell]; j >= 0; j = grid_next[j]) {
 
-    delx = coord[0] - x[j][0];
-    dely = coord[1] - x[j][1];
-    delz = coord[2] - x[j][2];
-    rsq = delx*delx + dely*dely + delz*delz;
-    int jtype = type[j];
+          if (i == j) continue;
+          if (exchmode == EXCHMOL || movemode == MOVEMOL)
+            if (imolecule == molecule[j]) continue;
 
-    // if overlap check requested, if overlap,
-    // return signal value for energy
+          delx = coord[0] - x[j][0];
+          dely = coord[1] - x[j][1];
+          delz = coord[2] - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          int jtype = type[j];
 
-    if (overlap_flag && rsq < overlap_cutoffsq)
-      return MAXENERGYSIGNAL;
+          // if overlap check requested, if overlap,
+          // return signal value for energy
 
-    if (rsq < cutsq[itype][jtype])
-      total_energy +=
-        pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+          if (overlap_flag && rsq < overlap_cutoffsq)
+            return MAXENERGYSIGNAL;
+
+          if (rsq < cutsq[itype][jtype])
+            total_energy +=
+              pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+        }
+      }
+    }
   }
 
   return total_energy;
 }
 
+/* ----------------------------------------------------------------------
+   bin all owned + ghost atoms into an occupancy grid with cells at
+   least one maximum pair cutoff wide, invalidated by any accepted MC
+   move via update_gas_atoms_list() and rebuilt lazily by energy()
+------------------------------------------------------------------------- */
+
+void FixGCMC::grid_build()
+{
+  double **x = atom->x;
+  int nall = atom->nlocal + atom->nghost;
+
+  // bounding box of owned + ghost atoms
+  // ghosts extend at least one cutoff beyond the sub-domain,
+  // so every atom within the cutoff of a trial position is binned
+
+  double lo[3],hi[3];
+  lo[0] = lo[1] = lo[2] = 0.0;
+  hi[0] = hi[1] = hi[2] = 0.0;
+  if (nall > 0)
+    for (int k = 0; k < 3; k++) lo[k] = hi[k] = x[0][k];
+  for (int j = 1; j < nall; j++)
+    for (int k = 0; k < 3; k++) {
+      lo[k] = MIN(lo[k],x[j][k]);
+      hi[k] = MAX(hi[k],x[j][k]);
+    }
+
+  double cell = force->pair->cutforce;
+  for (int k = 0; k < 3; k++) {
+    grid_lo[k] = lo[k];
+    grid_nbin[k] = MAX(1,static_cast<int>((hi[k]-lo[k])/cell));
+    if (hi[k] > lo[k]) grid_invsize[k] = grid_nbin[k]/(hi[k]-lo[k]);
+    else grid_invsize[k] = 0.0;
+  }
+
+  int ncell = grid_nbin[0]*grid_nbin[1]*grid_nbin[2];
+  if (ncell > grid_maxcell) {
+    grid_maxcell = ncell;
+    memory->grow(grid_head,grid_maxcell,"GCMC:grid_head");
+  }
+  if (atom->nmax > grid_maxatom) {
+    grid_maxatom = atom->nmax;
+    memory->grow(grid_next,grid_maxatom,"GCMC:grid_next");
+  }
+
+  for (int jcell = 0; jcell < ncell; jcell++) grid_head[jcell] = -1;
+
+  for (int j = 0; j < nall; j++) {
+    int kx = MIN(static_cast<int>((x[j][0]-grid_lo[0])*grid_invsize[0]),grid_nbin[0]-1);
+    int ky = MIN(static_cast<int>((x[j][1]-grid_lo[1])*grid_invsize[1]),grid_nbin[1]-1);
+    int kz = MIN(static_cast<int>((x[j][2]-grid_lo[2])*grid_invsize[2]),grid_nbin[2]-1);
+    int jcell = (kz*grid_nbin[1] + ky)*grid_nbin[0] + kx;
+    grid_next[j] = grid_head[jcell];
+    grid_head[jcell] = j;
+  }
+
+  grid_valid = 1;
+}
+
 /* ----------------------------------------------------------------------
    compute the energy of the given gas molecule in its current position
    sum across all procs that own atoms of the given molecule
@@ -2448,6 +2533,11 @@ void FixGCMC::toggle_intramolecular(int i)
 
 void FixGCMC::update_gas_atoms_list()
 {
+  // atom arrays have changed, force a rebuild of the occupancy grid
+  // before the next single-particle energy evaluation
+
+  grid_valid = 0;
+
   int nlocal = atom->nlocal;
   int *mask = atom->mask;
   tagint *molecule = atom->molecule;
@@ -2554,6 +2644,7 @@ double FixGCMC::compute_vector(int n)
 double FixGCMC::memory_usage()
 {
   double bytes = (double)gcmc_nmax * sizeof(int);
+  bytes += (double)(grid_maxcell + grid_maxatom) * sizeof(int);
   return bytes;
 }
 
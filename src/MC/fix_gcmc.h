@@ -104,6 +104,18 @@ class FixGCMC : public Fix {
 
   double energy_intra;
 
+  // cell list over owned + ghost atoms used by energy()
+  // rebuilt lazily after accepted MC moves change atom arrays
+
+  int grid_valid;            // 1 if cell list matches current atom arrays
+  int grid_nbin[3];          // # of cells in each dimension
+  int grid_maxcell;          // allocated # of cells
+  int grid_maxatom;          // allocated atom capacity of grid_next
+  double grid_lo[3];         // lower bounds of binned region
+  double grid_invsize[3];    // inverse cell size in each dimension
+  int *grid_head;            // first atom in each cell, -1 if empty
+  int *grid_next;            // next atom in same cell, -1 if last
+
   class Pair *pair;
 
   class RanPark *random_equal;
@@ -140,6 +152,7 @@ class FixGCMC : public Fix {
   void attempt_molecule_insertion_full();
 
   double energy(int, int, tagint, double *);
+  void grid_build();
   double energy_full();
   double molecule_energy(tagint);
 
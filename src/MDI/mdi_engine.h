@@ -137,6 +137,7 @@ class MDIEngine : protected Pointers {
   void many_commands();
   void infile();
   void send_ke();
+  void eval_command();
 
   void unit_conversions();
   void reallocate();
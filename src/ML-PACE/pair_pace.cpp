@@ -173,6 +173,7 @@ void PairPACE::compute(int eflag, int vflag)
   for (ii = 0; ii < inum; ii++) {
     i = list->ilist[ii];
     const int itype = type[i];
+    const double scale_ii = scale[itype][itype];
 
     const double xtmp = x[i][0];
     const double ytmp = x[i][1];
@@ -207,9 +208,9 @@ void PairPACE::compute(int eflag, int vflag)
       dely = x[j][1] - ytmp;
       delz = x[j][2] - ztmp;
 
-      fij[0] = scale[itype][itype] * aceimpl->ace->neighbours_forces(jj, 0);
-      fij[1] = scale[itype][itype] * aceimpl->ace->neighbours_forces(jj, 1);
-      fij[2] = scale[itype][itype] * aceimpl->ace->neighbours_forces(jj, 2);
+      fij[0] = scale_ii * aceimpl->ace->neighbours_forces(jj, 0);
+      fij[1] = scale_ii * aceimpl->ace->neighbours_forces(jj, 1);
+      fij[2] = scale_ii * aceimpl->ace->neighbours_forces(jj, 2);
 
       f[i][0] += fij[0];
       f[i][1] += fij[1];
@@ -227,7 +228,7 @@ void PairPACE::compute(int eflag, int vflag)
     // tally energy contribution
     if (eflag_either) {
       // evdwl = energy of atom I
-      evdwl = scale[itype][itype] * aceimpl->ace->e_atom;
+      evdwl = scale_ii * aceimpl->ace->e_atom;
       ev_tally_full(i, 2.0 * evdwl, 0.0, 0.0, 0.0, 0.0, 0.0);
     }
   }
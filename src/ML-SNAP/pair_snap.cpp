@@ -51,6 +51,14 @@ PairSNAP::PairSNAP(LAMMPS *lmp) : Pair(lmp)
   beta = nullptr;
   bispectrum = nullptr;
   snaptr = nullptr;
+
+  cachetol = 0.0;
+  cache_ok = 0;
+  cache_nmax = xcache_nmax = 0;
+  ycache_r = ycache_i = nullptr;
+  bcache = xcache = nullptr;
+  xmoved = cachehit = nullptr;
+  ycache_ok = bcache_ok = nullptr;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -68,6 +76,15 @@ PairSNAP::~PairSNAP()
   memory->destroy(beta);
   memory->destroy(bispectrum);
 
+  memory->destroy(ycache_r);
+  memory->destroy(ycache_i);
+  memory->destroy(bcache);
+  memory->destroy(xcache);
+  memory->destroy(xmoved);
+  memory->destroy(cachehit);
+  memory->destroy(ycache_ok);
+  memory->destroy(bcache_ok);
+
   delete snaptr;
 
   if (allocated) {
@@ -103,6 +120,10 @@ void PairSNAP::compute(int eflag, int vflag)
     beta_max = list->inum;
   }
 
+  // decide per atom whether cached Yi and bispectrum can be reused
+
+  if (cachetol > 0.0) cache_gate();
+
   // compute dE_i/dB_i = beta_i for all i in list
 
   if (quadraticflag || eflag)
@@ -163,19 +184,30 @@ void PairSNAP::compute(int eflag, int vflag)
     }
 
     // compute Ui, Yi for atom I
+    // when atom I and all its neighbors are within cachetol of their
+    // reference positions, reload the cached Yi and recompute only the
+    // per-neighbor U-functions that compute_duidrj() below consumes
 
-    if (chemflag)
-      snaptr->compute_ui(ninside, ielem);
-    else
-      snaptr->compute_ui(ninside, 0);
+    if (cachetol > 0.0 && cachehit[ii] && ycache_ok[ii]) {
+      snaptr->compute_ulist(ninside);
+      snaptr->load_yi(ycache_r[ii],ycache_i[ii]);
+    } else {
+      if (chemflag)
+        snaptr->compute_ui(ninside, ielem);
+      else
+        snaptr->compute_ui(ninside, 0);
+      snaptr->compute_yi(beta[ii]);
+      if (cachetol > 0.0 && cachehit[ii]) {
+        snaptr->save_yi(ycache_r[ii],ycache_i[ii]);
+        ycache_ok[ii] = 1;
+      }
+    }
 
     // for neighbors of I within cutoff:
     // compute Fij = dEi/dRj = -dEi/dRi
     // add to Fi, subtract from Fj
     // scaling is that for type I
 
-    snaptr->compute_yi(beta[ii]);
-
     for (int jj = 0; jj < ninside; jj++) {
       int j = snaptr->inside[jj];
       snaptr->compute_duidrj(jj);
@@ -288,6 +320,14 @@ void PairSNAP::compute_bispectrum()
   for (int ii = 0; ii < list->inum; ii++) {
     i = list->ilist[ii];
 
+    // reuse the cached bispectrum when atom I's neighborhood is unchanged
+
+    if (cachetol > 0.0 && cachehit[ii] && bcache_ok[ii]) {
+      for (int icoeff = 0; icoeff < ncoeff; icoeff++)
+        bispectrum[ii][icoeff] = bcache[ii][icoeff];
+      continue;
+    }
+
     const double xtmp = x[i][0];
     const double ytmp = x[i][1];
     const double ztmp = x[i][2];
@@ -348,10 +388,85 @@ void PairSNAP::compute_bispectrum()
     for (int icoeff = 0; icoeff < ncoeff; icoeff++) {
       bispectrum[ii][icoeff] = snaptr->blist[icoeff];
     }
+
+    if (cachetol > 0.0 && cachehit[ii]) {
+      for (int icoeff = 0; icoeff < ncoeff; icoeff++)
+        bcache[ii][icoeff] = bispectrum[ii][icoeff];
+      bcache_ok[ii] = 1;
+    }
   }
 
 }
 
+/* ----------------------------------------------------------------------
+   decide which atoms can reuse their cached Yi and bispectrum this step
+   an atom qualifies when neither it nor any atom in its neighbor list
+   has moved more than cachetol since the reference positions were taken,
+   so its cached values are accurate to within the tolerance
+------------------------------------------------------------------------- */
+
+void PairSNAP::cache_gate()
+{
+  double **x = atom->x;
+  const int inum = list->inum;
+  const int nall = atom->nlocal + atom->nghost;
+
+  // grow per-atom cache arrays, sized like beta and bispectrum
+
+  if (cache_nmax < inum) {
+    memory->grow(ycache_r,inum,snaptr->yi_size(),"PairSNAP:ycache_r");
+    memory->grow(ycache_i,inum,snaptr->yi_size(),"PairSNAP:ycache_i");
+    memory->grow(bcache,inum,ncoeff,"PairSNAP:bcache");
+    memory->grow(cachehit,inum,"PairSNAP:cachehit");
+    memory->grow(ycache_ok,inum,"PairSNAP:ycache_ok");
+    memory->grow(bcache_ok,inum,"PairSNAP:bcache_ok");
+    cache_nmax = inum;
+  }
+  if (xcache_nmax < atom->nmax) {
+    memory->grow(xcache,atom->nmax,3,"PairSNAP:xcache");
+    memory->grow(xmoved,atom->nmax,"PairSNAP:xmoved");
+    xcache_nmax = atom->nmax;
+  }
+
+  // when the neighbor list has just been rebuilt, record reference
+  // positions and drop all cached values: local and ghost indices
+  // have been reassigned
+
+  if (neighbor->ago == 0 || !cache_ok) {
+    for (int j = 0; j < nall; j++) {
+      xcache[j][0] = x[j][0];
+      xcache[j][1] = x[j][1];
+      xcache[j][2] = x[j][2];
+    }
+    for (int ii = 0; ii < inum; ii++) {
+      cachehit[ii] = 1;
+      ycache_ok[ii] = bcache_ok[ii] = 0;
+    }
+    cache_ok = 1;
+    return;
+  }
+
+  // flag atoms displaced beyond cachetol, then gate each central atom
+  // on its own flag and those of all atoms in its neighbor list
+
+  for (int j = 0; j < nall; j++) {
+    const double delx = x[j][0] - xcache[j][0];
+    const double dely = x[j][1] - xcache[j][1];
+    const double delz = x[j][2] - xcache[j][2];
+    xmoved[j] = (delx*delx + dely*dely + delz*delz > cachetolsq);
+  }
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = list->ilist[ii];
+    int hit = !xmoved[i];
+    const int *jlist = list->firstneigh[i];
+    const int jnum = list->numneigh[i];
+    for (int jj = 0; jj < jnum && hit; jj++)
+      hit = !xmoved[jlist[jj] & NEIGHMASK];
+    cachehit[ii] = hit;
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -445,6 +560,10 @@ void PairSNAP::init_style()
 
   snaptr->init();
 
+  // invalidate the Yi cache: settings may have changed since the last run
+
+  cachetolsq = cachetol*cachetol;
+  cache_ok = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -638,6 +757,7 @@ void PairSNAP::read_files(char *coefffilename, char *paramfilename)
   switchinnerflag = 0;
   chunksize = 32768;
   parallel_thresh = 8192;
+  cachetol = 0.0;
 
   // set local input checks
 
@@ -757,6 +877,8 @@ void PairSNAP::read_files(char *coefffilename, char *paramfilename)
         chunksize = utils::inumeric(FLERR,keyval,false,lmp);
       else if (keywd == "parallelthresh")
         parallel_thresh = utils::inumeric(FLERR,keyval,false,lmp);
+      else if (keywd == "cachetol")
+        cachetol = utils::numeric(FLERR,keyval,false,lmp);
       else
         error->all(FLERR,"Unknown parameter '{}' in SNAP parameter file", keywd);
     }
@@ -791,6 +913,12 @@ double PairSNAP::memory_usage()
   bytes += (double)beta_max*ncoeff*sizeof(double); // bispectrum
   bytes += (double)beta_max*ncoeff*sizeof(double); // beta
 
+  if (cachetol > 0.0) {
+    bytes += (double)cache_nmax*snaptr->yi_size()*2*sizeof(double); // ycache
+    bytes += (double)cache_nmax*ncoeff*sizeof(double);              // bcache
+    bytes += (double)xcache_nmax*3*sizeof(double);                  // xcache
+  }
+
   bytes += snaptr->memory_usage(); // SNA object
 
   return bytes;
@@ -49,6 +49,7 @@ class PairSNAP : public Pair {
 
   void compute_beta();
   void compute_bispectrum();
+  void cache_gate();
 
   double rcutmax;         // max cutoff for all elements
   double *radelem;        // element radii
@@ -66,6 +67,19 @@ class PairSNAP : public Pair {
   double rfac0, rmin0, wj1, wj2;
   int rcutfacflag, twojmaxflag;    // flags for required parameters
   int beta_max;                    // length of beta
+
+  // displacement-gated cache of per-atom Yi (cachetol keyword)
+
+  double cachetol, cachetolsq;    // displacement tolerance, 0.0 = cache off
+  int cache_ok;                   // 1 if reference positions match neighbor list
+  int cache_nmax;                 // allocated atoms in per-atom cache arrays
+  int xcache_nmax;                // allocated atoms in reference positions
+  double **ycache_r, **ycache_i;  // cached Yi for all atoms in list
+  double **bcache;                // cached bispectrum for all atoms in list
+  double **xcache;                // reference positions for local+ghost atoms
+  int *xmoved;                    // 1 if atom moved > cachetol from reference
+  int *cachehit;                  // 1 if atom's neighborhood is unchanged
+  int *ycache_ok, *bcache_ok;     // 1 if cached values have been stored
 };
 
 }    // namespace LAMMPS_NS
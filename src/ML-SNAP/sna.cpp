@@ -374,6 +374,55 @@ void SNA::compute_ui(int jnum, int ielem)
 
 }
 
+/* ----------------------------------------------------------------------
+   compute per-neighbor Wigner U-functions without touching Ulisttot
+   used by callers that reuse a cached Yi but still need dUi/dRj
+------------------------------------------------------------------------- */
+
+void SNA::compute_ulist(int jnum)
+{
+  double rsq, r, x, y, z, z0, theta0;
+
+  for (int j = 0; j < jnum; j++) {
+    x = rij[j][0];
+    y = rij[j][1];
+    z = rij[j][2];
+    rsq = x * x + y * y + z * z;
+    r = sqrt(rsq);
+
+    theta0 = (r - rmin0) * rfac0 * MY_PI / (rcutij[j] - rmin0);
+    z0 = r / tan(theta0);
+
+    compute_uarray(x, y, z, z0, r, j);
+  }
+
+}
+
+/* ----------------------------------------------------------------------
+   copy Yi to/from caller-owned storage, for reuse between steps
+------------------------------------------------------------------------- */
+
+int SNA::yi_size() const
+{
+  return idxu_max * nelements;
+}
+
+void SNA::save_yi(double *yr, double *yi) const
+{
+  for (int j = 0; j < idxu_max * nelements; j++) {
+    yr[j] = ylist_r[j];
+    yi[j] = ylist_i[j];
+  }
+}
+
+void SNA::load_yi(const double *yr, const double *yi)
+{
+  for (int j = 0; j < idxu_max * nelements; j++) {
+    ylist_r[j] = yr[j];
+    ylist_i[j] = yi[j];
+  }
+}
+
 /* ----------------------------------------------------------------------
    compute Zi by summing over products of Ui
 ------------------------------------------------------------------------- */
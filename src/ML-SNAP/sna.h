@@ -51,6 +51,13 @@ class SNA : protected Pointers {
   void compute_yterm(int, int, int, const double *);
   void compute_bi(int);
 
+  // functions for reusing Yi between steps (pair_style snap cachetol keyword)
+
+  void compute_ulist(int);
+  int yi_size() const;
+  void save_yi(double *, double *) const;
+  void load_yi(const double *, const double *);
+
   // functions for derivatives
 
   void compute_duidrj(int);
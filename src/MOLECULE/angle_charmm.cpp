@@ -54,6 +54,16 @@ AngleCharmm::~AngleCharmm()
 /* ---------------------------------------------------------------------- */
 
 void AngleCharmm::compute(int eflag, int vflag)
+{
+  ev_init(eflag, vflag);
+
+  if (compute_threaded(eflag, vflag)) return;
+  compute_partial(0, neighbor->nanglelist, atom->f, eflag, vflag);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void AngleCharmm::compute_partial(int nfrom, int nto, double **f, int eflag, int /*vflag*/)
 {
   int i1, i2, i3, n, type;
   double delx1, dely1, delz1, delx2, dely2, delz2;
@@ -63,16 +73,13 @@ void AngleCharmm::compute(int eflag, int vflag)
   double delxUB, delyUB, delzUB, rsqUB, rUB, dr, rk, forceUB;
 
   eangle = 0.0;
-  ev_init(eflag, vflag);
 
   double **x = atom->x;
-  double **f = atom->f;
   int **anglelist = neighbor->anglelist;
-  int nanglelist = neighbor->nanglelist;
   int nlocal = atom->nlocal;
   int newton_bond = force->newton_bond;
 
-  for (n = 0; n < nanglelist; n++) {
+  for (n = nfrom; n < nto; n++) {
     i1 = anglelist[n][0];
     i2 = anglelist[n][1];
     i3 = anglelist[n][2];
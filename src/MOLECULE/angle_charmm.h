@@ -29,6 +29,7 @@ class AngleCharmm : public Angle {
   AngleCharmm(class LAMMPS *);
   ~AngleCharmm() override;
   void compute(int, int) override;
+  void compute_partial(int, int, double **, int, int) override;
   void coeff(int, char **) override;
   double equilibrium_angle(int) override;
   void write_restart(FILE *) override;
@@ -13,6 +13,9 @@
 
 #include "atom_vec_full.h"
 #include "atom.h"
+#include "domain.h"
+#include "fix.h"
+#include "modify.h"
 
 using namespace LAMMPS_NS;
 
@@ -217,3 +220,216 @@ void AtomVecFull::data_atom_post(int ilocal)
   nspecial[ilocal][1] = 0;
   nspecial[ilocal][2] = 0;
 }
+
+/* ----------------------------------------------------------------------
+   straight-line specializations of the generic field-list methods
+   border comm of this style is hot enough that the per-field dispatch
+     in the AtomVec versions is measurable, so pack/unpack the fixed
+     field set (q, molecule) directly
+   must be kept in sync with the field strings set in the constructor
+------------------------------------------------------------------------- */
+
+int AtomVecFull::pack_border(int n, int *list, double *buf, int pbc_flag, int *pbc)
+{
+  int i, j, m;
+  double dx, dy, dz;
+  double *q = atom->q;
+  tagint *molecule = atom->molecule;
+
+  m = 0;
+  if (pbc_flag == 0) {
+    for (i = 0; i < n; i++) {
+      j = list[i];
+      buf[m++] = x[j][0];
+      buf[m++] = x[j][1];
+      buf[m++] = x[j][2];
+      buf[m++] = ubuf(tag[j]).d;
+      buf[m++] = ubuf(type[j]).d;
+      buf[m++] = ubuf(mask[j]).d;
+    }
+  } else {
+    if (domain->triclinic == 0) {
+      dx = pbc[0] * domain->xprd;
+      dy = pbc[1] * domain->yprd;
+      dz = pbc[2] * domain->zprd;
+    } else {
+      dx = pbc[0];
+      dy = pbc[1];
+      dz = pbc[2];
+    }
+    for (i = 0; i < n; i++) {
+      j = list[i];
+      buf[m++] = x[j][0] + dx;
+      buf[m++] = x[j][1] + dy;
+      buf[m++] = x[j][2] + dz;
+      buf[m++] = ubuf(tag[j]).d;
+      buf[m++] = ubuf(type[j]).d;
+      buf[m++] = ubuf(mask[j]).d;
+    }
+  }
+
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = q[j];
+  }
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = ubuf(molecule[j]).d;
+  }
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->pack_border(n, list, &buf[m]);
+
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int AtomVecFull::pack_border_vel(int n, int *list, double *buf, int pbc_flag, int *pbc)
+{
+  int i, j, m;
+  double dx, dy, dz, dvx, dvy, dvz;
+  double *q = atom->q;
+  tagint *molecule = atom->molecule;
+
+  m = 0;
+  if (pbc_flag == 0) {
+    for (i = 0; i < n; i++) {
+      j = list[i];
+      buf[m++] = x[j][0];
+      buf[m++] = x[j][1];
+      buf[m++] = x[j][2];
+      buf[m++] = ubuf(tag[j]).d;
+      buf[m++] = ubuf(type[j]).d;
+      buf[m++] = ubuf(mask[j]).d;
+      buf[m++] = v[j][0];
+      buf[m++] = v[j][1];
+      buf[m++] = v[j][2];
+    }
+  } else {
+    if (domain->triclinic == 0) {
+      dx = pbc[0] * domain->xprd;
+      dy = pbc[1] * domain->yprd;
+      dz = pbc[2] * domain->zprd;
+    } else {
+      dx = pbc[0];
+      dy = pbc[1];
+      dz = pbc[2];
+    }
+    if (!deform_vremap) {
+      for (i = 0; i < n; i++) {
+        j = list[i];
+        buf[m++] = x[j][0] + dx;
+        buf[m++] = x[j][1] + dy;
+        buf[m++] = x[j][2] + dz;
+        buf[m++] = ubuf(tag[j]).d;
+        buf[m++] = ubuf(type[j]).d;
+        buf[m++] = ubuf(mask[j]).d;
+        buf[m++] = v[j][0];
+        buf[m++] = v[j][1];
+        buf[m++] = v[j][2];
+      }
+    } else {
+      dvx = pbc[0] * h_rate[0] + pbc[5] * h_rate[5] + pbc[4] * h_rate[4];
+      dvy = pbc[1] * h_rate[1] + pbc[3] * h_rate[3];
+      dvz = pbc[2] * h_rate[2];
+      for (i = 0; i < n; i++) {
+        j = list[i];
+        buf[m++] = x[j][0] + dx;
+        buf[m++] = x[j][1] + dy;
+        buf[m++] = x[j][2] + dz;
+        buf[m++] = ubuf(tag[j]).d;
+        buf[m++] = ubuf(type[j]).d;
+        buf[m++] = ubuf(mask[j]).d;
+        if (mask[i] & deform_groupbit) {
+          buf[m++] = v[j][0] + dvx;
+          buf[m++] = v[j][1] + dvy;
+          buf[m++] = v[j][2] + dvz;
+        } else {
+          buf[m++] = v[j][0];
+          buf[m++] = v[j][1];
+          buf[m++] = v[j][2];
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = q[j];
+  }
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = ubuf(molecule[j]).d;
+  }
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->pack_border(n, list, &buf[m]);
+
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void AtomVecFull::unpack_border(int n, int first, double *buf)
+{
+  int i, m, last;
+
+  m = 0;
+  last = first + n;
+  while (last > nmax) grow(0);
+
+  double *q = atom->q;
+  tagint *molecule = atom->molecule;
+
+  for (i = first; i < last; i++) {
+    x[i][0] = buf[m++];
+    x[i][1] = buf[m++];
+    x[i][2] = buf[m++];
+    tag[i] = (tagint) ubuf(buf[m++]).i;
+    type[i] = (int) ubuf(buf[m++]).i;
+    mask[i] = (int) ubuf(buf[m++]).i;
+  }
+
+  for (i = first; i < last; i++) q[i] = buf[m++];
+  for (i = first; i < last; i++) molecule[i] = (tagint) ubuf(buf[m++]).i;
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->unpack_border(n, first, &buf[m]);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void AtomVecFull::unpack_border_vel(int n, int first, double *buf)
+{
+  int i, m, last;
+
+  m = 0;
+  last = first + n;
+  while (last > nmax) grow(0);
+
+  double *q = atom->q;
+  tagint *molecule = atom->molecule;
+
+  for (i = first; i < last; i++) {
+    x[i][0] = buf[m++];
+    x[i][1] = buf[m++];
+    x[i][2] = buf[m++];
+    tag[i] = (tagint) ubuf(buf[m++]).i;
+    type[i] = (int) ubuf(buf[m++]).i;
+    mask[i] = (int) ubuf(buf[m++]).i;
+    v[i][0] = buf[m++];
+    v[i][1] = buf[m++];
+    v[i][2] = buf[m++];
+  }
+
+  for (i = first; i < last; i++) q[i] = buf[m++];
+  for (i = first; i < last; i++) molecule[i] = (tagint) ubuf(buf[m++]).i;
+
+  if (atom->nextra_border)
+    for (int iextra = 0; iextra < atom->nextra_border; iextra++)
+      m += modify->fix[atom->extra_border[iextra]]->unpack_border(n, first, &buf[m]);
+}
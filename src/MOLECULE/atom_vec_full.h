@@ -30,6 +30,10 @@ class AtomVecFull : virtual public AtomVec {
   ~AtomVecFull() override;
 
   void grow_pointers() override;
+  int pack_border(int, int *, double *, int, int *) override;
+  int pack_border_vel(int, int *, double *, int, int *) override;
+  void unpack_border(int, int, double *) override;
+  void unpack_border_vel(int, int, double *) override;
   void pack_restart_pre(int) override;
   void pack_restart_post(int) override;
   void unpack_restart_init(int) override;
@@ -46,22 +46,29 @@ BondHarmonic::~BondHarmonic()
 /* ---------------------------------------------------------------------- */
 
 void BondHarmonic::compute(int eflag, int vflag)
+{
+  ev_init(eflag, vflag);
+
+  if (compute_threaded(eflag, vflag)) return;
+  compute_partial(0, neighbor->nbondlist, atom->f, eflag, vflag);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void BondHarmonic::compute_partial(int nfrom, int nto, double **f, int eflag, int /*vflag*/)
 {
   int i1, i2, n, type;
   double delx, dely, delz, ebond, fbond;
   double rsq, r, dr, rk;
 
   ebond = 0.0;
-  ev_init(eflag, vflag);
 
   double **x = atom->x;
-  double **f = atom->f;
   int **bondlist = neighbor->bondlist;
-  int nbondlist = neighbor->nbondlist;
   int nlocal = atom->nlocal;
   int newton_bond = force->newton_bond;
 
-  for (n = 0; n < nbondlist; n++) {
+  for (n = nfrom; n < nto; n++) {
     i1 = bondlist[n][0];
     i2 = bondlist[n][1];
     type = bondlist[n][2];
@@ -29,6 +29,7 @@ class BondHarmonic : public Bond {
   BondHarmonic(class LAMMPS *);
   ~BondHarmonic() override;
   void compute(int, int) override;
+  void compute_partial(int, int, double **, int, int) override;
   void coeff(int, char **) override;
   double equilibrium_distance(int) override;
   void write_restart(FILE *) override;
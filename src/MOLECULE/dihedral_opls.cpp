@@ -56,6 +56,16 @@ DihedralOPLS::~DihedralOPLS()
 /* ---------------------------------------------------------------------- */
 
 void DihedralOPLS::compute(int eflag, int vflag)
+{
+  ev_init(eflag, vflag);
+
+  if (compute_threaded(eflag, vflag)) return;
+  compute_partial(0, neighbor->ndihedrallist, atom->f, eflag, vflag);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DihedralOPLS::compute_partial(int nfrom, int nto, double **f, int eflag, int /*vflag*/)
 {
   int i1, i2, i3, i4, n, type;
   double vb1x, vb1y, vb1z, vb2x, vb2y, vb2z, vb3x, vb3y, vb3z, vb2xm, vb2ym, vb2zm;
@@ -67,16 +77,13 @@ void DihedralOPLS::compute(int eflag, int vflag)
   double s2, cx, cy, cz, cmag, dx, phi, si, siinv, sin2;
 
   edihedral = 0.0;
-  ev_init(eflag, vflag);
 
   double **x = atom->x;
-  double **f = atom->f;
   int **dihedrallist = neighbor->dihedrallist;
-  int ndihedrallist = neighbor->ndihedrallist;
   int nlocal = atom->nlocal;
   int newton_bond = force->newton_bond;
 
-  for (n = 0; n < ndihedrallist; n++) {
+  for (n = nfrom; n < nto; n++) {
     i1 = dihedrallist[n][0];
     i2 = dihedrallist[n][1];
     i3 = dihedrallist[n][2];
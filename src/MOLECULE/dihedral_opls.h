@@ -29,6 +29,7 @@ class DihedralOPLS : public Dihedral {
   DihedralOPLS(class LAMMPS *);
   ~DihedralOPLS() override;
   void compute(int, int) override;
+  void compute_partial(int, int, double **, int, int) override;
   void coeff(int, char **) override;
   void write_restart(FILE *) override;
   void read_restart(FILE *) override;
@@ -0,0 +1,67 @@
+# Install/unInstall package files in LAMMPS
+# mode = 0/1/2 for uninstall/install/update
+
+mode=$1
+
+# enforce using portable C locale
+LC_ALL=C
+export LC_ALL
+
+# arg1 = file, arg2 = file it depends on
+
+action () {
+  if (test $mode = 0) then
+    rm -f ../$1
+  elif (! cmp -s $1 ../$1) then
+    if (test -z "$2" || test -e ../$2) then
+      cp $1 ..
+      if (test $mode = 2) then
+        echo "  updating src/$1"
+      fi
+    fi
+  elif (test -n "$2") then
+    if (test ! -e ../$2) then
+      rm -f ../$1
+    fi
+  fi
+}
+
+# force rebuild of files with LMP_MPIIO switch
+
+MPIIO_INSTALLED=0
+if (test -e ../Makefile.package) then
+  MPIIO_INSTALLED=`grep DLMP_MPIIO ../Makefile.package | wc -l`
+fi
+
+if (test $mode = 1) then
+  if (test $MPIIO_INSTALLED = 0) then
+    touch ../write_restart.cpp ../read_restart.cpp ../output.cpp
+  fi
+elif (test $mode = 0) then
+  if (test $MPIIO_INSTALLED = 1) then
+    touch ../write_restart.cpp ../read_restart.cpp ../output.cpp
+  fi
+fi
+
+# all package files with no dependencies
+
+for file in *.cpp *.h; do
+  test -f ${file} && action $file
+done
+
+# edit Makefile.package to include/exclude the LMP_MPIIO switch
+
+if (test $1 = 1) then
+
+  if (test -e ../Makefile.package) then
+    sed -i -e 's/[^ \t]*-DLMP_MPIIO[^ \t]* //' ../Makefile.package
+    sed -i -e 's|^PKG_INC =[ \t]*|&-DLMP_MPIIO |' ../Makefile.package
+  fi
+
+elif (test $1 = 0) then
+
+  if (test -e ../Makefile.package) then
+    sed -i -e 's/[^ \t]*-DLMP_MPIIO[^ \t]* //' ../Makefile.package
+  fi
+
+fi
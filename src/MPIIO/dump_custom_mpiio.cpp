@@ -0,0 +1,359 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "dump_custom_mpiio.h"
+
+#include "atom.h"
+#include "compute.h"
+#include "domain.h"
+#include "error.h"
+#include "input.h"
+#include "memory.h"
+#include "update.h"
+#include "variable.h"
+
+#include <cstring>
+
+using namespace LAMMPS_NS;
+
+/* ----------------------------------------------------------------------
+   parallel binary variant of dump custom
+   all procs write their own chunk of each snapshot into one shared file
+   with collective MPI-IO, instead of funneling data through proc 0
+   the file layout is identical to a serial binary dump with nprocs
+   chunks per frame, followed by a per-frame index footer of int64_t:
+     INDEX_MAGIC, offset of previous footer (-1 for first frame),
+     file offset of each of the nprocs chunks, nprocs, INDEX_MAGIC
+   readers can walk the footer chain backwards from the end of the file
+   for random frame access, or skip footers when reading sequentially
+------------------------------------------------------------------------- */
+
+DumpCustomMPIIO::DumpCustomMPIIO(LAMMPS *lmp, int narg, char **arg) :
+    DumpCustom(lmp, narg, arg), headerbuf(nullptr), chunkbuf(nullptr)
+{
+  if (!binary)
+    error->all(FLERR, "Dump custom/mpiio requires a binary file, use a '.bin' filename suffix");
+  if (multiproc) error->all(FLERR, "Dump custom/mpiio cannot use '%' in dump filename");
+  if (append_flag) error->all(FLERR, "Dump custom/mpiio cannot append to a dump file");
+
+  buffer_allow = 0;
+  fileopen = 0;
+  mpifo = 0;
+  prev_footer = -1;
+  maxheaderbuf = nheaderbuf = 0;
+  maxchunkbuf = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpCustomMPIIO::~DumpCustomMPIIO()
+{
+  if (fileopen) MPI_File_close(&mpifh);
+  fileopen = 0;
+  memory->destroy(headerbuf);
+  memory->destroy(chunkbuf);
+}
+
+/* ----------------------------------------------------------------------
+   open the shared dump file on all procs
+------------------------------------------------------------------------- */
+
+void DumpCustomMPIIO::openfile()
+{
+  // single file, already opened, so just return
+
+  if (singlefile_opened) return;
+  if (multifile == 0) singlefile_opened = 1;
+
+  unit_count = 0;
+
+  // if one file per timestep, replace '*' with current timestep
+
+  char *filecurrent = filename;
+  if (multifile) filecurrent = utils::strdup(utils::star_subst(filecurrent, update->ntimestep, padflag));
+
+  if (fileopen) MPI_File_close(&mpifh);
+  int err = MPI_File_open(world, filecurrent, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                          &mpifh);
+  if (err != MPI_SUCCESS) error->one(FLERR, "Cannot open dump file {}", filecurrent);
+  MPI_File_set_size(mpifh, 0);
+  fileopen = 1;
+  mpifo = 0;
+  prev_footer = -1;
+
+  if (multifile) delete[] filecurrent;
+}
+
+/* ----------------------------------------------------------------------
+   write a snapshot, collectively by all procs
+   mirrors Dump::write() up to and including pack/sort, then replaces the
+   funnel through the filewriter proc with MPI-IO writes at per-proc
+   offsets from a prefix scan of the chunk sizes
+------------------------------------------------------------------------- */
+
+void DumpCustomMPIIO::write()
+{
+  imageint *imagehold;
+  double **xhold, **vhold;
+
+  // simulation box bounds
+
+  if (domain->triclinic == 0) {
+    boxxlo = domain->boxlo[0];
+    boxxhi = domain->boxhi[0];
+    boxylo = domain->boxlo[1];
+    boxyhi = domain->boxhi[1];
+    boxzlo = domain->boxlo[2];
+    boxzhi = domain->boxhi[2];
+  } else {
+    boxxlo = domain->boxlo_bound[0];
+    boxxhi = domain->boxhi_bound[0];
+    boxylo = domain->boxlo_bound[1];
+    boxyhi = domain->boxhi_bound[1];
+    boxzlo = domain->boxlo_bound[2];
+    boxzhi = domain->boxhi_bound[2];
+    boxxy = domain->xy;
+    boxxz = domain->xz;
+    boxyz = domain->yz;
+  }
+
+  // nme = # of dump lines this proc contributes to dump
+  // must come before delay/skip tests b/c count() invokes computes
+
+  nme = count();
+
+  if (delay_flag && update->ntimestep < delaystep) return;
+
+  if (skipflag) {
+    double value = input->variable->compute_equal(skipindex);
+    if (value != 0.0) return;
+  }
+
+  if (multifile || !fileopen) openfile();
+
+  // ntotal = total # of dump lines in snapshot
+  // nmax = max # of dump lines on any proc, sizes buf for sort/balance
+
+  bigint bnme = nme;
+  MPI_Allreduce(&bnme, &ntotal, 1, MPI_LMP_BIGINT, MPI_SUM, world);
+
+  int nmax;
+  MPI_Allreduce(&nme, &nmax, 1, MPI_INT, MPI_MAX, world);
+
+  if (nmax * size_one > maxbuf) {
+    if ((bigint) nmax * size_one > MAXSMALLINT) error->all(FLERR, "Too much per-proc info for dump");
+    maxbuf = nmax * size_one;
+    memory->destroy(buf);
+    memory->create(buf, maxbuf, "dump:buf");
+  }
+
+  if (sort_flag && sortcol == 0 && nmax > maxids) {
+    maxids = nmax;
+    memory->destroy(ids);
+    memory->create(ids, maxids, "dump:ids");
+  }
+
+  // apply PBC on copy of x,v,image if requested
+
+  if (pbcflag) {
+    int nlocal = atom->nlocal;
+    if (nlocal > maxpbc) pbc_allocate();
+    if (nlocal) {
+      memcpy(&xpbc[0][0], &atom->x[0][0], 3 * nlocal * sizeof(double));
+      memcpy(&vpbc[0][0], &atom->v[0][0], 3 * nlocal * sizeof(double));
+      memcpy(imagepbc, atom->image, nlocal * sizeof(imageint));
+    }
+    xhold = atom->x;
+    vhold = atom->v;
+    imagehold = atom->image;
+    atom->x = xpbc;
+    atom->v = vpbc;
+    atom->image = imagepbc;
+
+    if (domain->triclinic) domain->x2lamda(nlocal);
+    domain->pbc();
+    if (domain->triclinic) domain->lamda2x(nlocal);
+  }
+
+  // pack my data into buf, sort and balance as requested
+
+  if (sort_flag && (ntotal > 1) && sortcol == 0)
+    pack(ids);
+  else
+    pack(nullptr);
+  if (sort_flag && (ntotal > 1)) sort();
+  if (balance_flag && (ntotal > 1)) balance();
+
+  // frame header is packed and written by proc 0, but all procs need its
+  // size to compute the file offsets of their chunks
+
+  if (me == 0) pack_frame_header(ntotal);
+  MPI_Bcast(&nheaderbuf, 1, MPI_INT, 0, world);
+
+  // chunk of this proc = # of doubles as int + the doubles,
+  // the same layout DumpCustom::write_binary() produces per chunk
+
+  int ndouble = nme * size_one;
+  bigint chunkbytes = sizeof(int) + (bigint) ndouble * sizeof(double);
+  if (chunkbytes > MAXSMALLINT) error->all(FLERR, "Too much per-proc info for dump");
+  if (chunkbytes > maxchunkbuf) {
+    maxchunkbuf = chunkbytes;
+    memory->destroy(chunkbuf);
+    memory->create(chunkbuf, maxchunkbuf, "dump:chunkbuf");
+  }
+  memcpy(chunkbuf, &ndouble, sizeof(int));
+  memcpy(chunkbuf + sizeof(int), buf, (bigint) ndouble * sizeof(double));
+
+  // exclusive prefix sum of chunk sizes = offset of my chunk in the frame
+
+  int64_t mybytes = chunkbytes, sumbytes = 0;
+  MPI_Scan(&mybytes, &sumbytes, 1, MPI_INT64_T, MPI_SUM, world);
+  int64_t chunkoffset = (int64_t) mpifo + nheaderbuf + sumbytes - chunkbytes;
+
+  if (me == 0)
+    MPI_File_write_at(mpifh, mpifo, headerbuf, nheaderbuf, MPI_BYTE, MPI_STATUS_IGNORE);
+  MPI_File_write_at_all(mpifh, (MPI_Offset) chunkoffset, chunkbuf, (int) chunkbytes, MPI_BYTE,
+                        MPI_STATUS_IGNORE);
+
+  // append index footer: chunk offsets gathered on proc 0, bracketed by
+  // magic markers, with a link to the previous footer for backward walks
+
+  int64_t allbytes;
+  MPI_Allreduce(&mybytes, &allbytes, 1, MPI_INT64_T, MPI_SUM, world);
+  int64_t footerstart = (int64_t) mpifo + nheaderbuf + allbytes;
+  int nfooter = nprocs + 4;
+
+  int64_t *footer = nullptr;
+  if (me == 0) memory->create(footer, nfooter, "dump:footer");
+  MPI_Gather(&chunkoffset, 1, MPI_INT64_T, footer ? footer + 2 : nullptr, 1, MPI_INT64_T, 0,
+             world);
+  if (me == 0) {
+    footer[0] = INDEX_MAGIC;
+    footer[1] = prev_footer;
+    footer[nprocs + 2] = nprocs;
+    footer[nprocs + 3] = INDEX_MAGIC;
+    MPI_File_write_at(mpifh, (MPI_Offset) footerstart, footer, nfooter * sizeof(int64_t), MPI_BYTE,
+                      MPI_STATUS_IGNORE);
+    memory->destroy(footer);
+  }
+  prev_footer = footerstart;
+  mpifo = (MPI_Offset) (footerstart + (int64_t) nfooter * sizeof(int64_t));
+
+  // restore original x,v,image unaltered by PBC
+
+  if (pbcflag) {
+    atom->x = xhold;
+    atom->v = vhold;
+    atom->image = imagehold;
+  }
+
+  // trigger post-dump refresh by specified compute
+
+  if (refreshflag) irefresh->refresh();
+
+  // if file per timestep, close file
+
+  if (multifile) {
+    MPI_File_close(&mpifh);
+    fileopen = 0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   append nbytes at src to the frame header buffer
+------------------------------------------------------------------------- */
+
+void DumpCustomMPIIO::hpack(const void *src, int nbytes)
+{
+  if (nheaderbuf + nbytes > maxheaderbuf) {
+    maxheaderbuf = nheaderbuf + nbytes + 512;
+    memory->grow(headerbuf, maxheaderbuf, "dump:headerbuf");
+  }
+  memcpy(headerbuf + nheaderbuf, src, nbytes);
+  nheaderbuf += nbytes;
+}
+
+/* ----------------------------------------------------------------------
+   pack the binary frame header into headerbuf, byte-for-byte identical
+   to what the header_binary*() methods of DumpCustom fwrite(), with
+   nprocs as the chunk count
+------------------------------------------------------------------------- */
+
+void DumpCustomMPIIO::pack_frame_header(bigint ndump)
+{
+  nheaderbuf = 0;
+
+  // magic string, endianness, and format revision
+
+  bigint marker = -((bigint) strlen(MAGIC_STRING));
+  hpack(&marker, sizeof(bigint));
+  hpack(MAGIC_STRING, strlen(MAGIC_STRING));
+  hpack(&ENDIAN, sizeof(int));
+  hpack(&FORMAT_REVISION, sizeof(int));
+
+  // timestep, atom count, and box, with the same triclinic variants
+
+  hpack(&update->ntimestep, sizeof(bigint));
+  hpack(&ndump, sizeof(bigint));
+
+  if (triclinic_general == 1) {
+    int triclinic_general_flag = 2;
+    hpack(&triclinic_general_flag, sizeof(int));
+    hpack(&domain->boundary[0][0], 6 * sizeof(int));
+    hpack(domain->avec, 3 * sizeof(double));
+    hpack(domain->bvec, 3 * sizeof(double));
+    hpack(domain->cvec, 3 * sizeof(double));
+    hpack(domain->boxlo, 3 * sizeof(double));
+  } else {
+    hpack(&domain->triclinic, sizeof(int));
+    hpack(&domain->boundary[0][0], 6 * sizeof(int));
+    hpack(&boxxlo, sizeof(double));
+    hpack(&boxxhi, sizeof(double));
+    hpack(&boxylo, sizeof(double));
+    hpack(&boxyhi, sizeof(double));
+    hpack(&boxzlo, sizeof(double));
+    hpack(&boxzhi, sizeof(double));
+    if (domain->triclinic) {
+      hpack(&boxxy, sizeof(double));
+      hpack(&boxxz, sizeof(double));
+      hpack(&boxyz, sizeof(double));
+    }
+  }
+  hpack(&nfield, sizeof(int));
+
+  // unit style (first frame of a file only), time, and column labels
+
+  int len = 0;
+  if (unit_flag && !unit_count) {
+    ++unit_count;
+    len = strlen(update->unit_style);
+    hpack(&len, sizeof(int));
+    hpack(update->unit_style, len);
+  } else
+    hpack(&len, sizeof(int));
+
+  char flag = time_flag ? 1 : 0;
+  hpack(&flag, sizeof(char));
+  if (time_flag) {
+    double t = compute_time();
+    hpack(&t, sizeof(double));
+  }
+
+  len = strlen(columns);
+  hpack(&len, sizeof(int));
+  hpack(columns, len);
+
+  // one chunk per proc in this format
+
+  hpack(&nprocs, sizeof(int));
+}
@@ -0,0 +1,60 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+// clang-format off
+DumpStyle(custom/mpiio,DumpCustomMPIIO);
+// clang-format on
+#else
+
+#ifndef LMP_DUMP_CUSTOM_MPIIO_H
+#define LMP_DUMP_CUSTOM_MPIIO_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+class DumpCustomMPIIO : public DumpCustom {
+ public:
+  DumpCustomMPIIO(class LAMMPS *, int, char **);
+  ~DumpCustomMPIIO() override;
+
+  // marks the start and end of each per-frame index footer
+  // footer entries are always int64_t so that offsets beyond 2 GB work
+  // in all size configurations; the magic spells "LMPINDEX" in ASCII
+
+  static constexpr int64_t INDEX_MAGIC = 0x4C4D50494E444558;
+
+ protected:
+  MPI_File mpifh;         // MPI-IO file handle, shared by all procs
+  MPI_Offset mpifo;       // file offset where the next frame starts
+  int64_t prev_footer;    // file offset of previous frame footer, -1 if none
+  int fileopen;           // 1 if mpifh is an open file
+
+  char *headerbuf;    // packed binary frame header, used on proc 0 only
+  int maxheaderbuf;
+  int nheaderbuf;
+  char *chunkbuf;    // packed data chunk of this proc: int count + doubles
+  bigint maxchunkbuf;
+
+  void openfile() override;
+  void write() override;
+
+  void pack_frame_header(bigint);
+  void hpack(const void *, int);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
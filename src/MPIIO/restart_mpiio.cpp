@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "restart_mpiio.h"
+
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+// max # of doubles transferred per collective call, well below the
+// 32-bit count limit of the MPI-IO interface
+
+static constexpr bigint MAXPERCALL = 0x20000000;
+
+// convert an MPI error code into a printable message
+
+static std::string mpierrstr(int errcode)
+{
+  char str[MPI_MAX_ERROR_STRING + 1];
+  int len = 0;
+  MPI_Error_string(errcode, str, &len);
+  str[len] = '\0';
+  return {str};
+}
+
+/* ----------------------------------------------------------------------
+   collective reading/writing of the per-proc chunk section of a single
+   restart file, used by the read_restart and write_restart commands
+   when the restart filename ends in ".mpiio"
+   the header of the file is still written/read by proc 0 with stdio;
+   this class only transfers the raw per-atom double chunks, whose
+   per-proc sizes are recorded in the file layout section of the header
+------------------------------------------------------------------------- */
+
+RestartMPIIO::RestartMPIIO(LAMMPS *lmp) : Pointers(lmp), mpifh(MPI_FILE_NULL)
+{
+  MPI_Comm_size(world, &nprocs);
+  MPI_Comm_rank(world, &myrank);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void RestartMPIIO::openForRead(const char *filename)
+{
+  int err = MPI_File_open(world, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &mpifh);
+  if (err != MPI_SUCCESS)
+    error->one(FLERR, "Cannot open restart file {} for MPI-IO read: {}", filename, mpierrstr(err));
+}
+
+/* ---------------------------------------------------------------------- */
+
+void RestartMPIIO::openForWrite(const char *filename)
+{
+  int err = MPI_File_open(world, filename, MPI_MODE_APPEND | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                          &mpifh);
+  if (err != MPI_SUCCESS)
+    error->one(FLERR, "Cannot open restart file {} for MPI-IO write: {}", filename, mpierrstr(err));
+}
+
+/* ----------------------------------------------------------------------
+   collectively write send_size doubles from buf
+   headeroffset = file offset where the chunk section starts
+   each proc writes at headeroffset plus the sizes of all lower-rank
+   chunks, computed via an exclusive prefix sum, so the chunks appear
+   in rank order and match the sizes recorded in the file header
+------------------------------------------------------------------------- */
+
+void RestartMPIIO::write(bigint headeroffset, int send_size, double *buf)
+{
+  bigint incprefix = 0;
+  bigint bigsend = send_size;
+  MPI_Scan(&bigsend, &incprefix, 1, MPI_LMP_BIGINT, MPI_SUM, world);
+
+  MPI_Offset offset = headeroffset + (incprefix - bigsend) * sizeof(double);
+  int err = MPI_File_write_at_all(mpifh, offset, buf, send_size, MPI_DOUBLE, MPI_STATUS_IGNORE);
+  if (err != MPI_SUCCESS)
+    error->one(FLERR, "Cannot write to restart file via MPI-IO: {}", mpierrstr(err));
+}
+
+/* ----------------------------------------------------------------------
+   collectively read chunksize doubles into buf starting at byte offset
+   chunkoffset
+   a proc may be assigned the chunks of several writing procs, so
+   chunksize is a bigint and large reads are split over multiple
+   collective calls; all procs issue the same number of calls, with a
+   zero count once their own chunk is exhausted
+------------------------------------------------------------------------- */
+
+void RestartMPIIO::read(bigint chunkoffset, bigint chunksize, double *buf)
+{
+  bigint maxsize;
+  MPI_Allreduce(&chunksize, &maxsize, 1, MPI_LMP_BIGINT, MPI_MAX, world);
+  bigint ncall = (maxsize + MAXPERCALL - 1) / MAXPERCALL;
+
+  bigint ndone = 0;
+  for (bigint i = 0; i < ncall; i++) {
+    int count = static_cast<int>(MIN(chunksize - ndone, MAXPERCALL));
+    if (count < 0) count = 0;
+    MPI_Offset offset = chunkoffset + ndone * sizeof(double);
+    int err = MPI_File_read_at_all(mpifh, offset, &buf[ndone], count, MPI_DOUBLE,
+                                   MPI_STATUS_IGNORE);
+    if (err != MPI_SUCCESS)
+      error->one(FLERR, "Cannot read from restart file via MPI-IO: {}", mpierrstr(err));
+    ndone += count;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void RestartMPIIO::close()
+{
+  int err = MPI_File_close(&mpifh);
+  if (err != MPI_SUCCESS)
+    error->one(FLERR, "Cannot close restart file via MPI-IO: {}", mpierrstr(err));
+}
@@ -24,6 +24,7 @@
 #include "comm.h"
 #include "error.h"
 #include "force.h"
+#include "memory.h"
 #include "neighbor.h"
 #include "universe.h"
 #include "update.h"
@@ -62,7 +63,7 @@ static int get_tid()
 FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
   :  Fix(lmp, narg, arg),
      thr(nullptr), last_omp_style(nullptr), last_pair_hybrid(nullptr),
-     _nthr(-1), _neighbor(true), _mixed(false), _reduced(true),
+     _nthr(-1), _neighbor(true), _numa(false), _mixed(false), _reduced(true), _nall_last(-1),
      _pair_compute_flag(false), _kspace_compute_flag(false)
 {
   if (narg < 4) error->all(FLERR,"Illegal package omp command");
@@ -100,9 +101,19 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal package omp command");
       _neighbor = utils::logical(FLERR,arg[iarg+1],false,lmp) != 0;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"numa") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal package omp command");
+      _numa = utils::logical(FLERR,arg[iarg+1],false,lmp) != 0;
+      iarg += 2;
     } else error->all(FLERR,"Illegal package omp command");
   }
 
+  // NUMA first-touch policy applies to all subsequent large allocations
+
+#if defined(_OPENMP)
+  memory->numa_touch = _numa ? nthreads : 0;
+#endif
+
   // print summary of settings
 
   if (comm->me == 0) {
@@ -112,6 +123,8 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
     if (reset_thr)
       utils::logmesg(lmp, "set {} OpenMP thread(s) per MPI task\n", nthreads);
     utils::logmesg(lmp, "using {} neighbor list subroutines\n", nmode);
+    if (_numa)
+      utils::logmesg(lmp, "using NUMA-aware first-touch allocation\n");
 #else
     error->warning(FLERR,"OpenMP support not enabled during compilation; "
                          "using 1 thread only.");
@@ -138,6 +151,8 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
 
 FixOMP::~FixOMP()
 {
+  memory->numa_touch = 0;
+
   for (int i=0; i < _nthr; ++i)
     delete thr[i];
 
@@ -159,10 +174,6 @@ int FixOMP::setmask()
 
 void FixOMP::init()
 {
-  // OPENMP package cannot be used with atom_style template
-  if (atom->molecular == Atom::TEMPLATE)
-    error->all(FLERR,"OPENMP package does not (yet) work with atom_style template");
-
   // adjust number of data objects when the number of OpenMP
   // threads has been changed somehow
   const int nthreads = comm->nthreads;
@@ -319,13 +330,21 @@ void FixOMP::pre_force(int)
   double *desph = atom->desph;
   double *drho = atom->drho;
 
+  // the last force reduction zeroed the per-thread copies as it summed
+  //   them up; when the stride of the per-thread blocks (= nall) has not
+  //   changed since then, they are still all zero and re-zeroing them
+  //   would be a wasted sweep over nthreads copies of the force array
+
+  const int zeroed = (_reduced && (nall == _nall_last)) ? 1 : 0;
+  _nall_last = nall;
+
 #if defined(_OPENMP)
 #pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(f,torque,erforce,desph,drho)
 #endif
   {
     const int tid = get_tid();
     thr[tid]->check_tid(tid);
-    thr[tid]->init_force(nall,f,torque,erforce,desph,drho);
+    thr[tid]->init_force(nall,f,torque,erforce,desph,drho,zeroed);
   } // end of omp parallel region
 
   _reduced = false;
@@ -67,8 +67,10 @@ class FixOMP : public Fix {
  private:
   int _nthr;                    // number of currently active ThrData objects
   bool _neighbor;               // en/disable threads for neighbor list construction
+  bool _numa;                   // en/disable NUMA first-touch allocation policy
   bool _mixed;                  // whether to prefer mixed precision compute kernels
   bool _reduced;                // whether forces have been reduced for this step
+  int _nall_last;               // # of atoms the thread arrays were set up for
   bool _pair_compute_flag;      // whether pair_compute is called
   bool _kspace_compute_flag;    // whether kspace_compute is called
 };
@@ -133,6 +133,8 @@ void MSMOMP::direct_eval(const int nn)
   const double * _noalias const v3_directn = v3_direct[nn];
   const double * _noalias const v4_directn = v4_direct[nn];
   const double * _noalias const v5_directn = v5_direct[nn];
+  const int * _noalias const ixlo_n = direct_ixlo[nn];
+  const int * _noalias const ixhi_n = direct_ixhi[nn];
 
   double v0,v1,v2,v3,v4,v5,emsm;
   v0 = v1 = v2 = v3 = v4 = v5 = emsm = 0.0;
@@ -200,9 +202,12 @@ void MSMOMP::direct_eval(const int nn)
         const int zk = (iz + nzhi_direct)*ny;
         for (iy = jmin; iy <= jmax; iy++) {
           const int jj = icy+iy;
-          const int zyk = (zk + iy + nyhi_direct)*nx;
+          const int irow = zk + iy + nyhi_direct;
+          const int zyk = irow*nx;
+          const int ilo = MAX(imin,ixlo_n[irow]);
+          const int ihi = MIN(imax,ixhi_n[irow]);
           const double * _noalias const qgridnkj = &qgridn[kk][jj][icx];
-          for (ix = imin; ix <= imax; ix++) {
+          for (ix = ilo; ix <= ihi; ix++) {
             const double qtmp2 = qgridnkj[ix];
             k = zyk + ix + nxhi_direct;
             const double gtmp = g_directn[k];
@@ -225,9 +230,12 @@ void MSMOMP::direct_eval(const int nn)
       const int zk = nzhi_direct*ny;
       for (iy = 1; iy <= jmax; iy++) {
         const int jj = icy+iy;
-        const int zyk = (zk + iy + nyhi_direct)*nx;
+        const int irow = zk + iy + nyhi_direct;
+        const int zyk = irow*nx;
+        const int ilo = MAX(imin,ixlo_n[irow]);
+        const int ihi = MIN(imax,ixhi_n[irow]);
         const double * _noalias const qgridnkj = &qgridn[icz][jj][icx];
-        for (ix = imin; ix <= imax; ix++) {
+        for (ix = ilo; ix <= ihi; ix++) {
           const double qtmp2 = qgridnkj[ix];
           k = zyk + ix + nxhi_direct;
           const double gtmp = g_directn[k];
@@ -247,8 +255,9 @@ void MSMOMP::direct_eval(const int nn)
       // iz=0, iy=0
 
       const int zyk = (zk + nyhi_direct)*nx;
+      const int ihi0 = MIN(imax,ixhi_n[zk + nyhi_direct]);
       const double * _noalias const qgridnkj = &qgridn[icz][icy][icx];
-      for (ix = 1; ix <= imax; ix++) {
+      for (ix = 1; ix <= ihi0; ix++) {
         const double qtmp2 = qgridnkj[ix];
         k = zyk + ix + nxhi_direct;
         const double gtmp = g_directn[k];
@@ -333,7 +342,8 @@ void MSMOMP::direct_peratom(const int nn)
   const double * _noalias const v3_directn = v3_direct[nn];
   const double * _noalias const v4_directn = v4_direct[nn];
   const double * _noalias const v5_directn = v5_direct[nn];
-
+  const int * _noalias const ixlo_n = direct_ixlo[nn];
+  const int * _noalias const ixhi_n = direct_ixhi[nn];
 
   const int alphan = alpha[nn];
   const int betaxn = betax[nn];
@@ -388,9 +398,12 @@ void MSMOMP::direct_peratom(const int nn)
       const int zk = (iz + nzhi_direct)*ny;
       for (iy = jmin; iy <= jmax; iy++) {
         const int jj = icy+iy;
-        const int zyk = (zk + iy + nyhi_direct)*nx;
+        const int irow = zk + iy + nyhi_direct;
+        const int zyk = irow*nx;
+        const int ilo = MAX(imin,ixlo_n[irow]);
+        const int ihi = MIN(imax,ixhi_n[irow]);
         double * _noalias const egridnkj = &egridn[kk][jj][icx];
-        for (ix = imin; ix <= imax; ix++) {
+        for (ix = ilo; ix <= ihi; ix++) {
           k = zyk + ix + nxhi_direct;
           const int ii = icx+ix;
           const double gtmp = g_directn[k];
@@ -414,9 +427,12 @@ void MSMOMP::direct_peratom(const int nn)
     const int zk = nzhi_direct*ny;
     for (iy = 1; iy <= jmax; iy++) {
       const int jj = icy+iy;
-      const int zyk = (zk + iy + nyhi_direct)*nx;
+      const int irow = zk + iy + nyhi_direct;
+      const int zyk = irow*nx;
+      const int ilo = MAX(imin,ixlo_n[irow]);
+      const int ihi = MIN(imax,ixhi_n[irow]);
       double * _noalias const egridnkj = &egridn[icz][jj][icx];
-      for (ix = imin; ix <= imax; ix++) {
+      for (ix = ilo; ix <= ihi; ix++) {
         k = zyk + ix + nxhi_direct;
         const int ii = icx+ix;
         const double gtmp = g_directn[k];
@@ -437,8 +453,9 @@ void MSMOMP::direct_peratom(const int nn)
     // iz=0, iy=0
 
     const int zyk = (zk + nyhi_direct)*nx;
+    const int ihi0 = MIN(imax,ixhi_n[zk + nyhi_direct]);
     double * _noalias const egridnkj = &egridn[icz][icy][icx];
-    for (ix = 1; ix <= imax; ix++) {
+    for (ix = 1; ix <= ihi0; ix++) {
       k = zyk + ix + nxhi_direct;
       const int ii = icx+ix;
       const double gtmp = g_directn[k];
@@ -0,0 +1,189 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "nbin_standard_omp.h"
+#include "omp_compat.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "memory.h"
+#include "update.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+NBinStandardOmp::NBinStandardOmp(LAMMPS *lmp) : NBinStandard(lmp)
+{
+  binlist = nullptr;
+  binstart = nullptr;
+  thrcount = nullptr;
+  maxbinlist = maxbinstart = maxthrcount = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+NBinStandardOmp::~NBinStandardOmp()
+{
+  memory->destroy(binlist);
+  memory->destroy(binstart);
+  memory->destroy(thrcount);
+}
+
+/* ----------------------------------------------------------------------
+   setup for bin_atoms(), also grow counting sort scratch arrays
+------------------------------------------------------------------------- */
+
+void NBinStandardOmp::bin_atoms_setup(int nall)
+{
+  NBinStandard::bin_atoms_setup(nall);
+
+  int nthreads = comm->nthreads;
+
+  if (mbins > maxbinstart) {
+    maxbinstart = mbins;
+    memory->destroy(binstart);
+    memory->create(binstart,maxbinstart,"neigh:binstart");
+  }
+
+  if (nthreads*mbins > maxthrcount) {
+    maxthrcount = nthreads*mbins;
+    memory->destroy(thrcount);
+    memory->create(thrcount,maxthrcount,"neigh:thrcount");
+  }
+
+  if (nall > maxbinlist) {
+    maxbinlist = nall;
+    memory->destroy(binlist);
+    memory->create(binlist,maxbinlist,"neigh:binlist");
+  }
+}
+
+/* ----------------------------------------------------------------------
+   thread-parallel counting sort version of NBinStandard::bin_atoms()
+   pass 1: threads bin contiguous atom ranges, counting atoms per bin
+   pass 2: exclusive scan over bins, then over threads within each bin,
+     so the sort is stable in atom index order
+   pass 3: threads scatter their atoms into binlist at reserved offsets
+   pass 4: threads convert disjoint ranges of bins into the same
+     binhead/bins linked lists the serial version produces
+   stable index order reproduces the serial list layout exactly:
+     local atoms in ascending order, then ghost atoms in ascending order
+------------------------------------------------------------------------- */
+
+void NBinStandardOmp::bin_atoms()
+{
+  last_bin = update->ntimestep;
+
+  // includegroup bins only a subset of atoms: use the serial fallback
+
+  if (includegroup) {
+    NBinStandard::bin_atoms();
+    return;
+  }
+
+  double **x = atom->x;
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+
+#if defined(_OPENMP)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(x)
+#endif
+  {
+#if defined(_OPENMP)
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif
+    const int adelta = 1 + nall/nthreads;
+    const int afrom = tid*adelta;
+    const int ato = (afrom+adelta > nall) ? nall : afrom+adelta;
+    const int bdelta = 1 + mbins/nthreads;
+    const int bfrom = tid*bdelta;
+    const int bto = (bfrom+bdelta > mbins) ? mbins : bfrom+bdelta;
+
+    int i,ib,t,n,run;
+    int *mycount = &thrcount[tid*mbins];
+
+    for (ib = 0; ib < mbins; ib++) mycount[ib] = 0;
+
+    for (i = afrom; i < ato; i++) {
+      ib = coord2bin(x[i]);
+      atom2bin[i] = ib;
+      mycount[ib]++;
+    }
+
+#if defined(_OPENMP)
+#pragma omp barrier
+#pragma omp single
+#endif
+    {
+      n = 0;
+      for (ib = 0; ib < mbins; ib++) {
+        binstart[ib] = n;
+        for (t = 0; t < nthreads; t++) n += thrcount[t*mbins+ib];
+      }
+    }
+
+    // convert per-thread counts to scatter offsets for my range of bins
+
+    for (ib = bfrom; ib < bto; ib++) {
+      run = binstart[ib];
+      for (t = 0; t < nthreads; t++) {
+        n = thrcount[t*mbins+ib];
+        thrcount[t*mbins+ib] = run;
+        run += n;
+      }
+    }
+
+#if defined(_OPENMP)
+#pragma omp barrier
+#endif
+
+    for (i = afrom; i < ato; i++) binlist[mycount[atom2bin[i]]++] = i;
+
+#if defined(_OPENMP)
+#pragma omp barrier
+#endif
+
+    // build linked lists for my range of bins from the packed binlist
+
+    for (ib = bfrom; ib < bto; ib++) {
+      const int start = binstart[ib];
+      const int stop = (ib == mbins-1) ? nall : binstart[ib+1];
+      if (start == stop) {
+        binhead[ib] = -1;
+        continue;
+      }
+      binhead[ib] = binlist[start];
+      for (i = start; i < stop-1; i++) bins[binlist[i]] = binlist[i+1];
+      bins[binlist[stop-1]] = -1;
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double NBinStandardOmp::memory_usage()
+{
+  double bytes = NBinStandard::memory_usage();
+  bytes += memory->usage(binlist,maxbinlist);
+  bytes += memory->usage(binstart,maxbinstart);
+  bytes += memory->usage(thrcount,maxthrcount);
+  return bytes;
+}
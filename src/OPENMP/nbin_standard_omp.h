@@ -0,0 +1,50 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef NBIN_CLASS
+// clang-format off
+NBinStyle(standard/omp,
+          NBinStandardOmp,
+          NB_STANDARD | NB_OMP);
+// clang-format on
+#else
+
+#ifndef LMP_NBIN_STANDARD_OMP_H
+#define LMP_NBIN_STANDARD_OMP_H
+
+#include "nbin_standard.h"
+
+namespace LAMMPS_NS {
+
+class NBinStandardOmp : public NBinStandard {
+ public:
+  NBinStandardOmp(class LAMMPS *);
+  ~NBinStandardOmp() override;
+
+  void bin_atoms_setup(int) override;
+  void bin_atoms() override;
+  double memory_usage() override;
+
+ private:
+  int *binlist;     // atoms packed by bin, stable in atom index order
+  int *binstart;    // offset of each bin within binlist
+  int *thrcount;    // per-thread, per-bin atom counts, then offsets
+  int maxbinlist;
+  int maxbinstart;
+  int maxthrcount;
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -54,12 +54,19 @@ void NPairHalffullOmp<NEWTON, TRI, TRIM>::build(NeighList *list)
   const int inum_full = list->listfull->inum;
   const double delta = 0.01 * force->angstrom;
 
+  // conversion cost per atom tracks the full list length of that atom,
+  // which varies strongly, so threads grab chunks of atoms dynamically
+  // instead of a fixed partition
+
+  constexpr int CHUNKSIZE = 8;
+  int chunk_next = 0;
+
   NPAIR_OMP_INIT;
 
 #if defined(_OPENMP)
-#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(list)
+#pragma omp parallel LMP_DEFAULT_NONE LMP_SHARED(list, chunk_next)
 #endif
-  NPAIR_OMP_SETUP(inum_full);
+  NPAIR_OMP_SETUP_DYNAMIC;
 
   int i, j, ii, jj, n, jnum, joriginal;
   int *neighptr, *jlist;
@@ -83,55 +90,56 @@ void NPairHalffullOmp<NEWTON, TRI, TRIM>::build(NeighList *list)
 
   // loop over atoms in full list
 
-  for (ii = ifrom; ii < ito; ii++) {
-
-    n = 0;
-    neighptr = ipage.vget();
-
-    // loop over parent full list
-
-    i = ilist_full[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-
-    jlist = firstneigh_full[i];
-    jnum = numneigh_full[i];
-
-    for (jj = 0; jj < jnum; jj++) {
-      joriginal = jlist[jj];
-      j = joriginal & NEIGHMASK;
-
-      if (NEWTON) {
-        if (j < nlocal) {
-          if (i > j) continue;
-        } else if (TRI) {
-          if (fabs(x[j][2] - ztmp) > delta) {
-            if (x[j][2] < ztmp) continue;
-          } else if (fabs(x[j][1] - ytmp) > delta) {
-            if (x[j][1] < ytmp) continue;
+  while (true) {
+    int ichunk;
+#if defined(_OPENMP)
+#pragma omp atomic capture
+    ichunk = chunk_next++;
+#else
+    ichunk = chunk_next++;
+#endif
+    const int ifrom = ichunk * CHUNKSIZE;
+    if (ifrom >= inum_full) break;
+    const int ito = MIN(ifrom + CHUNKSIZE, inum_full);
+
+    for (ii = ifrom; ii < ito; ii++) {
+
+      n = 0;
+      neighptr = ipage.vget();
+
+      // loop over parent full list
+
+      i = ilist_full[ii];
+      xtmp = x[i][0];
+      ytmp = x[i][1];
+      ztmp = x[i][2];
+
+      jlist = firstneigh_full[i];
+      jnum = numneigh_full[i];
+
+      for (jj = 0; jj < jnum; jj++) {
+        joriginal = jlist[jj];
+        j = joriginal & NEIGHMASK;
+
+        if (NEWTON) {
+          if (j < nlocal) {
+            if (i > j) continue;
+          } else if (TRI) {
+            if (fabs(x[j][2] - ztmp) > delta) {
+              if (x[j][2] < ztmp) continue;
+            } else if (fabs(x[j][1] - ytmp) > delta) {
+              if (x[j][1] < ytmp) continue;
+            } else {
+              if (x[j][0] < xtmp) continue;
+            }
           } else {
-            if (x[j][0] < xtmp) continue;
-          }
-        } else {
-          if (x[j][2] < ztmp) continue;
-          if (x[j][2] == ztmp) {
-            if (x[j][1] < ytmp) continue;
-            if (x[j][1] == ytmp && x[j][0] < xtmp) continue;
+            if (x[j][2] < ztmp) continue;
+            if (x[j][2] == ztmp) {
+              if (x[j][1] < ytmp) continue;
+              if (x[j][1] == ytmp && x[j][0] < xtmp) continue;
+            }
           }
-        }
-
-        if (TRIM) {
-          delx = xtmp - x[j][0];
-          dely = ytmp - x[j][1];
-          delz = ztmp - x[j][2];
-          rsq = delx * delx + dely * dely + delz * delz;
 
-          if (rsq > cutsq_custom) continue;
-        }
-        neighptr[n++] = joriginal;
-      } else {
-        if (j > i) {
           if (TRIM) {
             delx = xtmp - x[j][0];
             dely = ytmp - x[j][1];
@@ -141,15 +149,27 @@ void NPairHalffullOmp<NEWTON, TRI, TRIM>::build(NeighList *list)
             if (rsq > cutsq_custom) continue;
           }
           neighptr[n++] = joriginal;
+        } else {
+          if (j > i) {
+            if (TRIM) {
+              delx = xtmp - x[j][0];
+              dely = ytmp - x[j][1];
+              delz = ztmp - x[j][2];
+              rsq = delx * delx + dely * dely + delz * delz;
+
+              if (rsq > cutsq_custom) continue;
+            }
+            neighptr[n++] = joriginal;
+          }
         }
       }
-    }
 
-    ilist[ii] = i;
-    firstneigh[i] = neighptr;
-    numneigh[i] = n;
-    ipage.vgot(n);
-    if (ipage.status()) error->one(FLERR, "Neighbor list overflow, boost neigh_modify one");
+      ilist[ii] = i;
+      firstneigh[i] = neighptr;
+      numneigh[i] = n;
+      ipage.vgot(n);
+      if (ipage.status()) error->one(FLERR, "Neighbor list overflow, boost neigh_modify one");
+    }
   }
   NPAIR_OMP_CLOSE;
   list->inum = inum_full;
@@ -46,6 +46,16 @@ namespace LAMMPS_NS {
     ThrData *thr = fix->get_thr(tid);                                  \
     thr->timer(Timer::START);
 
+// get thread id without a static atom partition
+// used by build kernels which schedule their atoms dynamically
+
+#define NPAIR_OMP_SETUP_DYNAMIC                             \
+  {                                                         \
+    const int tid = omp_get_thread_num();                   \
+    FixOMP *fix = static_cast<FixOMP *>(modify->fix[ifix]); \
+    ThrData *thr = fix->get_thr(tid);                       \
+    thr->timer(Timer::START);
+
 #define NPAIR_OMP_CLOSE     \
   thr->timer(Timer::NEIGH); \
   }
@@ -59,6 +69,8 @@ namespace LAMMPS_NS {
   const int ifrom = 0;       \
   const int ito = num
 
+#define NPAIR_OMP_SETUP_DYNAMIC const int tid = 0
+
 #define NPAIR_OMP_CLOSE
 
 #endif
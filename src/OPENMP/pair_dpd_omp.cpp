@@ -18,6 +18,7 @@
 #include <cmath>
 #include "atom.h"
 #include "comm.h"
+#include "error.h"
 #include "force.h"
 #include "neigh_list.h"
 #include "update.h"
@@ -55,6 +56,19 @@ PairDPDOMP::~PairDPDOMP()
 
 /* ---------------------------------------------------------------------- */
 
+void PairDPDOMP::init_style()
+{
+  // the threaded kernels draw from per-thread RanMars generators
+  // and would silently ignore the per-pair Saru stream
+
+  if (saru_flag)
+    error->all(FLERR,"Pair style dpd/omp does not support the saru keyword");
+
+  PairDPD::init_style();
+}
+
+/* ---------------------------------------------------------------------- */
+
 void PairDPDOMP::compute(int eflag, int vflag)
 {
   ev_init(eflag,vflag);
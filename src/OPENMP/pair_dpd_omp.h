@@ -36,6 +36,7 @@ class PairDPDOMP : public PairDPD, public ThrOMP {
   ~PairDPDOMP() override;
 
   void compute(int, int) override;
+  void init_style() override;
   double memory_usage() override;
 
  protected:
@@ -32,6 +32,10 @@ PairLJCutOMP::PairLJCutOMP(LAMMPS *lmp) :
   suffix_flag |= Suffix::OMP;
   respa_enable = 0;
   cut_respa = nullptr;
+
+  // threaded kernels use half-list accumulation, never cluster-pair lists
+
+  clusterpair_allow = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -69,7 +69,7 @@ double ThrData::get_time(enum Timer::ttype flag)
 /* ---------------------------------------------------------------------- */
 
 void ThrData::init_force(int nall, double **f, double **torque, double *erforce, double *de,
-                         double *drho)
+                         double *drho, int zeroed)
 {
   eng_vdwl = eng_coul = eng_bond = eng_angle = eng_dihed = eng_imprp = eng_kspce = 0.0;
   memset(virial_pair, 0, 6 * sizeof(double));
@@ -82,15 +82,19 @@ void ThrData::init_force(int nall, double **f, double **torque, double *erforce,
   eatom_pair = eatom_bond = eatom_angle = eatom_dihed = eatom_imprp = eatom_kspce = nullptr;
   vatom_pair = vatom_bond = vatom_angle = vatom_dihed = vatom_imprp = vatom_kspce = nullptr;
 
+  // data_reduce_thr() zeroes the copies of threads > 0 while reducing,
+  //   so they only need to be re-zeroed when the layout changed
+  // thread 0 aliases the real array and is always cleared
+
   if (nall >= 0 && f) {
     _f = f + _tid * nall;
-    memset(&(_f[0][0]), 0, nall * 3 * sizeof(double));
+    if (!zeroed || _tid == 0) memset(&(_f[0][0]), 0, nall * 3 * sizeof(double));
   } else
     _f = nullptr;
 
   if (nall >= 0 && torque) {
     _torque = torque + _tid * nall;
-    memset(&(_torque[0][0]), 0, nall * 3 * sizeof(double));
+    if (!zeroed || _tid == 0) memset(&(_torque[0][0]), 0, nall * 3 * sizeof(double));
   } else
     _torque = nullptr;
 
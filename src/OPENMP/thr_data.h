@@ -49,7 +49,10 @@ class ThrData {
   double get_time(enum Timer::ttype flag);
 
   // erase accumulator contents and hook up force arrays
-  void init_force(int, double **, double **, double *, double *, double *);
+  // zeroed = 1 if the per-thread copies are known to already be zero,
+  //   i.e. the last force reduction cleared them and the layout of the
+  //   arrays has not changed since, which skips re-zeroing f and torque
+  void init_force(int, double **, double **, double *, double *, double *, int zeroed = 0);
 
   // give access to per-thread offset arrays
   double **get_f() const { return _f; };
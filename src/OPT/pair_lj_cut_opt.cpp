@@ -29,7 +29,12 @@ using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
-PairLJCutOpt::PairLJCutOpt(LAMMPS *lmp) : PairLJCut(lmp) {}
+PairLJCutOpt::PairLJCutOpt(LAMMPS *lmp) : PairLJCut(lmp)
+{
+  // templated kernels use half-list accumulation, never cluster-pair lists
+
+  clusterpair_allow = 0;
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -456,6 +456,25 @@ void FixPeriNeigh::copy_arrays(int i, int j, int /*delflag*/)
   wvolume[j] = wvolume[i];
 }
 
+/* ----------------------------------------------------------------------
+   remove partner slot JJ of atom I by copying the last slot into it
+   called by the pair styles when a bond breaks or a partner is lost,
+   so partner lists stay compacted and force loops only visit live bonds
+------------------------------------------------------------------------- */
+
+void FixPeriNeigh::remove_partner(int i, int jj)
+{
+  int last = npartner[i] - 1;
+  partner[i][jj] = partner[i][last];
+  if (isVES) {
+    deviatorextention[i][jj] = deviatorextention[i][last];
+    deviatorBackextention[i][jj] = deviatorBackextention[i][last];
+  }
+  if (isEPS) deviatorPlasticextension[i][jj] = deviatorPlasticextension[i][last];
+  r0[i][jj] = r0[i][last];
+  npartner[i] = last;
+}
+
 /* ----------------------------------------------------------------------
    pack values in local atom-based arrays for exchange with another proc
 ------------------------------------------------------------------------- */
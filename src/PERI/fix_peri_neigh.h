@@ -58,6 +58,8 @@ class FixPeriNeigh : public Fix {
   int pack_forward_comm(int, int *, double *, int, int *) override;
   void unpack_forward_comm(int, int, double *) override;
 
+  void remove_partner(int, int);
+
  protected:
   int first;                            // flag for first time initialization
   int maxpartner;                       // max # of peridynamic neighs for any atom
@@ -44,7 +44,7 @@ PairPeriPMB::PairPeriPMB(LAMMPS *_lmp) : PairPeri(_lmp)
 
 void PairPeriPMB::compute(int eflag, int vflag)
 {
-  int i,j,ii,jj,inum,jnum,itype,jtype;
+  int i,j,ii,jj,inum,jnum,itype,jtype,broken;
   double xtmp,ytmp,ztmp,delx,dely,delz;
   double xtmp0,ytmp0,ztmp0,delx0,dely0,delz0,rsq0;
   double rsq,r,dr,rk,evdwl,fpair,fbond;
@@ -158,7 +158,7 @@ void PairPeriPMB::compute(int eflag, int vflag)
 
   // loop over my particles and their partners
   // partner list contains all bond partners, so I-J appears twice
-  // if bond already broken, skip this partner
+  // broken bonds are removed from the list, so only live bonds are visited
   // first = true if this is first neighbor of particle i
 
   bool first;
@@ -168,18 +168,24 @@ void PairPeriPMB::compute(int eflag, int vflag)
     ytmp = x[i][1];
     ztmp = x[i][2];
     itype = type[i];
-    jnum = npartner[i];
     s0_new[i] = DBL_MAX;
     first = true;
 
-    for (jj = 0; jj < jnum; jj++) {
-      if (partner[i][jj] == 0) continue;
+    jj = 0;
+    while (jj < npartner[i]) {
+
+      // zeroed slots can only come from restart files of older versions
+
+      if (partner[i][jj] == 0) {
+        fix_peri_neigh->remove_partner(i,jj);
+        continue;
+      }
       j = atom->map(partner[i][jj]);
 
       // check if lost a partner without first breaking bond
 
       if (j < 0) {
-        partner[i][jj] = 0;
+        fix_peri_neigh->remove_partner(i,jj);
         continue;
       }
 
@@ -222,8 +228,10 @@ void PairPeriPMB::compute(int eflag, int vflag)
 
       // find stretch in bond I-J and break if necessary
       // use s0 from previous timestep
+      // removal compacts the list by swapping the last live slot in,
+      // which is then processed next before jj is advanced
 
-      if (stretch > MIN(s0[i],s0[j])) partner[i][jj] = 0;
+      broken = (stretch > MIN(s0[i],s0[j]));
 
       // update s0 for next timestep
 
@@ -232,6 +240,9 @@ void PairPeriPMB::compute(int eflag, int vflag)
       else
          s0_new[i] = MAX(s0_new[i],s00[itype][jtype] - (alpha[itype][jtype] * stretch));
       first = false;
+
+      if (broken) fix_peri_neigh->remove_partner(i,jj);
+      else jj++;
     }
   }
 
@@ -165,6 +165,7 @@ void plugin_register(lammpsplugin_t *plugin, void *ptr)
   }
 
   std::string pstyle = plugin->style;
+  lmp->force->create_factories();
   if (pstyle == "pair") {
     auto pair_map = lmp->force->pair_map;
     if (pair_map->find(plugin->name) != pair_map->end()) {
@@ -299,6 +300,7 @@ void plugin_unload(const char *style, const char *name, LAMMPS *lmp)
   // we can close the DSO handle if the last reference is gone.
 
   std::string pstyle = style;
+  lmp->force->create_factories();
   if (pstyle == "pair") {
 
     auto found = lmp->force->pair_map->find(name);
@@ -27,6 +27,7 @@
 #include "memory.h"
 #include "modify.h"
 #include "neigh_list.h"
+#include "neighbor.h"
 #include "respa.h"
 #include "text_file_reader.h"
 #include "update.h"
@@ -107,6 +108,16 @@ FixQEq::FixQEq(LAMMPS *lmp, int narg, char **arg) :
   H.jlist = nullptr;
   H.val = nullptr;
 
+  // IC preconditioner, off by default, enabled via the precond keyword
+  icprec_flag = 0;
+  icprec_laststep = -1;
+  L.firstnbr = nullptr;
+  L.numnbrs = nullptr;
+  L.jlist = nullptr;
+  L.val = nullptr;
+  Ldiag = nullptr;
+  yprec = nullptr;
+
   // others
   cutoff_sq = cutoff*cutoff;
   chizj = nullptr;
@@ -269,6 +280,18 @@ void FixQEq::allocate_matrix()
   memory->create(H.numnbrs,n_cap,"qeq:H.numnbrs");
   memory->create(H.jlist,m_cap,"qeq:H.jlist");
   memory->create(H.val,m_cap,"qeq:H.val");
+
+  if (icprec_flag) {
+    L.n = n_cap;
+    L.m = m_cap;
+    memory->create(L.firstnbr,n_cap,"qeq:L.firstnbr");
+    memory->create(L.numnbrs,n_cap,"qeq:L.numnbrs");
+    memory->create(L.jlist,m_cap,"qeq:L.jlist");
+    memory->create(L.val,m_cap,"qeq:L.val");
+    memory->create(Ldiag,n_cap,"qeq:Ldiag");
+    memory->create(yprec,n_cap,"qeq:yprec");
+    icprec_laststep = -1;
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -279,6 +302,13 @@ void FixQEq::deallocate_matrix()
   memory->destroy(H.numnbrs);
   memory->destroy(H.jlist);
   memory->destroy(H.val);
+
+  memory->destroy(L.firstnbr);
+  memory->destroy(L.numnbrs);
+  memory->destroy(L.jlist);
+  memory->destroy(L.val);
+  memory->destroy(Ldiag);
+  memory->destroy(yprec);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -405,17 +435,30 @@ int FixQEq::CG(double *b, double *x)
   inum = list->inum;
   ilist = list->ilist;
 
+  // refactor the cached IC preconditioner only when the neighbor list
+  // was rebuilt (and hence atoms migrated) or the factor was invalidated
+
+  if (icprec_flag &&
+      (icprec_laststep < 0 ||
+       (neighbor->ago == 0 && icprec_laststep != update->ntimestep))) {
+    build_ic_precond();
+    icprec_laststep = update->ntimestep;
+  }
+
   pack_flag = 1;
   sparse_matvec(&H, x, q);
   comm->reverse_comm(this);
 
   vector_sum(r , 1.,  b, -1., q, inum);
 
-  for (ii = 0; ii < inum; ++ii) {
-    i = ilist[ii];
-    if (atom->mask[i] & groupbit)
-      d[i] = r[i] * Hdia_inv[i];
-    else d[i] = 0.0;
+  if (icprec_flag) apply_precond(r, d);
+  else {
+    for (ii = 0; ii < inum; ++ii) {
+      i = ilist[ii];
+      if (atom->mask[i] & groupbit)
+        d[i] = r[i] * Hdia_inv[i];
+      else d[i] = 0.0;
+    }
   }
 
   b_norm = parallel_norm(b, inum);
@@ -432,10 +475,13 @@ int FixQEq::CG(double *b, double *x)
     vector_add(x, alfa, d, inum);
     vector_add(r, -alfa, q, inum);
 
-    for (ii = 0; ii < inum; ++ii) {
-      i = ilist[ii];
-      if (atom->mask[i] & groupbit)
-        p[i] = r[i] * Hdia_inv[i];
+    if (icprec_flag) apply_precond(r, p);
+    else {
+      for (ii = 0; ii < inum; ++ii) {
+        i = ilist[ii];
+        if (atom->mask[i] & groupbit)
+          p[i] = r[i] * Hdia_inv[i];
+      }
     }
 
     sig_old = sig_new;
@@ -484,6 +530,115 @@ void FixQEq::sparse_matvec(sparse_matrix *A, double *x, double *b)
 
 }
 
+/* ----------------------------------------------------------------------
+   zero-fill IC(0) factorization of the local-local block of H
+   each proc factors only couplings between its owned atoms, which keeps
+     the preconditioner communication free (block Jacobi across procs)
+   compute_H stores each pair twice with half its value, so a stored
+     entry with j < i contributes 2*val to A_ij
+------------------------------------------------------------------------- */
+
+void FixQEq::build_ic_precond()
+{
+  int i, j, a, b, m, itr_j;
+
+  nlocal = atom->nlocal;
+  int *mask = atom->mask;
+
+  // gather the strictly lower triangular local couplings of each row
+  // and sort them by column for the merges in the factorization
+
+  m = 0;
+  for (i = 0; i < nlocal; i++) {
+    L.firstnbr[i] = m;
+    if (mask[i] & groupbit) {
+      for (itr_j = H.firstnbr[i]; itr_j < H.firstnbr[i]+H.numnbrs[i]; itr_j++) {
+        j = H.jlist[itr_j];
+        if (j < i && (mask[j] & groupbit)) {
+          L.jlist[m] = j;
+          L.val[m] = 2.0*H.val[itr_j];
+          m++;
+        }
+      }
+      for (a = L.firstnbr[i]+1; a < m; a++) {
+        const int cj = L.jlist[a];
+        const double cv = L.val[a];
+        for (b = a-1; b >= L.firstnbr[i] && L.jlist[b] > cj; b--) {
+          L.jlist[b+1] = L.jlist[b];
+          L.val[b+1] = L.val[b];
+        }
+        L.jlist[b+1] = cj;
+        L.val[b+1] = cv;
+      }
+    }
+    L.numnbrs[i] = m - L.firstnbr[i];
+  }
+
+  // IC(0) sweep: L_ij = (A_ij - sum_k L_ik*L_jk)/Ldiag_j over shared
+  // columns k < j, then Ldiag_i = sqrt(A_ii - sum_j L_ij^2)
+  // a degenerate pivot drops the row couplings and keeps its Jacobi
+  // diagonal, which cannot break the solve, only weaken the row
+
+  for (i = 0; i < nlocal; i++) {
+    const double diag = (mask[i] & groupbit) ? 1.0/Hdia_inv[i] : 1.0;
+    const int ifrom = L.firstnbr[i];
+    const int ito = ifrom + L.numnbrs[i];
+    double sum = 0.0;
+
+    for (itr_j = ifrom; itr_j < ito; itr_j++) {
+      j = L.jlist[itr_j];
+      const int bto = L.firstnbr[j] + L.numnbrs[j];
+      double dot = 0.0;
+      a = ifrom;
+      b = L.firstnbr[j];
+      while (a < itr_j && b < bto) {
+        if (L.jlist[a] == L.jlist[b]) dot += L.val[a++]*L.val[b++];
+        else if (L.jlist[a] < L.jlist[b]) a++;
+        else b++;
+      }
+      L.val[itr_j] = (L.val[itr_j] - dot)/Ldiag[j];
+      sum += L.val[itr_j]*L.val[itr_j];
+    }
+
+    if (diag - sum > 0.0) Ldiag[i] = sqrt(diag - sum);
+    else {
+      for (itr_j = ifrom; itr_j < ito; itr_j++) L.val[itr_j] = 0.0;
+      Ldiag[i] = sqrt(diag);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   zz = (L L^T)^-1 rr via forward and backward triangular solves
+   the backward pass scatters row entries since L is stored by row
+------------------------------------------------------------------------- */
+
+void FixQEq::apply_precond(double *rr, double *zz)
+{
+  int i, itr_j;
+
+  nlocal = atom->nlocal;
+  int *mask = atom->mask;
+
+  for (i = 0; i < nlocal; i++) {
+    double sum = (mask[i] & groupbit) ? rr[i] : 0.0;
+    const int ifrom = L.firstnbr[i];
+    const int ito = ifrom + L.numnbrs[i];
+    for (itr_j = ifrom; itr_j < ito; itr_j++)
+      sum -= L.val[itr_j]*yprec[L.jlist[itr_j]];
+    yprec[i] = sum/Ldiag[i];
+  }
+
+  for (i = nlocal-1; i >= 0; i--) {
+    zz[i] = yprec[i]/Ldiag[i];
+    if (!(mask[i] & groupbit)) zz[i] = 0.0;
+    const int ifrom = L.firstnbr[i];
+    const int ito = ifrom + L.numnbrs[i];
+    for (itr_j = ifrom; itr_j < ito; itr_j++)
+      yprec[L.jlist[itr_j]] -= L.val[itr_j]*zz[i];
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void FixQEq::calculate_Q()
@@ -586,6 +741,12 @@ double FixQEq::memory_usage()
   bytes += (double)m_cap * sizeof(int);
   bytes += (double)m_cap * sizeof(double);
 
+  if (icprec_flag) {    // IC factor + scratch
+    bytes += (double)n_cap*2 * sizeof(int);
+    bytes += (double)m_cap * sizeof(int);
+    bytes += (double)(m_cap + 2*n_cap) * sizeof(double);
+  }
+
   return bytes;
 }
 
@@ -96,6 +96,14 @@ class FixQEq : public Fix {
   double *b_s, *b_t;
   double *p, *q, *r, *d;
 
+  // cached incomplete Cholesky preconditioner
+
+  int icprec_flag;          // 1 if IC preconditioning requested
+  bigint icprec_laststep;   // step of last factorization, -1 if invalid
+  sparse_matrix L;          // strictly lower triangular IC factor
+  double *Ldiag;            // diagonal of the IC factor
+  double *yprec;            // scratch vector for the triangular solves
+
   // streitz-mintmire
 
   double alpha;
@@ -127,6 +135,8 @@ class FixQEq : public Fix {
 
   virtual int CG(double *, double *);
   virtual void sparse_matvec(sparse_matrix *, double *, double *);
+  void build_ic_precond();
+  void apply_precond(double *, double *);
 };
 
 }    // namespace LAMMPS_NS
@@ -37,13 +37,21 @@ using namespace LAMMPS_NS;
 
 FixQEqShielded::FixQEqShielded(LAMMPS *lmp, int narg, char **arg) : FixQEq(lmp, narg, arg)
 {
-  if (narg == 10) {
-    if (strcmp(arg[8], "warn") == 0) {
-      maxwarn = utils::logical(FLERR, arg[9], false, lmp);
+  int iarg = 8;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg], "warn") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix qeq/shielded warn", error);
+      maxwarn = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "precond") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix qeq/shielded precond", error);
+      if (strcmp(arg[iarg + 1], "jacobi") == 0) icprec_flag = 0;
+      else if (strcmp(arg[iarg + 1], "ic") == 0) icprec_flag = 1;
+      else error->all(FLERR, "Unknown fix qeq/shielded precond option: {}", arg[iarg + 1]);
+      iarg += 2;
     } else
-      error->all(FLERR, "Illegal fix qeq/shielded command");
-  } else if (narg > 8)
-    error->all(FLERR, "Illegal fix qeq/shielded command");
+      error->all(FLERR, "Unknown fix qeq/shielded keyword: {}", arg[iarg]);
+  }
   if (reax_flag) extract_reax();
 }
 
@@ -182,8 +190,9 @@ void FixQEqShielded::init_matvec()
       Hdia_inv[i] = 1. / eta[atom->type[i]];
       b_s[i]      = -(chi[atom->type[i]] + chizj[i]);
       b_t[i]      = -1.0;
-      t[i] = t_hist[i][2] + 3 * (t_hist[i][0] - t_hist[i][1]);
-      s[i] = 4*(s_hist[i][0]+s_hist[i][2])-(6*s_hist[i][1]+s_hist[i][3]);
+      t[i] = 4*(t_hist[i][0]+t_hist[i][2])-(6*t_hist[i][1]+t_hist[i][3]);
+      s[i] = 5*(s_hist[i][0]-s_hist[i][3]) - 10*(s_hist[i][1]-s_hist[i][2])
+        + s_hist[i][4];
     }
   }
 
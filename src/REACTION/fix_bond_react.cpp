@@ -577,6 +577,11 @@ FixBondReact::FixBondReact(LAMMPS *lmp, int narg, char **arg) :
   attempt = nullptr;
   nattempt = nullptr;
   allnattempt = 0;
+  cand_laststep = -1;
+  memory->create(cand_any,nreacts,"bond/react:cand_any");
+  for (int i = 0; i < nreacts; i++) cand_any[i] = 1;
+  cand_pairs.resize(nreacts);
+  any_limited = 1;
   my_num_mega = 0;
   local_num_mega = 0;
   ghostly_num_mega = 0;
@@ -628,6 +633,7 @@ FixBondReact::~FixBondReact()
   memory->destroy(nattempt);
   memory->destroy(distsq);
   memory->destroy(attempt);
+  memory->destroy(cand_any);
   memory->destroy(edge);
   memory->destroy(equivalences);
   memory->destroy(reverse_equiv);
@@ -889,10 +895,76 @@ void FixBondReact::post_integrate()
     return;
   }
 
-  // acquire updated ghost atom positions
-  // necessary b/c are calling this after integrate, but before Verlet comm
+  // per-rxn gating: Nevery phase, max # of rxns, rate limit
+  // all inputs are identical on every proc, so procs agree on eligibility
+  // and can consistently skip the collective operations below
 
-  comm->forward_comm();
+  int neligible = 0;
+  int *rxn_eligible = new int[nreacts];
+  for (rxnID = 0; rxnID < nreacts; rxnID++) {
+    int rate_limit_flag = 1;
+    if (rate_limit[0][rxnID] == 1) {
+      int myrxn_count = store_rxn_count[rate_limit[2][rxnID]-1][rxnID];
+      if (myrxn_count == -1) rate_limit_flag = 0;
+      else {
+        int nrxns_delta = reaction_count_total[rxnID] - myrxn_count;
+        int my_nrate;
+        if (var_flag[NRATE][rxnID] == 1) {
+          my_nrate = input->variable->compute_equal(var_id[NRATE][rxnID]);
+        } else my_nrate = rate_limit[1][rxnID];
+        if (nrxns_delta >= my_nrate) rate_limit_flag = 0;
+      }
+    }
+    if ((update->ntimestep % nevery[rxnID]) ||
+        (max_rxn[rxnID] <= reaction_count_total[rxnID]) ||
+        (rate_limit_flag == 0)) rxn_eligible[rxnID] = 0;
+    else {
+      rxn_eligible[rxnID] = 1;
+      neligible++;
+    }
+  }
+
+  if (!neligible) {
+    delete[] rxn_eligible;
+    unlimit_bond();
+    return;
+  }
+
+  // here we define a full special list
+  // may need correction for unusual special bond settings
+  nxspecial = atom->nspecial;
+  xspecial = atom->special;
+
+  // rebuild candidate pair indices if the neighbor lists were rebuilt
+  // since the last time, i.e. after atoms migrated or topology changed
+  // reactions and unlimiting force a reneighboring, so this is the only
+  // trigger needed
+
+  int comm_done = 0;
+  if (neighbor->ncalls != cand_laststep) {
+    // acquire updated ghost atom positions
+    // necessary b/c are calling this after integrate, but before Verlet comm
+    comm->forward_comm();
+    comm_done = 1;
+    neighbor->build_one(list);
+    build_candidates();
+    cand_laststep = neighbor->ncalls;
+  }
+
+  // early out without any communication if no proc has candidate pairs
+  // for any eligible rxn: cand_any was allreduced at the last rebuild,
+  // so all procs agree that nothing can happen
+
+  int any_work = 0;
+  for (int i = 0; i < nreacts; i++)
+    if (rxn_eligible[i] && cand_any[i]) any_work = 1;
+  if (!any_work) {
+    delete[] rxn_eligible;
+    unlimit_bond();
+    return;
+  }
+
+  if (!comm_done) comm->forward_comm();
 
   // resize bond partner list and initialize it
   // needs to be atom->nmax in length
@@ -919,37 +991,15 @@ void FixBondReact::post_integrate()
   int nlocal = atom->nlocal;
   int nall = atom->nlocal + atom->nghost;
 
-  // loop over neighbors of my atoms
+  // loop over candidate pairs
   // each atom sets one closest eligible partner atom ID to bond with
 
   tagint *tag = atom->tag;
   int *type = atom->type;
 
-  neighbor->build_one(list);
-
-  // here we define a full special list
-  // may need correction for unusual special bond settings
-  nxspecial = atom->nspecial;
-  xspecial = atom->special;
-
   int j;
   for (rxnID = 0; rxnID < nreacts; rxnID++) {
-    int rate_limit_flag = 1;
-    if (rate_limit[0][rxnID] == 1) {
-      int myrxn_count = store_rxn_count[rate_limit[2][rxnID]-1][rxnID];
-      if (myrxn_count == -1) rate_limit_flag = 0;
-      else {
-        int nrxns_delta = reaction_count_total[rxnID] - myrxn_count;
-        int my_nrate;
-        if (var_flag[NRATE][rxnID] == 1) {
-          my_nrate = input->variable->compute_equal(var_id[NRATE][rxnID]);
-        } else my_nrate = rate_limit[1][rxnID];
-        if (nrxns_delta >= my_nrate) rate_limit_flag = 0;
-      }
-    }
-    if ((update->ntimestep % nevery[rxnID]) ||
-        (max_rxn[rxnID] <= reaction_count_total[rxnID]) ||
-        (rate_limit_flag == 0)) continue;
+    if (!rxn_eligible[rxnID] || !cand_any[rxnID]) continue;
     for (int ii = 0; ii < nall; ii++) {
       partner[ii] = 0;
       finalpartner[ii] = 0;
@@ -1044,6 +1094,8 @@ void FixBondReact::post_integrate()
     }
   }
 
+  delete[] rxn_eligible;
+
   // break loop if no even eligible bonding atoms were found (on any proc)
   int some_chance;
 
@@ -1065,26 +1117,29 @@ void FixBondReact::post_integrate()
   // run through the superimpose algorithm
   // this checks if simulation topology matches unreacted mol template
   superimpose_algorithm();
+  // superimpose may have limited newly reacted atoms on some proc
+  any_limited = 1;
   // free atoms that have been limited after reacting
   unlimit_bond();
 }
 
 /* ----------------------------------------------------------------------
-  Search non-bonded neighbor lists if bonding atoms are not in special list
+  Rebuild the per-rxn candidate pair indices from the neighbor and
+  special lists. The cached filters (atom types, special-list exclusion,
+  inter/intra molecule) only change when atoms migrate or topology
+  changes, both of which force a reneighboring, so the indices stay
+  valid until the next neighbor list build. Atom group membership,
+  post-reaction limiting, and distances are rechecked at every scan.
+  Also allgathers whether any proc has candidates for each rxn, so later
+  invocations can skip all communication when nothing can react.
 ------------------------------------------------------------------------- */
 
-void FixBondReact::far_partner()
+void FixBondReact::build_candidates()
 {
   int inum,jnum,itype,jtype,possible;
-  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
   int *ilist,*jlist,*numneigh,**firstneigh;
 
-  // loop over neighbors of my atoms
-  // each atom sets one closest eligible partner atom ID to bond with
-
-  double **x = atom->x;
   tagint *tag = atom->tag;
-  int *mask = atom->mask;
   int *type = atom->type;
 
   inum = list->inum;
@@ -1092,82 +1147,144 @@ void FixBondReact::far_partner()
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
-  // per-atom property indicating if in bond/react master group
-  int flag,cols;
-  int index1 = atom->find_custom("limit_tags",flag,cols);
-  int *i_limit_tags = atom->ivector[index1];
-
   int i,j;
+  int *cand_local = new int[nreacts];
 
-  for (int ii = 0; ii < inum; ii++) {
-    i = ilist[ii];
-    if (!(mask[i] & groupbits[rxnID])) continue;
-    if (i_limit_tags[i] != 0) continue;
-    itype = type[i];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    jlist = firstneigh[i];
-    jnum = numneigh[i];
-
-    for (int jj = 0; jj < jnum; jj++) {
-      j = jlist[jj];
-      j &= NEIGHMASK;
-      if (!(mask[j] & groupbits[rxnID])) {
-        continue;
-      }
+  for (int myrxn = 0; myrxn < nreacts; myrxn++) {
+    std::vector<int> &pairs = cand_pairs[myrxn];
+    pairs.clear();
 
-      if (i_limit_tags[j] != 0) {
-        continue;
-      }
+    if (closeneigh[myrxn] < 0) {
 
-      if (molecule_keyword[rxnID] == INTER) {
-        if (atom->molecule[i] == atom->molecule[j]) continue;
-      } else if (molecule_keyword[rxnID] == INTRA) {
-        if (atom->molecule[i] != atom->molecule[j]) continue;
-      }
+      // bonding atoms are not in each other's special list:
+      // filter the full neighbor list down to type-eligible pairs
 
-      jtype = type[j];
-      possible = 0;
-      if (itype == iatomtype[rxnID] && jtype == jatomtype[rxnID]) {
-        possible = 1;
-      } else if (itype == jatomtype[rxnID] && jtype == iatomtype[rxnID]) {
-        possible = 1;
-      }
+      for (int ii = 0; ii < inum; ii++) {
+        i = ilist[ii];
+        itype = type[i];
+        jlist = firstneigh[i];
+        jnum = numneigh[i];
 
-      if (possible == 0) continue;
+        for (int jj = 0; jj < jnum; jj++) {
+          j = jlist[jj];
+          j &= NEIGHMASK;
 
-      // do not allow bonding atoms within special list
-      for (int k = 0; k < nxspecial[i][2]; k++)
-        if (xspecial[i][k] == tag[j]) possible = 0;
-      if (!possible) continue;
+          if (molecule_keyword[myrxn] == INTER) {
+            if (atom->molecule[i] == atom->molecule[j]) continue;
+          } else if (molecule_keyword[myrxn] == INTRA) {
+            if (atom->molecule[i] != atom->molecule[j]) continue;
+          }
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      domain->minimum_image(delx,dely,delz); // ghost location fix
-      rsq = delx*delx + dely*dely + delz*delz;
+          jtype = type[j];
+          possible = 0;
+          if (itype == iatomtype[myrxn] && jtype == jatomtype[myrxn]) {
+            possible = 1;
+          } else if (itype == jatomtype[myrxn] && jtype == iatomtype[myrxn]) {
+            possible = 1;
+          }
 
-      if (var_flag[RMIN][rxnID]) {
-        double cutoff = input->variable->compute_equal(var_id[RMIN][rxnID]);
-        cutsq[rxnID][0] = cutoff*cutoff;
-      }
-      if (var_flag[RMAX][rxnID]) {
-        double cutoff = input->variable->compute_equal(var_id[RMAX][rxnID]);
-        cutsq[rxnID][1] = cutoff*cutoff;
-      }
-      if (rsq >= cutsq[rxnID][1] || rsq <= cutsq[rxnID][0]) {
-        continue;
-      }
-      if (rsq < distsq[i][1]) {
-        partner[i] = tag[j];
-        distsq[i][1] = rsq;
+          if (possible == 0) continue;
+
+          // do not allow bonding atoms within special list
+          for (int k = 0; k < nxspecial[i][2]; k++)
+            if (xspecial[i][k] == tag[j]) possible = 0;
+          if (!possible) continue;
+
+          pairs.push_back(i);
+          pairs.push_back(j);
+        }
       }
-      if (rsq < distsq[j][1]) {
-        partner[j] = tag[i];
-        distsq[j][1] = rsq;
+
+    } else {
+
+      // bonding atoms are close neighbors:
+      // filter the special list down to type-eligible pairs
+
+      for (int ii = 0; ii < atom->nlocal; ii++) {
+        itype = type[ii];
+        int n = 0;
+        if (closeneigh[myrxn] != 0)
+          n = nxspecial[ii][closeneigh[myrxn]-1];
+        for (; n < nxspecial[ii][closeneigh[myrxn]]; n++) {
+          j = atom->map(xspecial[ii][n]);
+          jtype = type[j];
+          if (itype != iatomtype[myrxn] || jtype != jatomtype[myrxn]) continue;
+
+          if (molecule_keyword[myrxn] == INTER) {
+            if (atom->molecule[ii] == atom->molecule[j]) continue;
+          } else if (molecule_keyword[myrxn] == INTRA) {
+            if (atom->molecule[ii] != atom->molecule[j]) continue;
+          }
+
+          pairs.push_back(ii);
+          pairs.push_back(j);
+        }
       }
     }
+    cand_local[myrxn] = pairs.size() ? 1 : 0;
+  }
+
+  MPI_Allreduce(cand_local,cand_any,nreacts,MPI_INT,MPI_MAX,world);
+  delete[] cand_local;
+}
+
+/* ----------------------------------------------------------------------
+  Search candidate pairs from the non-bonded neighbor lists
+  if bonding atoms are not in special list
+------------------------------------------------------------------------- */
+
+void FixBondReact::far_partner()
+{
+  double delx,dely,delz,rsq;
+
+  // loop over candidate pairs of my atoms
+  // each atom sets one closest eligible partner atom ID to bond with
+
+  double **x = atom->x;
+  tagint *tag = atom->tag;
+  int *mask = atom->mask;
+
+  // per-atom property indicating if in bond/react master group
+  int flag,cols;
+  int index1 = atom->find_custom("limit_tags",flag,cols);
+  int *i_limit_tags = atom->ivector[index1];
+
+  int i,j;
+  const std::vector<int> &pairs = cand_pairs[rxnID];
+
+  for (std::size_t m = 0; m < pairs.size(); m += 2) {
+    i = pairs[m];
+    j = pairs[m+1];
+    if (!(mask[i] & groupbits[rxnID])) continue;
+    if (!(mask[j] & groupbits[rxnID])) continue;
+    if (i_limit_tags[i] != 0) continue;
+    if (i_limit_tags[j] != 0) continue;
+
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    domain->minimum_image(delx,dely,delz); // ghost location fix
+    rsq = delx*delx + dely*dely + delz*delz;
+
+    if (var_flag[RMIN][rxnID]) {
+      double cutoff = input->variable->compute_equal(var_id[RMIN][rxnID]);
+      cutsq[rxnID][0] = cutoff*cutoff;
+    }
+    if (var_flag[RMAX][rxnID]) {
+      double cutoff = input->variable->compute_equal(var_id[RMAX][rxnID]);
+      cutsq[rxnID][1] = cutoff*cutoff;
+    }
+    if (rsq >= cutsq[rxnID][1] || rsq <= cutsq[rxnID][0]) {
+      continue;
+    }
+    if (rsq < distsq[i][1]) {
+      partner[i] = tag[j];
+      distsq[i][1] = rsq;
+    }
+    if (rsq < distsq[j][1]) {
+      partner[j] = tag[i];
+      distsq[j][1] = rsq;
+    }
   }
 }
 
@@ -1177,12 +1294,11 @@ void FixBondReact::far_partner()
 
 void FixBondReact::close_partner()
 {
-  int n,i1,i2,itype,jtype;
+  int i1,i2;
   double delx,dely,delz,rsq;
 
   double **x = atom->x;
   tagint *tag = atom->tag;
-  int *type = atom->type;
   int *mask = atom->mask;
 
   // per-atom property indicating if in bond/react master group
@@ -1190,62 +1306,50 @@ void FixBondReact::close_partner()
   int index1 = atom->find_custom("limit_tags",flag,cols);
   int *i_limit_tags = atom->ivector[index1];
 
-  // loop over special list
-  for (int ii = 0; ii < atom->nlocal; ii++) {
-    itype = type[ii];
-    n = 0;
-    if (closeneigh[rxnID] != 0)
-      n = nxspecial[ii][closeneigh[rxnID]-1];
-    for (; n < nxspecial[ii][closeneigh[rxnID]]; n++) {
-      i1 = ii;
-      i2 = atom->map(xspecial[ii][n]);
-      jtype = type[i2];
-      if (!(mask[i1] & groupbits[rxnID])) continue;
-      if (!(mask[i2] & groupbits[rxnID])) continue;
-      if (i_limit_tags[i1] != 0) continue;
-      if (i_limit_tags[i2] != 0) continue;
-      if (itype != iatomtype[rxnID] || jtype != jatomtype[rxnID]) continue;
-
-      if (molecule_keyword[rxnID] == INTER) {
-        if (atom->molecule[i1] == atom->molecule[i2]) continue;
-      } else if (molecule_keyword[rxnID] == INTRA) {
-        if (atom->molecule[i1] != atom->molecule[i2]) continue;
-      }
-
-      delx = x[i1][0] - x[i2][0];
-      dely = x[i1][1] - x[i2][1];
-      delz = x[i1][2] - x[i2][2];
-      domain->minimum_image(delx,dely,delz); // ghost location fix
-      rsq = delx*delx + dely*dely + delz*delz;
+  // loop over candidate pairs from special list
+  const std::vector<int> &pairs = cand_pairs[rxnID];
+
+  for (std::size_t m = 0; m < pairs.size(); m += 2) {
+    i1 = pairs[m];
+    i2 = pairs[m+1];
+    if (!(mask[i1] & groupbits[rxnID])) continue;
+    if (!(mask[i2] & groupbits[rxnID])) continue;
+    if (i_limit_tags[i1] != 0) continue;
+    if (i_limit_tags[i2] != 0) continue;
+
+    delx = x[i1][0] - x[i2][0];
+    dely = x[i1][1] - x[i2][1];
+    delz = x[i1][2] - x[i2][2];
+    domain->minimum_image(delx,dely,delz); // ghost location fix
+    rsq = delx*delx + dely*dely + delz*delz;
+
+    if (var_flag[RMIN][rxnID]) {
+      double cutoff = input->variable->compute_equal(var_id[RMIN][rxnID]);
+      cutsq[rxnID][0] = cutoff*cutoff;
+    }
+    if (var_flag[RMAX][rxnID]) {
+      double cutoff = input->variable->compute_equal(var_id[RMAX][rxnID]);
+      cutsq[rxnID][1] = cutoff*cutoff;
+    }
+    if (rsq >= cutsq[rxnID][1] || rsq <= cutsq[rxnID][0]) continue;
 
-      if (var_flag[RMIN][rxnID]) {
-        double cutoff = input->variable->compute_equal(var_id[RMIN][rxnID]);
-        cutsq[rxnID][0] = cutoff*cutoff;
+    if (closeneigh[rxnID] == 0) {
+      if (rsq > distsq[i1][0]) {
+        partner[i1] = tag[i2];
+        distsq[i1][0] = rsq;
       }
-      if (var_flag[RMAX][rxnID]) {
-        double cutoff = input->variable->compute_equal(var_id[RMAX][rxnID]);
-        cutsq[rxnID][1] = cutoff*cutoff;
+      if (rsq > distsq[i2][0]) {
+        partner[i2] = tag[i1];
+        distsq[i2][0] = rsq;
       }
-      if (rsq >= cutsq[rxnID][1] || rsq <= cutsq[rxnID][0]) continue;
-
-      if (closeneigh[rxnID] == 0) {
-        if (rsq > distsq[i1][0]) {
-          partner[i1] = tag[i2];
-          distsq[i1][0] = rsq;
-        }
-        if (rsq > distsq[i2][0]) {
-          partner[i2] = tag[i1];
-          distsq[i2][0] = rsq;
-        }
-      } else {
-        if (rsq < distsq[i1][1]) {
-          partner[i1] = tag[i2];
-          distsq[i1][1] = rsq;
-        }
-        if (rsq < distsq[i2][1]) {
-          partner[i2] = tag[i1];
-          distsq[i2][1] = rsq;
-        }
+    } else {
+      if (rsq < distsq[i1][1]) {
+        partner[i1] = tag[i2];
+        distsq[i1][1] = rsq;
+      }
+      if (rsq < distsq[i2][1]) {
+        partner[i2] = tag[i1];
+        distsq[i2][1] = rsq;
       }
     }
   }
@@ -2803,6 +2907,12 @@ we give them back to the system thermostat
 
 void FixBondReact::unlimit_bond()
 {
+  // nothing to do (and no communication needed) if no atom anywhere is
+  // still limited: any_limited is reset whenever new reactions may have
+  // limited atoms, and updated below from a global check otherwise
+
+  if (!any_limited) return;
+
   // let's now unlimit in terms of i_limit_tags
   // we just run through all nlocal, looking for > limit_duration
   // then we return i_limit_tag to 0 (which removes from dynamic group)
@@ -2819,21 +2929,23 @@ void FixBondReact::unlimit_bond()
   int index3 = atom->find_custom("react_tags",flag,cols);
   int *i_react_tags = atom->ivector[index3];
 
-  int unlimitflag = 0;
+  int myflags[2] = {0,0};    // unlimited now, still limited after
   for (int i = 0; i < atom->nlocal; i++) {
     // unlimit atoms for next step! this resolves # of procs disparity, mostly
     // first '1': indexing offset, second '1': for next step
     if (i_limit_tags[i] != 0 && (update->ntimestep + 1 - i_limit_tags[i]) > limit_duration[i_react_tags[i]]) {
-      unlimitflag = 1;
+      myflags[0] = 1;
       i_limit_tags[i] = 0;
       if (stabilization_flag == 1) i_statted_tags[i] = 1;
       i_react_tags[i] = 0;
     }
+    if (i_limit_tags[i] != 0) myflags[1] = 1;
   }
 
   // really should only communicate this per-atom property, not entire reneighboring
-  MPI_Allreduce(MPI_IN_PLACE,&unlimitflag,1,MPI_INT,MPI_MAX,world);
-  if (unlimitflag) next_reneighbor = update->ntimestep;
+  MPI_Allreduce(MPI_IN_PLACE,myflags,2,MPI_INT,MPI_MAX,world);
+  if (myflags[0]) next_reneighbor = update->ntimestep;
+  any_limited = myflags[1];
 }
 
 /* ----------------------------------------------------------------------
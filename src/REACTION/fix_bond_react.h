@@ -105,6 +105,11 @@ class FixBondReact : public Fix {
   int allnattempt;
   tagint ***attempt;
 
+  bigint cand_laststep;    // # of neighbor builds when candidate pairs were last rebuilt
+  int *cand_any;           // per-rxn flag: any candidate pair on any proc
+  int any_limited;         // 0 once no atoms anywhere are limited post-reaction
+  std::vector<std::vector<int>> cand_pairs;    // per-rxn candidate atom-index pairs, flattened
+
   class Molecule *onemol;      // pre-reacted molecule template
   class Molecule *twomol;      // post-reacted molecule template
   Fix *fix1;                   // nve/limit used to relax reaction sites
@@ -209,6 +214,7 @@ class FixBondReact : public Fix {
   void readline(char *);
   void parse_keyword(int, char *, char *);
 
+  void build_candidates();
   void far_partner();
   void close_partner();
   void get_molxspecials();
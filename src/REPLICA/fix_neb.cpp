@@ -48,8 +48,10 @@ FixNEB::FixNEB(LAMMPS *lmp, int narg, char **arg) :
     Fix(lmp, narg, arg), id_pe(nullptr), pe(nullptr), nlenall(nullptr), vengall(nullptr),
     xprev(nullptr), xnext(nullptr), fnext(nullptr), springF(nullptr), tangent(nullptr),
     xsend(nullptr), xrecv(nullptr), fsend(nullptr), frecv(nullptr), tagsend(nullptr),
-    tagrecv(nullptr), xsendall(nullptr), xrecvall(nullptr), fsendall(nullptr), frecvall(nullptr),
-    tagsendall(nullptr), tagrecvall(nullptr), counts(nullptr), displacements(nullptr)
+    tagrecv(nullptr), xrecvnext(nullptr), tagrecvnext(nullptr), xsendall(nullptr),
+    xrecvall(nullptr), fsendall(nullptr), frecvall(nullptr), tagsendall(nullptr),
+    tagrecvall(nullptr), xrecvallnext(nullptr), tagrecvallnext(nullptr), counts(nullptr),
+    displacements(nullptr)
 {
 
   if (narg < 4) error->all(FLERR, "Illegal fix neb command");
@@ -190,6 +192,8 @@ FixNEB::~FixNEB()
   memory->destroy(frecv);
   memory->destroy(tagsend);
   memory->destroy(tagrecv);
+  memory->destroy(xrecvnext);
+  memory->destroy(tagrecvnext);
 
   memory->destroy(xsendall);
   memory->destroy(xrecvall);
@@ -197,6 +201,8 @@ FixNEB::~FixNEB()
   memory->destroy(frecvall);
   memory->destroy(tagsendall);
   memory->destroy(tagrecvall);
+  memory->destroy(xrecvallnext);
+  memory->destroy(tagrecvallnext);
 
   memory->destroy(counts);
   memory->destroy(displacements);
@@ -256,6 +262,8 @@ void FixNEB::init()
     memory->create(frecvall, ntotal, 3, "neb:frecvall");
     memory->create(tagsendall, ntotal, "neb:tagsendall");
     memory->create(tagrecvall, ntotal, "neb:tagrecvall");
+    memory->create(xrecvallnext, ntotal, 3, "neb:xrecvallnext");
+    memory->create(tagrecvallnext, ntotal, "neb:tagrecvallnext");
     memory->create(counts, nprocs, "neb:counts");
     memory->create(displacements, nprocs, "neb:displacements");
   }
@@ -282,13 +290,10 @@ void FixNEB::min_post_force(int /*vflag*/)
 
   vprev = vnext = veng = pe->compute_scalar();
 
-  if (ireplica < nreplica - 1 && me == 0) MPI_Send(&veng, 1, MPI_DOUBLE, procnext, 0, uworld);
-  if (ireplica > 0 && me == 0)
-    MPI_Recv(&vprev, 1, MPI_DOUBLE, procprev, 0, uworld, MPI_STATUS_IGNORE);
+  // communicate atoms and energies to/from adjacent replicas in one
+  // batched round to fill xprev,xnext,fnext,vprev,vnext
 
-  if (ireplica > 0 && me == 0) MPI_Send(&veng, 1, MPI_DOUBLE, procprev, 0, uworld);
-  if (ireplica < nreplica - 1 && me == 0)
-    MPI_Recv(&vnext, 1, MPI_DOUBLE, procnext, 0, uworld, MPI_STATUS_IGNORE);
+  inter_replica_comm(vprev, vnext);
 
   if (cmode == MULTI_PROC) {
     MPI_Bcast(&vprev, 1, MPI_DOUBLE, 0, world);
@@ -312,10 +317,6 @@ void FixNEB::min_post_force(int /*vflag*/)
 
   if (FreeEndIni && ireplica == 0 && (update->ntimestep == 0)) EIniIni = veng;
 
-  // communicate atoms to/from adjacent replicas to fill xprev,xnext
-
-  inter_replica_comm();
-
   // trigger potential energy computation on next timestep
 
   pe->addstep(update->ntimestep + 1);
@@ -598,17 +599,24 @@ void FixNEB::min_post_force(int /*vflag*/)
 }
 
 /* ----------------------------------------------------------------------
-   send/recv NEB atoms to/from adjacent replicas
+   send/recv NEB atoms and energies to/from adjacent replicas
    received atoms matching my local atoms are stored in xprev,xnext
+   received energies are stored in vprev,vnext (on root proc only for
+   multiple procs per replica)
    replicas 0 and N-1 send but do not receive any atoms
+   both directions and all quantities are exchanged in one nonblocking
+   round, so each minimization step pays a single message latency
 ------------------------------------------------------------------------- */
 
-void FixNEB::inter_replica_comm()
+void FixNEB::inter_replica_comm(double &vprev, double &vnext)
 {
   int i, m;
-  MPI_Request request;
-  MPI_Request requests[2];
-  MPI_Status statuses[2];
+  int nrequest = 0;
+  MPI_Request requests[14];
+
+  // message tags of the batched exchange
+
+  enum { TAGX, TAGF, TAGID, TAGENG };
 
   // reallocate memory if necessary
 
@@ -630,18 +638,23 @@ void FixNEB::inter_replica_comm()
   // direct comm of x -> xprev and x -> xnext
 
   if (cmode == SINGLE_PROC_DIRECT) {
-    if (ireplica > 0) MPI_Irecv(xprev[0], 3 * nlocal, MPI_DOUBLE, procprev, 0, uworld, &request);
-    if (ireplica < nreplica - 1) MPI_Send(x[0], 3 * nlocal, MPI_DOUBLE, procnext, 0, uworld);
-    if (ireplica > 0) MPI_Wait(&request, MPI_STATUS_IGNORE);
-    if (ireplica < nreplica - 1)
-      MPI_Irecv(xnext[0], 3 * nlocal, MPI_DOUBLE, procnext, 0, uworld, &request);
-    if (ireplica > 0) MPI_Send(x[0], 3 * nlocal, MPI_DOUBLE, procprev, 0, uworld);
-    if (ireplica < nreplica - 1) MPI_Wait(&request, MPI_STATUS_IGNORE);
-
-    if (ireplica < nreplica - 1)
-      MPI_Irecv(fnext[0], 3 * nlocal, MPI_DOUBLE, procnext, 0, uworld, &request);
-    if (ireplica > 0) MPI_Send(f[0], 3 * nlocal, MPI_DOUBLE, procprev, 0, uworld);
-    if (ireplica < nreplica - 1) MPI_Wait(&request, MPI_STATUS_IGNORE);
+    if (ireplica > 0) {
+      MPI_Irecv(xprev[0], 3 * nlocal, MPI_DOUBLE, procprev, TAGX, uworld, &requests[nrequest++]);
+      MPI_Irecv(&vprev, 1, MPI_DOUBLE, procprev, TAGENG, uworld, &requests[nrequest++]);
+    }
+    if (ireplica < nreplica - 1) {
+      MPI_Irecv(xnext[0], 3 * nlocal, MPI_DOUBLE, procnext, TAGX, uworld, &requests[nrequest++]);
+      MPI_Irecv(fnext[0], 3 * nlocal, MPI_DOUBLE, procnext, TAGF, uworld, &requests[nrequest++]);
+      MPI_Irecv(&vnext, 1, MPI_DOUBLE, procnext, TAGENG, uworld, &requests[nrequest++]);
+      MPI_Isend(x[0], 3 * nlocal, MPI_DOUBLE, procnext, TAGX, uworld, &requests[nrequest++]);
+      MPI_Isend(&veng, 1, MPI_DOUBLE, procnext, TAGENG, uworld, &requests[nrequest++]);
+    }
+    if (ireplica > 0) {
+      MPI_Isend(x[0], 3 * nlocal, MPI_DOUBLE, procprev, TAGX, uworld, &requests[nrequest++]);
+      MPI_Isend(f[0], 3 * nlocal, MPI_DOUBLE, procprev, TAGF, uworld, &requests[nrequest++]);
+      MPI_Isend(&veng, 1, MPI_DOUBLE, procprev, TAGENG, uworld, &requests[nrequest++]);
+    }
+    MPI_Waitall(nrequest, requests, MPI_STATUSES_IGNORE);
 
     return;
   }
@@ -666,53 +679,51 @@ void FixNEB::inter_replica_comm()
       }
 
     if (ireplica > 0) {
-      MPI_Irecv(xrecv[0], 3 * nebatoms, MPI_DOUBLE, procprev, 0, uworld, &requests[0]);
-      MPI_Irecv(tagrecv, nebatoms, MPI_LMP_TAGINT, procprev, 0, uworld, &requests[1]);
+      MPI_Irecv(xrecv[0], 3 * nebatoms, MPI_DOUBLE, procprev, TAGX, uworld, &requests[nrequest++]);
+      MPI_Irecv(tagrecv, nebatoms, MPI_LMP_TAGINT, procprev, TAGID, uworld, &requests[nrequest++]);
+      MPI_Irecv(&vprev, 1, MPI_DOUBLE, procprev, TAGENG, uworld, &requests[nrequest++]);
+      MPI_Isend(xsend[0], 3 * nebatoms, MPI_DOUBLE, procprev, TAGX, uworld, &requests[nrequest++]);
+      MPI_Isend(fsend[0], 3 * nebatoms, MPI_DOUBLE, procprev, TAGF, uworld, &requests[nrequest++]);
+      MPI_Isend(tagsend, nebatoms, MPI_LMP_TAGINT, procprev, TAGID, uworld, &requests[nrequest++]);
+      MPI_Isend(&veng, 1, MPI_DOUBLE, procprev, TAGENG, uworld, &requests[nrequest++]);
     }
     if (ireplica < nreplica - 1) {
-      MPI_Send(xsend[0], 3 * nebatoms, MPI_DOUBLE, procnext, 0, uworld);
-      MPI_Send(tagsend, nebatoms, MPI_LMP_TAGINT, procnext, 0, uworld);
+      MPI_Irecv(xrecvnext[0], 3 * nebatoms, MPI_DOUBLE, procnext, TAGX, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(frecv[0], 3 * nebatoms, MPI_DOUBLE, procnext, TAGF, uworld, &requests[nrequest++]);
+      MPI_Irecv(tagrecvnext, nebatoms, MPI_LMP_TAGINT, procnext, TAGID, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(&vnext, 1, MPI_DOUBLE, procnext, TAGENG, uworld, &requests[nrequest++]);
+      MPI_Isend(xsend[0], 3 * nebatoms, MPI_DOUBLE, procnext, TAGX, uworld, &requests[nrequest++]);
+      MPI_Isend(tagsend, nebatoms, MPI_LMP_TAGINT, procnext, TAGID, uworld, &requests[nrequest++]);
+      MPI_Isend(&veng, 1, MPI_DOUBLE, procnext, TAGENG, uworld, &requests[nrequest++]);
     }
+    MPI_Waitall(nrequest, requests, MPI_STATUSES_IGNORE);
 
-    if (ireplica > 0) {
-      MPI_Waitall(2, requests, statuses);
+    if (ireplica > 0)
       for (i = 0; i < nebatoms; i++) {
         m = atom->map(tagrecv[i]);
         xprev[m][0] = xrecv[i][0];
         xprev[m][1] = xrecv[i][1];
         xprev[m][2] = xrecv[i][2];
       }
-    }
-    if (ireplica < nreplica - 1) {
-      MPI_Irecv(xrecv[0], 3 * nebatoms, MPI_DOUBLE, procnext, 0, uworld, &requests[0]);
-      MPI_Irecv(frecv[0], 3 * nebatoms, MPI_DOUBLE, procnext, 0, uworld, &requests[0]);
-      MPI_Irecv(tagrecv, nebatoms, MPI_LMP_TAGINT, procnext, 0, uworld, &requests[1]);
-    }
-    if (ireplica > 0) {
-      MPI_Send(xsend[0], 3 * nebatoms, MPI_DOUBLE, procprev, 0, uworld);
-      MPI_Send(fsend[0], 3 * nebatoms, MPI_DOUBLE, procprev, 0, uworld);
-      MPI_Send(tagsend, nebatoms, MPI_LMP_TAGINT, procprev, 0, uworld);
-    }
-
-    if (ireplica < nreplica - 1) {
-      MPI_Waitall(2, requests, statuses);
+    if (ireplica < nreplica - 1)
       for (i = 0; i < nebatoms; i++) {
-        m = atom->map(tagrecv[i]);
-        xnext[m][0] = xrecv[i][0];
-        xnext[m][1] = xrecv[i][1];
-        xnext[m][2] = xrecv[i][2];
+        m = atom->map(tagrecvnext[i]);
+        xnext[m][0] = xrecvnext[i][0];
+        xnext[m][1] = xrecvnext[i][1];
+        xnext[m][2] = xrecvnext[i][2];
         fnext[m][0] = frecv[i][0];
         fnext[m][1] = frecv[i][1];
         fnext[m][2] = frecv[i][2];
       }
-    }
 
     return;
   }
 
   // multiple procs per replica
   // MPI_Gather all coords and atom IDs to root proc of each replica
-  // send to root of adjacent replicas
+  // exchange with roots of adjacent replicas
   // bcast within each replica
   // each proc extracts info for atoms it owns via atom->map()
 
@@ -748,19 +759,40 @@ void FixNEB::inter_replica_comm()
                 world);
   }
 
-  if (ireplica > 0 && me == 0) {
-    MPI_Irecv(xrecvall[0], 3 * nebatoms, MPI_DOUBLE, procprev, 0, uworld, &requests[0]);
-    MPI_Irecv(tagrecvall, nebatoms, MPI_LMP_TAGINT, procprev, 0, uworld, &requests[1]);
-  }
-  if (ireplica < nreplica - 1 && me == 0) {
-    MPI_Send(xsendall[0], 3 * nebatoms, MPI_DOUBLE, procnext, 0, uworld);
-    MPI_Send(tagsendall, nebatoms, MPI_LMP_TAGINT, procnext, 0, uworld);
+  if (me == 0) {
+    if (ireplica > 0) {
+      MPI_Irecv(xrecvall[0], 3 * nebatoms, MPI_DOUBLE, procprev, TAGX, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(tagrecvall, nebatoms, MPI_LMP_TAGINT, procprev, TAGID, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(&vprev, 1, MPI_DOUBLE, procprev, TAGENG, uworld, &requests[nrequest++]);
+      MPI_Isend(xsendall[0], 3 * nebatoms, MPI_DOUBLE, procprev, TAGX, uworld,
+                &requests[nrequest++]);
+      MPI_Isend(fsendall[0], 3 * nebatoms, MPI_DOUBLE, procprev, TAGF, uworld,
+                &requests[nrequest++]);
+      MPI_Isend(tagsendall, nebatoms, MPI_LMP_TAGINT, procprev, TAGID, uworld,
+                &requests[nrequest++]);
+      MPI_Isend(&veng, 1, MPI_DOUBLE, procprev, TAGENG, uworld, &requests[nrequest++]);
+    }
+    if (ireplica < nreplica - 1) {
+      MPI_Irecv(xrecvallnext[0], 3 * nebatoms, MPI_DOUBLE, procnext, TAGX, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(frecvall[0], 3 * nebatoms, MPI_DOUBLE, procnext, TAGF, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(tagrecvallnext, nebatoms, MPI_LMP_TAGINT, procnext, TAGID, uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(&vnext, 1, MPI_DOUBLE, procnext, TAGENG, uworld, &requests[nrequest++]);
+      MPI_Isend(xsendall[0], 3 * nebatoms, MPI_DOUBLE, procnext, TAGX, uworld,
+                &requests[nrequest++]);
+      MPI_Isend(tagsendall, nebatoms, MPI_LMP_TAGINT, procnext, TAGID, uworld,
+                &requests[nrequest++]);
+      MPI_Isend(&veng, 1, MPI_DOUBLE, procnext, TAGENG, uworld, &requests[nrequest++]);
+    }
+    MPI_Waitall(nrequest, requests, MPI_STATUSES_IGNORE);
   }
 
   if (ireplica > 0) {
-    if (me == 0) MPI_Waitall(2, requests, statuses);
-
-    MPI_Bcast(tagrecvall, nebatoms, MPI_INT, 0, world);
+    MPI_Bcast(tagrecvall, nebatoms, MPI_LMP_TAGINT, 0, world);
     MPI_Bcast(xrecvall[0], 3 * nebatoms, MPI_DOUBLE, 0, world);
 
     for (i = 0; i < nebatoms; i++) {
@@ -772,30 +804,17 @@ void FixNEB::inter_replica_comm()
     }
   }
 
-  if (ireplica < nreplica - 1 && me == 0) {
-    MPI_Irecv(xrecvall[0], 3 * nebatoms, MPI_DOUBLE, procnext, 0, uworld, &requests[0]);
-    MPI_Irecv(frecvall[0], 3 * nebatoms, MPI_DOUBLE, procnext, 0, uworld, &requests[0]);
-    MPI_Irecv(tagrecvall, nebatoms, MPI_LMP_TAGINT, procnext, 0, uworld, &requests[1]);
-  }
-  if (ireplica > 0 && me == 0) {
-    MPI_Send(xsendall[0], 3 * nebatoms, MPI_DOUBLE, procprev, 0, uworld);
-    MPI_Send(fsendall[0], 3 * nebatoms, MPI_DOUBLE, procprev, 0, uworld);
-    MPI_Send(tagsendall, nebatoms, MPI_LMP_TAGINT, procprev, 0, uworld);
-  }
-
   if (ireplica < nreplica - 1) {
-    if (me == 0) MPI_Waitall(2, requests, statuses);
-
-    MPI_Bcast(tagrecvall, nebatoms, MPI_INT, 0, world);
-    MPI_Bcast(xrecvall[0], 3 * nebatoms, MPI_DOUBLE, 0, world);
+    MPI_Bcast(tagrecvallnext, nebatoms, MPI_LMP_TAGINT, 0, world);
+    MPI_Bcast(xrecvallnext[0], 3 * nebatoms, MPI_DOUBLE, 0, world);
     MPI_Bcast(frecvall[0], 3 * nebatoms, MPI_DOUBLE, 0, world);
 
     for (i = 0; i < nebatoms; i++) {
-      m = atom->map(tagrecvall[i]);
+      m = atom->map(tagrecvallnext[i]);
       if (m < 0 || m >= nlocal) continue;
-      xnext[m][0] = xrecvall[i][0];
-      xnext[m][1] = xrecvall[i][1];
-      xnext[m][2] = xrecvall[i][2];
+      xnext[m][0] = xrecvallnext[i][0];
+      xnext[m][1] = xrecvallnext[i][1];
+      xnext[m][2] = xrecvallnext[i][2];
       fnext[m][0] = frecvall[i][0];
       fnext[m][1] = frecvall[i][1];
       fnext[m][2] = frecvall[i][2];
@@ -891,6 +910,10 @@ void FixNEB::reallocate()
     memory->create(frecv, maxlocal, 3, "neb:frecv");
     memory->create(tagsend, maxlocal, "neb:tagsend");
     memory->create(tagrecv, maxlocal, "neb:tagrecv");
+    memory->destroy(xrecvnext);
+    memory->destroy(tagrecvnext);
+    memory->create(xrecvnext, maxlocal, 3, "neb:xrecvnext");
+    memory->create(tagrecvnext, maxlocal, "neb:tagrecvnext");
   }
 
   if ((neb_mode == IDEAL) || (neb_mode == EQUAL)) {
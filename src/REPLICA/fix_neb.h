@@ -59,15 +59,19 @@ class FixNEB : public Fix {
   double **xsend, **xrecv;      // coords to send/recv to/from other replica
   double **fsend, **frecv;      // coords to send/recv to/from other replica
   tagint *tagsend, *tagrecv;    // ditto for atom IDs
+  double **xrecvnext;           // coords recv'd from next replica, so both
+  tagint *tagrecvnext;          //   directions can be in flight at once
 
   // info gathered from all procs in my replica
   double **xsendall, **xrecvall;      // coords to send/recv to/from other replica
   double **fsendall, **frecvall;      // force to send/recv to/from other replica
   tagint *tagsendall, *tagrecvall;    // ditto for atom IDs
+  double **xrecvallnext;              // ditto for the next-replica direction
+  tagint *tagrecvallnext;
 
   int *counts, *displacements;    // used for MPI_Gather
 
-  void inter_replica_comm();
+  void inter_replica_comm(double &, double &);
   void calculate_ideal_positions();
   void reallocate();
 };
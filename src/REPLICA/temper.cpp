@@ -205,9 +205,20 @@ void Temper::command(int narg, char **arg)
         fprintf(universe->ulogfile," T%d",i);
       fprintf(universe->ulogfile,"\n");
     }
-    print_status();
+    print_status(update->ntimestep);
   }
 
+  // swap outcomes are published asynchronously:
+  // the allgather of the new temp assignments across root procs is posted
+  // nonblocking right after each swap and only completed just before the
+  // next partner selection, so the universe-wide synchronization overlaps
+  // with the next nevery-step segment and a slow replica does not stall
+  // the others at the end of every segment
+
+  int temp_pending = 0;
+  bigint status_step = update->ntimestep;
+  MPI_Request temp_request;
+
   timer->init();
   timer->barrier_start();
 
@@ -219,15 +230,18 @@ void Temper::command(int narg, char **arg)
     update->integrate->run(nevery);
 
     // check for timeout across all procs
+    // posted nonblocking so it overlaps with the PE computation below
 
     int my_timeout=0;
     int any_timeout=0;
     if (timer->is_timeout()) my_timeout=1;
+#if defined(MPI_STUBS)
     MPI_Allreduce(&my_timeout, &any_timeout, 1, MPI_INT, MPI_SUM, universe->uworld);
-    if (any_timeout) {
-      timer->force_timeout();
-      break;
-    }
+#else
+    MPI_Request timeout_request;
+    MPI_Iallreduce(&my_timeout, &any_timeout, 1, MPI_INT, MPI_SUM, universe->uworld,
+                   &timeout_request);
+#endif
 
     // compute PE
     // notify compute it will be called at next swap
@@ -235,6 +249,29 @@ void Temper::command(int narg, char **arg)
     pe = pe_compute->compute_scalar();
     pe_compute->addstep(update->ntimestep + nevery);
 
+#if !defined(MPI_STUBS)
+    MPI_Wait(&timeout_request,MPI_STATUS_IGNORE);
+#endif
+    if (any_timeout) {
+      timer->force_timeout();
+      break;
+    }
+
+    // complete the allgather of temp assignments from the previous swap
+    // rebuild temp2world, publish within my world, print deferred status
+
+    if (temp_pending) {
+      if (me == 0) {
+#if !defined(MPI_STUBS)
+        MPI_Wait(&temp_request,MPI_STATUS_IGNORE);
+#endif
+        for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+      }
+      MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+      if (me_universe == 0) print_status(status_step);
+      temp_pending = 0;
+    }
+
     // which = which of 2 kinds of swaps to do (0,1)
 
     if (!ranswap) which = iswap % 2;
@@ -308,21 +345,35 @@ void Temper::command(int narg, char **arg)
       whichfix->reset_target(new_temp);
     }
 
-    // update my_set_temp and temp2world on every proc
-    // root procs update their value if swap took place
-    // allgather across root procs
-    // bcast within my world
+    // update my_set_temp, then post the allgather of the new assignments
+    // across root procs without waiting for it
+    // temp2world rebuild, bcast within my world, and status printout are
+    // deferred until just before the next partner selection
+    // my_set_temp is not modified again before the request completes
 
     if (swap) my_set_temp = partner_set_temp;
     if (me == 0) {
+#if defined(MPI_STUBS)
       MPI_Allgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots);
-      for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+#else
+      MPI_Iallgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots,&temp_request);
+#endif
     }
-    MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+    status_step = update->ntimestep;
+    temp_pending = 1;
+  }
 
-    // print out current swap status
+  // complete any outstanding swap publication and print final status
 
-    if (me_universe == 0) print_status();
+  if (temp_pending) {
+    if (me == 0) {
+#if !defined(MPI_STUBS)
+      MPI_Wait(&temp_request,MPI_STATUS_IGNORE);
+#endif
+      for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+    }
+    MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+    if (me_universe == 0) print_status(status_step);
   }
 
   timer->barrier_stop();
@@ -356,12 +407,12 @@ void Temper::scale_velocities(int t_partner, int t_me)
 }
 
 /* ----------------------------------------------------------------------
-   proc 0 prints current tempering status
+   proc 0 prints tempering status for the swap attempted at step
 ------------------------------------------------------------------------- */
 
-void Temper::print_status()
+void Temper::print_status(bigint step)
 {
-  std::string status = std::to_string(update->ntimestep);
+  std::string status = std::to_string(step);
   for (int i = 0; i < nworlds; i++)
     status += " " + std::to_string(world2temp[i]);
 
@@ -49,7 +49,7 @@ class Temper : public Command {
   int *world2root;     // world2root[i] = root proc of world i
 
   void scale_velocities(int, int);
-  void print_status();
+  void print_status(bigint);
 };
 
 }    // namespace LAMMPS_NS
@@ -504,9 +504,11 @@ void FixRigidNHSmall::initial_integrate(int vflag)
   }
 
   // forward communicate updated info of all bodies
+  // overlap the exchange with the thermostat/barostat updates below,
+  //   which only use bodies this proc owns
 
   commflag = INITIAL;
-  comm->forward_comm(this,29);
+  comm->forward_comm_start(this,29);
 
   // accumulate translational and rotational kinetic energies
 
@@ -546,6 +548,10 @@ void FixRigidNHSmall::initial_integrate(int vflag)
     nhc_press_integrate();
   }
 
+  // complete body exchange before remap() rescales ghost body xcm
+
+  comm->forward_comm_finish(this);
+
   // virial setup before call to set_xv
 
   v_init(vflag);
@@ -652,9 +658,11 @@ void FixRigidNHSmall::final_integrate()
   }
 
   // forward communicate updated info of all bodies
+  // overlap the exchange with the kinetic energy accumulation and
+  //   with atoms of bodies this proc owns
 
   commflag = FINAL;
-  comm->forward_comm(this,10);
+  comm->forward_comm_start(this,10);
 
   // accumulate translational and rotational kinetic energies
 
@@ -680,7 +688,9 @@ void FixRigidNHSmall::final_integrate()
   // set velocity/rotation of atoms in rigid bodies
   // virial is already setup from initial_integrate
 
-  set_v();
+  set_v(BODY_OWNED);
+  comm->forward_comm_finish(this);
+  set_v(BODY_GHOST);
 
   // compute current temperature
   if (tcomputeflag) t_current = temperature->compute_scalar();
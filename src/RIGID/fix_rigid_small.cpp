@@ -770,13 +770,17 @@ void FixRigidSmall::initial_integrate(int vflag)
   v_init(vflag);
 
   // forward communicate updated info of all bodies
+  // overlap the exchange with atoms of bodies this proc owns,
+  //   whose updated info is already available
 
   commflag = INITIAL;
-  comm->forward_comm(this,29);
+  comm->forward_comm_start(this,29);
 
   // set coords/orient and velocity/rotation of atoms in rigid bodies
 
-  set_xv();
+  set_xv(BODY_OWNED);
+  comm->forward_comm_finish(this);
+  set_xv(BODY_GHOST);
 }
 
 /* ----------------------------------------------------------------------
@@ -863,14 +867,18 @@ void FixRigidSmall::final_integrate()
   }
 
   // forward communicate updated info of all bodies
+  // overlap the exchange with atoms of bodies this proc owns,
+  //   whose updated info is already available
 
   commflag = FINAL;
-  comm->forward_comm(this,10);
+  comm->forward_comm_start(this,10);
 
   // set velocity/rotation of atoms in rigid bodies
   // virial is already setup from initial_integrate
 
-  set_v();
+  set_v(BODY_OWNED);
+  comm->forward_comm_finish(this);
+  set_v(BODY_GHOST);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -1237,9 +1245,11 @@ void FixRigidSmall::deform(int flag)
    set orientation and rotation of extended particles
    x = Q displace + Xcm, mapped back to periodic box
    v = Vcm + (W cross (x - Xcm))
+   bodyflag restricts the update to atoms of owned or ghost bodies,
+     so owned-body atoms can be set while body comm is still in flight
 ------------------------------------------------------------------------- */
 
-void FixRigidSmall::set_xv()
+void FixRigidSmall::set_xv(int bodyflag)
 {
   int xbox,ybox,zbox;
   double x0,x1,x2,v0,v1,v2,fc0,fc1,fc2,massone;
@@ -1260,10 +1270,13 @@ void FixRigidSmall::set_xv()
   int *type = atom->type;
   int nlocal = atom->nlocal;
 
+  int firstbody = (bodyflag == BODY_GHOST) ? nlocal_body : 0;
+  int lastbody = (bodyflag == BODY_OWNED) ? nlocal_body : nlocal_body + nghost_body;
+
   // set x and v of each atom
 
   for (int i = 0; i < nlocal; i++) {
-    if (atom2body[i] < 0) continue;
+    if (atom2body[i] < firstbody || atom2body[i] >= lastbody) continue;
     Body *b = &body[atom2body[i]];
 
     xbox = (xcmimage[i] & IMGMASK) - IMGMAX;
@@ -1344,7 +1357,7 @@ void FixRigidSmall::set_xv()
 
   // update the position of geometric center
 
-  for (int ibody = 0; ibody < nlocal_body + nghost_body; ibody++) {
+  for (int ibody = firstbody; ibody < lastbody; ibody++) {
     Body *b = &body[ibody];
     MathExtra::matvec(b->ex_space,b->ey_space,b->ez_space,
                       b->xgc_body,b->xgc);
@@ -1373,7 +1386,7 @@ void FixRigidSmall::set_xv()
     int *tri = atom->tri;
 
     for (int i = 0; i < nlocal; i++) {
-      if (atom2body[i] < 0) continue;
+      if (atom2body[i] < firstbody || atom2body[i] >= lastbody) continue;
       Body *b = &body[atom2body[i]];
 
       if (eflags[i] & SPHERE) {
@@ -1422,9 +1435,11 @@ void FixRigidSmall::set_xv()
    set space-frame velocity of each atom in a rigid body
    set omega and angmom of extended particles
    v = Vcm + (W cross (x - Xcm))
+   bodyflag restricts the update to atoms of owned or ghost bodies,
+     so owned-body atoms can be set while body comm is still in flight
 ------------------------------------------------------------------------- */
 
-void FixRigidSmall::set_v()
+void FixRigidSmall::set_v(int bodyflag)
 {
   int xbox,ybox,zbox;
   double x0,x1,x2,v0,v1,v2,fc0,fc1,fc2,massone;
@@ -1445,10 +1460,13 @@ void FixRigidSmall::set_v()
   int *type = atom->type;
   int nlocal = atom->nlocal;
 
+  int firstbody = (bodyflag == BODY_GHOST) ? nlocal_body : 0;
+  int lastbody = (bodyflag == BODY_OWNED) ? nlocal_body : nlocal_body + nghost_body;
+
   // set v of each atom
 
   for (int i = 0; i < nlocal; i++) {
-    if (atom2body[i] < 0) continue;
+    if (atom2body[i] < firstbody || atom2body[i] >= lastbody) continue;
     Body *b = &body[atom2body[i]];
 
     MathExtra::matvec(b->ex_space,b->ey_space,b->ez_space,displace[i],delta);
@@ -1525,7 +1543,7 @@ void FixRigidSmall::set_v()
     int *tri = atom->tri;
 
     for (int i = 0; i < nlocal; i++) {
-      if (atom2body[i] < 0) continue;
+      if (atom2body[i] < firstbody || atom2body[i] >= lastbody) continue;
       Body *b = &body[atom2body[i]];
 
       if (eflags[i] & SPHERE) {
@@ -191,11 +191,16 @@ class FixRigidSmall : public Fix {
     tagint atomID;
   };
 
+  // which bodies a set_xv() or set_v() call operates on
+  // owned-body atoms can be updated while ghost body comm is in flight
+
+  enum { BODY_OWNED, BODY_GHOST, BODY_ALL };
+
   // local methods
 
   void image_shift();
-  void set_xv();
-  void set_v();
+  void set_xv(int bodyflag = BODY_ALL);
+  void set_v(int bodyflag = BODY_ALL);
   void create_bodies(tagint *);
   void setup_bodies_static();
   void setup_bodies_dynamic();
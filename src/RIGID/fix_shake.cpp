@@ -45,6 +45,10 @@ static constexpr int RVOUS = 1;    // 0 for irregular, 1 for all2all
 static constexpr double BIG = 1.0e20;
 static constexpr double MASSDELTA = 0.1;
 
+// # of 3-atom angle clusters solved in lockstep by shake3angle_block()
+
+static constexpr int SHAKEBLOCK = 64;
+
 /* ---------------------------------------------------------------------- */
 
 FixShake::FixShake(LAMMPS *lmp, int narg, char **arg) :
@@ -670,15 +674,26 @@ void FixShake::post_force(int vflag)
   ebond = 0.0;
 
   // loop over clusters to add constraint forces
+  // 3-atom angle clusters (the common rigid water case) are gathered
+  //   into blocks and solved in lockstep across clusters
 
   int m;
+  int nblock = 0;
+  int iblock[SHAKEBLOCK];
   for (int i = 0; i < nlist; i++) {
     m = list[i];
     if (shake_flag[m] == 2) shake(i);
     else if (shake_flag[m] == 3) shake3(i);
     else if (shake_flag[m] == 4) shake4(i);
-    else shake3angle(i);
+    else {
+      iblock[nblock++] = i;
+      if (nblock == SHAKEBLOCK) {
+        shake3angle_block(nblock,iblock);
+        nblock = 0;
+      }
+    }
   }
+  if (nblock) shake3angle_block(nblock,iblock);
 
   // store vflag for coordinate_constraints_end_of_step()
 
@@ -718,15 +733,26 @@ void FixShake::post_force_respa(int vflag, int ilevel, int iloop)
   else evflag = 0;
 
   // loop over clusters to add constraint forces
+  // 3-atom angle clusters (the common rigid water case) are gathered
+  //   into blocks and solved in lockstep across clusters
 
   int m;
+  int nblock = 0;
+  int iblock[SHAKEBLOCK];
   for (int i = 0; i < nlist; i++) {
     m = list[i];
     if (shake_flag[m] == 2) shake(i);
     else if (shake_flag[m] == 3) shake3(i);
     else if (shake_flag[m] == 4) shake4(i);
-    else shake3angle(i);
+    else {
+      iblock[nblock++] = i;
+      if (nblock == SHAKEBLOCK) {
+        shake3angle_block(nblock,iblock);
+        nblock = 0;
+      }
+    }
   }
+  if (nblock) shake3angle_block(nblock,iblock);
 
   // store vflag for coordinate_constraints_end_of_step()
   vflag_post_force = vflag;
@@ -2331,245 +2357,293 @@ void FixShake::shake4(int ilist)
 }
 
 /* ----------------------------------------------------------------------
-   calculate SHAKE constraint forces for size 3 cluster = two bonds + angle
+   calculate SHAKE constraint forces for size 3 clusters = two bonds + angle
+   solves a block of clusters in lockstep: the per-cluster setup, the
+     iteration on the lamda equations, and the force update each loop
+     over the whole block, so the compiler can vectorize across clusters
+   per-cluster arithmetic is identical to solving each cluster alone:
+     a converged cluster is frozen while the rest of the block iterates
 ------------------------------------------------------------------------- */
 
-void FixShake::shake3angle(int ilist)
+void FixShake::shake3angle_block(int nb, const int *ilist)
 {
-  int atomlist[3];
-  double v[6];
+  int k,m;
   double invmass0,invmass1,invmass2;
 
-  // local atom IDs and constraint distances
-
-  int m = list[ilist];
-  int i0 = closest_list[ilist][0];
-  int i1 = closest_list[ilist][1];
-  int i2 = closest_list[ilist][2];
-  double bond1 = bond_distance[shake_type[m][0]];
-  double bond2 = bond_distance[shake_type[m][1]];
-  double bond12 = angle_distance[shake_type[m][2]];
-
-  // r01,r02,r12 = distance vec between atoms
-
-  double r01[3];
-  r01[0] = x[i0][0] - x[i1][0];
-  r01[1] = x[i0][1] - x[i1][1];
-  r01[2] = x[i0][2] - x[i1][2];
-
-  double r02[3];
-  r02[0] = x[i0][0] - x[i2][0];
-  r02[1] = x[i0][1] - x[i2][1];
-  r02[2] = x[i0][2] - x[i2][2];
-
-  double r12[3];
-  r12[0] = x[i1][0] - x[i2][0];
-  r12[1] = x[i1][1] - x[i2][1];
-  r12[2] = x[i1][2] - x[i2][2];
-
-  // s01,s02,s12 = distance vec after unconstrained update
-
-  double s01[3];
-  s01[0] = xshake[i0][0] - xshake[i1][0];
-  s01[1] = xshake[i0][1] - xshake[i1][1];
-  s01[2] = xshake[i0][2] - xshake[i1][2];
-
-  double s02[3];
-  s02[0] = xshake[i0][0] - xshake[i2][0];
-  s02[1] = xshake[i0][1] - xshake[i2][1];
-  s02[2] = xshake[i0][2] - xshake[i2][2];
-
-  double s12[3];
-  s12[0] = xshake[i1][0] - xshake[i2][0];
-  s12[1] = xshake[i1][1] - xshake[i2][1];
-  s12[2] = xshake[i1][2] - xshake[i2][2];
-
-  // scalar distances between atoms
-
-  double r01sq = r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2];
-  double r02sq = r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2];
-  double r12sq = r12[0]*r12[0] + r12[1]*r12[1] + r12[2]*r12[2];
-  double s01sq = s01[0]*s01[0] + s01[1]*s01[1] + s01[2]*s01[2];
-  double s02sq = s02[0]*s02[0] + s02[1]*s02[1] + s02[2]*s02[2];
-  double s12sq = s12[0]*s12[0] + s12[1]*s12[1] + s12[2]*s12[2];
-
-  // matrix coeffs and rhs for lamda equations
-
-  if (rmass) {
-    invmass0 = 1.0/rmass[i0];
-    invmass1 = 1.0/rmass[i1];
-    invmass2 = 1.0/rmass[i2];
-  } else {
-    invmass0 = 1.0/mass[type[i0]];
-    invmass1 = 1.0/mass[type[i1]];
-    invmass2 = 1.0/mass[type[i2]];
-  }
-
-  double a11 = 2.0 * (invmass0+invmass1) *
-    (s01[0]*r01[0] + s01[1]*r01[1] + s01[2]*r01[2]);
-  double a12 = 2.0 * invmass0 *
-    (s01[0]*r02[0] + s01[1]*r02[1] + s01[2]*r02[2]);
-  double a13 = - 2.0 * invmass1 *
-    (s01[0]*r12[0] + s01[1]*r12[1] + s01[2]*r12[2]);
-  double a21 = 2.0 * invmass0 *
-    (s02[0]*r01[0] + s02[1]*r01[1] + s02[2]*r01[2]);
-  double a22 = 2.0 * (invmass0+invmass2) *
-    (s02[0]*r02[0] + s02[1]*r02[1] + s02[2]*r02[2]);
-  double a23 = 2.0 * invmass2 *
-    (s02[0]*r12[0] + s02[1]*r12[1] + s02[2]*r12[2]);
-  double a31 = - 2.0 * invmass1 *
-    (s12[0]*r01[0] + s12[1]*r01[1] + s12[2]*r01[2]);
-  double a32 = 2.0 * invmass2 *
-    (s12[0]*r02[0] + s12[1]*r02[1] + s12[2]*r02[2]);
-  double a33 = 2.0 * (invmass1+invmass2) *
-    (s12[0]*r12[0] + s12[1]*r12[1] + s12[2]*r12[2]);
-
-  // inverse of matrix
-
-  double determ = a11*a22*a33 + a12*a23*a31 + a13*a21*a32 -
-    a11*a23*a32 - a12*a21*a33 - a13*a22*a31;
-  if (determ == 0.0) error->one(FLERR,"Shake determinant = 0.0");
-  double determinv = 1.0/determ;
-
-  double a11inv = determinv * (a22*a33 - a23*a32);
-  double a12inv = -determinv * (a12*a33 - a13*a32);
-  double a13inv = determinv * (a12*a23 - a13*a22);
-  double a21inv = -determinv * (a21*a33 - a23*a31);
-  double a22inv = determinv * (a11*a33 - a13*a31);
-  double a23inv = -determinv * (a11*a23 - a13*a21);
-  double a31inv = determinv * (a21*a32 - a22*a31);
-  double a32inv = -determinv * (a11*a32 - a12*a31);
-  double a33inv = determinv * (a11*a22 - a12*a21);
-
-  // quadratic correction coeffs
-
-  double r0102 = (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
-  double r0112 = (r01[0]*r12[0] + r01[1]*r12[1] + r01[2]*r12[2]);
-  double r0212 = (r02[0]*r12[0] + r02[1]*r12[1] + r02[2]*r12[2]);
-
-  double quad1_0101 = (invmass0+invmass1)*(invmass0+invmass1) * r01sq;
-  double quad1_0202 = invmass0*invmass0 * r02sq;
-  double quad1_1212 = invmass1*invmass1 * r12sq;
-  double quad1_0102 = 2.0 * (invmass0+invmass1)*invmass0 * r0102;
-  double quad1_0112 = - 2.0 * (invmass0+invmass1)*invmass1 * r0112;
-  double quad1_0212 = - 2.0 * invmass0*invmass1 * r0212;
-
-  double quad2_0101 = invmass0*invmass0 * r01sq;
-  double quad2_0202 = (invmass0+invmass2)*(invmass0+invmass2) * r02sq;
-  double quad2_1212 = invmass2*invmass2 * r12sq;
-  double quad2_0102 = 2.0 * (invmass0+invmass2)*invmass0 * r0102;
-  double quad2_0112 = 2.0 * invmass0*invmass2 * r0112;
-  double quad2_0212 = 2.0 * (invmass0+invmass2)*invmass2 * r0212;
-
-  double quad3_0101 = invmass1*invmass1 * r01sq;
-  double quad3_0202 = invmass2*invmass2 * r02sq;
-  double quad3_1212 = (invmass1+invmass2)*(invmass1+invmass2) * r12sq;
-  double quad3_0102 = - 2.0 * invmass1*invmass2 * r0102;
-  double quad3_0112 = - 2.0 * (invmass1+invmass2)*invmass1 * r0112;
-  double quad3_0212 = 2.0 * (invmass1+invmass2)*invmass2 * r0212;
-
-  // iterate until converged
+  // SoA staging of per-cluster quantities, one lane per cluster
+
+  int i0[SHAKEBLOCK],i1[SHAKEBLOCK],i2[SHAKEBLOCK];
+  double r01[3][SHAKEBLOCK],r02[3][SHAKEBLOCK],r12[3][SHAKEBLOCK];
+  double s01sq[SHAKEBLOCK],s02sq[SHAKEBLOCK],s12sq[SHAKEBLOCK];
+  double bond1sq[SHAKEBLOCK],bond2sq[SHAKEBLOCK],bond12sq[SHAKEBLOCK];
+  double ainv[9][SHAKEBLOCK];
+  double quad1c[6][SHAKEBLOCK],quad2c[6][SHAKEBLOCK],quad3c[6][SHAKEBLOCK];
+  double determ[SHAKEBLOCK];
+  double lamda01[SHAKEBLOCK],lamda02[SHAKEBLOCK],lamda12[SHAKEBLOCK];
+  int done[SHAKEBLOCK];
+
+  // setup: gather atoms and precompute matrix inverse and quadratic
+  //   correction coeffs of each cluster
+
+  for (k = 0; k < nb; k++) {
+
+    // local atom IDs and constraint distances
+
+    m = list[ilist[k]];
+    i0[k] = closest_list[ilist[k]][0];
+    i1[k] = closest_list[ilist[k]][1];
+    i2[k] = closest_list[ilist[k]][2];
+    double bond1 = bond_distance[shake_type[m][0]];
+    double bond2 = bond_distance[shake_type[m][1]];
+    double bond12 = angle_distance[shake_type[m][2]];
+    bond1sq[k] = bond1*bond1;
+    bond2sq[k] = bond2*bond2;
+    bond12sq[k] = bond12*bond12;
+
+    // r01,r02,r12 = distance vec between atoms
+
+    r01[0][k] = x[i0[k]][0] - x[i1[k]][0];
+    r01[1][k] = x[i0[k]][1] - x[i1[k]][1];
+    r01[2][k] = x[i0[k]][2] - x[i1[k]][2];
+
+    r02[0][k] = x[i0[k]][0] - x[i2[k]][0];
+    r02[1][k] = x[i0[k]][1] - x[i2[k]][1];
+    r02[2][k] = x[i0[k]][2] - x[i2[k]][2];
+
+    r12[0][k] = x[i1[k]][0] - x[i2[k]][0];
+    r12[1][k] = x[i1[k]][1] - x[i2[k]][1];
+    r12[2][k] = x[i1[k]][2] - x[i2[k]][2];
+
+    // s01,s02,s12 = distance vec after unconstrained update
+
+    double s01[3];
+    s01[0] = xshake[i0[k]][0] - xshake[i1[k]][0];
+    s01[1] = xshake[i0[k]][1] - xshake[i1[k]][1];
+    s01[2] = xshake[i0[k]][2] - xshake[i1[k]][2];
+
+    double s02[3];
+    s02[0] = xshake[i0[k]][0] - xshake[i2[k]][0];
+    s02[1] = xshake[i0[k]][1] - xshake[i2[k]][1];
+    s02[2] = xshake[i0[k]][2] - xshake[i2[k]][2];
+
+    double s12[3];
+    s12[0] = xshake[i1[k]][0] - xshake[i2[k]][0];
+    s12[1] = xshake[i1[k]][1] - xshake[i2[k]][1];
+    s12[2] = xshake[i1[k]][2] - xshake[i2[k]][2];
+
+    // scalar distances between atoms
+
+    double r01sq = r01[0][k]*r01[0][k] + r01[1][k]*r01[1][k] + r01[2][k]*r01[2][k];
+    double r02sq = r02[0][k]*r02[0][k] + r02[1][k]*r02[1][k] + r02[2][k]*r02[2][k];
+    double r12sq = r12[0][k]*r12[0][k] + r12[1][k]*r12[1][k] + r12[2][k]*r12[2][k];
+    s01sq[k] = s01[0]*s01[0] + s01[1]*s01[1] + s01[2]*s01[2];
+    s02sq[k] = s02[0]*s02[0] + s02[1]*s02[1] + s02[2]*s02[2];
+    s12sq[k] = s12[0]*s12[0] + s12[1]*s12[1] + s12[2]*s12[2];
+
+    // matrix coeffs and rhs for lamda equations
+
+    if (rmass) {
+      invmass0 = 1.0/rmass[i0[k]];
+      invmass1 = 1.0/rmass[i1[k]];
+      invmass2 = 1.0/rmass[i2[k]];
+    } else {
+      invmass0 = 1.0/mass[type[i0[k]]];
+      invmass1 = 1.0/mass[type[i1[k]]];
+      invmass2 = 1.0/mass[type[i2[k]]];
+    }
 
-  double lamda01 = 0.0;
-  double lamda02 = 0.0;
-  double lamda12 = 0.0;
+    double a11 = 2.0 * (invmass0+invmass1) *
+      (s01[0]*r01[0][k] + s01[1]*r01[1][k] + s01[2]*r01[2][k]);
+    double a12 = 2.0 * invmass0 *
+      (s01[0]*r02[0][k] + s01[1]*r02[1][k] + s01[2]*r02[2][k]);
+    double a13 = - 2.0 * invmass1 *
+      (s01[0]*r12[0][k] + s01[1]*r12[1][k] + s01[2]*r12[2][k]);
+    double a21 = 2.0 * invmass0 *
+      (s02[0]*r01[0][k] + s02[1]*r01[1][k] + s02[2]*r01[2][k]);
+    double a22 = 2.0 * (invmass0+invmass2) *
+      (s02[0]*r02[0][k] + s02[1]*r02[1][k] + s02[2]*r02[2][k]);
+    double a23 = 2.0 * invmass2 *
+      (s02[0]*r12[0][k] + s02[1]*r12[1][k] + s02[2]*r12[2][k]);
+    double a31 = - 2.0 * invmass1 *
+      (s12[0]*r01[0][k] + s12[1]*r01[1][k] + s12[2]*r01[2][k]);
+    double a32 = 2.0 * invmass2 *
+      (s12[0]*r02[0][k] + s12[1]*r02[1][k] + s12[2]*r02[2][k]);
+    double a33 = 2.0 * (invmass1+invmass2) *
+      (s12[0]*r12[0][k] + s12[1]*r12[1][k] + s12[2]*r12[2][k]);
+
+    // inverse of matrix
+
+    determ[k] = a11*a22*a33 + a12*a23*a31 + a13*a21*a32 -
+      a11*a23*a32 - a12*a21*a33 - a13*a22*a31;
+    double determinv = 1.0/determ[k];
+
+    ainv[0][k] = determinv * (a22*a33 - a23*a32);
+    ainv[1][k] = -determinv * (a12*a33 - a13*a32);
+    ainv[2][k] = determinv * (a12*a23 - a13*a22);
+    ainv[3][k] = -determinv * (a21*a33 - a23*a31);
+    ainv[4][k] = determinv * (a11*a33 - a13*a31);
+    ainv[5][k] = -determinv * (a11*a23 - a13*a21);
+    ainv[6][k] = determinv * (a21*a32 - a22*a31);
+    ainv[7][k] = -determinv * (a11*a32 - a12*a31);
+    ainv[8][k] = determinv * (a11*a22 - a12*a21);
+
+    // quadratic correction coeffs
+
+    double r0102 = (r01[0][k]*r02[0][k] + r01[1][k]*r02[1][k] + r01[2][k]*r02[2][k]);
+    double r0112 = (r01[0][k]*r12[0][k] + r01[1][k]*r12[1][k] + r01[2][k]*r12[2][k]);
+    double r0212 = (r02[0][k]*r12[0][k] + r02[1][k]*r12[1][k] + r02[2][k]*r12[2][k]);
+
+    quad1c[0][k] = (invmass0+invmass1)*(invmass0+invmass1) * r01sq;
+    quad1c[1][k] = invmass0*invmass0 * r02sq;
+    quad1c[2][k] = invmass1*invmass1 * r12sq;
+    quad1c[3][k] = 2.0 * (invmass0+invmass1)*invmass0 * r0102;
+    quad1c[4][k] = - 2.0 * (invmass0+invmass1)*invmass1 * r0112;
+    quad1c[5][k] = - 2.0 * invmass0*invmass1 * r0212;
+
+    quad2c[0][k] = invmass0*invmass0 * r01sq;
+    quad2c[1][k] = (invmass0+invmass2)*(invmass0+invmass2) * r02sq;
+    quad2c[2][k] = invmass2*invmass2 * r12sq;
+    quad2c[3][k] = 2.0 * (invmass0+invmass2)*invmass0 * r0102;
+    quad2c[4][k] = 2.0 * invmass0*invmass2 * r0112;
+    quad2c[5][k] = 2.0 * (invmass0+invmass2)*invmass2 * r0212;
+
+    quad3c[0][k] = invmass1*invmass1 * r01sq;
+    quad3c[1][k] = invmass2*invmass2 * r02sq;
+    quad3c[2][k] = (invmass1+invmass2)*(invmass1+invmass2) * r12sq;
+    quad3c[3][k] = - 2.0 * invmass1*invmass2 * r0102;
+    quad3c[4][k] = - 2.0 * (invmass1+invmass2)*invmass1 * r0112;
+    quad3c[5][k] = 2.0 * (invmass1+invmass2)*invmass2 * r0212;
+  }
+
+  for (k = 0; k < nb; k++)
+    if (determ[k] == 0.0) error->one(FLERR,"Shake determinant = 0.0");
+
+  // iterate each cluster until converged
+  // a converged lane is frozen so its result matches a standalone solve
+
+  for (k = 0; k < nb; k++) {
+    lamda01[k] = 0.0;
+    lamda02[k] = 0.0;
+    lamda12[k] = 0.0;
+    done[k] = 0;
+  }
+
+  int nremain = nb;
   int niter = 0;
-  int done = 0;
 
   double quad1,quad2,quad3,b1,b2,b3,lamda01_new,lamda02_new,lamda12_new;
 
-  while (!done && niter < max_iter) {
-
-    quad1 = quad1_0101 * lamda01*lamda01 +
-      quad1_0202 * lamda02*lamda02 +
-      quad1_1212 * lamda12*lamda12 +
-      quad1_0102 * lamda01*lamda02 +
-      quad1_0112 * lamda01*lamda12 +
-      quad1_0212 * lamda02*lamda12;
-
-    quad2 = quad2_0101 * lamda01*lamda01 +
-      quad2_0202 * lamda02*lamda02 +
-      quad2_1212 * lamda12*lamda12 +
-      quad2_0102 * lamda01*lamda02 +
-      quad2_0112 * lamda01*lamda12 +
-      quad2_0212 * lamda02*lamda12;
-
-    quad3 = quad3_0101 * lamda01*lamda01 +
-      quad3_0202 * lamda02*lamda02 +
-      quad3_1212 * lamda12*lamda12 +
-      quad3_0102 * lamda01*lamda02 +
-      quad3_0112 * lamda01*lamda12 +
-      quad3_0212 * lamda02*lamda12;
-
-    b1 = bond1*bond1 - s01sq - quad1;
-    b2 = bond2*bond2 - s02sq - quad2;
-    b3 = bond12*bond12 - s12sq - quad3;
-
-    lamda01_new = a11inv*b1 + a12inv*b2 + a13inv*b3;
-    lamda02_new = a21inv*b1 + a22inv*b2 + a23inv*b3;
-    lamda12_new = a31inv*b1 + a32inv*b2 + a33inv*b3;
-
-    done = 1;
-    if (fabs(lamda01_new-lamda01) > tolerance) done = 0;
-    if (fabs(lamda02_new-lamda02) > tolerance) done = 0;
-    if (fabs(lamda12_new-lamda12) > tolerance) done = 0;
-
-    lamda01 = lamda01_new;
-    lamda02 = lamda02_new;
-    lamda12 = lamda12_new;
-
-    // stop iterations before we have a floating point overflow
-    // max double is < 1.0e308, so 1e150 is a reasonable cutoff
-
-    if (fabs(lamda01) > 1e150 || fabs(lamda02) > 1e150
-        || fabs(lamda12) > 1e150) done = 1;
+  while (nremain && niter < max_iter) {
+
+    for (k = 0; k < nb; k++) {
+      if (done[k]) continue;
+
+      quad1 = quad1c[0][k] * lamda01[k]*lamda01[k] +
+        quad1c[1][k] * lamda02[k]*lamda02[k] +
+        quad1c[2][k] * lamda12[k]*lamda12[k] +
+        quad1c[3][k] * lamda01[k]*lamda02[k] +
+        quad1c[4][k] * lamda01[k]*lamda12[k] +
+        quad1c[5][k] * lamda02[k]*lamda12[k];
+
+      quad2 = quad2c[0][k] * lamda01[k]*lamda01[k] +
+        quad2c[1][k] * lamda02[k]*lamda02[k] +
+        quad2c[2][k] * lamda12[k]*lamda12[k] +
+        quad2c[3][k] * lamda01[k]*lamda02[k] +
+        quad2c[4][k] * lamda01[k]*lamda12[k] +
+        quad2c[5][k] * lamda02[k]*lamda12[k];
+
+      quad3 = quad3c[0][k] * lamda01[k]*lamda01[k] +
+        quad3c[1][k] * lamda02[k]*lamda02[k] +
+        quad3c[2][k] * lamda12[k]*lamda12[k] +
+        quad3c[3][k] * lamda01[k]*lamda02[k] +
+        quad3c[4][k] * lamda01[k]*lamda12[k] +
+        quad3c[5][k] * lamda02[k]*lamda12[k];
+
+      b1 = bond1sq[k] - s01sq[k] - quad1;
+      b2 = bond2sq[k] - s02sq[k] - quad2;
+      b3 = bond12sq[k] - s12sq[k] - quad3;
+
+      lamda01_new = ainv[0][k]*b1 + ainv[1][k]*b2 + ainv[2][k]*b3;
+      lamda02_new = ainv[3][k]*b1 + ainv[4][k]*b2 + ainv[5][k]*b3;
+      lamda12_new = ainv[6][k]*b1 + ainv[7][k]*b2 + ainv[8][k]*b3;
+
+      int mydone = 1;
+      if (fabs(lamda01_new-lamda01[k]) > tolerance) mydone = 0;
+      if (fabs(lamda02_new-lamda02[k]) > tolerance) mydone = 0;
+      if (fabs(lamda12_new-lamda12[k]) > tolerance) mydone = 0;
+
+      lamda01[k] = lamda01_new;
+      lamda02[k] = lamda02_new;
+      lamda12[k] = lamda12_new;
+
+      // stop iterations before we have a floating point overflow
+      // max double is < 1.0e308, so 1e150 is a reasonable cutoff
+
+      if (fabs(lamda01[k]) > 1e150 || fabs(lamda02[k]) > 1e150
+          || fabs(lamda12[k]) > 1e150) mydone = 1;
+
+      if (mydone) {
+        done[k] = 1;
+        nremain--;
+      }
+    }
 
     niter++;
   }
 
   // update forces if atom is owned by this processor
 
-  lamda01 = lamda01/dtfsq;
-  lamda02 = lamda02/dtfsq;
-  lamda12 = lamda12/dtfsq;
-
-  if (i0 < nlocal) {
-    f[i0][0] += lamda01*r01[0] + lamda02*r02[0];
-    f[i0][1] += lamda01*r01[1] + lamda02*r02[1];
-    f[i0][2] += lamda01*r01[2] + lamda02*r02[2];
-  }
-
-  if (i1 < nlocal) {
-    f[i1][0] -= lamda01*r01[0] - lamda12*r12[0];
-    f[i1][1] -= lamda01*r01[1] - lamda12*r12[1];
-    f[i1][2] -= lamda01*r01[2] - lamda12*r12[2];
-  }
+  for (k = 0; k < nb; k++) {
+    lamda01[k] = lamda01[k]/dtfsq;
+    lamda02[k] = lamda02[k]/dtfsq;
+    lamda12[k] = lamda12[k]/dtfsq;
 
-  if (i2 < nlocal) {
-    f[i2][0] -= lamda02*r02[0] + lamda12*r12[0];
-    f[i2][1] -= lamda02*r02[1] + lamda12*r12[1];
-    f[i2][2] -= lamda02*r02[2] + lamda12*r12[2];
-  }
+    if (i0[k] < nlocal) {
+      f[i0[k]][0] += lamda01[k]*r01[0][k] + lamda02[k]*r02[0][k];
+      f[i0[k]][1] += lamda01[k]*r01[1][k] + lamda02[k]*r02[1][k];
+      f[i0[k]][2] += lamda01[k]*r01[2][k] + lamda02[k]*r02[2][k];
+    }
 
-  if (evflag) {
-    int count = 0;
-    if (i0 < nlocal) atomlist[count++] = i0;
-    if (i1 < nlocal) atomlist[count++] = i1;
-    if (i2 < nlocal) atomlist[count++] = i2;
+    if (i1[k] < nlocal) {
+      f[i1[k]][0] -= lamda01[k]*r01[0][k] - lamda12[k]*r12[0][k];
+      f[i1[k]][1] -= lamda01[k]*r01[1][k] - lamda12[k]*r12[1][k];
+      f[i1[k]][2] -= lamda01[k]*r01[2][k] - lamda12[k]*r12[2][k];
+    }
 
-    v[0] = lamda01*r01[0]*r01[0]+lamda02*r02[0]*r02[0]+lamda12*r12[0]*r12[0];
-    v[1] = lamda01*r01[1]*r01[1]+lamda02*r02[1]*r02[1]+lamda12*r12[1]*r12[1];
-    v[2] = lamda01*r01[2]*r01[2]+lamda02*r02[2]*r02[2]+lamda12*r12[2]*r12[2];
-    v[3] = lamda01*r01[0]*r01[1]+lamda02*r02[0]*r02[1]+lamda12*r12[0]*r12[1];
-    v[4] = lamda01*r01[0]*r01[2]+lamda02*r02[0]*r02[2]+lamda12*r12[0]*r12[2];
-    v[5] = lamda01*r01[1]*r01[2]+lamda02*r02[1]*r02[2]+lamda12*r12[1]*r12[2];
+    if (i2[k] < nlocal) {
+      f[i2[k]][0] -= lamda02[k]*r02[0][k] + lamda12[k]*r12[0][k];
+      f[i2[k]][1] -= lamda02[k]*r02[1][k] + lamda12[k]*r12[1][k];
+      f[i2[k]][2] -= lamda02[k]*r02[2][k] + lamda12[k]*r12[2][k];
+    }
 
-    double fpairlist[] = {lamda01, lamda02, lamda12};
-    double dellist[][3]  = {{r01[0], r01[1], r01[2]},
-                            {r02[0], r02[1], r02[2]},
-                            {r12[0], r12[1], r12[2]}};
-    int pairlist[][2] = {{i0,i1}, {i0,i2}, {i1,i2}};
-    v_tally(count,atomlist,3.0,v,nlocal,3,pairlist,fpairlist,dellist);
+    if (evflag) {
+      int atomlist[3];
+      double v[6];
+      int count = 0;
+      if (i0[k] < nlocal) atomlist[count++] = i0[k];
+      if (i1[k] < nlocal) atomlist[count++] = i1[k];
+      if (i2[k] < nlocal) atomlist[count++] = i2[k];
+
+      v[0] = lamda01[k]*r01[0][k]*r01[0][k]+lamda02[k]*r02[0][k]*r02[0][k]+
+        lamda12[k]*r12[0][k]*r12[0][k];
+      v[1] = lamda01[k]*r01[1][k]*r01[1][k]+lamda02[k]*r02[1][k]*r02[1][k]+
+        lamda12[k]*r12[1][k]*r12[1][k];
+      v[2] = lamda01[k]*r01[2][k]*r01[2][k]+lamda02[k]*r02[2][k]*r02[2][k]+
+        lamda12[k]*r12[2][k]*r12[2][k];
+      v[3] = lamda01[k]*r01[0][k]*r01[1][k]+lamda02[k]*r02[0][k]*r02[1][k]+
+        lamda12[k]*r12[0][k]*r12[1][k];
+      v[4] = lamda01[k]*r01[0][k]*r01[2][k]+lamda02[k]*r02[0][k]*r02[2][k]+
+        lamda12[k]*r12[0][k]*r12[2][k];
+      v[5] = lamda01[k]*r01[1][k]*r01[2][k]+lamda02[k]*r02[1][k]*r02[2][k]+
+        lamda12[k]*r12[1][k]*r12[2][k];
+
+      double fpairlist[] = {lamda01[k], lamda02[k], lamda12[k]};
+      double dellist[][3]  = {{r01[0][k], r01[1][k], r01[2][k]},
+                              {r02[0][k], r02[1][k], r02[2][k]},
+                              {r12[0][k], r12[1][k], r12[2][k]}};
+      int pairlist[][2] = {{i0[k],i1[k]}, {i0[k],i2[k]}, {i1[k],i2[k]}};
+      v_tally(count,atomlist,3.0,v,nlocal,3,pairlist,fpairlist,dellist);
+    }
   }
 }
 
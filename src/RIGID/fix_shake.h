@@ -140,7 +140,7 @@ class FixShake : public Fix {
   void shake(int);
   void shake3(int);
   void shake4(int);
-  void shake3angle(int);
+  void shake3angle_block(int, const int *);
   void bond_force(int, int, double);
   virtual void stats();
   int bondtype_findset(int, tagint, tagint, int);
@@ -23,6 +23,7 @@
 #include "error.h"
 #include "force.h"
 #include "memory.h"
+#include "neighbor.h"
 #include "pair_hybrid.h"
 
 #include <cstdlib>
@@ -192,7 +193,10 @@ void Scafacos::compute(int eflag, int vflag)
   FCSResult result;
 
   // for the FMM at least one particle is required per process
-  if (strcmp(method, "fmm")) {
+  // nlocal only changes when atoms migrate at reneighboring, so the
+  //   check (a blocking allreduce) is only redone after a neighbor build
+
+  if (strcmp(method, "fmm") == 0 && neighbor->ago == 0) {
     int empty = (nlocal == 0) ? 1 : 0;
     MPI_Allreduce(MPI_IN_PLACE, &empty, 1, MPI_INT, MPI_SUM, world);
     if (empty > 0)
@@ -355,8 +359,9 @@ int Scafacos::modify_param(int narg, char **arg)
 double Scafacos::memory_usage()
 {
   double bytes = 0.0;
-  bytes += (double) maxatom * sizeof(double);
-  bytes += (double) 3 * maxatom * sizeof(double);
+  bytes += (double) maxatom * sizeof(double);        // epot
+  bytes += (double) 3 * maxatom * sizeof(double);    // efield
+  bytes += (double) 3 * maxatom * sizeof(double);    // xpbc
   return bytes;
 }
 
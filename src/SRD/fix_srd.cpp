@@ -41,6 +41,8 @@
 #include <cmath>
 #include <cstring>
 
+#include "omp_compat.h"
+
 using namespace LAMMPS_NS;
 using namespace FixConst;
 using namespace MathConst;
@@ -825,11 +827,7 @@ void FixSRD::post_force(int /*vflag*/)
 
 void FixSRD::reset_velocities()
 {
-  int i, j, n, ix, iy, iz, ibin, axis, sign, irandom;
-  double u[3], vsum[3];
-  double vsq, tbin, scale;
-  double *vave, *xlamda;
-  double vstream[3];
+  int i, ix, iy, iz, ibin;
 
   // if requested, perform a dynamic shift of bin positions
 
@@ -888,30 +886,42 @@ void FixSRD::reset_velocities()
 
   if (triclinic) domain->lamda2x(nlocal);
 
-  // for each bin I have particles contributing to:
-  // compute summed v of particles in that bin
-  // if I own the bin, set its random value, else set to 0.0
+  // if I own a bin, set its random value, else set to 0.0
+  // serial loop over bins so the random # stream does not depend on threads
 
   for (i = 0; i < nbins; i++) {
-    n = 0;
-    vsum[0] = vsum[1] = vsum[2] = 0.0;
-    for (j = binhead[i]; j >= 0; j = binnext[j]) {
-      vsum[0] += v[j][0];
-      vsum[1] += v[j][1];
-      vsum[2] += v[j][2];
-      n++;
-    }
-
-    vbin[i].vsum[0] = vsum[0];
-    vbin[i].vsum[1] = vsum[1];
-    vbin[i].vsum[2] = vsum[2];
-    vbin[i].n = n;
     if (vbin[i].owner)
       vbin[i].random = random->uniform();
     else
       vbin[i].random = 0.0;
   }
 
+  // for each bin I have particles contributing to:
+  // compute summed v of particles in that bin
+  // bins are independent, so loop is multi-threaded when possible
+
+  int *bhead = binhead;
+  int *bnext = binnext;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(nbins, vbin, bhead, bnext, v)
+#endif
+  for (int ib = 0; ib < nbins; ib++) {
+    int count = 0;
+    double vsumone[3] = {0.0, 0.0, 0.0};
+    for (int jp = bhead[ib]; jp >= 0; jp = bnext[jp]) {
+      vsumone[0] += v[jp][0];
+      vsumone[1] += v[jp][1];
+      vsumone[2] += v[jp][2];
+      count++;
+    }
+
+    vbin[ib].vsum[0] = vsumone[0];
+    vbin[ib].vsum[1] = vsumone[1];
+    vbin[ib].vsum[2] = vsumone[2];
+    vbin[ib].n = count;
+  }
+
   // communicate bin info for bins which more than 1 proc contribute to
 
   if (shifts[shiftflag].commflag) vbin_comm(shiftflag);
@@ -945,60 +955,78 @@ void FixSRD::reset_velocities()
   srd_bin_temp = 0.0;
   srd_bin_count = 0;
 
-  if (dimension == 2) axis = 2;
   double *h_rate = domain->h_rate;
   double *h_ratelo = domain->h_ratelo;
+  int dim = dimension;
 
-  for (i = 0; i < nbins; i++) {
-    vbin[i].value[0] = 0.0;
-    n = vbin[i].n;
-    if (n == 0) continue;
-    vave = vbin[i].vsum;
-    vave[0] /= n;
-    vave[1] /= n;
-    vave[2] /= n;
-
-    irandom = static_cast<int>(6.0 * vbin[i].random);
-    sign = irandom % 2;
-    if (dimension == 3) axis = irandom / 2;
-
-    vsq = 0.0;
-    for (j = binhead[i]; j >= 0; j = binnext[j]) {
+  // each bin touches only its own particles, so loop is multi-threaded
+  // when possible, with results identical to the serial loop
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE LMP_SHARED(nbins, vbin, bhead, bnext, v, dim)
+#endif
+  for (int ib = 0; ib < nbins; ib++) {
+    double u[3];
+
+    vbin[ib].value[0] = 0.0;
+    int count = vbin[ib].n;
+    if (count == 0) continue;
+    double *vave = vbin[ib].vsum;
+    vave[0] /= count;
+    vave[1] /= count;
+    vave[2] /= count;
+
+    int irandom = static_cast<int>(6.0 * vbin[ib].random);
+    int sign = irandom % 2;
+    int axis = 2;
+    if (dim == 3) axis = irandom / 2;
+
+    double vsq = 0.0;
+    for (int jp = bhead[ib]; jp >= 0; jp = bnext[jp]) {
       if (axis == 0) {
-        u[0] = v[j][0] - vave[0];
-        u[1] = sign ? v[j][2] - vave[2] : vave[2] - v[j][2];
-        u[2] = sign ? vave[1] - v[j][1] : v[j][1] - vave[1];
+        u[0] = v[jp][0] - vave[0];
+        u[1] = sign ? v[jp][2] - vave[2] : vave[2] - v[jp][2];
+        u[2] = sign ? vave[1] - v[jp][1] : v[jp][1] - vave[1];
       } else if (axis == 1) {
-        u[1] = v[j][1] - vave[1];
-        u[0] = sign ? v[j][2] - vave[2] : vave[2] - v[j][2];
-        u[2] = sign ? vave[0] - v[j][0] : v[j][0] - vave[0];
+        u[1] = v[jp][1] - vave[1];
+        u[0] = sign ? v[jp][2] - vave[2] : vave[2] - v[jp][2];
+        u[2] = sign ? vave[0] - v[jp][0] : v[jp][0] - vave[0];
       } else {
-        u[2] = v[j][2] - vave[2];
-        u[1] = sign ? v[j][0] - vave[0] : vave[0] - v[j][0];
-        u[0] = sign ? vave[1] - v[j][1] : v[j][1] - vave[1];
+        u[2] = v[jp][2] - vave[2];
+        u[1] = sign ? v[jp][0] - vave[0] : vave[0] - v[jp][0];
+        u[0] = sign ? vave[1] - v[jp][1] : v[jp][1] - vave[1];
       }
       vsq += u[0] * u[0] + u[1] * u[1] + u[2] * u[2];
-      v[j][0] = u[0] + vave[0];
-      v[j][1] = u[1] + vave[1];
-      v[j][2] = u[2] + vave[2];
+      v[jp][0] = u[0] + vave[0];
+      v[jp][1] = u[1] + vave[1];
+      v[jp][2] = u[2] + vave[2];
     }
 
-    if (n > 1) vbin[i].value[0] = vsq;
+    if (count > 1) vbin[ib].value[0] = vsq;
   }
 
   if (shifts[shiftflag].commflag) xbin_comm(shiftflag, 1);
 
   if (tstat) {
-    for (i = 0; i < nbins; i++) {
-      n = vbin[i].n;
-      if (n <= 1) continue;
+    int deform = deformflag;
+    double t_srd = temperature_srd;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE \
+  LMP_SHARED(nbins, vbin, bhead, bnext, v, deform, t_srd, dof_tstat, tfactor, h_rate, h_ratelo)
+#endif
+    for (int ib = 0; ib < nbins; ib++) {
+      double u[3], vstream[3];
+
+      int count = vbin[ib].n;
+      if (count <= 1) continue;
 
       // vsum is already average velocity
 
-      vave = vbin[i].vsum;
+      double *vave = vbin[ib].vsum;
 
-      if (deformflag) {
-        xlamda = vbin[i].xctr;
+      if (deform) {
+        double *xlamda = vbin[ib].xctr;
         vstream[0] =
             h_rate[0] * xlamda[0] + h_rate[5] * xlamda[1] + h_rate[4] * xlamda[2] + h_ratelo[0];
         vstream[1] = h_rate[1] * xlamda[1] + h_rate[3] * xlamda[2] + h_ratelo[1];
@@ -1012,19 +1040,19 @@ void FixSRD::reset_velocities()
       // tbin = thermal temperature of particles in bin
       // scale = scale factor for thermal velocity
 
-      tbin = vbin[i].value[0] / (n - dof_tstat) * tfactor;
-      scale = sqrt(temperature_srd / tbin);
-      vsq = 0.0;
-      for (j = binhead[i]; j >= 0; j = binnext[j]) {
-        u[0] = (v[j][0] - vave[0]) * scale;
-        u[1] = (v[j][1] - vave[1]) * scale;
-        u[2] = (v[j][2] - vave[2]) * scale;
+      double tbin = vbin[ib].value[0] / (count - dof_tstat) * tfactor;
+      double scale = sqrt(t_srd / tbin);
+      double vsq = 0.0;
+      for (int jp = bhead[ib]; jp >= 0; jp = bnext[jp]) {
+        u[0] = (v[jp][0] - vave[0]) * scale;
+        u[1] = (v[jp][1] - vave[1]) * scale;
+        u[2] = (v[jp][2] - vave[2]) * scale;
         vsq += u[0] * u[0] + u[1] * u[1] + u[2] * u[2];
-        v[j][0] = u[0] + vstream[0];
-        v[j][1] = u[1] + vstream[1];
-        v[j][2] = u[2] + vstream[2];
+        v[jp][0] = u[0] + vstream[0];
+        v[jp][1] = u[1] + vstream[1];
+        v[jp][2] = u[2] + vstream[2];
       }
-      vbin[i].value[0] = vsq;
+      vbin[ib].value[0] = vsq;
     }
 
     if (shifts[shiftflag].commflag) xbin_comm(shiftflag, 1);
@@ -1044,14 +1072,25 @@ void FixSRD::reset_velocities()
   // rescale any too-large velocities
 
   if (rescale_rotate) {
-    for (i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        vsq = v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2];
-        if (vsq > vmaxsq) {
-          nrescale++;
-          MathExtra::scale3(vmax / sqrt(vsq), v[i]);
+    int groupbit_copy = groupbit;
+    double vmax_copy = vmax;
+    double vmaxsq_copy = vmaxsq;
+    int nrescale_me = 0;
+
+#if defined(_OPENMP)
+#pragma omp parallel for LMP_DEFAULT_NONE \
+  LMP_SHARED(nlocal, mask, v, groupbit_copy, vmax_copy, vmaxsq_copy) reduction(+ : nrescale_me)
+#endif
+    for (int ip = 0; ip < nlocal; ip++)
+      if (mask[ip] & groupbit_copy) {
+        double vsq = v[ip][0] * v[ip][0] + v[ip][1] * v[ip][1] + v[ip][2] * v[ip][2];
+        if (vsq > vmaxsq_copy) {
+          nrescale_me++;
+          MathExtra::scale3(vmax_copy / sqrt(vsq), v[ip]);
         }
       }
+
+    nrescale += nrescale_me;
   }
 }
 
@@ -30,6 +30,9 @@ ComputeTempUef::ComputeTempUef(LAMMPS *lmp, int narg, char **arg) :
   ComputeTemp(lmp, narg, arg)
 {
   rot_flag=true;
+  // vector is rotated after the base-class sweep, so a scalar call
+  // must not publish the unrotated fused vector
+  vector_fusable = 0;
 }
 
 /* ----------------------------------------------------------------------
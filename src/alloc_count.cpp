@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "alloc_count.h"
+
+#if defined(LMP_DEBUG_ALLOC)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> alloc_count{0};
+
+uint64_t LAMMPS_NS::AllocCount::count()
+{
+  return alloc_count.load(std::memory_order_relaxed);
+}
+
+// counting replacements for the global allocation functions
+// deliberately minimal: aligned and nothrow variants fall back to these
+
+void *operator new(std::size_t nbytes)
+{
+  alloc_count.fetch_add(1, std::memory_order_relaxed);
+  void *ptr = malloc(nbytes ? nbytes : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void *operator new[](std::size_t nbytes)
+{
+  return operator new(nbytes);
+}
+
+void operator delete(void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+  free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+  free(ptr);
+}
+
+#else
+
+uint64_t LAMMPS_NS::AllocCount::count()
+{
+  return 0;
+}
+
+#endif
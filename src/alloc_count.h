@@ -0,0 +1,32 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_ALLOC_COUNT_H
+#define LMP_ALLOC_COUNT_H
+
+#include <cstdint>
+
+namespace LAMMPS_NS {
+namespace AllocCount {
+
+  // number of global operator new calls made so far by this process
+  // always returns 0 unless compiled with -DLMP_DEBUG_ALLOC, which
+  // replaces the global operator new/delete with counting versions
+  // used to verify that steady-state hot paths stay off the heap
+
+  uint64_t count();
+
+}    // namespace AllocCount
+}    // namespace LAMMPS_NS
+
+#endif
@@ -19,8 +19,14 @@
 #include "force.h"
 #include "math_const.h"
 #include "memory.h"
+#include "neighbor.h"
 #include "suffix.h"
 
+#include <cstring>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 using namespace MathConst;
 
@@ -50,6 +56,9 @@ Angle::Angle(LAMMPS *_lmp) : Pointers(_lmp)
   datamask_read = ALL_MASK;
   datamask_modify = ALL_MASK;
 
+  fthread = nullptr;
+  maxthread = 0;
+
   copymode = kokkosable = 0;
 }
 
@@ -62,6 +71,7 @@ Angle::~Angle()
   memory->destroy(eatom);
   memory->destroy(vatom);
   memory->destroy(cvatom);
+  memory->destroy(fthread);
 }
 
 /* ----------------------------------------------------------------------
@@ -550,11 +560,79 @@ void Angle::ev_tally2(int i, int j, int nlocal, int newton_bond, double ebond, d
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   evaluate all bonded terms via compute_partial() with one force buffer
+   per thread, then reduce the buffers into the global force array.
+   only used on steps without energy/virial tallying, so styles need no
+   per-thread accumulators.  returns 0 if the style must evaluate its
+   terms on the serial path instead.
+------------------------------------------------------------------------- */
+
+int Angle::compute_threaded(int eflag, int vflag)
+{
+#if defined(_OPENMP)
+  const int nthreads = comm->nthreads;
+  const int nanglelist = neighbor->nanglelist;
+  if (evflag || nthreads == 1 || nanglelist < 512) return 0;
+
+  const int nall = atom->nlocal + atom->nghost;
+  if (atom->nmax > maxthread) {
+    maxthread = atom->nmax;
+    memory->destroy(fthread);
+    memory->create(fthread, (bigint) (nthreads - 1) * maxthread, 3, "angle:fthread");
+  }
+
+  double **f = atom->f;
+
+#pragma omp parallel default(shared)
+  {
+    const int tid = omp_get_thread_num();
+
+    // thread 0 adds directly to the global array, all others to a
+    // private buffer which must be cleared first
+
+    double **fpart;
+    if (tid == 0) fpart = f;
+    else {
+      fpart = fthread + (bigint) (tid - 1) * maxthread;
+      memset(&fpart[0][0], 0, (size_t) nall * 3 * sizeof(double));
+    }
+
+    const int nfrom = (int) ((bigint) tid * nanglelist / nthreads);
+    const int nto = (int) ((bigint) (tid + 1) * nanglelist / nthreads);
+    compute_partial(nfrom, nto, fpart, eflag, vflag);
+
+#pragma omp barrier
+
+    // each thread reduces a disjoint range of atoms
+
+    const int ifrom = (int) ((bigint) tid * nall / nthreads);
+    const int ito = (int) ((bigint) (tid + 1) * nall / nthreads);
+    for (int n = 0; n < nthreads - 1; n++) {
+      double **fsrc = fthread + (bigint) n * maxthread;
+      for (int i = ifrom; i < ito; i++) {
+        f[i][0] += fsrc[i][0];
+        f[i][1] += fsrc[i][1];
+        f[i][2] += fsrc[i][2];
+      }
+    }
+  }
+  return 1;
+#else
+  (void) eflag;
+  (void) vflag;
+  return 0;
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
 double Angle::memory_usage()
 {
   double bytes = (double) comm->nthreads * maxeatom * sizeof(double);
   bytes += (double) comm->nthreads * maxvatom * 6 * sizeof(double);
   bytes += (double) comm->nthreads * maxcvatom * 9 * sizeof(double);
+  if (fthread) bytes += (double) (comm->nthreads - 1) * maxthread * 3 * sizeof(double);
   return bytes;
 }
 
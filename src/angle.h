@@ -73,6 +73,18 @@ class Angle : protected Pointers {
  protected:
   int suffix_flag;    // suffix compatibility flag
 
+  double **fthread;    // per-thread force buffers for compute_threaded()
+  int maxthread;       // # of atom rows allocated per thread buffer
+
+  // optional range interface for native multi-threading: styles that
+  // implement it evaluate bonded terms nfrom to nto-1, adding forces to f
+
+  virtual void compute_partial(int /*nfrom*/, int /*nto*/, double ** /*f*/, int /*eflag*/,
+                               int /*vflag*/)
+  {
+  }
+  int compute_threaded(int, int);
+
   int evflag;
   int eflag_either, eflag_global, eflag_atom;
   int vflag_either, vflag_global, vflag_atom, cvflag_atom;
@@ -39,6 +39,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 #ifdef LMP_GPU
 #include "fix_gpu.h"
@@ -94,6 +95,7 @@ Atom::Atom(LAMMPS *_lmp) : Pointers(_lmp), atom_style(nullptr), avec(nullptr), a
 {
   natoms = 0;
   nlocal = nghost = nmax = 0;
+  peratom_epoch = 0;
   ntypes = 0;
   nellipsoids = nlines = ntris = nbodies = 0;
   nbondtypes = nangletypes = ndihedraltypes = nimpropertypes = 0;
@@ -102,9 +104,11 @@ Atom::Atom(LAMMPS *_lmp) : Pointers(_lmp), atom_style(nullptr), avec(nullptr), a
   firstgroupname = nullptr;
   sortfreq = 1000;
   nextsort = 0;
+  sortorder = SORTBIN;
   userbinsize = 0.0;
   maxbin = maxnext = 0;
   binhead = nullptr;
+  binorder = nullptr;
   next = permute = nullptr;
 
   // --------------------------------------------------------------------
@@ -277,6 +281,9 @@ Atom::Atom(LAMMPS *_lmp) : Pointers(_lmp), atom_style(nullptr), avec(nullptr), a
   map_array = nullptr;
   map_bucket = nullptr;
   map_hash = nullptr;
+  map_page = nullptr;
+  map_npage = 0;
+  map_pflag = 0;
 
   unique_tags = nullptr;
   reset_image_flag[0] = reset_image_flag[1] = reset_image_flag[2] = false;
@@ -301,6 +308,7 @@ Atom::~Atom()
 
   delete[] firstgroupname;
   memory->destroy(binhead);
+  memory->destroy(binorder);
   memory->destroy(next);
   memory->destroy(permute);
 
@@ -627,6 +635,44 @@ void Atom::add_peratom_vary(const std::string &name, void *address,
   peratom.push_back(item);
 }
 
+/* ----------------------------------------------------------------------
+   register NAME as a peratom field some consumer reads from ghost atoms
+   called by pair/bond/fix/compute styles at init time, before Comm::init()
+   border fields an atom style lists as lazy are only communicated to
+     ghost atoms when at least one consumer has registered them
+------------------------------------------------------------------------- */
+
+void Atom::add_ghost_field(const std::string &name)
+{
+  for (const auto &field : ghost_fields)
+    if (field == name) return;
+  ghost_fields.push_back(name);
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if a consumer registered NAME via add_ghost_field(), else 0
+   aliases of the same storage ("mu" vs "mu3") are matched by comparing
+     the registered peratom addresses
+------------------------------------------------------------------------- */
+
+int Atom::ghost_field_requested(const std::string &name) const
+{
+  const void *addr = nullptr;
+  for (const auto &p : peratom)
+    if (p.name == name) {
+      addr = p.address;
+      break;
+    }
+
+  for (const auto &field : ghost_fields) {
+    if (field == name) return 1;
+    if (addr)
+      for (const auto &p : peratom)
+        if (p.name == field && p.address == addr) return 1;
+  }
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    add info for a single per-atom array to PerAtom data struct
 ------------------------------------------------------------------------- */
@@ -866,6 +912,23 @@ void Atom::modify_params(int narg, char **arg)
       if ((sortfreq >= 0) && firstgroupname)
         error->all(FLERR,"Atom_modify sort and first options cannot be used together");
       iarg += 3;
+      if (iarg < narg && strcmp(arg[iarg],"bin") == 0) {
+        sortorder = SORTBIN;
+        iarg++;
+      } else if (iarg < narg && strcmp(arg[iarg],"morton") == 0) {
+        sortorder = SORTMORTON;
+        iarg++;
+      }
+    } else if (strcmp(arg[iarg],"headroom") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "atom_modify headroom", error);
+      memory->grow_headroom = utils::inumeric(FLERR,arg[iarg+1],false,lmp);
+      if (memory->grow_headroom < 0 || memory->grow_headroom > 100)
+        error->all(FLERR,"Illegal atom_modify headroom percentage {}", arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"hugepage") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "atom_modify hugepage", error);
+      memory->hugepage = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
     } else error->all(FLERR,"Illegal atom_modify command argument: {}", arg[iarg]);
   }
 }
@@ -1057,11 +1120,13 @@ void Atom::deallocate_topology()
    unpack N lines from Atom section of data file
    call atom-style specific method to parse each line
    triclinic_general = 1 if data file defines a general triclinic box
+   keepall = 1 if caller reads a distinct slice of the section on each
+     proc and atoms are kept regardless of which sub-domain owns them
 ------------------------------------------------------------------------- */
 
 void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
                       int type_offset, int shiftflag, double *shift,
-                      int labelflag, int *ilabel, int triclinic_general)
+                      int labelflag, int *ilabel, int triclinic_general, int keepall)
 {
   int xptr,iptr;
   imageint imagedata;
@@ -1227,15 +1292,18 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
       domain->remap(xdata,imagedata);
 
       // determine if this proc owns the atom
+      // with keepall, this proc is the only reader of the line,
+      //   so keep the atom and let the caller migrate it afterwards
 
       if (triclinic) {
         domain->x2lamda(xdata,lamda);
         coord = lamda;
       } else coord = xdata;
 
-      if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
-          coord[1] >= sublo[1] && coord[1] < subhi[1] &&
-          coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+      if (keepall ||
+          (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
+           coord[1] >= sublo[1] && coord[1] < subhi[1] &&
+           coord[2] >= sublo[2] && coord[2] < subhi[2])) {
 
         // atom-style specific method parses single line
 
@@ -2328,6 +2396,10 @@ void Atom::sort()
   if (domain->box_change) setup_sort_bins();
   if (nbins == 1) return;
 
+  // sorting reorders the per-atom arrays
+
+  peratom_epoch++;
+
   // reallocate per-atom vectors if needed
 
   if (nlocal > maxnext) {
@@ -2371,10 +2443,11 @@ void Atom::sort()
 
   // permute = desired permutation of atoms
   // permute[I] = J means Ith new atom will be Jth old atom
+  // for Morton ordering, traverse bins in the order setup_sort_bins() chose
 
   n = 0;
   for (m = 0; m < nbins; m++) {
-    i = binhead[m];
+    i = binhead[(sortorder == SORTMORTON) ? binorder[m] : m];
     while (i >= 0) {
       permute[n++] = i;
       i = next[i];
@@ -2385,25 +2458,58 @@ void Atom::sort()
   // current[I] = J means Ith current atom is Jth old atom
 
   int *current = next;
-  for (i = 0; i < nlocal; i++) current[i] = i;
-
-  // reorder local atom list, when done, current = permute
-  // perform "in place" using copy() to extra atom location at end of list
-  // inner while loop processes one cycle of the permutation
-  // copy before inner-loop moves an atom to end of atom list
-  // copy after inner-loop moves atom at end of list back into list
-  // empty = location in atom list that is currently empty
-
-  for (i = 0; i < nlocal; i++) {
-    if (current[i] == permute[i]) continue;
-    avec->copy(i,nlocal,0);
-    empty = i;
-    while (permute[empty] != i) {
-      avec->copy(permute[empty],empty,0);
-      empty = current[empty] = permute[empty];
+
+  // reorder local atom list
+  // bulk path: gather each per-atom array in one streaming pass through
+  //   a persistent shadow buffer, one array at a time
+  // fixes with atom-based arrays do the same via reorder_arrays() when
+  //   they support it, else their data is permuted by cycles of their
+  //   copy_arrays() callback
+  // styles with bonus data use the original cycle swaps via copy(),
+  //   since bonus data back-references atom indices
+
+  if (avec->bonus_flag == 0) {
+    avec->reorder(permute);
+
+    for (int iextra = 0; iextra < nextra_grow; iextra++) {
+      Fix *fix = modify->fix[extra_grow[iextra]];
+      if (fix->reorder_arrays(nlocal,permute)) continue;
+      for (i = 0; i < nlocal; i++) current[i] = i;
+      for (i = 0; i < nlocal; i++) {
+        if (current[i] == permute[i]) continue;
+        fix->copy_arrays(i,nlocal,0);
+        empty = i;
+        while (permute[empty] != i) {
+          fix->copy_arrays(permute[empty],empty,0);
+          empty = current[empty] = permute[empty];
+        }
+        fix->copy_arrays(nlocal,empty,0);
+        current[empty] = permute[empty];
+      }
+    }
+
+  } else {
+
+    // when done, current = permute
+    // perform "in place" using copy() to extra atom location at end of list
+    // inner while loop processes one cycle of the permutation
+    // copy before inner-loop moves an atom to end of atom list
+    // copy after inner-loop moves atom at end of list back into list
+    // empty = location in atom list that is currently empty
+
+    for (i = 0; i < nlocal; i++) current[i] = i;
+
+    for (i = 0; i < nlocal; i++) {
+      if (current[i] == permute[i]) continue;
+      avec->copy(i,nlocal,0);
+      empty = i;
+      while (permute[empty] != i) {
+        avec->copy(permute[empty],empty,0);
+        empty = current[empty] = permute[empty];
+      }
+      avec->copy(nlocal,empty,0);
+      current[empty] = permute[empty];
     }
-    avec->copy(nlocal,empty,0);
-    current[empty] = permute[empty];
   }
 
   // sanity check that current = permute
@@ -2560,6 +2666,32 @@ void Atom::setup_sort_bins()
     maxbin = nbins;
     memory->create(binhead,maxbin,"atom:binhead");
   }
+
+  // for Morton ordering, precompute bin traversal order by sorting bins
+  //   on the interleaved bits of their integer (ix,iy,iz) coordinates
+  // keeps atoms in nearby bins close together in memory in all 3 dims,
+  //   unlike the x-fastest bin sweep
+
+  if (sortorder == SORTMORTON) {
+    memory->destroy(binorder);
+    memory->create(binorder,nbins,"atom:binorder");
+    std::vector<uint64_t> keys(nbins);
+    for (int ibin = 0; ibin < nbins; ibin++) {
+      int ix = ibin % nbinx;
+      int iy = (ibin/nbinx) % nbiny;
+      int iz = ibin/(nbinx*nbiny);
+      uint64_t key = 0;
+      for (int b = 0; b < 21; b++) {
+        key |= ((uint64_t)(ix >> b) & 1) << (3*b);
+        key |= ((uint64_t)(iy >> b) & 1) << (3*b+1);
+        key |= ((uint64_t)(iz >> b) & 1) << (3*b+2);
+      }
+      keys[ibin] = key;
+      binorder[ibin] = ibin;
+    }
+    std::sort(binorder,binorder+nbins,
+              [&keys](int a, int b) { return keys[a] < keys[b]; });
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -2690,6 +2822,7 @@ number of values per atom.
    find custom per-atom vector with name
    return index if found, -1 if not found
      lists of names can have NULL entries if previously removed
+     lookup is a hash table query, so cheap enough for per-step use
    return flag = 0/1 for int/double
    return cols = 0/N for vector/array where N = # of columns
 ------------------------------------------------------------------------- */
@@ -2698,35 +2831,32 @@ int Atom::find_custom(const char *name, int &flag, int &cols)
 {
   if (name == nullptr) return -1;
 
-  for (int i = 0; i < nivector; i++)
-    if (ivname[i] && strcmp(ivname[i],name) == 0) {
-      flag = 0;
-      cols = 0;
-      return i;
-    }
+  auto entry = custom_map.find(name);
+  if (entry == custom_map.end()) return -1;
 
-  for (int i = 0; i < ndvector; i++)
-    if (dvname[i] && strcmp(dvname[i],name) == 0) {
-      flag = 1;
-      cols = 0;
-      return i;
-    }
+  flag = entry->second.flag;
+  cols = entry->second.cols;
+  return entry->second.index;
+}
 
-  for (int i = 0; i < niarray; i++)
-    if (ianame[i] && strcmp(ianame[i],name) == 0) {
-      flag = 0;
-      cols = icols[i];
-      return i;
-    }
+/* ----------------------------------------------------------------------
+   enter custom per-atom property into the name lookup table
+   called by add_custom() here and in derived classes
+------------------------------------------------------------------------- */
 
-  for (int i = 0; i < ndarray; i++)
-    if (daname[i] && strcmp(daname[i],name) == 0) {
-      flag = 1;
-      cols = dcols[i];
-      return i;
-    }
+void Atom::register_custom(const char *name, int index, int flag, int cols)
+{
+  custom_map[name] = {index, flag, cols};
+}
 
-  return -1;
+/* ----------------------------------------------------------------------
+   drop custom per-atom property from the name lookup table
+   called by remove_custom() here and in derived classes
+------------------------------------------------------------------------- */
+
+void Atom::deregister_custom(const char *name)
+{
+  if (name) custom_map.erase(name);
 }
 
 /** \brief Find a custom per-atom property with given name and retrieve ghost property
@@ -2821,6 +2951,7 @@ int Atom::add_custom(const char *name, int flag, int cols, int ghost)
   if (index < 0)
     error->all(FLERR,"Invalid call to Atom::add_custom()");
 
+  register_custom(name,index,flag,cols);
   return index;
 }
 
@@ -2842,24 +2973,28 @@ void Atom::remove_custom(int index, int flag, int cols)
   if (flag == 0 && cols == 0) {
     memory->destroy(ivector[index]);
     ivector[index] = nullptr;
+    deregister_custom(ivname[index]);
     delete[] ivname[index];
     ivname[index] = nullptr;
 
   } else if (flag == 1 && cols == 0) {
     memory->destroy(dvector[index]);
     dvector[index] = nullptr;
+    deregister_custom(dvname[index]);
     delete[] dvname[index];
     dvname[index] = nullptr;
 
   } else if (flag == 0 && cols) {
     memory->destroy(iarray[index]);
     iarray[index] = nullptr;
+    deregister_custom(ianame[index]);
     delete[] ianame[index];
     ianame[index] = nullptr;
 
   } else if (flag == 1 && cols) {
     memory->destroy(darray[index]);
     darray[index] = nullptr;
+    deregister_custom(daname[index]);
     delete[] daname[index];
     daname[index] = nullptr;
   }
@@ -3275,6 +3410,9 @@ double Atom::memory_usage()
   else if (map_style == MAP_HASH) {
     bytes += (double)map_nbucket*sizeof(int);
     bytes += (double)map_nhash*sizeof(HashElem);
+    bytes += (double)map_npage*sizeof(int *);
+    for (tagint i = 0; i < map_npage; i++)
+      if (map_page[i]) bytes += (double)MAP_PAGE_SIZE*sizeof(int);
   }
   if (maxnext) {
     bytes += memory->usage(next,maxnext);
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 
 namespace LAMMPS_NS {
 
@@ -43,6 +44,9 @@ class Atom : protected Pointers {
                          // natoms may not be current if atoms lost
   int nlocal, nghost;    // # of owned and ghost atoms on this proc
   int nmax;              // max # of owned+ghost in arrays on this proc
+  bigint peratom_epoch;  // incremented when per-atom arrays are
+                         // reallocated or reordered, so library callers
+                         // can validate cached per-atom pointers
   int tag_enable;        // 0/1 if atom ID tags are defined
   int molecular;         // 0 = atomic, 1 = standard molecular system,
                          // 2 = molecule template system
@@ -243,6 +247,11 @@ class Atom : protected Pointers {
 
   std::vector<PerAtom> peratom;
 
+  // peratom fields consumers read from ghost atoms
+  // registered by styles at init time, checked by AtomVec::border_defer()
+
+  std::vector<std::string> ghost_fields;
+
   // custom vectors and arrays used by fix property/atom
 
   int **ivector, ***iarray;
@@ -252,6 +261,16 @@ class Atom : protected Pointers {
   int nivector, ndvector, niarray, ndarray;
   int *ivghost, *dvghost, *iaghost, *daghost;
 
+  // name -> (index,flag,cols) lookup table for custom vectors and arrays
+  // maintained by add_custom()/remove_custom() so find_custom() is O(1)
+
+  struct CustomEntry {
+    int index;    // index in the respective list of properties
+    int flag;     // 0/1 for int/double data
+    int cols;     // 0 for vector, # of columns for array
+  };
+  std::unordered_map<std::string, CustomEntry> custom_map;
+
   // molecule templates
   // each template can be a set of consecutive molecules
   // each with same ID (stored in molecules)
@@ -292,6 +311,9 @@ class Atom : protected Pointers {
   int sortfreq;          // sort atoms every this many steps, 0 = off
   bigint nextsort;       // next timestep to sort on
   double userbinsize;    // requested sort bin size
+  int sortorder;         // SORTBIN = bin-sweep order, SORTMORTON = Morton order
+
+  enum { SORTBIN, SORTMORTON };
 
   // indices of atoms with same ID
 
@@ -318,6 +340,8 @@ class Atom : protected Pointers {
   void add_peratom(const std::string &, void *, int, int, int threadflag = 0);
   void add_peratom_change_columns(const std::string &, int);
   void add_peratom_vary(const std::string &, void *, int, int *, void *, int collength = 0);
+  void add_ghost_field(const std::string &);
+  int ghost_field_requested(const std::string &) const;
   void create_avec(const std::string &, int, char **, int);
   virtual AtomVec *new_avec(const std::string &, int, int &);
 
@@ -337,7 +361,7 @@ class Atom : protected Pointers {
 
   virtual void deallocate_topology();
 
-  void data_atoms(int, char *, tagint, tagint, int, int, double *, int, int *, int);
+  void data_atoms(int, char *, tagint, tagint, int, int, double *, int, int *, int, int keepall = 0);
   void data_vels(int, char *, tagint);
   void data_bonds(int, char *, int *, tagint, int, int, int *);
   void data_angles(int, char *, int *, tagint, int, int, int *);
@@ -375,6 +399,8 @@ class Atom : protected Pointers {
   int find_custom_ghost(const char *, int &, int &, int &);
   virtual int add_custom(const char *, int, int, int ghost = 0);
   virtual void remove_custom(int, int, int);
+  void register_custom(const char *, int, int, int);
+  void deregister_custom(const char *);
 
   void *extract(const char *);
   int extract_datatype(const char *);
@@ -397,9 +423,13 @@ class Atom : protected Pointers {
   {
     if (map_style == 1)
       return map_array[global];
-    else if (map_style == 2)
+    else if (map_style == 2) {
+      if (map_pflag) {
+        const int *page = map_page[global >> MAP_PAGE_BITS];
+        return page ? page[global & (MAP_PAGE_SIZE - 1)] : -1;
+      }
       return map_find_hash(global);
-    else
+    } else
       return -1;
   };
 
@@ -429,6 +459,18 @@ class Atom : protected Pointers {
   int *map_bucket;       // ptr to 1st entry in each bucket
   HashElem *map_hash;    // hash table
 
+  // paged direct map, accelerates lookups for the hashed map style
+  // pages are allocated on demand, only for populated tag ranges
+
+  static constexpr int MAP_PAGE_BITS = 12;
+  static constexpr int MAP_PAGE_SIZE = 1 << MAP_PAGE_BITS;    // tags per page
+  int **map_page;     // page table, null entry = unpopulated tag range
+  tagint map_npage;    // # of slots in page table
+  int map_pflag;       // 1 if paged map is in use, 0 if hash table
+
+  int *map_page_get(tagint);
+  void map_page_delete();
+
   int max_same;    // allocated size of sametag
 
   // spatial sorting of atoms
@@ -440,6 +482,7 @@ class Atom : protected Pointers {
   int *binhead;                        // 1st atom in each bin
   int *next;                           // next atom in bin
   int *permute;                        // permutation vector
+  int *binorder;                       // bin traversal order for Morton sort
   double bininvx, bininvy, bininvz;    // inverse actual bin sizes
   double bboxlo[3], bboxhi[3];         // bounding box of my sub-domain
 
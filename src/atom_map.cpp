@@ -19,11 +19,18 @@
 #include "memory.h"
 
 #include <cmath>
+#include <cstring>
 
 using namespace LAMMPS_NS;
 
 static constexpr int EXTRA = 1000;
 
+// max # of slots in the page table of the paged direct map
+// beyond this, sparse tags would make the table itself too large,
+//   so lookups fall back to the hash table
+
+static constexpr tagint MAP_PAGE_TABLE_MAX = 1 << 20;
+
 /* ----------------------------------------------------------------------
    allocate and initialize array or hash table for global -> local map
    for array option:
@@ -105,6 +112,34 @@ void Atom::map_init(int check)
       map_hash[map_nhash-1].next = -1;
     }
   }
+
+  // for hash option, enable the paged direct map unless sparse tags
+  //   would make the page table itself too large
+  // grow page table to span map_tag_max, keep pages already allocated,
+  //   blank all pages since the map must start out empty
+
+  if (map_style == MAP_HASH) {
+    tagint npage = (map_tag_max >> MAP_PAGE_BITS) + 1;
+    if (map_tag_max >= 0 && npage <= MAP_PAGE_TABLE_MAX) {
+      if (npage > map_npage) {
+        auto newpage = new int*[npage];
+        for (tagint i = 0; i < map_npage; i++) newpage[i] = map_page[i];
+        for (tagint i = map_npage; i < npage; i++) newpage[i] = nullptr;
+        delete [] map_page;
+        map_page = newpage;
+        map_npage = npage;
+      }
+      for (tagint i = 0; i < map_npage; i++)
+        if (map_page[i]) memset(map_page[i],0xff,MAP_PAGE_SIZE*sizeof(int));
+      map_pflag = 1;
+    } else {
+      map_page_delete();
+      map_pflag = 0;
+    }
+  } else if (map_pflag) {
+    map_page_delete();
+    map_pflag = 0;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -122,6 +157,14 @@ void Atom::map_clear()
       map_array[tag[i]] = -1;
     }
 
+  } else if (map_pflag) {
+    int nall = nlocal + nghost;
+    for (int i = 0; i < nall; i++) {
+      if (sametag) sametag[i] = -1;
+      int *page = map_page[tag[i] >> MAP_PAGE_BITS];
+      if (page) page[tag[i] & (MAP_PAGE_SIZE-1)] = -1;
+    }
+
   } else {
     int previous,ibucket,index;
     tagint global;
@@ -200,6 +243,19 @@ void Atom::map_set()
       memory->create(sametag,max_same,"atom:sametag");
     }
 
+    // paged map works like the array map,
+    //   except pages are allocated as tag ranges are encountered
+
+    if (map_pflag) {
+      for (int i = nall-1; i >= 0; i--) {
+        int *page = map_page_get(tag[i]);
+        const int offset = tag[i] & (MAP_PAGE_SIZE-1);
+        sametag[i] = page[offset];
+        page[offset] = i;
+      }
+      return;
+    }
+
     int previous,ibucket,index;
     tagint global;
 
@@ -249,7 +305,9 @@ void Atom::map_set()
 void Atom::map_one(tagint global, int local)
 {
   if (map_style == MAP_ARRAY) map_array[global] = local;
-  else {
+  else if (map_pflag) {
+    map_page_get(global)[global & (MAP_PAGE_SIZE-1)] = local;
+  } else {
     // search for key
     // if found it, just overwrite local value with index
 
@@ -330,6 +388,9 @@ void Atom::map_delete()
   sametag = nullptr;
   max_same = 0;
 
+  map_page_delete();
+  map_pflag = 0;
+
   if (map_style == MAP_ARRAY) {
     memory->destroy(map_array);
     map_array = nullptr;
@@ -344,6 +405,35 @@ void Atom::map_delete()
   }
 }
 
+/* ----------------------------------------------------------------------
+   return page of paged map containing global ID
+   allocate and blank the page if its tag range was not yet populated
+------------------------------------------------------------------------- */
+
+int *Atom::map_page_get(tagint global)
+{
+  tagint ipage = global >> MAP_PAGE_BITS;
+  int *page = map_page[ipage];
+  if (!page) {
+    page = new int[MAP_PAGE_SIZE];
+    memset(page,0xff,MAP_PAGE_SIZE*sizeof(int));
+    map_page[ipage] = page;
+  }
+  return page;
+}
+
+/* ----------------------------------------------------------------------
+   free the page table and all pages of the paged map
+------------------------------------------------------------------------- */
+
+void Atom::map_page_delete()
+{
+  for (tagint i = 0; i < map_npage; i++) delete [] map_page[i];
+  delete [] map_page;
+  map_page = nullptr;
+  map_npage = 0;
+}
+
 /* ----------------------------------------------------------------------
    lookup global ID in hash table, return local index
    called by map() in atom.h
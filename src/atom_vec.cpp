@@ -23,6 +23,8 @@
 #include "memory.h"
 #include "modify.h"
 
+#include <algorithm>
+
 using namespace LAMMPS_NS;
 
 // peratom variables that are auto-included in corresponding child style field lists
@@ -71,6 +73,9 @@ AtomVec::AtomVec(LAMMPS *lmp) : Pointers(lmp)
   x_hold = nullptr;
   v_hold = omega_hold = angmom_hold = nullptr;
 
+  sortshadow = nullptr;
+  maxshadow = 0;
+
   threads = nullptr;
 }
 
@@ -115,6 +120,10 @@ AtomVec::~AtomVec()
     }
   }
 
+  for (auto &m : soa_mirrors) memory->destroy(m.columns);
+
+  memory->sfree(sortshadow);
+
   delete[] threads;
 }
 
@@ -156,6 +165,79 @@ void AtomVec::init()
     error->all(FLERR, "KOKKOS package requires a kokkos enabled atom_style");
 }
 
+/* ----------------------------------------------------------------------
+   rebuild forward/border comm field lists, deferring unconsumed fields
+   fields listed in fields_ghost_lazy are dropped from forward and
+     border comm unless a consumer registered them via
+     Atom::add_ghost_field(), leaving their ghost values unset until
+     forwarded on demand via Comm::forward_field()
+   may restore the comm_x_only fast path when the only forward comm
+     fields of a style go unconsumed
+   called by Comm::init() after all styles have made their requests
+   no-op with KOKKOS: its device pack/unpack kernels use fixed buffer
+     offsets per style and do not consult the field lists
+------------------------------------------------------------------------- */
+
+void AtomVec::defer_ghost_fields()
+{
+  int n, cols;
+
+  if (fields_ghost_lazy.empty()) return;
+  if (lmp->kokkos) return;
+
+  std::vector<std::string> comm = fields_comm;
+  std::vector<std::string> comm_vel = fields_comm_vel;
+  std::vector<std::string> border = fields_border;
+  std::vector<std::string> border_vel = fields_border_vel;
+  for (const auto &name : fields_ghost_lazy) {
+    if (atom->ghost_field_requested(name)) continue;
+    for (auto fields : {&comm, &comm_vel, &border, &border_vel})
+      fields->erase(std::remove(fields->begin(), fields->end(), name), fields->end());
+  }
+
+  ncomm = process_fields(comm, default_comm, &mcomm);
+  ncomm_vel = process_fields(comm_vel, default_comm_vel, &mcomm_vel);
+  nborder = process_fields(border, default_border, &mborder);
+  nborder_vel = process_fields(border_vel, default_border_vel, &mborder_vel);
+  init_method(ncomm, &mcomm);
+  init_method(ncomm_vel, &mcomm_vel);
+  init_method(nborder, &mborder);
+  init_method(nborder_vel, &mborder_vel);
+
+  comm_x_only = 1;
+  if (ncomm) comm_x_only = 0;
+  if (bonus_flag && size_forward_bonus) comm_x_only = 0;
+
+  size_forward = 3;
+  for (n = 0; n < ncomm; n++) {
+    cols = mcomm.cols[n];
+    if (cols == 0)
+      size_forward++;
+    else
+      size_forward += cols;
+  }
+  if (bonus_flag) size_forward += size_forward_bonus;
+
+  size_border = 6;
+  for (n = 0; n < nborder; n++) {
+    cols = mborder.cols[n];
+    if (cols == 0)
+      size_border++;
+    else
+      size_border += cols;
+  }
+  if (bonus_flag) size_border += size_border_bonus;
+
+  size_velocity = 3;
+  for (n = 0; n < ncomm_vel; n++) {
+    cols = mcomm_vel.cols[n];
+    if (cols == 0)
+      size_velocity++;
+    else
+      size_velocity += cols;
+  }
+}
+
 static constexpr bigint DELTA = 16384;
 
 /* ----------------------------------------------------------------------
@@ -209,6 +291,7 @@ void AtomVec::grow(int n)
   else
     nmax = MAX(n, nmax);
   atom->nmax = nmax;
+  atom->peratom_epoch++;
   if (nmax < 0 || nmax > MAXSMALLINT) error->one(FLERR, "Per-processor system is too big");
 
   tag = memory->grow(atom->tag, nmax, "atom:tag");
@@ -347,6 +430,68 @@ void AtomVec::copy(int i, int j, int delflag)
       modify->fix[atom->extra_grow[iextra]]->copy_arrays(i, j, delflag);
 }
 
+/* ----------------------------------------------------------------------
+   apply a permutation to the first N atoms, for Atom::sort()
+   permute[I] = J means Ith new atom is Jth old atom
+   gather each per-atom array in one streaming pass through the shadow
+     buffer instead of cycle swaps through element-wise copy()
+   variable-width rows are gathered at their full allocated width
+   does NOT touch bonus data or fixes with atom-based arrays
+------------------------------------------------------------------------- */
+
+void AtomVec::reorder(int *permute)
+{
+  int n, ncols, datatype;
+  void *pdata;
+
+  const int nlocal = atom->nlocal;
+
+  reorder_gather(tag, nlocal, permute);
+  reorder_gather(type, nlocal, permute);
+  reorder_gather(mask, nlocal, permute);
+  reorder_gather(image, nlocal, permute);
+  reorder_gather(x, 3, nlocal, permute);
+  reorder_gather(v, 3, nlocal, permute);
+
+  for (n = 0; n < ncopy; n++) {
+    pdata = mcopy.pdata[n];
+    datatype = mcopy.datatype[n];
+    ncols = mcopy.cols[n];
+    if (ncols < 0) ncols = *(mcopy.maxcols[n]);
+    if (datatype == Atom::DOUBLE) {
+      if (mcopy.cols[n] == 0)
+        reorder_gather(*((double **) pdata), nlocal, permute);
+      else
+        reorder_gather(*((double ***) pdata), ncols, nlocal, permute);
+    } else if (datatype == Atom::INT) {
+      if (mcopy.cols[n] == 0)
+        reorder_gather(*((int **) pdata), nlocal, permute);
+      else
+        reorder_gather(*((int ***) pdata), ncols, nlocal, permute);
+    } else if (datatype == Atom::BIGINT) {
+      if (mcopy.cols[n] == 0)
+        reorder_gather(*((bigint **) pdata), nlocal, permute);
+      else
+        reorder_gather(*((bigint ***) pdata), ncols, nlocal, permute);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   persistent shadow buffer backing the reorder_gather() methods
+   grown to the largest single per-atom array seen so far
+------------------------------------------------------------------------- */
+
+void *AtomVec::sort_shadow(bigint nbytes)
+{
+  if (nbytes > maxshadow) {
+    memory->sfree(sortshadow);
+    maxshadow = nbytes;
+    sortshadow = (char *) memory->smalloc(maxshadow, "atom:sortshadow");
+  }
+  return sortshadow;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int AtomVec::pack_comm(int n, int *list, double *buf, int pbc_flag, int *pbc)
@@ -1165,10 +1310,18 @@ int AtomVec::pack_exchange(int i, double *buf)
   buf[m++] = v[i][0];
   buf[m++] = v[i][1];
   buf[m++] = v[i][2];
+
+  // pack pairs of 32-bit values into single 8-byte buffer entries
+  //   to reduce the volume of exchange communication
+  // tag and image are paired unless -DLAMMPS_BIGBIG makes them 64-bit
+
+#if defined(LAMMPS_BIGBIG)
   buf[m++] = ubuf(tag[i]).d;
-  buf[m++] = ubuf(type[i]).d;
-  buf[m++] = ubuf(mask[i]).d;
   buf[m++] = ubuf(image[i]).d;
+#else
+  buf[m++] = ubuf((int64_t) (((uint64_t) (uint32_t) tag[i] << 32) | (uint32_t) image[i])).d;
+#endif
+  buf[m++] = ubuf((int64_t) (((uint64_t) (uint32_t) type[i] << 32) | (uint32_t) mask[i])).d;
 
   if (nexchange) {
     for (nn = 0; nn < nexchange; nn++) {
@@ -1259,10 +1412,21 @@ int AtomVec::unpack_exchange(double *buf)
   v[nlocal][0] = buf[m++];
   v[nlocal][1] = buf[m++];
   v[nlocal][2] = buf[m++];
+
+  // unpack the pairs of 32-bit values packed by pack_exchange()
+
+  uint64_t two;
+#if defined(LAMMPS_BIGBIG)
   tag[nlocal] = (tagint) ubuf(buf[m++]).i;
-  type[nlocal] = (int) ubuf(buf[m++]).i;
-  mask[nlocal] = (int) ubuf(buf[m++]).i;
   image[nlocal] = (imageint) ubuf(buf[m++]).i;
+#else
+  two = (uint64_t) ubuf(buf[m++]).i;
+  tag[nlocal] = (tagint) (int32_t) (two >> 32);
+  image[nlocal] = (imageint) (uint32_t) two;
+#endif
+  two = (uint64_t) ubuf(buf[m++]).i;
+  type[nlocal] = (int) (int32_t) (two >> 32);
+  mask[nlocal] = (int) (int32_t) (uint32_t) two;
 
   if (nexchange) {
     for (nn = 0; nn < nexchange; nn++) {
@@ -2348,6 +2512,85 @@ void AtomVec::write_data_restore_restricted()
   }
 }
 
+/* ----------------------------------------------------------------------
+   find or create the structure-of-arrays mirror of a per-atom array
+   field must be a per-atom double array with a fixed # of columns
+------------------------------------------------------------------------- */
+
+AtomVec::SoAMirror *AtomVec::soa_mirror(const std::string &field)
+{
+  for (auto &m : soa_mirrors)
+    if (m.name == field) return &m;
+
+  const auto &peratom = atom->peratom;
+  const int nperatom = peratom.size();
+
+  int match;
+  for (match = 0; match < nperatom; match++)
+    if (field == peratom[match].name) break;
+  if (match == nperatom) error->all(FLERR, "Peratom field {} not recognized", field);
+  if (peratom[match].datatype != Atom::DOUBLE || peratom[match].cols <= 0)
+    error->all(FLERR, "Peratom field {} is not a fixed-width double array", field);
+
+  SoAMirror m;
+  m.name = field;
+  m.pdata = peratom[match].address;
+  m.cols = peratom[match].cols;
+  m.nmax = 0;
+  m.columns = nullptr;
+  soa_mirrors.push_back(m);
+  return &soa_mirrors.back();
+}
+
+/* ----------------------------------------------------------------------
+   refresh the structure-of-arrays mirror of a per-atom array, return it
+   result = one contiguous unit-stride column per column of the array,
+     each padded to a multiple of 8 doubles so that every column starts
+     on an allocation boundary when LAMMPS_MEMALIGN is in effect
+   values are copies, valid for owned+ghost atoms until atoms are
+     migrated, sorted, or modified: re-gather after any such change
+------------------------------------------------------------------------- */
+
+double **AtomVec::soa_gather(const std::string &field)
+{
+  SoAMirror *m = soa_mirror(field);
+
+  if (atom->nmax > m->nmax) {
+    m->nmax = (atom->nmax + 7) / 8 * 8;
+    memory->destroy(m->columns);
+    memory->create(m->columns, m->cols, m->nmax, "atom:soa");
+  }
+
+  double **array = *((double ***) m->pdata);
+  const int nall = atom->nlocal + atom->nghost;
+
+  for (int ic = 0; ic < m->cols; ic++) {
+    double *column = m->columns[ic];
+    for (int i = 0; i < nall; i++) column[i] = array[i][ic];
+  }
+
+  return m->columns;
+}
+
+/* ----------------------------------------------------------------------
+   write the columns of a structure-of-arrays mirror back to its array
+   overwrites the owned+ghost values, so must pair with a prior gather
+------------------------------------------------------------------------- */
+
+void AtomVec::soa_scatter(const std::string &field)
+{
+  SoAMirror *m = soa_mirror(field);
+  if (!m->columns) error->all(FLERR, "Scatter of peratom field {} without prior gather", field);
+
+  double **array = *((double ***) m->pdata);
+  const int nall = atom->nlocal + atom->nghost;
+
+  for (int ic = 0; ic < m->cols; ic++) {
+    double *column = m->columns[ic];
+    for (int i = 0; i < nall; i++) array[i][ic] = column[i];
+  }
+}
+
 /* ----------------------------------------------------------------------
    return # of bytes of allocated memory
 ------------------------------------------------------------------------- */
@@ -2402,6 +2645,10 @@ double AtomVec::memory_usage()
     }
   }
 
+  for (const auto &m : soa_mirrors) bytes += memory->usage(m.columns, m.cols, m.nmax);
+
+  bytes += maxshadow;
+
   if (bonus_flag) bytes += memory_usage_bonus();
 
   return bytes;
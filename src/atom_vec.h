@@ -15,6 +15,7 @@
 #define LMP_ATOM_VEC_H
 
 #include "pointers.h"    // IWYU pragma: export
+#include <cstring>
 #include <vector>
 
 namespace LAMMPS_NS {
@@ -64,6 +65,12 @@ class AtomVec : protected Pointers {
   std::vector<std::string> fields_exchange, fields_restart, fields_create;
   std::vector<std::string> fields_data_atom, fields_data_vel;
 
+  // fields only communicated to ghost atoms when a consumer requests them
+  // may appear in fields_comm, fields_comm_vel, fields_border,
+  //   fields_border_vel, see Atom::add_ghost_field() and defer_ghost_fields()
+
+  std::vector<std::string> fields_ghost_lazy;
+
   // methods
 
   AtomVec(class LAMMPS *);
@@ -79,6 +86,8 @@ class AtomVec : protected Pointers {
   virtual void grow(int);
   virtual void grow_pointers() {}
   virtual void copy(int, int, int);
+  virtual void reorder(int *);
+  void defer_ghost_fields();
 
   virtual void copy_bonus(int, int, int) {}
   virtual void clear_bonus() {}
@@ -158,6 +167,39 @@ class AtomVec : protected Pointers {
   virtual int property_atom(const std::string &) { return -1; }
   virtual void pack_property_atom(int, double *, int, int) {}
 
+  double **soa_gather(const std::string &);
+  void soa_scatter(const std::string &);
+
+  // permutation-gather of one per-atom array through a persistent shadow
+  // buffer, used by reorder() and by fixes in Fix::reorder_arrays()
+  // permute[I] = J means Ith new atom is Jth old atom
+
+  void *sort_shadow(bigint);
+
+  template <typename TYPE> void reorder_gather(TYPE *vec, int n, int *permute)
+  {
+    if (n == 0) return;
+    TYPE *shadow = (TYPE *) sort_shadow((bigint) sizeof(TYPE) * n);
+    for (int i = 0; i < n; i++) shadow[i] = vec[permute[i]];
+    memcpy(vec, shadow, sizeof(TYPE) * n);
+  }
+
+  template <typename TYPE> void reorder_gather_rows(TYPE *data, int cols, int n, int *permute)
+  {
+    if (n == 0 || cols == 0) return;
+    TYPE *shadow = (TYPE *) sort_shadow((bigint) sizeof(TYPE) * cols * n);
+    const size_t rowbytes = sizeof(TYPE) * cols;
+    for (int i = 0; i < n; i++)
+      memcpy(&shadow[(bigint) i * cols], &data[(bigint) permute[i] * cols], rowbytes);
+    memcpy(data, shadow, rowbytes * n);
+  }
+
+  template <typename TYPE> void reorder_gather(TYPE **array, int cols, int n, int *permute)
+  {
+    if (n == 0 || cols == 0) return;
+    reorder_gather_rows(&array[0][0], cols, n, permute);
+  }
+
   virtual double memory_usage();
   virtual double memory_usage_bonus() { return 0; }
 
@@ -201,6 +243,24 @@ class AtomVec : protected Pointers {
   Method mcomm, mcomm_vel, mreverse, mborder, mborder_vel, mexchange, mrestart;
   Method mcreate, mdata_atom, mdata_vel;
 
+  // opt-in structure-of-arrays mirrors of per-atom arrays
+  // one aligned, padded, unit-stride column per array column
+
+  struct SoAMirror {
+    std::string name;    // name of mirrored field in Atom::peratom
+    void *pdata;         // ptr to the double ** variable holding the array
+    int cols;            // # of columns in the mirrored array
+    int nmax;            // per-column allocation, padded multiple of atom->nmax
+    double **columns;    // cols arrays of length nmax each
+  };
+
+  std::vector<SoAMirror> soa_mirrors;
+
+  // shadow buffer backing the reorder_gather() methods
+
+  char *sortshadow;
+  bigint maxshadow;
+
   int ngrow, ncopy;
   int ncomm, ncomm_vel, nreverse, nborder, nborder_vel, nexchange, nrestart;
   int ncreate, ndata_atom, ndata_vel;
@@ -214,6 +274,7 @@ class AtomVec : protected Pointers {
 
   void grow_nmax();
   int grow_nmax_bonus(int);
+  SoAMirror *soa_mirror(const std::string &);
   void setup_fields();
   int process_fields(const std::vector<std::string> &, const std::vector<std::string> &, Method *);
   void init_method(int, Method *);
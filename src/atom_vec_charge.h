@@ -27,6 +27,11 @@ namespace LAMMPS_NS {
 class AtomVecCharge : virtual public AtomVec {
  public:
   AtomVecCharge(class LAMMPS *);
+
+  int pack_border(int, int *, double *, int, int *) override;
+  int pack_border_vel(int, int *, double *, int, int *) override;
+  void unpack_border(int, int, double *) override;
+  void unpack_border_vel(int, int, double *) override;
 };
 
 }    // namespace LAMMPS_NS
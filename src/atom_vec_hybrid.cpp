@@ -153,6 +153,7 @@ void AtomVecHybrid::process_args(int narg, char **arg)
     merge_fields(fields_create, styles[k]->fields_create, 0, concat_dummy);
     merge_fields(fields_data_atom, styles[k]->fields_data_atom, 0, concat_dummy);
     merge_fields(fields_data_vel, styles[k]->fields_data_vel, 0, concat_dummy);
+    merge_fields(fields_ghost_lazy, styles[k]->fields_ghost_lazy, 0, concat_dummy);
   }
 
   // check concat_grow for multiple special-case fields
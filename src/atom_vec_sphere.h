@@ -31,6 +31,10 @@ class AtomVecSphere : virtual public AtomVec {
   void init() override;
 
   void grow_pointers() override;
+  int pack_border(int, int *, double *, int, int *) override;
+  int pack_border_vel(int, int *, double *, int, int *) override;
+  void unpack_border(int, int, double *) override;
+  void unpack_border_vel(int, int, double *) override;
   void create_atom_post(int) override;
   void data_atom_post(int) override;
   void pack_data_pre(int) override;
@@ -439,6 +439,7 @@ void Balance::options(int iarg, int narg, char **arg, int sortflag_default)
   int outarg = 0;
   fp = nullptr;
   oldrcb = 0;
+  rcbreuse = 0;
 
   while (iarg < narg) {
     if (strcmp(arg[iarg],"weight") == 0) {
@@ -481,6 +482,11 @@ void Balance::options(int iarg, int narg, char **arg, int sortflag_default)
       outarg = iarg+1;
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"reuse") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "balance reuse", error);
+      rcbreuse = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"old") == 0) {
       oldrcb = 1;
       iarg++;
@@ -582,6 +588,11 @@ int *Balance::bisection()
 {
   if (!rcb) rcb = new RCB(lmp);
 
+  // warm-start cuts from previous bisection if requested
+  // only matters for repeated invocations, e.g. via fix balance
+
+  rcb->reuse = rcbreuse;
+
   int dim = domain->dimension;
   int triclinic = domain->triclinic;
 
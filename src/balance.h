@@ -54,6 +54,7 @@ class Balance : public Command {
   int xflag, yflag, zflag;                            // xyz LB flags
   double *user_xsplit, *user_ysplit, *user_zsplit;    // params for xyz LB
   int oldrcb;                                         // use old-style RCB compute
+  int rcbreuse;                                       // warm-start RCB cuts from previous LB
 
   int nitermax;    // params for shift LB
   double stopthresh;
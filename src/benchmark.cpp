@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "benchmark.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "domain.h"
+#include "error.h"
+#include "input.h"
+#include "timer.h"
+
+#include <cstring>
+
+using namespace LAMMPS_NS;
+
+// timing sections reported per run, same set as the Finish breakdown
+
+static const Timer::ttype sections[] = {Timer::PAIR, Timer::BOND,   Timer::KSPACE, Timer::NEIGH,
+                                        Timer::COMM, Timer::MODIFY, Timer::OUTPUT};
+static const char *const section_names[] = {"pair", "bond",   "kspace", "neigh",
+                                            "comm", "modify", "output"};
+static constexpr int NSECTIONS = sizeof(sections) / sizeof(sections[0]);
+
+/* ---------------------------------------------------------------------- */
+
+Benchmark::Benchmark(LAMMPS *lmp) : Command(lmp) {}
+
+/* ----------------------------------------------------------------------
+   run the current system at one or more replication levels and write
+   a YAML report with per-level size, throughput, and timing breakdown
+------------------------------------------------------------------------- */
+
+void Benchmark::command(int narg, char **arg)
+{
+  if (domain->box_exist == 0)
+    error->all(FLERR, "Benchmark command before simulation box is defined");
+  if (narg < 2) utils::missing_cmd_args(FLERR, "benchmark", error);
+  if (!timer->has_normal())
+    error->all(FLERR, "Benchmark command requires timer setting normal or full");
+
+  bigint nsteps = utils::bnumeric(FLERR, arg[0], false, lmp);
+  if (nsteps <= 0) error->all(FLERR, "Invalid benchmark run length {}", nsteps);
+  std::string filename = arg[1];
+
+  // optional keywords
+
+  int nlevels = 1;
+  int repfactor[3] = {2, 2, 2};
+
+  int iarg = 2;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg], "levels") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "benchmark levels", error);
+      nlevels = utils::inumeric(FLERR, arg[iarg + 1], false, lmp);
+      if (nlevels <= 0) error->all(FLERR, "Invalid benchmark levels value {}", nlevels);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "replicate") == 0) {
+      if (iarg + 4 > narg) utils::missing_cmd_args(FLERR, "benchmark replicate", error);
+      for (int i = 0; i < 3; i++) {
+        repfactor[i] = utils::inumeric(FLERR, arg[iarg + 1 + i], false, lmp);
+        if (repfactor[i] <= 0)
+          error->all(FLERR, "Invalid benchmark replicate factor {}", repfactor[i]);
+      }
+      iarg += 4;
+    } else
+      error->all(FLERR, "Unknown benchmark keyword: {}", arg[iarg]);
+  }
+
+  FILE *fp = nullptr;
+  if (comm->me == 0) {
+    fp = fopen(filename.c_str(), "w");
+    if (!fp)
+      error->one(FLERR, "Cannot open benchmark report file {}: {}", filename,
+                 utils::getsyserror());
+    fmt::print(fp, "---\nlammps_version: {}\n", lmp->version);
+    fmt::print(fp, "date: {}\n", utils::current_date());
+    fmt::print(fp, "nprocs: {}\n", comm->nprocs);
+    fmt::print(fp, "nthreads: {}\n", comm->nthreads);
+    fmt::print(fp, "runs:\n");
+  }
+
+  for (int ilevel = 0; ilevel < nlevels; ilevel++) {
+
+    // grow system between levels, then run
+    // both commands go through Input so they behave exactly as scripted
+
+    if (ilevel > 0)
+      input->one(fmt::format("replicate {} {} {}", repfactor[0], repfactor[1], repfactor[2]));
+    input->one(fmt::format("run {}", nsteps));
+
+    // timing data from the run just completed, averaged over procs
+    // "other" is loop time not covered by any timed section, as in Finish
+
+    double tmp;
+    double time_loop = timer->get_wall(Timer::TOTAL);
+    MPI_Allreduce(&time_loop, &tmp, 1, MPI_DOUBLE, MPI_SUM, world);
+    time_loop = tmp / comm->nprocs;
+
+    double time_section[NSECTIONS];
+    double time_other = time_loop;
+    for (int i = 0; i < NSECTIONS; i++) {
+      double t = timer->get_wall(sections[i]);
+      MPI_Allreduce(&t, &tmp, 1, MPI_DOUBLE, MPI_SUM, world);
+      time_section[i] = tmp / comm->nprocs;
+      time_other -= time_section[i];
+    }
+
+    if (comm->me == 0) {
+      fmt::print(fp, "  - natoms: {}\n", atom->natoms);
+      fmt::print(fp, "    nsteps: {}\n", nsteps);
+      fmt::print(fp, "    wall_time: {:.6g}\n", time_loop);
+      if (time_loop > 0.0) {
+        fmt::print(fp, "    steps_per_second: {:.6g}\n", nsteps / time_loop);
+        fmt::print(fp, "    atom_steps_per_second: {:.6g}\n",
+                   (double) atom->natoms * (double) nsteps / time_loop);
+      }
+      fmt::print(fp, "    breakdown:\n");
+      for (int i = 0; i < NSECTIONS; i++)
+        fmt::print(fp, "      {}: {:.6g}\n", section_names[i], time_section[i]);
+      fmt::print(fp, "      other: {:.6g}\n", time_other);
+      fflush(fp);
+    }
+  }
+
+  if (comm->me == 0) {
+    fmt::print(fp, "...\n");
+    fclose(fp);
+  }
+}
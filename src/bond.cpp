@@ -23,6 +23,11 @@
 #include "suffix.h"
 #include "update.h"
 
+#include <cstring>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 enum { NONE, LINEAR, SPLINE };
@@ -38,8 +43,9 @@ int Bond::instance_total = 0;
 
 Bond::Bond(LAMMPS *_lmp) :
     Pointers(_lmp), setflag(nullptr), virial{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, eatom(nullptr),
-    vatom(nullptr), svector(nullptr)
+    vatom(nullptr), svector(nullptr), fthread(nullptr)
 {
+  maxthread = 0;
   instance_me = instance_total++;
 
   energy = 0.0;
@@ -71,6 +77,7 @@ Bond::~Bond()
 
   memory->destroy(eatom);
   memory->destroy(vatom);
+  memory->destroy(fthread);
 }
 
 /* ----------------------------------------------------------------------
@@ -425,10 +432,78 @@ void Bond::write_file(int narg, char **arg)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   evaluate all bonded terms via compute_partial() with one force buffer
+   per thread, then reduce the buffers into the global force array.
+   only used on steps without energy/virial tallying, so styles need no
+   per-thread accumulators.  returns 0 if the style must evaluate its
+   terms on the serial path instead.
+------------------------------------------------------------------------- */
+
+int Bond::compute_threaded(int eflag, int vflag)
+{
+#if defined(_OPENMP)
+  const int nthreads = comm->nthreads;
+  const int nbondlist = neighbor->nbondlist;
+  if (evflag || nthreads == 1 || nbondlist < 512) return 0;
+
+  const int nall = atom->nlocal + atom->nghost;
+  if (atom->nmax > maxthread) {
+    maxthread = atom->nmax;
+    memory->destroy(fthread);
+    memory->create(fthread, (bigint) (nthreads - 1) * maxthread, 3, "bond:fthread");
+  }
+
+  double **f = atom->f;
+
+#pragma omp parallel default(shared)
+  {
+    const int tid = omp_get_thread_num();
+
+    // thread 0 adds directly to the global array, all others to a
+    // private buffer which must be cleared first
+
+    double **fpart;
+    if (tid == 0) fpart = f;
+    else {
+      fpart = fthread + (bigint) (tid - 1) * maxthread;
+      memset(&fpart[0][0], 0, (size_t) nall * 3 * sizeof(double));
+    }
+
+    const int nfrom = (int) ((bigint) tid * nbondlist / nthreads);
+    const int nto = (int) ((bigint) (tid + 1) * nbondlist / nthreads);
+    compute_partial(nfrom, nto, fpart, eflag, vflag);
+
+#pragma omp barrier
+
+    // each thread reduces a disjoint range of atoms
+
+    const int ifrom = (int) ((bigint) tid * nall / nthreads);
+    const int ito = (int) ((bigint) (tid + 1) * nall / nthreads);
+    for (int n = 0; n < nthreads - 1; n++) {
+      double **fsrc = fthread + (bigint) n * maxthread;
+      for (int i = ifrom; i < ito; i++) {
+        f[i][0] += fsrc[i][0];
+        f[i][1] += fsrc[i][1];
+        f[i][2] += fsrc[i][2];
+      }
+    }
+  }
+  return 1;
+#else
+  (void) eflag;
+  (void) vflag;
+  return 0;
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
 double Bond::memory_usage()
 {
   double bytes = (double) comm->nthreads * maxeatom * sizeof(double);
   bytes += (double) comm->nthreads * maxvatom * 6 * sizeof(double);
+  if (fthread) bytes += (double) (comm->nthreads - 1) * maxthread * 3 * sizeof(double);
   return bytes;
 }
 
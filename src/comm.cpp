@@ -57,6 +57,7 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   mode = 0;
   bordergroup = 0;
   cutghostuser = 0.0;
+  cutghostuserdim[0] = cutghostuserdim[1] = cutghostuserdim[2] = 0.0;
   cutusermulti = nullptr;
   cutusermultiold = nullptr;
   ncollections = 0;
@@ -184,6 +185,11 @@ void Comm::init()
 
   domain->subbox_too_small_check(neighbor->skin);
 
+  // defer lazily-communicated ghost fields with no registered consumer
+  // must precede copying comm_x_only and the per-atom sizes below
+
+  atom->avec->defer_ghost_fields();
+
   // comm_only = 1 if only x,f are exchanged in forward/reverse comm
   // comm_x_only = 0 if ghost_velocity since velocities are added
 
@@ -266,6 +272,41 @@ void Comm::init()
    set maxexchange based on AtomVec and fixes
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   on-demand forward comm of one named peratom field to ghost atoms
+   for consumers of border fields whose communication was deferred,
+     called before reading the ghost values of the field
+------------------------------------------------------------------------- */
+
+void Comm::forward_field(const std::string &name)
+{
+  for (const auto &field : atom->peratom) {
+    if (field.name != name) continue;
+    if (field.datatype != Atom::DOUBLE || field.cols <= 0)
+      error->all(FLERR,"Peratom field {} cannot be forwarded on demand",name);
+    forward_comm_array(field.cols,*((double ***) field.address));
+    return;
+  }
+  error->all(FLERR,"Peratom field {} for on-demand forward comm not found",name);
+}
+
+/* ----------------------------------------------------------------------
+   split-phase forward communication invoked by a Fix
+   caller may overlap independent work between start() and finish(),
+     as long as it does not alter the data being packed or unpacked
+   default implementation completes the exchange in start(),
+     comm styles with a nonblocking variant override both methods
+------------------------------------------------------------------------- */
+
+void Comm::forward_comm_start(Fix *fix, int size)
+{
+  forward_comm(fix,size);
+}
+
+void Comm::forward_comm_finish(Fix * /*fix*/) {}
+
+/* ---------------------------------------------------------------------- */
+
 void Comm::init_exchange()
 {
   maxexchange_fix = 0;
@@ -301,6 +342,7 @@ void Comm::modify_params(int narg, char **arg)
         // need to reset cutghostuser when switching comm mode
         if (mode == Comm::SINGLE) cutghostuser = 0.0;
         if (mode == Comm::MULTIOLD) cutghostuser = 0.0;
+        cutghostuserdim[0] = cutghostuserdim[1] = cutghostuserdim[2] = 0.0;
         memory->destroy(cutusermultiold);
         mode = Comm::MULTI;
       } else if (strcmp(arg[iarg+1],"multi/old") == 0) {
@@ -309,6 +351,7 @@ void Comm::modify_params(int narg, char **arg)
         // need to reset cutghostuser when switching comm mode
         if (mode == Comm::SINGLE) cutghostuser = 0.0;
         if (mode == Comm::MULTI) cutghostuser = 0.0;
+        cutghostuserdim[0] = cutghostuserdim[1] = cutghostuserdim[2] = 0.0;
         memory->destroy(cutusermulti);
         mode = Comm::MULTIOLD;
       } else error->all(FLERR,"Unknown comm_modify mode argument: {}", arg[iarg+1]);
@@ -331,6 +374,18 @@ void Comm::modify_params(int narg, char **arg)
       if (cutghostuser < 0.0)
         error->all(FLERR,"Invalid cutoff {} in comm_modify command", arg[iarg+1]);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"cutoff/dim") == 0) {
+      if (iarg+4 > narg) utils::missing_cmd_args(FLERR, "comm_modify cutoff/dim", error);
+      if (mode == Comm::MULTI)
+        error->all(FLERR, "Use cutoff/multi keyword to set cutoff in multi mode");
+      if (mode == Comm::MULTIOLD)
+        error->all(FLERR, "Use cutoff/multi/old keyword to set cutoff in multi mode");
+      for (int idim = 0; idim < 3; idim++) {
+        cutghostuserdim[idim] = utils::numeric(FLERR,arg[iarg+1+idim],false,lmp);
+        if (cutghostuserdim[idim] < 0.0)
+          error->all(FLERR,"Invalid cutoff {} in comm_modify command", arg[iarg+1+idim]);
+      }
+      iarg += 4;
     } else if (strcmp(arg[iarg],"cutoff/multi") == 0) {
       int i,nlo,nhi;
       double cut;
@@ -432,7 +487,8 @@ void Comm::set_processors(int narg, char **arg)
         if (iarg+6 > narg) error->all(FLERR,"Illegal processors command");
         gridflag = TWOLEVEL;
 
-        ncores = utils::inumeric(FLERR,arg[iarg+2],false,lmp);
+        if (strcmp(arg[iarg+2],"*") == 0) ncores = 0;
+        else ncores = utils::inumeric(FLERR,arg[iarg+2],false,lmp);
         if (strcmp(arg[iarg+3],"*") == 0) user_coregrid[0] = 0;
         else user_coregrid[0] = utils::inumeric(FLERR,arg[iarg+3],false,lmp);
         if (strcmp(arg[iarg+4],"*") == 0) user_coregrid[1] = 0;
@@ -440,7 +496,7 @@ void Comm::set_processors(int narg, char **arg)
         if (strcmp(arg[iarg+5],"*") == 0) user_coregrid[2] = 0;
         else user_coregrid[2] = utils::inumeric(FLERR,arg[iarg+5],false,lmp);
 
-        if (ncores <= 0 || user_coregrid[0] < 0 ||
+        if (ncores < 0 || user_coregrid[0] < 0 ||
             user_coregrid[1] < 0 || user_coregrid[2] < 0)
           error->all(FLERR,"Illegal processors command");
         iarg += 4;
@@ -567,6 +623,14 @@ void Comm::set_proc_grid(int outflag)
                         otherflag,other_style,other_procgrid,other_coregrid);
 
   } else if (gridflag == TWOLEVEL) {
+
+    // Ncores = * means auto-detect how many procs share each node
+
+    if (ncores == 0) {
+      ncores = pmap->cores_per_node();
+      if (me == 0)
+        utils::logmesg(lmp,"Detected {} cores per node for twolevel processor grid\n",ncores);
+    }
     pmap->twolevel_grid(nprocs,user_procgrid,procgrid,
                         ncores,user_coregrid,coregrid,
                         otherflag,other_style,other_procgrid,other_coregrid);
@@ -803,6 +867,26 @@ int Comm::coord2proc(double *x, int &igx, int &igy, int &igz)
   return grid2proc[igx][igy][igz];
 }
 
+/* ----------------------------------------------------------------------
+   gather the processor names of all procs into one buffer
+   name of proc I is at offset I*MPI_MAX_PROCESSOR_NAME, null-terminated
+   used by comm styles to classify swap partners as on-node or off-node
+   caller must delete [] the returned buffer
+------------------------------------------------------------------------- */
+
+char *Comm::gather_node_names()
+{
+  char myname[MPI_MAX_PROCESSOR_NAME];
+  memset(myname,0,MPI_MAX_PROCESSOR_NAME);
+  int len;
+  MPI_Get_processor_name(myname,&len);
+
+  char *names = new char[(bigint) nprocs*MPI_MAX_PROCESSOR_NAME];
+  MPI_Allgather(myname,MPI_MAX_PROCESSOR_NAME,MPI_CHAR,
+                names,MPI_MAX_PROCESSOR_NAME,MPI_CHAR,world);
+  return names;
+}
+
 /* ----------------------------------------------------------------------
    communicate inbuf around full ring of processors with messtag
    nbytes = size of inbuf = n datums * nper bytes
@@ -861,6 +945,62 @@ void Comm::ring(int n, int nper, void *inbuf, int messtag,
   memory->destroy(bufcopy);
 }
 
+/* ----------------------------------------------------------------------
+   bulk-synchronous alternative to ring() for read-only callbacks
+   allgathers the inbufs of all procs, then invokes callback once per
+     proc's chunk locally, one collective instead of nprocs ring steps
+   only valid when callback does not modify the buffer it is passed,
+     i.e. equivalent to ring() with outbuf = nullptr
+   if self = 0, callback is not invoked on my own chunk
+   falls back to a ring pass if gathered data would overflow a 32-bit count
+------------------------------------------------------------------------- */
+
+void Comm::ring_gather(int n, int nper, void *inbuf,
+                       void (*callback)(int, char *, void *), void *ptr, int self)
+{
+  int nbytes = n*nper;
+
+  // sanity check
+
+  if ((nbytes > 0) && inbuf == nullptr)
+    error->one(FLERR,"Cannot put data on ring from NULL pointer");
+
+  int *counts = new int[nprocs];
+  MPI_Allgather(&nbytes,1,MPI_INT,counts,1,MPI_INT,world);
+
+  // no need to communicate without data
+
+  bigint btotal = 0;
+  for (int i = 0; i < nprocs; i++) btotal += counts[i];
+  if (btotal == 0) {
+    delete [] counts;
+    return;
+  }
+
+  if (btotal > MAXSMALLINT) {
+    delete [] counts;
+    ring(n,nper,inbuf,0,callback,nullptr,ptr,self);
+    return;
+  }
+
+  int *displs = new int[nprocs];
+  displs[0] = 0;
+  for (int i = 1; i < nprocs; i++) displs[i] = displs[i-1] + counts[i-1];
+
+  char *buf;
+  memory->create(buf,(int) btotal,"comm:buf");
+  MPI_Allgatherv(inbuf,nbytes,MPI_CHAR,buf,counts,displs,MPI_CHAR,world);
+
+  for (int iproc = 0; iproc < nprocs; iproc++) {
+    if (!self && iproc == me) continue;
+    callback(counts[iproc]/nper,&buf[displs[iproc]],ptr);
+  }
+
+  memory->destroy(buf);
+  delete [] counts;
+  delete [] displs;
+}
+
 /* ----------------------------------------------------------------------
    rendezvous communication operation
    three stages:
@@ -37,6 +37,8 @@ class Comm : protected Pointers {
   int ghost_velocity;           // 1 if ghost atoms have velocity, 0 if not
   double cutghost[3];           // cutoffs used for acquiring ghost atoms
   double cutghostuser;          // user-specified ghost cutoff (mode == SINGLE)
+  double cutghostuserdim[3];    // per-dimension user ghost cutoffs (mode == SINGLE)
+                                //   overrides cutghostuser in that dim, 0.0 if unset
   double *cutusermulti;         // per collection user ghost cutoff (mode == MULTI)
   double *cutusermultiold;      // per type user ghost cutoff (mode == MULTIOLD)
   int ncollections;             // # of collections known by comm, used to test if # has changed
@@ -92,6 +94,8 @@ class Comm : protected Pointers {
   virtual void forward_comm(class Bond *) = 0;
   virtual void reverse_comm(class Bond *) = 0;
   virtual void forward_comm(class Fix *, int size = 0) = 0;
+  virtual void forward_comm_start(class Fix *, int size = 0);
+  virtual void forward_comm_finish(class Fix *);
   virtual void reverse_comm(class Fix *, int size = 0) = 0;
   virtual void reverse_comm_variable(class Fix *) = 0;
   virtual void forward_comm(class Compute *) = 0;
@@ -103,6 +107,10 @@ class Comm : protected Pointers {
 
   virtual void forward_comm_array(int, double **) = 0;
 
+  // on-demand forward comm of one named peratom field
+
+  void forward_field(const std::string &);
+
   // map a point to a processor, based on current decomposition
 
   virtual void coord2proc_setup() {}
@@ -112,9 +120,17 @@ class Comm : protected Pointers {
 
   virtual double memory_usage() = 0;
 
+  // on-node vs off-node swap partner counts, for mapping quality stats
+
+  virtual void swap_node_counts(int &onnode, int &offnode)
+  {
+    onnode = offnode = 0;
+  }
+
   // non-virtual functions common to all Comm styles
 
   void ring(int, int, void *, int, void (*)(int, char *, void *), void *, void *, int self = 1);
+  void ring_gather(int, int, void *, void (*)(int, char *, void *), void *, int self = 1);
   int rendezvous(int, int, char *, int, int, int *,
                  int (*)(int, char *, int &, int *&, char *&, void *), int, char *&, int, void *,
                  int statflag = 0);
@@ -126,6 +142,8 @@ class Comm : protected Pointers {
  protected:
   int bordergroup;    // only communicate this group in borders
 
+  char *gather_node_names();    // processor names of all procs
+
   int triclinic;                   // 0 if domain is orthog, 1 if triclinic
   int map_style;                   // non-0 if global->local mapping is done
   int comm_x_only, comm_f_only;    // 1 if only exchange x,f in for/rev comm
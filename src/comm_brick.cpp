@@ -39,6 +39,11 @@ static constexpr double BUFFACTOR = 1.5;
 static constexpr int BUFMIN = 1024;
 static constexpr double BIG = 1.0e20;
 
+// MPI tag for split-phase fix comm, so that an outstanding receive cannot
+// match messages from blocking comm operations issued before finish()
+
+static constexpr int SPLITTAG = 7;
+
 /* ---------------------------------------------------------------------- */
 
 CommBrick::CommBrick(LAMMPS *lmp) :
@@ -47,8 +52,9 @@ CommBrick::CommBrick(LAMMPS *lmp) :
   size_forward_recv(nullptr), size_reverse_send(nullptr), size_reverse_recv(nullptr),
   slablo(nullptr), slabhi(nullptr), multilo(nullptr), multihi(nullptr),
   multioldlo(nullptr), multioldhi(nullptr), cutghostmulti(nullptr), cutghostmultiold(nullptr),
-  pbc_flag(nullptr), pbc(nullptr), firstrecv(nullptr), sendlist(nullptr),
-  localsendlist(nullptr), maxsendlist(nullptr), buf_send(nullptr), buf_recv(nullptr)
+  pbc_flag(nullptr), pbc(nullptr), firstrecv(nullptr), requests(nullptr),
+  sendlist(nullptr), localsendlist(nullptr), maxsendlist(nullptr),
+  buf_send(nullptr), buf_recv(nullptr)
 {
   style = Comm::BRICK;
   layout = Comm::LAYOUT_UNIFORM;
@@ -113,9 +119,10 @@ void CommBrick::init_buffers()
   buf_send = buf_recv = nullptr;
   maxsend = maxrecv = BUFMIN;
   CommBrick::grow_send(maxsend,2);
-  memory->create(buf_recv,maxrecv,"comm:buf_recv");
+  memory->create_arena(buf_recv,maxrecv,"comm:buf_recv");
 
   nswap = 0;
+  split_pending = 0;
   maxswap = 6;
   CommBrick::allocate_swap(maxswap);
 
@@ -250,11 +257,24 @@ void CommBrick::setup()
     }
   }
 
+  // cutdim[] = ghost cutoff in each dim = global cutoff unless overridden
+  //   per dimension via comm_modify cutoff/dim
+  // per-dim values are floored at the max neighbor cutoff so that no
+  //   ghost atoms required by the neighbor lists are excluded
+
+  double cutdim[3];
+  cutdim[0] = cutdim[1] = cutdim[2] = cut;
+  for (i = 0; i < 3; i++)
+    if (cutghostuserdim[i] > 0.0)
+      cutdim[i] = MAX(cutghostuserdim[i],neighbor->cutneighmax);
+
   if (triclinic == 0) {
     prd = domain->prd;
     sublo = domain->sublo;
     subhi = domain->subhi;
-    cutghost[0] = cutghost[1] = cutghost[2] = cut;
+    cutghost[0] = cutdim[0];
+    cutghost[1] = cutdim[1];
+    cutghost[2] = cutdim[2];
   } else {
     prd = domain->prd_lamda;
     sublo = domain->sublo_lamda;
@@ -262,11 +282,11 @@ void CommBrick::setup()
     double *h_inv = domain->h_inv;
     double length0,length1,length2;
     length0 = sqrt(h_inv[0]*h_inv[0] + h_inv[5]*h_inv[5] + h_inv[4]*h_inv[4]);
-    cutghost[0] = cut * length0;
+    cutghost[0] = cutdim[0] * length0;
     length1 = sqrt(h_inv[1]*h_inv[1] + h_inv[3]*h_inv[3]);
-    cutghost[1] = cut * length1;
+    cutghost[1] = cutdim[1] * length1;
     length2 = h_inv[2];
-    cutghost[2] = cut * length2;
+    cutghost[2] = cutdim[2] * length2;
     if (mode == Comm::MULTI) {
       for (i = 0; i < ncollections; i++) {
         cutghostmulti[i][0] *= length0;
@@ -541,23 +561,39 @@ void CommBrick::forward_comm(int /*dummy*/)
   MPI_Request request;
   AtomVec *avec = atom->avec;
   double **x = atom->x;
-  double *buf;
 
   // exchange data with another proc
   // if other proc is self, just copy
   // if comm_x_only set, exchange or copy directly to x, don't unpack
 
-  for (int iswap = 0; iswap < nswap; iswap++) {
-    if (sendproc[iswap] != me) {
-      if (comm_x_only) {
-        if (size_forward_recv[iswap]) {
-          buf = x[firstrecv[iswap]];
-          MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,recvproc[iswap],0,world,&request);
-        }
+  // with comm_x_only, every receive lands in its own disjoint block of x,
+  //   so post all of them before any swap is packed: no sender then stalls
+  //   on a receive that has not been posted yet, and messages for later
+  //   swaps flow while earlier ones are processed
+  // packing and completion waits stay in swap order since the atoms sent
+  //   in one swap can include ghosts received in a previous swap
+
+  if (comm_x_only) {
+    for (int iswap = 0; iswap < nswap; iswap++)
+      if (sendproc[iswap] != me && size_forward_recv[iswap])
+        MPI_Irecv(x[firstrecv[iswap]],size_forward_recv[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&requests[iswap]);
+
+    for (int iswap = 0; iswap < nswap; iswap++) {
+      if (sendproc[iswap] != me) {
         n = avec->pack_comm(sendnum[iswap],sendlist[iswap],buf_send,pbc_flag[iswap],pbc[iswap]);
         if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
-        if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
-      } else if (ghost_velocity) {
+        if (size_forward_recv[iswap]) MPI_Wait(&requests[iswap],MPI_STATUS_IGNORE);
+      } else if (sendnum[iswap])
+        avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+    }
+    return;
+  }
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    if (sendproc[iswap] != me) {
+      if (ghost_velocity) {
         if (size_forward_recv[iswap])
           MPI_Irecv(buf_recv,size_forward_recv[iswap],MPI_DOUBLE,recvproc[iswap],0,world,&request);
         n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],buf_send,pbc_flag[iswap],pbc[iswap]);
@@ -575,11 +611,7 @@ void CommBrick::forward_comm(int /*dummy*/)
       }
 
     } else {
-      if (comm_x_only) {
-        if (sendnum[iswap])
-          avec->pack_comm(sendnum[iswap],sendlist[iswap],
-                          x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
-      } else if (ghost_velocity) {
+      if (ghost_velocity) {
         avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],buf_send,pbc_flag[iswap],pbc[iswap]);
         avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf_send);
       } else {
@@ -668,6 +700,30 @@ void CommBrick::exchange()
   atom->nghost = 0;
   atom->avec->clear_bonus();
 
+  // if the last distance check determined no atom on any proc has left
+  //   its subdomain, the migration below is a global no-op, so skip it
+  // verdict is good for a single exchange, so reset it immediately
+
+  int needed = neighbor->exchange_needed;
+  neighbor->exchange_needed = 1;
+  if (!needed) return;
+
+  // exchange reorders the per-atom arrays
+
+  atom->peratom_epoch++;
+
+  // start a new transient-buffer epoch if the comm buffers live in the
+  //   arena (an accelerator subclass may manage its own buffers instead)
+  // re-create both buffers at their current sizes, which in steady state
+  //   is two bump suballocations from the retained high-water block
+
+  if (memory->arena_owned(buf_send)) {
+    memory->arena_clear();
+    buf_send = buf_recv = nullptr;
+    memory->create_arena(buf_send,maxsend+bufextra,"comm:buf_send");
+    memory->create_arena(buf_recv,maxrecv,"comm:buf_recv");
+  }
+
   // ensure send buf has extra space for a single atom
   // only need to reset if a fix can dynamically add to size of single atom
 
@@ -1168,6 +1224,73 @@ void CommBrick::forward_comm(Fix *fix, int size)
   }
 }
 
+/* ----------------------------------------------------------------------
+   split-phase version of forward communication invoked by a Fix
+   identical to forward_comm(Fix *) except that the receive of the last
+     swap is left outstanding, to be completed by forward_comm_finish()
+   only the last swap can be deferred: ghost atoms received in earlier
+     swaps may be packed again in later swaps
+   caller may overlap work between start and finish that does not touch
+     the data being packed or unpacked
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_start(Fix *fix, int size)
+{
+  int iswap,n,nsize;
+  double *buf;
+  MPI_Request request;
+
+  if (size) nsize = size;
+  else nsize = fix->comm_forward;
+
+  split_pending = 0;
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer
+
+    n = fix->pack_forward_comm(sendnum[iswap],sendlist[iswap],buf_send,pbc_flag[iswap],pbc[iswap]);
+
+    // exchange with another proc
+    // if self, set recv buffer to send buffer
+    // for the last swap, send and return with the receive outstanding
+
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(buf_recv,nsize*recvnum[iswap],MPI_DOUBLE,recvproc[iswap],SPLITTAG,world,&request);
+      if (sendnum[iswap])
+        MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],SPLITTAG,world);
+      if (recvnum[iswap]) {
+        if (iswap == nswap-1) {
+          split_request = request;
+          split_pending = 1;
+          return;
+        }
+        MPI_Wait(&request,MPI_STATUS_IGNORE);
+      }
+      buf = buf_recv;
+    } else buf = buf_send;
+
+    // unpack buffer
+
+    fix->unpack_forward_comm(recvnum[iswap],firstrecv[iswap],buf);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   complete a split-phase fix forward comm: wait on the outstanding
+     receive of the last swap and unpack it
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_finish(Fix *fix)
+{
+  if (!split_pending) return;
+  split_pending = 0;
+
+  MPI_Wait(&split_request,MPI_STATUS_IGNORE);
+  fix->unpack_forward_comm(recvnum[nswap-1],firstrecv[nswap-1],buf_recv);
+}
+
 /* ----------------------------------------------------------------------
    reverse communication invoked by a Fix
    size/nsize used only to set recv buffer limit
@@ -1186,11 +1309,18 @@ void CommBrick::reverse_comm(Fix *fix, int size)
   if (size) nsize = size;
   else nsize = fix->comm_reverse;
 
+  // if fix flags its reverse comm data as contiguous rows of array_atom,
+  //   skip the pack and send (or unpack for self) directly from the array
+  // only possible when communicating the full comm_reverse width
+
+  double **array = nullptr;
+  if (fix->comm_reverse_array && !size) array = fix->array_atom;
+
   for (iswap = nswap-1; iswap >= 0; iswap--) {
 
     // pack buffer
 
-    n = fix->pack_reverse_comm(recvnum[iswap],firstrecv[iswap],buf_send);
+    if (!array) n = fix->pack_reverse_comm(recvnum[iswap],firstrecv[iswap],buf_send);
 
     // exchange with another proc
     // if self, set recv buffer to send buffer
@@ -1198,11 +1328,16 @@ void CommBrick::reverse_comm(Fix *fix, int size)
     if (sendproc[iswap] != me) {
       if (sendnum[iswap])
         MPI_Irecv(buf_recv,nsize*sendnum[iswap],MPI_DOUBLE,sendproc[iswap],0,world,&request);
-      if (recvnum[iswap])
-        MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+      if (recvnum[iswap]) {
+        if (array)
+          MPI_Send(array[firstrecv[iswap]],nsize*recvnum[iswap],MPI_DOUBLE,
+                   recvproc[iswap],0,world);
+        else MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+      }
       if (sendnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
       buf = buf_recv;
-    } else buf = buf_send;
+    } else if (array && recvnum[iswap]) buf = array[firstrecv[iswap]];
+    else buf = buf_send;
 
     // unpack buffer
 
@@ -1304,11 +1439,17 @@ void CommBrick::reverse_comm(Compute *compute)
 
   int nsize = compute->comm_reverse;
 
+  // if compute flags its reverse comm data as contiguous rows of array_atom,
+  //   skip the pack and send (or unpack for self) directly from the array
+
+  double **array = nullptr;
+  if (compute->comm_reverse_array) array = compute->array_atom;
+
   for (iswap = nswap-1; iswap >= 0; iswap--) {
 
     // pack buffer
 
-    n = compute->pack_reverse_comm(recvnum[iswap],firstrecv[iswap],buf_send);
+    if (!array) n = compute->pack_reverse_comm(recvnum[iswap],firstrecv[iswap],buf_send);
 
     // exchange with another proc
     // if self, set recv buffer to send buffer
@@ -1316,11 +1457,16 @@ void CommBrick::reverse_comm(Compute *compute)
     if (sendproc[iswap] != me) {
       if (sendnum[iswap])
         MPI_Irecv(buf_recv,nsize*sendnum[iswap],MPI_DOUBLE,sendproc[iswap],0,world,&request);
-      if (recvnum[iswap])
-        MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+      if (recvnum[iswap]) {
+        if (array)
+          MPI_Send(array[firstrecv[iswap]],nsize*recvnum[iswap],MPI_DOUBLE,
+                   recvproc[iswap],0,world);
+        else MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
+      }
       if (sendnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
       buf = buf_recv;
-    } else buf = buf_send;
+    } else if (array && recvnum[iswap]) buf = array[firstrecv[iswap]];
+    else buf = buf_send;
 
     // unpack buffer
 
@@ -1467,13 +1613,13 @@ void CommBrick::grow_send(int n, int flag)
   if (flag == 0) {
     maxsend = static_cast<int> (BUFFACTOR * n);
     memory->destroy(buf_send);
-    memory->create(buf_send,maxsend+bufextra,"comm:buf_send");
+    memory->create_arena(buf_send,maxsend+bufextra,"comm:buf_send");
   } else if (flag == 1) {
     maxsend = static_cast<int> (BUFFACTOR * n);
-    memory->grow(buf_send,maxsend+bufextra,"comm:buf_send");
+    memory->grow_arena(buf_send,maxsend+bufextra,"comm:buf_send");
   } else {
     memory->destroy(buf_send);
-    memory->grow(buf_send,maxsend+bufextra,"comm:buf_send");
+    memory->grow_arena(buf_send,maxsend+bufextra,"comm:buf_send");
   }
 }
 
@@ -1485,7 +1631,7 @@ void CommBrick::grow_recv(int n)
 {
   maxrecv = static_cast<int> (BUFFACTOR * n);
   memory->destroy(buf_recv);
-  memory->create(buf_recv,maxrecv,"comm:buf_recv");
+  memory->create_arena(buf_recv,maxrecv,"comm:buf_recv");
 }
 
 /* ----------------------------------------------------------------------
@@ -1545,6 +1691,7 @@ void CommBrick::allocate_swap(int n)
   memory->create(firstrecv,n,"comm:firstrecv");
   memory->create(pbc_flag,n,"comm:pbc_flag");
   memory->create(pbc,n,6,"comm:pbc");
+  requests = new MPI_Request[n];
 }
 
 /* ----------------------------------------------------------------------
@@ -1586,6 +1733,8 @@ void CommBrick::free_swap()
   memory->destroy(firstrecv);
   memory->destroy(pbc_flag);
   memory->destroy(pbc);
+  delete[] requests;
+  requests = nullptr;
 }
 
 /* ----------------------------------------------------------------------
@@ -1653,3 +1802,26 @@ double CommBrick::memory_usage()
   bytes += memory->usage(buf_recv,maxrecv);
   return bytes;
 }
+
+/* ----------------------------------------------------------------------
+   count my swap send partners residing on the same vs a different node
+   used by Finish to report the locality of the proc grid mapping
+------------------------------------------------------------------------- */
+
+void CommBrick::swap_node_counts(int &onnode, int &offnode)
+{
+  onnode = offnode = 0;
+  if (nprocs == 1) return;
+
+  char *names = gather_node_names();
+  const char *myname = &names[(bigint) me*MPI_MAX_PROCESSOR_NAME];
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    if (sendproc[iswap] == me) continue;
+    if (strcmp(&names[(bigint) sendproc[iswap]*MPI_MAX_PROCESSOR_NAME],myname) == 0)
+      onnode++;
+    else offnode++;
+  }
+
+  delete [] names;
+}
@@ -37,6 +37,8 @@ class CommBrick : public Comm {
   void forward_comm(class Bond *) override;                 // forward comm from a Bond
   void reverse_comm(class Bond *) override;                 // reverse comm from a Bond
   void forward_comm(class Fix *, int size = 0) override;    // forward comm from a Fix
+  void forward_comm_start(class Fix *, int size = 0) override;    // split-phase fix comm
+  void forward_comm_finish(class Fix *) override;           // complete split-phase fix comm
   void reverse_comm(class Fix *, int size = 0) override;    // reverse comm from a Fix
   void reverse_comm_variable(class Fix *) override;         // variable size reverse comm from a Fix
   void forward_comm(class Compute *) override;              // forward from a Compute
@@ -47,9 +49,12 @@ class CommBrick : public Comm {
   void forward_comm_array(int, double **) override;            // forward comm of array
   void *extract(const char *, int &) override;
   double memory_usage() override;
+  void swap_node_counts(int &, int &) override;
 
  protected:
   int nswap;                            // # of swaps to perform = sum of maxneed
+  int split_pending;                    // 1 if last swap of split fix comm is outstanding
+  MPI_Request split_request;            // receive request of the outstanding swap
   int recvneed[3][2];                   // # of procs away I recv atoms from
   int sendneed[3][2];                   // # of procs away I send atoms to
   int maxneed[3];                       // max procs away any proc needs, per dim
@@ -75,6 +80,7 @@ class CommBrick : public Comm {
   double *buf_send;        // send buffer for all comm
   double *buf_recv;        // recv buffer for all comm
   int maxsend, maxrecv;    // current size of send/recv buffer
+  MPI_Request *requests;    // length maxswap, for pre-posted receives
   int smax, rmax;          // max size in atoms of single borders send/recv
 
   // NOTE: init_buffers is called from a constructor and must not be made virtual
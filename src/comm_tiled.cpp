@@ -73,6 +73,7 @@ CommTiled::CommTiled(LAMMPS * /*lmp*/, Comm *oldcomm) : Comm(*oldcomm)
 
 CommTiled::~CommTiled()
 {
+  free_persistent_comm();
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
   memory->destroy(overlap);
@@ -117,6 +118,10 @@ void CommTiled::init_pointers()
   maxsendlist = nullptr;
   sendlist = nullptr;
   requests = nullptr;
+  npersist = 0;
+  persist_nsend = persist_nrecv = nullptr;
+  persist_forward_recv = persist_forward_send = nullptr;
+  persist_reverse_recv = persist_reverse_send = nullptr;
   nprocmax = nullptr;
   nexchproc = nullptr;
   nexchprocmax = nullptr;
@@ -283,16 +288,30 @@ void CommTiled::setup()
     error->warning(FLERR,"Communication cutoff is 0.0. No ghost atoms "
                    "will be generated. Atoms may get lost.");
 
-  if (triclinic == 0) cutghost[0] = cutghost[1] = cutghost[2] = cut;
-  else {
+  // cutdim[] = ghost cutoff in each dim = global cutoff unless overridden
+  //   per dimension via comm_modify cutoff/dim
+  // per-dim values are floored at the max neighbor cutoff so that no
+  //   ghost atoms required by the neighbor lists are excluded
+
+  double cutdim[3];
+  cutdim[0] = cutdim[1] = cutdim[2] = cut;
+  for (i = 0; i < 3; i++)
+    if (cutghostuserdim[i] > 0.0)
+      cutdim[i] = MAX(cutghostuserdim[i],neighbor->cutneighmax);
+
+  if (triclinic == 0) {
+    cutghost[0] = cutdim[0];
+    cutghost[1] = cutdim[1];
+    cutghost[2] = cutdim[2];
+  } else {
     double *h_inv = domain->h_inv;
     double length0,length1,length2;
     length0 = sqrt(h_inv[0]*h_inv[0] + h_inv[5]*h_inv[5] + h_inv[4]*h_inv[4]);
-    cutghost[0] = cut * length0;
+    cutghost[0] = cutdim[0] * length0;
     length1 = sqrt(h_inv[1]*h_inv[1] + h_inv[3]*h_inv[3]);
-    cutghost[1] = cut * length1;
+    cutghost[1] = cutdim[1] * length1;
     length2 = h_inv[2];
-    cutghost[2] = cut * length2;
+    cutghost[2] = cutdim[2] * length2;
     if (mode == Comm::MULTI) {
       for (i = 0; i < ncollections; i++) {
         cutghostmulti[i][0] *= length0;
@@ -766,22 +785,30 @@ void CommTiled::forward_comm(int /*dummy*/)
 
     if (comm_x_only) {
       if (recvother[iswap]) {
-        for (i = 0; i < nrecv; i++)
-          MPI_Irecv(x[firstrecv[iswap][i]],size_forward_recv[iswap][i],
-                    MPI_DOUBLE,recvproc[iswap][i],0,world,&requests[i]);
+        if (npersist) MPI_Startall(nrecv,persist_forward_recv[iswap]);
+        else
+          for (i = 0; i < nrecv; i++)
+            MPI_Irecv(x[firstrecv[iswap][i]],size_forward_recv[iswap][i],
+                      MPI_DOUBLE,recvproc[iswap][i],0,world,&requests[i]);
       }
       if (sendother[iswap]) {
         for (i = 0; i < nsend; i++) {
           n = avec->pack_comm(sendnum[iswap][i],sendlist[iswap][i],
                               buf_send,pbc_flag[iswap][i],pbc[iswap][i]);
-          MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][i],0,world);
+          if (npersist) {
+            MPI_Start(&persist_forward_send[iswap][i]);
+            MPI_Wait(&persist_forward_send[iswap][i],MPI_STATUS_IGNORE);
+          } else MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][i],0,world);
         }
       }
       if (sendself[iswap]) {
         avec->pack_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],
                         x[firstrecv[iswap][nrecv]],pbc_flag[iswap][nsend],pbc[iswap][nsend]);
       }
-      if (recvother[iswap]) MPI_Waitall(nrecv,requests,MPI_STATUS_IGNORE);
+      if (recvother[iswap]) {
+        if (npersist) MPI_Waitall(nrecv,persist_forward_recv[iswap],MPI_STATUS_IGNORE);
+        else MPI_Waitall(nrecv,requests,MPI_STATUS_IGNORE);
+      }
 
     } else if (ghost_velocity) {
       if (recvother[iswap]) {
@@ -862,15 +889,18 @@ void CommTiled::reverse_comm()
 
     if (comm_f_only) {
       if (sendother[iswap]) {
-        for (i = 0; i < nsend; i++) {
-          MPI_Irecv(&buf_recv[size_reverse*reverse_recv_offset[iswap][i]],
-                    size_reverse_recv[iswap][i],MPI_DOUBLE,sendproc[iswap][i],0,world,&requests[i]);
-        }
+        if (npersist) MPI_Startall(nsend,persist_reverse_recv[iswap]);
+        else
+          for (i = 0; i < nsend; i++)
+            MPI_Irecv(&buf_recv[size_reverse*reverse_recv_offset[iswap][i]],
+                      size_reverse_recv[iswap][i],MPI_DOUBLE,sendproc[iswap][i],0,world,&requests[i]);
       }
       if (recvother[iswap]) {
-        for (i = 0; i < nrecv; i++)
-          MPI_Send(f[firstrecv[iswap][i]],size_reverse_send[iswap][i],
-                   MPI_DOUBLE,recvproc[iswap][i],0,world);
+        if (npersist) MPI_Startall(nrecv,persist_reverse_send[iswap]);
+        else
+          for (i = 0; i < nrecv; i++)
+            MPI_Send(f[firstrecv[iswap][i]],size_reverse_send[iswap][i],
+                     MPI_DOUBLE,recvproc[iswap][i],0,world);
       }
       if (sendself[iswap]) {
         avec->unpack_reverse(sendnum[iswap][nsend],sendlist[iswap][nsend],
@@ -878,12 +908,19 @@ void CommTiled::reverse_comm()
       }
       if (sendother[iswap]) {
         for (i = 0; i < nsend; i++) {
-          MPI_Waitany(nsend,requests,&irecv,MPI_STATUS_IGNORE);
+          if (npersist) MPI_Waitany(nsend,persist_reverse_recv[iswap],&irecv,MPI_STATUS_IGNORE);
+          else MPI_Waitany(nsend,requests,&irecv,MPI_STATUS_IGNORE);
           avec->unpack_reverse(sendnum[iswap][irecv],sendlist[iswap][irecv],
                                &buf_recv[size_reverse*reverse_recv_offset[iswap][irecv]]);
         }
       }
 
+      // sends read the ghost force arrays directly, which the next step's
+      // force computation overwrites, so they must complete before returning
+
+      if (npersist && recvother[iswap])
+        MPI_Waitall(nrecv,persist_reverse_send[iswap],MPI_STATUS_IGNORE);
+
     } else {
       if (sendother[iswap]) {
         for (i = 0; i < nsend; i++)
@@ -939,6 +976,18 @@ void CommTiled::exchange()
   atom->nghost = 0;
   atom->avec->clear_bonus();
 
+  // if the last distance check determined no atom on any proc has left
+  //   its subdomain, the migration below is a global no-op, so skip it
+  // verdict is good for a single exchange, so reset it immediately
+
+  int needed = neighbor->exchange_needed;
+  neighbor->exchange_needed = 1;
+  if (!needed) return;
+
+  // exchange reorders the per-atom arrays
+
+  atom->peratom_epoch++;
+
   // ensure send buf has extra space for a single atom
   // only need to reset if a fix can dynamically add to size of single atom
 
@@ -1376,6 +1425,105 @@ void CommTiled::borders()
   // reset global->local map
 
   if (map_style != Atom::MAP_NONE) atom->map_set();
+
+  // rebuild persistent requests for the every-step halo exchanges
+  // all counts, offsets, and buffer addresses they capture are now final
+  //   until the next reneighboring
+
+  build_persistent_comm();
+}
+
+/* ----------------------------------------------------------------------
+   build persistent MPI requests for the fixed communication pattern
+   of the forward and reverse halo exchange done every timestep
+   only the comm_x_only/comm_f_only paths exchange fixed-size messages
+   at fixed addresses; the pack/unpack paths keep on-the-fly requests
+------------------------------------------------------------------------- */
+
+void CommTiled::build_persistent_comm()
+{
+  free_persistent_comm();
+  if (!comm_x_only && !comm_f_only) return;
+
+  double **x = atom->x;
+  double **f = atom->f;
+
+  npersist = nswap;
+  persist_nsend = new int[nswap];
+  persist_nrecv = new int[nswap];
+  if (comm_x_only) {
+    persist_forward_recv = new MPI_Request*[nswap];
+    persist_forward_send = new MPI_Request*[nswap];
+  }
+  if (comm_f_only) {
+    persist_reverse_recv = new MPI_Request*[nswap];
+    persist_reverse_send = new MPI_Request*[nswap];
+  }
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    int nsend = persist_nsend[iswap] = nsendproc[iswap] - sendself[iswap];
+    int nrecv = persist_nrecv[iswap] = nrecvproc[iswap] - sendself[iswap];
+
+    if (comm_x_only) {
+      persist_forward_recv[iswap] = new MPI_Request[nrecv];
+      persist_forward_send[iswap] = new MPI_Request[nsend];
+      for (int i = 0; i < nrecv; i++)
+        MPI_Recv_init(x[firstrecv[iswap][i]],size_forward_recv[iswap][i],MPI_DOUBLE,
+                      recvproc[iswap][i],0,world,&persist_forward_recv[iswap][i]);
+      for (int i = 0; i < nsend; i++)
+        MPI_Send_init(buf_send,size_forward*sendnum[iswap][i],MPI_DOUBLE,
+                      sendproc[iswap][i],0,world,&persist_forward_send[iswap][i]);
+    }
+
+    if (comm_f_only) {
+      persist_reverse_recv[iswap] = new MPI_Request[nsend];
+      persist_reverse_send[iswap] = new MPI_Request[nrecv];
+      for (int i = 0; i < nsend; i++)
+        MPI_Recv_init(&buf_recv[size_reverse*reverse_recv_offset[iswap][i]],
+                      size_reverse_recv[iswap][i],MPI_DOUBLE,sendproc[iswap][i],0,world,
+                      &persist_reverse_recv[iswap][i]);
+      for (int i = 0; i < nrecv; i++)
+        MPI_Send_init(f[firstrecv[iswap][i]],size_reverse_send[iswap][i],MPI_DOUBLE,
+                      recvproc[iswap][i],0,world,&persist_reverse_send[iswap][i]);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   free all persistent MPI requests
+------------------------------------------------------------------------- */
+
+void CommTiled::free_persistent_comm()
+{
+  for (int iswap = 0; iswap < npersist; iswap++) {
+    if (persist_forward_recv) {
+      for (int i = 0; i < persist_nrecv[iswap]; i++)
+        MPI_Request_free(&persist_forward_recv[iswap][i]);
+      for (int i = 0; i < persist_nsend[iswap]; i++)
+        MPI_Request_free(&persist_forward_send[iswap][i]);
+      delete [] persist_forward_recv[iswap];
+      delete [] persist_forward_send[iswap];
+    }
+    if (persist_reverse_recv) {
+      for (int i = 0; i < persist_nsend[iswap]; i++)
+        MPI_Request_free(&persist_reverse_recv[iswap][i]);
+      for (int i = 0; i < persist_nrecv[iswap]; i++)
+        MPI_Request_free(&persist_reverse_send[iswap][i]);
+      delete [] persist_reverse_recv[iswap];
+      delete [] persist_reverse_send[iswap];
+    }
+  }
+
+  delete [] persist_nsend;
+  delete [] persist_nrecv;
+  delete [] persist_forward_recv;
+  delete [] persist_forward_send;
+  delete [] persist_reverse_recv;
+  delete [] persist_reverse_send;
+  persist_nsend = persist_nrecv = nullptr;
+  persist_forward_recv = persist_forward_send = nullptr;
+  persist_reverse_recv = persist_reverse_send = nullptr;
+  npersist = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -1609,6 +1757,13 @@ void CommTiled::reverse_comm(Fix *fix, int size)
   if (size) nsize = size;
   else nsize = fix->comm_reverse;
 
+  // if fix flags its reverse comm data as contiguous rows of array_atom,
+  //   skip the pack and send (or unpack for self) directly from the array
+  // only possible when communicating the full comm_reverse width
+
+  double **array = nullptr;
+  if (fix->comm_reverse_array && !size) array = fix->array_atom;
+
   for (int iswap = nswap-1; iswap >= 0; iswap--) {
     nsend = nsendproc[iswap] - sendself[iswap];
     nrecv = nrecvproc[iswap] - sendself[iswap];
@@ -1620,13 +1775,23 @@ void CommTiled::reverse_comm(Fix *fix, int size)
     }
     if (recvother[iswap]) {
       for (i = 0; i < nrecv; i++) {
-        n = fix->pack_reverse_comm(recvnum[iswap][i],firstrecv[iswap][i],buf_send);
-        MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap][i],0,world);
+        if (array)
+          MPI_Send(array[firstrecv[iswap][i]],nsize*recvnum[iswap][i],MPI_DOUBLE,
+                   recvproc[iswap][i],0,world);
+        else {
+          n = fix->pack_reverse_comm(recvnum[iswap][i],firstrecv[iswap][i],buf_send);
+          MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap][i],0,world);
+        }
       }
     }
     if (sendself[iswap]) {
-      fix->pack_reverse_comm(recvnum[iswap][nrecv],firstrecv[iswap][nrecv],buf_send);
-      fix->unpack_reverse_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],buf_send);
+      if (array && recvnum[iswap][nrecv])
+        fix->unpack_reverse_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],
+                                 array[firstrecv[iswap][nrecv]]);
+      else {
+        fix->pack_reverse_comm(recvnum[iswap][nrecv],firstrecv[iswap][nrecv],buf_send);
+        fix->unpack_reverse_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],buf_send);
+      }
     }
     if (sendother[iswap]) {
       for (i = 0; i < nsend; i++) {
@@ -1704,6 +1869,12 @@ void CommTiled::reverse_comm(Compute *compute)
 
   int nsize = compute->comm_reverse;
 
+  // if compute flags its reverse comm data as contiguous rows of array_atom,
+  //   skip the pack and send (or unpack for self) directly from the array
+
+  double **array = nullptr;
+  if (compute->comm_reverse_array) array = compute->array_atom;
+
   for (int iswap = nswap-1; iswap >= 0; iswap--) {
     nsend = nsendproc[iswap] - sendself[iswap];
     nrecv = nrecvproc[iswap] - sendself[iswap];
@@ -1715,13 +1886,23 @@ void CommTiled::reverse_comm(Compute *compute)
     }
     if (recvother[iswap]) {
       for (i = 0; i < nrecv; i++) {
-        n = compute->pack_reverse_comm(recvnum[iswap][i],firstrecv[iswap][i],buf_send);
-        MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap][i],0,world);
+        if (array)
+          MPI_Send(array[firstrecv[iswap][i]],nsize*recvnum[iswap][i],MPI_DOUBLE,
+                   recvproc[iswap][i],0,world);
+        else {
+          n = compute->pack_reverse_comm(recvnum[iswap][i],firstrecv[iswap][i],buf_send);
+          MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap][i],0,world);
+        }
       }
     }
     if (sendself[iswap]) {
-      compute->pack_reverse_comm(recvnum[iswap][nrecv],firstrecv[iswap][nrecv],buf_send);
-      compute->unpack_reverse_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],buf_send);
+      if (array && recvnum[iswap][nrecv])
+        compute->unpack_reverse_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],
+                                     array[firstrecv[iswap][nrecv]]);
+      else {
+        compute->pack_reverse_comm(recvnum[iswap][nrecv],firstrecv[iswap][nrecv],buf_send);
+        compute->unpack_reverse_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],buf_send);
+      }
     }
     if (sendother[iswap]) {
       for (i = 0; i < nsend; i++) {
@@ -2518,3 +2699,28 @@ double CommTiled::memory_usage()
   double bytes = 0;
   return bytes;
 }
+
+/* ----------------------------------------------------------------------
+   count my swap send partners residing on the same vs a different node
+   used by Finish to report the locality of the proc grid mapping
+------------------------------------------------------------------------- */
+
+void CommTiled::swap_node_counts(int &onnode, int &offnode)
+{
+  onnode = offnode = 0;
+  if (nprocs == 1) return;
+
+  char *names = gather_node_names();
+  const char *myname = &names[(bigint) me*MPI_MAX_PROCESSOR_NAME];
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    int nsend = nsendproc[iswap] - sendself[iswap];
+    for (int i = 0; i < nsend; i++) {
+      if (strcmp(&names[(bigint) sendproc[iswap][i]*MPI_MAX_PROCESSOR_NAME],myname) == 0)
+        onnode++;
+      else offnode++;
+    }
+  }
+
+  delete [] names;
+}
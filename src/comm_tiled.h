@@ -50,6 +50,7 @@ class CommTiled : public Comm {
   int coord2proc(double *, int &, int &, int &) override;
 
   double memory_usage() override;
+  void swap_node_counts(int &, int &) override;
 
  protected:
   int nswap;      // # of swaps to perform = 2*dim
@@ -100,6 +101,21 @@ class CommTiled : public Comm {
   int maxrequest;    // max size of Request vector
   MPI_Request *requests;
 
+  // persistent requests for the fixed-pattern halo exchanges done
+  //   every step with comm_x_only forward and comm_f_only reverse comm
+  // rebuilt by borders() since counts, offsets, and buffer addresses
+  //   are only fixed within one reneighbor interval
+
+  int npersist;                          // # of swaps with persistent requests, 0 = none
+  int *persist_nsend, *persist_nrecv;    // # of send/recv partners per swap
+  MPI_Request **persist_forward_recv;    // forward comm recvs directly into x
+  MPI_Request **persist_forward_send;    // forward comm sends from buf_send
+  MPI_Request **persist_reverse_recv;    // reverse comm recvs into buf_recv
+  MPI_Request **persist_reverse_send;    // reverse comm sends directly from f
+
+  void build_persistent_comm();
+  void free_persistent_comm();
+
   struct RCBinfo {
     double mysplit[3][2];    // fractional RCB bounding box for one proc
     double cutfrac;          // fractional position of cut this proc owns
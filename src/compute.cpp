@@ -65,12 +65,14 @@ Compute::Compute(LAMMPS *lmp, int narg, char **arg) :
 
   tempflag = pressflag = peflag = 0;
   pressatomflag = peatomflag = 0;
+  timedumpflag = 0;
   create_attribute = 0;
   tempbias = 0;
   scalar = 0.0;
 
   timeflag = 0;
   comm_forward = comm_reverse = 0;
+  comm_reverse_array = 0;
   dynamic = 0;
   dynamic_group_allow = 1;
 
@@ -78,6 +78,8 @@ class Compute : protected Pointers {
                            // 3 if Compute calculates both
   int peflag;              // 1 if Compute calculates PE (uses Force energies)
   int peatomflag;          // 1 if Compute calculates per-atom PE
+  int timedumpflag;        // 1 if Compute was invoked by a time dump,
+                           // learned by Output, used by Integrate::ev_set()
   int create_attribute;    // 1 if compute stores attributes that need
                            // setting when a new atom is created
 
@@ -101,6 +103,9 @@ class Compute : protected Pointers {
 
   int comm_forward;           // size of forward communication (0 if none)
   int comm_reverse;           // size of reverse communication (0 if none)
+  int comm_reverse_array;     // 1 if reverse comm data = comm_reverse columns of
+                              //   array_atom, packed contiguously by ghost atom index,
+                              //   so comm can send directly from the array
   int dynamic_group_allow;    // 1 if can be used with dynamic group, else 0
 
   // KOKKOS host/device flag and data masks
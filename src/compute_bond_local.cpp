@@ -21,10 +21,12 @@
 #include "domain.h"
 #include "error.h"
 #include "force.h"
+#include "group.h"
 #include "input.h"
 #include "math_extra.h"
 #include "memory.h"
 #include "molecule.h"
+#include "neighbor.h"
 #include "update.h"
 #include "variable.h"
 
@@ -41,7 +43,8 @@ enum{DIST,DX,DY,DZ,VELVIB,OMEGA,ENGTRANS,ENGVIB,ENGROT,ENGPOT,FORCE,FX,FY,FZ,VAR
 
 ComputeBondLocal::ComputeBondLocal(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  bstyle(nullptr), vvar(nullptr), dstr(nullptr), vstr(nullptr), vlocal(nullptr), alocal(nullptr)
+  bstyle(nullptr), vvar(nullptr), dstr(nullptr), vstr(nullptr), vlocal(nullptr), alocal(nullptr),
+  cacheatom1(nullptr), cacheatom2(nullptr), cachebtype(nullptr)
 {
   if (narg < 4) error->all(FLERR,"Illegal compute bond/local command");
 
@@ -151,6 +154,9 @@ ComputeBondLocal::ComputeBondLocal(LAMMPS *lmp, int narg, char **arg) :
   nmax = 0;
   vlocal = nullptr;
   alocal = nullptr;
+
+  cachestep = -1;
+  ncache = maxcache = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -167,6 +173,9 @@ ComputeBondLocal::~ComputeBondLocal()
 
   memory->destroy(vlocal);
   memory->destroy(alocal);
+  memory->destroy(cacheatom1);
+  memory->destroy(cacheatom2);
+  memory->destroy(cachebtype);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -200,10 +209,13 @@ void ComputeBondLocal::init()
   else ghostvelflag = 0;
 
   // do initial memory allocation so that memory_usage() is correct
+  // invalidate the cached bond list afterwards, since atom indices
+  //   can still change when neighbor lists are built during setup
 
   initflag = 1;
   ncount = compute_bonds(0);
   initflag = 0;
+  cachestep = -1;
 
   if (ncount > nmax) reallocate(ncount);
   size_local_rows = ncount;
@@ -215,23 +227,29 @@ void ComputeBondLocal::compute_local()
 {
   invoked_local = update->ntimestep;
 
-  // count local entries and compute bond info
+  // rebuild the cached bond list if neighbor lists have been rebuilt
+  //   since it was last filled (atom indices change) or the group is
+  //   dynamic, else the previous selection is still valid
+
+  if (cachestep < neighbor->lastcall || group->dynamic[igroup])
+    ncount = compute_bonds(0);
+  else
+    ncount = ncache;
 
-  ncount = compute_bonds(0);
   if (ncount > nmax) reallocate(ncount);
   size_local_rows = ncount;
   ncount = compute_bonds(1);
 }
 
 /* ----------------------------------------------------------------------
-   count bonds and compute bond info on this proc
-   only count bond once if newton_bond is off
-   all atoms in interaction must be in group
-   all atoms in interaction must be known to proc
-   if bond is deleted (type = 0), do not count
-   if bond is turned off (type < 0), still count
-   if flag is set, compute requested info about bond
-   if bond is turned off (type < 0), energy = 0.0
+   for flag = 0, select bonds on this proc into the cached bond list
+     only count bond once if newton_bond is off
+     all atoms in interaction must be in group
+     all atoms in interaction must be known to proc
+     if bond is deleted (type = 0), do not count
+     if bond is turned off (type < 0), still count
+   for flag = 1, compute requested info for each bond in the cached list
+     if bond is turned off (type < 0), energy = 0.0
 ------------------------------------------------------------------------- */
 
 int ComputeBondLocal::compute_bonds(int flag)
@@ -270,188 +288,204 @@ int ComputeBondLocal::compute_bonds(int flag)
 
   Bond *bond = force->bond;
 
-  // communicate ghost velocities if needed
+  // flag = 0: loop over all atoms and their bonds,
+  //   store selected bonds in the cached bond list
 
-  if (ghostvelflag && !initflag) comm->forward_comm(this);
+  if (!flag) {
+    ncache = 0;
+    for (atom1 = 0; atom1 < nlocal; atom1++) {
+      if (!(mask[atom1] & groupbit)) continue;
 
-  // loop over all atoms and their bonds
+      if (molecular == Atom::MOLECULAR) nb = num_bond[atom1];
+      else {
+        if (molindex[atom1] < 0) continue;
+        imol = molindex[atom1];
+        iatom = molatom[atom1];
+        nb = onemols[imol]->num_bond[iatom];
+      }
 
-  m = 0;
-  for (atom1 = 0; atom1 < nlocal; atom1++) {
-    if (!(mask[atom1] & groupbit)) continue;
-
-    if (molecular == Atom::MOLECULAR) nb = num_bond[atom1];
-    else {
-      if (molindex[atom1] < 0) continue;
-      imol = molindex[atom1];
-      iatom = molatom[atom1];
-      nb = onemols[imol]->num_bond[iatom];
-    }
+      for (i = 0; i < nb; i++) {
+        if (molecular == Atom::MOLECULAR) {
+          btype = bond_type[atom1][i];
+          atom2 = atom->map(bond_atom[atom1][i]);
+        } else {
+          tagprev = tag[atom1] - iatom - 1;
+          btype = onemols[imol]->bond_type[iatom][i];
+          atom2 = atom->map(onemols[imol]->bond_atom[iatom][i]+tagprev);
+        }
+
+        if (atom2 < 0 || !(mask[atom2] & groupbit)) continue;
+        if (newton_bond == 0 && tag[atom1] > tag[atom2]) continue;
+        if (btype == 0) continue;
 
-    for (i = 0; i < nb; i++) {
-      if (molecular == Atom::MOLECULAR) {
-        btype = bond_type[atom1][i];
-        atom2 = atom->map(bond_atom[atom1][i]);
-      } else {
-        tagprev = tag[atom1] - iatom - 1;
-        btype = onemols[imol]->bond_type[iatom][i];
-        atom2 = atom->map(onemols[imol]->bond_atom[iatom][i]+tagprev);
+        if (ncache == maxcache) {
+          maxcache += DELTA;
+          memory->grow(cacheatom1,maxcache,"bond/local:cacheatom1");
+          memory->grow(cacheatom2,maxcache,"bond/local:cacheatom2");
+          memory->grow(cachebtype,maxcache,"bond/local:cachebtype");
+        }
+        cacheatom1[ncache] = atom1;
+        cacheatom2[ncache] = atom2;
+        cachebtype[ncache] = btype;
+        ncache++;
       }
+    }
+
+    cachestep = update->ntimestep;
+    return ncache;
+  }
+
+  // flag = 1: compute requested info for each bond in the cached list
 
-      if (atom2 < 0 || !(mask[atom2] & groupbit)) continue;
-      if (newton_bond == 0 && tag[atom1] > tag[atom2]) continue;
-      if (btype == 0) continue;
+  // communicate ghost velocities if needed
+
+  if (ghostvelflag && !initflag) comm->forward_comm(this);
 
-      if (!flag) {
-        m++;
-        continue;
+  m = 0;
+  for (int ic = 0; ic < ncache; ic++) {
+    atom1 = cacheatom1[ic];
+    atom2 = cacheatom2[ic];
+    btype = cachebtype[ic];
+
+    dx = x[atom1][0] - x[atom2][0];
+    dy = x[atom1][1] - x[atom2][1];
+    dz = x[atom1][2] - x[atom2][2];
+    domain->minimum_image_once(dx,dy,dz);
+    rsq = dx*dx + dy*dy + dz*dz;
+
+    if (singleflag) engpot = bond->single(btype,rsq,atom1,atom2,fbond);
+    else fbond = engpot = 0.0;
+    engvib = engrot = engtrans = omegasq = vvib = 0.0;
+
+    if (velflag) {
+      if (rmass) {
+        mass1 = rmass[atom1];
+        mass2 = rmass[atom2];
+      }
+      else {
+        mass1 = mass[type[atom1]];
+        mass2 = mass[type[atom2]];
       }
+      masstotal = mass1+mass2;
+      invmasstotal = 1.0 / (masstotal);
+      xcm[0] = (mass1*x[atom1][0] + mass2*x[atom2][0]) * invmasstotal;
+      xcm[1] = (mass1*x[atom1][1] + mass2*x[atom2][1]) * invmasstotal;
+      xcm[2] = (mass1*x[atom1][2] + mass2*x[atom2][2]) * invmasstotal;
+      vcm[0] = (mass1*v[atom1][0] + mass2*v[atom2][0]) * invmasstotal;
+      vcm[1] = (mass1*v[atom1][1] + mass2*v[atom2][1]) * invmasstotal;
+      vcm[2] = (mass1*v[atom1][2] + mass2*v[atom2][2]) * invmasstotal;
 
-      dx = x[atom1][0] - x[atom2][0];
-      dy = x[atom1][1] - x[atom2][1];
-      dz = x[atom1][2] - x[atom2][2];
-      domain->minimum_image(dx,dy,dz);
-      rsq = dx*dx + dy*dy + dz*dz;
-
-      if (btype == 0) {
-        fbond = 0.0;
-      } else {
-
-        if (singleflag) engpot = bond->single(btype,rsq,atom1,atom2,fbond);
-        else fbond = engpot = 0.0;
-        engvib = engrot = engtrans = omegasq = vvib = 0.0;
-
-        if (velflag) {
-          if (rmass) {
-            mass1 = rmass[atom1];
-            mass2 = rmass[atom2];
-          }
-          else {
-            mass1 = mass[type[atom1]];
-            mass2 = mass[type[atom2]];
-          }
-          masstotal = mass1+mass2;
-          invmasstotal = 1.0 / (masstotal);
-          xcm[0] = (mass1*x[atom1][0] + mass2*x[atom2][0]) * invmasstotal;
-          xcm[1] = (mass1*x[atom1][1] + mass2*x[atom2][1]) * invmasstotal;
-          xcm[2] = (mass1*x[atom1][2] + mass2*x[atom2][2]) * invmasstotal;
-          vcm[0] = (mass1*v[atom1][0] + mass2*v[atom2][0]) * invmasstotal;
-          vcm[1] = (mass1*v[atom1][1] + mass2*v[atom2][1]) * invmasstotal;
-          vcm[2] = (mass1*v[atom1][2] + mass2*v[atom2][2]) * invmasstotal;
-
-          engtrans = 0.5 * masstotal * MathExtra::lensq3(vcm);
-
-          // r12 = unit bond vector from atom1 to atom2
-
-          MathExtra::sub3(x[atom2],x[atom1],r12);
-          MathExtra::norm3(r12);
-
-          // delr = vector from COM to each atom
-          // delv = velocity of each atom relative to COM
-
-          MathExtra::sub3(x[atom1],xcm,delr1);
-          MathExtra::sub3(x[atom2],xcm,delr2);
-          MathExtra::sub3(v[atom1],vcm,delv1);
-          MathExtra::sub3(v[atom2],vcm,delv2);
-
-          // vpar = component of delv parallel to bond vector
-
-          vpar1 = MathExtra::dot3(delv1,r12);
-          vpar2 = MathExtra::dot3(delv2,r12);
-          engvib = 0.5 * (mass1*vpar1*vpar1 + mass2*vpar2*vpar2);
-
-          // vvib = relative velocity of 2 atoms along bond direction
-          // vvib < 0 for 2 atoms moving towards each other
-          // vvib > 0 for 2 atoms moving apart
-
-          vvib = vpar2 - vpar1;
-
-          // vrotsq = tangential speed squared of atom1 only
-          // omegasq = omega squared, and is the same for atom1 and atom2
-
-          inertia = mass1*MathExtra::lensq3(delr1) +
-            mass2*MathExtra::lensq3(delr2);
-          vrotsq = MathExtra::lensq3(delv1) - vpar1*vpar1;
-          omegasq = vrotsq / MathExtra::lensq3(delr1);
-
-          engrot = 0.5 * inertia * omegasq;
-
-          // scale energies by units
-
-          mvv2e = force->mvv2e;
-          engtrans *= mvv2e;
-          engvib *= mvv2e;
-          engrot *= mvv2e;
-        }
+      engtrans = 0.5 * masstotal * MathExtra::lensq3(vcm);
 
-        if (nvalues == 1) ptr = &vlocal[m];
-        else ptr = alocal[m];
+      // r12 = unit bond vector from atom1 to atom2
 
-        if (nvar) {
-          ivar = 0;
-          if (dstr) input->variable->internal_set(dvar,sqrt(rsq));
-        }
+      MathExtra::sub3(x[atom2],x[atom1],r12);
+      MathExtra::norm3(r12);
 
-        // to make sure dx, dy and dz are always from the lower to the higher id
-        double directionCorrection = tag[atom1] > tag[atom2] ? -1.0 : 1.0;
-
-        for (int n = 0; n < nvalues; n++) {
-          switch (bstyle[n]) {
-          case DIST:
-            ptr[n] = sqrt(rsq);
-            break;
-          case DX:
-            ptr[n] = dx*directionCorrection;
-            break;
-          case DY:
-            ptr[n] = dy*directionCorrection;
-            break;
-          case DZ:
-            ptr[n] = dz*directionCorrection;
-            break;
-          case ENGPOT:
-            ptr[n] = engpot;
-            break;
-          case FORCE:
-            ptr[n] = sqrt(rsq)*fbond;
-            break;
-          case FX:
-            ptr[n] = dx*fbond;
-            break;
-          case FY:
-            ptr[n] = dy*fbond;
-            break;
-          case FZ:
-            ptr[n] = dz*fbond;
-            break;
-          case ENGVIB:
-            ptr[n] = engvib;
-            break;
-          case ENGROT:
-            ptr[n] = engrot;
-            break;
-          case ENGTRANS:
-            ptr[n] = engtrans;
-            break;
-          case OMEGA:
-            ptr[n] = sqrt(omegasq);
-            break;
-          case VELVIB:
-            ptr[n] = vvib;
-            break;
-          case VARIABLE:
-            ptr[n] = input->variable->compute_equal(vvar[ivar]);
-            ivar++;
-            break;
-          case BN:
-            ptr[n] = bond->svector[bindex[n]];
-            break;
-          }
-        }
-      }
+      // delr = vector from COM to each atom
+      // delv = velocity of each atom relative to COM
+
+      MathExtra::sub3(x[atom1],xcm,delr1);
+      MathExtra::sub3(x[atom2],xcm,delr2);
+      MathExtra::sub3(v[atom1],vcm,delv1);
+      MathExtra::sub3(v[atom2],vcm,delv2);
+
+      // vpar = component of delv parallel to bond vector
+
+      vpar1 = MathExtra::dot3(delv1,r12);
+      vpar2 = MathExtra::dot3(delv2,r12);
+      engvib = 0.5 * (mass1*vpar1*vpar1 + mass2*vpar2*vpar2);
+
+      // vvib = relative velocity of 2 atoms along bond direction
+      // vvib < 0 for 2 atoms moving towards each other
+      // vvib > 0 for 2 atoms moving apart
+
+      vvib = vpar2 - vpar1;
+
+      // vrotsq = tangential speed squared of atom1 only
+      // omegasq = omega squared, and is the same for atom1 and atom2
 
-      m++;
+      inertia = mass1*MathExtra::lensq3(delr1) +
+        mass2*MathExtra::lensq3(delr2);
+      vrotsq = MathExtra::lensq3(delv1) - vpar1*vpar1;
+      omegasq = vrotsq / MathExtra::lensq3(delr1);
+
+      engrot = 0.5 * inertia * omegasq;
+
+      // scale energies by units
+
+      mvv2e = force->mvv2e;
+      engtrans *= mvv2e;
+      engvib *= mvv2e;
+      engrot *= mvv2e;
+    }
+
+    if (nvalues == 1) ptr = &vlocal[m];
+    else ptr = alocal[m];
+
+    if (nvar) {
+      ivar = 0;
+      if (dstr) input->variable->internal_set(dvar,sqrt(rsq));
     }
+
+    // to make sure dx, dy and dz are always from the lower to the higher id
+    double directionCorrection = tag[atom1] > tag[atom2] ? -1.0 : 1.0;
+
+    for (int n = 0; n < nvalues; n++) {
+      switch (bstyle[n]) {
+      case DIST:
+        ptr[n] = sqrt(rsq);
+        break;
+      case DX:
+        ptr[n] = dx*directionCorrection;
+        break;
+      case DY:
+        ptr[n] = dy*directionCorrection;
+        break;
+      case DZ:
+        ptr[n] = dz*directionCorrection;
+        break;
+      case ENGPOT:
+        ptr[n] = engpot;
+        break;
+      case FORCE:
+        ptr[n] = sqrt(rsq)*fbond;
+        break;
+      case FX:
+        ptr[n] = dx*fbond;
+        break;
+      case FY:
+        ptr[n] = dy*fbond;
+        break;
+      case FZ:
+        ptr[n] = dz*fbond;
+        break;
+      case ENGVIB:
+        ptr[n] = engvib;
+        break;
+      case ENGROT:
+        ptr[n] = engrot;
+        break;
+      case ENGTRANS:
+        ptr[n] = engtrans;
+        break;
+      case OMEGA:
+        ptr[n] = sqrt(omegasq);
+        break;
+      case VELVIB:
+        ptr[n] = vvib;
+        break;
+      case VARIABLE:
+        ptr[n] = input->variable->compute_equal(vvar[ivar]);
+        ivar++;
+        break;
+      case BN:
+        ptr[n] = bond->svector[bindex[n]];
+        break;
+      }
+    }
+
+    m++;
   }
 
   return m;
@@ -520,5 +554,6 @@ void ComputeBondLocal::reallocate(int n)
 double ComputeBondLocal::memory_usage()
 {
   double bytes = (double)nmax*nvalues * sizeof(double);
+  bytes += (double)3*maxcache * sizeof(int);
   return bytes;
 }
@@ -47,6 +47,15 @@ class ComputeBondLocal : public Compute {
   double *vlocal;
   double **alocal;
 
+  // cached list of selected bonds, reused until the next reneighboring
+  // selection is position-independent, so the cache holds exactly the
+  //   bonds that are output, with atom IDs already mapped to local indices
+
+  bigint cachestep;                    // timestep the cache was built on, -1 if invalid
+  int ncache, maxcache;                // # of selected bonds and allocated size
+  int *cacheatom1, *cacheatom2;        // local indices of the two bond atoms
+  int *cachebtype;                     // bond type, < 0 if bond is turned off
+
   int compute_bonds(int);
   void reallocate(int);
 };
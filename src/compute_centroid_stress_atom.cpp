@@ -78,6 +78,7 @@ ComputeCentroidStressAtom::ComputeCentroidStressAtom(LAMMPS *lmp, int narg, char
   pressatomflag = 2;
   timeflag = 1;
   comm_reverse = 9;
+  comm_reverse_array = 1;
 
   // store temperature ID used by stress computation
   // ensure it is valid for temperature computation
@@ -28,13 +28,14 @@
 #include "math_const.h"
 #include "memory.h"
 #include "modify.h"
+#include "neighbor.h"
 #include "region.h"
 #include "update.h"
 #include "variable.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
-#include <map>
 #include <utility>
 
 using namespace LAMMPS_NS;
@@ -47,6 +48,7 @@ enum { ONCE, NFREQ, EVERY };    // used in several files
 enum { LIMITMAX, LIMITEXACT };
 
 static constexpr int IDMAX = (1024 * 1024);
+static constexpr double BIG = 1.0e20;
 
 /* ---------------------------------------------------------------------- */
 
@@ -465,10 +467,20 @@ ComputeChunkAtom::ComputeChunkAtom(LAMMPS *lmp, int narg, char **arg) :
   fixstore = nullptr;
 
   if (compress)
-    hash = new std::map<tagint, int>();
+    hash = new std::unordered_map<tagint, int>();
   else
     hash = nullptr;
 
+  // incremental bin reassignment applies only to 1d bins in box coords
+  // with no region, since a region can include/exclude a moving atom
+
+  incremental = (which == ArgInfo::BIN1D) && (scaleflag != REDUCED) && !regionflag;
+  nhold = nmaxhold = 0;
+  holdstep = -1;
+  xbinhold = nullptr;
+  binmargin = nullptr;
+  binhold = nullptr;
+
   maxvar = 0;
   varatom = nullptr;
 
@@ -501,6 +513,10 @@ ComputeChunkAtom::~ComputeChunkAtom()
   delete[] cfvid;
   delete hash;
 
+  memory->destroy(xbinhold);
+  memory->destroy(binmargin);
+  memory->destroy(binhold);
+
   memory->destroy(varatom);
 }
 
@@ -724,26 +740,29 @@ void ComputeChunkAtom::compute_ichunk()
     if (binflag) {
       for (i = 0; i < nlocal; i++) {
         if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end())
+        auto pos = hash->find(ichunk[i]);
+        if (pos == hash->end())
           exclude[i] = 1;
         else
-          ichunk[i] = hash->find(ichunk[i])->second;
+          ichunk[i] = pos->second;
       }
     } else if (discard == NODISCARD) {
       for (i = 0; i < nlocal; i++) {
         if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end())
+        auto pos = hash->find(ichunk[i]);
+        if (pos == hash->end())
           ichunk[i] = nchunk;
         else
-          ichunk[i] = hash->find(ichunk[i])->second;
+          ichunk[i] = pos->second;
       }
     } else {
       for (i = 0; i < nlocal; i++) {
         if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end())
+        auto pos = hash->find(ichunk[i]);
+        if (pos == hash->end())
           exclude[i] = 1;
         else
-          ichunk[i] = hash->find(ichunk[i])->second;
+          ichunk[i] = pos->second;
       }
     }
 
@@ -832,6 +851,7 @@ int ComputeChunkAtom::setup_chunks()
     else if (which == ArgInfo::BINCYLINDER)
       nchunk = setup_cylinder_bins();
     bin_volumes();
+    holdstep = -1;
   } else {
     chunk_volume_scalar = domain->xprd * domain->yprd;
     if (domain->dimension == 3) chunk_volume_scalar *= domain->zprd;
@@ -1063,8 +1083,7 @@ void ComputeChunkAtom::compress_chunk_ids()
   memory->create(list, n, "chunk/atom:list");
 
   n = 0;
-  std::map<tagint, int>::iterator pos;
-  for (pos = hash->begin(); pos != hash->end(); ++pos) list[n++] = pos->first;
+  for (auto &entry : *hash) list[n++] = entry.first;
 
   // if nall < 1M, just allgather all ID lists on every proc
   // else perform ring comm
@@ -1114,7 +1133,7 @@ void ComputeChunkAtom::compress_chunk_ids()
 
   // reset hash value of each original chunk ID to ordered index
   //   ordered index = new compressed chunk ID (1 to Nchunk)
-  //   leverages fact that map stores keys in ascending order
+  //   sort the IDs explicitly since the hash stores them unordered
   // also allocate and set chunkID = list of original chunk IDs
   //   used by fix ave/chunk and compute property/chunk
 
@@ -1122,10 +1141,9 @@ void ComputeChunkAtom::compress_chunk_ids()
   memory->create(chunkID, nchunk, "chunk/atom:chunkID");
 
   n = 0;
-  for (pos = hash->begin(); pos != hash->end(); ++pos) {
-    chunkID[n] = pos->first;
-    (*hash)[pos->first] = ++n;
-  }
+  for (auto &entry : *hash) chunkID[n++] = entry.first;
+  std::sort(chunkID, chunkID + nchunk);
+  for (n = 0; n < nchunk; n++) (*hash)[chunkID[n]] = n + 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -1139,7 +1157,7 @@ void ComputeChunkAtom::idring(int n, char *cbuf, void *ptr)
 {
   auto cptr = (ComputeChunkAtom *) ptr;
   auto list = (tagint *) cbuf;
-  std::map<tagint, int> *hash = cptr->hash;
+  std::unordered_map<tagint, int> *hash = cptr->hash;
   for (int i = 0; i < n; i++) (*hash)[list[i]] = 0;
 }
 
@@ -1520,6 +1538,27 @@ void ComputeChunkAtom::atom2bin1d()
     }
   }
 
+  // incremental pass is OK if hold arrays were filled since the last
+  //   reneighboring, so local indices still match, atom count is same,
+  //   and the group is not dynamic
+  // an atom that moved less than its stored margin since its last full
+  //   computation cannot have changed bins, so reuse the stored outcome
+  // atoms recomputed below refresh their own hold entries
+
+  int incr = 0;
+  if (incremental) {
+    incr = (holdstep > update->ntimestep - neighbor->ago) && (nlocal == nhold) &&
+        !group->dynamic[igroup];
+    if (atom->nmax > nmaxhold) {
+      nmaxhold = atom->nmax;
+      memory->grow(xbinhold, nmaxhold, "chunk/atom:xbinhold");
+      memory->grow(binmargin, nmaxhold, "chunk/atom:binmargin");
+      memory->grow(binhold, nmaxhold, "chunk/atom:binhold");
+    }
+    nhold = nlocal;
+    holdstep = update->ntimestep;
+  }
+
   // remap each atom's relevant coord back into box via PBC if necessary
   // if scaleflag = REDUCED, box coords -> lamda coords
   // apply discard rule
@@ -1529,6 +1568,14 @@ void ComputeChunkAtom::atom2bin1d()
   for (i = 0; i < nlocal; i++) {
     if (exclude[i]) continue;
 
+    if (incr && fabs(x[i][idim] - xbinhold[i]) < binmargin[i]) {
+      if (binhold[i] == 0)
+        exclude[i] = 1;
+      else
+        ichunk[i] = binhold[i];
+      continue;
+    }
+
     xremap = x[i][idim];
     if (periodicity) {
       if (xremap < boxlo[idim]) xremap += prd[idim];
@@ -1538,28 +1585,62 @@ void ComputeChunkAtom::atom2bin1d()
     ibin = static_cast<int>((xremap - offset[0]) * invdelta[0]);
     if (xremap < offset[0]) ibin--;
 
+    // marginlo/hi = how far the atom can move along -/+ idim before the
+    //   discard/clamp outcome below could change
+    // a side an atom can never cross (clamped bin edge, or edge of the
+    //   discard zone it already sits in) contributes an infinite margin
+
+    double marginlo = BIG;
+    double marginhi = BIG;
+    int keep = 1;
+
     if (discard == MIXED) {
       if (!minflag[idim])
         ibin = MAX(ibin, 0);
-      else if (ibin < 0) {
-        exclude[i] = 1;
-        continue;
-      }
-      if (!maxflag[idim])
-        ibin = MIN(ibin, nlayer1m1);
-      else if (ibin > nlayer1m1) {
-        exclude[i] = 1;
-        continue;
+      else if (ibin < 0)
+        keep = 0;
+      if (keep) {
+        if (!maxflag[idim])
+          ibin = MIN(ibin, nlayer1m1);
+        else if (ibin > nlayer1m1)
+          keep = 0;
       }
     } else if (discard == NODISCARD) {
       ibin = MAX(ibin, 0);
       ibin = MIN(ibin, nlayer1m1);
     } else if (ibin < 0 || ibin > nlayer1m1) {
+      keep = 0;
+    }
+
+    if (keep) {
+      if (ibin > 0 || discard == YESDISCARD || (discard == MIXED && minflag[idim]))
+        marginlo = xremap - (offset[0] + ibin * delta[0]);
+      if (ibin < nlayer1m1 || discard == YESDISCARD || (discard == MIXED && maxflag[idim]))
+        marginhi = (offset[0] + (ibin + 1) * delta[0]) - xremap;
+      ichunk[i] = ibin + 1;
+    } else {
+      if (ibin < 0)
+        marginhi = offset[0] - xremap;
+      else
+        marginlo = xremap - (offset[0] + nlayers[0] * delta[0]);
       exclude[i] = 1;
-      continue;
     }
 
-    ichunk[i] = ibin + 1;
+    if (incremental) {
+
+      // cap margin at distance to the periodic boundaries, where the
+      //   remapped coord jumps by the box length
+
+      double margin = MIN(marginlo, marginhi);
+      if (periodicity) {
+        margin = MIN(margin, xremap - boxlo[idim]);
+        margin = MIN(margin, boxhi[idim] - xremap);
+      }
+
+      xbinhold[i] = x[i][idim];
+      binmargin[i] = margin;
+      binhold[i] = keep ? ibin + 1 : 0;
+    }
   }
 
   if (scaleflag == REDUCED) domain->lamda2x(nlocal);
@@ -2050,6 +2131,7 @@ double ComputeChunkAtom::memory_usage()
   double bytes = 2 * MAX(nmaxint, 0) * sizeof(int);        // ichunk,exclude
   bytes += (double) nmax * sizeof(double);                 // chunk
   bytes += (double) ncoord * nchunk * sizeof(double);      // coord
-  if (compress) bytes += (double) nchunk * sizeof(int);    // chunkID
+  if (compress) bytes += (double) nchunk * sizeof(int);            // chunkID
+  bytes += (double) nmaxhold * (2 * sizeof(double) + sizeof(int));  // hold arrays
   return bytes;
 }
@@ -21,7 +21,7 @@ ComputeStyle(chunk/atom,ComputeChunkAtom);
 #define LMP_COMPUTE_CHUNK_ATOM_H
 
 #include "compute.h"
-#include <map>
+#include <unordered_map>
 
 namespace LAMMPS_NS {
 
@@ -104,9 +104,19 @@ class ComputeChunkAtom : public Compute {
   int nmax, nmaxint;
   double *chunk;
 
-  int molcheck;                   // one-time check if all molecule atoms in chunk
-  int *exclude;                   // 1 if atom is not assigned to any chunk
-  std::map<tagint, int> *hash;    // store original chunks IDs before compression
+  int molcheck;    // one-time check if all molecule atoms in chunk
+  int *exclude;    // 1 if atom is not assigned to any chunk
+  std::unordered_map<tagint, int> *hash;    // original chunk IDs before compression
+
+  // incremental bin reassignment for style bin/1d
+
+  int incremental;       // 1 if style supports incremental bin reassignment
+  int nhold;             // # of atoms covered by hold arrays
+  int nmaxhold;          // allocated length of hold arrays
+  bigint holdstep;       // timestep of last bin assignment, -1 if invalid
+  double *xbinhold;      // binned coord of each atom at last assignment
+  double *binmargin;     // how far each atom can move before its bin could change
+  int *binhold;          // bin outcome at last assignment, 0 = discarded atom
 
   // callback function for ring communication
 
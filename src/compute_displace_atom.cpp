@@ -71,27 +71,39 @@ ComputeDisplaceAtom::ComputeDisplaceAtom(LAMMPS *lmp, int narg, char **arg) :
   }
 
   // create a new fix STORE style
-  // id = compute-ID + COMPUTE_STORE, fix group = compute group
-
-  id_fix = utils::strdup(std::string(id) + "_COMPUTE_STORE");
-  fix = dynamic_cast<FixStoreAtom *>(
-    modify->add_fix(fmt::format("{} {} STORE/ATOM 3 0 0 1", id_fix, group->names[igroup])));
-
-  // calculate xu,yu,zu for fix store array
-  // skip if reset from restart file
-
-  if (fix->restart_reset) fix->restart_reset = 0;
-  else {
-    double **xoriginal = fix->astore;
-
-    double **x = atom->x;
-    int *mask = atom->mask;
-    imageint *image = atom->image;
-    int nlocal = atom->nlocal;
-
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) domain->unmap(x[i],image[i],xoriginal[i]);
-      else xoriginal[i][0] = xoriginal[i][1] = xoriginal[i][2] = 0.0;
+  // without refresh the store holds plain unwrapped coords, so share one
+  //   store per group and creation timestep with other plain displacement
+  //   trackers (e.g. compute msd) instead of duplicating it
+  // otherwise id = compute-ID + COMPUTE_STORE, fix group = compute group
+
+  fix = nullptr;
+  if (!refreshflag) {
+    id_fix = utils::strdup(
+      fmt::format("REFSTORE_{}_{}", group->names[igroup], update->ntimestep));
+    fix = dynamic_cast<FixStoreAtom *>(modify->get_fix_by_id(id_fix));
+    if (fix) fix->refcount++;
+  } else id_fix = utils::strdup(std::string(id) + "_COMPUTE_STORE");
+
+  if (!fix) {
+    fix = dynamic_cast<FixStoreAtom *>(
+      modify->add_fix(fmt::format("{} {} STORE/ATOM 3 0 0 1", id_fix, group->names[igroup])));
+
+    // calculate xu,yu,zu for fix store array
+    // skip if reset from restart file
+
+    if (fix->restart_reset) fix->restart_reset = 0;
+    else {
+      double **xoriginal = fix->astore;
+
+      double **x = atom->x;
+      int *mask = atom->mask;
+      imageint *image = atom->image;
+      int nlocal = atom->nlocal;
+
+      for (int i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) domain->unmap(x[i],image[i],xoriginal[i]);
+        else xoriginal[i][0] = xoriginal[i][1] = xoriginal[i][2] = 0.0;
+    }
   }
 
   // per-atom displacement array
@@ -104,9 +116,11 @@ ComputeDisplaceAtom::ComputeDisplaceAtom(LAMMPS *lmp, int narg, char **arg) :
 
 ComputeDisplaceAtom::~ComputeDisplaceAtom()
 {
-  // check nfix in case all fixes have already been deleted
+  // delete fix unless shared and another compute still references it
+  // lookup by ID in case all fixes have already been deleted
 
-  if (modify->nfix) modify->delete_fix(id_fix);
+  auto *fstore = dynamic_cast<FixStoreAtom *>(modify->get_fix_by_id(id_fix));
+  if (fstore && (--fstore->refcount == 0)) modify->delete_fix(id_fix);
 
   delete [] id_fix;
   memory->destroy(displace);
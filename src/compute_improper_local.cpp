@@ -178,17 +178,17 @@ int ComputeImproperLocal::compute_impropers(int flag)
           vb1x = x[atom1][0] - x[atom2][0];
           vb1y = x[atom1][1] - x[atom2][1];
           vb1z = x[atom1][2] - x[atom2][2];
-          domain->minimum_image(vb1x,vb1y,vb1z);
+          domain->minimum_image_once(vb1x,vb1y,vb1z);
 
           vb2x = x[atom3][0] - x[atom2][0];
           vb2y = x[atom3][1] - x[atom2][1];
           vb2z = x[atom3][2] - x[atom2][2];
-          domain->minimum_image(vb2x,vb2y,vb2z);
+          domain->minimum_image_once(vb2x,vb2y,vb2z);
 
           vb3x = x[atom4][0] - x[atom3][0];
           vb3y = x[atom4][1] - x[atom3][1];
           vb3z = x[atom4][2] - x[atom3][2];
-          domain->minimum_image(vb3x,vb3y,vb3z);
+          domain->minimum_image_once(vb3x,vb3y,vb3z);
 
           ss1 = 1.0 / (vb1x*vb1x + vb1y*vb1y + vb1z*vb1z);
           ss2 = 1.0 / (vb2x*vb2x + vb2y*vb2y + vb2z*vb2z);
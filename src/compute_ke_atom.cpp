@@ -17,6 +17,7 @@
 #include "comm.h"
 #include "error.h"
 #include "force.h"
+#include "group.h"
 #include "memory.h"
 #include "modify.h"
 #include "update.h"
@@ -67,31 +68,32 @@ void ComputeKEAtom::compute_peratom()
   }
 
   // compute kinetic energy for each atom in group
+  // zero whole vector, then sweep over the list of group members only
 
   double mvv2e = force->mvv2e;
   double **v = atom->v;
   double *mass = atom->mass;
   double *rmass = atom->rmass;
-  int *mask = atom->mask;
   int *type = atom->type;
   int nlocal = atom->nlocal;
 
+  for (int i = 0; i < nlocal; i++) ke[i] = 0.0;
+
+  int nmember;
+  int *mlist = group->member_list(igroup, nmember);
+
   if (rmass)
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        ke[i] =
-            0.5 * mvv2e * rmass[i] * (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]);
-      } else
-        ke[i] = 0.0;
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      ke[i] =
+          0.5 * mvv2e * rmass[i] * (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]);
     }
 
   else
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        ke[i] = 0.5 * mvv2e * mass[type[i]] *
-            (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]);
-      } else
-        ke[i] = 0.0;
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      ke[i] = 0.5 * mvv2e * mass[type[i]] *
+          (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]);
     }
 }
 
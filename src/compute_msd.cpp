@@ -60,9 +60,22 @@ ComputeMSD::ComputeMSD(LAMMPS *lmp, int narg, char **arg) : Compute(lmp, narg, a
     error->all(FLERR, "Compute {} is not compatible with dynamic groups", style);
 
   // create a new fix STORE style for reference positions
-  // id = compute-ID + COMPUTE_STORE, fix group = compute group
+  // plain MSD (no com/average adjustment) stores the same unwrapped coords
+  //   as other plain displacement trackers, so share one store per group
+  //   and creation timestep instead of duplicating it
+  // otherwise id = compute-ID + COMPUTE_STORE, fix group = compute group
+
+  if (!comflag && !avflag) {
+    id_fix = utils::strdup(
+        fmt::format("REFSTORE_{}_{}", group->names[igroup], update->ntimestep));
+    fix = dynamic_cast<FixStoreAtom *>(modify->get_fix_by_id(id_fix));
+    if (fix) {
+      fix->refcount++;
+      vector = new double[size_vector];
+      return;
+    }
+  } else id_fix = utils::strdup(id + std::string("_COMPUTE_STORE"));
 
-  id_fix = utils::strdup(id + std::string("_COMPUTE_STORE"));
   fix = dynamic_cast<FixStoreAtom *>(
       modify->add_fix(fmt::format("{} {} STORE/ATOM 3 0 0 1", id_fix, group->names[igroup])));
 
@@ -113,9 +126,11 @@ ComputeMSD::ComputeMSD(LAMMPS *lmp, int narg, char **arg) : Compute(lmp, narg, a
 
 ComputeMSD::~ComputeMSD()
 {
-  // check nfix in case all fixes have already been deleted
+  // delete fix unless shared and another compute still references it
+  // lookup by ID in case all fixes have already been deleted
 
-  if (modify->nfix) modify->delete_fix(id_fix);
+  auto *fstore = dynamic_cast<FixStoreAtom *>(modify->get_fix_by_id(id_fix));
+  if (fstore && (--fstore->refcount == 0)) modify->delete_fix(id_fix);
 
   delete[] id_fix;
   delete[] vector;
@@ -223,8 +238,8 @@ void ComputeMSD::compute_vector()
 
         if (avflag) {
           xoriginal[i][0] = (xoriginal[i][0] * naverage + xtmp) * navfac;
-          xoriginal[i][1] = (xoriginal[i][0] * naverage + xtmp) * navfac;
-          xoriginal[i][2] = (xoriginal[i][0] * naverage + xtmp) * navfac;
+          xoriginal[i][1] = (xoriginal[i][1] * naverage + ytmp) * navfac;
+          xoriginal[i][2] = (xoriginal[i][2] * naverage + ztmp) * navfac;
         }
 
         dx = xtmp - xoriginal[i][0];
@@ -55,7 +55,7 @@ static constexpr double QEPSILON = 1.0e-6;
 ComputeOrientOrderAtom::ComputeOrientOrderAtom(LAMMPS *lmp, int narg, char **arg) :
     Compute(lmp, narg, arg), qlist(nullptr), qnormfac(nullptr), qnormfac2(nullptr), distsq(nullptr),
     nearest(nullptr), rlist(nullptr), qnarray(nullptr), qnm_r(nullptr), qnm_i(nullptr),
-    w3jlist(nullptr)
+    ylmnorm(nullptr), plmall(nullptr), w3jlist(nullptr)
 {
   if (narg < 3) error->all(FLERR, "Illegal compute orientorder/atom command");
 
@@ -160,6 +160,25 @@ ComputeOrientOrderAtom::ComputeOrientOrderAtom(LAMMPS *lmp, int narg, char **arg
     qnormfac[il] = sqrt(MY_4PI / (2.0 * l + 1.0));
     qnormfac2[il] = sqrt(2.0 * l + 1.0);
   }
+
+  // precompute Ylm normalization prefactors
+  // sqrt((2l+1) (l-m)! / (4pi (l+m)!)) so that
+  // Ylm = ylmnorm * P_l^m(cos(theta)) * exp(i*m*phi)
+  // calc_boop() then needs no factorials or sqrts per neighbor
+
+  memory->create(ylmnorm, nqlist, qmax + 1, "orientorder/atom:ylmnorm");
+  for (int il = 0; il < nqlist; il++) {
+    int l = qlist[il];
+    for (int m = 0; m <= l; m++) {
+      double facratio = 1.0;
+      for (int i = l - m + 1; i < l + m + 1; ++i) facratio *= static_cast<double>(i);
+      ylmnorm[il][m] = sqrt(static_cast<double>(2 * l + 1) / (MY_4PI * facratio));
+    }
+  }
+
+  // scratch space for the associated Legendre triangle of one neighbor
+
+  memory->create(plmall, qmax + 1, qmax + 1, "orientorder/atom:plmall");
 }
 
 /* --------------------------------------------------------------------- */
@@ -177,6 +196,8 @@ ComputeOrientOrderAtom::~ComputeOrientOrderAtom()
   memory->destroy(qnormfac2);
   memory->destroy(qnm_r);
   memory->destroy(qnm_i);
+  memory->destroy(ylmnorm);
+  memory->destroy(plmall);
   memory->destroy(w3jlist);
 }
 
@@ -320,6 +341,7 @@ double ComputeOrientOrderAtom::memory_usage()
 {
   double bytes = (double) ncol * nmax * sizeof(double);
   bytes += (double) (qmax * (2 * qmax + 1) + maxneigh * 4) * sizeof(double);
+  bytes += (double) (nqlist + qmax + 1) * (qmax + 1) * sizeof(double);
   bytes += (double) (nqlist + maxneigh) * sizeof(int);
   return bytes;
 }
@@ -446,6 +468,10 @@ void ComputeOrientOrderAtom::calc_boop(double **rlist, int ncount, double qn[],
       expphi_i *= rxymaginv;
     }
 
+    // one recurrence pass generates P_l^m for all (l,m) up to qmax
+
+    calc_plm(costheta);
+
     for (int il = 0; il < nqlist; il++) {
       int l = qlist[il];
 
@@ -453,12 +479,15 @@ void ComputeOrientOrderAtom::calc_boop(double **rlist, int ncount, double qn[],
       // Ylm, -l <= m <= l
       // sign convention: sign(Yll(0,0)) = (-1)^l
 
-      qnm_r[il][0] += polar_prefactor(l, 0, costheta);
+      const double *const plm = plmall[l];
+      const double *const norm = ylmnorm[il];
+
+      qnm_r[il][0] += norm[0] * plm[0];
       double expphim_r = expphi_r;
       double expphim_i = expphi_i;
       for (int m = 1; m <= +l; m++) {
 
-        double prefactor = polar_prefactor(l, m, costheta);
+        double prefactor = norm[m] * plm[m];
         double ylm_r = prefactor * expphim_r;
         double ylm_i = prefactor * expphim_i;
         qnm_r[il][m] += ylm_r;
@@ -571,6 +600,33 @@ void ComputeOrientOrderAtom::calc_boop(double **rlist, int ncount, double qn[],
   }
 }
 
+/* ----------------------------------------------------------------------
+   associated legendre polynomials P_l^m(x) for all 0 <= m <= l <= qmax
+   computed in one pass of the standard recurrences, stored in plmall[l][m]
+   sign convention: P(l,l) = (2l-1)!!(-sqrt(1-x^2))^l
+------------------------------------------------------------------------- */
+
+void ComputeOrientOrderAtom::calc_plm(double x)
+{
+  const double msqx = -sqrt(1.0 - x * x);
+
+  double pmm = 1.0;
+  for (int m = 0; m <= qmax; ++m) {
+    if (m != 0) pmm *= static_cast<double>(2 * m - 1) * msqx;
+    plmall[m][m] = pmm;
+
+    double pm1 = pmm;
+    double pm2 = 0.0;
+    for (int l = m + 1; l <= qmax; ++l) {
+      double p = (static_cast<double>(2 * l - 1) * x * pm1 - static_cast<double>(l + m - 1) * pm2) /
+          static_cast<double>(l - m);
+      plmall[l][m] = p;
+      pm2 = pm1;
+      pm1 = p;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    polar prefactor for spherical harmonic Y_l^m, where
    Y_l^m (theta, phi) = prefactor(l, m, cos(theta)) * exp(i*m*phi)
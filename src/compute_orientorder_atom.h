@@ -48,9 +48,12 @@ class ComputeOrientOrderAtom : public Compute {
   double **qnarray;
   double **qnm_r;
   double **qnm_i;
+  double **ylmnorm;    // precomputed Ylm normalization prefactors
+  double **plmall;     // associated Legendre triangle for one neighbor
 
   void select3(int, int, double *, int *, double **);
   void calc_boop(double **rlist, int numNeighbors, double qn[], int nlist[], int nnlist);
+  void calc_plm(double);
 
   double polar_prefactor(int, int, double);
   double associated_legendre(int, int, double);
@@ -16,6 +16,7 @@
 #include "atom.h"
 #include "error.h"
 #include "force.h"
+#include "group.h"
 #include "memory.h"
 #include "neigh_list.h"
 #include "neigh_request.h"
@@ -36,7 +37,8 @@ enum { TYPE, RADIUS };
 /* ---------------------------------------------------------------------- */
 
 ComputePairLocal::ComputePairLocal(LAMMPS *lmp, int narg, char **arg) :
-    Compute(lmp, narg, arg), pstyle(nullptr), pindex(nullptr), vlocal(nullptr), alocal(nullptr)
+    Compute(lmp, narg, arg), pstyle(nullptr), pindex(nullptr), vlocal(nullptr), alocal(nullptr),
+    cachei(nullptr), cachej(nullptr)
 {
   if (narg < 4) error->all(FLERR, "Illegal compute pair/local command");
 
@@ -113,6 +115,9 @@ ComputePairLocal::ComputePairLocal(LAMMPS *lmp, int narg, char **arg) :
   nmax = 0;
   vlocal = nullptr;
   alocal = nullptr;
+
+  cachestep = -1;
+  ncache = maxcache = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -121,6 +126,8 @@ ComputePairLocal::~ComputePairLocal()
 {
   memory->destroy(vlocal);
   memory->destroy(alocal);
+  memory->destroy(cachei);
+  memory->destroy(cachej);
   delete[] pstyle;
   delete[] pindex;
 }
@@ -161,24 +168,25 @@ void ComputePairLocal::compute_local()
 {
   invoked_local = update->ntimestep;
 
-  // count local entries and compute pair info
+  // compute pair info in a single pass, output arrays grow as needed
 
-  ncount = compute_pairs(0);
-  if (ncount > nmax) reallocate(ncount);
+  ncount = compute_pairs();
   size_local_rows = ncount;
-  compute_pairs(1);
 }
 
 /* ----------------------------------------------------------------------
-   count pairs and compute pair info on this proc
+   compute pair info on this proc in a single pass
    only count pair once if newton_pair is off
    both atom I,J must be in group
-   if flag is set, compute requested info about pair
+   the group and newton/tag tests are cached as a list of candidate pairs
+     reused until the next reneighboring, since local indices are stable
+     in between; the position-dependent cutoff test is re-applied to the
+     current coords on every invocation
 ------------------------------------------------------------------------- */
 
-int ComputePairLocal::compute_pairs(int flag)
+int ComputePairLocal::compute_pairs()
 {
-  int i, j, m, n, ii, jj, inum, jnum, itype, jtype;
+  int i, j, m, n, ii, jj, ic, inum, jnum, itype, jtype;
   tagint itag, jtag;
   double xtmp, ytmp, ztmp, delx, dely, delz;
   double rsq, radsum, eng, fpair, factor_coul, factor_lj;
@@ -197,127 +205,148 @@ int ComputePairLocal::compute_pairs(int flag)
 
   // invoke half neighbor list (will copy or build if necessary)
 
-  if (flag == 0) neighbor->build_one(list);
-
-  inum = list->inum;
-  ilist = list->ilist;
-  numneigh = list->numneigh;
-  firstneigh = list->firstneigh;
+  neighbor->build_one(list);
 
+  // rebuild the candidate pair list if the neighbor lists have been
+  //   rebuilt since it was last filled or if the group is dynamic
   // loop over neighbors of my atoms
   // skip if I or J are not in group
   // for newton = 0 and J = ghost atom,
   //   need to ensure I,J pair is only output by one proc
   //   use same itag,jtag logic as in Neighbor::neigh_half_nsq()
-  // for flag = 0, just count pair interactions within force cutoff
-  // for flag = 1, calculate requested output fields
+
+  if (cachestep < neighbor->lastcall || group->dynamic[igroup]) {
+    inum = list->inum;
+    ilist = list->ilist;
+    numneigh = list->numneigh;
+    firstneigh = list->firstneigh;
+
+    ncache = 0;
+    for (ii = 0; ii < inum; ii++) {
+      i = ilist[ii];
+      if (!(mask[i] & groupbit)) continue;
+
+      xtmp = x[i][0];
+      ytmp = x[i][1];
+      ztmp = x[i][2];
+      itag = tag[i];
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj] & NEIGHMASK;
+        if (!(mask[j] & groupbit)) continue;
+        jtag = tag[j];
+
+        // itag = jtag is possible for long cutoffs that include images of self
+
+        if (newton_pair == 0 && j >= nlocal) {
+          if (itag > jtag) {
+            if ((itag + jtag) % 2 == 0) continue;
+          } else if (itag < jtag) {
+            if ((itag + jtag) % 2 == 1) continue;
+          } else {
+            if (x[j][2] < ztmp) continue;
+            if (x[j][2] == ztmp) {
+              if (x[j][1] < ytmp) continue;
+              if (x[j][1] == ytmp && x[j][0] < xtmp) continue;
+            }
+          }
+        }
+
+        if (ncache == maxcache) {
+          maxcache += DELTA;
+          memory->grow(cachei, maxcache, "pair/local:cachei");
+          memory->grow(cachej, maxcache, "pair/local:cachej");
+        }
+        cachei[ncache] = i;
+        cachej[ncache] = jlist[jj];
+        ncache++;
+      }
+    }
+
+    cachestep = update->ntimestep;
+  }
+
+  // loop over candidate pairs, calculate requested output fields
+  //   for those within the force cutoff at the current coords
 
   Pair *pair = force->pair;
   double **cutsq = force->pair->cutsq;
 
   m = 0;
-  for (ii = 0; ii < inum; ii++) {
-    i = ilist[ii];
-    if (!(mask[i] & groupbit)) continue;
-
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itag = tag[i];
+  for (ic = 0; ic < ncache; ic++) {
+    i = cachei[ic];
+    j = cachej[ic];
+    factor_lj = special_lj[sbmask(j)];
+    factor_coul = special_coul[sbmask(j)];
+    j &= NEIGHMASK;
+
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    rsq = delx * delx + dely * dely + delz * delz;
     itype = type[i];
-    jlist = firstneigh[i];
-    jnum = numneigh[i];
-
-    for (jj = 0; jj < jnum; jj++) {
-      j = jlist[jj];
-      factor_lj = special_lj[sbmask(j)];
-      factor_coul = special_coul[sbmask(j)];
-      j &= NEIGHMASK;
-      jtag = tag[j];
-
-      if (!(mask[j] & groupbit)) continue;
-
-      // itag = jtag is possible for long cutoffs that include images of self
-
-      if (newton_pair == 0 && j >= nlocal) {
-        if (itag > jtag) {
-          if ((itag + jtag) % 2 == 0) continue;
-        } else if (itag < jtag) {
-          if ((itag + jtag) % 2 == 1) continue;
-        } else {
-          if (x[j][2] < ztmp) continue;
-          if (x[j][2] == ztmp) {
-            if (x[j][1] < ytmp) continue;
-            if (x[j][1] == ytmp && x[j][0] < xtmp) continue;
-          }
-        }
-      }
+    jtype = type[j];
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx * delx + dely * dely + delz * delz;
-      jtype = type[j];
-
-      if (cutstyle == TYPE) {
-        if (rsq >= cutsq[itype][jtype]) continue;
-      } else {
-        radsum = radius[i] + radius[j];
-        if (rsq >= radsum * radsum) continue;
-      }
+    if (cutstyle == TYPE) {
+      if (rsq >= cutsq[itype][jtype]) continue;
+    } else {
+      radsum = radius[i] + radius[j];
+      if (rsq >= radsum * radsum) continue;
+    }
 
-      if (flag) {
-        if (singleflag)
-          eng = pair->single(i, j, itype, jtype, rsq, factor_coul, factor_lj, fpair);
-        else
-          eng = fpair = 0.0;
-
-        if (nvalues == 1)
-          ptr = &vlocal[m];
-        else
-          ptr = alocal[m];
-
-        // to make sure dx, dy and dz are always from the lower to the higher id
-        double directionCorrection = itag > jtag ? -1.0 : 1.0;
-
-        for (n = 0; n < nvalues; n++) {
-          switch (pstyle[n]) {
-            case DIST:
-              ptr[n] = sqrt(rsq);
-              break;
-            case DX:
-              ptr[n] = delx * directionCorrection;
-              break;
-            case DY:
-              ptr[n] = dely * directionCorrection;
-              break;
-            case DZ:
-              ptr[n] = delz * directionCorrection;
-              break;
-            case ENG:
-              ptr[n] = eng;
-              break;
-            case FORCE:
-              ptr[n] = sqrt(rsq) * fpair;
-              break;
-            case FX:
-              ptr[n] = delx * fpair;
-              break;
-            case FY:
-              ptr[n] = dely * fpair;
-              break;
-            case FZ:
-              ptr[n] = delz * fpair;
-              break;
-            case PN:
-              ptr[n] = pair->svector[pindex[n]];
-              break;
-          }
-        }
+    if (m == nmax) reallocate(m + 1);
+
+    if (singleflag)
+      eng = pair->single(i, j, itype, jtype, rsq, factor_coul, factor_lj, fpair);
+    else
+      eng = fpair = 0.0;
+
+    if (nvalues == 1)
+      ptr = &vlocal[m];
+    else
+      ptr = alocal[m];
+
+    // to make sure dx, dy and dz are always from the lower to the higher id
+    double directionCorrection = tag[i] > tag[j] ? -1.0 : 1.0;
+
+    for (n = 0; n < nvalues; n++) {
+      switch (pstyle[n]) {
+        case DIST:
+          ptr[n] = sqrt(rsq);
+          break;
+        case DX:
+          ptr[n] = delx * directionCorrection;
+          break;
+        case DY:
+          ptr[n] = dely * directionCorrection;
+          break;
+        case DZ:
+          ptr[n] = delz * directionCorrection;
+          break;
+        case ENG:
+          ptr[n] = eng;
+          break;
+        case FORCE:
+          ptr[n] = sqrt(rsq) * fpair;
+          break;
+        case FX:
+          ptr[n] = delx * fpair;
+          break;
+        case FY:
+          ptr[n] = dely * fpair;
+          break;
+        case FZ:
+          ptr[n] = delz * fpair;
+          break;
+        case PN:
+          ptr[n] = pair->svector[pindex[n]];
+          break;
       }
-
-      m++;
     }
+
+    m++;
   }
 
   return m;
@@ -327,17 +356,15 @@ int ComputePairLocal::compute_pairs(int flag)
 
 void ComputePairLocal::reallocate(int n)
 {
-  // grow vector_local or array_local
+  // grow vector_local or array_local, preserving already computed entries
 
   while (nmax < n) nmax += DELTA;
 
   if (nvalues == 1) {
-    memory->destroy(vlocal);
-    memory->create(vlocal, nmax, "pair/local:vector_local");
+    memory->grow(vlocal, nmax, "pair/local:vector_local");
     vector_local = vlocal;
   } else {
-    memory->destroy(alocal);
-    memory->create(alocal, nmax, nvalues, "pair/local:array_local");
+    memory->grow(alocal, nmax, nvalues, "pair/local:array_local");
     array_local = alocal;
   }
 }
@@ -349,5 +376,6 @@ void ComputePairLocal::reallocate(int n)
 double ComputePairLocal::memory_usage()
 {
   double bytes = (double) nmax * nvalues * sizeof(double);
+  bytes += (double) 2 * maxcache * sizeof(int);
   return bytes;
 }
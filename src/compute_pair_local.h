@@ -44,9 +44,17 @@ class ComputePairLocal : public Compute {
   double *vlocal;
   double **alocal;
 
+  // cached candidate pairs, i.e. neighbor list entries that passed the
+  // group and newton/tag tests, reused until the next reneighboring
+
+  bigint cachestep;           // timestep the cache was built on, -1 if invalid
+  int ncache, maxcache;       // # of candidate pairs and allocated size
+  int *cachei, *cachej;       // local indices of each candidate pair
+                              // cachej retains special bond bits
+
   class NeighList *list;
 
-  int compute_pairs(int);
+  int compute_pairs();
   void reallocate(int);
 };
 
@@ -238,9 +238,15 @@ double ComputePressure::compute_scalar()
       temperature->compute_scalar();
   }
 
+  // if the full tensor was already assembled this step, e.g. by a
+  //   barostat, its reduced diagonal is still valid: reuse it instead
+  //   of re-assembling and re-reducing the virial
+
+  const int reuse = (invoked_vector == update->ntimestep);
+
   if (dimension == 3) {
     inv_volume = 1.0 / (domain->xprd * domain->yprd * domain->zprd);
-    virial_compute(3,3);
+    if (!reuse) virial_compute(3,3);
     if (keflag)
       scalar = (temperature->dof * boltz * temperature->scalar +
                 virial[0] + virial[1] + virial[2]) / 3.0 * inv_volume * nktv2p;
@@ -248,7 +254,7 @@ double ComputePressure::compute_scalar()
       scalar = (virial[0] + virial[1] + virial[2]) / 3.0 * inv_volume * nktv2p;
   } else {
     inv_volume = 1.0 / (domain->xprd * domain->yprd);
-    virial_compute(2,2);
+    if (!reuse) virial_compute(2,2);
     if (keflag)
       scalar = (temperature->dof * boltz * temperature->scalar +
                 virial[0] + virial[1]) / 2.0 * inv_volume * nktv2p;
@@ -58,10 +58,12 @@ ComputeRDF::ComputeRDF(LAMMPS *lmp, int narg, char **arg) :
   // nargpair = # of pairwise args, starting at iarg = 4
 
   cutflag = 0;
+  stride = 1;
+  strideoffset = 0;
 
   int iarg;
   for (iarg = 4; iarg < narg; iarg++)
-    if (strcmp(arg[iarg],"cutoff") == 0) break;
+    if ((strcmp(arg[iarg],"cutoff") == 0) || (strcmp(arg[iarg],"stride") == 0)) break;
 
   int nargpair = iarg - 4;
 
@@ -74,6 +76,11 @@ ComputeRDF::ComputeRDF(LAMMPS *lmp, int narg, char **arg) :
       if (cutoff_user <= 0.0) cutflag = 0;
       else cutflag = 1;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"stride") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR,"compute rdf stride", error);
+      stride = utils::inumeric(FLERR,arg[iarg+1],false,lmp);
+      if (stride < 1) error->all(FLERR,"Illegal compute rdf stride value: {}", stride);
+      iarg += 2;
     } else error->all(FLERR,"Unknown compute rdf keyword {}", arg[iarg]);
   }
 
@@ -194,6 +201,7 @@ void ComputeRDF::init()
   } else delr = force->pair->cutforce / nbin;
 
   delrinv = 1.0/delr;
+  cutsq_bin = (nbin*delr) * (nbin*delr);
 
   // set 1st column of output array to bin coords
 
@@ -277,7 +285,7 @@ void ComputeRDF::init_norm()
 void ComputeRDF::compute_array()
 {
   int i,j,m,ii,jj,inum,jnum,itype,jtype,ipair,jpair,ibin,ihisto;
-  double xtmp,ytmp,ztmp,delx,dely,delz,r;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,r;
   int *ilist,*jlist,*numneigh,**firstneigh;
   double factor_lj,factor_coul;
 
@@ -314,6 +322,10 @@ void ComputeRDF::compute_array()
   // itype,jtype must have been specified by user
   // consider I,J as one interaction even if neighbor pair is stored on 2 procs
   // tally I,J pair each time I is central atom, and each time J is central
+  // if stride > 1, only every stride-th central atom is visited and the
+  //   resulting counts are scaled by stride, an unbiased but noisier estimate
+  //   the starting offset rotates between invocations so successive samples
+  //   cover different subsets of atoms
 
   double **x = atom->x;
   int *type = atom->type;
@@ -324,58 +336,120 @@ void ComputeRDF::compute_array()
   double *special_lj = force->special_lj;
   int newton_pair = force->newton_pair;
 
-  for (ii = 0; ii < inum; ii++) {
-    i = ilist[ii];
-    if (!(mask[i] & groupbit)) continue;
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
-    jlist = firstneigh[i];
-    jnum = numneigh[i];
-
-    for (jj = 0; jj < jnum; jj++) {
-      j = jlist[jj];
-      factor_lj = special_lj[sbmask(j)];
-      factor_coul = special_coul[sbmask(j)];
-      j &= NEIGHMASK;
-
-      // if both weighting factors are 0, skip this pair
-      // could be 0 and still be in neigh list for long-range Coulombics
-      // want consistency with non-charged pairs which wouldn't be in list
-
-      if (factor_lj == 0.0 && factor_coul == 0.0) continue;
-
-      if (!(mask[j] & groupbit)) continue;
-      jtype = type[j];
-      ipair = nrdfpair[itype][jtype];
-      jpair = nrdfpair[jtype][itype];
-      if (!ipair && !jpair) continue;
-
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      r = sqrt(delx*delx + dely*dely + delz*delz);
-      ibin = static_cast<int> (r*delrinv);
-      if (ibin >= nbin) continue;
-
-      for (ihisto = 0; ihisto < ipair; ihisto++) {
-        m = rdfpair[ihisto][itype][jtype];
-        hist[m][ibin] += 1.0;
+  int iifirst = 0;
+  if (stride > 1) {
+    iifirst = strideoffset;
+    strideoffset = (strideoffset + 1) % stride;
+  }
+
+  if (npairs == 1) {
+
+    // common case of a single histogram: increment a flat histogram
+    // without the per-histogram indirection of the general path
+
+    double *histone = hist[0];
+
+    for (ii = iifirst; ii < inum; ii += stride) {
+      i = ilist[ii];
+      if (!(mask[i] & groupbit)) continue;
+      xtmp = x[i][0];
+      ytmp = x[i][1];
+      ztmp = x[i][2];
+      itype = type[i];
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj];
+        factor_lj = special_lj[sbmask(j)];
+        factor_coul = special_coul[sbmask(j)];
+        j &= NEIGHMASK;
+
+        if (factor_lj == 0.0 && factor_coul == 0.0) continue;
+
+        if (!(mask[j] & groupbit)) continue;
+        jtype = type[j];
+        ipair = nrdfpair[itype][jtype];
+        jpair = nrdfpair[jtype][itype];
+        if (!ipair && !jpair) continue;
+
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+        if (rsq >= cutsq_bin) continue;
+        r = sqrt(rsq);
+        ibin = static_cast<int> (r*delrinv);
+        if (ibin >= nbin) continue;
+
+        if (newton_pair || j < nlocal) histone[ibin] += ipair + jpair;
+        else histone[ibin] += ipair;
       }
-      if (newton_pair || j < nlocal) {
-        for (ihisto = 0; ihisto < jpair; ihisto++) {
-          m = rdfpair[ihisto][jtype][itype];
+    }
+
+  } else {
+
+    for (ii = iifirst; ii < inum; ii += stride) {
+      i = ilist[ii];
+      if (!(mask[i] & groupbit)) continue;
+      xtmp = x[i][0];
+      ytmp = x[i][1];
+      ztmp = x[i][2];
+      itype = type[i];
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj];
+        factor_lj = special_lj[sbmask(j)];
+        factor_coul = special_coul[sbmask(j)];
+        j &= NEIGHMASK;
+
+        // if both weighting factors are 0, skip this pair
+        // could be 0 and still be in neigh list for long-range Coulombics
+        // want consistency with non-charged pairs which wouldn't be in list
+
+        if (factor_lj == 0.0 && factor_coul == 0.0) continue;
+
+        if (!(mask[j] & groupbit)) continue;
+        jtype = type[j];
+        ipair = nrdfpair[itype][jtype];
+        jpair = nrdfpair[jtype][itype];
+        if (!ipair && !jpair) continue;
+
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+        if (rsq >= cutsq_bin) continue;
+        r = sqrt(rsq);
+        ibin = static_cast<int> (r*delrinv);
+        if (ibin >= nbin) continue;
+
+        for (ihisto = 0; ihisto < ipair; ihisto++) {
+          m = rdfpair[ihisto][itype][jtype];
           hist[m][ibin] += 1.0;
         }
+        if (newton_pair || j < nlocal) {
+          for (ihisto = 0; ihisto < jpair; ihisto++) {
+            m = rdfpair[ihisto][jtype][itype];
+            hist[m][ibin] += 1.0;
+          }
+        }
       }
     }
   }
 
   // sum histograms across procs
+  // rescale strided counts so the estimate stays unbiased
 
   MPI_Allreduce(hist[0],histall[0],npairs*nbin,MPI_DOUBLE,MPI_SUM,world);
 
+  if (stride > 1)
+    for (i = 0; i < npairs; i++)
+      for (j = 0; j < nbin; j++)
+        histall[i][j] *= stride;
+
   // convert counts to g(r) and coord(r) and copy into output array
   // vfrac = fraction of volume in shell m
   // npairs = number of pairs, corrected for duplicates
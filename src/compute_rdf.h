@@ -36,7 +36,10 @@ class ComputeRDF : public Compute {
   int nbin;                // # of rdf bins
   int cutflag;             // user cutoff flag
   int npairs;              // # of rdf pairs
+  int stride;              // tally every this many central atoms
+  int strideoffset;        // rotating start offset for strided sampling
   double delr, delrinv;    // bin width and its inverse
+  double cutsq_bin;        // squared distance of outermost bin edge
   double cutoff_user;      // user-specified cutoff
   double mycutneigh;       // user-specified cutoff + neighbor skin
   int ***rdfpair;          // map 2 type pair to rdf pair for each histo
@@ -21,6 +21,7 @@
 #include "error.h"
 #include "fix.h"
 #include "force.h"
+#include "group.h"
 #include "improper.h"
 #include "kspace.h"
 #include "memory.h"
@@ -46,6 +47,7 @@ ComputeStressAtom::ComputeStressAtom(LAMMPS *lmp, int narg, char **arg) :
   pressatomflag = 1;
   timeflag = 1;
   comm_reverse = 6;
+  comm_reverse_array = 1;
 
   // store temperature ID used by stress computation
   // ensure it is valid for temperature computation
@@ -175,43 +177,34 @@ void ComputeStressAtom::compute_peratom()
   for (i = 0; i < ntotal; i++)
     for (j = 0; j < 6; j++) stress[i][j] = 0.0;
 
+  // if group is a strict subset of the local atoms, accumulate virials
+  //   only for group members (owned via member list, ghosts via mask,
+  //   which is communicated to ghost atoms), leaving other rows zero
+  // otherwise accumulate densely without the indexed access
+
+  int nmember;
+  int *mlist = group->member_list(igroup, nmember);
+  int sparse = (nmember < nlocal);
+
   // add in per-atom contributions from each force
 
-  if (pairflag && force->pair && force->pair->compute_flag) {
-    double **vatom = force->pair->vatom;
-    for (i = 0; i < npair; i++)
-      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
-  }
+  if (pairflag && force->pair && force->pair->compute_flag)
+    add_vatom(force->pair->vatom, npair, mlist, nmember, sparse);
 
-  if (bondflag && force->bond) {
-    double **vatom = force->bond->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
-  }
+  if (bondflag && force->bond)
+    add_vatom(force->bond->vatom, nbond, mlist, nmember, sparse);
 
-  if (angleflag && force->angle) {
-    double **vatom = force->angle->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
-  }
+  if (angleflag && force->angle)
+    add_vatom(force->angle->vatom, nbond, mlist, nmember, sparse);
 
-  if (dihedralflag && force->dihedral) {
-    double **vatom = force->dihedral->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
-  }
+  if (dihedralflag && force->dihedral)
+    add_vatom(force->dihedral->vatom, nbond, mlist, nmember, sparse);
 
-  if (improperflag && force->improper) {
-    double **vatom = force->improper->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
-  }
+  if (improperflag && force->improper)
+    add_vatom(force->improper->vatom, nbond, mlist, nmember, sparse);
 
-  if (kspaceflag && force->kspace && force->kspace->compute_flag) {
-    double **vatom = force->kspace->vatom;
-    for (i = 0; i < nkspace; i++)
-      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
-  }
+  if (kspaceflag && force->kspace && force->kspace->compute_flag)
+    add_vatom(force->kspace->vatom, nkspace, mlist, nmember, sparse);
 
   // add in per-atom contributions from relevant fixes
   // skip if vatom = nullptr
@@ -223,9 +216,7 @@ void ComputeStressAtom::compute_peratom()
     for (auto &ifix : modify->get_fix_list())
       if (ifix->virial_peratom_flag && ifix->thermo_virial) {
         double **vatom = ifix->vatom;
-        if (vatom)
-          for (i = 0; i < nlocal; i++)
-            for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
+        if (vatom) add_vatom(vatom, nlocal, mlist, nmember, sparse);
       }
   }
 
@@ -235,18 +226,21 @@ void ComputeStressAtom::compute_peratom()
 
   // zero virial of atoms not in group
   // only do this after comm since ghost contributions must be included
+  // in the sparse path non-member rows were never accumulated, and
+  //   reverse comm only adds ghost rows which are zero for non-members
 
   int *mask = atom->mask;
 
-  for (i = 0; i < nlocal; i++)
-    if (!(mask[i] & groupbit)) {
-      stress[i][0] = 0.0;
-      stress[i][1] = 0.0;
-      stress[i][2] = 0.0;
-      stress[i][3] = 0.0;
-      stress[i][4] = 0.0;
-      stress[i][5] = 0.0;
-    }
+  if (!sparse)
+    for (i = 0; i < nlocal; i++)
+      if (!(mask[i] & groupbit)) {
+        stress[i][0] = 0.0;
+        stress[i][1] = 0.0;
+        stress[i][2] = 0.0;
+        stress[i][3] = 0.0;
+        stress[i][4] = 0.0;
+        stress[i][5] = 0.0;
+      }
 
   // include kinetic energy term for each atom in group
   // apply temperature bias is applicable
@@ -261,28 +255,28 @@ void ComputeStressAtom::compute_peratom()
 
     if (biasflag == NOBIAS) {
       if (rmass) {
-        for (i = 0; i < nlocal; i++)
-          if (mask[i] & groupbit) {
-            onemass = mvv2e * rmass[i];
-            stress[i][0] += onemass * v[i][0] * v[i][0];
-            stress[i][1] += onemass * v[i][1] * v[i][1];
-            stress[i][2] += onemass * v[i][2] * v[i][2];
-            stress[i][3] += onemass * v[i][0] * v[i][1];
-            stress[i][4] += onemass * v[i][0] * v[i][2];
-            stress[i][5] += onemass * v[i][1] * v[i][2];
-          }
+        for (int m = 0; m < nmember; m++) {
+          i = mlist[m];
+          onemass = mvv2e * rmass[i];
+          stress[i][0] += onemass * v[i][0] * v[i][0];
+          stress[i][1] += onemass * v[i][1] * v[i][1];
+          stress[i][2] += onemass * v[i][2] * v[i][2];
+          stress[i][3] += onemass * v[i][0] * v[i][1];
+          stress[i][4] += onemass * v[i][0] * v[i][2];
+          stress[i][5] += onemass * v[i][1] * v[i][2];
+        }
 
       } else {
-        for (i = 0; i < nlocal; i++)
-          if (mask[i] & groupbit) {
-            onemass = mvv2e * mass[type[i]];
-            stress[i][0] += onemass * v[i][0] * v[i][0];
-            stress[i][1] += onemass * v[i][1] * v[i][1];
-            stress[i][2] += onemass * v[i][2] * v[i][2];
-            stress[i][3] += onemass * v[i][0] * v[i][1];
-            stress[i][4] += onemass * v[i][0] * v[i][2];
-            stress[i][5] += onemass * v[i][1] * v[i][2];
-          }
+        for (int m = 0; m < nmember; m++) {
+          i = mlist[m];
+          onemass = mvv2e * mass[type[i]];
+          stress[i][0] += onemass * v[i][0] * v[i][0];
+          stress[i][1] += onemass * v[i][1] * v[i][1];
+          stress[i][2] += onemass * v[i][2] * v[i][2];
+          stress[i][3] += onemass * v[i][0] * v[i][1];
+          stress[i][4] += onemass * v[i][0] * v[i][2];
+          stress[i][5] += onemass * v[i][1] * v[i][2];
+        }
       }
 
     } else {
@@ -293,32 +287,32 @@ void ComputeStressAtom::compute_peratom()
       if (keflag && temperature->invoked_scalar != update->ntimestep) temperature->compute_scalar();
 
       if (rmass) {
-        for (i = 0; i < nlocal; i++)
-          if (mask[i] & groupbit) {
-            temperature->remove_bias(i, v[i]);
-            onemass = mvv2e * rmass[i];
-            stress[i][0] += onemass * v[i][0] * v[i][0];
-            stress[i][1] += onemass * v[i][1] * v[i][1];
-            stress[i][2] += onemass * v[i][2] * v[i][2];
-            stress[i][3] += onemass * v[i][0] * v[i][1];
-            stress[i][4] += onemass * v[i][0] * v[i][2];
-            stress[i][5] += onemass * v[i][1] * v[i][2];
-            temperature->restore_bias(i, v[i]);
-          }
+        for (int m = 0; m < nmember; m++) {
+          i = mlist[m];
+          temperature->remove_bias(i, v[i]);
+          onemass = mvv2e * rmass[i];
+          stress[i][0] += onemass * v[i][0] * v[i][0];
+          stress[i][1] += onemass * v[i][1] * v[i][1];
+          stress[i][2] += onemass * v[i][2] * v[i][2];
+          stress[i][3] += onemass * v[i][0] * v[i][1];
+          stress[i][4] += onemass * v[i][0] * v[i][2];
+          stress[i][5] += onemass * v[i][1] * v[i][2];
+          temperature->restore_bias(i, v[i]);
+        }
 
       } else {
-        for (i = 0; i < nlocal; i++)
-          if (mask[i] & groupbit) {
-            temperature->remove_bias(i, v[i]);
-            onemass = mvv2e * mass[type[i]];
-            stress[i][0] += onemass * v[i][0] * v[i][0];
-            stress[i][1] += onemass * v[i][1] * v[i][1];
-            stress[i][2] += onemass * v[i][2] * v[i][2];
-            stress[i][3] += onemass * v[i][0] * v[i][1];
-            stress[i][4] += onemass * v[i][0] * v[i][2];
-            stress[i][5] += onemass * v[i][1] * v[i][2];
-            temperature->restore_bias(i, v[i]);
-          }
+        for (int m = 0; m < nmember; m++) {
+          i = mlist[m];
+          temperature->remove_bias(i, v[i]);
+          onemass = mvv2e * mass[type[i]];
+          stress[i][0] += onemass * v[i][0] * v[i][0];
+          stress[i][1] += onemass * v[i][1] * v[i][1];
+          stress[i][2] += onemass * v[i][2] * v[i][2];
+          stress[i][3] += onemass * v[i][0] * v[i][1];
+          stress[i][4] += onemass * v[i][0] * v[i][2];
+          stress[i][5] += onemass * v[i][1] * v[i][2];
+          temperature->restore_bias(i, v[i]);
+        }
       }
     }
   }
@@ -326,15 +320,41 @@ void ComputeStressAtom::compute_peratom()
   // convert to stress*volume units = -pressure*volume
 
   double nktv2p = -force->nktv2p;
-  for (i = 0; i < nlocal; i++)
-    if (mask[i] & groupbit) {
-      stress[i][0] *= nktv2p;
-      stress[i][1] *= nktv2p;
-      stress[i][2] *= nktv2p;
-      stress[i][3] *= nktv2p;
-      stress[i][4] *= nktv2p;
-      stress[i][5] *= nktv2p;
+  for (int m = 0; m < nmember; m++) {
+    i = mlist[m];
+    stress[i][0] *= nktv2p;
+    stress[i][1] *= nktv2p;
+    stress[i][2] *= nktv2p;
+    stress[i][3] *= nktv2p;
+    stress[i][4] *= nktv2p;
+    stress[i][5] *= nktv2p;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   accumulate a per-atom virial array into the stress array
+   sparse path visits owned group members via the member list and tests
+     ghost atoms against the group mask, other rows remain zero
+------------------------------------------------------------------------- */
+
+void ComputeStressAtom::add_vatom(double **vatom, int nall, int *mlist, int nmember, int sparse)
+{
+  int i, j;
+
+  if (!sparse) {
+    for (i = 0; i < nall; i++)
+      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
+  } else {
+    int *mask = atom->mask;
+    int nlocal = atom->nlocal;
+    for (int m = 0; m < nmember; m++) {
+      i = mlist[m];
+      for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
     }
+    for (i = nlocal; i < nall; i++)
+      if (mask[i] & groupbit)
+        for (j = 0; j < 6; j++) stress[i][j] += vatom[i][j];
+  }
 }
 
 /* ---------------------------------------------------------------------- */
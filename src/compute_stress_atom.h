@@ -42,6 +42,8 @@ class ComputeStressAtom : public Compute {
 
   int nmax;
   double **stress;
+
+  void add_vatom(double **, int, int *, int, int);
 };
 
 }    // namespace LAMMPS_NS
@@ -33,6 +33,7 @@ ComputeTemp::ComputeTemp(LAMMPS *lmp, int narg, char **arg) : Compute(lmp, narg,
   extscalar = 0;
   extvector = 1;
   tempflag = 1;
+  vector_fusable = 1;
 
   vector = new double[size_vector];
 }
@@ -71,42 +72,34 @@ void ComputeTemp::dof_compute()
 
 double ComputeTemp::compute_scalar()
 {
-  invoked_scalar = update->ntimestep;
-
-  double **v = atom->v;
-  double *mass = atom->mass;
-  double *rmass = atom->rmass;
-  int *type = atom->type;
-  int *mask = atom->mask;
-  int nlocal = atom->nlocal;
-
-  double t = 0.0;
-
-  if (rmass) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit)
-        t += (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]) * rmass[i];
-  } else {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit)
-        t += (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]) * mass[type[i]];
-  }
-
-  MPI_Allreduce(&t, &scalar, 1, MPI_DOUBLE, MPI_SUM, world);
-  if (dynamic) dof_compute();
-  if (dof < 0.0 && natoms_temp > 0.0)
-    error->all(FLERR, "Temperature compute degrees of freedom < 0");
-  scalar *= tfactor;
+  compute_fused(vector_fusable);
   return scalar;
 }
 
 /* ---------------------------------------------------------------------- */
 
 void ComputeTemp::compute_vector()
+{
+  compute_fused(1);
+}
+
+/* ----------------------------------------------------------------------
+   fused sweep computing the scalar and the KE tensor together
+   thermostatted runs with pressure output invoke both every step, and
+     consumers cache on invoked_scalar/invoked_vector, so filling both
+     from one pass over v[] halves the velocity traffic
+   fillvector = 0 skips publishing the vector, used for scalar calls on
+     derived classes which post-process the vector after the sweep
+   the scalar keeps its own accumulator so both results are summed in
+     the same order as the former separate sweeps
+------------------------------------------------------------------------- */
+
+void ComputeTemp::compute_fused(int fillvector)
 {
   int i;
 
-  invoked_vector = update->ntimestep;
+  invoked_scalar = update->ntimestep;
+  if (fillvector) invoked_vector = update->ntimestep;
 
   double **v = atom->v;
   double *mass = atom->mass;
@@ -115,8 +108,8 @@ void ComputeTemp::compute_vector()
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
 
-  double massone, t[6];
-  for (i = 0; i < 6; i++) t[i] = 0.0;
+  double massone, t[7];
+  for (i = 0; i < 7; i++) t[i] = 0.0;
 
   for (i = 0; i < nlocal; i++)
     if (mask[i] & groupbit) {
@@ -130,8 +123,17 @@ void ComputeTemp::compute_vector()
       t[3] += massone * v[i][0] * v[i][1];
       t[4] += massone * v[i][0] * v[i][2];
       t[5] += massone * v[i][1] * v[i][2];
+      t[6] += (v[i][0] * v[i][0] + v[i][1] * v[i][1] + v[i][2] * v[i][2]) * massone;
     }
 
-  MPI_Allreduce(t, vector, 6, MPI_DOUBLE, MPI_SUM, world);
-  for (i = 0; i < 6; i++) vector[i] *= force->mvv2e;
+  double tall[7];
+  MPI_Allreduce(t, tall, 7, MPI_DOUBLE, MPI_SUM, world);
+  if (fillvector)
+    for (i = 0; i < 6; i++) vector[i] = tall[i] * force->mvv2e;
+
+  scalar = tall[6];
+  if (dynamic) dof_compute();
+  if (dof < 0.0 && natoms_temp > 0.0)
+    error->all(FLERR, "Temperature compute degrees of freedom < 0");
+  scalar *= tfactor;
 }
@@ -35,8 +35,13 @@ class ComputeTemp : public Compute {
 
  protected:
   double tfactor;
+  int vector_fusable;    // 0 if derived class post-processes vector, so a
+                         // scalar call must not publish the fused vector
 
   virtual void dof_compute();
+
+ private:
+  void compute_fused(int);
 };
 
 }    // namespace LAMMPS_NS
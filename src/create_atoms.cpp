@@ -1326,9 +1326,24 @@ void CreateAtoms::add_lattice()
   if (domain->dimension == 2) klo = khi = 0;
 
   // count lattice sites on each proc
+  // when filling the box with atoms and no subset selection, the count
+  //   pass over all sites is skipped: the loop bounds provide an exact
+  //   overflow check and a tight upper bound for the pre-allocation,
+  //   so each lattice site is only enumerated once by the insert pass
+  // the overflow reduction is performed either way, since which pass a
+  //   proc takes depends on its own loop bounds
 
   nlatt_overflow = 0;
-  loop_lattice(COUNT);
+  int countflag = 1;
+  if (subsetflag == NONE && style == BOX && varflag == 0 && mode == ATOM) {
+    bigint bcount = (bigint) (ihi - ilo + 1) * (jhi - jlo + 1);
+    bcount *= (bigint) (khi - klo + 1) * nbasis;
+    if (bcount < MAXSMALLINT) {
+      countflag = 0;
+      nlatt = static_cast<int>(bcount);
+    }
+  }
+  if (countflag) loop_lattice(COUNT);
 
   // nadd = # of atoms each proc will insert (estimated if subsetflag)
 
@@ -1339,7 +1354,9 @@ void CreateAtoms::add_lattice()
   bigint nadd;
 
   if (subsetflag == NONE) {
-    if (comm->nprocs == 1)
+    if (countflag == 0)
+      nadd = nlatt;
+    else if (comm->nprocs == 1)
       nadd = nlatt;
     else
       nadd = static_cast<bigint>(LB_FACTOR * nlatt);
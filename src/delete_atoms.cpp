@@ -592,12 +592,12 @@ void DeleteAtoms::delete_bond()
 {
   // hash = for atom IDs being deleted by one processor
   // list of these IDs is sent around ring
-  // at each stage of ring pass, hash is re-populated with received IDs
+  // for each chunk of the gathered list, hash is re-populated with its IDs
 
   hash = new std::map<tagint, int>();
 
   // list = set of unique molecule IDs from which I deleted atoms
-  // pass list to all other procs via comm->ring()
+  // pass list to all other procs via comm->ring_gather()
 
   tagint *tag = atom->tag;
   int nlocal = atom->nlocal;
@@ -612,7 +612,7 @@ void DeleteAtoms::delete_bond()
   for (int i = 0; i < nlocal; i++)
     if (dlist[i]) list[n++] = tag[i];
 
-  comm->ring(n, sizeof(tagint), list, 1, bondring, nullptr, (void *) this);
+  comm->ring_gather(n, sizeof(tagint), list, bondring, (void *) this);
 
   delete hash;
   memory->destroy(list);
@@ -639,7 +639,7 @@ void DeleteAtoms::delete_molecule()
   }
 
   // list = set of unique molecule IDs from which I deleted atoms
-  // pass list to all other procs via comm->ring()
+  // pass list to all other procs via comm->ring_gather()
 
   int n = hash->size();
   tagint *list;
@@ -649,7 +649,7 @@ void DeleteAtoms::delete_molecule()
   std::map<tagint, int>::iterator pos;
   for (pos = hash->begin(); pos != hash->end(); ++pos) list[n++] = pos->first;
 
-  comm->ring(n, sizeof(tagint), list, 1, molring, nullptr, (void *) this);
+  comm->ring_gather(n, sizeof(tagint), list, molring, (void *) this);
 
   delete hash;
   memory->destroy(list);
@@ -719,7 +719,7 @@ void DeleteAtoms::recount_topology()
 }
 
 /* ----------------------------------------------------------------------
-   callback from comm->ring() in delete_bond()
+   callback from comm->ring_gather() in delete_bond()
 ------------------------------------------------------------------------- */
 
 void DeleteAtoms::bondring(int nbuf, char *cbuf, void *ptr)
@@ -849,7 +849,7 @@ void DeleteAtoms::bondring(int nbuf, char *cbuf, void *ptr)
 }
 
 /* ----------------------------------------------------------------------
-   callback from comm->ring() in delete_molecule()
+   callback from comm->ring_gather() in delete_molecule()
 ------------------------------------------------------------------------- */
 
 void DeleteAtoms::molring(int n, char *cbuf, void *ptr)
@@ -1351,6 +1351,29 @@ void Domain::minimum_image_big(double &dx, double &dy, double &dz) const
   }
 }
 
+/* ----------------------------------------------------------------------
+   minimum image convention applied to N displacements stored in
+     separate dx/dy/dz arrays
+   same branchless single-shot floor-based wrap as minimum_image_once(),
+     written as per-dimension loops over contiguous data
+     so the compiler can vectorize them
+------------------------------------------------------------------------- */
+
+void Domain::minimum_image_batch(int n, double *dx, double *dy, double *dz) const
+{
+  if (triclinic == 0) {
+    if (xperiodic)
+      for (int i = 0; i < n; i++) dx[i] -= xprd * floor(dx[i] / xprd + 0.5);
+    if (yperiodic)
+      for (int i = 0; i < n; i++) dy[i] -= yprd * floor(dy[i] / yprd + 0.5);
+    if (zperiodic)
+      for (int i = 0; i < n; i++) dz[i] -= zprd * floor(dz[i] / zprd + 0.5);
+
+  } else {
+    for (int i = 0; i < n; i++) minimum_image_once(dx[i], dy[i], dz[i]);
+  }
+}
+
 /* ----------------------------------------------------------------------
    return local index of atom J or any of its images that is closest to atom I
    if J is not a valid index like -1, just return it
@@ -131,6 +131,7 @@ class Domain : protected Pointers {
   void minimum_image(double *delta) const { minimum_image(delta[0], delta[1], delta[2]); }
   void minimum_image_big(double &, double &, double &) const;
   void minimum_image_big(double *delta) const { minimum_image_big(delta[0], delta[1], delta[2]); }
+  void minimum_image_batch(int, double *, double *, double *) const;
   int closest_image(int, int);
   int closest_image(const double *const, int);
   void closest_image(const double *const, const double *const, double *const);
@@ -191,6 +192,42 @@ class Domain : protected Pointers {
     return 0;
   }
 
+  // branchless minimum image convention in periodic dimensions
+  // single-shot floor-based wrap instead of the data-dependent while loops
+  //   of minimum_image(), so the compiler can vectorize loops calling it
+  // no too-far-apart check: intended for bonded topology distances,
+  //   which are bounded by the extent of a bond/angle/dihedral
+  // a displacement of exactly +/- half a box length may wrap to the
+  //   opposite sign than minimum_image() leaves it; distance is identical
+  // inline since called from per-bond/angle/dihedral inner loops
+
+  inline void minimum_image_once(double &dx, double &dy, double &dz) const
+  {
+    if (triclinic == 0) {
+      if (xperiodic) dx -= xprd * floor(dx / xprd + 0.5);
+      if (yperiodic) dy -= yprd * floor(dy / yprd + 0.5);
+      if (zperiodic) dz -= zprd * floor(dz / zprd + 0.5);
+    } else {
+      if (zperiodic) {
+        const double nz = floor(dz / zprd + 0.5);
+        dz -= zprd * nz;
+        dy -= yz * nz;
+        dx -= xz * nz;
+      }
+      if (yperiodic) {
+        const double ny = floor(dy / yprd + 0.5);
+        dy -= yprd * ny;
+        dx -= xy * ny;
+      }
+      if (xperiodic) dx -= xprd * floor(dx / xprd + 0.5);
+    }
+  }
+
+  void minimum_image_once(double *delta) const
+  {
+    minimum_image_once(delta[0], delta[1], delta[2]);
+  }
+
  protected:
   double small[3];    // fractions of box lengths
   std::unordered_set<Region *> regions;
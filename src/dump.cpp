@@ -84,6 +84,8 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) :
   unit_count = 0;
   delay_flag = 0;
   write_header_flag = 1;
+  frameindex_flag = 0;
+  idxfp = nullptr;
   has_id = 1;
 
   skipflag = 0;
@@ -95,6 +97,16 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) :
   maxbuf = maxids = maxsort = maxproc = 0;
   maxsbuf = 0;
 
+  async_flag = 0;
+  athread = nullptr;
+  nasync = maxasync = 0;
+  asynccount = nullptr;
+  async_stringflag = 0;
+  nabuf = maxabuf = 0;
+  abuf = nullptr;
+  nasbuf = maxasbuf = 0;
+  asbuf = nullptr;
+
   maxpbc = -1;
 
   // parse filename for special syntax
@@ -140,6 +152,13 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) :
 
 Dump::~Dump()
 {
+  // finish any in-flight asynchronous frame before tearing down buffers
+
+  write_wait();
+  memory->destroy(asynccount);
+  memory->destroy(abuf);
+  memory->destroy(asbuf);
+
   delete[] id;
   delete[] style;
   delete[] filename;
@@ -192,6 +211,11 @@ Dump::~Dump()
     }
     fp = nullptr;
   }
+
+  if (idxfp != nullptr) {
+    fclose(idxfp);
+    idxfp = nullptr;
+  }
 }
 
 // clang-format off
@@ -200,6 +224,11 @@ Dump::~Dump()
 
 void Dump::init()
 {
+  // let an asynchronous frame from a previous run finish before
+  // init_style() may reallocate the format strings it reads
+
+  write_wait();
+
   init_style();
 
   if (!sort_flag) {
@@ -369,7 +398,7 @@ void Dump::write()
   // do this after skip check, so no file is opened if skip occurs
 
   if (multifile) openfile();
-  if (fp) clearerr(fp);
+  if (!async_flag && fp) clearerr(fp);
 
   // ntotal = total # of dump lines in snapshot
   // nmax = max # of dump lines on any proc
@@ -445,6 +474,25 @@ void Dump::write()
     MPI_Allreduce(&bnme,&nheader,1,MPI_LMP_BIGINT,MPI_SUM,clustercomm);
   }
 
+  // in async mode, wait for the helper thread writing the previous frame
+  // before this frame's header is written and the staging buffers reused
+  // this is the backpressure point if the writer cannot keep up
+
+  if (async_flag && filewriter) {
+    write_wait();
+    nasync = 0;
+    nabuf = nasbuf = 0;
+  }
+
+  // record byte offset of this frame in the index sidecar before the
+  // header is written; in async mode write_wait() above guarantees the
+  // previous frame has been fully written to fp at this point
+
+  if (filewriter && idxfp) {
+    fmt::print(idxfp,"{} {}\n",update->ntimestep,platform::ftell(fp));
+    if (flush_flag) fflush(idxfp);
+  }
+
   if (filewriter && write_header_flag) write_header(nheader);
 
   // if buffering, convert doubles into strings
@@ -486,9 +534,10 @@ void Dump::write()
           nlines /= size_one;
         } else nlines = nme;
 
-        write_data(nlines,buf);
+        if (async_flag) stage_chunk(nlines,buf,0);
+        else write_data(nlines,buf);
       }
-      if (flush_flag && fp) fflush(fp);
+      if (!async_flag && flush_flag && fp) fflush(fp);
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
@@ -507,9 +556,10 @@ void Dump::write()
           MPI_Get_count(&status,MPI_CHAR,&nchars);
         } else nchars = nsme;
 
-        write_data(nchars,(double *) sbuf);
+        if (async_flag) stage_chunk(nchars,(double *) sbuf,1);
+        else write_data(nchars,(double *) sbuf);
       }
-      if (flush_flag && fp) fflush(fp);
+      if (!async_flag && flush_flag && fp) fflush(fp);
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
@@ -530,9 +580,16 @@ void Dump::write()
 
   if (refreshflag) irefresh->refresh();
 
-  if (filewriter && fp != nullptr) write_footer();
+  // in async mode, hand the staged frame to a helper thread which
+  // replays it through write_data(), writes the footer, and flushes
+  // write errors are detected at the next write_wait() call
 
-  if (fp && ferror(fp)) error->one(FLERR,"Error writing dump {}: {}", id, utils::getsyserror());
+  if (async_flag) {
+    if (filewriter) athread = new std::thread(&Dump::write_async_frame, this);
+  } else {
+    if (filewriter && fp != nullptr) write_footer();
+    if (fp && ferror(fp)) error->one(FLERR,"Error writing dump {}: {}", id, utils::getsyserror());
+  }
 
   // if file per timestep, close file if I am filewriter
 
@@ -595,6 +652,17 @@ void Dump::openfile()
     }
 
     if (fp == nullptr) error->one(FLERR,"Cannot open dump file");
+
+    // open frame index sidecar next to the dump file for read_dump seeks
+
+    if (frameindex_flag && !multifile && !compressed) {
+      std::string idxname = fmt::format("{}.idx",filecurrent);
+      if (append_flag && !binary) idxfp = fopen(idxname.c_str(),"a");
+      else idxfp = fopen(idxname.c_str(),"w");
+      if (idxfp == nullptr)
+        error->one(FLERR,"Cannot open dump frame index file {}: {}",
+                   idxname,utils::getsyserror());
+    }
   } else fp = nullptr;
 
   // delete string with timestep replaced
@@ -1040,6 +1108,74 @@ void Dump::balance()
   delete[] request;
 }
 
+/* ----------------------------------------------------------------------
+   wait for the helper thread writing the previous frame, if any
+   then check for write errors the thread could not report itself
+------------------------------------------------------------------------- */
+
+void Dump::write_wait()
+{
+  if (!athread) return;
+  athread->join();
+  delete athread;
+  athread = nullptr;
+  if (fp && ferror(fp)) error->one(FLERR,"Error writing dump {}: {}", id, utils::getsyserror());
+}
+
+/* ----------------------------------------------------------------------
+   copy one chunk of the current frame into the staging buffers
+   n = # of lines for native data, # of chars for string data
+------------------------------------------------------------------------- */
+
+void Dump::stage_chunk(int n, double *data, int stringflag)
+{
+  if (nasync == maxasync) {
+    maxasync += 16;
+    memory->grow(asynccount,maxasync,"dump:asynccount");
+  }
+  asynccount[nasync++] = n;
+  async_stringflag = stringflag;
+
+  if (stringflag) {
+    if (nasbuf + n > maxasbuf) {
+      maxasbuf = nasbuf + n;
+      memory->grow(asbuf,maxasbuf,"dump:asbuf");
+    }
+    memcpy(&asbuf[nasbuf],(char *) data,n);
+    nasbuf += n;
+  } else {
+    bigint ndouble = (bigint) n * size_one;
+    if (nabuf + ndouble > maxabuf) {
+      maxabuf = nabuf + ndouble;
+      memory->grow(abuf,maxabuf,"dump:abuf");
+    }
+    memcpy(&abuf[nabuf],data,ndouble*sizeof(double));
+    nabuf += ndouble;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   replay the staged chunks of one frame through write_data()
+   runs on the helper thread, overlapped with subsequent timesteps
+   no MPI calls and no Error calls are allowed here
+------------------------------------------------------------------------- */
+
+void Dump::write_async_frame()
+{
+  bigint offset = 0;
+  for (int i = 0; i < nasync; i++) {
+    if (async_stringflag) {
+      write_data(asynccount[i],(double *) &asbuf[offset]);
+      offset += asynccount[i];
+    } else {
+      write_data(asynccount[i],&abuf[offset]);
+      offset += (bigint) asynccount[i] * size_one;
+    }
+  }
+  if (fp != nullptr) write_footer();
+  if (flush_flag && fp) fflush(fp);
+}
+
 /* ----------------------------------------------------------------------
    process params common to all dumps here
    if unknown param, call modify_param specific to the dump
@@ -1049,6 +1185,10 @@ void Dump::modify_params(int narg, char **arg)
 {
   if (narg == 0) utils::missing_cmd_args(FLERR, "dump_modify", error);
 
+  // settings must not change while a helper thread still writes a frame
+
+  write_wait();
+
   int iarg = 0;
   while (iarg < narg) {
     if (strcmp(arg[iarg],"append") == 0) {
@@ -1056,6 +1196,13 @@ void Dump::modify_params(int narg, char **arg)
       append_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "dump_modify async", error);
+      async_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      if (async_flag && multifile)
+        error->all(FLERR,"Dump_modify async yes not allowed with one file per timestep");
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"balance") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "dump_modify balance", error);
       if (nprocs > 1)
@@ -1213,6 +1360,15 @@ void Dump::modify_params(int narg, char **arg)
       write_header_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"index") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "dump_modify index", error);
+      frameindex_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      if (frameindex_flag && multifile)
+        error->all(FLERR,"Dump_modify index requires writing one big dump file");
+      if (frameindex_flag && compressed)
+        error->all(FLERR,"Dump_modify index cannot be used with compressed dump files");
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"maxfiles") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "dump_modify maxfiles", error);
       if (!multifile)
@@ -1353,6 +1509,8 @@ double Dump::memory_usage()
 {
   double bytes = memory->usage(buf,maxbuf);
   bytes += memory->usage(sbuf,maxsbuf);
+  bytes += memory->usage(abuf,maxabuf);
+  bytes += memory->usage(asbuf,maxasbuf);
   if (sort_flag) {
     if (sortcol == 0) bytes += memory->usage(ids,maxids);
     bytes += memory->usage(bufsort,size_one*maxsort);
@@ -1367,3 +1525,58 @@ double Dump::memory_usage()
   }
   return bytes;
 }
+
+/* ----------------------------------------------------------------------
+   free all high-water buffers that write() regrows on demand
+   invoked by the reset_memory command to trim allocations
+     back to current need on long runs
+   return # of bytes reclaimed
+------------------------------------------------------------------------- */
+
+double Dump::trim_memory()
+{
+  double bytes = memory_usage();
+
+  // let an in-flight asynchronous frame finish before freeing its staging
+
+  write_wait();
+
+  memory->destroy(asynccount);
+  memory->destroy(abuf);
+  memory->destroy(asbuf);
+  asynccount = nullptr;
+  abuf = nullptr;
+  asbuf = nullptr;
+  nasync = maxasync = 0;
+  nabuf = maxabuf = 0;
+  nasbuf = maxasbuf = 0;
+
+  memory->destroy(buf);
+  memory->destroy(sbuf);
+  buf = nullptr;
+  sbuf = nullptr;
+  maxbuf = maxsbuf = 0;
+
+  memory->destroy(ids);
+  memory->destroy(bufsort);
+  memory->destroy(idsort);
+  memory->destroy(index);
+  memory->destroy(proclist);
+  delete irregular;
+  ids = idsort = nullptr;
+  bufsort = nullptr;
+  index = proclist = nullptr;
+  irregular = nullptr;
+  maxids = maxsort = maxproc = 0;
+
+  if (pbcflag && maxpbc > 0) {
+    memory->destroy(xpbc);
+    memory->destroy(vpbc);
+    memory->destroy(imagepbc);
+    xpbc = vpbc = nullptr;
+    imagepbc = nullptr;
+    maxpbc = 0;
+  }
+
+  return bytes - memory_usage();
+}
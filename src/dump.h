@@ -17,6 +17,7 @@
 #include "pointers.h"    // IWYU pragma: export
 
 #include <map>
+#include <thread>
 
 namespace LAMMPS_NS {
 class Compute;
@@ -53,6 +54,7 @@ class Dump : protected Pointers {
 
   void modify_params(int, char **);
   virtual double memory_usage();
+  double trim_memory();
 
  protected:
   int me, nprocs;    // proc info
@@ -85,6 +87,7 @@ class Dump : protected Pointers {
   int unit_count;           // # of times the unit information was written
   int delay_flag;           // 1 if delay output until delaystep
   int write_header_flag;    // 1 if write header, 0 if not
+  int frameindex_flag;      // 1 if write frame index sidecar for read_dump
   int has_id;               // 1 if output contains Atom-IDs
 
   bigint delaystep;
@@ -112,6 +115,7 @@ class Dump : protected Pointers {
   std::vector<std::string> keyword_user;
 
   FILE *fp;        // file to write dump to
+  FILE *idxfp;     // frame index sidecar file, null if not written
   int size_one;    // # of quantities for one atom
   int nme;         // # of atoms in this dump from me
   int nsme;        // # of chars in string output from me
@@ -137,6 +141,17 @@ class Dump : protected Pointers {
   int maxsbuf;    // size of sbuf
   char *sbuf;     // memory for atom quantities in string format
 
+  int async_flag;           // 1 if filewriter writes frames on a helper thread
+  std::thread *athread;     // thread writing the staged frame, null if idle
+  int nasync;               // # of staged chunks in current frame
+  int maxasync;             // allocated length of asynccount
+  int *asynccount;          // per-chunk line or char counts
+  int async_stringflag;     // 1 if staged frame holds string data
+  bigint nabuf, maxabuf;    // used/allocated doubles in abuf
+  double *abuf;             // staged chunk data, native format
+  bigint nasbuf, maxasbuf;  // used/allocated chars in asbuf
+  char *asbuf;              // staged chunk data, string format
+
   int maxids;     // size of ids
   int maxsort;    // size of bufsort, idsort, index
   int maxproc;    // size of proclist
@@ -164,6 +179,10 @@ class Dump : protected Pointers {
   void pbc_allocate();
   double compute_time();
 
+  void write_wait();
+  void stage_chunk(int, double *, int);
+  void write_async_frame();
+
   void sort();
 #if defined(LMP_QSORT)
   static int idcompare(const void *, const void *);
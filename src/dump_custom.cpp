@@ -26,10 +26,12 @@
 #include "label_map.h"
 #include "memory.h"
 #include "modify.h"
+#include "neighbor.h"
 #include "region.h"
 #include "update.h"
 #include "variable.h"
 
+#include <cmath>
 #include <cstring>
 
 using namespace LAMMPS_NS;
@@ -46,7 +48,7 @@ enum{ID,MOL,PROC,PROCP1,TYPE,TYPELABEL,ELEMENT,MASS,
      OMEGAX,OMEGAY,OMEGAZ,ANGMOMX,ANGMOMY,ANGMOMZ,
      TQX,TQY,TQZ,
      COMPUTE,FIX,VARIABLE,IVEC,DVEC,IARRAY,DARRAY};
-enum{LT,LE,GT,GE,EQ,NEQ,XOR};
+enum{LT,LE,GT,GE,EQ,NEQ,XOR,SPARSE};
 
 static constexpr int ONEFIELD = 32;
 static constexpr int DELTA = 1048576;
@@ -56,8 +58,10 @@ static constexpr int DELTA = 1048576;
 DumpCustom::DumpCustom(LAMMPS *lmp, int narg, char **arg) :
     Dump(lmp, narg, arg), idregion(nullptr), thresh_array(nullptr), thresh_op(nullptr),
     thresh_value(nullptr), thresh_last(nullptr), thresh_fix(nullptr), thresh_fixID(nullptr),
-    thresh_first(nullptr), earg(nullptr), vtype(nullptr), vformat(nullptr), columns(nullptr),
+    thresh_first(nullptr), schoose(nullptr), sparse_current(nullptr),
+    earg(nullptr), vtype(nullptr), vformat(nullptr), columns(nullptr),
     columns_default(nullptr), choose(nullptr), dchoose(nullptr), clist(nullptr),
+    selbase(nullptr),
     field2index(nullptr), argindex(nullptr), id_compute(nullptr), compute(nullptr), id_fix(nullptr),
     fix(nullptr), id_variable(nullptr), variable(nullptr), vbuf(nullptr), id_custom(nullptr),
     custom(nullptr), custom_flag(nullptr), typenames(nullptr), header_choice(nullptr),
@@ -92,6 +96,13 @@ DumpCustom::DumpCustom(LAMMPS *lmp, int narg, char **arg) :
   triclinic_general = 0;
   nthresh = 0;
   nthreshlast = 0;
+  nsparse = 0;
+  sparse_keyframe = 0;
+  maxsparse = 0;
+
+  selcache_flag = 0;
+  lastselbuild = -1;
+  nselbase = 0;
 
   // computes, fixes, variables which the dump accesses
 
@@ -196,6 +207,8 @@ DumpCustom::~DumpCustom()
   memory->sfree(thresh_fix);
   memory->sfree(thresh_fixID);
   memory->destroy(thresh_first);
+  memory->destroy(schoose);
+  memory->destroy(sparse_current);
 
   for (int i = 0; i < ncompute; i++) delete[] id_compute[i];
   memory->sfree(id_compute);
@@ -218,6 +231,7 @@ DumpCustom::~DumpCustom()
   memory->destroy(choose);
   memory->destroy(dchoose);
   memory->destroy(clist);
+  memory->destroy(selbase);
 
   for (int i = 1; i <= ntypes; i++) delete[] typenames[i];
   delete[] typenames;
@@ -661,6 +675,9 @@ void DumpCustom::header_item(bigint ndump)
              "{:>1.16e} {:>1.16e}\n",
              boundstr,boxxlo,boxxhi,boxylo,boxyhi,boxzlo,boxzhi);
 
+  if (nsparse)
+    fmt::print(fp,"ITEM: SPARSE FRAME\n{}\n",sparse_keyframe ? "keyframe" : "delta");
+
   fmt::print(fp,"ITEM: ATOMS {}\n",columns);
 }
 
@@ -684,6 +701,9 @@ void DumpCustom::header_item_triclinic(bigint ndump)
              "{:>1.16e} {:>1.16e} {:>1.16e}\n",
              boundstr,boxxlo,boxxhi,boxxy,boxylo,boxyhi,boxxz,boxzlo,boxzhi,boxyz);
 
+  if (nsparse)
+    fmt::print(fp,"ITEM: SPARSE FRAME\n{}\n",sparse_keyframe ? "keyframe" : "delta");
+
   fmt::print(fp,"ITEM: ATOMS {}\n",columns);
 }
 
@@ -708,6 +728,9 @@ void DumpCustom::header_item_triclinic_general(bigint ndump)
              domain->bvec[0],domain->bvec[1],domain->bvec[2],domain->boxlo[1],
              domain->cvec[0],domain->cvec[1],domain->cvec[2],domain->boxlo[2]);
 
+  if (nsparse)
+    fmt::print(fp,"ITEM: SPARSE FRAME\n{}\n",sparse_keyframe ? "keyframe" : "delta");
+
   fmt::print(fp,"ITEM: ATOMS {}\n",columns);
 }
 
@@ -726,9 +749,19 @@ int DumpCustom::count()
     memory->destroy(choose);
     memory->destroy(dchoose);
     memory->destroy(clist);
+    memory->destroy(selbase);
     memory->create(choose,maxlocal,"dump:choose");
     memory->create(dchoose,maxlocal,"dump:dchoose");
     memory->create(clist,maxlocal,"dump:clist");
+    memory->create(selbase,maxlocal,"dump:selbase");
+    lastselbuild = -1;
+
+    memory->destroy(schoose);
+    memory->create(schoose,maxlocal,"dump:schoose");
+    if (maxsparse) {
+      memory->destroy(sparse_current);
+      memory->create(sparse_current,maxsparse,maxlocal,"dump:sparse_current");
+    }
 
     for (i = 0; i < nvariable; i++) {
       memory->destroy(vbuf[i]);
@@ -757,30 +790,48 @@ int DumpCustom::count()
     for (i = 0; i < nvariable; i++)
       input->variable->compute_atom(variable[i],igroup,vbuf[i],1,0);
 
-  // choose all local atoms for output
+  // choose all local atoms for output, then un-choose by group and region
+  // if dump_modify selection reneighbor is set, reuse the flags built on the
+  //   first snapshot after the last reneighboring, since local indices are
+  //   stable in between and atoms have moved at most a skin distance
 
-  for (i = 0; i < nlocal; i++) choose[i] = 1;
+  int *select = choose;
+  int rebuild = 1;
+  if (selcache_flag) {
+    select = selbase;
+    if (lastselbuild >= neighbor->lastcall && nselbase == nlocal) rebuild = 0;
+    else {
+      lastselbuild = update->ntimestep;
+      nselbase = nlocal;
+    }
+  }
 
-  // un-choose if not in group
+  if (rebuild) {
+    for (i = 0; i < nlocal; i++) select[i] = 1;
 
-  if (igroup) {
-    int *mask = atom->mask;
-    for (i = 0; i < nlocal; i++)
-      if (!(mask[i] & groupbit))
-        choose[i] = 0;
-  }
+    // un-choose if not in group
+
+    if (igroup) {
+      int *mask = atom->mask;
+      for (i = 0; i < nlocal; i++)
+        if (!(mask[i] & groupbit))
+          select[i] = 0;
+    }
 
-  // un-choose if not in region
+    // un-choose if not in region
 
-  if (idregion) {
-    auto region = domain->get_region_by_id(idregion);
-    region->prematch();
-    double **x = atom->x;
-    for (i = 0; i < nlocal; i++)
-      if (choose[i] && region->match(x[i][0],x[i][1],x[i][2]) == 0)
-        choose[i] = 0;
+    if (idregion) {
+      auto region = domain->get_region_by_id(idregion);
+      region->prematch();
+      double **x = atom->x;
+      for (i = 0; i < nlocal; i++)
+        if (select[i] && region->match(x[i][0],x[i][1],x[i][2]) == 0)
+          select[i] = 0;
+    }
   }
 
+  if (selcache_flag) memcpy(choose,selbase,nlocal*sizeof(int));
+
   // un-choose if any threshold criterion isn't met
 
   if (nthresh) {
@@ -789,6 +840,19 @@ int DumpCustom::count()
     double value;
     int nstride,lastflag;
 
+    // allocate per-condition scratch space for sparse conditions
+
+    if (nsparse > maxsparse) {
+      maxsparse = nsparse;
+      memory->destroy(sparse_current);
+      memory->create(sparse_current,maxsparse,maxlocal,"dump:sparse_current");
+    }
+    if (nsparse) {
+      for (i = 0; i < nlocal; i++) schoose[i] = 0;
+      sparse_keyframe = 0;
+    }
+    int isparse = 0;
+
     for (int ithresh = 0; ithresh < nthresh; ithresh++) {
 
       // customize by adding to if statement
@@ -1225,6 +1289,29 @@ int DumpCustom::count()
         nstride = atom->dcols[iwhich];
       }
 
+      // sparse condition: flag atoms whose value changed by more than
+      // delta since the atom was last written; the flags from all
+      // sparse conditions are OR-ed and applied after this loop
+      // the first comparison selects all atoms as a complete keyframe
+
+      if (thresh_op[ithresh] == SPARSE) {
+        int ilast = thresh_last[ithresh];
+        values = thresh_fix[ilast]->vstore;
+        double *current = sparse_current[isparse];
+        for (i = 0; i < nlocal; i++, ptr += nstride) current[i] = *ptr;
+        if (thresh_first[ilast]) {
+          thresh_first[ilast] = 0;
+          sparse_keyframe = 1;
+          for (i = 0; i < nlocal; i++) schoose[i] = 1;
+        } else {
+          double delta = thresh_value[ithresh];
+          for (i = 0; i < nlocal; i++)
+            if (fabs(current[i] - values[i]) > delta) schoose[i] = 1;
+        }
+        isparse++;
+        continue;
+      }
+
       // unselect atoms that don't meet threshold criterion
       // compare to single value or values stored in threshfix
       // copy ptr attribute into thresh_fix if this is first comparison
@@ -1313,6 +1400,24 @@ int DumpCustom::count()
         for (i = 0; i < nlocal; i++, ptr += nstride) values[i] = *ptr;
       }
     }
+
+    // sparse output: keep only atoms flagged by a sparse condition and
+    // refresh the stored values of just the atoms that will be written,
+    // so that sub-delta drift accumulates until the atom is emitted
+
+    if (nsparse) {
+      for (i = 0; i < nlocal; i++)
+        if (!schoose[i]) choose[i] = 0;
+
+      isparse = 0;
+      for (int ithresh = 0; ithresh < nthresh; ithresh++) {
+        if (thresh_op[ithresh] != SPARSE) continue;
+        values = thresh_fix[thresh_last[ithresh]]->vstore;
+        double *current = sparse_current[isparse++];
+        for (i = 0; i < nlocal; i++)
+          if (choose[i]) values[i] = current[i];
+      }
+    }
   }
 
   // compress choose flags into clist
@@ -1872,6 +1977,16 @@ int DumpCustom::modify_param(int narg, char **arg)
         error->all(FLERR,"Dump_modify region {} does not exist", arg[1]);
       idregion = utils::strdup(arg[1]);
     }
+    lastselbuild = -1;
+    return 2;
+  }
+
+  if (strcmp(arg[0],"selection") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    if (strcmp(arg[1],"step") == 0) selcache_flag = 0;
+    else if (strcmp(arg[1],"reneighbor") == 0) selcache_flag = 1;
+    else error->all(FLERR,"Unknown dump_modify selection mode: {}", arg[1]);
+    lastselbuild = -1;
     return 2;
   }
 
@@ -1954,8 +2069,12 @@ int DumpCustom::modify_param(int narg, char **arg)
     return 2;
   }
 
-  if (strcmp(arg[0],"thresh") == 0) {
-    if (narg < 2) utils::missing_cmd_args(FLERR, "dump_modify thresh", error);
+  int sparseflag = 0;
+  if (strcmp(arg[0],"sparse") == 0) sparseflag = 1;
+
+  if (sparseflag || (strcmp(arg[0],"thresh") == 0)) {
+    if (narg < 2)
+      utils::missing_cmd_args(FLERR, sparseflag ? "dump_modify sparse" : "dump_modify thresh", error);
     if (strcmp(arg[1],"none") == 0) {
       if (nthresh) {
         memory->destroy(thresh_array);
@@ -1973,11 +2092,13 @@ int DumpCustom::modify_param(int narg, char **arg)
         thresh_fixID = nullptr;
         thresh_first = nullptr;
       }
-      nthresh = nthreshlast = 0;
+      nthresh = nthreshlast = nsparse = 0;
       return 2;
     }
 
-    if (narg < 4) utils::missing_cmd_args(FLERR, "dump_modify thresh", error);
+    if (sparseflag) {
+      if (narg < 3) utils::missing_cmd_args(FLERR, "dump_modify sparse", error);
+    } else if (narg < 4) utils::missing_cmd_args(FLERR, "dump_modify thresh", error);
 
     // grow threshold arrays
 
@@ -2194,8 +2315,10 @@ int DumpCustom::modify_param(int narg, char **arg)
     }
 
     // set operation type of threshold
+    // sparse condition is its own operation with a per-field delta
 
-    if (strcmp(arg[2],"<") == 0) thresh_op[nthresh] = LT;
+    if (sparseflag) thresh_op[nthresh] = SPARSE;
+    else if (strcmp(arg[2],"<") == 0) thresh_op[nthresh] = LT;
     else if (strcmp(arg[2],"<=") == 0) thresh_op[nthresh] = LE;
     else if (strcmp(arg[2],">") == 0) thresh_op[nthresh] = GT;
     else if (strcmp(arg[2],">=") == 0) thresh_op[nthresh] = GE;
@@ -2205,13 +2328,21 @@ int DumpCustom::modify_param(int narg, char **arg)
     else error->all(FLERR,"Invalid dump_modify thresh operator");
 
     // set threshold value as number or special LAST keyword
+    // a sparse condition stores a delta and always retains last-written values
     // create FixStore to hold LAST values, should work with restart
     // id = dump-ID + nthreshlast + DUMP_STORE, fix group = dump group
 
-    if (strcmp(arg[3],"LAST") != 0) {
+    int storeflag = sparseflag;
+    if (sparseflag) {
+      thresh_value[nthresh] = utils::numeric(FLERR,arg[2],false,lmp);
+      if (thresh_value[nthresh] < 0.0)
+        error->all(FLERR,"Invalid dump_modify sparse delta: {}", arg[2]);
+    } else if (strcmp(arg[3],"LAST") != 0) {
       thresh_value[nthresh] = utils::numeric(FLERR,arg[3],false,lmp);
       thresh_last[nthresh] = -1;
-    } else {
+    } else storeflag = 1;
+
+    if (storeflag) {
       thresh_fix = (FixStoreAtom **)
         memory->srealloc(thresh_fix,(nthreshlast+1)*sizeof(FixStoreAtom *),"dump:thresh_fix");
       thresh_fixID = (char **)
@@ -2223,13 +2354,14 @@ int DumpCustom::modify_param(int narg, char **arg)
       threshid += fmt::format(" {} STORE/ATOM 1 0 0 1", group->names[igroup]);
       thresh_fix[nthreshlast] = dynamic_cast<FixStoreAtom *>(modify->add_fix(threshid));
 
-      thresh_last[nthreshlast] = nthreshlast;
+      thresh_last[nthresh] = nthreshlast;
       thresh_first[nthreshlast] = 1;
       nthreshlast++;
     }
 
+    if (sparseflag) nsparse++;
     nthresh++;
-    return 4;
+    return sparseflag ? 3 : 4;
   }
 
   return 0;
@@ -52,6 +52,12 @@ class DumpCustom : public Dump {
   char **thresh_fixID;                // IDs of thresh_fixes
   int *thresh_first;                  // 1 the first time a FixStore values accessed
 
+  int nsparse;                // # of thresholds that are sparse conditions
+  int sparse_keyframe;        // 1 if current sparse snapshot is complete
+  int maxsparse;              // allocated rows of sparse_current
+  int *schoose;               // 1 if atom flagged by any sparse condition
+  double **sparse_current;    // current values of each sparse attribute
+
   int expand;        // flag for whether field args were expanded
   char **earg;       // field names with wildcard expansion
   int nargnew;       // size of earg
@@ -68,6 +74,12 @@ class DumpCustom : public Dump {
   double *dchoose;    // value for each atom to threshold against
   int *clist;         // compressed list of indices of selected atoms
 
+  int selcache_flag;      // 1 if group/region selection is only
+                          //   recomputed after reneighboring
+  int *selbase;           // cached group/region selection flags
+  bigint lastselbuild;    // timestep cached selection was last rebuilt
+  int nselbase;           // nlocal when cached selection was last rebuilt
+
   int nfield;                 // # of keywords listed by user
   int ioptional;              // index of start of optional args
                               //
@@ -0,0 +1,284 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "dump_delta.h"
+
+#include "atom.h"
+#include "domain.h"
+#include "error.h"
+#include "fix_store_atom.h"
+#include "group.h"
+#include "memory.h"
+#include "modify.h"
+#include "update.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using namespace LAMMPS_NS;
+
+// deltas beyond this magnitude escape to an absolute record
+
+static constexpr int32_t DELTA_MAX = 32767;
+
+/* ----------------------------------------------------------------------
+   binary file layout, all fields in native endianness:
+
+   per snapshot:
+     bigint   -strlen(MAGIC_STRING), then MAGIC_STRING, int ENDIAN,
+              int FORMAT_REVISION
+     bigint   timestep
+     bigint   # of atoms in snapshot
+     int      triclinic flag (0/1)
+     6 int    boundary flags
+     6 double box bounds (+ 3 double tilt factors if triclinic)
+     double   precision = quantization factor, coords are stored
+              as round(x*precision)
+     char     1 if keyframe (all records absolute), 0 if delta
+     int      # of chunks
+   per chunk:
+     int      # of atom records
+     int      # of payload bytes
+     per atom record:
+       tagint  atom ID
+       int16   atom type
+       uint8   1 = absolute, 0 = delta
+       3 int32 quantized coords (absolute record), or
+       3 int16 quantized displacement since the atom's previous
+               record (delta record)
+------------------------------------------------------------------------- */
+
+DumpDelta::DumpDelta(LAMMPS *lmp, int narg, char **arg) : Dump(lmp, narg, arg),
+  id_fix(nullptr), fixprev(nullptr), cbuf(nullptr)
+{
+  if (narg != 5) error->all(FLERR,"Illegal dump delta command");
+  if (!binary)
+    error->all(FLERR,"Dump delta requires a binary filename, e.g. *.bin");
+  if (multiproc)
+    error->all(FLERR,"Dump delta cannot use '%' in the dump filename");
+
+  size_one = 6;
+  buffer_allow = 0;
+  format_default = nullptr;
+
+  prec = 1000.0;
+  nkeyframe = 0;
+  iframe = 0;
+  curkey = 1;
+  maxcbuf = 0;
+
+  // per-atom store for the quantized coords of each atom's previous
+  // record plus a validity flag, migrates with the atoms
+
+  id_fix = utils::strdup(std::string(id) + "_DUMP_DELTA_STORE");
+  fixprev = dynamic_cast<FixStoreAtom *>(modify->add_fix(
+      fmt::format("{} {} STORE/ATOM 4 0 0 0", id_fix, group->names[igroup])));
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpDelta::~DumpDelta()
+{
+  // check nfix in case all fixes have already been deleted
+
+  if (modify->nfix) modify->delete_fix(id_fix);
+  delete[] id_fix;
+  memory->destroy(cbuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpDelta::init_style()
+{
+  if (atom->tag_enable == 0) error->all(FLERR,"Dump delta requires atom IDs");
+  if (atom->ntypes > 32767)
+    error->all(FLERR,"Too many atom types for dump delta");
+
+  // setup boundary string
+
+  domain->boundary_string(boundstr);
+
+  // open single file, one time only
+
+  if (multifile == 0) openfile();
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpDelta::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0],"precision") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    prec = utils::numeric(FLERR,arg[1],false,lmp);
+    if (prec <= 0.0) error->all(FLERR,"Illegal dump_modify command");
+
+    // stored coords are in units of the old precision, force a keyframe
+
+    iframe = 0;
+    return 2;
+  }
+
+  if (strcmp(arg[0],"keyframe") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    nkeyframe = utils::inumeric(FLERR,arg[1],false,lmp);
+    if (nkeyframe < 0) error->all(FLERR,"Illegal dump_modify command");
+    return 2;
+  }
+
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpDelta::write_header(bigint ndump)
+{
+  if (me) return;
+
+  // use negative ntimestep as marker for new format
+
+  bigint fmtlen = strlen(MAGIC_STRING);
+  bigint marker = -fmtlen;
+  fwrite(&marker, sizeof(bigint), 1, fp);
+  fwrite(MAGIC_STRING, sizeof(char), fmtlen, fp);
+  int endian = ENDIAN;
+  fwrite(&endian, sizeof(int), 1, fp);
+  int revision = FORMAT_REVISION;
+  fwrite(&revision, sizeof(int), 1, fp);
+
+  fwrite(&update->ntimestep, sizeof(bigint), 1, fp);
+  fwrite(&ndump, sizeof(bigint), 1, fp);
+  fwrite(&domain->triclinic, sizeof(int), 1, fp);
+  fwrite(&domain->boundary[0][0], 6*sizeof(int), 1, fp);
+  fwrite(&boxxlo, sizeof(double), 1, fp);
+  fwrite(&boxxhi, sizeof(double), 1, fp);
+  fwrite(&boxylo, sizeof(double), 1, fp);
+  fwrite(&boxyhi, sizeof(double), 1, fp);
+  fwrite(&boxzlo, sizeof(double), 1, fp);
+  fwrite(&boxzhi, sizeof(double), 1, fp);
+  if (domain->triclinic) {
+    fwrite(&boxxy, sizeof(double), 1, fp);
+    fwrite(&boxxz, sizeof(double), 1, fp);
+    fwrite(&boxyz, sizeof(double), 1, fp);
+  }
+  fwrite(&prec, sizeof(double), 1, fp);
+  char key = curkey;
+  fwrite(&key, sizeof(char), 1, fp);
+  fwrite(&nclusterprocs, sizeof(int), 1, fp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpDelta::pack(tagint *ids)
+{
+  int k;
+
+  tagint *tag = atom->tag;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+  double **store = fixprev->astore;
+
+  // keyframes force absolute records for all atoms
+  // every snapshot of a multifile dump is a keyframe
+  //   so that each file is self-contained
+
+  if (iframe == 0 || multifile) curkey = 1;
+  else if (nkeyframe > 0 && (iframe % nkeyframe == 0)) curkey = 1;
+  else curkey = 0;
+  iframe++;
+
+  int m = 0;
+  int n = 0;
+  for (int i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+
+    int32_t qi[3];
+    for (k = 0; k < 3; k++) {
+      double q = std::round(x[i][k]*prec);
+      if (q < (double) INT32_MIN || q > (double) INT32_MAX)
+        error->one(FLERR,"Dump delta quantized coordinate overflow, "
+                   "reduce dump_modify precision");
+      qi[k] = (int32_t) q;
+    }
+
+    // emit delta only if this atom has a previous record
+    //   and all 3 displacements fit in 16 bits
+
+    int absflag = 1;
+    int32_t dq[3] = {0,0,0};
+    if (!curkey && store[i][3] != 0.0) {
+      absflag = 0;
+      for (k = 0; k < 3; k++) {
+        dq[k] = qi[k] - (int32_t) store[i][k];
+        if (dq[k] < -DELTA_MAX || dq[k] > DELTA_MAX) absflag = 1;
+      }
+    }
+
+    buf[m++] = tag[i];
+    buf[m++] = type[i];
+    buf[m++] = absflag;
+    if (absflag) for (k = 0; k < 3; k++) buf[m++] = qi[k];
+    else for (k = 0; k < 3; k++) buf[m++] = dq[k];
+
+    for (k = 0; k < 3; k++) store[i][k] = qi[k];
+    store[i][3] = 1.0;
+
+    if (ids) ids[n++] = tag[i];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpDelta::write_data(int n, double *mybuf)
+{
+  // encode chunk of size_one-wide lines into variable-length records
+
+  bigint needed = (bigint) n *
+    (sizeof(tagint) + sizeof(int16_t) + 1 + 3*sizeof(int32_t));
+  if (needed > MAXSMALLINT)
+    error->one(FLERR,"Too much dump delta data for one chunk");
+  if (needed > maxcbuf) {
+    maxcbuf = needed;
+    memory->grow(cbuf,maxcbuf,"dump:cbuf");
+  }
+
+  int m = 0;
+  char *ptr = cbuf;
+  for (int i = 0; i < n; i++) {
+    tagint idatom = (tagint) mybuf[m++];
+    int16_t itype = (int16_t) mybuf[m++];
+    char absflag = (char) mybuf[m++];
+    memcpy(ptr,&idatom,sizeof(tagint)); ptr += sizeof(tagint);
+    memcpy(ptr,&itype,sizeof(int16_t)); ptr += sizeof(int16_t);
+    *ptr++ = absflag;
+    if (absflag) {
+      for (int k = 0; k < 3; k++) {
+        int32_t v = (int32_t) mybuf[m++];
+        memcpy(ptr,&v,sizeof(int32_t)); ptr += sizeof(int32_t);
+      }
+    } else {
+      for (int k = 0; k < 3; k++) {
+        int16_t v = (int16_t) mybuf[m++];
+        memcpy(ptr,&v,sizeof(int16_t)); ptr += sizeof(int16_t);
+      }
+    }
+  }
+
+  int nbytes = (int) (ptr - cbuf);
+  fwrite(&n,sizeof(int),1,fp);
+  fwrite(&nbytes,sizeof(int),1,fp);
+  fwrite(cbuf,1,nbytes,fp);
+}
@@ -0,0 +1,58 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+// clang-format off
+DumpStyle(delta,DumpDelta);
+// clang-format on
+#else
+
+#ifndef LMP_DUMP_DELTA_H
+#define LMP_DUMP_DELTA_H
+
+#include "dump.h"
+
+namespace LAMMPS_NS {
+
+class DumpDelta : public Dump {
+ public:
+  DumpDelta(LAMMPS *, int, char **);
+  ~DumpDelta() override;
+
+  const char *MAGIC_STRING = "DUMPDELTA";
+  const int FORMAT_REVISION = 0x0001;
+  const int ENDIAN = 0x0001;
+
+ protected:
+  double prec;         // quantization factor, coord grid spacing = 1/prec
+  int nkeyframe;       // write a keyframe every this many snapshots, 0 = first only
+  bigint iframe;       // # of snapshots written so far
+  int curkey;          // 1 if current snapshot is a keyframe
+
+  char *id_fix;                  // ID of internal fix holding previous coords
+  class FixStoreAtom *fixprev;   // quantized coords of previous snapshot + valid flag
+
+  char *cbuf;       // encoded per-atom records of one chunk
+  bigint maxcbuf;
+
+  void init_style() override;
+  int modify_param(int, char **) override;
+  void write_header(bigint) override;
+  void pack(tagint *) override;
+  void write_data(int, double *) override;
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
@@ -0,0 +1,475 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "dump_reduce.h"
+
+#include "arg_info.h"
+#include "atom.h"
+#include "compute.h"
+#include "domain.h"
+#include "error.h"
+#include "fix.h"
+#include "input.h"
+#include "memory.h"
+#include "modify.h"
+#include "update.h"
+#include "variable.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace LAMMPS_NS;
+
+enum{HISTO,MOMENTS};
+
+static constexpr double BIG = 1.0e20;
+
+/* ---------------------------------------------------------------------- */
+
+DumpReduce::DumpReduce(LAMMPS *lmp, int narg, char **arg) :
+  Dump(lmp, narg, arg),
+  bin(nullptr), bin_all(nullptr), coord(nullptr),
+  mom(nullptr), mom_all(nullptr), momin(nullptr), momin_all(nullptr),
+  momax(nullptr), momax_all(nullptr), vector(nullptr), maxatom(0),
+  columns(nullptr)
+{
+  if (narg < 7) utils::missing_cmd_args(FLERR,"dump reduce",error);
+
+  clearstep = 1;
+  buffer_allow = 0;
+  buffer_flag = 0;
+  sort_flag = 0;
+
+  nevery = utils::inumeric(FLERR,arg[3],false,lmp);
+  if (nevery <= 0) error->all(FLERR,"Illegal dump reduce nevery value: {}", nevery);
+
+  if (binary) error->all(FLERR,"Binary files are not supported with dump reduce");
+  if (multiproc) error->all(FLERR,"Dump reduce cannot use '%' in filename");
+
+  // parse reduction mode and its arguments
+
+  int iarg = 5;
+  lo = hi = binsize = bininv = 0.0;
+  nbins = 0;
+
+  if (strcmp(arg[iarg],"histo") == 0) {
+    mode = HISTO;
+    if (iarg+4 > narg) utils::missing_cmd_args(FLERR,"dump reduce histo",error);
+    lo = utils::numeric(FLERR,arg[iarg+1],false,lmp);
+    hi = utils::numeric(FLERR,arg[iarg+2],false,lmp);
+    nbins = utils::inumeric(FLERR,arg[iarg+3],false,lmp);
+    if (lo >= hi) error->all(FLERR,"Invalid dump reduce histo lo/hi values");
+    if (nbins <= 0) error->all(FLERR,"Invalid dump reduce histo Nbin value: {}", nbins);
+    iarg += 4;
+  } else if (strcmp(arg[iarg],"moments") == 0) {
+    mode = MOMENTS;
+    iarg++;
+  } else error->all(FLERR,"Unknown dump reduce mode: {}", arg[iarg]);
+
+  if (iarg == narg) error->all(FLERR,"No dump reduce values specified");
+
+  nvalues = narg - iarg;
+
+  // expand args if any have wildcard character "*"
+
+  int expand = 0;
+  char **earg;
+  nvalues = utils::expand_args(FLERR,nvalues,&arg[iarg],1,earg,lmp);
+
+  if (earg != &arg[iarg]) expand = 1;
+
+  // parse per-atom values, same inputs as fix ave/histo in peratom mode
+
+  values.clear();
+
+  for (int i = 0; i < nvalues; i++) {
+    value_t val;
+    val.id = "";
+    val.val.c = nullptr;
+
+    if (strcmp(earg[i],"x") == 0) {
+      val.which = ArgInfo::X;
+      val.argindex = 0;
+    } else if (strcmp(earg[i],"y") == 0) {
+      val.which = ArgInfo::X;
+      val.argindex = 1;
+    } else if (strcmp(earg[i],"z") == 0) {
+      val.which = ArgInfo::X;
+      val.argindex = 2;
+
+    } else if (strcmp(earg[i],"vx") == 0) {
+      val.which = ArgInfo::V;
+      val.argindex = 0;
+    } else if (strcmp(earg[i],"vy") == 0) {
+      val.which = ArgInfo::V;
+      val.argindex = 1;
+    } else if (strcmp(earg[i],"vz") == 0) {
+      val.which = ArgInfo::V;
+      val.argindex = 2;
+
+    } else if (strcmp(earg[i],"fx") == 0) {
+      val.which = ArgInfo::F;
+      val.argindex = 0;
+    } else if (strcmp(earg[i],"fy") == 0) {
+      val.which = ArgInfo::F;
+      val.argindex = 1;
+    } else if (strcmp(earg[i],"fz") == 0) {
+      val.which = ArgInfo::F;
+      val.argindex = 2;
+
+    } else {
+      ArgInfo argi(earg[i]);
+
+      if ((argi.get_type() == ArgInfo::NONE) || (argi.get_type() == ArgInfo::UNKNOWN) ||
+          (argi.get_dim() > 1))
+        error->all(FLERR,"Invalid attribute {} in dump reduce command", earg[i]);
+
+      val.which = argi.get_type();
+      val.argindex = argi.get_index1();
+      val.id = argi.get_name();
+    }
+    values.push_back(val);
+  }
+
+  // if wildcard expansion occurred, free earg memory from expand_args()
+
+  if (expand) {
+    for (int i = 0; i < nvalues; i++) delete[] earg[i];
+    memory->sfree(earg);
+  }
+
+  // rows and columns of the per-snapshot output
+
+  if (mode == HISTO) {
+    size_one = 4;
+    columns = utils::strdup("bin coord count fraction");
+
+    memory->create(bin,nbins,"dump:bin");
+    memory->create(bin_all,nbins,"dump:bin_all");
+    memory->create(coord,nbins,"dump:coord");
+
+    binsize = (hi-lo)/nbins;
+    bininv = 1.0/binsize;
+    for (int i = 0; i < nbins; i++) coord[i] = lo + (i+0.5)*binsize;
+
+  } else {
+    size_one = 6;
+    columns = utils::strdup("value count mean stdev min max");
+
+    memory->create(mom,3*nvalues,"dump:mom");
+    memory->create(mom_all,3*nvalues,"dump:mom_all");
+    memory->create(momin,nvalues,"dump:momin");
+    memory->create(momin_all,nvalues,"dump:momin_all");
+    memory->create(momax,nvalues,"dump:momax");
+    memory->create(momax_all,nvalues,"dump:momax_all");
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpReduce::~DumpReduce()
+{
+  memory->destroy(bin);
+  memory->destroy(bin_all);
+  memory->destroy(coord);
+  memory->destroy(mom);
+  memory->destroy(mom_all);
+  memory->destroy(momin);
+  memory->destroy(momin_all);
+  memory->destroy(momax);
+  memory->destroy(momax_all);
+  memory->destroy(vector);
+  delete[] columns;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpReduce::init_style()
+{
+  if (sort_flag) error->all(FLERR,"Dump reduce cannot sort its output");
+
+  // find current ptr for each compute, fix, variable
+  // check that the inputs are per-atom and accessed in-range
+  // check that fix frequency is acceptable
+
+  for (auto &val : values) {
+    if (val.which == ArgInfo::COMPUTE) {
+      val.val.c = modify->get_compute_by_id(val.id);
+      if (!val.val.c) error->all(FLERR,"Could not find dump reduce compute ID {}", val.id);
+      if (val.val.c->peratom_flag == 0)
+        error->all(FLERR,"Dump reduce compute {} does not compute per-atom info", val.id);
+      if (val.argindex == 0 && val.val.c->size_peratom_cols > 0)
+        error->all(FLERR,"Dump reduce compute {} does not compute per-atom vector", val.id);
+      if (val.argindex > 0 && val.val.c->size_peratom_cols == 0)
+        error->all(FLERR,"Dump reduce compute {} does not compute per-atom array", val.id);
+      if (val.argindex > 0 && val.argindex > val.val.c->size_peratom_cols)
+        error->all(FLERR,"Dump reduce compute {} vector is accessed out-of-range", val.id);
+
+    } else if (val.which == ArgInfo::FIX) {
+      val.val.f = modify->get_fix_by_id(val.id);
+      if (!val.val.f) error->all(FLERR,"Could not find dump reduce fix ID {}", val.id);
+      if (val.val.f->peratom_flag == 0)
+        error->all(FLERR,"Dump reduce fix {} does not compute per-atom info", val.id);
+      if (val.argindex == 0 && val.val.f->size_peratom_cols > 0)
+        error->all(FLERR,"Dump reduce fix {} does not compute per-atom vector", val.id);
+      if (val.argindex > 0 && val.val.f->size_peratom_cols == 0)
+        error->all(FLERR,"Dump reduce fix {} does not compute per-atom array", val.id);
+      if (val.argindex > 0 && val.argindex > val.val.f->size_peratom_cols)
+        error->all(FLERR,"Dump reduce fix {} vector is accessed out-of-range", val.id);
+      if (nevery % val.val.f->peratom_freq)
+        error->all(FLERR,"Dump reduce and fix {} not computed at compatible times", val.id);
+
+    } else if (val.which == ArgInfo::VARIABLE) {
+      val.val.v = input->variable->find(val.id.c_str());
+      if (val.val.v < 0)
+        error->all(FLERR,"Could not find dump reduce variable name {}", val.id);
+      if (input->variable->atomstyle(val.val.v) == 0)
+        error->all(FLERR,"Dump reduce variable {} is not atom-style variable", val.id);
+    }
+  }
+
+  // setup boundary string
+
+  domain->boundary_string(boundstr);
+
+  // open single file, one time only
+
+  if (multifile == 0) openfile();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpReduce::write_header(bigint ndump)
+{
+  if (me == 0) {
+    if (unit_flag && !unit_count) {
+      ++unit_count;
+      fmt::print(fp,"ITEM: UNITS\n{}\n",update->unit_style);
+    }
+    if (time_flag) fmt::print(fp,"ITEM: TIME\n{:.16}\n",compute_time());
+
+    const char *label = (mode == HISTO) ? "BINS" : "VALUES";
+    fmt::print(fp,"ITEM: TIMESTEP\n{}\n"
+               "ITEM: NUMBER OF {}\n{}\n",
+               update->ntimestep, label, ndump);
+
+    if (domain->triclinic) {
+      fmt::print(fp,"ITEM: BOX BOUNDS xy xz yz {}\n"
+                 "{:>1.16e} {:>1.16e} {:>1.16e}\n"
+                 "{:>1.16e} {:>1.16e} {:>1.16e}\n"
+                 "{:>1.16e} {:>1.16e} {:>1.16e}\n",
+                 boundstr,boxxlo,boxxhi,boxxy,boxylo,boxyhi,boxxz,boxzlo,boxzhi,boxyz);
+    } else {
+      fmt::print(fp,"ITEM: BOX BOUNDS {}\n"
+                 "{:>1.16e} {:>1.16e}\n"
+                 "{:>1.16e} {:>1.16e}\n"
+                 "{:>1.16e} {:>1.16e}\n",
+                 boundstr,boxxlo,boxxhi,boxylo,boxyhi,boxzlo,boxzhi);
+    }
+
+    if (mode == HISTO)
+      fmt::print(fp,"ITEM: STATS count out-of-range min max\n"
+                 "{:.0f} {:.0f} {:.8g} {:.8g}\n",
+                 stats_all[0],stats_all[1],stats_all[2],stats_all[3]);
+
+    fmt::print(fp,"ITEM: {} {}\n", label, columns);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   accumulate the local partial reduction over all inputs, then merge it
+   across procs; only proc 0 contributes rows to the snapshot
+------------------------------------------------------------------------- */
+
+int DumpReduce::count()
+{
+  // zero accumulators
+
+  if (mode == HISTO) {
+    stats[0] = stats[1] = 0.0;
+    stats[2] = BIG;
+    stats[3] = -BIG;
+    for (int i = 0; i < nbins; i++) bin[i] = 0.0;
+  } else {
+    for (int m = 0; m < 3*nvalues; m++) mom[m] = 0.0;
+    for (int m = 0; m < nvalues; m++) {
+      momin[m] = BIG;
+      momax[m] = -BIG;
+    }
+  }
+
+  // accumulate atom attributes, computes, fixes, variables
+
+  int m = 0;
+  for (auto &val : values) {
+    int j = val.argindex;
+
+    if (val.which == ArgInfo::X) {
+      reduce_atoms(m,&atom->x[0][j],3);
+    } else if (val.which == ArgInfo::V) {
+      reduce_atoms(m,&atom->v[0][j],3);
+    } else if (val.which == ArgInfo::F) {
+      reduce_atoms(m,&atom->f[0][j],3);
+
+    } else if (val.which == ArgInfo::COMPUTE) {
+      if (!val.val.c->is_initialized())
+        error->all(FLERR,"Dump compute ID {} cannot be invoked before initialization by a run",
+                   val.val.c->id);
+      if (!(val.val.c->invoked_flag & Compute::INVOKED_PERATOM)) {
+        val.val.c->compute_peratom();
+        val.val.c->invoked_flag |= Compute::INVOKED_PERATOM;
+      }
+      if (j == 0)
+        reduce_atoms(m,val.val.c->vector_atom,1);
+      else if (val.val.c->array_atom)
+        reduce_atoms(m,&val.val.c->array_atom[0][j-1],val.val.c->size_peratom_cols);
+
+    } else if (val.which == ArgInfo::FIX) {
+      if (update->ntimestep % val.val.f->peratom_freq)
+        error->all(FLERR,"Fix {} for dump reduce not computed at compatible time", val.id);
+      if (j == 0)
+        reduce_atoms(m,val.val.f->vector_atom,1);
+      else if (val.val.f->array_atom)
+        reduce_atoms(m,&val.val.f->array_atom[0][j-1],val.val.f->size_peratom_cols);
+
+    } else if (val.which == ArgInfo::VARIABLE) {
+      if (atom->nmax > maxatom) {
+        memory->destroy(vector);
+        maxatom = atom->nmax;
+        memory->create(vector,maxatom,"dump:vector");
+      }
+      input->variable->compute_atom(val.val.v,igroup,vector,1,0);
+      reduce_atoms(m,vector,1);
+    }
+    m++;
+  }
+
+  // merge the partial reductions across procs
+
+  if (mode == HISTO) {
+    MPI_Allreduce(stats,stats_all,2,MPI_DOUBLE,MPI_SUM,world);
+    MPI_Allreduce(&stats[2],&stats_all[2],1,MPI_DOUBLE,MPI_MIN,world);
+    MPI_Allreduce(&stats[3],&stats_all[3],1,MPI_DOUBLE,MPI_MAX,world);
+    MPI_Allreduce(bin,bin_all,nbins,MPI_DOUBLE,MPI_SUM,world);
+  } else {
+    MPI_Allreduce(mom,mom_all,3*nvalues,MPI_DOUBLE,MPI_SUM,world);
+    MPI_Allreduce(momin,momin_all,nvalues,MPI_DOUBLE,MPI_MIN,world);
+    MPI_Allreduce(momax,momax_all,nvalues,MPI_DOUBLE,MPI_MAX,world);
+  }
+
+  // only proc 0 writes the reduced rows
+
+  if (me == 0) return (mode == HISTO) ? nbins : nvalues;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpReduce::pack(tagint * /*dummy*/)
+{
+  int n = 0;
+
+  if (mode == HISTO) {
+    double total = stats_all[0];
+    for (int i = 0; i < nme; i++) {
+      buf[n++] = i+1;
+      buf[n++] = coord[i];
+      buf[n++] = bin_all[i];
+      buf[n++] = (total != 0.0) ? bin_all[i]/total : 0.0;
+    }
+  } else {
+    for (int m = 0; m < nme; m++) {
+      double ncount = mom_all[3*m];
+      double mean = 0.0;
+      double stdev = 0.0;
+      if (ncount != 0.0) {
+        mean = mom_all[3*m+1]/ncount;
+        double var = mom_all[3*m+2]/ncount - mean*mean;
+        if (var > 0.0) stdev = sqrt(var);
+      }
+      buf[n++] = m+1;
+      buf[n++] = ncount;
+      buf[n++] = mean;
+      buf[n++] = stdev;
+      buf[n++] = (ncount != 0.0) ? momin_all[m] : 0.0;
+      buf[n++] = (ncount != 0.0) ? momax_all[m] : 0.0;
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpReduce::write_data(int n, double *mybuf)
+{
+  int m = 0;
+  if (mode == HISTO) {
+    for (int i = 0; i < n; i++) {
+      fmt::print(fp,"{} {:.8g} {:.0f} {:.8g}\n",
+                 static_cast<int> (mybuf[m]),mybuf[m+1],mybuf[m+2],mybuf[m+3]);
+      m += size_one;
+    }
+  } else {
+    for (int i = 0; i < n; i++) {
+      fmt::print(fp,"{} {:.0f} {:.8g} {:.8g} {:.8g} {:.8g}\n",
+                 static_cast<int> (mybuf[m]),mybuf[m+1],mybuf[m+2],
+                 mybuf[m+3],mybuf[m+4],mybuf[m+5]);
+      m += size_one;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   reduce a single value of input m
+------------------------------------------------------------------------- */
+
+void DumpReduce::reduce_one(int m, double value)
+{
+  if (mode == HISTO) {
+    stats[2] = MIN(stats[2],value);
+    stats[3] = MAX(stats[3],value);
+
+    if (value < lo || value > hi) {
+      stats[1] += 1.0;
+      return;
+    }
+    int ibin = static_cast<int> ((value-lo)*bininv);
+    ibin = MIN(ibin,nbins-1);
+    bin[ibin] += 1.0;
+    stats[0] += 1.0;
+
+  } else {
+    mom[3*m] += 1.0;
+    mom[3*m+1] += value;
+    mom[3*m+2] += value*value;
+    momin[m] = MIN(momin[m],value);
+    momax[m] = MAX(momax[m],value);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   reduce a per-atom vector of values with stride
+   only include atoms in the dump group
+------------------------------------------------------------------------- */
+
+void DumpReduce::reduce_atoms(int m, double *avalues, int stride)
+{
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  int i = 0;
+  for (int n = 0; n < nlocal; n++) {
+    if (mask[n] & groupbit) reduce_one(m,avalues[i]);
+    i += stride;
+  }
+}
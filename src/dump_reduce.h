@@ -0,0 +1,78 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+// clang-format off
+DumpStyle(reduce,DumpReduce);
+// clang-format on
+#else
+
+#ifndef LMP_DUMP_REDUCE_H
+#define LMP_DUMP_REDUCE_H
+
+#include "dump.h"
+
+namespace LAMMPS_NS {
+
+class DumpReduce : public Dump {
+ public:
+  DumpReduce(class LAMMPS *, int, char **);
+  ~DumpReduce() override;
+
+ protected:
+  struct value_t {
+    int which;         // type of data: X, V, F, COMPUTE, FIX, VARIABLE
+    int argindex;      // 1-based index if data is vector, else 0
+    std::string id;    // compute/fix/variable ID
+    union {
+      class Compute *c;
+      class Fix *f;
+      int v;
+    } val;
+  };
+  std::vector<value_t> values;
+
+  int mode;        // HISTO or MOMENTS
+  int nvalues;     // # of per-atom inputs
+  int nevery;      // dump frequency for fix frequency checks
+
+  double lo, hi, binsize, bininv;    // histogram range and bin width
+  int nbins;
+  double *bin, *bin_all;    // local and reduced bin counts
+  double *coord;            // center coordinate of each bin
+  double stats[4];          // inside count, out-of-range count, min, max
+  double stats_all[4];
+
+  double *mom, *mom_all;        // count, sum, sum of squares per value
+  double *momin, *momin_all;    // min per value
+  double *momax, *momax_all;    // max per value
+
+  double *vector;    // buffer for evaluating atom-style variables
+  int maxatom;
+
+  char *columns;    // column labels for the header ITEM line
+
+  void init_style() override;
+  void write_header(bigint) override;
+  int count() override;
+  void pack(tagint *) override;
+  void write_data(int, double *) override;
+
+  void reduce_one(int, double);
+  void reduce_atoms(int, double *, int);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
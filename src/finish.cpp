@@ -32,11 +32,15 @@
 #include "universe.h"
 #include "update.h"
 
+#include "fix.h"
+#include "modify.h"
+
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <vector>
 
 #ifdef LMP_OPENMP
-#include "modify.h"
 #include "fix_omp.h"
 #include "thr_data.h"
 #endif
@@ -357,6 +361,53 @@ void Finish::end(int flag)
     }
   }
 
+  // per-section hardware counter breakdown if collection was enabled
+  // via the timer counters command
+
+  if (timeflag && timer->has_normal() && timer->has_counters()) {
+    const char *labels[8] = {"Pair","Bond","Kspace","Neigh","Comm","Output","Modify","Sync"};
+    const Timer::ttype sections[8] = {Timer::PAIR,Timer::BOND,Timer::KSPACE,Timer::NEIGH,
+                                      Timer::COMM,Timer::OUTPUT,Timer::MODIFY,Timer::SYNC};
+    double counts[16],countsall[16];
+    for (i = 0; i < 8; i++) {
+      counts[2*i] = timer->get_instr(sections[i]);
+      counts[2*i+1] = timer->get_cachemiss(sections[i]);
+    }
+    MPI_Allreduce(counts,countsall,16,MPI_DOUBLE,MPI_SUM,world);
+    if (me == 0) {
+      utils::logmesg(lmp,"\nHardware counter breakdown (ave over procs):\n"
+                     "Section | instructions | LLC misses\n");
+      for (i = 0; i < 8; i++) {
+        if (sections[i] == Timer::SYNC && !timer->has_sync()) continue;
+        utils::logmesg(lmp,"{:<7} | {:<12.4g} | {:<12.4g}\n",
+                       labels[i],countsall[2*i]/nprocs,countsall[2*i+1]/nprocs);
+      }
+    }
+  }
+
+  // per-fix timing breakdown, tallied by Modify at timer full level
+  // attributes the Modify section to individual fixes
+
+  if (timeflag && timer->has_full() && modify->nfix > 0) {
+    int nfix = modify->nfix;
+    double *fixtime = new double[nfix];
+    double *fixtimeall = new double[nfix];
+    for (i = 0; i < nfix; i++) fixtime[i] = modify->fix[i]->fixtime;
+    MPI_Allreduce(fixtime,fixtimeall,nfix,MPI_DOUBLE,MPI_SUM,world);
+    double fixtotal = 0.0;
+    for (i = 0; i < nfix; i++) fixtotal += fixtimeall[i];
+    if (me == 0 && fixtotal > 0.0) {
+      utils::logmesg(lmp,"\nFix timing breakdown (ave over procs):\n"
+                     "Fix ID               | Style                | time (s)   | %total\n");
+      for (i = 0; i < nfix; i++)
+        utils::logmesg(lmp,"{:<20} | {:<20} | {:<10.4g} |{:6.2f}\n",
+                       modify->fix[i]->id,modify->fix[i]->style,
+                       fixtimeall[i]/nprocs,fixtimeall[i]/fixtotal*100.0);
+    }
+    delete[] fixtime;
+    delete[] fixtimeall;
+  }
+
 #ifdef LMP_OPENMP
   FixOMP *fixomp = dynamic_cast<FixOMP *>(modify->get_fix_by_id("package_omp"));
 
@@ -539,11 +590,108 @@ void Finish::end(int flag)
       if ((atom->molecular != Atom::ATOMIC) && (atom->natoms > 0))
         mesg += fmt::format("Ave special neighs/atom = {:.8}\n",nspec_all/atom->natoms);
       mesg += fmt::format("Neighbor list builds = {}\n",neighbor->ncalls);
+      if (neighbor->autotune_flag) {
+        if (neighbor->autotune_done)
+          mesg += fmt::format("Autotuned neighbor bin size = {:.8g}\n",neighbor->autotune_binsize);
+        else mesg += "Neighbor bin size autotuning did not complete\n";
+      }
       if (neighbor->dist_check)
         mesg += fmt::format("Dangerous builds = {}\n",neighbor->ndanger);
       else mesg += "Dangerous builds not checked\n";
       utils::logmesg(lmp,mesg);
     }
+
+    // report duplicated bonded term evaluations with newton off
+    // each bonded term straddling a rank boundary is then evaluated on
+    //   every rank that owns one of its atoms, so the sum of per-rank
+    //   term counts vs the global unique counts measures the waste
+
+    if (force->newton_bond == 0 && atom->molecular != Atom::ATOMIC) {
+      bigint nterms_local = (bigint) neighbor->nbondlist + neighbor->nanglelist +
+        neighbor->ndihedrallist + neighbor->nimproperlist;
+      bigint nterms;
+      MPI_Allreduce(&nterms_local,&nterms,1,MPI_LMP_BIGINT,MPI_SUM,world);
+      bigint nunique = atom->nbonds + atom->nangles + atom->ndihedrals + atom->nimpropers;
+      if (me == 0 && nunique > 0 && nterms > nunique) {
+        double waste = 100.0*(double)(nterms-nunique)/(double)nterms;
+        utils::logmesg(lmp,"Duplicated bonded term evaluations (newton off) = "
+                       "{} of {} ({:.1f}%)\n",nterms-nunique,nterms,waste);
+        if (waste > 2.0)
+          utils::logmesg(lmp,"Use 'newton on' to evaluate each straddling "
+                         "bonded term on a single rank\n");
+      }
+    }
+
+    // chain spread metrics for molecular systems on multiple ranks:
+    // ave # of ranks each molecule is spread across (as for compute
+    //   chunk/atom, the # of molecules is taken as the max molecule ID)
+    //   and the fraction of bonded terms straddling a rank boundary,
+    //   i.e. evaluated with at least one ghost atom
+    // both drive ghost atom counts and bonded comm volume and respond
+    //   to the proc grid shape and to load balancing
+
+    if (nprocs > 1 && atom->molecule_flag && atom->molecular != Atom::ATOMIC) {
+      int nlocal = atom->nlocal;
+      tagint *molecule = atom->molecule;
+
+      std::vector<tagint> mols(molecule,molecule+nlocal);
+      std::sort(mols.begin(),mols.end());
+      mols.erase(std::unique(mols.begin(),mols.end()),mols.end());
+      bigint counts_local[2],counts[2];
+      counts_local[0] = mols.size();
+      if (!mols.empty() && mols[0] == 0) counts_local[0]--;
+      counts_local[1] = mols.empty() ? 0 : mols.back();
+      MPI_Allreduce(&counts_local[0],&counts[0],1,MPI_LMP_BIGINT,MPI_SUM,world);
+      MPI_Allreduce(&counts_local[1],&counts[1],1,MPI_LMP_BIGINT,MPI_MAX,world);
+
+      bigint straddle_local[2],straddle[2];
+      straddle_local[0] = straddle_local[1] = 0;
+      for (i = 0; i < neighbor->nbondlist; i++)
+        if (neighbor->bondlist[i][0] >= nlocal ||
+            neighbor->bondlist[i][1] >= nlocal) straddle_local[0]++;
+      for (i = 0; i < neighbor->nanglelist; i++)
+        if (neighbor->anglelist[i][0] >= nlocal ||
+            neighbor->anglelist[i][1] >= nlocal ||
+            neighbor->anglelist[i][2] >= nlocal) straddle_local[0]++;
+      for (i = 0; i < neighbor->ndihedrallist; i++)
+        if (neighbor->dihedrallist[i][0] >= nlocal ||
+            neighbor->dihedrallist[i][1] >= nlocal ||
+            neighbor->dihedrallist[i][2] >= nlocal ||
+            neighbor->dihedrallist[i][3] >= nlocal) straddle_local[0]++;
+      for (i = 0; i < neighbor->nimproperlist; i++)
+        if (neighbor->improperlist[i][0] >= nlocal ||
+            neighbor->improperlist[i][1] >= nlocal ||
+            neighbor->improperlist[i][2] >= nlocal ||
+            neighbor->improperlist[i][3] >= nlocal) straddle_local[0]++;
+      straddle_local[1] = (bigint) neighbor->nbondlist + neighbor->nanglelist +
+        neighbor->ndihedrallist + neighbor->nimproperlist;
+      MPI_Allreduce(straddle_local,straddle,2,MPI_LMP_BIGINT,MPI_SUM,world);
+
+      if (me == 0) {
+        std::string mesg;
+        if (counts[1] > 0)
+          mesg += fmt::format("Ave ranks spanned per molecule = {:.3f} ({} molecules)\n",
+                              (double)counts[0]/(double)counts[1],counts[1]);
+        if (straddle[1] > 0)
+          mesg += fmt::format("Bonded terms straddling rank boundaries = {} of {} ({:.1f}%)\n",
+                              straddle[0],straddle[1],
+                              100.0*(double)straddle[0]/(double)straddle[1]);
+        utils::logmesg(lmp,mesg);
+      }
+    }
+  }
+
+  // on-node vs off-node swap partner counts
+  // quantifies the locality of the proc grid mapping on multi-node runs
+
+  if (neighflag && nprocs > 1) {
+    int counts[2],countsall[2];
+    comm->swap_node_counts(counts[0],counts[1]);
+    MPI_Allreduce(counts,countsall,2,MPI_INT,MPI_SUM,world);
+    if (me == 0 && countsall[0]+countsall[1] > 0)
+      utils::logmesg(lmp,"Comm swap partners on/off node = {} {} ({:.1f}% off-node)\n",
+                     countsall[0],countsall[1],
+                     100.0*countsall[1]/(countsall[0]+countsall[1]));
   }
 
   if (logfile) fflush(logfile);
@@ -79,6 +79,7 @@ Fix::Fix(LAMMPS *lmp, int /*narg*/, char **arg) :
   pre_exchange_migrate = 0;
   stores_ids = 0;
   diam_flag = 0;
+  fixtime = 0.0;
 
   scalar_flag = vector_flag = array_flag = 0;
   extscalar = extvector = extarray = -1;
@@ -87,6 +88,7 @@ Fix::Fix(LAMMPS *lmp, int /*narg*/, char **arg) :
   size_vector_variable = size_array_rows_variable = 0;
 
   comm_forward = comm_reverse = comm_border = 0;
+  comm_reverse_array = 0;
   restart_reset = 0;
 
   // reasonable defaults
@@ -110,7 +112,7 @@ Fix::Fix(LAMMPS *lmp, int /*narg*/, char **arg) :
   datamask_modify = ALL_MASK;
 
   kokkosable = copymode = 0;
-  forward_comm_device = exchange_comm_device = sort_device = 0;
+  forward_comm_device = reverse_comm_device = exchange_comm_device = sort_device = 0;
   fuse_integrate_flag = 0;
 }
 
@@ -80,6 +80,9 @@ class Fix : protected Pointers {
   int stores_ids;              // 1 if fix stores atom IDs
   int diam_flag;               // 1 if fix may change partical diameter
 
+  double fixtime;              // wall time accumulated in per-step hooks
+                               //      tallied by Modify at timer full level
+
   int scalar_flag;                 // 0/1 if compute_scalar() function exists
   int vector_flag;                 // 0/1 if compute_vector() function exists
   int array_flag;                  // 0/1 if compute_array() function exists
@@ -112,9 +115,12 @@ class Fix : protected Pointers {
   double *vector_local;    // computed local vector
   double **array_local;    // computed local array
 
-  int comm_forward;    // size of forward communication (0 if none)
-  int comm_reverse;    // size of reverse communication (0 if none)
-  int comm_border;     // size of border communication (0 if none)
+  int comm_forward;         // size of forward communication (0 if none)
+  int comm_reverse;         // size of reverse communication (0 if none)
+  int comm_reverse_array;   // 1 if reverse comm data = comm_reverse columns of
+                            //   array_atom, packed contiguously by ghost atom index,
+                            //   so comm can send directly from the array
+  int comm_border;          // size of border communication (0 if none)
 
   double virial[6];          // virial for this timestep
   double *eatom, **vatom;    // per-atom energy/virial for this timestep
@@ -131,6 +137,7 @@ class Fix : protected Pointers {
 
   int kokkosable;              // 1 if Kokkos fix
   int forward_comm_device;     // 1 if forward comm on Device
+  int reverse_comm_device;     // 1 if reverse comm on Device
   int exchange_comm_device;    // 1 if exchange comm on Device
   int fuse_integrate_flag;     // 1 if can fuse initial integrate with final integrate
   int sort_device;             // 1 if sort on Device
@@ -172,6 +179,7 @@ class Fix : protected Pointers {
 
   virtual void grow_arrays(int) {}
   virtual void copy_arrays(int, int, int) {}
+  virtual int reorder_arrays(int, int *) { return 0; }
   virtual void set_arrays(int) {}
   virtual void update_arrays(int, int) {}
   virtual void set_molecule(int, tagint, int, double *, double *, double *);
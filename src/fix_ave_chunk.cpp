@@ -744,7 +744,7 @@ void FixAveChunk::end_of_step()
         values_many[m][j] += values_one[m][j];
     }
   } else if (normflag == SAMPLE) {
-    MPI_Allreduce(count_one,count_many,nchunk,MPI_DOUBLE,MPI_SUM,world);
+    reduce_chunks(count_one,count_many,nullptr,nullptr);
 
     if (cchunk->chunk_volume_vec) {
       volflag = VECTOR;
@@ -812,9 +812,7 @@ void FixAveChunk::end_of_step()
   double repeat = nrepeat;
 
   if (normflag == ALL) {
-    MPI_Allreduce(count_many,count_sum,nchunk,MPI_DOUBLE,MPI_SUM,world);
-    MPI_Allreduce(&values_many[0][0],&values_sum[0][0],nchunk*nvalues,
-                  MPI_DOUBLE,MPI_SUM,world);
+    reduce_chunks(count_many,count_sum,values_many,values_sum);
 
     if (cchunk->chunk_volume_vec) {
       volflag = VECTOR;
@@ -846,8 +844,7 @@ void FixAveChunk::end_of_step()
       count_sum[m] /= repeat;
     }
   } else if (normflag == SAMPLE) {
-    MPI_Allreduce(&values_many[0][0],&values_sum[0][0],nchunk*nvalues,
-                  MPI_DOUBLE,MPI_SUM,world);
+    reduce_chunks(nullptr,nullptr,values_many,values_sum);
     for (m = 0; m < nchunk; m++) {
       for (j = 0; j < nvalues; j++) values_sum[m][j] /= repeat;
       count_sum[m] /= repeat;
@@ -992,6 +989,119 @@ void FixAveChunk::end_of_step()
   }
 }
 
+/* ----------------------------------------------------------------------
+   sum per-chunk accumulators across all procs
+   each proc only contributes to chunks its own atoms touched, so when
+     the touched fraction is small (fine-grained spatial bins on many
+     procs), allgather (index,count,values) tuples for touched chunks
+     instead of allreducing the dense nchunk-length arrays
+   falls back to dense MPI_Allreduce when tuples would not be smaller
+   cnt_in/cnt_out are NULL if only values are reduced, and vice versa
+   all procs end up with the full sums, as fix output is global
+------------------------------------------------------------------------- */
+
+void FixAveChunk::reduce_chunks(double *cnt_in, double *cnt_out,
+                                double **val_in, double **val_out)
+{
+  int m,j;
+
+  const int nv = val_in ? nvalues : 0;
+  const int width = 1 + (cnt_in ? 1 : 0) + nv;
+
+  // ntouch = # of chunks this proc contributed to
+
+  int ntouch = 0;
+  if (cnt_in) {
+    for (m = 0; m < nchunk; m++)
+      if (cnt_in[m] != 0.0) ntouch++;
+  } else {
+    for (m = 0; m < nchunk; m++)
+      for (j = 0; j < nv; j++)
+        if (val_in[m][j] != 0.0) {
+          ntouch++;
+          break;
+        }
+  }
+
+  // use the dense path unless the tuples from all procs amount to
+  // less than half the dense arrays
+
+  bigint nsend = (bigint) ntouch*width;
+  bigint nsendall;
+  MPI_Allreduce(&nsend,&nsendall,1,MPI_LMP_BIGINT,MPI_SUM,world);
+
+  bigint dense = (bigint) nchunk * (width-1);
+  if (2*nsendall >= dense || nsendall > MAXSMALLINT) {
+    if (cnt_in) MPI_Allreduce(cnt_in,cnt_out,nchunk,MPI_DOUBLE,MPI_SUM,world);
+    if (val_in) MPI_Allreduce(&val_in[0][0],&val_out[0][0],nchunk*nv,
+                              MPI_DOUBLE,MPI_SUM,world);
+    return;
+  }
+
+  // pack (index,count,values) tuples for my touched chunks
+
+  double *sendbuf;
+  memory->create(sendbuf,(int) nsend,"ave/chunk:sendbuf");
+
+  int n = 0;
+  for (m = 0; m < nchunk; m++) {
+    int touched;
+    if (cnt_in) touched = (cnt_in[m] != 0.0);
+    else {
+      touched = 0;
+      for (j = 0; j < nv; j++)
+        if (val_in[m][j] != 0.0) {
+          touched = 1;
+          break;
+        }
+    }
+    if (!touched) continue;
+    sendbuf[n++] = (double) m;
+    if (cnt_in) sendbuf[n++] = cnt_in[m];
+    for (j = 0; j < nv; j++) sendbuf[n++] = val_in[m][j];
+  }
+
+  // allgather tuples from all procs
+
+  int nprocs = comm->nprocs;
+  int *recvcounts,*displs;
+  memory->create(recvcounts,nprocs,"ave/chunk:recvcounts");
+  memory->create(displs,nprocs,"ave/chunk:displs");
+
+  int nsendint = (int) nsend;
+  MPI_Allgather(&nsendint,1,MPI_INT,recvcounts,1,MPI_INT,world);
+  displs[0] = 0;
+  for (int iproc = 1; iproc < nprocs; iproc++)
+    displs[iproc] = displs[iproc-1] + recvcounts[iproc-1];
+  int nall = displs[nprocs-1] + recvcounts[nprocs-1];
+
+  double *recvbuf;
+  memory->create(recvbuf,nall,"ave/chunk:recvbuf");
+  MPI_Allgatherv(sendbuf,nsendint,MPI_DOUBLE,recvbuf,recvcounts,displs,
+                 MPI_DOUBLE,world);
+
+  // zero the outputs, then accumulate all tuples
+
+  if (cnt_out)
+    for (m = 0; m < nchunk; m++) cnt_out[m] = 0.0;
+  if (val_out) {
+    double *flat = &val_out[0][0];
+    for (m = 0; m < nchunk*nv; m++) flat[m] = 0.0;
+  }
+
+  n = 0;
+  while (n < nall) {
+    m = (int) recvbuf[n++];
+    if (cnt_out) cnt_out[m] += recvbuf[n++];
+    for (j = 0; j < nv; j++) val_out[m][j] += recvbuf[n++];
+  }
+
+  memory->destroy(sendbuf);
+  memory->destroy(recvbuf);
+  memory->destroy(recvcounts);
+  memory->destroy(displs);
+}
+
 /* ----------------------------------------------------------------------
    allocate all per-chunk vectors
 ------------------------------------------------------------------------- */
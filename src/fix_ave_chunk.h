@@ -84,6 +84,7 @@ class FixAveChunk : public Fix {
   double **values_total, ***values_list;
 
   void allocate();
+  void reduce_chunks(double *, double *, double **, double **);
   bigint nextvalid();
 };
 
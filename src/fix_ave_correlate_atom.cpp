@@ -0,0 +1,677 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "fix_ave_correlate_atom.h"
+
+#include "arg_info.h"
+#include "atom.h"
+#include "comm.h"
+#include "compute.h"
+#include "error.h"
+#include "input.h"
+#include "memory.h"
+#include "modify.h"
+#include "update.h"
+#include "variable.h"
+
+#include <cstring>
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+enum { ONE, RUNNING };
+
+/* ---------------------------------------------------------------------- */
+
+FixAveCorrelateAtom::FixAveCorrelateAtom(LAMMPS *lmp, int narg, char **arg) :
+    Fix(lmp, narg, arg), fp(nullptr), cvalues(nullptr), count(nullptr), corr(nullptr),
+    save_count(nullptr), save_corr(nullptr)
+{
+  if (narg < 7) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom", error);
+
+  nevery = utils::inumeric(FLERR, arg[3], false, lmp);
+  nrepeat = utils::inumeric(FLERR, arg[4], false, lmp);
+  nfreq = utils::inumeric(FLERR, arg[5], false, lmp);
+
+  time_depend = 1;
+  global_freq = nfreq;
+
+  // expand args if any have wildcard character "*"
+
+  int expand = 0;
+  char **earg;
+  int nargnew = utils::expand_args(FLERR, narg - 6, &arg[6], 1, earg, lmp);
+
+  if (earg != &arg[6]) expand = 1;
+  arg = earg;
+
+  // parse values until one isn't recognized
+
+  int iarg = 0;
+  while (iarg < nargnew) {
+    value_t val;
+    val.id = "";
+    val.val.c = nullptr;
+
+    if (strcmp(arg[iarg], "x") == 0) {
+      val.which = ArgInfo::X;
+      val.argindex = 0;
+    } else if (strcmp(arg[iarg], "y") == 0) {
+      val.which = ArgInfo::X;
+      val.argindex = 1;
+    } else if (strcmp(arg[iarg], "z") == 0) {
+      val.which = ArgInfo::X;
+      val.argindex = 2;
+
+    } else if (strcmp(arg[iarg], "vx") == 0) {
+      val.which = ArgInfo::V;
+      val.argindex = 0;
+    } else if (strcmp(arg[iarg], "vy") == 0) {
+      val.which = ArgInfo::V;
+      val.argindex = 1;
+    } else if (strcmp(arg[iarg], "vz") == 0) {
+      val.which = ArgInfo::V;
+      val.argindex = 2;
+
+    } else if (strcmp(arg[iarg], "fx") == 0) {
+      val.which = ArgInfo::F;
+      val.argindex = 0;
+    } else if (strcmp(arg[iarg], "fy") == 0) {
+      val.which = ArgInfo::F;
+      val.argindex = 1;
+    } else if (strcmp(arg[iarg], "fz") == 0) {
+      val.which = ArgInfo::F;
+      val.argindex = 2;
+
+    } else {
+      ArgInfo argi(arg[iarg]);
+
+      if (argi.get_type() == ArgInfo::NONE) break;
+      if ((argi.get_type() == ArgInfo::UNKNOWN) || (argi.get_dim() > 1))
+        error->all(FLERR, "Unknown fix ave/correlate/atom data type: {}", arg[iarg]);
+
+      val.which = argi.get_type();
+      val.argindex = argi.get_index1();
+      val.id = argi.get_name();
+    }
+
+    values.push_back(val);
+    iarg++;
+  }
+  nvalues = values.size();
+  if (nvalues == 0) error->all(FLERR, "No values in fix ave/correlate/atom command");
+
+  // optional args
+
+  ave = ONE;
+  startstep = 0;
+  prefactor = 1.0;
+  fp = nullptr;
+  overwrite = 0;
+  char *title1 = nullptr;
+  char *title2 = nullptr;
+  char *title3 = nullptr;
+
+  while (iarg < nargnew) {
+    if (strcmp(arg[iarg],"ave") == 0) {
+      if (iarg+2 > nargnew) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom ave", error);
+      if (strcmp(arg[iarg+1],"one") == 0) ave = ONE;
+      else if (strcmp(arg[iarg+1],"running") == 0) ave = RUNNING;
+      else error->all(FLERR,"Unknown fix ave/correlate/atom ave mode: {}", arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"start") == 0) {
+      if (iarg+2 > nargnew) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom start", error);
+      startstep = utils::inumeric(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"prefactor") == 0) {
+      if (iarg+2 > nargnew)
+        utils::missing_cmd_args(FLERR, "fix ave/correlate/atom prefactor", error);
+      prefactor = utils::numeric(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"file") == 0) {
+      if (iarg+2 > nargnew) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom file", error);
+      if (comm->me == 0) {
+        fp = fopen(arg[iarg+1],"w");
+        if (fp == nullptr)
+          error->one(FLERR,"Cannot open fix ave/correlate/atom file {}: {}",
+                     arg[iarg+1], utils::getsyserror());
+      }
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"overwrite") == 0) {
+      overwrite = 1;
+      iarg += 1;
+    } else if (strcmp(arg[iarg],"title1") == 0) {
+      if (iarg+2 > nargnew) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom title1", error);
+      delete[] title1;
+      title1 = utils::strdup(arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"title2") == 0) {
+      if (iarg+2 > nargnew) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom title2", error);
+      delete[] title2;
+      title2 = utils::strdup(arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"title3") == 0) {
+      if (iarg+2 > nargnew) utils::missing_cmd_args(FLERR, "fix ave/correlate/atom title3", error);
+      delete[] title3;
+      title3 = utils::strdup(arg[iarg+1]);
+      iarg += 2;
+    } else error->all(FLERR,"Unknown fix ave/correlate/atom keyword: {}", arg[iarg]);
+  }
+
+  // setup and error check
+  // for fix inputs, check that fix frequency is acceptable
+
+  if (nevery <= 0) error->all(FLERR,"Illegal fix ave/correlate/atom nevery value: {}", nevery);
+  if (nrepeat <= 0) error->all(FLERR,"Illegal fix ave/correlate/atom nrepeat value: {}", nrepeat);
+  if (nfreq <= 0) error->all(FLERR,"Illegal fix ave/correlate/atom nfreq value: {}", nfreq);
+  if (nfreq % nevery || nrepeat*nevery > nfreq)
+    error->all(FLERR,"Inconsistent fix ave/correlate/atom nevery/nrepeat/nfreq values");
+  if (ave != RUNNING && overwrite)
+    error->all(FLERR,"Fix ave/correlate/atom overwrite keyword requires ave running setting");
+
+  for (auto &val : values) {
+
+    if (val.which == ArgInfo::COMPUTE) {
+      val.val.c = modify->get_compute_by_id(val.id);
+      if (!val.val.c)
+        error->all(FLERR, "Compute ID {} for fix ave/correlate/atom does not exist", val.id);
+      if (val.val.c->peratom_flag == 0)
+        error->all(FLERR, "Fix ave/correlate/atom compute {} does not calculate per-atom values",
+                   val.id);
+      if (val.argindex == 0 && val.val.c->size_peratom_cols != 0)
+        error->all(FLERR, "Fix ave/correlate/atom compute {} does not calculate a per-atom vector",
+                   val.id);
+      if (val.argindex && val.val.c->size_peratom_cols == 0)
+        error->all(FLERR, "Fix ave/correlate/atom compute {} does not calculate a per-atom array",
+                   val.id);
+      if (val.argindex && val.argindex > val.val.c->size_peratom_cols)
+        error->all(FLERR, "Fix ave/correlate/atom compute {} array is accessed out-of-range",
+                   val.id);
+
+    } else if (val.which == ArgInfo::FIX) {
+      val.val.f = modify->get_fix_by_id(val.id);
+      if (!val.val.f)
+        error->all(FLERR, "Fix ID {} for fix ave/correlate/atom does not exist", val.id);
+      if (val.val.f->peratom_flag == 0)
+        error->all(FLERR, "Fix ave/correlate/atom fix {} does not calculate per-atom values",
+                   val.id);
+      if (val.argindex == 0 && val.val.f->size_peratom_cols != 0)
+        error->all(FLERR, "Fix ave/correlate/atom fix {} does not calculate a per-atom vector",
+                   val.id);
+      if (val.argindex && val.val.f->size_peratom_cols == 0)
+        error->all(FLERR, "Fix ave/correlate/atom fix {} does not calculate a per-atom array",
+                   val.id);
+      if (val.argindex && val.argindex > val.val.f->size_peratom_cols)
+        error->all(FLERR, "Fix ave/correlate/atom fix {} array is accessed out-of-range", val.id);
+      if (nevery % val.val.f->peratom_freq)
+        error->all(FLERR, "Fix {} for fix ave/correlate/atom not computed at compatible time",
+                   val.id);
+
+    } else if (val.which == ArgInfo::VARIABLE) {
+      val.val.v = input->variable->find(val.id.c_str());
+      if (val.val.v < 0)
+        error->all(FLERR, "Variable name {} for fix ave/correlate/atom does not exist", val.id);
+      if (input->variable->atomstyle(val.val.v) == 0)
+        error->all(FLERR, "Fix ave/correlate/atom variable {} is not atom-style variable", val.id);
+    }
+  }
+
+  // print file comment lines
+  // only auto-correlations of each value are computed
+
+  if (fp && comm->me == 0) {
+    clearerr(fp);
+    if (title1) fprintf(fp,"%s\n",title1);
+    else fprintf(fp,"# Per-atom time-correlated data for fix %s\n",id);
+    if (title2) fprintf(fp,"%s\n",title2);
+    else fprintf(fp,"# Timestep Number-of-time-windows\n");
+    if (title3) fprintf(fp,"%s\n",title3);
+    else {
+      fprintf(fp,"# Index TimeDelta Ncount");
+      for (int i = 0; i < nvalues; i++)
+        fprintf(fp," %s*%s",earg[i],earg[i]);
+      fprintf(fp,"\n");
+    }
+    if (ferror(fp))
+      error->one(FLERR,"Error writing ave/correlate/atom header: {}", utils::getsyserror());
+
+    filepos = platform::ftell(fp);
+  }
+
+  delete[] title1;
+  delete[] title2;
+  delete[] title3;
+
+  // if wildcard expansion occurred, free earg memory from expand_args()
+  // wait to do this until after file comment lines are printed
+
+  if (expand) {
+    for (int i = 0; i < nargnew; i++) delete[] earg[i];
+    memory->sfree(earg);
+  }
+
+  // allocate and initialize memory for accumulation
+  // set count and corr to zero since they accumulate
+  // also set save versions to zero in case accessed via compute_array()
+
+  memory->create(count,nrepeat,"ave/correlate/atom:count");
+  memory->create(save_count,nrepeat,"ave/correlate/atom:save_count");
+  memory->create(corr,nrepeat,nvalues,"ave/correlate/atom:corr");
+  memory->create(save_corr,nrepeat,nvalues,"ave/correlate/atom:save_corr");
+
+  int i,j;
+  for (i = 0; i < nrepeat; i++) {
+    save_count[i] = count[i] = 0.0;
+    for (j = 0; j < nvalues; j++)
+      save_corr[i][j] = corr[i][j] = 0.0;
+  }
+
+  // perform initial allocation of atom-based ring buffer
+  // register with Atom class
+
+  maxexchange = nrepeat*nvalues;
+  FixAveCorrelateAtom::grow_arrays(atom->nmax);
+  atom->add_callback(Atom::GROW);
+  create_attribute = 1;
+
+  // zero the ring buffer so stale data can never enter a correlation
+
+  int nlocal = atom->nlocal;
+  int ncols = nrepeat*nvalues;
+  for (i = 0; i < nlocal; i++)
+    for (j = 0; j < ncols; j++)
+      cvalues[i][j] = 0.0;
+
+  // this fix produces a global array
+
+  array_flag = 1;
+  size_array_rows = nrepeat;
+  size_array_cols = nvalues+2;
+  extarray = 0;
+
+  // nvalid = next step on which end_of_step does something
+  // add nvalid to all computes that store invocation times
+  // since don't know a priori which are invoked by this fix
+  // once in end_of_step() can set timestep for ones actually invoked
+
+  lastindex = -1;
+  firstindex = 0;
+  nsample = 0;
+  nvalid_last = -1;
+  nvalid = nextvalid();
+  modify->addstep_compute_all(nvalid);
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixAveCorrelateAtom::~FixAveCorrelateAtom()
+{
+  // unregister callback to this fix from Atom class
+
+  atom->delete_callback(id,Atom::GROW);
+
+  memory->destroy(cvalues);
+  memory->destroy(count);
+  memory->destroy(save_count);
+  memory->destroy(corr);
+  memory->destroy(save_corr);
+
+  if (fp && comm->me == 0) fclose(fp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixAveCorrelateAtom::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::init()
+{
+  // set current indices for all computes,fixes,variables
+
+  for (auto &val : values) {
+
+    if (val.which == ArgInfo::COMPUTE) {
+      val.val.c = modify->get_compute_by_id(val.id);
+      if (!val.val.c)
+        error->all(FLERR, "Compute ID {} for fix ave/correlate/atom does not exist", val.id);
+
+    } else if (val.which == ArgInfo::FIX) {
+      val.val.f = modify->get_fix_by_id(val.id);
+      if (!val.val.f)
+        error->all(FLERR, "Fix ID {} for fix ave/correlate/atom does not exist", val.id);
+
+    } else if (val.which == ArgInfo::VARIABLE) {
+      val.val.v = input->variable->find(val.id.c_str());
+      if (val.val.v < 0)
+        error->all(FLERR, "Variable name {} for fix ave/correlate/atom does not exist", val.id);
+    }
+  }
+
+  // need to reset nvalid if nvalid < ntimestep b/c minimize was performed
+
+  if (nvalid < update->ntimestep) {
+    lastindex = -1;
+    firstindex = 0;
+    nsample = 0;
+    nvalid = nextvalid();
+    modify->addstep_compute_all(nvalid);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   only does something if nvalid = current timestep
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::setup(int /*vflag*/)
+{
+  end_of_step();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::end_of_step()
+{
+  int i,j,m;
+
+  // skip if not step which requires doing something
+
+  bigint ntimestep = update->ntimestep;
+  if (ntimestep != nvalid) return;
+  nvalid_last = nvalid;
+
+  // accumulate results of attributes,computes,fixes,variables into the
+  // ring slot for the new origin
+  // compute/fix/variable may invoke computes so wrap with clear/add
+
+  modify->clearstep_compute();
+
+  // lastindex = index in per-atom ring of latest time sample
+
+  lastindex++;
+  if (lastindex == nrepeat) lastindex = 0;
+
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+  int offset = lastindex*nvalues;
+
+  // zero the slot so atoms outside the group contribute nothing
+
+  for (i = 0; i < nlocal; i++)
+    for (j = 0; j < nvalues; j++)
+      cvalues[i][offset+j] = 0.0;
+
+  m = 0;
+  for (auto &val : values) {
+    j = val.argindex;
+
+    if (val.which == ArgInfo::X) {
+      double **x = atom->x;
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) cvalues[i][offset+m] = x[i][j];
+
+    } else if (val.which == ArgInfo::V) {
+      double **v = atom->v;
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) cvalues[i][offset+m] = v[i][j];
+
+    } else if (val.which == ArgInfo::F) {
+      double **f = atom->f;
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) cvalues[i][offset+m] = f[i][j];
+
+    // invoke compute if not previously invoked
+
+    } else if (val.which == ArgInfo::COMPUTE) {
+      if (!(val.val.c->invoked_flag & Compute::INVOKED_PERATOM)) {
+        val.val.c->compute_peratom();
+        val.val.c->invoked_flag |= Compute::INVOKED_PERATOM;
+      }
+
+      if (j == 0) {
+        double *compute_vector = val.val.c->vector_atom;
+        for (i = 0; i < nlocal; i++)
+          if (mask[i] & groupbit) cvalues[i][offset+m] = compute_vector[i];
+      } else {
+        int jm1 = j - 1;
+        double **compute_array = val.val.c->array_atom;
+        for (i = 0; i < nlocal; i++)
+          if (mask[i] & groupbit) cvalues[i][offset+m] = compute_array[i][jm1];
+      }
+
+    // access fix fields, guaranteed to be ready
+
+    } else if (val.which == ArgInfo::FIX) {
+      if (j == 0) {
+        double *fix_vector = val.val.f->vector_atom;
+        for (i = 0; i < nlocal; i++)
+          if (mask[i] & groupbit) cvalues[i][offset+m] = fix_vector[i];
+      } else {
+        int jm1 = j - 1;
+        double **fix_array = val.val.f->array_atom;
+        for (i = 0; i < nlocal; i++)
+          if (mask[i] & groupbit) cvalues[i][offset+m] = fix_array[i][jm1];
+      }
+
+    // evaluate atom-style variable
+    // final argument = 0 stores result directly, zeroed outside group
+
+    } else if (val.which == ArgInfo::VARIABLE) {
+      if (cvalues)
+        input->variable->compute_atom(val.val.v,igroup,&cvalues[0][offset+m],
+                                      nrepeat*nvalues,0);
+      else input->variable->compute_atom(val.val.v,igroup,nullptr,nrepeat*nvalues,0);
+    }
+    ++m;
+  }
+
+  // firstindex = index in per-atom ring of earliest time sample
+  // nsample = number of time samples in per-atom ring
+
+  if (nsample < nrepeat) nsample++;
+  else {
+    firstindex++;
+    if (firstindex == nrepeat) firstindex = 0;
+  }
+
+  nvalid += nevery;
+  modify->addstep_compute(nvalid);
+
+  // accumulate all Cij() enabled by latest values
+
+  accumulate();
+  if (ntimestep % nfreq) return;
+
+  // sum local accumulations across all procs
+  // save results in save_count and save_corr
+
+  MPI_Allreduce(count,save_count,nrepeat,MPI_DOUBLE,MPI_SUM,world);
+  if (nrepeat*nvalues)
+    MPI_Allreduce(&corr[0][0],&save_corr[0][0],nrepeat*nvalues,MPI_DOUBLE,MPI_SUM,world);
+
+  for (i = 0; i < nrepeat; i++) {
+    if (save_count[i] > 0.0)
+      for (j = 0; j < nvalues; j++)
+        save_corr[i][j] = prefactor*save_corr[i][j]/save_count[i];
+    else
+      for (j = 0; j < nvalues; j++)
+        save_corr[i][j] = 0.0;
+  }
+
+  // output result to file
+
+  if (fp && comm->me == 0) {
+    clearerr(fp);
+    if (overwrite) platform::fseek(fp,filepos);
+    fmt::print(fp,"{} {}\n",ntimestep,nrepeat);
+    for (i = 0; i < nrepeat; i++) {
+      fprintf(fp,"%d %d " BIGINT_FORMAT,i+1,i*nevery,(bigint) save_count[i]);
+      for (j = 0; j < nvalues; j++)
+        fprintf(fp," %g",save_corr[i][j]);
+      fprintf(fp,"\n");
+    }
+    if (ferror(fp))
+      error->one(FLERR,"Error writing out fix ave/correlate/atom data: {}",
+                 utils::getsyserror());
+
+    fflush(fp);
+
+    if (overwrite) {
+      bigint fileend = platform::ftell(fp);
+      if ((fileend > 0) && (platform::ftruncate(fp,fileend)))
+        error->warning(FLERR,"Error while truncating output: {}", utils::getsyserror());
+    }
+  }
+
+  // zero accumulation if requested
+  // recalculate Cij(0)
+
+  if (ave == ONE) {
+    for (i = 0; i < nrepeat; i++) {
+      count[i] = 0.0;
+      for (j = 0; j < nvalues; j++)
+        corr[i][j] = 0.0;
+    }
+    nsample = 1;
+    accumulate();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   accumulate per-atom correlation data using most recently added values
+   sum over local atoms in group, so results must be allreduced for output
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::accumulate()
+{
+  int i,k,m;
+
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  double ngroup = 0.0;
+  for (i = 0; i < nlocal; i++)
+    if (mask[i] & groupbit) ngroup += 1.0;
+  for (k = 0; k < nsample; k++) count[k] += ngroup;
+
+  int n = lastindex;
+  m = n;
+  for (k = 0; k < nsample; k++) {
+    double *corrk = corr[k];
+    int moffset = m*nvalues;
+    int noffset = n*nvalues;
+    for (i = 0; i < nlocal; i++) {
+      if (!(mask[i] & groupbit)) continue;
+      double *cv = cvalues[i];
+      for (int iv = 0; iv < nvalues; iv++)
+        corrk[iv] += cv[moffset+iv]*cv[noffset+iv];
+    }
+    m--;
+    if (m < 0) m = nrepeat-1;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   return I,J array value
+------------------------------------------------------------------------- */
+
+double FixAveCorrelateAtom::compute_array(int i, int j)
+{
+  if (j == 0) return 1.0*i*nevery;
+  else if (j == 1) return save_count[i];
+  else if (save_count[i] > 0.0) return save_corr[i][j-2];
+  return 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based ring buffer
+------------------------------------------------------------------------- */
+
+double FixAveCorrelateAtom::memory_usage()
+{
+  double bytes = (double)atom->nmax*nrepeat*nvalues * sizeof(double);
+  return bytes;
+}
+
+/* ----------------------------------------------------------------------
+   allocate atom-based ring buffer
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::grow_arrays(int nmax)
+{
+  memory->grow(cvalues,nmax,nrepeat*nvalues,"fix_ave/correlate/atom:cvalues");
+}
+
+/* ----------------------------------------------------------------------
+   copy values within local atom-based ring buffer
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::copy_arrays(int i, int j, int /*delflag*/)
+{
+  int ncols = nrepeat*nvalues;
+  for (int m = 0; m < ncols; m++)
+    cvalues[j][m] = cvalues[i][m];
+}
+
+/* ----------------------------------------------------------------------
+   zero ring buffer of a created atom so it cannot inject stale data
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::set_arrays(int i)
+{
+  int ncols = nrepeat*nvalues;
+  for (int m = 0; m < ncols; m++)
+    cvalues[i][m] = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   pack values in local atom-based ring buffer for exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixAveCorrelateAtom::pack_exchange(int i, double *buf)
+{
+  int ncols = nrepeat*nvalues;
+  for (int m = 0; m < ncols; m++) buf[m] = cvalues[i][m];
+  return ncols;
+}
+
+/* ----------------------------------------------------------------------
+   unpack values in local atom-based ring buffer from exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixAveCorrelateAtom::unpack_exchange(int nlocal, double *buf)
+{
+  int ncols = nrepeat*nvalues;
+  for (int m = 0; m < ncols; m++) cvalues[nlocal][m] = buf[m];
+  return ncols;
+}
+
+/* ----------------------------------------------------------------------
+   nvalid = next step on which end_of_step does something
+   this step if multiple of nevery, else next multiple
+   startstep is lower bound
+------------------------------------------------------------------------- */
+
+bigint FixAveCorrelateAtom::nextvalid()
+{
+  bigint nvalid = update->ntimestep;
+  if (startstep > nvalid) nvalid = startstep;
+  if (nvalid % nevery) nvalid = (nvalid/nevery)*nevery + nevery;
+  return nvalid;
+}
@@ -0,0 +1,83 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+// clang-format off
+FixStyle(ave/correlate/atom,FixAveCorrelateAtom);
+// clang-format on
+#else
+
+#ifndef LMP_FIX_AVE_CORRELATE_ATOM_H
+#define LMP_FIX_AVE_CORRELATE_ATOM_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixAveCorrelateAtom : public Fix {
+ public:
+  FixAveCorrelateAtom(class LAMMPS *, int, char **);
+  ~FixAveCorrelateAtom() override;
+  int setmask() override;
+  void init() override;
+  void setup(int) override;
+  void end_of_step() override;
+  double compute_array(int, int) override;
+
+  double memory_usage() override;
+  void grow_arrays(int) override;
+  void copy_arrays(int, int, int) override;
+  void set_arrays(int) override;
+  int pack_exchange(int, double *) override;
+  int unpack_exchange(int, double *) override;
+
+ private:
+  struct value_t {
+    int which;         // type of data: X, V, F, COMPUTE, FIX, VARIABLE
+    int argindex;      // 1-based index if data is array, else 0
+    std::string id;    // compute/fix/variable ID
+    union {
+      class Compute *c;
+      class Fix *f;
+      int v;
+    } val;
+  };
+  std::vector<value_t> values;
+
+  int nvalues, nrepeat, nfreq;
+  bigint nvalid, nvalid_last;
+  FILE *fp;
+
+  int ave, startstep, overwrite;
+  double prefactor;
+  bigint filepos;
+
+  int firstindex;    // index in per-atom ring of earliest time sample
+  int lastindex;     // index in per-atom ring of latest time sample
+  int nsample;       // number of time samples in per-atom ring
+
+  double **cvalues;    // per-atom ring buffer, nrepeat*nvalues columns
+  double *count;       // # of atom contributions per lag, local
+  double **corr;       // summed per-atom correlations per lag, local
+
+  double *save_count;    // globally summed values at Nfreq for output
+  double **save_corr;    // via compute_array()
+
+  void accumulate();
+  bigint nextvalid();
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
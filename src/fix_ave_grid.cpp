@@ -42,6 +42,10 @@ enum{DISCARD,KEEP};
 
 static constexpr int OFFSET = 16384;
 
+// DELTATALLY = chunk size for growing tally list of touched grid cells
+
+static constexpr int DELTATALLY = 4096;
+
 /* ---------------------------------------------------------------------- */
 
 FixAveGrid::FixAveGrid(LAMMPS *lmp, int narg, char **arg) :
@@ -350,6 +354,13 @@ FixAveGrid::FixAveGrid(LAMMPS *lmp, int narg, char **arg) :
   bin = nullptr;
   skip = nullptr;
 
+  // tally list of touched grid_sample cells for ATOM mode with norm = SAMPLE
+  // enabled at start of each Nfreq epoch in end_of_step()
+
+  tally = nullptr;
+  ntally = -1;
+  maxtally = 0;
+
   maxvar = 0;
   vresult = nullptr;
 
@@ -401,6 +412,7 @@ FixAveGrid::~FixAveGrid()
   if (modeatom) {
     memory->destroy(bin);
     memory->destroy(skip);
+    memory->destroy(tally);
     memory->destroy(vresult);
   }
 }
@@ -522,7 +534,10 @@ void FixAveGrid::end_of_step()
 
   if (irepeat == 0) {
     zero_grid(grid_sample);
-    if (normflag == SAMPLE) zero_grid(grid_nfreq);
+    if (normflag == SAMPLE) {
+      zero_grid(grid_nfreq);
+      if (modeatom) ntally = 0;
+    }
   }
 
   // accumulate per-grid values for one sample for either ATOM or GRID mode
@@ -563,11 +578,19 @@ void FixAveGrid::end_of_step()
   //   normalize the single sample
   //   sum sample grid to Nfreq grid
   //   return if irepeat < nrepeat
+  // if tally list is in use, only process cells touched during this sample
+  //   else fall back to sweeping entire sample grid
 
   if (modeatom && normflag == SAMPLE) {
-    normalize_atom(1,grid_sample);
-    add_grid(grid_sample,grid_nfreq);
-    zero_grid(grid_sample);
+    if (ntally >= 0) {
+      normalize_atom_tally();
+      add_grid_tally(grid_sample,grid_nfreq);
+      zero_grid_tally(grid_sample);
+    } else {
+      normalize_atom(1,grid_sample);
+      add_grid(grid_sample,grid_nfreq);
+      zero_grid(grid_sample);
+    }
 
     if (irepeat < nrepeat) {
       nvalid += nevery;
@@ -684,6 +707,16 @@ void FixAveGrid::atom2grid()
   double ***vec3d = grid_sample->vec3d;
   double ****array3d = grid_sample->array3d;
 
+  // if tally list is in use,
+  //   cbase2d/cbase3d = start of contiguous count array for cell offsets
+
+  double *cbase2d = nullptr;
+  double *cbase3d = nullptr;
+  if (ntally >= 0 && ngridout) {
+    if (dimension == 2) cbase2d = &count2d[nylo_out][nxlo_out];
+    else cbase3d = &count3d[nzlo_out][nylo_out][nxlo_out];
+  }
+
   // scan my owned atoms before tallying to bins
   // bin[i][dim] = indices of bin each atom is in
   // count[][] or count[][][] = count of atoms contributing to each bin
@@ -768,6 +801,8 @@ void FixAveGrid::atom2grid()
       }
 
       skip[i] = 0;
+      if (cbase2d && count2d[iy][ix] == 0.0)
+        tally_cell((int) (&count2d[iy][ix] - cbase2d));
       count2d[iy][ix] += 1.0;
       bin[i][0] = iy;
       bin[i][1] = ix;
@@ -836,6 +871,8 @@ void FixAveGrid::atom2grid()
       }
 
       skip[i] = 0;
+      if (cbase3d && count3d[iz][iy][ix] == 0.0)
+        tally_cell((int) (&count3d[iz][iy][ix] - cbase3d));
       count3d[iz][iy][ix] += 1.0;
       bin[i][0] = iz;
       bin[i][1] = iy;
@@ -1782,6 +1819,186 @@ void FixAveGrid::subtract_grid(GridData *src, GridData *result)
   }
 }
 
+/* ----------------------------------------------------------------------
+   append one grid_sample cell to tally list of cells touched this sample
+   offset = flattened index into contiguous grid data arrays, incl ghosts
+   only invoked for ATOM mode with norm = SAMPLE
+------------------------------------------------------------------------- */
+
+void FixAveGrid::tally_cell(int offset)
+{
+  if (ntally == maxtally) {
+    maxtally += DELTATALLY;
+    memory->grow(tally,maxtally,"ave/grid:tally");
+  }
+  tally[ntally++] = offset;
+}
+
+/* ----------------------------------------------------------------------
+   normalize per-atom values for grid_sample cells in tally list
+   same operation as normalize_atom() for a single sample
+   tallied ghost cells are also normalized, which is harmless,
+     since they are zeroed by zero_grid_tally() before the next sample
+------------------------------------------------------------------------- */
+
+void FixAveGrid::normalize_atom_tally()
+{
+  int m,n;
+  double count,norm;
+
+  double mvv2e = force->mvv2e;
+  double mv2d = force->mv2d;
+  double boltz = force->boltz;
+
+  double *prd = domain->prd;
+  double dx = prd[0]/nxgrid;
+  double dy = prd[1]/nygrid;
+  double dz = prd[2]/nzgrid;
+
+  double binvol;
+  if (dimension == 2) binvol = dx*dy;
+  else binvol = dx*dy*dz;
+
+  double density_number_norm = 1.0 / binvol;
+  double density_mass_norm = mv2d / binvol;
+
+  double *cgrid,*dgrid,*values;
+
+  if (dimension == 2) {
+    cgrid = &grid_sample->count2d[nylo_out][nxlo_out];
+    if (nvalues == 1) dgrid = &grid_sample->vec2d[nylo_out][nxlo_out];
+    else dgrid = &grid_sample->array2d[nylo_out][nxlo_out][0];
+  } else {
+    cgrid = &grid_sample->count3d[nzlo_out][nylo_out][nxlo_out];
+    if (nvalues == 1) dgrid = &grid_sample->vec3d[nzlo_out][nylo_out][nxlo_out];
+    else dgrid = &grid_sample->array3d[nzlo_out][nylo_out][nxlo_out][0];
+  }
+
+  if (nvalues == 1) {
+    for (n = 0; n < ntally; n++) {
+      count = cgrid[tally[n]];
+      if (count) {
+        if (which[0] == ArgInfo::DENSITY_NUMBER)
+          norm = density_number_norm;
+        else if (which[0] == ArgInfo::DENSITY_MASS)
+          norm = density_mass_norm;
+        else if (which[0] == ArgInfo::TEMPERATURE)
+          norm = mvv2e / ((cdof + adof*count) * boltz);
+        else
+          norm = 1.0/count;
+        dgrid[tally[n]] *= norm;
+      }
+    }
+
+  } else {
+    for (n = 0; n < ntally; n++) {
+      count = cgrid[tally[n]];
+      if (count) {
+        values = &dgrid[nvalues*tally[n]];
+        for (m = 0; m < nvalues; m++) {
+          if (which[m] == ArgInfo::DENSITY_NUMBER)
+            norm = density_number_norm;
+          else if (which[m] == ArgInfo::DENSITY_MASS)
+            norm = density_mass_norm;
+          else if (which[m] == ArgInfo::TEMPERATURE)
+            norm = mvv2e / ((cdof + adof*count) * boltz);
+          else
+            norm = 1.0/count;
+          values[m] *= norm;
+        }
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add values and counts of src grid to result grid for cells in tally list
+   same operation as add_grid() for the cells touched during one sample
+   tallied ghost cells of result grid accumulate unused values,
+     they are never read and are zeroed at the start of each Nfreq epoch
+------------------------------------------------------------------------- */
+
+void FixAveGrid::add_grid_tally(GridData *src, GridData *result)
+{
+  int m,n;
+  double *csrc,*dsrc,*cresult,*dresult,*values,*vresult;
+
+  if (dimension == 2) {
+    csrc = &src->count2d[nylo_out][nxlo_out];
+    cresult = &result->count2d[nylo_out][nxlo_out];
+    if (nvalues == 1) {
+      dsrc = &src->vec2d[nylo_out][nxlo_out];
+      dresult = &result->vec2d[nylo_out][nxlo_out];
+    } else {
+      dsrc = &src->array2d[nylo_out][nxlo_out][0];
+      dresult = &result->array2d[nylo_out][nxlo_out][0];
+    }
+  } else {
+    csrc = &src->count3d[nzlo_out][nylo_out][nxlo_out];
+    cresult = &result->count3d[nzlo_out][nylo_out][nxlo_out];
+    if (nvalues == 1) {
+      dsrc = &src->vec3d[nzlo_out][nylo_out][nxlo_out];
+      dresult = &result->vec3d[nzlo_out][nylo_out][nxlo_out];
+    } else {
+      dsrc = &src->array3d[nzlo_out][nylo_out][nxlo_out][0];
+      dresult = &result->array3d[nzlo_out][nylo_out][nxlo_out][0];
+    }
+  }
+
+  if (nvalues == 1) {
+    for (n = 0; n < ntally; n++) {
+      cresult[tally[n]] += csrc[tally[n]];
+      dresult[tally[n]] += dsrc[tally[n]];
+    }
+  } else {
+    for (n = 0; n < ntally; n++) {
+      cresult[tally[n]] += csrc[tally[n]];
+      values = &dsrc[nvalues*tally[n]];
+      vresult = &dresult[nvalues*tally[n]];
+      for (m = 0; m < nvalues; m++)
+        vresult[m] += values[m];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   zero values and counts of grid for cells in tally list
+   same operation as zero_grid() since only tallied cells are non-zero
+   also reset tally list for next sample
+------------------------------------------------------------------------- */
+
+void FixAveGrid::zero_grid_tally(GridData *grid)
+{
+  int m,n;
+  double *cgrid,*dgrid,*values;
+
+  if (dimension == 2) {
+    cgrid = &grid->count2d[nylo_out][nxlo_out];
+    if (nvalues == 1) dgrid = &grid->vec2d[nylo_out][nxlo_out];
+    else dgrid = &grid->array2d[nylo_out][nxlo_out][0];
+  } else {
+    cgrid = &grid->count3d[nzlo_out][nylo_out][nxlo_out];
+    if (nvalues == 1) dgrid = &grid->vec3d[nzlo_out][nylo_out][nxlo_out];
+    else dgrid = &grid->array3d[nzlo_out][nylo_out][nxlo_out][0];
+  }
+
+  if (nvalues == 1) {
+    for (n = 0; n < ntally; n++) {
+      cgrid[tally[n]] = 0.0;
+      dgrid[tally[n]] = 0.0;
+    }
+  } else {
+    for (n = 0; n < ntally; n++) {
+      cgrid[tally[n]] = 0.0;
+      values = &dgrid[nvalues*tally[n]];
+      for (m = 0; m < nvalues; m++)
+        values[m] = 0.0;
+    }
+  }
+
+  ntally = 0;
+}
+
 /* ----------------------------------------------------------------------
    set output grid pointers to src grid data
    for ATOM mode, also set pointers to per-grid count
@@ -1869,14 +2086,21 @@ void FixAveGrid::unpack_reverse_grid(int /*which*/, void *vbuf, int nlist, int *
     else data = &grid_sample->array3d[nzlo_out][nylo_out][nxlo_out][0];
   }
 
+  // if tally list is in use, tally an owned cell which becomes non-empty
+  //   only due to a remote ghost contribution
+
   m = 0;
   if (nvalues == 1) {
     for (i = 0; i < nlist; i++) {
+      if (ntally >= 0 && count[list[i]] == 0.0 && buf[m] != 0.0)
+        tally_cell(list[i]);
       count[list[i]] += buf[m++];
       data[list[i]] += buf[m++];
     }
   } else {
     for (i = 0; i < nlist; i++) {
+      if (ntally >= 0 && count[list[i]] == 0.0 && buf[m] != 0.0)
+        tally_cell(list[i]);
       count[list[i]] += buf[m++];
       values = &data[nvalues*list[i]];
       for (j = 0; j < nvalues; j++)
@@ -2048,6 +2272,11 @@ void FixAveGrid::reset_grid()
                            grid_buf1,grid_buf2,MPI_DOUBLE);
   }
 
+  // disable tally list until start of next Nfreq epoch
+  // its cell offsets are not valid for the new grid decomposition
+
+  ntally = -1;
+
   // deallocate local comm buffers b/c new ones will be allocated
 
   memory->destroy(grid_buf1);
@@ -2247,6 +2476,7 @@ double FixAveGrid::memory_usage()
   if (modeatom) {
     bytes += sizeof(int) * maxatom * dimension;   // bin array
     bytes += sizeof(int) * maxatom;               // skip vector
+    bytes += sizeof(int) * maxtally;              // tally list
     bytes += sizeof(double) * maxvar;             // vresult for per-atom variable
   }
 
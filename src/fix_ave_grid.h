@@ -101,6 +101,14 @@ class FixAveGrid : public Fix {
   int *skip;
   int maxatom;
 
+  // for ATOM mode with norm = SAMPLE
+  // list of grid_sample cells (owned+ghost) touched during current sample
+  // stored as flattened offsets into contiguous grid data arrays
+  // ntally = -1 if list is not in use, e.g. after grid remap mid-window
+
+  int *tally;
+  int ntally, maxtally;
+
   double *vresult;
   int maxvar;
 
@@ -126,6 +134,11 @@ class FixAveGrid : public Fix {
   void subtract_grid(GridData *, GridData *);
   void output_grid(GridData *);
 
+  void tally_cell(int);
+  void normalize_atom_tally();
+  void add_grid_tally(GridData *, GridData *);
+  void zero_grid_tally(GridData *);
+
   bigint nextvalid();
 };
 
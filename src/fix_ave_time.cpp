@@ -129,6 +129,8 @@ FixAveTime::FixAveTime(LAMMPS *lmp, int narg, char **arg) :
     error->all(FLERR,"Inconsistent fix ave/time nevery/nrepeat/nfreq values");
   if (ave != RUNNING && overwrite)
     error->all(FLERR,"Fix ave/time overwrite keyword requires ave running setting");
+  if (asyncflag && overwrite)
+    error->all(FLERR,"Fix ave/time async keyword is incompatible with overwrite");
 
   for (auto &val : values) {
 
@@ -431,6 +433,7 @@ FixAveTime::~FixAveTime()
   delete[] extlist;
 
   if (fp && comm->me == 0) {
+    write_wait();
     if (yaml_flag) fputs("...\n", fp);
     fclose(fp);
   }
@@ -639,31 +642,32 @@ void FixAveTime::invoke_scalar(bigint ntimestep)
   // output result to file
 
   if (fp && comm->me == 0) {
-    clearerr(fp);
-    if (overwrite) (void) platform::fseek(fp,filepos);
+
+    // format the output into a string, then write it synchronously or
+    //   hand it to the helper thread, see write_or_stage()
+
+    std::string text;
     if (yaml_flag) {
       if (!yaml_header || overwrite) {
         yaml_header = true;
-        fputs("keywords: ['Step', ", fp);
-        for (const auto &val : values) fmt::print(fp, "'{}', ", val.keyword);
-        fputs("]\ndata:\n", fp);
+        text += "keywords: ['Step', ";
+        for (const auto &val : values) text += fmt::format("'{}', ", val.keyword);
+        text += "]\ndata:\n";
       }
-      fmt::print(fp, "  - [{}, ", ntimestep);
-      for (i = 0; i < nvalues; i++) fmt::print(fp,"{}, ",vector_total[i]/norm);
-      fputs("]\n", fp);
+      text += fmt::format("  - [{}, ", ntimestep);
+      for (i = 0; i < nvalues; i++) text += fmt::format("{}, ",vector_total[i]/norm);
+      text += "]\n";
     } else {
-      fmt::print(fp,"{}",ntimestep);
-      for (i = 0; i < nvalues; i++) fprintf(fp,format,vector_total[i]/norm);
-      fprintf(fp,"\n");
-      if (ferror(fp)) error->one(FLERR,"Error writing out time averaged data");
+      char fbuf[64];
+      text += fmt::format("{}",ntimestep);
+      for (i = 0; i < nvalues; i++) {
+        snprintf(fbuf,sizeof(fbuf),format,vector_total[i]/norm);
+        text += fbuf;
+      }
+      text += "\n";
     }
-    fflush(fp);
 
-    if (overwrite) {
-      bigint fileend = platform::ftell(fp);
-      if ((fileend > 0) && (platform::ftruncate(fp,fileend)))
-        error->warning(FLERR,"Error while tuncating output: {}", utils::getsyserror());
-    }
+    write_or_stage(text);
   }
 }
 
@@ -855,37 +859,99 @@ void FixAveTime::invoke_vector(bigint ntimestep)
   // output result to file
 
   if (fp && comm->me == 0) {
-    if (overwrite) platform::fseek(fp,filepos);
+
+    // format the output into a string, then write it synchronously or
+    //   hand it to the helper thread, see write_or_stage()
+
+    std::string text;
     if (yaml_flag) {
       if (!yaml_header || overwrite) {
         yaml_header = true;
-        fputs("keywords: [", fp);
-        for (const auto &val : values) fmt::print(fp, "'{}', ", val.keyword);
-        fputs("]\ndata:\n", fp);
+        text += "keywords: [";
+        for (const auto &val : values) text += fmt::format("'{}', ", val.keyword);
+        text += "]\ndata:\n";
       }
-      fmt::print(fp, "  {}:\n", ntimestep);
+      text += fmt::format("  {}:\n", ntimestep);
       for (int i = 0; i < nrows; i++) {
-        fputs("  - [", fp);
-        for (int j = 0; j < nvalues; j++) fmt::print(fp,"{}, ",array_total[i][j]/norm);
-        fputs("]\n", fp);
+        text += "  - [";
+        for (int j = 0; j < nvalues; j++) text += fmt::format("{}, ",array_total[i][j]/norm);
+        text += "]\n";
       }
     } else {
-      fmt::print(fp,"{} {}\n",ntimestep,nrows);
+      char fbuf[64];
+      text += fmt::format("{} {}\n",ntimestep,nrows);
       for (int i = 0; i < nrows; i++) {
-        fprintf(fp,"%d",i+1);
-        for (int j = 0; j < nvalues; j++) fprintf(fp,format,array_total[i][j]/norm);
-        fprintf(fp,"\n");
+        text += fmt::format("{}",i+1);
+        for (int j = 0; j < nvalues; j++) {
+          snprintf(fbuf,sizeof(fbuf),format,array_total[i][j]/norm);
+          text += fbuf;
+        }
+        text += "\n";
       }
     }
-    fflush(fp);
-    if (overwrite) {
-      bigint fileend = platform::ftell(fp);
-      if ((fileend > 0) && (platform::ftruncate(fp,fileend)))
-        error->warning(FLERR,"Error while tuncating output: {}", utils::getsyserror());
-    }
+
+    write_or_stage(text);
   }
 }
 
+/* ----------------------------------------------------------------------
+   write formatted output text to the file, only called on proc 0
+   sync: write, flush and error check in place, as before
+   async: stage the text and write/flush it on a helper thread, so the
+     file I/O overlaps subsequent timesteps; a still-running write of
+     the previous epoch is joined first and its error surfaced
+------------------------------------------------------------------------- */
+
+void FixAveTime::write_or_stage(std::string &text)
+{
+  if (asyncflag) {
+    write_wait();
+    asyncbuf = std::move(text);
+    athread = new std::thread(&FixAveTime::write_async, this);
+    return;
+  }
+
+  clearerr(fp);
+  if (overwrite) (void) platform::fseek(fp,filepos);
+  fwrite(text.data(),1,text.size(),fp);
+  if (ferror(fp)) error->one(FLERR,"Error writing out time averaged data");
+  fflush(fp);
+
+  if (overwrite) {
+    bigint fileend = platform::ftell(fp);
+    if ((fileend > 0) && (platform::ftruncate(fp,fileend)))
+      error->warning(FLERR,"Error while tuncating output: {}", utils::getsyserror());
+  }
+}
+
+/* ----------------------------------------------------------------------
+   wait for a helper-thread write to finish, then surface its error
+   no-op if no write is in flight
+------------------------------------------------------------------------- */
+
+void FixAveTime::write_wait()
+{
+  if (!athread) return;
+  athread->join();
+  delete athread;
+  athread = nullptr;
+  if (asyncerror) error->one(FLERR,"Error writing out time averaged data");
+}
+
+/* ----------------------------------------------------------------------
+   write the staged text, runs on the helper thread
+   no MPI calls and no Error calls are allowed here: a failure is
+   recorded and raised at the next write_wait()
+------------------------------------------------------------------------- */
+
+void FixAveTime::write_async()
+{
+  clearerr(fp);
+  fwrite(asyncbuf.data(),1,asyncbuf.size(),fp);
+  fflush(fp);
+  if (ferror(fp)) asyncerror = 1;
+}
+
 /* ----------------------------------------------------------------------
    return scalar value
 ------------------------------------------------------------------------- */
@@ -1024,6 +1090,9 @@ void FixAveTime::options(int iarg, int narg, char **arg)
   noff = 0;
   offlist = nullptr;
   overwrite = 0;
+  asyncflag = 0;
+  athread = nullptr;
+  asyncerror = 0;
   yaml_flag = yaml_header = false;
   format_user = nullptr;
   format = (char *) " %g";
@@ -1078,6 +1147,10 @@ void FixAveTime::options(int iarg, int narg, char **arg)
     } else if (strcmp(arg[iarg],"overwrite") == 0) {
       overwrite = 1;
       iarg += 1;
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "fix ave/time async", error);
+      asyncflag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
     } else if (strcmp(arg[iarg],"format") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "fix ave/time format", error);
       delete[] format_user;
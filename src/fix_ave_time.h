@@ -23,6 +23,7 @@ FixStyle(ave/time,FixAveTime);
 #include "fix.h"
 
 #include <map>
+#include <thread>
 
 namespace LAMMPS_NS {
 
@@ -67,6 +68,12 @@ class FixAveTime : public Fix {
 
   int ave, nwindow, startstep, mode;
   int noff, overwrite;
+
+  int asyncflag;           // 1 if file output is written on a helper thread
+  std::thread *athread;    // thread writing the staged text, null if idle
+  std::string asyncbuf;    // staged formatted output for the helper thread
+  int asyncerror;          // set by the helper thread on a write error
+
   int *offlist;
   char *format, *format_user;
   char *title1, *title2, *title3;
@@ -86,6 +93,9 @@ class FixAveTime : public Fix {
   int column_length(int);
   void invoke_scalar(bigint);
   void invoke_vector(bigint);
+  void write_or_stage(std::string &);
+  void write_wait();
+  void write_async();
   void options(int, int, char **);
   void allocate_arrays();
   bigint nextvalid();
@@ -255,6 +255,22 @@ void FixExternal::set_virial_peratom(double **caller_virial)
       vatom[i][j] = caller_virial[i][j];
 }
 
+/* ----------------------------------------------------------------------
+   caller invokes this method to set all its energy/virial contributions
+   in one call, typically from within the callback function.
+   a null pointer skips the corresponding quantity.  semantics of each
+   quantity are identical to the individual set methods above.
+------------------------------------------------------------------------- */
+
+void FixExternal::set_results(double caller_energy, double *caller_virial,
+                              double *caller_energy_peratom, double **caller_virial_peratom)
+{
+  set_energy_global(caller_energy);
+  if (caller_virial) set_virial_global(caller_virial);
+  if (caller_energy_peratom) set_energy_peratom(caller_energy_peratom);
+  if (caller_virial_peratom) set_virial_peratom(caller_virial_peratom);
+}
+
 /* ----------------------------------------------------------------------
    caller invokes this method to set length of global vector of values
    assume all vector values are extensive.
@@ -45,6 +45,7 @@ class FixExternal : public Fix {
   void set_virial_global(double *);
   void set_energy_peratom(double *);
   void set_virial_peratom(double **);
+  void set_results(double, double *, double *, double **);
   void set_vector_length(int);
   void set_vector(int, double);
 
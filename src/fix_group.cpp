@@ -21,6 +21,7 @@
 #include "input.h"
 #include "memory.h"
 #include "modify.h"
+#include "neighbor.h"
 #include "region.h"
 #include "respa.h"
 #include "update.h"
@@ -34,7 +35,8 @@ using namespace FixConst;
 /* ---------------------------------------------------------------------- */
 
 FixGroup::FixGroup(LAMMPS *lmp, int narg, char **arg) :
-    Fix(lmp, narg, arg), idregion(nullptr), idvar(nullptr), idprop(nullptr), region(nullptr)
+    Fix(lmp, narg, arg), idregion(nullptr), idvar(nullptr), idprop(nullptr), region(nullptr),
+    gatex(nullptr), gatedist(nullptr)
 {
   // dgroupbit = bitmask of dynamic group
   // group ID is last part of fix ID
@@ -94,12 +96,30 @@ FixGroup::FixGroup(LAMMPS *lmp, int narg, char **arg) :
     } else
       error->all(FLERR, "Unknown keyword {} in dynamic group command", arg[iarg]);
   }
+
+  // per-atom arrays for displacement-gated region tests
+  // only useful for purely region-based dynamic groups
+
+  gateflag = regionflag && !varflag && !propflag;
+  gatevalid = 0;
+
+  if (gateflag) {
+    FixGroup::grow_arrays(atom->nmax);
+    atom->add_callback(Atom::GROW);
+    for (int i = 0; i < atom->nlocal; i++) gatedist[i] = 0.0;
+  }
 }
 
 /* ---------------------------------------------------------------------- */
 
 FixGroup::~FixGroup()
 {
+  if (gateflag) {
+    atom->delete_callback(id, Atom::GROW);
+    memory->destroy(gatex);
+    memory->destroy(gatedist);
+  }
+
   delete[] idregion;
   delete[] idvar;
   delete[] idprop;
@@ -150,6 +170,11 @@ void FixGroup::init()
       error->all(FLERR, "Custom per-atom property vector {} for dynamic group {} does not exist",
                  idprop, dyngroup);
   }
+
+  // discard stored boundary distances:
+  // region may have been redefined between runs
+
+  gatevalid = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -209,6 +234,26 @@ void FixGroup::set_group()
 
   if (regionflag) region->prematch();
 
+  // displacement gating of region tests:
+  // an atom whose displacement since its last test is smaller than its
+  //   stored distance to the region surface cannot have changed side,
+  //   so its group membership is unchanged and the test is skipped
+  // requires a static closed region: a moving/resizing boundary or an
+  //   open face invalidates stored distances without atom motion
+  // gateskip = 1 if stored distances may be used to skip tests this sweep
+  // gatecut caps stored distances: atoms farther from the surface than
+  //   the neighbor skin must move at least that far to need a re-test
+
+  int gateskip = 0;
+  double gatecut = 0.0;
+
+  if (gateflag && !region->dynamic && !region->varshape && !region->openflag) {
+    gateskip = gatevalid;
+    gatecut = neighbor->skin;
+    gatevalid = 1;
+  } else
+    gatevalid = 0;
+
   // set mask for each atom
   // only in group if in parent group, in region, variable is non-zero
 
@@ -218,6 +263,12 @@ void FixGroup::set_group()
 
   for (int i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
+      if (gateskip) {
+        const double dx = x[i][0] - gatex[i][0];
+        const double dy = x[i][1] - gatex[i][1];
+        const double dz = x[i][2] - gatex[i][2];
+        if (dx * dx + dy * dy + dz * dz < gatedist[i] * gatedist[i]) continue;
+      }
       inflag = 1;
       if (regionflag && !region->match(x[i][0], x[i][1], x[i][2])) inflag = 0;
       if (varflag && var[i] == 0.0) inflag = 0;
@@ -225,6 +276,12 @@ void FixGroup::set_group()
         if (!proptype && ivector[i] == 0) inflag = 0;
         if (proptype && dvector[i] == 0.0) inflag = 0;
       }
+      if (gatevalid) {
+        gatedist[i] = region->boundary_distance(x[i], gatecut);
+        gatex[i][0] = x[i][0];
+        gatex[i][1] = x[i][1];
+        gatex[i][2] = x[i][2];
+      }
     } else
       inflag = 0;
 
@@ -272,6 +329,74 @@ void FixGroup::unpack_forward_comm(int n, int first, double *buf)
   for (i = first; i < last; i++) mask[i] = (int) ubuf(buf[m++]).i;
 }
 
+/* ----------------------------------------------------------------------
+   allocate atom-based arrays for displacement gating
+------------------------------------------------------------------------- */
+
+void FixGroup::grow_arrays(int nmax)
+{
+  memory->grow(gatex, nmax, 3, "fix/group:gatex");
+  memory->grow(gatedist, nmax, "fix/group:gatedist");
+}
+
+/* ----------------------------------------------------------------------
+   copy values within local atom-based arrays
+------------------------------------------------------------------------- */
+
+void FixGroup::copy_arrays(int i, int j, int /*delflag*/)
+{
+  gatex[j][0] = gatex[i][0];
+  gatex[j][1] = gatex[i][1];
+  gatex[j][2] = gatex[i][2];
+  gatedist[j] = gatedist[i];
+}
+
+/* ----------------------------------------------------------------------
+   initialize one atom's array values, called when atom is created
+   zero distance forces a region test at the next sweep
+------------------------------------------------------------------------- */
+
+void FixGroup::set_arrays(int i)
+{
+  gatedist[i] = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   pack values in local atom-based arrays for exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixGroup::pack_exchange(int i, double *buf)
+{
+  buf[0] = gatex[i][0];
+  buf[1] = gatex[i][1];
+  buf[2] = gatex[i][2];
+  buf[3] = gatedist[i];
+  return 4;
+}
+
+/* ----------------------------------------------------------------------
+   unpack values in local atom-based arrays from exchange with another proc
+------------------------------------------------------------------------- */
+
+int FixGroup::unpack_exchange(int nlocal, double *buf)
+{
+  gatex[nlocal][0] = buf[0];
+  gatex[nlocal][1] = buf[1];
+  gatex[nlocal][2] = buf[2];
+  gatedist[nlocal] = buf[3];
+  return 4;
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based arrays
+------------------------------------------------------------------------- */
+
+double FixGroup::memory_usage()
+{
+  if (!gateflag) return 0.0;
+  return (double) atom->nmax * 4 * sizeof(double);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void *FixGroup::extract(const char *str, int & /*unused*/)
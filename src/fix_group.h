@@ -35,6 +35,12 @@ class FixGroup : public Fix {
   void post_force_respa(int, int, int) override;
   int pack_forward_comm(int, int *, double *, int, int *) override;
   void unpack_forward_comm(int, int, double *) override;
+  void grow_arrays(int) override;
+  void copy_arrays(int, int, int) override;
+  void set_arrays(int) override;
+  int pack_exchange(int, double *) override;
+  int unpack_exchange(int, double *) override;
+  double memory_usage() override;
   void *extract(const char *, int &) override;
 
  private:
@@ -44,6 +50,11 @@ class FixGroup : public Fix {
   char *idregion, *idvar, *idprop;
   class Region *region;
 
+  int gateflag;         // 1 if per-atom arrays for displacement gating exist
+  int gatevalid;        // 1 if stored boundary distances are current
+  double **gatex;       // coords of each atom at its last region test
+  double *gatedist;     // lower bound on distance from gatex to region surface
+
   int nlevels_respa;
 
   void set_group();
@@ -20,7 +20,9 @@
 #include "input.h"
 #include "modify.h"
 #include "neighbor.h"
+#include "output.h"
 #include "timer.h"
+#include "universe.h"
 #include "update.h"
 #include "variable.h"
 
@@ -35,6 +37,10 @@ enum { LT, LE, GT, GE, EQ, NEQ, XOR };
 enum { HARD, SOFT, CONTINUE };
 enum { NOMSG = 0, YESMSG = 1 };
 
+// weight of the most recent check interval in the per-step cost average
+
+static constexpr double EWMA_ALPHA = 0.5;
+
 /* ---------------------------------------------------------------------- */
 
 FixHalt::FixHalt(LAMMPS *lmp, int narg, char **arg) :
@@ -90,6 +96,9 @@ FixHalt::FixHalt(LAMMPS *lmp, int narg, char **arg) :
 
   eflag = SOFT;
   msgflag = YESMSG;
+  dumpflag = 0;
+  restartflag = 0;
+  universeflag = 0;
   ++iarg;
   while (iarg < narg) {
     if (strcmp(arg[iarg], "error") == 0) {
@@ -103,6 +112,18 @@ FixHalt::FixHalt(LAMMPS *lmp, int narg, char **arg) :
       if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix halt message", error);
       msgflag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
       iarg += 2;
+    } else if (strcmp(arg[iarg], "dump") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix halt dump", error);
+      dumpflag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "restart") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix halt restart", error);
+      restartflag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg], "universe") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix halt universe", error);
+      universeflag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
+      iarg += 2;
     } else if (strcmp(arg[iarg], "path") == 0) {
       if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "fix halt error", error);
       ++iarg;
@@ -120,6 +141,9 @@ FixHalt::FixHalt(LAMMPS *lmp, int narg, char **arg) :
   }
   // clang-format on
 
+  if (universeflag && attribute != TLIMIT)
+    error->all(FLERR, "Fix halt universe yes requires the tlimit attribute");
+
   // add nfirst to all computes that store invocation times
   // since don't know a priori which are invoked via variables by this fix
   // once in end_of_step() can set timestep for ones actually invoked
@@ -167,6 +191,9 @@ void FixHalt::init()
   nextstep = (update->ntimestep / nevery) * nevery + nevery;
   thisstep = -1;
   tratio = 0.5;
+  step_cost = 0.0;
+  cpu_last = 0.0;
+  step_last = update->ntimestep;
 
   // check if disk limit is supported
 
@@ -174,6 +201,11 @@ void FixHalt::init()
     if (!dlimit_path || platform::disk_free(dlimit_path) < 0.0)
       error->all(FLERR, "Disk limit not supported by OS or illegal path");
   }
+
+  // triggered restart files require the restart command
+
+  if (restartflag && !output->restart_flag)
+    error->all(FLERR, "Fix halt restart yes requires restart files to be defined");
 }
 
 /* ---------------------------------------------------------------------- */
@@ -228,6 +260,13 @@ void FixHalt::end_of_step()
     if ((attvalue == 0.0 && value == 0.0) || (attvalue != 0.0 && value != 0.0)) return;
   }
 
+  // capture the triggering configuration before halting, if requested:
+  // force a snapshot for all defined dumps and/or a restart file
+  // same forced-output path as PRD and TAD use for detected events
+
+  if (dumpflag) output->write_dump(update->ntimestep);
+  if (restartflag) output->write_restart(update->ntimestep);
+
   // hard halt -> exit LAMMPS
   // soft/continue halt -> trigger timer to break from run loop
   // print message with ID of fix halt in case multiple instances
@@ -286,23 +325,54 @@ double FixHalt::bondmax()
 }
 
 /* ----------------------------------------------------------------------
-   compute synced elapsed time
-   reset nextstep = estimate of timestep when run will end
-   first project to 1/2 the run time, thereafter to end of run
+   compute synced elapsed time and predict when the time limit is hit
+   keep an exponential moving average of the recent per-step cost and
+     return the wall time projected for the next halt opportunity, so
+     the run stops on the last multiple of Nevery that still fits in
+     the budget instead of the first one past it, leaving time for a
+     final dump/restart within the budget
+   reset nextstep = estimate of timestep when the limit will be reached
+   first project to 1/2 the remaining time, thereafter to the limit
 ------------------------------------------------------------------------- */
 
 double FixHalt::tlimit()
 {
   double cpu = timer->elapsed(Timer::TOTAL);
-  MPI_Bcast(&cpu, 1, MPI_DOUBLE, 0, world);
 
-  if (cpu < value) {
-    bigint elapsed = update->ntimestep - update->firststep;
-    bigint final = update->firststep + static_cast<bigint>(tratio * value / cpu * elapsed);
-    nextstep = (final / nevery) * nevery + nevery;
-    if (nextstep == update->ntimestep) nextstep += nevery;
-    tratio = 1.0;
+  // for universe = yes, all partitions agree on the slowest clock,
+  //   so they all halt their runs on the same step
+
+  if (universeflag && universe->nworlds > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &cpu, 1, MPI_DOUBLE, MPI_MAX, universe->uworld);
+  else
+    MPI_Bcast(&cpu, 1, MPI_DOUBLE, 0, world);
+
+  // blend the cost of the steps since the last check into the average,
+  //   seeded with the mean over the whole run so far
+
+  bigint elapsed = update->ntimestep - update->firststep;
+  if (elapsed > 0 && cpu > 0.0) {
+    if (step_cost == 0.0) step_cost = cpu / elapsed;
+    if (update->ntimestep > step_last && cpu > cpu_last) {
+      double recent = (cpu - cpu_last) / (update->ntimestep - step_last);
+      step_cost = EWMA_ALPHA * recent + (1.0 - EWMA_ALPHA) * step_cost;
+    }
   }
+  cpu_last = cpu;
+  step_last = update->ntimestep;
+
+  // predicted = wall time when the next halt opportunity is reached
+
+  double predicted = cpu + nevery * step_cost;
+
+  if (predicted < value && step_cost > 0.0) {
+    bigint ahead = static_cast<bigint>(tratio * ((value - cpu) / step_cost - nevery));
+    if (ahead < nevery) ahead = nevery;
+    nextstep = ((update->ntimestep + ahead) / nevery) * nevery;
+    if (nextstep <= update->ntimestep) nextstep = update->ntimestep + nevery;
+    tratio = 1.0;
+  } else
+    nextstep = update->ntimestep + nevery;
 
-  return cpu;
+  return predicted;
 }
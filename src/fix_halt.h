@@ -36,8 +36,9 @@ class FixHalt : public Fix {
 
  private:
   int attribute, operation, eflag, msgflag, ivar;
-  bigint nextstep, thisstep;
-  double value, tratio;
+  int dumpflag, restartflag, universeflag;
+  bigint nextstep, thisstep, step_last;
+  double value, tratio, step_cost, cpu_last;
   char *idvar;
   char *dlimit_path;
 
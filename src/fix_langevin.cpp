@@ -32,7 +32,7 @@
 #include "math_extra.h"
 #include "memory.h"
 #include "modify.h"
-#include "random_mars.h"
+#include "random_counter.h"
 #include "respa.h"
 #include "update.h"
 #include "variable.h"
@@ -80,9 +80,11 @@ FixLangevin::FixLangevin(LAMMPS *lmp, int narg, char **arg) :
   if (t_period <= 0.0) error->all(FLERR, "Fix langevin period must be > 0.0");
   if (seed <= 0) error->all(FLERR, "Illegal fix langevin command");
 
-  // initialize Marsaglia RNG with processor-unique seed
+  // initialize counter-based RNG with the same seed on all procs
+  // noise is keyed on (timestep,atom ID), so it is independent of the
+  //   processor count and needs no processor-unique seed offset
 
-  random = new RanMars(lmp, seed + comm->me);
+  random = new RanCounter(lmp, seed);
 
   // allocate per-type arrays for force prefactors
 
@@ -223,6 +225,9 @@ int FixLangevin::setmask()
 
 void FixLangevin::init()
 {
+  if (atom->tag_enable == 0)
+    error->all(FLERR, "Fix langevin requires atoms have IDs");
+
   if (gjfflag) {
     if (t_period * 2 == update->dt)
       error->all(FLERR, "Fix langevin gjf cannot have t_period equal to dt/2");
@@ -581,9 +586,11 @@ void FixLangevin::post_force_templated()
   double **v = atom->v;
   double **f = atom->f;
   double *rmass = atom->rmass;
+  tagint *tag = atom->tag;
   int *type = atom->type;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
+  bigint step = update->ntimestep;
 
   // apply damping and thermostat to atoms in group
 
@@ -654,13 +661,13 @@ void FixLangevin::post_force_templated()
       }
 
       if (Tp_GJF) {
-        fran[0] = gamma2*random->gaussian();
-        fran[1] = gamma2*random->gaussian();
-        fran[2] = gamma2*random->gaussian();
+        fran[0] = gamma2*random->gaussian(step,tag[i],0);
+        fran[1] = gamma2*random->gaussian(step,tag[i],1);
+        fran[2] = gamma2*random->gaussian(step,tag[i],2);
       } else {
-        fran[0] = gamma2*(random->uniform()-0.5);
-        fran[1] = gamma2*(random->uniform()-0.5);
-        fran[2] = gamma2*(random->uniform()-0.5);
+        fran[0] = gamma2*(random->uniform(step,tag[i],0)-0.5);
+        fran[1] = gamma2*(random->uniform(step,tag[i],1)-0.5);
+        fran[2] = gamma2*(random->uniform(step,tag[i],2)-0.5);
       }
 
       if (Tp_BIAS) {
@@ -825,9 +832,11 @@ void FixLangevin::omega_thermostat()
   double **omega = atom->omega;
   double *radius = atom->radius;
   double *rmass = atom->rmass;
+  tagint *tag = atom->tag;
   int *mask = atom->mask;
   int *type = atom->type;
   int nlocal = atom->nlocal;
+  bigint step = update->ntimestep;
 
   // rescale gamma1/gamma2 by 10/3 & sqrt(10/3) for spherical particles
   // does not affect rotational thermosatting
@@ -845,9 +854,9 @@ void FixLangevin::omega_thermostat()
       gamma2 = sqrt(inertiaone) * sqrt(80.0*boltz/t_period/dt/mvv2e) / ftm2v;
       gamma1 *= 1.0/ratio[type[i]];
       gamma2 *= 1.0/sqrt(ratio[type[i]]) * tsqrt;
-      tran[0] = gamma2*(random->uniform()-0.5);
-      tran[1] = gamma2*(random->uniform()-0.5);
-      tran[2] = gamma2*(random->uniform()-0.5);
+      tran[0] = gamma2*(random->uniform(step,tag[i],3)-0.5);
+      tran[1] = gamma2*(random->uniform(step,tag[i],4)-0.5);
+      tran[2] = gamma2*(random->uniform(step,tag[i],5)-0.5);
       torque[i][0] += gamma1*omega[i][0] + tran[0];
       torque[i][1] += gamma1*omega[i][1] + tran[1];
       torque[i][2] += gamma1*omega[i][2] + tran[2];
@@ -872,10 +881,12 @@ void FixLangevin::angmom_thermostat()
   double **torque = atom->torque;
   double **angmom = atom->angmom;
   double *rmass = atom->rmass;
+  tagint *tag = atom->tag;
   int *ellipsoid = atom->ellipsoid;
   int *mask = atom->mask;
   int *type = atom->type;
   int nlocal = atom->nlocal;
+  bigint step = update->ntimestep;
 
   // rescale gamma1/gamma2 by ascale for aspherical particles
   // does not affect rotational thermosatting
@@ -899,9 +910,9 @@ void FixLangevin::angmom_thermostat()
       gamma2 = sqrt(ascale*24.0*boltz/t_period/dt/mvv2e) / ftm2v;
       gamma1 *= 1.0/ratio[type[i]];
       gamma2 *= 1.0/sqrt(ratio[type[i]]) * tsqrt;
-      tran[0] = sqrt(inertia[0])*gamma2*(random->uniform()-0.5);
-      tran[1] = sqrt(inertia[1])*gamma2*(random->uniform()-0.5);
-      tran[2] = sqrt(inertia[2])*gamma2*(random->uniform()-0.5);
+      tran[0] = sqrt(inertia[0])*gamma2*(random->uniform(step,tag[i],3)-0.5);
+      tran[1] = sqrt(inertia[1])*gamma2*(random->uniform(step,tag[i],4)-0.5);
+      tran[2] = sqrt(inertia[2])*gamma2*(random->uniform(step,tag[i],5)-0.5);
       torque[i][0] += inertia[0]*gamma1*omega[0] + tran[0];
       torque[i][1] += inertia[1]*gamma1*omega[1] + tran[1];
       torque[i][2] += inertia[2]*gamma1*omega[2] + tran[2];
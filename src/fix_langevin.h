@@ -70,7 +70,7 @@ class FixLangevin : public Fix {
   class Compute *temperature;
 
   int nlevels_respa;
-  class RanMars *random;
+  class RanCounter *random;
   int seed;
 
   template <int Tp_TSTYLEATOM, int Tp_GJF, int Tp_TALLY, int Tp_BIAS, int Tp_RMASS, int Tp_ZERO>
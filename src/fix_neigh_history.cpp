@@ -14,6 +14,7 @@
 #include "fix_neigh_history.h"
 
 #include "atom.h"
+#include "atom_vec.h"
 #include "comm.h"
 #include "error.h"
 #include "force.h"
@@ -739,6 +740,21 @@ void FixNeighHistory::copy_arrays(int i, int j, int /*delflag*/)
   valuepartner[j] = valuepartner[i];
 }
 
+/* ----------------------------------------------------------------------
+   reorder atom-based arrays in one bulk pass during atom sorting
+   gather the partner counts and chunk pointers, same pointer-copy
+     semantics as copy_arrays() since the chunks themselves stay put
+     inside ipage_atom,dpage_atom
+------------------------------------------------------------------------- */
+
+int FixNeighHistory::reorder_arrays(int nlocal, int *permute)
+{
+  atom->avec->reorder_gather(npartner, nlocal, permute);
+  atom->avec->reorder_gather(partner, nlocal, permute);
+  atom->avec->reorder_gather(valuepartner, nlocal, permute);
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    initialize one atom's array values, called when atom is created
 ------------------------------------------------------------------------- */
@@ -47,6 +47,7 @@ class FixNeighHistory : public Fix {
   double memory_usage() override;
   void grow_arrays(int) override;
   void copy_arrays(int, int, int) override;
+  int reorder_arrays(int, int *) override;
   void set_arrays(int) override;
 
   int pack_reverse_comm_size(int, int) override;
@@ -77,9 +77,14 @@ void FixNVE::initial_integrate(int /*vflag*/)
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
+  // for group all the per-atom mask test always passes: skip it so the
+  //   sweep is branch-free and vectorizes, it dominates cheap-pair runs
+
+  const int all = (igroup == 0);
+
   if (rmass) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
+    if (all) {
+      for (int i = 0; i < nlocal; i++) {
         dtfm = dtf / rmass[i];
         v[i][0] += dtfm * f[i][0];
         v[i][1] += dtfm * f[i][1];
@@ -88,10 +93,22 @@ void FixNVE::initial_integrate(int /*vflag*/)
         x[i][1] += dtv * v[i][1];
         x[i][2] += dtv * v[i][2];
       }
+    } else {
+      for (int i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          dtfm = dtf / rmass[i];
+          v[i][0] += dtfm * f[i][0];
+          v[i][1] += dtfm * f[i][1];
+          v[i][2] += dtfm * f[i][2];
+          x[i][0] += dtv * v[i][0];
+          x[i][1] += dtv * v[i][1];
+          x[i][2] += dtv * v[i][2];
+        }
+    }
 
   } else {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
+    if (all) {
+      for (int i = 0; i < nlocal; i++) {
         dtfm = dtf / mass[type[i]];
         v[i][0] += dtfm * f[i][0];
         v[i][1] += dtfm * f[i][1];
@@ -100,6 +117,18 @@ void FixNVE::initial_integrate(int /*vflag*/)
         x[i][1] += dtv * v[i][1];
         x[i][2] += dtv * v[i][2];
       }
+    } else {
+      for (int i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          dtfm = dtf / mass[type[i]];
+          v[i][0] += dtfm * f[i][0];
+          v[i][1] += dtfm * f[i][1];
+          v[i][2] += dtfm * f[i][2];
+          x[i][0] += dtv * v[i][0];
+          x[i][1] += dtv * v[i][1];
+          x[i][2] += dtv * v[i][2];
+        }
+    }
   }
 }
 
@@ -120,23 +149,43 @@ void FixNVE::final_integrate()
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
+  const int all = (igroup == 0);
+
   if (rmass) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
+    if (all) {
+      for (int i = 0; i < nlocal; i++) {
         dtfm = dtf / rmass[i];
         v[i][0] += dtfm * f[i][0];
         v[i][1] += dtfm * f[i][1];
         v[i][2] += dtfm * f[i][2];
       }
+    } else {
+      for (int i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          dtfm = dtf / rmass[i];
+          v[i][0] += dtfm * f[i][0];
+          v[i][1] += dtfm * f[i][1];
+          v[i][2] += dtfm * f[i][2];
+        }
+    }
 
   } else {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
+    if (all) {
+      for (int i = 0; i < nlocal; i++) {
         dtfm = dtf / mass[type[i]];
         v[i][0] += dtfm * f[i][0];
         v[i][1] += dtfm * f[i][1];
         v[i][2] += dtfm * f[i][2];
       }
+    } else {
+      for (int i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          dtfm = dtf / mass[type[i]];
+          v[i][0] += dtfm * f[i][0];
+          v[i][1] += dtfm * f[i][1];
+          v[i][2] += dtfm * f[i][2];
+        }
+    }
   }
 }
 
@@ -16,6 +16,7 @@
 #include "atom.h"
 #include "domain.h"
 #include "error.h"
+#include "group.h"
 #include "input.h"
 #include "memory.h"
 #include "modify.h"
@@ -218,8 +219,11 @@ void FixSetForce::post_force(int /*vflag*/)
 {
   double **x = atom->x;
   double **f = atom->f;
-  int *mask = atom->mask;
-  int nlocal = atom->nlocal;
+
+  // iterate over list of group members only, not all nlocal atoms
+
+  int nmember;
+  int *mlist = group->member_list(igroup, nmember);
 
   // update region if necessary
 
@@ -237,16 +241,16 @@ void FixSetForce::post_force(int /*vflag*/)
   force_flag = 0;
 
   if (varflag == CONSTANT) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        if (region && !region->match(x[i][0], x[i][1], x[i][2])) continue;
-        foriginal[0] += f[i][0];
-        foriginal[1] += f[i][1];
-        foriginal[2] += f[i][2];
-        if (xstyle) f[i][0] = xvalue;
-        if (ystyle) f[i][1] = yvalue;
-        if (zstyle) f[i][2] = zvalue;
-      }
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      if (region && !region->match(x[i][0], x[i][1], x[i][2])) continue;
+      foriginal[0] += f[i][0];
+      foriginal[1] += f[i][1];
+      foriginal[2] += f[i][2];
+      if (xstyle) f[i][0] = xvalue;
+      if (ystyle) f[i][1] = yvalue;
+      if (zstyle) f[i][2] = zvalue;
+    }
 
     // variable force, wrap with clear/add
 
@@ -269,25 +273,25 @@ void FixSetForce::post_force(int /*vflag*/)
 
     modify->addstep_compute(update->ntimestep + 1);
 
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        if (region && !region->match(x[i][0], x[i][1], x[i][2])) continue;
-        foriginal[0] += f[i][0];
-        foriginal[1] += f[i][1];
-        foriginal[2] += f[i][2];
-        if (xstyle == ATOM)
-          f[i][0] = sforce[i][0];
-        else if (xstyle)
-          f[i][0] = xvalue;
-        if (ystyle == ATOM)
-          f[i][1] = sforce[i][1];
-        else if (ystyle)
-          f[i][1] = yvalue;
-        if (zstyle == ATOM)
-          f[i][2] = sforce[i][2];
-        else if (zstyle)
-          f[i][2] = zvalue;
-      }
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      if (region && !region->match(x[i][0], x[i][1], x[i][2])) continue;
+      foriginal[0] += f[i][0];
+      foriginal[1] += f[i][1];
+      foriginal[2] += f[i][2];
+      if (xstyle == ATOM)
+        f[i][0] = sforce[i][0];
+      else if (xstyle)
+        f[i][0] = xvalue;
+      if (ystyle == ATOM)
+        f[i][1] = sforce[i][1];
+      else if (ystyle)
+        f[i][1] = yvalue;
+      if (zstyle == ATOM)
+        f[i][2] = sforce[i][2];
+      else if (zstyle)
+        f[i][2] = zvalue;
+    }
   }
 }
 
@@ -309,19 +313,20 @@ void FixSetForce::post_force_respa(int vflag, int ilevel, int /*iloop*/)
 
     double **x = atom->x;
     double **f = atom->f;
-    int *mask = atom->mask;
-    int nlocal = atom->nlocal;
-
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        if (region && !region->match(x[i][0], x[i][1], x[i][2])) continue;
-        foriginal_saved[0] += f[i][0];
-        foriginal_saved[1] += f[i][1];
-        foriginal_saved[2] += f[i][2];
-        if (xstyle) f[i][0] = 0.0;
-        if (ystyle) f[i][1] = 0.0;
-        if (zstyle) f[i][2] = 0.0;
-      }
+
+    int nmember;
+    int *mlist = group->member_list(igroup, nmember);
+
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      if (region && !region->match(x[i][0], x[i][1], x[i][2])) continue;
+      foriginal_saved[0] += f[i][0];
+      foriginal_saved[1] += f[i][1];
+      foriginal_saved[2] += f[i][2];
+      if (xstyle) f[i][0] = 0.0;
+      if (ystyle) f[i][1] = 0.0;
+      if (zstyle) f[i][2] = 0.0;
+    }
   }
 }
 
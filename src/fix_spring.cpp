@@ -205,32 +205,34 @@ void FixSpring::spring_tether()
   }
 
   // apply restoring force to atoms in group
+  // iterate over list of group members only, not all nlocal atoms
 
   double **f = atom->f;
-  int *mask = atom->mask;
   int *type = atom->type;
   double *mass = atom->mass;
   double *rmass = atom->rmass;
-  int nlocal = atom->nlocal;
+
+  int nmember;
+  int *mlist = group->member_list(igroup,nmember);
 
   double massone;
 
   if (rmass) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        massone = rmass[i];
-        f[i][0] -= fx*massone;
-        f[i][1] -= fy*massone;
-        f[i][2] -= fz*massone;
-      }
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      massone = rmass[i];
+      f[i][0] -= fx*massone;
+      f[i][1] -= fy*massone;
+      f[i][2] -= fz*massone;
+    }
   } else {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
-        massone = mass[type[i]];
-        f[i][0] -= fx*massone;
-        f[i][1] -= fy*massone;
-        f[i][2] -= fz*massone;
-      }
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      massone = mass[type[i]];
+      f[i][0] -= fx*massone;
+      f[i][1] -= fy*massone;
+      f[i][2] -= fz*massone;
+    }
   }
 }
 
@@ -290,43 +292,45 @@ void FixSpring::spring_couple()
   // f = -k*(r-r0)*mass/masstotal
 
   double **f = atom->f;
-  int *mask = atom->mask;
   int *type = atom->type;
   double *mass = atom->mass;
   double *rmass = atom->rmass;
-  int nlocal = atom->nlocal;
+
+  int nmember,nmember2;
+  int *mlist = group->member_list(igroup,nmember);
+  int *mlist2 = group->member_list(igroup2,nmember2);
 
   double massone;
 
   if (rmass) {
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        massone = rmass[i];
-        f[i][0] += fx*massone;
-        f[i][1] += fy*massone;
-        f[i][2] += fz*massone;
-      }
-      if (mask[i] & group2bit) {
-        massone = rmass[i];
-        f[i][0] -= fx2*massone;
-        f[i][1] -= fy2*massone;
-        f[i][2] -= fz2*massone;
-      }
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      massone = rmass[i];
+      f[i][0] += fx*massone;
+      f[i][1] += fy*massone;
+      f[i][2] += fz*massone;
+    }
+    for (int m = 0; m < nmember2; m++) {
+      const int i = mlist2[m];
+      massone = rmass[i];
+      f[i][0] -= fx2*massone;
+      f[i][1] -= fy2*massone;
+      f[i][2] -= fz2*massone;
     }
   } else {
-    for (int i = 0; i < nlocal; i++) {
-      if (mask[i] & groupbit) {
-        massone = mass[type[i]];
-        f[i][0] += fx*massone;
-        f[i][1] += fy*massone;
-        f[i][2] += fz*massone;
-      }
-      if (mask[i] & group2bit) {
-        massone = mass[type[i]];
-        f[i][0] -= fx2*massone;
-        f[i][1] -= fy2*massone;
-        f[i][2] -= fz2*massone;
-      }
+    for (int m = 0; m < nmember; m++) {
+      const int i = mlist[m];
+      massone = mass[type[i]];
+      f[i][0] += fx*massone;
+      f[i][1] += fy*massone;
+      f[i][2] += fz*massone;
+    }
+    for (int m = 0; m < nmember2; m++) {
+      const int i = mlist2[m];
+      massone = mass[type[i]];
+      f[i][0] -= fx2*massone;
+      f[i][1] -= fy2*massone;
+      f[i][2] -= fz2*massone;
     }
   }
 }
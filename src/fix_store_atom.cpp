@@ -14,6 +14,7 @@
 #include "fix_store_atom.h"
 
 #include "atom.h"
+#include "atom_vec.h"
 #include "error.h"
 #include "memory.h"
 
@@ -38,6 +39,7 @@ FixStoreAtom::FixStoreAtom(LAMMPS *lmp, int narg, char **arg) :
   if (narg != 7) error->all(FLERR, "Illegal fix STORE/ATOM command: number of args");
 
   disable = 0;
+  refcount = 1;
 
   n1 = utils::inumeric(FLERR, arg[3], false, lmp);
   n2 = utils::inumeric(FLERR, arg[4], false, lmp);
@@ -145,6 +147,23 @@ void FixStoreAtom::copy_arrays(int i, int j, int /*delflag*/)
   }
 }
 
+/* ----------------------------------------------------------------------
+   reorder atom-based arrays in one bulk pass during atom sorting
+------------------------------------------------------------------------- */
+
+int FixStoreAtom::reorder_arrays(int nlocal, int *permute)
+{
+  if (disable) return 1;
+
+  if (vecflag)
+    atom->avec->reorder_gather(vstore, nlocal, permute);
+  else if (arrayflag)
+    atom->avec->reorder_gather(astore, nvalues, nlocal, permute);
+  else if (tensorflag)
+    atom->avec->reorder_gather_rows(&tstore[0][0][0], n1 * n2, nlocal, permute);
+  return 1;
+}
+
 /* ----------------------------------------------------------------------
    pack values for border communication at re-neighboring
 ------------------------------------------------------------------------- */
@@ -30,6 +30,8 @@ class FixStoreAtom : public Fix {
   double **astore;     // array storage
   double ***tstore;    // tensor (3d array) storage
   int disable;         // 1 if operations (except grow) are currently disabled
+  int refcount;        // # of clients sharing this store, owner deletes at 0
+                       // only used by computes sharing a reference store
 
   FixStoreAtom(class LAMMPS *, int, char **);
   ~FixStoreAtom() override;
@@ -37,6 +39,7 @@ class FixStoreAtom : public Fix {
 
   void grow_arrays(int) override;
   void copy_arrays(int, int, int) override;
+  int reorder_arrays(int, int *) override;
   int pack_border(int, int *, double *) override;
   int unpack_border(int, int, double *) override;
   int pack_exchange(int, double *) override;
@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "fix_timer_trace.h"
+
+#include "comm.h"
+#include "error.h"
+#include "memory.h"
+#include "timer.h"
+#include "update.h"
+
+#include <cstring>
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+// timer phases recorded in each trace record, in file order
+// names are stored in the file header, 16 bytes each, for the converter
+
+static constexpr int NPHASES = 7;
+
+static const Timer::ttype phases[NPHASES] = {
+  Timer::PAIR, Timer::BOND, Timer::KSPACE, Timer::NEIGH,
+  Timer::COMM, Timer::MODIFY, Timer::OUTPUT };
+
+static const char *phasenames[NPHASES] = {
+  "Pair", "Bond", "Kspace", "Neigh", "Comm", "Modify", "Output" };
+
+static constexpr int NAMELEN = 16;
+static constexpr int TRACE_VERSION = 1;
+
+/* ---------------------------------------------------------------------- */
+
+FixTimerTrace::FixTimerTrace(LAMMPS *lmp, int narg, char **arg) :
+    Fix(lmp, narg, arg), buf(nullptr), gatherbuf(nullptr), last(nullptr), fp(nullptr)
+{
+  if (narg != 5) error->all(FLERR, "Illegal fix timer/trace command");
+
+  nbuffer = utils::inumeric(FLERR, arg[3], false, lmp);
+  if (nbuffer <= 0)
+    error->all(FLERR, "Illegal fix timer/trace buffer size {}; must be > 0", nbuffer);
+
+  nevery = 1;
+  ncollect = 0;
+  stride = 1 + NPHASES;
+
+  memory->create(buf, nbuffer * stride, "timer/trace:buf");
+  if (comm->me == 0)
+    memory->create(gatherbuf, (bigint) comm->nprocs * nbuffer * stride, "timer/trace:gatherbuf");
+  memory->create(last, NPHASES, "timer/trace:last");
+
+  // rank 0 opens trace file and writes header:
+  // 8-byte magic, version, nprocs, # of phases, phase names
+
+  if (comm->me == 0) {
+    fp = fopen(arg[4], "wb");
+    if (fp == nullptr)
+      error->one(FLERR, "Cannot open fix timer/trace file {}: {}", arg[4], utils::getsyserror());
+
+    char magic[8] = {'L', 'M', 'P', 'T', 'R', 'A', 'C', 'E'};
+    int header[3] = {TRACE_VERSION, comm->nprocs, NPHASES};
+    fwrite(magic, sizeof(char), 8, fp);
+    fwrite(header, sizeof(int), 3, fp);
+    char name[NAMELEN];
+    for (int k = 0; k < NPHASES; k++) {
+      memset(name, 0, NAMELEN);
+      strncpy(name, phasenames[k], NAMELEN - 1);
+      fwrite(name, sizeof(char), NAMELEN, fp);
+    }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixTimerTrace::~FixTimerTrace()
+{
+  memory->destroy(buf);
+  memory->destroy(gatherbuf);
+  memory->destroy(last);
+  if (fp && (comm->me == 0)) fclose(fp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixTimerTrace::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixTimerTrace::init()
+{
+  if (!timer->has_normal())
+    error->all(FLERR, "Fix timer/trace requires timer setting 'normal' or 'full'");
+}
+
+/* ----------------------------------------------------------------------
+   record timer baselines after setup, so setup cost is not
+   attributed to the first timestep
+------------------------------------------------------------------------- */
+
+void FixTimerTrace::setup(int /*vflag*/)
+{
+  for (int k = 0; k < NPHASES; k++) last[k] = timer->get_wall(phases[k]);
+}
+
+/* ----------------------------------------------------------------------
+   buffer per-phase wall time accumulated since previous sample
+   phases stamped after end_of_step (e.g. output) land in the next record
+------------------------------------------------------------------------- */
+
+void FixTimerTrace::end_of_step()
+{
+  double *record = &buf[ncollect * stride];
+  record[0] = (double) update->ntimestep;
+  for (int k = 0; k < NPHASES; k++) {
+    double t = timer->get_wall(phases[k]);
+    record[1 + k] = t - last[k];
+    last[k] = t;
+  }
+
+  ncollect++;
+  if (ncollect == nbuffer) flush_buffer();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixTimerTrace::post_run()
+{
+  flush_buffer();
+  if (fp && (comm->me == 0)) fflush(fp);
+}
+
+/* ----------------------------------------------------------------------
+   gather buffered records from all ranks and write one binary block
+   collective: every rank samples every step, so counts match
+   block format: int nrecords per rank, then records rank by rank
+------------------------------------------------------------------------- */
+
+void FixTimerTrace::flush_buffer()
+{
+  if (ncollect == 0) return;
+
+  MPI_Gather(buf, ncollect * stride, MPI_DOUBLE, gatherbuf, ncollect * stride, MPI_DOUBLE, 0,
+             world);
+
+  if (comm->me == 0) {
+    fwrite(&ncollect, sizeof(int), 1, fp);
+    fwrite(gatherbuf, sizeof(double), (bigint) comm->nprocs * ncollect * stride, fp);
+  }
+
+  ncollect = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixTimerTrace::memory_usage()
+{
+  double bytes = (double) nbuffer * stride * sizeof(double);
+  if (comm->me == 0) bytes += (double) comm->nprocs * nbuffer * stride * sizeof(double);
+  return bytes;
+}
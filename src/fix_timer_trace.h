@@ -0,0 +1,53 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+// clang-format off
+FixStyle(timer/trace,FixTimerTrace);
+// clang-format on
+#else
+
+#ifndef LMP_FIX_TIMER_TRACE_H
+#define LMP_FIX_TIMER_TRACE_H
+
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixTimerTrace : public Fix {
+ public:
+  FixTimerTrace(class LAMMPS *, int, char **);
+  ~FixTimerTrace() override;
+  int setmask() override;
+  void init() override;
+  void setup(int) override;
+  void end_of_step() override;
+  void post_run() override;
+  double memory_usage() override;
+
+ private:
+  int nbuffer;          // # of steps buffered per rank between flushes
+  int ncollect;         // # of records currently buffered
+  int stride;           // # of doubles per record = 1 + # of traced phases
+  double *buf;          // buffered records on this rank
+  double *gatherbuf;    // all-rank records gathered on rank 0 for writing
+  double *last;         // timer readings at previous sample
+  FILE *fp;             // trace file, written by rank 0 only
+
+  void flush_buffer();
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
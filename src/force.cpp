@@ -79,11 +79,27 @@ Force::Force(LAMMPS *lmp) :
   kspace_style = utils::strdup("none");
 
   pair_restart = nullptr;
-  create_factories();
+
+  // style factory maps are filled lazily on first lookup
+
+  pair_map = nullptr;
+  bond_map = nullptr;
+  angle_map = nullptr;
+  dihedral_map = nullptr;
+  improper_map = nullptr;
+  kspace_map = nullptr;
 }
 
-void _noopt Force::create_factories()
+/* ----------------------------------------------------------------------
+   one lazy factory builder per style map, so that short runs only pay
+   for the maps they look up.  direct consumers of the public map
+   pointers (info, plugin) must call create_factories() first.
+------------------------------------------------------------------------- */
+
+void _noopt Force::create_pair_factories()
 {
+  if (pair_map) return;
+
   // fill pair map with pair styles listed in style_pair.h
 
   pair_map = new PairCreatorMap();
@@ -93,6 +109,11 @@ void _noopt Force::create_factories()
 #include "style_pair.h"    // IWYU pragma: keep
 #undef PairStyle
 #undef PAIR_CLASS
+}
+
+void _noopt Force::create_bond_factories()
+{
+  if (bond_map) return;
 
   bond_map = new BondCreatorMap();
 
@@ -101,6 +122,11 @@ void _noopt Force::create_factories()
 #include "style_bond.h"    // IWYU pragma: keep
 #undef BondStyle
 #undef BOND_CLASS
+}
+
+void _noopt Force::create_angle_factories()
+{
+  if (angle_map) return;
 
   angle_map = new AngleCreatorMap();
 
@@ -109,6 +135,11 @@ void _noopt Force::create_factories()
 #include "style_angle.h"    // IWYU pragma: keep
 #undef AngleStyle
 #undef ANGLE_CLASS
+}
+
+void _noopt Force::create_dihedral_factories()
+{
+  if (dihedral_map) return;
 
   dihedral_map = new DihedralCreatorMap();
 
@@ -117,6 +148,11 @@ void _noopt Force::create_factories()
 #include "style_dihedral.h"    // IWYU pragma: keep
 #undef DihedralStyle
 #undef DIHEDRAL_CLASS
+}
+
+void _noopt Force::create_improper_factories()
+{
+  if (improper_map) return;
 
   improper_map = new ImproperCreatorMap();
 
@@ -125,6 +161,11 @@ void _noopt Force::create_factories()
 #include "style_improper.h"    // IWYU pragma: keep
 #undef ImproperStyle
 #undef IMPROPER_CLASS
+}
+
+void _noopt Force::create_kspace_factories()
+{
+  if (kspace_map) return;
 
   kspace_map = new KSpaceCreatorMap();
 
@@ -135,6 +176,21 @@ void _noopt Force::create_factories()
 #undef KSPACE_CLASS
 }
 
+/* ----------------------------------------------------------------------
+   fill all style factory maps
+   for consumers that access the map pointers directly
+------------------------------------------------------------------------- */
+
+void Force::create_factories()
+{
+  create_pair_factories();
+  create_bond_factories();
+  create_angle_factories();
+  create_dihedral_factories();
+  create_improper_factories();
+  create_kspace_factories();
+}
+
 /* ---------------------------------------------------------------------- */
 
 Force::~Force()
@@ -220,6 +276,27 @@ void Force::setup()
   if (pair) pair->setup();
 }
 
+/* ----------------------------------------------------------------------
+   warn when a suffixed version of a style was requested but only the
+   base version exists, so accelerator fallbacks are not silent
+------------------------------------------------------------------------- */
+
+static void warn_missing_suffix(LAMMPS *lmp, const char *category,
+                                const std::string &style, const char *suffix1)
+{
+  if (lmp->comm->me != 0) return;
+  if (style == "zero" || utils::strmatch(style, "^hybrid")) return;
+  std::string tried;
+  if (suffix1) tried = fmt::format("{}/{}", style, suffix1);
+  if (lmp->suffix2) {
+    if (tried.size()) tried += " or ";
+    tried += fmt::format("{}/{}", style, lmp->suffix2);
+  }
+  if (tried.empty()) return;
+  lmp->error->warning(FLERR, "Using non-accelerated {} style {}: {} not available",
+                      category, style, tried);
+}
+
 /* ----------------------------------------------------------------------
    create a pair style, called from input script or restart file
 ------------------------------------------------------------------------- */
@@ -246,6 +323,8 @@ void Force::create_pair(const std::string &style, int trysuffix)
 
 Pair *Force::new_pair(const std::string &style, int trysuffix, int &sflag)
 {
+  create_pair_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->suffix) {
       sflag = 1;
@@ -268,6 +347,8 @@ Pair *Force::new_pair(const std::string &style, int trysuffix, int &sflag)
   sflag = 0;
   if (style == "none") return nullptr;
   if (pair_map->find(style) != pair_map->end()) {
+    if (trysuffix && lmp->suffix_enable)
+      warn_missing_suffix(lmp, "pair", style, lmp->suffix);
     PairCreator &pair_creator = (*pair_map)[style];
     return pair_creator(lmp);
   }
@@ -350,6 +431,8 @@ void Force::create_bond(const std::string &style, int trysuffix)
 
 Bond *Force::new_bond(const std::string &style, int trysuffix, int &sflag)
 {
+  create_bond_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->non_pair_suffix()) {
       sflag = 1 + 2 * lmp->pair_only_flag;
@@ -373,6 +456,8 @@ Bond *Force::new_bond(const std::string &style, int trysuffix, int &sflag)
   sflag = 0;
   if (style == "none") return nullptr;
   if (bond_map->find(style) != bond_map->end()) {
+    if (trysuffix && lmp->suffix_enable)
+      warn_missing_suffix(lmp, "bond", style, lmp->non_pair_suffix());
     BondCreator &bond_creator = (*bond_map)[style];
     return bond_creator(lmp);
   }
@@ -420,6 +505,8 @@ void Force::create_angle(const std::string &style, int trysuffix)
 
 Angle *Force::new_angle(const std::string &style, int trysuffix, int &sflag)
 {
+  create_angle_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->non_pair_suffix()) {
       sflag = 1 + 2 * lmp->pair_only_flag;
@@ -443,6 +530,8 @@ Angle *Force::new_angle(const std::string &style, int trysuffix, int &sflag)
   sflag = 0;
   if (style == "none") return nullptr;
   if (angle_map->find(style) != angle_map->end()) {
+    if (trysuffix && lmp->suffix_enable)
+      warn_missing_suffix(lmp, "angle", style, lmp->non_pair_suffix());
     AngleCreator &angle_creator = (*angle_map)[style];
     return angle_creator(lmp);
   }
@@ -490,6 +579,8 @@ void Force::create_dihedral(const std::string &style, int trysuffix)
 
 Dihedral *Force::new_dihedral(const std::string &style, int trysuffix, int &sflag)
 {
+  create_dihedral_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->non_pair_suffix()) {
       sflag = 1 + 2 * lmp->pair_only_flag;
@@ -513,6 +604,8 @@ Dihedral *Force::new_dihedral(const std::string &style, int trysuffix, int &sfla
   sflag = 0;
   if (style == "none") return nullptr;
   if (dihedral_map->find(style) != dihedral_map->end()) {
+    if (trysuffix && lmp->suffix_enable)
+      warn_missing_suffix(lmp, "dihedral", style, lmp->non_pair_suffix());
     DihedralCreator &dihedral_creator = (*dihedral_map)[style];
     return dihedral_creator(lmp);
   }
@@ -560,6 +653,8 @@ void Force::create_improper(const std::string &style, int trysuffix)
 
 Improper *Force::new_improper(const std::string &style, int trysuffix, int &sflag)
 {
+  create_improper_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->non_pair_suffix()) {
       sflag = 1 + 2 * lmp->pair_only_flag;
@@ -583,6 +678,8 @@ Improper *Force::new_improper(const std::string &style, int trysuffix, int &sfla
   sflag = 0;
   if (style == "none") return nullptr;
   if (improper_map->find(style) != improper_map->end()) {
+    if (trysuffix && lmp->suffix_enable)
+      warn_missing_suffix(lmp, "improper", style, lmp->non_pair_suffix());
     ImproperCreator &improper_creator = (*improper_map)[style];
     return improper_creator(lmp);
   }
@@ -630,6 +727,8 @@ void Force::create_kspace(const std::string &style, int trysuffix)
 
 KSpace *Force::new_kspace(const std::string &style, int trysuffix, int &sflag)
 {
+  create_kspace_factories();
+
   if (trysuffix && lmp->suffix_enable) {
     if (lmp->non_pair_suffix()) {
       sflag = 1 + 2 * lmp->pair_only_flag;
@@ -653,6 +752,8 @@ KSpace *Force::new_kspace(const std::string &style, int trysuffix, int &sflag)
   sflag = 0;
   if (style == "none") return nullptr;
   if (kspace_map->find(style) != kspace_map->end()) {
+    if (trysuffix && lmp->suffix_enable)
+      warn_missing_suffix(lmp, "kspace", style, lmp->non_pair_suffix());
     KSpaceCreator &kspace_creator = (*kspace_map)[style];
     return kspace_creator(lmp);
   }
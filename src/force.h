@@ -152,8 +152,15 @@ class Force : protected Pointers {
 
   double memory_usage();
 
- private:
   void create_factories();
+
+ private:
+  void create_pair_factories();
+  void create_bond_factories();
+  void create_angle_factories();
+  void create_dihedral_factories();
+  void create_improper_factories();
+  void create_kspace_factories();
 };
 
 }    // namespace LAMMPS_NS
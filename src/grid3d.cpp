@@ -50,7 +50,7 @@ static constexpr int OFFSET = 16384;
 ------------------------------------------------------------------------- */
 
 Grid3d::Grid3d(LAMMPS *lmp, MPI_Comm gcomm, int gnx, int gny, int gnz) :
-  Pointers(lmp), swap(nullptr), requests(nullptr), srequest(nullptr), rrequest(nullptr),
+  Pointers(lmp), swap(nullptr), requests(nullptr), requests2(nullptr), srequest(nullptr), rrequest(nullptr),
     sresponse(nullptr), rresponse(nullptr), send(nullptr), recv(nullptr), copy(nullptr),
     send_remap(nullptr), recv_remap(nullptr), overlap_procs(nullptr), xsplit(nullptr),
     ysplit(nullptr), zsplit(nullptr), grid2proc(nullptr), rcbinfo(nullptr), overlap_list(nullptr)
@@ -98,7 +98,7 @@ Grid3d::Grid3d(LAMMPS *lmp, MPI_Comm gcomm, int gnx, int gny, int gnz) :
 Grid3d::Grid3d(LAMMPS *lmp, MPI_Comm gcomm, int gnx, int gny, int gnz,
                int ixlo, int ixhi, int iylo, int iyhi, int izlo, int izhi,
                int oxlo, int oxhi, int oylo, int oyhi, int ozlo, int ozhi) :
-  Pointers(lmp), swap(nullptr), requests(nullptr), srequest(nullptr), rrequest(nullptr),
+  Pointers(lmp), swap(nullptr), requests(nullptr), requests2(nullptr), srequest(nullptr), rrequest(nullptr),
     sresponse(nullptr), rresponse(nullptr), send(nullptr), recv(nullptr), copy(nullptr),
     send_remap(nullptr), recv_remap(nullptr), overlap_procs(nullptr), xsplit(nullptr),
     ysplit(nullptr), zsplit(nullptr), grid2proc(nullptr), rcbinfo(nullptr), overlap_list(nullptr)
@@ -172,6 +172,7 @@ Grid3d::~Grid3d()
   memory->sfree(copy);
 
   delete [] requests;
+  delete [] requests2;
   delete [] requests_remap;
 
   memory->sfree(rcbinfo);
@@ -463,10 +464,12 @@ void Grid3d::initialize()
   swap = nullptr;
 
   nsend = nrecv = ncopy = 0;
+  self_offset = 0;
   send = nullptr;
   recv = nullptr;
   copy = nullptr;
   requests = nullptr;
+  requests2 = nullptr;
   requests_remap = nullptr;
 
   xsplit = ysplit = zsplit = nullptr;
@@ -1167,10 +1170,12 @@ void Grid3d::setup_comm_tiled(int &nbuf1, int &nbuf2)
     offset += recv[m].nunpack;
   }
 
-  // length of MPI requests vector is max of nsend, nrecv
+  // length of MPI requests vectors is max of nsend, nrecv
+  // requests2 is for the sends posted while the recvs are pending
 
   int nrequest = MAX(nsend,nrecv);
   requests = new MPI_Request[nrequest];
+  requests2 = new MPI_Request[nrequest];
 
   // clean-up
 
@@ -1181,29 +1186,30 @@ void Grid3d::setup_comm_tiled(int &nbuf1, int &nbuf2)
   memory->sfree(sresponse);
   memory->sfree(rresponse);
 
-  // nbuf1 = largest pack or unpack in any Send or Recv or Copy
-  // nbuf2 = larget of sum of all packs or unpacks in Send or Recv
-
-  nbuf1 = 0;
+  // nbuf1 = sum of all packs or unpacks in Send or Recv, whichever is
+  //   larger, plus the largest pack or unpack in any Copy, since all
+  //   outgoing messages are packed into their own slot of buf1 so their
+  //   sends can be in flight at once, while copies to self pack into a
+  //   scratch slot at self_offset past the send slots
+  // nbuf2 = largest of sum of all packs or unpacks in Send or Recv
 
+  int nbufc = 0;
   for (m = 0; m < ncopy; m++) {
-    nbuf1 = MAX(nbuf1,copy[m].npack);
-    nbuf1 = MAX(nbuf1,copy[m].nunpack);
+    nbufc = MAX(nbufc,copy[m].npack);
+    nbufc = MAX(nbufc,copy[m].nunpack);
   }
 
   int nbufs = 0;
-  for (m = 0; m < nsend; m++) {
-    nbuf1 = MAX(nbuf1,send[m].npack);
+  for (m = 0; m < nsend; m++)
     nbufs += send[m].npack;
-  }
 
   int nbufr = 0;
-  for (m = 0; m < nrecv; m++) {
-    nbuf1 = MAX(nbuf1,recv[m].nunpack);
+  for (m = 0; m < nrecv; m++)
     nbufr += recv[m].nunpack;
-  }
 
   nbuf2 = MAX(nbufs,nbufr);
+  self_offset = nbuf2;
+  nbuf1 = nbuf2 + nbufc;
 }
 
 // ----------------------------------------------------------------------
@@ -1339,18 +1345,29 @@ forward_comm_tiled(T *ptr, int which, int nper, int nbyte,
               recv[m].proc,0,gridcomm,&requests[m]);
   }
 
-  // perform all sends to other procs
+  // pack and send all messages to other procs
+  // nonblocking sends from per-message slots of buf1 let the packing
+  //   and the self copies below overlap the transfers
+
+  auto buf1c = (char *) buf1;
 
   for (m = 0; m < nsend; m++) {
-    ptr->pack_forward_grid(which,buf1,send[m].npack,send[m].packlist);
-    MPI_Send(buf1,nper*send[m].npack,datatype,send[m].proc,0,gridcomm);
+    offset = nper * send[m].offset * nbyte;
+    ptr->pack_forward_grid(which,(void *) &buf1c[offset],
+                           send[m].npack,send[m].packlist);
+    MPI_Isend((void *) &buf1c[offset],nper*send[m].npack,datatype,
+              send[m].proc,0,gridcomm,&requests2[m]);
   }
 
   // perform all copies to self
+  // pack into the scratch slot past the send slots,
+  //   whose nonblocking sends may still be in flight
+
+  char *scratch = &buf1c[nper*self_offset*nbyte];
 
   for (m = 0; m < ncopy; m++) {
-    ptr->pack_forward_grid(which,buf1,copy[m].npack,copy[m].packlist);
-    ptr->unpack_forward_grid(which,buf1,copy[m].nunpack,copy[m].unpacklist);
+    ptr->pack_forward_grid(which,(void *) scratch,copy[m].npack,copy[m].packlist);
+    ptr->unpack_forward_grid(which,(void *) scratch,copy[m].nunpack,copy[m].unpacklist);
   }
 
   // unpack all received data
@@ -1361,6 +1378,169 @@ forward_comm_tiled(T *ptr, int which, int nper, int nbyte,
     ptr->unpack_forward_grid(which,(void *) &buf2[offset],
                              recv[m].nunpack,recv[m].unpacklist);
   }
+
+  // wait for all sends to drain before buf1 can be reused
+
+  if (nsend) MPI_Waitall(nsend,requests2,MPI_STATUS_IGNORE);
+}
+
+/* ----------------------------------------------------------------------
+   batched forward comm of nwhich data sets in a single exchange
+   which[k] and nper[k] describe each data set as in forward_comm()
+   each message to a neighbor concatenates the blocks of all data sets,
+     so the per-message latency is paid once instead of nwhich times
+   caller buffers must be sized for the summed nper of all data sets
+------------------------------------------------------------------------- */
+
+void Grid3d::forward_comm_list(int caller, void *ptr, int nwhich, const int *which,
+                               const int *nper, int nbyte, void *buf1, void *buf2,
+                               MPI_Datatype datatype)
+{
+  if (layout_grid != Comm::LAYOUT_TILED) {
+    if (caller == KSPACE)
+      forward_comm_list_brick<KSpace>((KSpace *) ptr,nwhich,which,nper,nbyte,
+                                      buf1,buf2,datatype);
+    else if (caller == PAIR)
+      forward_comm_list_brick<Pair>((Pair *) ptr,nwhich,which,nper,nbyte,
+                                    buf1,buf2,datatype);
+    else if (caller == FIX)
+      forward_comm_list_brick<Fix>((Fix *) ptr,nwhich,which,nper,nbyte,
+                                   buf1,buf2,datatype);
+  } else {
+    if (caller == KSPACE)
+      forward_comm_list_tiled<KSpace>((KSpace *) ptr,nwhich,which,nper,nbyte,
+                                      buf1,buf2,datatype);
+    else if (caller == PAIR)
+      forward_comm_list_tiled<Pair>((Pair *) ptr,nwhich,which,nper,nbyte,
+                                    buf1,buf2,datatype);
+    else if (caller == FIX)
+      forward_comm_list_tiled<Fix>((Fix *) ptr,nwhich,which,nper,nbyte,
+                                   buf1,buf2,datatype);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   batched forward comm for brick decomp
+   both sides of a swap pack/unpack the data sets in the same order and
+     the pair's npack/nunpack counts match, so the block offsets agree
+------------------------------------------------------------------------- */
+
+template < class T >
+void Grid3d::
+forward_comm_list_brick(T *ptr, int nwhich, const int *which, const int *nper,
+                        int nbyte, void *buf1, void *buf2, MPI_Datatype datatype)
+{
+  int k,m,offset;
+  MPI_Request request;
+
+  int ntotal = 0;
+  for (k = 0; k < nwhich; k++) ntotal += nper[k];
+
+  auto cbuf1 = (char *) buf1;
+  auto cbuf2 = (char *) buf2;
+
+  for (m = 0; m < nswap; m++) {
+    offset = 0;
+    if (swap[m].sendproc == me) {
+      for (k = 0; k < nwhich; k++) {
+        ptr->pack_forward_grid(which[k],(void *) &cbuf2[offset],
+                               swap[m].npack,swap[m].packlist);
+        offset += nper[k]*swap[m].npack*nbyte;
+      }
+    } else {
+      for (k = 0; k < nwhich; k++) {
+        ptr->pack_forward_grid(which[k],(void *) &cbuf1[offset],
+                               swap[m].npack,swap[m].packlist);
+        offset += nper[k]*swap[m].npack*nbyte;
+      }
+    }
+
+    if (swap[m].sendproc != me) {
+      if (swap[m].nunpack) MPI_Irecv(buf2,ntotal*swap[m].nunpack,datatype,
+                                     swap[m].recvproc,0,gridcomm,&request);
+      if (swap[m].npack) MPI_Send(buf1,ntotal*swap[m].npack,datatype,
+                                  swap[m].sendproc,0,gridcomm);
+      if (swap[m].nunpack) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    }
+
+    offset = 0;
+    for (k = 0; k < nwhich; k++) {
+      ptr->unpack_forward_grid(which[k],(void *) &cbuf2[offset],
+                               swap[m].nunpack,swap[m].unpacklist);
+      offset += nper[k]*swap[m].nunpack*nbyte;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   batched forward comm for tiled decomp
+   per-message slots in buf1/buf2 are scaled by the summed nper
+------------------------------------------------------------------------- */
+
+template < class T >
+void Grid3d::
+forward_comm_list_tiled(T *ptr, int nwhich, const int *which, const int *nper,
+                        int nbyte, void *buf1, void *vbuf2, MPI_Datatype datatype)
+{
+  int i,k,m,offset,koffset;
+
+  auto buf2 = (char *) vbuf2;
+
+  int ntotal = 0;
+  for (k = 0; k < nwhich; k++) ntotal += nper[k];
+
+  // post all receives
+
+  for (m = 0; m < nrecv; m++) {
+    offset = ntotal * recv[m].offset * nbyte;
+    MPI_Irecv((void *) &buf2[offset],ntotal*recv[m].nunpack,datatype,
+              recv[m].proc,0,gridcomm,&requests[m]);
+  }
+
+  // pack all data sets into each message slot and send
+
+  auto buf1c = (char *) buf1;
+
+  for (m = 0; m < nsend; m++) {
+    offset = ntotal * send[m].offset * nbyte;
+    koffset = offset;
+    for (k = 0; k < nwhich; k++) {
+      ptr->pack_forward_grid(which[k],(void *) &buf1c[koffset],
+                             send[m].npack,send[m].packlist);
+      koffset += nper[k]*send[m].npack*nbyte;
+    }
+    MPI_Isend((void *) &buf1c[offset],ntotal*send[m].npack,datatype,
+              send[m].proc,0,gridcomm,&requests2[m]);
+  }
+
+  // perform all copies to self
+  // pack into the scratch slot past the send slots,
+  //   whose nonblocking sends may still be in flight
+
+  char *scratch = &buf1c[ntotal*self_offset*nbyte];
+
+  for (m = 0; m < ncopy; m++) {
+    for (k = 0; k < nwhich; k++) {
+      ptr->pack_forward_grid(which[k],(void *) scratch,copy[m].npack,copy[m].packlist);
+      ptr->unpack_forward_grid(which[k],(void *) scratch,copy[m].nunpack,copy[m].unpacklist);
+    }
+  }
+
+  // unpack all received data
+
+  for (i = 0; i < nrecv; i++) {
+    MPI_Waitany(nrecv,requests,&m,MPI_STATUS_IGNORE);
+    offset = ntotal * recv[m].offset * nbyte;
+    for (k = 0; k < nwhich; k++) {
+      ptr->unpack_forward_grid(which[k],(void *) &buf2[offset],
+                               recv[m].nunpack,recv[m].unpacklist);
+      offset += nper[k]*recv[m].nunpack*nbyte;
+    }
+  }
+
+  // wait for all sends to drain before buf1 can be reused
+
+  if (nsend) MPI_Waitall(nsend,requests2,MPI_STATUS_IGNORE);
 }
 
 /* ----------------------------------------------------------------------
@@ -1444,18 +1624,29 @@ reverse_comm_tiled(T *ptr, int which, int nper, int nbyte,
               send[m].proc,0,gridcomm,&requests[m]);
   }
 
-  // perform all sends to other procs
+  // pack and send all messages to other procs
+  // nonblocking sends from per-message slots of buf1 let the packing
+  //   and the self copies below overlap the transfers
+
+  auto buf1c = (char *) buf1;
 
   for (m = 0; m < nrecv; m++) {
-    ptr->pack_reverse_grid(which,buf1,recv[m].nunpack,recv[m].unpacklist);
-    MPI_Send(buf1,nper*recv[m].nunpack,datatype,recv[m].proc,0,gridcomm);
+    offset = nper * recv[m].offset * nbyte;
+    ptr->pack_reverse_grid(which,(void *) &buf1c[offset],
+                           recv[m].nunpack,recv[m].unpacklist);
+    MPI_Isend((void *) &buf1c[offset],nper*recv[m].nunpack,datatype,
+              recv[m].proc,0,gridcomm,&requests2[m]);
   }
 
   // perform all copies to self
+  // pack into the scratch slot past the send slots,
+  //   whose nonblocking sends may still be in flight
+
+  char *scratch = &buf1c[nper*self_offset*nbyte];
 
   for (m = 0; m < ncopy; m++) {
-    ptr->pack_reverse_grid(which,buf1,copy[m].nunpack,copy[m].unpacklist);
-    ptr->unpack_reverse_grid(which,buf1,copy[m].npack,copy[m].packlist);
+    ptr->pack_reverse_grid(which,(void *) scratch,copy[m].nunpack,copy[m].unpacklist);
+    ptr->unpack_reverse_grid(which,(void *) scratch,copy[m].npack,copy[m].packlist);
   }
 
   // unpack all received data
@@ -1466,6 +1657,10 @@ reverse_comm_tiled(T *ptr, int which, int nper, int nbyte,
     ptr->unpack_reverse_grid(which,(void *) &buf2[offset],
                              send[m].npack,send[m].packlist);
   }
+
+  // wait for all sends to drain before buf1 can be reused
+
+  if (nrecv) MPI_Waitall(nrecv,requests2,MPI_STATUS_IGNORE);
 }
 
 // ----------------------------------------------------------------------
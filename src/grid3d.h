@@ -48,6 +48,8 @@ class Grid3d : protected Pointers {
   int ghost_adjacent();
   void forward_comm(int, void *, int, int, int, void *, void *, MPI_Datatype);
   void reverse_comm(int, void *, int, int, int, void *, void *, MPI_Datatype);
+  void forward_comm_list(int, void *, int, const int *, const int *, int, void *, void *,
+                         MPI_Datatype);
 
   void setup_remap(Grid3d *, int &, int &);
   void remap(int, void *, int, int, int, void *, void *, MPI_Datatype);
@@ -120,7 +122,8 @@ class Grid3d : protected Pointers {
   // internal variables for TILED layout
   // -------------------------------------------
 
-  MPI_Request *requests;    // length of max messages this proc receives
+  MPI_Request *requests;     // length of max messages this proc receives
+  MPI_Request *requests2;    // for sends posted concurrently with recvs
 
   // request = sent to each proc whose owned cells overlap my ghost cells
 
@@ -179,6 +182,8 @@ class Grid3d : protected Pointers {
   };
 
   int nsend, nrecv, ncopy;
+  int self_offset;    // offset in buf1 of scratch slot for copies to self,
+                      // past the send slots which may still be in flight
   Send *send;
   Recv *recv;
   Copy *copy;
@@ -246,6 +251,12 @@ class Grid3d : protected Pointers {
 
   template <class T> void forward_comm_brick(T *, int, int, int, void *, void *, MPI_Datatype);
   template <class T> void forward_comm_tiled(T *, int, int, int, void *, void *, MPI_Datatype);
+  template <class T>
+  void forward_comm_list_brick(T *, int, const int *, const int *, int, void *, void *,
+                               MPI_Datatype);
+  template <class T>
+  void forward_comm_list_tiled(T *, int, const int *, const int *, int, void *, void *,
+                               MPI_Datatype);
   template <class T> void reverse_comm_brick(T *, int, int, int, void *, void *, MPI_Datatype);
   template <class T> void reverse_comm_tiled(T *, int, int, int, void *, void *, MPI_Datatype);
 
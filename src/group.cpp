@@ -27,9 +27,11 @@
 #include "math_extra.h"
 #include "memory.h"
 #include "modify.h"
+#include "neighbor.h"
 #include "output.h"
 #include "region.h"
 #include "tokenizer.h"
+#include "update.h"
 #include "variable.h"
 
 #include <cmath>
@@ -65,6 +67,15 @@ Group::Group(LAMMPS *lmp) : Pointers(lmp)
   for (int i = 0; i < MAX_GROUP; i++) inversemask[i] = bitmask[i] ^ ~0;
   for (int i = 0; i < MAX_GROUP; i++) dynamic[i] = 0;
 
+  memlist = new int *[MAX_GROUP];
+  nmemlist = new int[MAX_GROUP];
+  maxmemlist = new int[MAX_GROUP];
+  memstep = new bigint[MAX_GROUP];
+
+  for (int i = 0; i < MAX_GROUP; i++) memlist[i] = nullptr;
+  for (int i = 0; i < MAX_GROUP; i++) nmemlist[i] = maxmemlist[i] = 0;
+  for (int i = 0; i < MAX_GROUP; i++) memstep[i] = -1;
+
   // create "all" group
 
   names[0] = utils::strdup("all");
@@ -82,6 +93,12 @@ Group::~Group()
   delete[] bitmask;
   delete[] inversemask;
   delete[] dynamic;
+
+  for (int i = 0; i < MAX_GROUP; i++) memory->destroy(memlist[i]);
+  delete[] memlist;
+  delete[] nmemlist;
+  delete[] maxmemlist;
+  delete[] memstep;
 }
 
 /* ----------------------------------------------------------------------
@@ -671,7 +688,7 @@ void Group::add_molecules(int /*igroup*/, int bit)
     }
 
   // list = set of unique molecule IDs for atoms to add
-  // pass list to all other procs via comm->ring()
+  // pass list to all other procs via comm->ring_gather()
 
   int n = hash->size();
   tagint *list;
@@ -682,14 +699,14 @@ void Group::add_molecules(int /*igroup*/, int bit)
   for (pos = hash->begin(); pos != hash->end(); ++pos) list[n++] = pos->first;
 
   molbit = bit;
-  comm->ring(n, sizeof(tagint), list, 1, molring, nullptr, (void *) this);
+  comm->ring_gather(n, sizeof(tagint), list, molring, (void *) this);
 
   delete hash;
   memory->destroy(list);
 }
 
 /* ----------------------------------------------------------------------
-   callback from comm->ring()
+   callback from comm->ring_gather()
    cbuf = list of N molecule IDs, put them in hash
    loop over my atoms, if matches molecule ID in hash,
      add atom to group flagged by molbit
@@ -778,6 +795,42 @@ void Group::read_restart(FILE *fp)
   }
 }
 
+/* ----------------------------------------------------------------------
+   return cached list of local atom indices in group, set n to its length
+   membership of local atoms can only change when atoms migrate, are
+   sorted, or a dynamic group updates its masks, so the list is rebuilt
+   on reneighbor steps (which includes every run setup) and on every
+   call for dynamic groups
+   callers iterating small static groups avoid sweeping all nlocal atoms
+------------------------------------------------------------------------- */
+
+int *Group::member_list(int igroup, int &n)
+{
+  bigint laststep = update->ntimestep - neighbor->ago;
+
+  if (dynamic[igroup] || memstep[igroup] <= laststep) {
+    int *mask = atom->mask;
+    int nlocal = atom->nlocal;
+    int groupbit = bitmask[igroup];
+
+    if (nlocal > maxmemlist[igroup]) {
+      maxmemlist[igroup] = atom->nmax;
+      memory->grow(memlist[igroup], maxmemlist[igroup], "group:memlist");
+    }
+
+    int *list = memlist[igroup];
+    int nmem = 0;
+    for (int i = 0; i < nlocal; i++)
+      if (mask[i] & groupbit) list[nmem++] = i;
+
+    nmemlist[igroup] = nmem;
+    memstep[igroup] = update->ntimestep;
+  }
+
+  n = nmemlist[igroup];
+  return memlist[igroup];
+}
+
 // ----------------------------------------------------------------------
 // computations on a group of atoms
 // ----------------------------------------------------------------------
@@ -39,6 +39,8 @@ class Group : protected Pointers {
   void write_restart(FILE *);
   void read_restart(FILE *);
 
+  int *member_list(int, int &);    // cached list of local atoms in group
+
   bigint count_all();             // count atoms in group all
   bigint count(int);              // count atoms in group
   bigint count(int, Region *);    // count atoms in group & region
@@ -70,6 +72,13 @@ class Group : protected Pointers {
   int me;
   std::map<tagint, int> *hash;
 
+  // per-group member lists served by member_list()
+
+  int **memlist;        // indices of local atoms in each group, or NULL
+  int *nmemlist;        // # of local atoms in each list
+  int *maxmemlist;      // allocated length of each list
+  bigint *memstep;      // timestep each list was last rebuilt on
+
   int find_unused();
   void add_molecules(int, int);
 
@@ -483,10 +483,16 @@ void Image::draw_sphere(double *x, double *surfaceColor, double diameter)
   xc += width / 2;
   yc += height / 2;
 
-  for (iy = yc - pixelRadius; iy <= yc + pixelRadius; iy++) {
-    for (ix = xc - pixelRadius; ix <= xc + pixelRadius; ix++) {
-      if (iy < 0 || iy >= height || ix < 0 || ix >= width) continue;
+  // clip raster square to the viewport
+  // also skips spheres which are entirely off-screen
 
+  int iylo = MAX(yc - pixelRadius,0);
+  int iyhi = MIN(yc + pixelRadius,height-1);
+  int ixlo = MAX(xc - pixelRadius,0);
+  int ixhi = MIN(xc + pixelRadius,width-1);
+
+  for (iy = iylo; iy <= iyhi; iy++) {
+    for (ix = ixlo; ix <= ixhi; ix++) {
       surface[1] = ((iy - yc) - height_error) * pixelWidth;
       surface[0] = ((ix - xc) - width_error) * pixelWidth;
       projRad = surface[0]*surface[0] + surface[1]*surface[1];
@@ -545,10 +551,13 @@ void Image::draw_cube(double *x, double *surfaceColor, double diameter)
   xc += width / 2;
   yc += height / 2;
 
-  for (int iy = yc - pixelHalfWidth; iy <= yc + pixelHalfWidth; iy ++) {
-    for (int ix = xc - pixelHalfWidth; ix <= xc + pixelHalfWidth; ix ++) {
-      if (iy < 0 || iy >= height || ix < 0 || ix >= width) continue;
+  int iylo = MAX(yc - pixelHalfWidth,0);
+  int iyhi = MIN(yc + pixelHalfWidth,height-1);
+  int ixlo = MAX(xc - pixelHalfWidth,0);
+  int ixhi = MIN(xc + pixelHalfWidth,width-1);
 
+  for (int iy = iylo; iy <= iyhi; iy ++) {
+    for (int ix = ixlo; ix <= ixhi; ix ++) {
       double sy = ((iy - yc) - height_error) * pixelWidth;
       double sx = ((ix - xc) - width_error) * pixelWidth;
       surface[0] = camRight[0] * sx + camUp[0] * sy;
@@ -699,10 +708,13 @@ void Image::draw_cylinder(double *x, double *y,
 
   double a = camLDir[0] * camLDir[0];
 
-  for (int iy = yc - pixelHalfHeight; iy <= yc + pixelHalfHeight; iy ++) {
-    for (int ix = xc - pixelHalfWidth; ix <= xc + pixelHalfWidth; ix ++) {
-      if (iy < 0 || iy >= height || ix < 0 || ix >= width) continue;
+  int iylo = MAX(yc - pixelHalfHeight,0);
+  int iyhi = MIN(yc + pixelHalfHeight,height-1);
+  int ixlo = MAX(xc - pixelHalfWidth,0);
+  int ixhi = MIN(xc + pixelHalfWidth,width-1);
 
+  for (int iy = iylo; iy <= iyhi; iy ++) {
+    for (int ix = ixlo; ix <= ixhi; ix ++) {
       double sy = ((iy - yc) - height_error) * pixelWidth;
       double sx = ((ix - xc) - width_error) * pixelWidth;
       surface[0] = camLRight[0] * sx + camLUp[0] * sy;
@@ -823,10 +835,13 @@ void Image::draw_triangle(double *x, double *y, double *z, double *surfaceColor)
   int pixelDown = static_cast<int> (pixelDownFull + 0.5);
   int pixelUp = static_cast<int> (pixelUpFull + 0.5);
 
-  for (int iy = yc - pixelDown; iy <= yc + pixelUp; iy ++) {
-    for (int ix = xc - pixelLeft; ix <= xc + pixelRight; ix ++) {
-      if (iy < 0 || iy >= height || ix < 0 || ix >= width) continue;
+  int iylo = MAX(yc - pixelDown,0);
+  int iyhi = MIN(yc + pixelUp,height-1);
+  int ixlo = MAX(xc - pixelLeft,0);
+  int ixhi = MIN(xc + pixelRight,width-1);
 
+  for (int iy = iylo; iy <= iyhi; iy ++) {
+    for (int ix = ixlo; ix <= ixhi; ix ++) {
       double sy = ((iy - yc) - height_error) * pixelWidth;
       double sx = ((ix - xc) - width_error) * pixelWidth;
       surface[0] = camRight[0] * sx + camUp[0] * sy;
@@ -21,6 +21,10 @@ using namespace LAMMPS_NS;
 
 static constexpr double BIG = 1.0e20;
 
+// EMA weight for the newest measurement when smoothing per-atom cost
+
+static constexpr double ALPHA = 0.5;
+
 /* -------------------------------------------------------------------- */
 
 ImbalanceTime::ImbalanceTime(LAMMPS *lmp) : Imbalance(lmp) {}
@@ -42,6 +46,7 @@ int ImbalanceTime::options(int narg, char **arg)
 void ImbalanceTime::init(int flag)
 {
   last = 0.0;
+  rate = 0.0;
 
   // flag = 1 if called from FixBalance at start of run
   //   init Timer, so accumulated time not carried over from previous run
@@ -79,6 +84,14 @@ void ImbalanceTime::compute(double *weight)
 
   if (nlocal && localwt <= 0.0) error->one(FLERR, "Balance weight <= 0.0");
 
+  // smooth the per-atom cost with an exponential moving average over
+  //   successive invocations, so that repeated rebalancing (fix balance)
+  //   responds to the cost trend, not to single-window measurement noise
+  // first invocation has no history and uses the raw measurement
+
+  if (rate > 0.0 && localwt > 0.0) localwt = ALPHA * localwt + (1.0 - ALPHA) * rate;
+  rate = localwt;
+
   // apply factor if specified != 1.0
   // wtlo,wthi = lo/hi values excluding 0.0 due to no atoms on this proc
   // lo value does not change
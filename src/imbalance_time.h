@@ -35,6 +35,7 @@ class ImbalanceTime : public Imbalance {
  private:
   double factor;    // weight factor for time imbalance
   double last;      // combined wall time from last call
+  double rate;      // smoothed per-atom cost from previous invocations
 };
 
 }    // namespace LAMMPS_NS
@@ -35,6 +35,7 @@
 #include "improper.h"
 #include "input.h"
 #include "lmpfftsettings.h"
+#include "memory.h"
 #include "modify.h"
 #include "neighbor.h"
 #include "output.h"
@@ -338,6 +339,21 @@ void Info::command(int narg, char **arg)
     fmt::print(out,"Total dynamically allocated memory: {:.4} Mbyte\n",
                meminfo[0]);
 
+    if (memory->arena_nbytes() > 0)
+      fmt::print(out,"Transient buffer arena: {:.4} Mbyte reserved, "
+                 "{:.4} Mbyte high-water use\n",
+                 memory->arena_nbytes()/1048576.0,
+                 memory->arena_highwater()/1048576.0);
+
+    if (atom->nmax > 0)
+      fmt::print(out,"Per-atom array capacity: {} atoms, {} owned + {} ghost "
+                 "stored ({:.1f}% used)\n",atom->nmax,atom->nlocal,atom->nghost,
+                 100.0*(atom->nlocal+atom->nghost)/atom->nmax);
+    if (memory->grow_headroom > 0)
+      fmt::print(out,"Reallocation headroom: {}%\n",memory->grow_headroom);
+    if (memory->hugepage)
+      fputs("Transparent hugepages requested for large allocations\n",out);
+
 #if defined(_WIN32)
     fmt::print(out,"Non-shared memory use: {:.4} Mbyte\n",meminfo[1]);
     fmt::print(out,"Maximum working set size: {:.4} Mbyte\n",meminfo[2]);
@@ -695,6 +711,7 @@ void Info::minimize_styles(FILE *out)
 
 void Info::pair_styles(FILE *out)
 {
+  force->create_factories();
   fputs("\nPair styles:\n",out);
   print_columns(out, force->pair_map);
   fputs("\n\n\n",out);
@@ -702,6 +719,7 @@ void Info::pair_styles(FILE *out)
 
 void Info::bond_styles(FILE *out)
 {
+  force->create_factories();
   fputs("\nBond styles:\n",out);
   print_columns(out, force->bond_map);
   fputs("\n\n\n",out);
@@ -709,6 +727,7 @@ void Info::bond_styles(FILE *out)
 
 void Info::angle_styles(FILE *out)
 {
+  force->create_factories();
   fputs("\nAngle styles:\n",out);
   print_columns(out, force->angle_map);
   fputs("\n\n\n",out);
@@ -716,6 +735,7 @@ void Info::angle_styles(FILE *out)
 
 void Info::dihedral_styles(FILE *out)
 {
+  force->create_factories();
   fputs("\nDihedral styles:\n",out);
   print_columns(out, force->dihedral_map);
   fputs("\n\n\n",out);
@@ -723,6 +743,7 @@ void Info::dihedral_styles(FILE *out)
 
 void Info::improper_styles(FILE *out)
 {
+  force->create_factories();
   fputs("\nImproper styles:\n",out);
   print_columns(out, force->improper_map);
   fputs("\n\n\n",out);
@@ -730,6 +751,7 @@ void Info::improper_styles(FILE *out)
 
 void Info::kspace_styles(FILE *out)
 {
+  force->create_factories();
   fputs("\nKSpace styles:\n",out);
   print_columns(out, force->kspace_map);
   fputs("\n\n\n",out);
@@ -908,6 +930,7 @@ bool Info::is_defined(const char *category, const char *name)
 
 bool Info::has_style(const std::string &category, const std::string &name)
 {
+  force->create_factories();
   if (category == "atom") {
     return find_style(lmp, atom->avec_map, name, false);
   } else if (category == "integrate") {
@@ -942,6 +965,7 @@ bool Info::has_style(const std::string &category, const std::string &name)
 
 std::vector<std::string> Info::get_available_styles(const std::string &category)
 {
+  force->create_factories();
   if (category == "atom") {
     return get_style_names(atom->avec_map);
   } else if (category == "integrate") {
@@ -766,6 +766,13 @@ int Input::execute_command()
   int flag = 1;
 
   std::string mycmd = command;
+
+  // any command except another run and a few output-only commands may
+  //   perturb system state, which the "run pre auto" fast path relies on
+
+  if (mycmd != "run" && mycmd != "echo" && mycmd != "log" && mycmd != "print" &&
+      mycmd != "shell" && mycmd != "variable")
+    update->post_run_valid = 0;
   if (mycmd == "clear") clear();
   else if (mycmd == "echo") echo();
   else if (mycmd == "if") ifthenelse();
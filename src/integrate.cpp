@@ -81,8 +81,9 @@ void Integrate::ev_setup()
    based on
      (1) computes that need energy/virial info on this timestep
      (2) time dumps that may need per-atom compute info on this timestep
-     NOTE: inefficient to add all per-atom eng/virial computes
-             but don't know which ones the dump needs
+     NOTE: only per-atom eng/virial computes a time dump is known to
+             invoke are added, all of them until Output has learned
+             which ones the dumps need (first snapshot of the run)
            see NOTE in output.cpp
    invoke matchstep() on all timestep-dependent computes to clear their arrays
    eflag: set any or no bits
@@ -115,7 +116,7 @@ void Integrate::ev_set(bigint ntimestep)
   int eflag_atom = 0;
   for (auto &icompute : elist_atom)
     if (icompute->matchstep(ntimestep)) flag = 1;
-  if (flag || (tdflag && (elist_atom.size() > 0))) eflag_atom = ENERGY_ATOM;
+  if (flag || (tdflag && match_timedump(elist_atom))) eflag_atom = ENERGY_ATOM;
 
   if (eflag_global) update->eflag_global = ntimestep;
   if (eflag_atom) update->eflag_atom = ntimestep;
@@ -131,15 +132,30 @@ void Integrate::ev_set(bigint ntimestep)
   int vflag_atom = 0;
   for (auto &icompute : vlist_atom)
     if (icompute->matchstep(ntimestep)) flag = 1;
-  if (flag || (tdflag && (vlist_atom.size() > 0))) vflag_atom = VIRIAL_ATOM;
+  if (flag || (tdflag && match_timedump(vlist_atom))) vflag_atom = VIRIAL_ATOM;
 
   flag = 0;
   int cvflag_atom = 0;
   for (auto &icompute : cvlist_atom)
     if (icompute->matchstep(ntimestep)) flag = 1;
-  if (flag || (tdflag && (cvlist_atom.size() > 0))) cvflag_atom = VIRIAL_CENTROID;
+  if (flag || (tdflag && match_timedump(cvlist_atom))) cvflag_atom = VIRIAL_CENTROID;
 
   if (vflag_global) update->vflag_global = ntimestep;
   if (vflag_atom || cvflag_atom) update->vflag_atom = ntimestep;
   vflag = vflag_global + vflag_atom + cvflag_atom;
 }
+
+/* ----------------------------------------------------------------------
+   return 1 if a pending time dump requires a compute in list
+   until Output has learned which computes time dumps invoke,
+     conservatively assume any compute in list is required
+------------------------------------------------------------------------- */
+
+int Integrate::match_timedump(const std::vector<Compute *> &list)
+{
+  if (list.empty()) return 0;
+  if (!output->timedump_inputs_known) return 1;
+  for (const auto &icompute : list)
+    if (icompute->timedumpflag) return 1;
+  return 0;
+}
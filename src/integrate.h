@@ -44,6 +44,7 @@ class Integrate : protected Pointers {
 
   void ev_setup();
   void ev_set(bigint);
+  int match_timedump(const std::vector<Compute *> &);
 };
 
 }    // namespace LAMMPS_NS
@@ -68,6 +68,12 @@ Irregular::Irregular(LAMMPS *lmp) :
   memory->create(work1, nprocs, "irregular:work1");
   memory->create(work2, nprocs, "irregular:work2");
 
+  // cached plan graph, filled by first create_atom() call
+
+  cache_valid = 0;
+  cache_nsend = cache_nrecv = 0;
+  cache_proc_send = cache_proc_recv = nullptr;
+
   // initialize buffers for migrate atoms, not used for datum comm
   // these can persist for multiple irregular operations
 
@@ -89,6 +95,8 @@ Irregular::~Irregular()
   memory->destroy(work2);
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
+  delete [] cache_proc_send;
+  delete [] cache_proc_recv;
 }
 
 /* ----------------------------------------------------------------------
@@ -121,6 +129,10 @@ void Irregular::migrate_atoms(int sortflag, int preassign, int *procassign)
   atom->nghost = 0;
   atom->avec->clear_bonus();
 
+  // migration reorders the per-atom arrays
+
+  atom->peratom_epoch++;
+
   // subbox bounds for orthogonal or triclinic box
 
   double *sublo,*subhi;
@@ -318,21 +330,44 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
   for (i = 0; i < n; i++) work1[proclist[i]] = 1;
   work1[me] = 0;
 
+  // compare my set of send partners against the plan graph cached from the
+  //   previous call, cheap allreduce decides if the cached graph is reusable
+  // if no proc's send set changed, every proc's recv set is also unchanged,
+  //   so the collective receiver discovery below can be skipped entirely
+  // common for repeated migrations of slowly evolving decompositions,
+  //   e.g. fix deform or fix npt remaps, where consecutive plans are
+  //   nearly identical
+
+  int nsend = 0;
+  for (i = 0; i < nprocs; i++) nsend += work1[i];
+
+  int same = cache_valid && (nsend == cache_nsend);
+  if (same)
+    for (i = 0; i < cache_nsend; i++)
+      if (!work1[cache_proc_send[i]]) { same = 0; break; }
+
+  int allsame;
+  MPI_Allreduce(&same,&allsame,1,MPI_INT,MPI_MIN,world);
+
   // nrecv_proc = # of procs I receive messages from, not including self
+  // known from the cached graph if it is reusable on all procs
   // options for performing ReduceScatter operation
   // some are more efficient on some machines at big sizes
 
+  if (allsame) nrecv_proc = cache_nrecv;
+  else {
 #ifdef LAMMPS_RS_ALLREDUCE_INPLACE
-  MPI_Allreduce(MPI_IN_PLACE,work1,nprocs,MPI_INT,MPI_SUM,world);
-  nrecv_proc = work1[me];
+    MPI_Allreduce(MPI_IN_PLACE,work1,nprocs,MPI_INT,MPI_SUM,world);
+    nrecv_proc = work1[me];
 #else
 #ifdef LAMMPS_RS_ALLREDUCE
-  MPI_Allreduce(work1,work2,nprocs,MPI_INT,MPI_SUM,world);
-  nrecv_proc = work2[me];
+    MPI_Allreduce(work1,work2,nprocs,MPI_INT,MPI_SUM,world);
+    nrecv_proc = work2[me];
 #else
-  MPI_Reduce_scatter(work1,&nrecv_proc,work2,MPI_INT,MPI_SUM,world);
+    MPI_Reduce_scatter(work1,&nrecv_proc,work2,MPI_INT,MPI_SUM,world);
 #endif
 #endif
+  }
 
   // allocate receive arrays
 
@@ -402,6 +437,28 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
     else offset_send[i] = 0;
   }
 
+  // if the cached graph is reusable, the recv partners are already known,
+  //   so exchange message lengths point-to-point with them and return
+  // no sort or barrier needed: recv order is fixed by the cached list and
+  //   no MPI_ANY_SOURCE recv is posted that a data message could match
+
+  if (allsame) {
+    for (i = 0; i < nrecv_proc; i++) {
+      proc_recv[i] = cache_proc_recv[i];
+      MPI_Irecv(&length_recv[i],1,MPI_INT,proc_recv[i],0,world,&request[i]);
+    }
+    sendmax_proc = 0;
+    for (i = 0; i < nsend_proc; i++) {
+      MPI_Send(&length_send[i],1,MPI_INT,proc_send[i],0,world);
+      sendmax_proc = MAX(sendmax_proc,length_send[i]);
+    }
+    MPI_Waitall(nrecv_proc,request,status);
+
+    int nrecvsize = 0;
+    for (i = 0; i < nrecv_proc; i++) nrecvsize += length_recv[i];
+    return nrecvsize;
+  }
+
   // tell receivers how much data I send
   // sendmax_proc = # of doubles I send in largest single message
 
@@ -457,6 +514,18 @@ int Irregular::create_atom(int n, int *sizes, int *proclist, int sortflag)
     delete[] length_recv_ordered;
   }
 
+  // cache the plan graph for reuse by the next call
+
+  delete [] cache_proc_send;
+  delete [] cache_proc_recv;
+  cache_nsend = nsend_proc;
+  cache_nrecv = nrecv_proc;
+  cache_proc_send = new int[nsend_proc];
+  cache_proc_recv = new int[nrecv_proc];
+  memcpy(cache_proc_send,proc_send,nsend_proc*sizeof(int));
+  memcpy(cache_proc_recv,proc_recv,nrecv_proc*sizeof(int));
+  cache_valid = 1;
+
   // barrier to ensure all MPI_ANY_SOURCE messages are received
   // else another proc could proceed to exchange_atom() and send to me
 
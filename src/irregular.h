@@ -75,6 +75,16 @@ class Irregular : protected Pointers {
   int *length_recv;    // # of doubles to recv from each proc
   int *offset_send;    // where each atom starts in send buffer
 
+  // cached plan graph from previous create_atom() call
+  // reused when no proc's set of send partners has changed, which skips
+  //   the collective receiver discovery for repeated similar migrations
+
+  int cache_valid;        // 1 if cached send/recv proc lists are usable
+  int cache_nsend;        // # of procs previous plan sent to
+  int cache_nrecv;        // # of procs previous plan received from
+  int *cache_proc_send;   // procs previous plan sent to
+  int *cache_proc_recv;   // procs previous plan received from
+
   // extra plan params plan for irregular communication of datums
   // 2 self params refer to data copied to self
 
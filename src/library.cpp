@@ -2140,6 +2140,41 @@ void *lammps_extract_atom(void *handle, const char *name)
   return lmp->atom->extract(name);
 }
 
+/* ---------------------------------------------------------------------- */
+
+/** Get the validity epoch of per-atom data pointers
+ *
+\verbatim embed:rst
+
+.. versionadded:: TBD
+
+This function returns a counter that is incremented whenever the
+per-atom arrays of this rank are reallocated or reordered, i.e. when
+atoms migrate between sub-domains, when atoms are spatially sorted
+(see :doc:`atom_modify sort <atom_modify>`), or when the arrays grow.
+Pointers obtained from :cpp:func:`lammps_extract_atom` remain valid,
+and keep referring to the same atoms in the same order, for as long as
+the epoch is unchanged.  This allows callers to hold on to a per-atom
+buffer (e.g. a NumPy view created by the python module) across
+multiple timesteps and re-extract it only after the epoch has changed,
+instead of copying per-atom data on every access.
+
+The counter only ever increases during a simulation.  Comparisons must
+be for equality, not ordering, since the counter is process local:
+different MPI ranks reallocate and reorder independently.
+
+\endverbatim
+ *
+ * \param  handle  pointer to a previously created LAMMPS instance
+ * \return         per-atom buffer validity epoch of this rank
+ * */
+
+int64_t lammps_extract_atom_epoch(void *handle)
+{
+  auto lmp = (LAMMPS *) handle;
+  return (int64_t) lmp->atom->peratom_epoch;
+}
+
 // ----------------------------------------------------------------------
 // Library functions to access data from computes, fixes, variables in LAMMPS
 // ----------------------------------------------------------------------
@@ -2938,11 +2973,9 @@ void lammps_gather_atoms(void *handle, const char *name, int type, int count, vo
         }
 
       } else {
-        for (i = 0; i < nlocal; i++) {
-          offset = count*(tag[i]-1);
-          for (j = 0; j < count; j++)
-            copy[offset++] = array[i][j];
-        }
+        // rows of 2d arrays are contiguous: copy each atom's values en bloc
+        for (i = 0; i < nlocal; i++)
+          memcpy(&copy[count*(tag[i]-1)],array[i],count*sizeof(int));
       }
 
       MPI_Allreduce(copy,data,count*natoms,MPI_INT,MPI_SUM,lmp->world);
@@ -2966,11 +2999,8 @@ void lammps_gather_atoms(void *handle, const char *name, int type, int count, vo
           copy[tag[i]-1] = vector[i];
 
       } else {
-        for (i = 0; i < nlocal; i++) {
-          offset = count*(tag[i]-1);
-          for (j = 0; j < count; j++)
-            copy[offset++] = array[i][j];
-        }
+        for (i = 0; i < nlocal; i++)
+          memcpy(&copy[count*(tag[i]-1)],array[i],count*sizeof(double));
       }
 
       MPI_Allreduce(copy,data,count*natoms,MPI_DOUBLE,MPI_SUM,lmp->world);
@@ -3274,11 +3304,8 @@ void lammps_gather_atoms_subset(void *handle, const char *name, int type,
       } else {
         for (i = 0; i < ndata; i++) {
           id = ids[i];
-          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal) {
-            offset = count*i;
-            for (j = 0; j < count; j++)
-              copy[offset++] = array[m][j];
-          }
+          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal)
+            memcpy(&copy[count*i],array[m],count*sizeof(int));
         }
       }
 
@@ -3307,11 +3334,8 @@ void lammps_gather_atoms_subset(void *handle, const char *name, int type,
       } else {
         for (i = 0; i < ndata; i++) {
           id = ids[i];
-          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal) {
-            offset = count*i;
-            for (j = 0; j < count; j++)
-              copy[offset++] = array[m][j];
-          }
+          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal)
+            memcpy(&copy[count*i],array[m],count*sizeof(double));
         }
       }
 
@@ -3370,6 +3394,7 @@ void lammps_scatter_atoms(void *handle, const char *name, int type, int count,
                           void *data)
 {
   auto lmp = (LAMMPS *) handle;
+  lmp->update->post_run_valid = 0;
 
   BEGIN_CAPTURE
   {
@@ -3524,6 +3549,7 @@ void lammps_scatter_atoms_subset(void *handle, const char *name, int type,
                                  int count, int ndata, int *ids, void *data)
 {
   auto lmp = (LAMMPS *) handle;
+  lmp->update->post_run_valid = 0;
 
   BEGIN_CAPTURE
   {
@@ -4295,11 +4321,9 @@ void lammps_gather(void *handle, const char *name, int type, int count, void *da
         }
 
       } else {
-        for (i = 0; i < nlocal; i++) {
-          offset = count*(tag[i]-1);
-          for (j = 0; j < count; j++)
-            copy[offset++] = array[i][j];
-        }
+        // rows of 2d arrays are contiguous: copy each atom's values en bloc
+        for (i = 0; i < nlocal; i++)
+          memcpy(&copy[count*(tag[i]-1)],array[i],count*sizeof(int));
       }
 
       MPI_Allreduce(copy,data,count*natoms,MPI_INT,MPI_SUM,lmp->world);
@@ -4859,11 +4883,8 @@ void lammps_gather_subset(void *handle, const char *name, int type, int count,
       } else {
         for (i = 0; i < ndata; i++) {
           id = ids[i];
-          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal) {
-            offset = count*i;
-            for (j = 0; j < count; j++)
-              copy[offset++] = array[m][j];
-          }
+          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal)
+            memcpy(&copy[count*i],array[m],count*sizeof(int));
         }
       }
 
@@ -4893,11 +4914,8 @@ void lammps_gather_subset(void *handle, const char *name, int type, int count,
       } else {
         for (i = 0; i < ndata; i++) {
           id = ids[i];
-          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal) {
-            offset = count*i;
-            for (j = 0; j < count; j++)
-              copy[offset++] = array[m][j];
-          }
+          if ((m = lmp->atom->map(id)) >= 0 && m < nlocal)
+            memcpy(&copy[count*i],array[m],count*sizeof(double));
         }
       }
 
@@ -4976,6 +4994,7 @@ void lammps_scatter(void *handle, const char *name, int type, int count,
                     void *data)
 {
   auto lmp = (LAMMPS *) handle;
+  lmp->update->post_run_valid = 0;
 
   BEGIN_CAPTURE
   {
@@ -5223,6 +5242,7 @@ void lammps_scatter_subset(void *handle, const char *name,int type, int count, i
                            int *ids, void *data)
 {
   auto lmp = (LAMMPS *) handle;
+  lmp->update->post_run_valid = 0;
 
   BEGIN_CAPTURE
   {
@@ -5470,6 +5490,7 @@ int lammps_create_atoms(void *handle, int n, const tagint *id, const int *type,
                         int bexpand)
 {
   auto lmp = (LAMMPS *) handle;
+  lmp->update->post_run_valid = 0;
   bigint natoms_prev = lmp->atom->natoms;
 
   BEGIN_CAPTURE
@@ -6740,6 +6761,58 @@ void lammps_fix_external_set_virial_peratom(void *handle, const char *id, double
   END_CAPTURE
 }
 
+/** Set all energy and virial contributions for a fix external instance in one call.
+
+\verbatim embed:rst
+
+.. versionadded:: TBD
+
+This function combines :cpp:func:`lammps_fix_external_set_energy_global`,
+:cpp:func:`lammps_fix_external_set_virial_global`,
+:cpp:func:`lammps_fix_external_set_energy_peratom`, and
+:cpp:func:`lammps_fix_external_set_virial_peratom` into a single call.
+External codes that produce energies and virials together (e.g. machine
+learning potentials evaluating a whole batch at once) can thus hand all
+results to the fix with a single library call per step instead of up to
+four, each of which has to look up and validate the fix instance again.
+
+A NULL pointer for the *virial*, *eatom*, or *vatom* argument skips
+setting the corresponding quantity.  The units, ordering, and parallel
+semantics of each argument are identical to those of the individual
+functions listed above.
+
+Please see the documentation for :doc:`fix external <fix_external>` for
+more information about how to use the fix and how to couple it with an
+external code.
+
+\endverbatim
+ *
+ * \param  handle   pointer to a previously created LAMMPS instance cast to ``void *``.
+ * \param  id       fix ID of fix external instance
+ * \param  eng      total energy to be added to the global energy
+ * \param  virial   the 6 global stress tensor components to be added to the global virial or NULL
+ * \param  eatom    pointer to array of length nlocal with the energy to be added to the per-atom energy or NULL
+ * \param  vatom    a list of nlocal entries with the 6 per-atom stress tensor components or NULL */
+
+void lammps_fix_external_set_results(void *handle, const char *id, double eng, double *virial,
+                                     double *eatom, double **vatom)
+{
+  auto lmp = (LAMMPS *) handle;
+
+  BEGIN_CAPTURE
+  {
+    auto fix = lmp->modify->get_fix_by_id(id);
+    if (!fix) lmp->error->all(FLERR,"Can not find fix with ID '{}'!", id);
+
+    if (strcmp("external",fix->style) != 0)
+      lmp->error->all(FLERR,"Fix '{}' is not of style external!", id);
+
+    auto fext = dynamic_cast<FixExternal*>(fix);
+    fext->set_results(eng, virial, eatom, vatom);
+  }
+  END_CAPTURE
+}
+
 /** Set the vector length for a global vector stored with fix external for analysis
 
 \verbatim embed:rst
@@ -173,6 +173,7 @@ int lammps_map_atom(void *handle, const void *id);
 
 int lammps_extract_atom_datatype(void *handle, const char *name);
 void *lammps_extract_atom(void *handle, const char *name);
+int64_t lammps_extract_atom_epoch(void *handle);
 
 /* ----------------------------------------------------------------------
  * Library functions to access data from computes, fixes, variables in LAMMPS
@@ -292,6 +293,8 @@ void lammps_fix_external_set_energy_global(void *handle, const char *id, double
 void lammps_fix_external_set_energy_peratom(void *handle, const char *id, double *eng);
 void lammps_fix_external_set_virial_global(void *handle, const char *id, double *virial);
 void lammps_fix_external_set_virial_peratom(void *handle, const char *id, double **virial);
+void lammps_fix_external_set_results(void *handle, const char *id, double eng, double *virial,
+                                     double *eatom, double **vatom);
 void lammps_fix_external_set_vector_length(void *handle, const char *id, int len);
 void lammps_fix_external_set_vector(void *handle, const char *id, int idx, double val);
 
@@ -16,6 +16,18 @@
 
 #include "error.h"
 
+#include <cstdint>
+#include <cstring>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(__linux__) && !defined(LMP_USE_TBB_ALLOCATOR)
+#include <malloc.h>
+#include <sys/mman.h>
+#endif
+
 #if defined(LMP_INTEL) && ((defined(__INTEL_COMPILER) || defined(__INTEL_LLVM_COMPILER)))
 #ifndef LMP_INTEL_NO_TBB
 #define LMP_USE_TBB_ALLOCATOR
@@ -36,9 +48,46 @@
 
 using namespace LAMMPS_NS;
 
+// alignment of arena suballocations, also the size of their headers
+
+static constexpr bigint ARENA_ALIGN = 64;
+
+// minimum size of a new arena block
+
+static constexpr bigint ARENA_BLOCKMIN = 1048576;
+
+// minimum allocation size for NUMA first-touch treatment and
+// chunk granularity of the parallel touch/copy loops
+
+static constexpr bigint NUMA_TOUCH_MIN = 1048576;
+static constexpr bigint NUMA_PAGE = 4096;
+
+// minimum allocation size for transparent hugepage backing
+
+static constexpr bigint HUGEPAGE_MIN = 16777216;
+
+/* ---------------------------------------------------------------------- */
+
+Memory::Memory(LAMMPS *lmp) : Pointers(lmp)
+{
+  ablocks = nullptr;
+  nablock = maxablock = 0;
+  ahighwater = 0;
+
+  numa_touch = 0;
+  grow_headroom = 0;
+  hugepage = 0;
+}
+
 /* ---------------------------------------------------------------------- */
 
-Memory::Memory(LAMMPS *lmp) : Pointers(lmp) {}
+Memory::~Memory()
+{
+  int nb = nablock;
+  nablock = 0;    // detach blocks so sfree() releases instead of ignoring them
+  for (int i = 0; i < nb; i++) sfree(ablocks[i].data);
+  sfree(ablocks);
+}
 
 /* ----------------------------------------------------------------------
    safe malloc
@@ -63,6 +112,29 @@ void *Memory::smalloc(bigint nbytes, const char *name)
 #endif
   if (ptr == nullptr)
     error->one(FLERR,"Failed to allocate {} bytes for array {}", nbytes,name);
+
+  // request hugepage backing before the pages are faulted in
+
+#if defined(__linux__) && !defined(LMP_USE_TBB_ALLOCATOR)
+  if (hugepage && nbytes >= HUGEPAGE_MIN) hugepage_advise(ptr,nbytes);
+#endif
+
+  // NUMA first-touch: fault in the pages of large allocations from the
+  // threads that will stream over them, in equal page-aligned chunks
+
+#if defined(_OPENMP)
+  if (numa_touch && nbytes >= NUMA_TOUCH_MIN) {
+    bigint chunk = (nbytes + numa_touch - 1) / numa_touch;
+    chunk = (chunk + NUMA_PAGE - 1) / NUMA_PAGE * NUMA_PAGE;
+#pragma omp parallel num_threads(numa_touch)
+    {
+      const bigint lo = (bigint) omp_get_thread_num() * chunk;
+      const bigint hi = MIN(lo + chunk, nbytes);
+      if (lo < hi) memset((char *) ptr + lo, 0, hi - lo);
+    }
+  }
+#endif
+
   return ptr;
 }
 
@@ -72,11 +144,49 @@ void *Memory::smalloc(bigint nbytes, const char *name)
 
 void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
 {
+  if (ptr && nablock && arena_block(ptr) >= 0)
+    return srealloc_arena(ptr,nbytes,name);
+
   if (nbytes == 0) {
     destroy(ptr);
     return nullptr;
   }
 
+  // grow-ahead: reuse the existing capacity of the allocation when it
+  // already suffices, else round the request up by the configured
+  // headroom, so fluctuating sizes (e.g. GCMC insertions/deletions
+  // changing local atom counts) do not reallocate on every increase
+
+#if defined(__linux__) && !defined(LMP_USE_TBB_ALLOCATOR)
+  if (grow_headroom && ptr) {
+    if (nbytes <= (bigint) malloc_usable_size(ptr)) return ptr;
+    nbytes += nbytes/100 * grow_headroom;
+  }
+#endif
+
+  // NUMA first-touch: replace a large realloc by a freshly touched
+  // allocation plus a parallel copy, so a grown array keeps the page
+  // placement of the threads that use it instead of inheriting the
+  // master thread's placement from realloc's internal copy
+
+#if defined(_OPENMP) && defined(__linux__) && !defined(LMP_USE_TBB_ALLOCATOR)
+  if (numa_touch && ptr && nbytes >= NUMA_TOUCH_MIN) {
+    void *optr = ptr;
+    const bigint ncopy = MIN(nbytes,(bigint) malloc_usable_size(optr));
+    void *nptr = smalloc(nbytes,name);
+    bigint chunk = (nbytes + numa_touch - 1) / numa_touch;
+    chunk = (chunk + NUMA_PAGE - 1) / NUMA_PAGE * NUMA_PAGE;
+#pragma omp parallel num_threads(numa_touch)
+    {
+      const bigint lo = (bigint) omp_get_thread_num() * chunk;
+      const bigint hi = MIN(lo + chunk, ncopy);
+      if (lo < hi) memcpy((char *) nptr + lo, (char *) optr + lo, hi - lo);
+    }
+    free(optr);
+    return nptr;
+  }
+#endif
+
 #if defined(LMP_USE_TBB_ALLOCATOR)
   ptr = scalable_aligned_realloc(ptr, nbytes, LAMMPS_MEMALIGN);
 #elif defined(LMP_INTEL_NO_TBB) && defined(LAMMPS_MEMALIGN) && \
@@ -102,9 +212,165 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
   if (ptr == nullptr)
     error->one(FLERR,"Failed to reallocate {} bytes for array {}",
                                  nbytes,name);
+
+#if defined(__linux__) && !defined(LMP_USE_TBB_ALLOCATOR)
+  if (hugepage && nbytes >= HUGEPAGE_MIN) hugepage_advise(ptr,nbytes);
+#endif
+
   return ptr;
 }
 
+/* ----------------------------------------------------------------------
+   request transparent hugepage backing for a large allocation
+   madvise() needs page-aligned addresses, so advise the page-aligned
+     interior of the allocation and let the kernel collapse its pages
+------------------------------------------------------------------------- */
+
+void Memory::hugepage_advise(void *ptr, bigint nbytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  uintptr_t lo = ((uintptr_t) ptr + NUMA_PAGE - 1) / NUMA_PAGE * NUMA_PAGE;
+  uintptr_t hi = ((uintptr_t) ptr + (uintptr_t) nbytes) / NUMA_PAGE * NUMA_PAGE;
+  if (hi > lo) madvise((void *) lo, hi - lo, MADV_HUGEPAGE);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   suballocate from the epoch arena
+   result is only valid until the next arena_clear()
+------------------------------------------------------------------------- */
+
+void *Memory::smalloc_arena(bigint nbytes, const char *name)
+{
+  if (nbytes == 0) return nullptr;
+
+  bigint needed = (nbytes + ARENA_ALIGN - 1)/ARENA_ALIGN*ARENA_ALIGN + ARENA_ALIGN;
+
+  ArenaBlock *block;
+  if (nablock && ablocks[nablock-1].size - ablocks[nablock-1].used >= needed)
+    block = &ablocks[nablock-1];
+  else block = arena_add_block(needed);
+
+  char *base = block->data + block->used;
+  *((bigint *) base) = nbytes;
+  block->used += needed;
+  return base + ARENA_ALIGN;
+}
+
+/* ----------------------------------------------------------------------
+   grow an arena suballocation, preserving its contents
+   extends in place when ptr is the most recent suballocation,
+     else copies into a fresh one and abandons the old space
+     until the next arena_clear() reclaims it
+------------------------------------------------------------------------- */
+
+void *Memory::srealloc_arena(void *ptr, bigint nbytes, const char *name)
+{
+  if (ptr == nullptr) return smalloc_arena(nbytes,name);
+  if (nbytes == 0) return nullptr;
+
+  char *base = (char *) ptr - ARENA_ALIGN;
+  bigint oldbytes = *((bigint *) base);
+  if (nbytes <= oldbytes) return ptr;
+
+  bigint oldneeded = (oldbytes + ARENA_ALIGN - 1)/ARENA_ALIGN*ARENA_ALIGN + ARENA_ALIGN;
+  bigint needed = (nbytes + ARENA_ALIGN - 1)/ARENA_ALIGN*ARENA_ALIGN + ARENA_ALIGN;
+
+  ArenaBlock *block = &ablocks[nablock-1];
+  if (base + oldneeded == block->data + block->used &&
+      block->used - oldneeded + needed <= block->size) {
+    block->used += needed - oldneeded;
+    *((bigint *) base) = nbytes;
+    return ptr;
+  }
+
+  void *newptr = smalloc_arena(nbytes,name);
+  memcpy(newptr,ptr,oldbytes);
+  return newptr;
+}
+
+/* ----------------------------------------------------------------------
+   start a new arena epoch: all outstanding suballocations are invalidated
+   coalesce the blocks into a single high-water block, so that subsequent
+     epochs of up to the same total size perform no system allocator calls
+------------------------------------------------------------------------- */
+
+void Memory::arena_clear()
+{
+  if (nablock == 0) return;
+
+  bigint used = 0;
+  for (int i = 0; i < nablock; i++) used += ablocks[i].used;
+  ahighwater = MAX(ahighwater,used);
+
+  if (nablock > 1 || ablocks[0].size < ahighwater) {
+    int nb = nablock;
+    nablock = 0;    // detach blocks so sfree() releases instead of ignoring them
+    for (int i = 0; i < nb; i++) sfree(ablocks[i].data);
+    arena_add_block(ahighwater);
+  }
+
+  ablocks[0].used = 0;
+}
+
+/* ----------------------------------------------------------------------
+   total bytes of system memory reserved by the arena
+------------------------------------------------------------------------- */
+
+bigint Memory::arena_nbytes() const
+{
+  bigint size = 0;
+  for (int i = 0; i < nablock; i++) size += ablocks[i].size;
+  return size;
+}
+
+/* ----------------------------------------------------------------------
+   1 if ptr is an arena suballocation, else 0
+------------------------------------------------------------------------- */
+
+int Memory::arena_owned(const void *ptr) const
+{
+  return nablock && arena_block(ptr) >= 0;
+}
+
+/* ----------------------------------------------------------------------
+   append a new arena block large enough for nbytes
+   at least double the total arena size each time, to bound the number
+     of blocks (and copies) within one epoch
+------------------------------------------------------------------------- */
+
+Memory::ArenaBlock *Memory::arena_add_block(bigint nbytes)
+{
+  bigint size = MAX(nbytes,arena_nbytes());
+  size = MAX(size,ARENA_BLOCKMIN);
+  size = (size + ARENA_ALIGN - 1)/ARENA_ALIGN*ARENA_ALIGN;
+
+  if (nablock == maxablock) {
+    maxablock += 4;
+    ablocks = (ArenaBlock *)
+      srealloc(ablocks,maxablock*sizeof(ArenaBlock),"memory:ablocks");
+  }
+
+  ablocks[nablock].data = (char *) smalloc(size,"memory:arena");
+  ablocks[nablock].size = size;
+  ablocks[nablock].used = 0;
+  return &ablocks[nablock++];
+}
+
+/* ----------------------------------------------------------------------
+   index of the arena block containing ptr, else -1
+------------------------------------------------------------------------- */
+
+int Memory::arena_block(const void *ptr) const
+{
+  auto p = (uintptr_t) ptr;
+  for (int i = 0; i < nablock; i++) {
+    auto lo = (uintptr_t) ablocks[i].data;
+    if (p >= lo && p < lo + (uintptr_t) ablocks[i].size) return i;
+  }
+  return -1;
+}
+
 /* ----------------------------------------------------------------------
    safe free
 ------------------------------------------------------------------------- */
@@ -112,6 +378,7 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
 void Memory::sfree(void *ptr)
 {
   if (ptr == nullptr) return;
+  if (nablock && arena_block(ptr) >= 0) return;   // arena space, reclaimed by arena_clear()
   #if defined(LMP_USE_TBB_ALLOCATOR)
   scalable_aligned_free(ptr);
   #else
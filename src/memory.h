@@ -22,12 +22,49 @@ namespace LAMMPS_NS {
 class Memory : protected Pointers {
  public:
   Memory(class LAMMPS *);
+  ~Memory();
 
   void *smalloc(bigint n, const char *);
   void *srealloc(void *, bigint n, const char *);
   void sfree(void *);
   void fail(const char *);
 
+  // NUMA-aware first-touch policy, set by the OPENMP package
+  // when > 0, large fresh allocations are zeroed in parallel by this many
+  //   threads in equal page-aligned chunks, so that with pinned threads
+  //   each page is faulted in on the socket of the thread that will use it,
+  //   and large reallocations are replaced by allocate+parallel copy so
+  //   grown arrays keep that page placement
+
+  int numa_touch;
+
+  // grow-ahead policy, set by atom_modify headroom
+  // when > 0, growing reallocations first reuse the existing capacity
+  //   of the allocation if it suffices, else request this many percent
+  //   extra capacity, so fluctuating sizes do not realloc continuously
+
+  int grow_headroom;
+
+  // 1 to request transparent hugepage backing (madvise) for allocations
+  //   beyond a size threshold, set by atom_modify hugepage
+
+  int hugepage;
+
+  // epoch arena for transient buffers rebuilt every reneighbor
+  // allocations are bump-pointer suballocations of a few large blocks
+  // arena_clear() starts a new epoch: it invalidates all outstanding
+  //   arena pointers and coalesces the blocks to one high-water block,
+  //   so steady-state epochs perform no system allocator calls
+  // srealloc/sfree recognize arena pointers and reroute/ignore them,
+  //   so arena arrays may be passed to the regular grow/destroy methods
+
+  void *smalloc_arena(bigint n, const char *);
+  void *srealloc_arena(void *, bigint n, const char *);
+  void arena_clear();
+  bigint arena_nbytes() const;
+  bigint arena_highwater() const { return ahighwater; }
+  int arena_owned(const void *) const;
+
 /* ----------------------------------------------------------------------
    create/grow/destroy vecs and multidim arrays with contiguous memory blocks
    only use with primitive data types, e.g. 1d vec of ints, 2d array of doubles
@@ -96,6 +133,40 @@ class Memory : protected Pointers {
     array = nullptr;
   }
 
+/* ----------------------------------------------------------------------
+   create/grow a 1d array suballocated from the epoch arena
+   only valid until the next arena_clear()
+   destroy() such an array as usual: the space is reclaimed by the arena
+------------------------------------------------------------------------- */
+
+  template <typename TYPE> TYPE *create_arena(TYPE *&array, int n, const char *name)
+  {
+    bigint nbytes = ((bigint) sizeof(TYPE)) * n;
+    array = (TYPE *) smalloc_arena(nbytes, name);
+    return array;
+  }
+
+  template <typename TYPE> TYPE **create_arena(TYPE **& /*array*/, int /*n*/, const char *name)
+  {
+    fail(name);
+    return nullptr;
+  }
+
+  template <typename TYPE> TYPE *grow_arena(TYPE *&array, int n, const char *name)
+  {
+    if (array == nullptr) return create_arena(array, n, name);
+
+    bigint nbytes = ((bigint) sizeof(TYPE)) * n;
+    array = (TYPE *) srealloc_arena(array, nbytes, name);
+    return array;
+  }
+
+  template <typename TYPE> TYPE **grow_arena(TYPE **& /*array*/, int /*n*/, const char *name)
+  {
+    fail(name);
+    return nullptr;
+  }
+
 // -------------------------------------------------------------------------
 // -------------------------------------------------------------------------
 // -------------------------------------------------------------------------
@@ -941,6 +1012,25 @@ class Memory : protected Pointers {
     bytes += ((double) sizeof(TYPE ***)) * n1;
     return bytes;
   }
+
+ private:
+  // epoch arena state
+  // each allocation is preceded by an alignment-sized header with its size
+
+  struct ArenaBlock {
+    char *data;     // block storage, allocated via smalloc
+    bigint size;    // bytes in block
+    bigint used;    // bytes handed out, multiple of the arena alignment
+  };
+
+  ArenaBlock *ablocks;    // blocks owned by the arena, last one is active
+  int nablock;            // # of blocks
+  int maxablock;          // allocated length of ablocks
+  bigint ahighwater;      // max total bytes used over all completed epochs
+
+  ArenaBlock *arena_add_block(bigint nbytes);
+  int arena_block(const void *) const;
+  void hugepage_advise(void *, bigint);
 };
 
 }    // namespace LAMMPS_NS
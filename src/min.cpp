@@ -723,6 +723,7 @@ void Min::modify_params(int narg, char **arg)
       if (strcmp(arg[iarg+1],"backtrack") == 0) linestyle = BACKTRACK;
       else if (strcmp(arg[iarg+1],"quadratic") == 0) linestyle = QUADRATIC;
       else if (strcmp(arg[iarg+1],"forcezero") == 0) linestyle = FORCEZERO;
+      else if (strcmp(arg[iarg+1],"secant") == 0) linestyle = SECANT;
       else if (strcmp(arg[iarg+1],"spin_cubic") == 0) linestyle = SPIN_CUBIC;
       else if (strcmp(arg[iarg+1],"spin_none") == 0) linestyle = SPIN_NONE;
       else error->all(FLERR,"Illegal min_modify command");
@@ -77,7 +77,7 @@ class Min : protected Pointers {
   enum { EULERIMPLICIT, VERLET, LEAPFROG, EULEREXPLICIT };
 
   // line search styles
-  enum { BACKTRACK, QUADRATIC, FORCEZERO, SPIN_CUBIC, SPIN_NONE };
+  enum { BACKTRACK, QUADRATIC, FORCEZERO, SECANT, SPIN_CUBIC, SPIN_NONE };
 
  protected:
   int eflag, vflag;            // flags for energy/virial computation
@@ -0,0 +1,338 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "min_cg_precond.h"
+
+#include "atom.h"
+#include "comm.h"
+#include "error.h"
+#include "fix_minimize.h"
+#include "force.h"
+#include "neigh_list.h"
+#include "neighbor.h"
+#include "output.h"
+#include "pair.h"
+#include "timer.h"
+#include "update.h"
+
+#include <cmath>
+
+using namespace LAMMPS_NS;
+
+// EPS_ENERGY = minimum normalization for energy tolerance
+
+static constexpr double EPS_ENERGY = 1.0e-8;
+
+/* ---------------------------------------------------------------------- */
+
+MinCGPrecond::MinCGPrecond(LAMMPS *lmp) : MinLineSearch(lmp)
+{
+  pd = nullptr;
+  ncalls_last = -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MinCGPrecond::init()
+{
+  MinLineSearch::init();
+  ncalls_last = -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MinCGPrecond::setup_style()
+{
+  MinLineSearch::setup_style();
+
+  // memory for diagonal preconditioner, stored per-atom so it migrates
+
+  fix_minimize->add_vector(3);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void MinCGPrecond::reset_vectors()
+{
+  MinLineSearch::reset_vectors();
+  pd = fix_minimize->request_vector(3 + 3*nextra_atom);
+}
+
+/* ----------------------------------------------------------------------
+   refresh the diagonal preconditioner from per-atom neighbor counts
+   called whenever a force evaluation rebuilt the neighbor lists
+   pd[i] = mean(1+nn)/(1+nn_i), so loosely coordinated (soft) dof take
+   larger steps than densely coordinated (stiff) dof
+------------------------------------------------------------------------- */
+
+void MinCGPrecond::precond_update()
+{
+  int i,ii,j,jj,inum,jnum;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  if (neighbor->ncalls == ncalls_last) return;
+  ncalls_last = neighbor->ncalls;
+
+  NeighList *nlist = nullptr;
+  if (force->pair) nlist = neighbor->find_list(force->pair);
+
+  // no pairwise neighbor list available: identity preconditioner
+
+  if (!nlist || !nlist->numneigh) {
+    for (i = 0; i < nvec; i++) pd[i] = 1.0;
+    return;
+  }
+
+  // count neighbors of owned + ghost atoms, borrowing f as scratch
+  //   space since x0 holds a copy and ghost forces are transient
+  // i and j are both incremented, so with a half list owners receive
+  //   their full count after the reverse comm, and with a full list
+  //   every count is uniformly doubled, which the normalization below
+  //   cancels out
+
+  double **f = atom->f;
+  const int nlocal = atom->nlocal;
+  const int nall = nlocal + atom->nghost;
+
+  for (i = 0; i < nvec; i++) x0[i] = fvec[i];
+  for (i = 0; i < nall; i++) f[i][0] = f[i][1] = f[i][2] = 0.0;
+
+  inum = nlist->inum;
+  ilist = nlist->ilist;
+  numneigh = nlist->numneigh;
+  firstneigh = nlist->firstneigh;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+    f[i][0] += jnum;
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj] & NEIGHMASK;
+      f[j][0] += 1.0;
+    }
+  }
+
+  if (force->newton_pair) comm->reverse_comm();
+
+  // normalize so the mean diagonal is 1, which keeps the alpha limits
+  //   of the line searches operating on the usual force scale
+
+  double sum = 0.0;
+  for (i = 0; i < nlocal; i++) sum += 1.0 + f[i][0];
+  double sumall;
+  MPI_Allreduce(&sum,&sumall,1,MPI_DOUBLE,MPI_SUM,world);
+  const double mean = sumall/atom->natoms;
+
+  for (i = 0; i < nlocal; i++) {
+    const double scale = mean/(1.0 + f[i][0]);
+    pd[3*i] = pd[3*i+1] = pd[3*i+2] = scale;
+  }
+
+  // restore forces
+
+  for (i = 0; i < nvec; i++) fvec[i] = x0[i];
+}
+
+/* ----------------------------------------------------------------------
+   minimization via preconditioned conjugate gradient iterations
+   same logic as MinCG, but the search direction is built from the
+   preconditioned gradient z = M^-1 f with preconditioned Polak-Ribiere
+   beta; extra global/per-atom dof use an identity preconditioner
+------------------------------------------------------------------------- */
+
+int MinCGPrecond::iterate(int maxiter)
+{
+  int i,m,n,fail,ntimestep;
+  double beta,zg,dot[4],dotall[4],fdotf;
+  double *fatom,*gatom,*hatom;
+
+  // nlimit = max # of CG iterations before restarting
+  // set to ndoftotal unless too big
+
+  int nlimit = static_cast<int> (MIN(MAXSMALLINT,ndoftotal));
+
+  // initialize working vectors, h = z = M^-1 f
+
+  precond_update();
+
+  for (i = 0; i < nvec; i++) {
+    g[i] = fvec[i];
+    h[i] = pd[i]*fvec[i];
+  }
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      fatom = fextra_atom[m];
+      gatom = gextra_atom[m];
+      hatom = hextra_atom[m];
+      n = extra_nlen[m];
+      for (i = 0; i < n; i++) hatom[i] = gatom[i] = fatom[i];
+    }
+  if (nextra_global)
+    for (i = 0; i < nextra_global; i++) hextra[i] = gextra[i] = fextra[i];
+
+  // zg = z dot g, denominator of the preconditioned beta
+
+  dot[0] = 0.0;
+  for (i = 0; i < nvec; i++) dot[0] += pd[i]*fvec[i]*fvec[i];
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      fatom = fextra_atom[m];
+      n = extra_nlen[m];
+      for (i = 0; i < n; i++) dot[0] += fatom[i]*fatom[i];
+    }
+  MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+  if (nextra_global)
+    for (i = 0; i < nextra_global; i++) dotall[0] += fextra[i]*fextra[i];
+  zg = dotall[0];
+
+  for (int iter = 0; iter < maxiter; iter++) {
+
+    if (timer->check_timeout(niter))
+      return TIMEOUT;
+
+    ntimestep = ++update->ntimestep;
+    niter++;
+
+    // line minimization along direction h from current atom->x
+
+    eprevious = ecurrent;
+    fail = (this->*linemin)(ecurrent,alpha_final);
+    if (fail) return fail;
+
+    // function evaluation criterion
+
+    if (neval >= update->max_eval) return MAXEVAL;
+
+    // energy tolerance criterion
+
+    if (fabs(ecurrent-eprevious) <
+        update->etol * 0.5*(fabs(ecurrent) + fabs(eprevious) + EPS_ENERGY))
+      return ETOL;
+
+    // refresh preconditioner if the line search reneighbored
+
+    precond_update();
+
+    // force tolerance criterion
+    // dots: f.f, f.g, z.f, z.g with z = M^-1 f and g = old f
+
+    dot[0] = dot[1] = dot[2] = dot[3] = 0.0;
+    for (i = 0; i < nvec; i++) {
+      dot[0] += fvec[i]*fvec[i];
+      dot[1] += fvec[i]*g[i];
+      dot[2] += pd[i]*fvec[i]*fvec[i];
+      dot[3] += pd[i]*fvec[i]*g[i];
+    }
+
+    if (nextra_atom)
+      for (m = 0; m < nextra_atom; m++) {
+        fatom = fextra_atom[m];
+        gatom = gextra_atom[m];
+        n = extra_nlen[m];
+        for (i = 0; i < n; i++) {
+          dot[0] += fatom[i]*fatom[i];
+          dot[1] += fatom[i]*gatom[i];
+          dot[2] += fatom[i]*fatom[i];
+          dot[3] += fatom[i]*gatom[i];
+        }
+      }
+    MPI_Allreduce(dot,dotall,4,MPI_DOUBLE,MPI_SUM,world);
+    if (nextra_global)
+      for (i = 0; i < nextra_global; i++) {
+        dotall[0] += fextra[i]*fextra[i];
+        dotall[1] += fextra[i]*gextra[i];
+        dotall[2] += fextra[i]*fextra[i];
+        dotall[3] += fextra[i]*gextra[i];
+      }
+
+    fdotf = 0.0;
+    if (update->ftol > 0.0) {
+      if (normstyle == MAX) fdotf = fnorm_max();        // max force norm
+      else if (normstyle == INF) fdotf = fnorm_inf();   // infinite force norm
+      else if (normstyle == TWO) fdotf = dotall[0];     // same as fnorm_sqr(), Euclidean force 2-norm
+      else error->all(FLERR,"Illegal min_modify command");
+      if (fdotf < update->ftol*update->ftol) return FTOL;
+    }
+
+    // update new search direction h from new z = M^-1 f and old g
+    // this is the preconditioned Polak-Ribiere formulation
+    // reinitialize CG every ndof iterations by setting beta = 0.0
+
+    beta = MAX(0.0,(dotall[2] - dotall[3])/zg);
+    if ((niter+1) % nlimit == 0) beta = 0.0;
+    zg = dotall[2];
+
+    for (i = 0; i < nvec; i++) {
+      g[i] = fvec[i];
+      h[i] = pd[i]*g[i] + beta*h[i];
+    }
+    if (nextra_atom)
+      for (m = 0; m < nextra_atom; m++) {
+        fatom = fextra_atom[m];
+        gatom = gextra_atom[m];
+        hatom = hextra_atom[m];
+        n = extra_nlen[m];
+        for (i = 0; i < n; i++) {
+          gatom[i] = fatom[i];
+          hatom[i] = gatom[i] + beta*hatom[i];
+        }
+      }
+    if (nextra_global)
+      for (i = 0; i < nextra_global; i++) {
+        gextra[i] = fextra[i];
+        hextra[i] = gextra[i] + beta*hextra[i];
+      }
+
+    // reinitialize CG if new search direction h is not downhill
+    // the fallback h = z is always downhill since M^-1 is positive
+
+    dot[0] = 0.0;
+    for (i = 0; i < nvec; i++) dot[0] += g[i]*h[i];
+    if (nextra_atom)
+      for (m = 0; m < nextra_atom; m++) {
+        gatom = gextra_atom[m];
+        hatom = hextra_atom[m];
+        n = extra_nlen[m];
+        for (i = 0; i < n; i++) dot[0] += gatom[i]*hatom[i];
+      }
+    MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+    if (nextra_global)
+      for (i = 0; i < nextra_global; i++)
+        dotall[0] += gextra[i]*hextra[i];
+
+    if (dotall[0] <= 0.0) {
+      for (i = 0; i < nvec; i++) h[i] = pd[i]*g[i];
+      if (nextra_atom)
+        for (m = 0; m < nextra_atom; m++) {
+          gatom = gextra_atom[m];
+          hatom = hextra_atom[m];
+          n = extra_nlen[m];
+          for (i = 0; i < n; i++) hatom[i] = gatom[i];
+        }
+      if (nextra_global)
+        for (i = 0; i < nextra_global; i++) hextra[i] = gextra[i];
+    }
+
+    // output for thermo, dump, restart files
+
+    if (output->next == ntimestep) {
+      timer->stamp();
+      output->write(ntimestep);
+      timer->stamp(Timer::OUTPUT);
+    }
+  }
+
+  return MAXITER;
+}
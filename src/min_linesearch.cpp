@@ -78,6 +78,7 @@ void MinLineSearch::init()
   if (linestyle == BACKTRACK) linemin = &MinLineSearch::linemin_backtrack;
   else if (linestyle == QUADRATIC) linemin = &MinLineSearch::linemin_quadratic;
   else if (linestyle == FORCEZERO) linemin = &MinLineSearch::linemin_forcezero;
+  else if (linestyle == SECANT) linemin = &MinLineSearch::linemin_secant;
 
   delete[] gextra;
   delete[] hextra;
@@ -826,6 +827,134 @@ int MinLineSearch::linemin_forcezero(double eoriginal, double &alpha)
   }
 }
 
+/* ----------------------------------------------------------------------
+   linemin: secant step on the force projection
+   the directional derivative at alpha = 0 comes for free from the
+   forces left over by the previous evaluation, so no extra energy call
+   is needed to anchor the model: one trial evaluation at alpha_max
+   plus one secant step to the projected force zero typically suffice
+   falls back to plain backtracking when the model is not convex or the
+   energy did not decrease sufficiently
+------------------------------------------------------------------------- */
+
+int MinLineSearch::linemin_secant(double eoriginal, double &alpha)
+{
+  int i,m,n;
+  double fdothall,fdothme,hme,hmax,hmaxall;
+  double de_ideal,de;
+  double ff,fh,delfh,alpha0,alphamax;
+  double *xatom,*x0atom,*fatom,*hatom;
+
+  // fdothall = projection of search dir along downhill gradient
+  // if search direction is not downhill, exit with error
+
+  fdothme = 0.0;
+  for (i = 0; i < nvec; i++) fdothme += fvec[i]*h[i];
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      fatom = fextra_atom[m];
+      hatom = hextra_atom[m];
+      n = extra_nlen[m];
+      for (i = 0; i < n; i++) fdothme += fatom[i]*hatom[i];
+    }
+  MPI_Allreduce(&fdothme,&fdothall,1,MPI_DOUBLE,MPI_SUM,world);
+  if (nextra_global)
+    for (i = 0; i < nextra_global; i++) fdothall += fextra[i]*hextra[i];
+  if (output->thermo->normflag) fdothall /= atom->natoms;
+  if (fdothall <= 0.0) return DOWNHILL;
+
+  // set alphamax so no dof is changed by more than max allowed amount
+  // for atom coords, max amount = dmax
+  // for extra per-atom dof, max amount = extra_max[]
+  // for extra global dof, max amount is set by fix
+  // also ensure alphamax <= ALPHA_MAX
+  // if all search dir components are already 0.0, exit with error
+
+  hme = 0.0;
+  for (i = 0; i < nvec; i++) hme = MAX(hme,fabs(h[i]));
+  MPI_Allreduce(&hme,&hmaxall,1,MPI_DOUBLE,MPI_MAX,world);
+  alphamax = MIN(ALPHA_MAX,dmax/hmaxall);
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      hatom = hextra_atom[m];
+      n = extra_nlen[m];
+      hme = 0.0;
+      for (i = 0; i < n; i++) hme = MAX(hme,fabs(hatom[i]));
+      MPI_Allreduce(&hme,&hmax,1,MPI_DOUBLE,MPI_MAX,world);
+      alphamax = MIN(alphamax,extra_max[m]/hmax);
+      hmaxall = MAX(hmaxall,hmax);
+    }
+  if (nextra_global) {
+    double alpha_extra = modify->max_alpha(hextra);
+    alphamax = MIN(alphamax,alpha_extra);
+    for (i = 0; i < nextra_global; i++)
+      hmaxall = MAX(hmaxall,fabs(hextra[i]));
+  }
+  if (hmaxall == 0.0) return ZEROFORCE;
+
+  // store box and values of all dof at start of linesearch
+
+  fix_minimize->store_box();
+  for (i = 0; i < nvec; i++) x0[i] = xvec[i];
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      xatom = xextra_atom[m];
+      x0atom = x0extra_atom[m];
+      n = extra_nlen[m];
+      for (i = 0; i < n; i++) x0atom[i] = xatom[i];
+    }
+  if (nextra_global) modify->min_store();
+
+  // trial evaluation at alphamax, then one secant step toward the zero
+  //   of the force projection when the curvature along h is positive
+  // skip the secant step when it lands close to the trial point or
+  //   beyond alphamax, i.e. the trial evaluation is reused as is
+
+  alpha = alphamax;
+  ecurrent = alpha_step(alpha,1);
+  fh = compute_dir_deriv(ff);
+
+  delfh = fdothall - fh;
+  if (delfh > EPS_QUAD) {
+    alpha0 = MIN(alpha*fdothall/delfh,alphamax);
+    if (fabs(alpha0 - alpha) > QUADRATIC_TOL*alpha) {
+      alpha = alpha0;
+      ecurrent = alpha_step(alpha,1);
+    }
+  }
+
+  // accept if the energy decrease is sufficient, else backtrack
+
+  while (true) {
+    de_ideal = -BACKTRACK_SLOPE*alpha*fdothall;
+    de = ecurrent - eoriginal;
+    if (de <= de_ideal) {
+      if (nextra_global) {
+        int itmp = modify->min_reset_ref();
+        if (itmp) ecurrent = energy_force(1);
+      }
+      return 0;
+    }
+
+    // reduce alpha
+
+    alpha *= ALPHA_REDUCE;
+
+    // backtracked too much
+    // reset to starting point
+    // if de is positive, exit with error
+    // if de is negative, exit with ETOL
+
+    if (alpha <= 0.0 || de_ideal >= -EMACH) {
+      ecurrent = alpha_step(0.0,0);
+      if (de < 0.0) return ETOL;
+      else return ZEROALPHA;
+    }
+
+    ecurrent = alpha_step(alpha,1);
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 double MinLineSearch::alpha_step(double alpha, int resetflag)
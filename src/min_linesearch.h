@@ -47,6 +47,7 @@ class MinLineSearch : public Min {
   int linemin_backtrack(double, double &);
   int linemin_quadratic(double, double &);
   int linemin_forcezero(double, double &);
+  int linemin_secant(double, double &);
 
   double alpha_step(double, int);
   double compute_dir_deriv(double &);
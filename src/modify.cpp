@@ -24,7 +24,9 @@
 #include "group.h"
 #include "input.h"
 #include "memory.h"
+#include "platform.h"
 #include "region.h"
+#include "timer.h"
 #include "update.h"
 #include "variable.h"
 
@@ -210,6 +212,10 @@ void Modify::init()
     fix[i]->init_flags();
   }
 
+  // reset per-fix hook timings, tallied per run like the Timer arrays
+
+  for (i = 0; i < nfix; i++) fix[i]->fixtime = 0.0;
+
   // set global flag if any fix has its restart_pbc flag set
 
   restart_pbc_any = 0;
@@ -395,8 +401,20 @@ void Modify::setup_pre_reverse(int eflag, int vflag)
 
 void Modify::initial_integrate(int vflag)
 {
-  for (int i = 0; i < n_initial_integrate; i++)
-    fix[list_initial_integrate[i]]->initial_integrate(vflag);
+  if (!timer->has_full()) {
+    for (int i = 0; i < n_initial_integrate; i++)
+      fix[list_initial_integrate[i]]->initial_integrate(vflag);
+    return;
+  }
+
+  // tally per-fix wall time at timer full level
+
+  for (int i = 0; i < n_initial_integrate; i++) {
+    Fix *f = fix[list_initial_integrate[i]];
+    double tstart = platform::walltime();
+    f->initial_integrate(vflag);
+    f->fixtime += platform::walltime() - tstart;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -405,7 +423,17 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  for (int i = 0; i < n_post_integrate; i++) fix[list_post_integrate[i]]->post_integrate();
+  if (!timer->has_full()) {
+    for (int i = 0; i < n_post_integrate; i++) fix[list_post_integrate[i]]->post_integrate();
+    return;
+  }
+
+  for (int i = 0; i < n_post_integrate; i++) {
+    Fix *f = fix[list_post_integrate[i]];
+    double tstart = platform::walltime();
+    f->post_integrate();
+    f->fixtime += platform::walltime() - tstart;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -441,7 +469,17 @@ void Modify::post_neighbor()
 
 void Modify::pre_force(int vflag)
 {
-  for (int i = 0; i < n_pre_force; i++) fix[list_pre_force[i]]->pre_force(vflag);
+  if (!timer->has_full()) {
+    for (int i = 0; i < n_pre_force; i++) fix[list_pre_force[i]]->pre_force(vflag);
+    return;
+  }
+
+  for (int i = 0; i < n_pre_force; i++) {
+    Fix *f = fix[list_pre_force[i]];
+    double tstart = platform::walltime();
+    f->pre_force(vflag);
+    f->fixtime += platform::walltime() - tstart;
+  }
 }
 /* ----------------------------------------------------------------------
    pre_reverse call, only for relevant fixes
@@ -449,7 +487,17 @@ void Modify::pre_force(int vflag)
 
 void Modify::pre_reverse(int eflag, int vflag)
 {
-  for (int i = 0; i < n_pre_reverse; i++) fix[list_pre_reverse[i]]->pre_reverse(eflag, vflag);
+  if (!timer->has_full()) {
+    for (int i = 0; i < n_pre_reverse; i++) fix[list_pre_reverse[i]]->pre_reverse(eflag, vflag);
+    return;
+  }
+
+  for (int i = 0; i < n_pre_reverse; i++) {
+    Fix *f = fix[list_pre_reverse[i]];
+    double tstart = platform::walltime();
+    f->pre_reverse(eflag, vflag);
+    f->fixtime += platform::walltime() - tstart;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -460,12 +508,34 @@ void Modify::pre_reverse(int eflag, int vflag)
 
 void Modify::post_force(int vflag)
 {
+  if (!timer->has_full()) {
+    if (n_post_force_group) {
+      for (int i = 0; i < n_post_force_group; i++)
+        fix[list_post_force_group[i]]->post_force(vflag);
+    }
+
+    if (n_post_force) {
+      for (int i = 0; i < n_post_force; i++) fix[list_post_force[i]]->post_force(vflag);
+    }
+    return;
+  }
+
   if (n_post_force_group) {
-    for (int i = 0; i < n_post_force_group; i++) fix[list_post_force_group[i]]->post_force(vflag);
+    for (int i = 0; i < n_post_force_group; i++) {
+      Fix *f = fix[list_post_force_group[i]];
+      double tstart = platform::walltime();
+      f->post_force(vflag);
+      f->fixtime += platform::walltime() - tstart;
+    }
   }
 
   if (n_post_force) {
-    for (int i = 0; i < n_post_force; i++) fix[list_post_force[i]]->post_force(vflag);
+    for (int i = 0; i < n_post_force; i++) {
+      Fix *f = fix[list_post_force[i]];
+      double tstart = platform::walltime();
+      f->post_force(vflag);
+      f->fixtime += platform::walltime() - tstart;
+    }
   }
 }
 
@@ -475,7 +545,17 @@ void Modify::post_force(int vflag)
 
 void Modify::final_integrate()
 {
-  for (int i = 0; i < n_final_integrate; i++) fix[list_final_integrate[i]]->final_integrate();
+  if (!timer->has_full()) {
+    for (int i = 0; i < n_final_integrate; i++) fix[list_final_integrate[i]]->final_integrate();
+    return;
+  }
+
+  for (int i = 0; i < n_final_integrate; i++) {
+    Fix *f = fix[list_final_integrate[i]];
+    double tstart = platform::walltime();
+    f->final_integrate();
+    f->fixtime += platform::walltime() - tstart;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -485,8 +565,19 @@ void Modify::final_integrate()
 
 void Modify::end_of_step()
 {
+  if (!timer->has_full()) {
+    for (int i = 0; i < n_end_of_step; i++)
+      if (update->ntimestep % end_of_step_every[i] == 0) fix[list_end_of_step[i]]->end_of_step();
+    return;
+  }
+
   for (int i = 0; i < n_end_of_step; i++)
-    if (update->ntimestep % end_of_step_every[i] == 0) fix[list_end_of_step[i]]->end_of_step();
+    if (update->ntimestep % end_of_step_every[i] == 0) {
+      Fix *f = fix[list_end_of_step[i]];
+      double tstart = platform::walltime();
+      f->end_of_step();
+      f->fixtime += platform::walltime() - tstart;
+    }
 }
 
 /* ----------------------------------------------------------------------
@@ -181,6 +181,7 @@ template <class T> void MyPage<T>::deallocate()
 
 namespace LAMMPS_NS {
 template class MyPage<int>;
+template class MyPage<unsigned short>;
 template class MyPage<long>;
 template class MyPage<long long>;
 template class MyPage<double>;
@@ -18,9 +18,13 @@
 #include "comm.h"
 #include "neighbor.h"
 #include "neigh_request.h"
+#include "error.h"
 #include "my_page.h"
 #include "memory.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace LAMMPS_NS;
 
 static constexpr int PGDELTA = 1;
@@ -64,6 +68,28 @@ NeighList::NeighList(LAMMPS *lmp) : Pointers(lmp)
 
   ipage = nullptr;
 
+  // cluster-pair format
+
+  clusterflag = 0;
+  nclusters = 0;
+  cluster_numneigh = nullptr;
+  cluster_firstneigh = nullptr;
+  maxcluster = 0;
+  cpage = nullptr;
+
+  // compressed list storage
+
+  compressflag = 0;
+  firstneigh16 = nullptr;
+  maxatom16 = 0;
+  upage = nullptr;
+
+  // special-bond partition
+
+  specialsortflag = 0;
+  numplain = nullptr;
+  maxplain = 0;
+
   // extra rRESPA lists
 
   inum_inner = gnum_inner = 0;
@@ -106,6 +132,15 @@ NeighList::~NeighList()
     delete [] ipage;
   }
 
+  memory->destroy(cluster_numneigh);
+  memory->sfree(cluster_firstneigh);
+  delete [] cpage;
+
+  memory->sfree(firstneigh16);
+  delete [] upage;
+
+  memory->destroy(numplain);
+
   if (respainner) {
     memory->destroy(ilist_inner);
     memory->destroy(numneigh_inner);
@@ -209,6 +244,12 @@ void NeighList::setup_pages(int pgsize_caller, int oneatom_caller)
 
 void NeighList::grow(int nlocal, int nall)
 {
+  // any previously built cluster, compressed, or partition data is now stale
+
+  clusterflag = 0;
+  compressflag = 0;
+  specialsortflag = 0;
+
   // skip if data structs are already big enough
 
   if (ssa) {
@@ -251,6 +292,210 @@ void NeighList::grow(int nlocal, int nall)
   }
 }
 
+/* ----------------------------------------------------------------------
+   derive cluster-pair format from the just-built full list
+   groups of CLUSTER_SIZE consecutive I atoms in ilist share one J list
+   shared J list = union of the J lists of the I atoms in the cluster
+   consumers iterate one J list per cluster -> SIMD across the I lanes
+     with contiguous loads of x[] instead of per-I gather
+   only called by styles which requested a full list, so each I,J pair
+     is computed one-sided and duplicates across clusters cannot occur
+------------------------------------------------------------------------- */
+
+void NeighList::build_clusters()
+{
+  int i,j,k,n,c,jj,jnum,ibase,nicluster;
+  int *jlist,*neighptr;
+
+  int nall = atom->nlocal + atom->nghost;
+
+  // stamp[j] = index of last cluster that added atom J, for dedup
+
+  int *stamp;
+  memory->create(stamp,nall,"neighlist:stamp");
+  for (j = 0; j < nall; j++) stamp[j] = -1;
+
+  nclusters = (inum + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+
+  if (nclusters > maxcluster) {
+    maxcluster = nclusters;
+    memory->destroy(cluster_numneigh);
+    memory->sfree(cluster_firstneigh);
+    memory->create(cluster_numneigh,maxcluster,"neighlist:cluster_numneigh");
+    cluster_firstneigh = (int **)
+      memory->smalloc(maxcluster*sizeof(int *),"neighlist:cluster_firstneigh");
+  }
+
+  if (!cpage) {
+    cpage = new MyPage<int>[1];
+    cpage->init(CLUSTER_SIZE*oneatom,MAX(CLUSTER_SIZE*oneatom,pgsize),PGDELTA);
+  }
+  cpage->reset();
+
+  for (c = 0; c < nclusters; c++) {
+    n = 0;
+    neighptr = cpage->vget();
+
+    ibase = c * CLUSTER_SIZE;
+    nicluster = MIN(CLUSTER_SIZE,inum-ibase);
+
+    for (k = 0; k < nicluster; k++) {
+      i = ilist[ibase+k];
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj] & NEIGHMASK;
+        if (stamp[j] != c) {
+          stamp[j] = c;
+          neighptr[n++] = j;
+        }
+      }
+    }
+
+    cluster_firstneigh[c] = neighptr;
+    cluster_numneigh[c] = n;
+    cpage->vgot(n);
+    if (cpage->status())
+      error->one(FLERR,"Neighbor cluster list overflow, boost neigh_modify one");
+  }
+
+  memory->destroy(stamp);
+  clusterflag = 1;
+}
+
+/* ----------------------------------------------------------------------
+   compress the just-built J lists into sorted 16-bit delta streams
+   per-atom stream layout: 1st J index as 2 shorts, then per neighbor a
+     16-bit delta to the previous J index, with 0 as an escape code
+     followed by the full index as 2 shorts (deltas are >= 1 after sort)
+   numneigh[] keeps the neighbor counts, decode is inlined in consumers
+   if no other list derives from this one, the int pages are released
+     afterwards, which is where the memory saving comes from
+------------------------------------------------------------------------- */
+
+void NeighList::compress_list()
+{
+  int i,j,jprev,n,ii,jj,jnum;
+  int *jlist;
+  unsigned short *sptr;
+
+  if (copy || trim || kk2cpu || ssa) return;
+
+  if (maxatom > maxatom16) {
+    maxatom16 = maxatom;
+    memory->sfree(firstneigh16);
+    firstneigh16 = (unsigned short **)
+      memory->smalloc(maxatom16*sizeof(unsigned short *),
+                      "neighlist:firstneigh16");
+  }
+
+  // stream worst case = 3 shorts per neighbor plus leading full index
+
+  if (!upage) {
+    upage = new MyPage<unsigned short>[1];
+    upage->init(3*oneatom+2,MAX(3*oneatom+2,pgsize),PGDELTA);
+  }
+  upage->reset();
+
+  std::vector<int> jsorted(oneatom);
+
+  for (ii = 0; ii < inum+gnum; ii++) {
+    i = ilist[ii];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    for (jj = 0; jj < jnum; jj++) jsorted[jj] = jlist[jj] & NEIGHMASK;
+    std::sort(jsorted.begin(),jsorted.begin()+jnum);
+
+    n = 0;
+    sptr = upage->vget();
+
+    if (jnum) {
+      j = jsorted[0];
+      sptr[n++] = (unsigned short) (j & 0xFFFF);
+      sptr[n++] = (unsigned short) ((j >> 16) & 0x7FFF);
+      jprev = j;
+      for (jj = 1; jj < jnum; jj++) {
+        j = jsorted[jj];
+        if (j - jprev < 65536) sptr[n++] = (unsigned short) (j - jprev);
+        else {
+          sptr[n++] = 0;
+          sptr[n++] = (unsigned short) (j & 0xFFFF);
+          sptr[n++] = (unsigned short) ((j >> 16) & 0x7FFF);
+        }
+        jprev = j;
+      }
+    }
+
+    firstneigh16[i] = sptr;
+    upage->vgot(n);
+    if (upage->status())
+      error->one(FLERR,"Compressed neighbor list overflow, boost neigh_modify one");
+  }
+
+  // release the int pages unless another list derives from this one
+  // re-init frees all pages and allocates a single fresh one, so the
+  //   next build starts over without extra logic in NPair
+
+  int derived = 0;
+  for (int m = 0; m < neighbor->nlist; m++) {
+    NeighList *other = neighbor->lists[m];
+    if (!other || other == this) continue;
+    if (other->listcopy == this || other->listskip == this ||
+        other->listfull == this) derived = 1;
+  }
+  if (!derived) {
+    int nmypage = comm->nthreads;
+    for (int t = 0; t < nmypage; t++) ipage[t].init(oneatom,pgsize,PGDELTA);
+  }
+
+  compressflag = 1;
+}
+
+/* ----------------------------------------------------------------------
+   partition the just-built J lists by special-bond scaling
+   each atom's list is reordered in place: neighbors without special-bond
+     encoding bits first, the (few) scaled ones at the end, with
+     numplain[i] recording the split point
+   consumers run their inner loop over the leading run without the
+     sbmask() decode and special_lj/special_coul gathers, then process
+     the scaled remainder in a short second loop
+   entries keep their encoding, so consumers unaware of the partition
+     (e.g. a scalar energy/virial path) are unaffected by it
+------------------------------------------------------------------------- */
+
+void NeighList::sort_special()
+{
+  int i,n,nmask,ii,jj,jnum;
+  int *jlist;
+
+  if (copy || trim || kk2cpu || ssa) return;
+
+  if (maxatom > maxplain) {
+    maxplain = maxatom;
+    memory->destroy(numplain);
+    memory->create(numplain,maxplain,"neighlist:numplain");
+  }
+
+  std::vector<int> masked(oneatom);
+
+  for (ii = 0; ii < inum+gnum; ii++) {
+    i = ilist[ii];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    n = nmask = 0;
+    for (jj = 0; jj < jnum; jj++) {
+      if (jlist[jj] >> SBBITS & 3) masked[nmask++] = jlist[jj];
+      else jlist[n++] = jlist[jj];
+    }
+    numplain[i] = n;
+    for (jj = 0; jj < nmask; jj++) jlist[n++] = masked[jj];
+  }
+
+  specialsortflag = 1;
+}
+
 /* ----------------------------------------------------------------------
    print attributes of this list and associated request
 ------------------------------------------------------------------------- */
@@ -318,6 +563,19 @@ double NeighList::memory_usage()
       bytes += ipage[i].size();
   }
 
+  if (cpage) {
+    bytes += memory->usage(cluster_numneigh,maxcluster);
+    bytes += (double)maxcluster * sizeof(int *);
+    bytes += cpage->size();
+  }
+
+  if (upage) {
+    bytes += (double)maxatom16 * sizeof(unsigned short *);
+    bytes += upage->size();
+  }
+
+  bytes += memory->usage(numplain,maxplain);
+
   if (respainner) {
     bytes += memory->usage(ilist_inner,maxatom);
     bytes += memory->usage(numneigh_inner,maxatom);
@@ -61,6 +61,36 @@ class NeighList : protected Pointers {
   int oneatom;           // max size for one atom
   MyPage<int> *ipage;    // pages of neighbor indices
 
+  // optional cluster-pair format derived from a full list
+  // groups of CLUSTER_SIZE consecutive I atoms in ilist share one J list
+  // built on demand by consumers via build_clusters(), opt-in
+  //   via neigh_modify clusterpair command
+
+  static constexpr int CLUSTER_SIZE = 4;
+
+  int clusterflag;             // 1 if cluster data is current for this list
+  int nclusters;               // # of I-atom clusters
+  int *cluster_numneigh;       // # of J neighbors for each cluster
+  int **cluster_firstneigh;    // ptr to 1st J int value of each cluster
+  int maxcluster;              // size of allocated cluster arrays
+  MyPage<int> *cpage;          // pages of cluster neighbor indices
+
+  // optional compressed list storage, opt-in via neigh_modify compress
+  // per-atom J lists sorted and stored as 16-bit deltas, see compress_list()
+
+  int compressflag;                  // 1 if compressed data is current
+  unsigned short **firstneigh16;     // ptr to encoded J stream of each I atom
+  int maxatom16;                     // size of allocated firstneigh16
+  MyPage<unsigned short> *upage;     // pages of encoded neighbor streams
+
+  // optional special-bond partition, opt-in via neigh_modify specialsort
+  // per-atom J lists reordered in place so neighbors without special-bond
+  //   encoding bits come first, see sort_special()
+
+  int specialsortflag;    // 1 if partition data is current for this list
+  int *numplain;          // # of leading unscaled J neighbors per I atom
+  int maxplain;           // size of allocated numplain
+
   // data structs to store rRESPA neighbor pairs I,J and associated values
 
   int inum_inner;            // # of I atoms neighbors are stored for
@@ -108,6 +138,9 @@ class NeighList : protected Pointers {
   void post_constructor(class NeighRequest *);
   void setup_pages(int, int);    // setup page data structures
   void grow(int, int);           // grow all data structs
+  void build_clusters();         // derive cluster-pair format from full list
+  void compress_list();          // compress J lists to 16-bit delta streams
+  void sort_special();           // partition J lists by special-bond scaling
   void print_attributes();       // debug routine
   int get_maxlocal() { return maxatom; }
   double memory_usage();
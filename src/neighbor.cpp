@@ -42,6 +42,7 @@
 #include "output.h"
 #include "pair.h"
 #include "pair_hybrid.h"
+#include "platform.h"
 #include "respa.h"
 #include "style_nbin.h"  // IWYU pragma: keep
 #include "style_npair.h"  // IWYU pragma: keep
@@ -134,9 +135,19 @@ pairclass(nullptr), pairnames(nullptr), pairmasks(nullptr)
   pgsize = 100000;
   oneatom = 2000;
   binsizeflag = 0;
+
+  autotune_flag = autotune_done = 0;
+  autotune_binsize = 0.0;
+  autotune_state = AUTOTUNE_OFF;
+  autotune_icand = -1;
+  autotune_isample = 0;
   build_once = 0;
   cluster_check = 0;
+  clusterpair_flag = 0;
+  compress_flag = 0;
+  specialsort_flag = 0;
   ago = -1;
+  exchange_needed = 1;
 
   cutneighmax = 0.0;
   cutneighsq = nullptr;
@@ -223,6 +234,7 @@ pairclass(nullptr), pairnames(nullptr), pairmasks(nullptr)
   cutcollectionsq = nullptr;
   custom_collection_flag = 0;
   interval_collection_flag = 0;
+  auto_interval_flag = 0;
   nmax_collection = 0;
 
   // Kokkos setting
@@ -311,6 +323,7 @@ void Neighbor::init()
 
   overlap_topo = 0;
   ncalls = ndanger = 0;
+  exchange_needed = 1;
   dimension = domain->dimension;
   triclinic = domain->triclinic;
   newton_pair = force->newton_pair;
@@ -434,6 +447,36 @@ void Neighbor::init()
       if (!force->pair)
         error->all(FLERR, "Cannot use collection/interval command without defining a pairstyle");
 
+      // for collection/auto, generate geometrically spaced interval bounds
+      // spanning the current range of per-atom cutoffs, so each size class
+      // is binned at a resolution matching its own interactions
+
+      if (auto_interval_flag) {
+        if (!force->pair->finitecutflag)
+          error->all(FLERR, "Cannot use collection/auto without a finite-size pair style");
+
+        double cutlo = BIG;
+        double cuthi = 0.0;
+        for (i = 0; i < atom->nlocal; i++) {
+          double cut_atom = force->pair->atom2cut(i);
+          cutlo = MIN(cutlo,cut_atom);
+          cuthi = MAX(cuthi,cut_atom);
+        }
+        double cuttmp;
+        MPI_Allreduce(&cuthi,&cuttmp,1,MPI_DOUBLE,MPI_MAX,world);
+        cuthi = cuttmp;
+        MPI_Allreduce(&cutlo,&cuttmp,1,MPI_DOUBLE,MPI_MIN,world);
+        cutlo = cuttmp;
+        if (cuthi <= 0.0)
+          error->all(FLERR, "Cannot use collection/auto without finite-size particles");
+
+        memory->grow(collection2cut,ncollections,"neigh:collection2cut");
+        const double ratio = pow(cuthi/cutlo,1.0/ncollections);
+        for (i = 0; i < ncollections; i++)
+          collection2cut[i] = cutlo*pow(ratio,i+1);
+        collection2cut[ncollections-1] = cuthi;
+      }
+
       if (force->pair->finitecutflag) {
         finite_cut_flag = 1;
         // If cutoffs depend on finite atom sizes, use radii of intervals to find cutoffs
@@ -1559,7 +1602,20 @@ void Neighbor::morph_copy_trim()
       // no need to check omp b/c it stores same pairs
       // NOTE: need check for 2 Kokkos flags?
 
-      if (irq->size != jrq->size) continue;
+      // exception: a size list w/o history may be trimmed from a
+      //   non-size list via the radius-sum criterion (NPairTrimSize),
+      //   so hybrid overlay runs avoid an independent granular build
+      // restricted to plain CPU lists built to the global cutoff
+
+      int size_trim = 0;
+      if (irq->size != jrq->size) {
+        if (!irq->size || jrq->size) continue;
+        if (irq->history || irq->granonesided) continue;
+        if (irq->omp || irq->intel || irq->ssa) continue;
+        if (irq->kokkos_host || irq->kokkos_device) continue;
+        if (irq->cut || jrq->cut) continue;
+        size_trim = 1;
+      }
       if (irq->history != jrq->history) continue;
       if (irq->bond != jrq->bond) continue;
       if (irq->intel != jrq->intel) continue;
@@ -1575,6 +1631,7 @@ void Neighbor::morph_copy_trim()
 
       // 2 lists are a match
 
+      if (size_trim) trim_flag = 1;
       break;
     }
 
@@ -1970,9 +2027,13 @@ int Neighbor::choose_bin(NeighRequest *rq)
     if (!rq->kokkos_host != !(mask & NB_KOKKOS_HOST)) continue;
 
     // multi neighbor style require multi bin style
+    // thread-parallel bin styles only exist for standard binning
+
     if (style == Neighbor::MULTI) {
+      if (mask & NB_OMP) continue;
       if (!(mask & NB_MULTI)) continue;
     } else {
+      if (!rq->omp != !(mask & NB_OMP)) continue;
       if (!(mask & NB_STANDARD)) continue;
     }
 
@@ -2130,6 +2191,11 @@ int Neighbor::choose_pair(NeighRequest *rq)
       if (!(mask & NP_COPY)) continue;
       if (rq->trim) {
         if (!rq->trim != !(mask & NP_TRIM)) continue;
+        // a size list trimmed from a non-size parent needs the
+        //   radius-sum criterion of NPairTrimSize
+        if (rq->size && !requests[rq->copylist]->size) {
+          if (!(mask & NP_SIZE)) continue;
+        } else if (mask & NP_SIZE) continue;
         if (!rq->omp != !(mask & NP_OMP)) continue;
         if (!rq->intel != !(mask & NP_INTEL)) continue;
       }
@@ -2319,9 +2385,12 @@ void Neighbor::setup_bins()
   // invoke create_setup() and create() for all perpetual NStencil
   // same ops performed for occasional lists in build_one()
 
+  // create_setup() flags stencils whose geometry is unchanged since the
+  //   last create(), those can skip the (possibly expensive) re-create
+
   for (int i = 0; i < nstencil_perpetual; i++) {
     neigh_stencil[slist[i]]->create_setup();
-    neigh_stencil[slist[i]]->create();
+    if (!neigh_stencil[slist[i]]->skip_create) neigh_stencil[slist[i]]->create();
   }
 
   last_setup_bins = update->ntimestep;
@@ -2331,6 +2400,11 @@ void Neighbor::setup_bins()
 
 int Neighbor::decide()
 {
+  // assume atoms must migrate unless check_distance() proves otherwise
+  // covers the return-1 paths below and derived classes with own checks
+
+  exchange_needed = 1;
+
   if (must_check) {
     bigint n = update->ntimestep;
     if (restart_check && n == output->next_restart) return 1;
@@ -2398,6 +2472,71 @@ int Neighbor::check_distance()
   int nlocal = atom->nlocal;
   if (includegroup) nlocal = atom->nfirst;
 
+  // also monitor whether any owned atom has left my subdomain, so the
+  //   migration protocol in comm exchange() can be skipped globally if
+  //   no proc has one, common in quasi-static runs where reneighboring
+  //   is triggered by small collective motions
+  // verdict is only valid when subdomain bounds are static between
+  //   checks, so changing boxes always migrate, as do triclinic boxes
+  //   since atoms are not yet in lamda coords when this runs
+  // scan all owned atoms even if includegroup limits the check above
+
+  int eflag = 1;
+  if (!boxcheck && triclinic == 0) {
+    double *sublo = domain->sublo;
+    double *subhi = domain->subhi;
+    int nall = atom->nlocal;
+    eflag = 0;
+    for (int i = 0; i < nall; i++)
+      if (x[i][0] < sublo[0] || x[i][0] >= subhi[0] ||
+          x[i][1] < sublo[1] || x[i][1] >= subhi[1] ||
+          x[i][2] < sublo[2] || x[i][2] >= subhi[2]) {
+        eflag = 1;
+        break;
+      }
+  }
+
+  // pairwise trigger mode: instead of rebuilding as soon as any one atom
+  //   has moved further than half the effective skin, rebuild only when
+  //   the two largest displacements anywhere in the system sum to more
+  //   than the full effective skin
+  // this is the tightest per-pair bound the xhold data allows and can
+  //   substantially reduce the rebuild frequency for diffusive systems
+  // 2nd-largest global displacement found via a 2-stage reduction:
+  //   procs not owning the global max contribute their own max
+
+  if (dist_check == 2) {
+    double rsq1 = 0.0;
+    double rsq2 = 0.0;
+    for (int i = 0; i < nlocal; i++) {
+      delx = x[i][0] - xhold[i][0];
+      dely = x[i][1] - xhold[i][1];
+      delz = x[i][2] - xhold[i][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq > rsq1) {
+        rsq2 = rsq1;
+        rsq1 = rsq;
+      } else if (rsq > rsq2) rsq2 = rsq;
+    }
+
+    double d1 = sqrt(rsq1);
+    double d1all;
+    MPI_Allreduce(&d1,&d1all,1,MPI_DOUBLE,MPI_MAX,world);
+    double dcand = (d1 == d1all) ? sqrt(rsq2) : d1;
+    double d2all;
+    MPI_Allreduce(&dcand,&d2all,1,MPI_DOUBLE,MPI_MAX,world);
+    int locals[2],totals[2];
+    locals[0] = (d1 == d1all) ? 1 : 0;
+    locals[1] = eflag;
+    MPI_Allreduce(locals,totals,2,MPI_INT,MPI_SUM,world);
+    if (totals[0] > 1) d2all = d1all;
+    exchange_needed = totals[1] ? 1 : 0;
+
+    int flagall = (d1all + d2all > 2.0*sqrt(deltasq)) ? 1 : 0;
+    if (flagall && ago == MAX(every,delay)) ndanger++;
+    return flagall;
+  }
+
   int flag = 0;
   for (int i = 0; i < nlocal; i++) {
     delx = x[i][0] - xhold[i][0];
@@ -2407,10 +2546,100 @@ int Neighbor::check_distance()
     if (rsq > deltasq) { flag = 1; break; }
   }
 
-  int flagall;
-  MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
-  if (flagall && ago == MAX(every,delay)) ndanger++;
-  return flagall;
+  int flags[2],flagsall[2];
+  flags[0] = flag;
+  flags[1] = eflag;
+  MPI_Allreduce(flags,flagsall,2,MPI_INT,MPI_MAX,world);
+  exchange_needed = flagsall[1];
+  if (flagsall[0] && ago == MAX(every,delay)) ndanger++;
+  return flagsall[0];
+}
+
+/* ----------------------------------------------------------------------
+   set the bin size to use for the build about to be performed
+   on the first call, generate candidate sizes as multiples of the
+     current bin size (user-set or the default half of cutneighmax)
+   re-bins and re-creates stencils so the build uses the new size
+   once all candidates have been timed, apply the winning size for good
+------------------------------------------------------------------------- */
+
+void Neighbor::autotune_select()
+{
+  if (style == Neighbor::NSQ) {
+    autotune_state = AUTOTUNE_DONE;
+    return;
+  }
+
+  if (autotune_state == AUTOTUNE_DECIDED) {
+    if (autotune_icand == 0 && !autotune_binsizeflag_orig) {
+
+      // the default size won: restore the automatic heuristic so the
+      //   bin size keeps tracking future changes in cutneighmax
+
+      binsizeflag = autotune_binsizeflag_orig;
+      binsize_user = autotune_binsize_orig;
+    } else {
+      binsizeflag = 1;
+      binsize_user = autotune_binsize;
+    }
+    for (int i = 0; i < nbin; i++) neigh_bin[i]->copy_neighbor_info();
+    setup_bins();
+    autotune_state = AUTOTUNE_DONE;
+    autotune_done = 1;
+    return;
+  }
+
+  if (autotune_icand < 0) {
+    autotune_binsizeflag_orig = binsizeflag;
+    autotune_binsize_orig = binsize_user;
+
+    double base = (binsizeflag) ? binsize_user : 0.5*cutneighmax;
+    const double factors[AUTOTUNE_NCAND] = {1.0, 0.5, 0.75, 1.5};
+    for (int i = 0; i < AUTOTUNE_NCAND; i++) {
+      autotune_cands[i] = factors[i]*base;
+      autotune_times[i] = BIG;
+    }
+    autotune_icand = 0;
+    autotune_isample = 0;
+  }
+
+  binsizeflag = 1;
+  binsize_user = autotune_cands[autotune_icand];
+  for (int i = 0; i < nbin; i++) neigh_bin[i]->copy_neighbor_info();
+  setup_bins();
+}
+
+/* ----------------------------------------------------------------------
+   record the time the just-completed build took with the current
+     bin size candidate, keeping the fastest of NSAMPLE builds
+   all procs advance through the candidates in lockstep, so the
+     allreduced decision is identical everywhere
+   the winning size is applied by autotune_select() at the next build,
+     this build used the last candidate and its lists stay valid
+------------------------------------------------------------------------- */
+
+void Neighbor::autotune_record(double elapsed)
+{
+  autotune_times[autotune_icand] = MIN(autotune_times[autotune_icand],elapsed);
+  autotune_isample++;
+  if (autotune_isample < AUTOTUNE_NSAMPLE) return;
+
+  autotune_isample = 0;
+  autotune_icand++;
+  if (autotune_icand < AUTOTUNE_NCAND) return;
+
+  // all candidates sampled: the slowest proc governs each candidate
+
+  double times[AUTOTUNE_NCAND];
+  MPI_Allreduce(autotune_times,times,AUTOTUNE_NCAND,MPI_DOUBLE,MPI_MAX,world);
+
+  int best = 0;
+  for (int i = 1; i < AUTOTUNE_NCAND; i++)
+    if (times[i] < times[best]) best = i;
+
+  autotune_icand = best;
+  autotune_binsize = autotune_cands[best];
+  autotune_state = AUTOTUNE_DECIDED;
 }
 
 /* ----------------------------------------------------------------------
@@ -2480,6 +2709,15 @@ void Neighbor::build(int topoflag)
   // if bin then, atoms may have moved outside of proc domain & bin extent,
   //   leading to errors or even a crash
 
+  // while autotuning, switch to the bin size to time during this build,
+  //   or lock in the winning size once all candidates have been sampled
+
+  double tstart = 0.0;
+  if (autotune_state == AUTOTUNE_SAMPLING || autotune_state == AUTOTUNE_DECIDED) {
+    autotune_select();
+    if (autotune_state == AUTOTUNE_SAMPLING) tstart = platform::walltime();
+  }
+
   if (style != Neighbor::NSQ) {
     if (last_setup_bins < 0) setup_bins();
     for (i = 0; i < nbin; i++) {
@@ -2499,6 +2737,8 @@ void Neighbor::build(int topoflag)
     neigh_pair[m]->build(lists[m]);
   }
 
+  if (autotune_state == AUTOTUNE_SAMPLING) autotune_record(platform::walltime() - tstart);
+
   // build topology lists for bonds/angles/etc
   // skip if GPU package styles will call it explicitly to overlap with GPU computation.
 
@@ -2584,7 +2824,7 @@ void Neighbor::build_one(class NeighList *mylist)
   NStencil *ns = np->ns;
   if (ns && ns->last_stencil < last_setup_bins) {
     ns->create_setup();
-    ns->create();
+    if (!ns->skip_create) ns->create();
   }
 
   // build the list
@@ -2659,7 +2899,8 @@ void Neighbor::modify_params(int narg, char **arg)
       iarg += 2;
     } else if (strcmp(arg[iarg],"check") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify check", error);
-      dist_check = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      if (strcmp(arg[iarg+1],"pairwise") == 0) dist_check = 2;
+      else dist_check = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
     } else if (strcmp(arg[iarg],"once") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify once", error);
@@ -2681,10 +2922,32 @@ void Neighbor::modify_params(int narg, char **arg)
       if (binsize_user <= 0.0) binsizeflag = 0;
       else binsizeflag = 1;
       iarg += 2;
+    } else if (strcmp(arg[iarg],"autotune") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify autotune", error);
+      autotune_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      if (autotune_flag) {
+        autotune_state = AUTOTUNE_SAMPLING;
+        autotune_icand = -1;
+        autotune_isample = 0;
+        autotune_done = 0;
+      } else autotune_state = AUTOTUNE_OFF;
+      iarg += 2;
     } else if (strcmp(arg[iarg],"cluster") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify cluster", error);
       cluster_check = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"clusterpair") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify clusterpair", error);
+      clusterpair_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"compress") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify compress", error);
+      compress_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"specialsort") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify specialsort", error);
+      specialsort_flag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
     } else if (strcmp(arg[iarg],"include") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "neigh_modify include", error);
       includegroup = group->find(arg[iarg+1]);
@@ -2771,6 +3034,7 @@ void Neighbor::modify_params(int narg, char **arg)
       comm->ncollections_cutoff = 0;
       interval_collection_flag = 1;
       custom_collection_flag = 1;
+      auto_interval_flag = 0;
       memory->grow(collection2cut,ncollections,"neigh:collection2cut");
 
       // Set upper cutoff for each collection
@@ -2786,6 +3050,24 @@ void Neighbor::modify_params(int narg, char **arg)
       }
 
       iarg += 2 + ncollections;
+    } else if (strcmp(arg[iarg],"collection/auto") == 0) {
+      if (style != Neighbor::MULTI)
+        error->all(FLERR,"Cannot use collection/auto command without multi setting");
+
+      if (iarg+2 > narg)
+        utils::missing_cmd_args(FLERR, "neigh_modify collection/auto", error);
+      ncollections = utils::inumeric(FLERR,arg[iarg+1],false,lmp);
+      if (ncollections < 1)
+        error->all(FLERR, "Invalid collection/auto keyword: illegal number of custom collections: {}", ncollections);
+
+      // Invalidate old user cutoffs, interval bounds are generated at init
+
+      comm->ncollections_cutoff = 0;
+      interval_collection_flag = 1;
+      custom_collection_flag = 1;
+      auto_interval_flag = 1;
+
+      iarg += 2;
     } else if (strcmp(arg[iarg],"collection/type") == 0) {
       if (style != Neighbor::MULTI)
         error->all(FLERR,"Cannot use collection/type command without multi setting");
@@ -2806,6 +3088,7 @@ void Neighbor::modify_params(int narg, char **arg)
       comm->ncollections_cutoff = 0;
       interval_collection_flag = 0;
       custom_collection_flag = 1;
+      auto_interval_flag = 0;
       if (!type2collection)
         memory->create(type2collection,ntypes+1,"neigh:type2collection");
 
@@ -35,6 +35,10 @@ class Neighbor : protected Pointers {
   int includegroup;    // only build pairwise lists for this group
   int build_once;      // 1 if only build lists once per run
 
+  int exchange_needed;    // 0 if last distance check found no atom on any proc
+                          //   outside its subdomain, so comm can skip migration
+                          //   in exchange(), valid for one exchange only
+
   double skin;                    // skin distance
   double cutneighmin;             // min neighbor cutoff for all type pairs
   double cutneighmax;             // max neighbor cutoff for all type pairs
@@ -85,6 +89,18 @@ class Neighbor : protected Pointers {
 
   int cluster_check;    // 1 if check bond/angle/etc satisfies minimg
 
+  // cluster-pair list format setting, used by consuming pair styles
+
+  int clusterpair_flag;    // 1 if pair styles may use cluster-pair lists
+  int compress_flag;       // 1 if pair styles may use compressed lists
+  int specialsort_flag;    // 1 if pair styles may use special-partitioned lists
+
+  // bin size autotuning, set via neigh_modify autotune, read by Finish
+
+  int autotune_flag;         // 1 if bin size autotuning is enabled
+  int autotune_done;         // 1 once a bin size has been locked in
+  double autotune_binsize;   // bin size chosen by autotuning
+
   // pairwise neighbor lists and corresponding requests
 
   int nlist;           // # of pairwise neighbor lists
@@ -111,6 +127,7 @@ class Neighbor : protected Pointers {
 
   int custom_collection_flag;      // 1 if custom collections are defined for multi
   int interval_collection_flag;    // 1 if custom collections use intervals
+  int auto_interval_flag;          // 1 if interval cutoffs are generated automatically
   int finite_cut_flag;             // 1 if multi considers finite atom size
   int ncollections;                // # of custom collections
   int nmax_collection;             // maximum atoms stored in collection array
@@ -195,6 +212,19 @@ class Neighbor : protected Pointers {
 
   double triggersq;    // trigger = build when atom moves this dist
 
+  // bin size autotuning sampling state
+
+  enum { AUTOTUNE_OFF, AUTOTUNE_SAMPLING, AUTOTUNE_DECIDED, AUTOTUNE_DONE };
+  static const int AUTOTUNE_NCAND = 4;      // # of bin sizes to sample
+  static const int AUTOTUNE_NSAMPLE = 3;    // # of builds timed per size
+  int autotune_state;                       // where in the sampling cycle we are
+  int autotune_icand;                       // candidate being sampled, -1 before start
+  int autotune_isample;                     // sample # for current candidate
+  int autotune_binsizeflag_orig;            // binsize settings before tuning
+  double autotune_binsize_orig;
+  double autotune_cands[AUTOTUNE_NCAND];    // candidate bin sizes
+  double autotune_times[AUTOTUNE_NCAND];    // fastest timed build per candidate
+
   double **xhold;    // atom coords at last neighbor build
   int maxhold;       // size of xhold array
 
@@ -269,6 +299,9 @@ class Neighbor : protected Pointers {
   void print_pairwise_info();
   void requests_new2old();
 
+  void autotune_select();           // set bin size candidate before a build
+  void autotune_record(double);     // record build time, lock in when done
+
   int choose_bin(class NeighRequest *);
   int choose_stencil(class NeighRequest *);
   int choose_pair(class NeighRequest *);
@@ -295,7 +328,8 @@ namespace NeighConst {
     NB_KOKKOS_HOST = 1 << 2,
     NB_SSA = 1 << 3,
     NB_STANDARD = 1 << 4,
-    NB_MULTI = 1 << 5
+    NB_MULTI = 1 << 5,
+    NB_OMP = 1 << 6
   };
 
   enum {
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "npair_trim_size.h"
+
+#include "atom.h"
+#include "error.h"
+#include "my_page.h"
+#include "neigh_list.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+NPairTrimSize::NPairTrimSize(LAMMPS *lmp) : NPair(lmp) {}
+
+/* ----------------------------------------------------------------------
+   create a size (finite-size particle) list by trimming a parent list
+     with a longer distance cutoff to the radius-sum contact criterion
+   same criterion as the SIZE variants of the regular NPair builds, so
+     e.g. a granular list in a pair hybrid overlay can be derived from
+     the overlay partner's list instead of being built independently
+   only used for size lists without contact history
+------------------------------------------------------------------------- */
+
+void NPairTrimSize::build(NeighList *list)
+{
+  NeighList *listcopy = list->listcopy;
+
+  int ii, jj, n, jnum, joriginal;
+  int *neighptr, *jlist;
+  double xtmp, ytmp, ztmp, radi;
+  double delx, dely, delz, rsq, radsum, cut;
+
+  double **x = atom->x;
+  double *radius = atom->radius;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  MyPage<int> *ipage = list->ipage;
+  ipage->reset();
+
+  int *ilist_copy = listcopy->ilist;
+  int *numneigh_copy = listcopy->numneigh;
+  int **firstneigh_copy = listcopy->firstneigh;
+  int inum = listcopy->inum;
+  int gnum = listcopy->gnum;
+
+  list->inum = inum;
+  list->gnum = gnum;
+
+  int inum_trim = inum;
+  if (list->ghost) inum_trim += gnum;
+
+  for (ii = 0; ii < inum_trim; ii++) {
+    n = 0;
+    neighptr = ipage->vget();
+
+    const int i = ilist_copy[ii];
+    ilist[ii] = i;
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    radi = radius[i];
+
+    // loop over parent list and keep pairs within radius sum + skin
+
+    jlist = firstneigh_copy[i];
+    jnum = numneigh_copy[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      joriginal = jlist[jj];
+      const int j = joriginal & NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx * delx + dely * dely + delz * delz;
+
+      radsum = radi + radius[j];
+      cut = radsum + skin;
+      if (rsq > cut * cut) continue;
+
+      neighptr[n++] = joriginal;
+    }
+
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status()) error->one(FLERR, "Neighbor list overflow, boost neigh_modify one");
+  }
+}
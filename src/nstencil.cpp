@@ -69,6 +69,8 @@ using namespace LAMMPS_NS;
 NStencil::NStencil(LAMMPS *lmp) : Pointers(lmp)
 {
   last_stencil = -1;
+  skip_create = 0;
+  create_cached = 0;
 
   xyzflag = 0;
   maxstencil = maxstencil_multi_old = 0;
@@ -231,6 +233,26 @@ void NStencil::create_setup()
     if (sz*binsizez < cutneighmax) sz++;
     if (dimension == 2) sz = 0;
 
+    // stencil contents are a pure function of the bin geometry and the
+    //   neighbor cutoff, so if neither changed since the last create()
+    //   the caller may skip re-creating the stencil
+    // typical win for workflows of many short runs with a static box
+
+    skip_create = (neighstyle == Neighbor::BIN) && create_cached &&
+      sx == create_sx && sy == create_sy && sz == create_sz &&
+      mbinx == create_mbinx && mbiny == create_mbiny &&
+      mbinz == create_mbinz &&
+      binsizex == create_binsizex && binsizey == create_binsizey &&
+      binsizez == create_binsizez &&
+      cutneighmax == create_cutneighmax;
+
+    create_cached = 1;
+    create_sx = sx; create_sy = sy; create_sz = sz;
+    create_mbinx = mbinx; create_mbiny = mbiny; create_mbinz = mbinz;
+    create_binsizex = binsizex; create_binsizey = binsizey;
+    create_binsizez = binsizez;
+    create_cutneighmax = cutneighmax;
+
     int smax = (2*sx+1) * (2*sy+1) * (2*sz+1);
 
     // reallocate stencil structs if necessary
@@ -238,6 +260,7 @@ void NStencil::create_setup()
 
     if (neighstyle == Neighbor::BIN) {
       if (smax > maxstencil) {
+        skip_create = 0;
         maxstencil = smax;
         memory->destroy(stencil);
         memory->create(stencil,maxstencil,"neighstencil:stencil");
@@ -277,6 +300,8 @@ void NStencil::create_setup()
     double stencil_range;
     int n = ncollections;
 
+    skip_create = 0;
+
     if (nb) copy_bin_info_multi();
 
     // Deallocate arrays if previously allocated
@@ -23,6 +23,8 @@ class NStencil : protected Pointers {
   int istyle;             // 1-N index into binnames
   class NBin *nb;         // ptr to NBin instance I depend on
   bigint last_stencil;    // last timestep stencil was created
+  int skip_create;        // 1 if geometry unchanged since last create()
+                          //   so caller may skip the create() call
 
   int nstencil;                 // # of bins in stencil
   int *stencil;                 // list of bin offsets
@@ -64,6 +66,15 @@ class NStencil : protected Pointers {
 
   int neighstyle;
   double cutneighmax;
+
+  // cached geometry from last create(), to detect unchanged stencils
+
+  int create_cached;
+  int create_sx, create_sy, create_sz;
+  int create_mbinx, create_mbiny, create_mbinz;
+  double create_binsizex, create_binsizey, create_binsizez;
+  double create_cutneighmax;
+
   double cutneighmaxsq;
   double *cuttypesq;
   double **cutneighsq;
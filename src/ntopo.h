@@ -23,6 +23,12 @@ class NTopo : protected Pointers {
   int nbondlist, nanglelist, ndihedrallist, nimproperlist;
   int **bondlist, **anglelist, **dihedrallist, **improperlist;
 
+  // build() emits list entries in ascending local index of the atom that
+  //   stores each term (the central atom for angles/dihedrals/impropers),
+  //   so bonded force loops sweep x/f in index order; with atom sorting
+  //   enabled, index order is also spatial (bin) order - preserve this
+  //   property when adding new topology classes
+
   NTopo(class LAMMPS *);
   ~NTopo() override;
 
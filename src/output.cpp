@@ -20,6 +20,7 @@
 #include "style_dump.h"         // IWYU pragma: keep
 
 #include "comm.h"
+#include "compute.h"
 #include "domain.h"
 #include "dump.h"
 #include "error.h"
@@ -77,6 +78,7 @@ Output::Output(LAMMPS *lmp) : Pointers(lmp)
   ndump = 0;
   max_dump = 0;
   any_time_dumps = 0;
+  timedump_inputs_known = 0;
   next_thermo = next_restart = next_dump_any = next_time_dump_any = MAXBIGINT;
   mode_dump = nullptr;
   every_dump = nullptr;
@@ -151,6 +153,14 @@ void Output::init()
   }
 
   for (int i = 0; i < ndump; i++) dump[i]->init();
+
+  // forget which computes time dumps invoke, in case dumps changed
+  // re-learned on the first time dump snapshot of this run
+
+  timedump_inputs_known = 0;
+  for (const auto &icompute : modify->get_compute_list())
+    icompute->timedumpflag = 0;
+
   any_time_dumps = 0;
   for (int i = 0; i < ndump; i++) {
     if (mode_dump[i]) any_time_dumps = 1;
@@ -260,10 +270,15 @@ void Output::setup(int memflag)
       if (last_dump[idump] == ntimestep) writeflag = 0;
 
       // perform dump
+      // wrap time dumps with clear, then record which computes they invoked
 
       if (writeflag) {
+        if (mode_dump[idump] == 1 && (dump[idump]->clearstep || var_dump[idump]))
+          modify->clearstep_compute();
         dump[idump]->write();
         last_dump[idump] = ntimestep;
+        if (mode_dump[idump] == 1 && (dump[idump]->clearstep || var_dump[idump]))
+          learn_timedump_computes();
       }
 
       // calculate timestep or time for next dump
@@ -363,15 +378,13 @@ void Output::write(bigint ntimestep)
   // set next_dump_any to smallest next_dump
   // wrap step dumps that invoke computes or do variable eval with clear/add
   // NOTE:
-  //   not wrapping time dumps means that Integrate::ev_set()
-  //     needs to trigger all per-atom eng/virial computes
-  //     on a timestep where any time dump will be output
-  //   could wrap time dumps as well, if timestep size did not vary
-  //   if wrap when timestep size varies frequently,
-  //     then can do many unneeded addstep() --> inefficient
-  //   hard to know if timestep varies, since run every could change it
-  //   can't remove an uneeded addstep from a compute, b/c don't know
-  //     what other command may have added it
+  //   time dumps are wrapped with clearstep only, no addstep,
+  //     since their next output timestep is unknown if timestep size varies
+  //   instead record which computes each time dump invoked
+  //     via learn_timedump_computes()
+  //   Integrate::ev_set() then triggers only those per-atom eng/virial
+  //     computes on a timestep where any time dump will be output,
+  //     conservatively all of them until the first snapshot is written
 
   if (next_dump_any == ntimestep) {
     next_dump_any = next_time_dump_any = MAXBIGINT;
@@ -381,8 +394,7 @@ void Output::write(bigint ntimestep)
       if (next_dump[idump] == ntimestep) {
         if (last_dump[idump] == ntimestep) continue;
 
-        if (mode_dump[idump] == 0 &&
-            (dump[idump]->clearstep || var_dump[idump]))
+        if (dump[idump]->clearstep || var_dump[idump])
           modify->clearstep_compute();
 
         // perform dump
@@ -392,9 +404,12 @@ void Output::write(bigint ntimestep)
         last_dump[idump] = ntimestep;
         calculate_next_dump(WRITE,idump,ntimestep);
 
-        if (mode_dump[idump] == 0 &&
-            (dump[idump]->clearstep || var_dump[idump]))
-          modify->addstep_compute(next_dump[idump]);
+        if (dump[idump]->clearstep || var_dump[idump]) {
+          if (mode_dump[idump] == 0)
+            modify->addstep_compute(next_dump[idump]);
+          else
+            learn_timedump_computes();
+        }
       }
 
       if (mode_dump[idump] && (dump[idump]->clearstep || var_dump[idump]))
@@ -593,6 +608,20 @@ int Output::check_time_dumps(bigint ntimestep)
   return nowflag;
 }
 
+/* ----------------------------------------------------------------------
+   flag all computes invoked since the preceding clearstep_compute()
+     as inputs of a time dump
+   called after each time dump snapshot, so Integrate::ev_set() can
+     trigger only these computes on future time dump steps
+------------------------------------------------------------------------- */
+
+void Output::learn_timedump_computes()
+{
+  for (const auto &icompute : modify->get_compute_list())
+    if (icompute->invoked_flag) icompute->timedumpflag = 1;
+  timedump_inputs_known = 1;
+}
+
 /* ----------------------------------------------------------------------
    force restart file(s) to be written
    called from PRD and TAD
@@ -988,19 +1017,26 @@ void Output::create_restart(int narg, char **arg)
   int multiproc;
   if (strchr(arg[1],'%')) multiproc = comm->nprocs;
   else multiproc = 0;
+  int mpiioflag;
+  if (utils::strmatch(arg[1],"\\.mpiio$")) mpiioflag = 1;
+  else mpiioflag = 0;
   if (nfile == 2) {
     if (multiproc && !strchr(arg[2],'%'))
       error->all(FLERR,"Both restart files must use % or neither");
     if (!multiproc && strchr(arg[2],'%'))
       error->all(FLERR,"Both restart files must use % or neither");
+    if (mpiioflag != (utils::strmatch(arg[2],"\\.mpiio$") ? 1 : 0))
+      error->all(FLERR,"Both restart files must use .mpiio or neither");
   }
+  if (multiproc && mpiioflag)
+    error->all(FLERR,"Cannot use both '%' and '.mpiio' in restart file name");
 
   // setup output style and process optional args
 
   delete restart;
   restart = new WriteRestart(lmp);
   int iarg = nfile+1;
-  restart->multiproc_options(multiproc,narg-iarg,&arg[iarg]);
+  restart->multiproc_options(multiproc,mpiioflag,narg-iarg,&arg[iarg]);
 }
 
 /* ----------------------------------------------------------------------
@@ -38,6 +38,8 @@ class Output : protected Pointers {
   bigint next_dump_any;         // next timestep for any dump
   bigint next_time_dump_any;    // next timestep for any time dump with computes
   int any_time_dumps;           // 1 if any time dump defined
+  int timedump_inputs_known;    // 1 if computes invoked by time dumps
+                                // have been identified for Integrate::ev_set()
   int *mode_dump;               // 0/1 if write every N timesteps or Delta in sim time
   int *every_dump;              // dump every N timesteps, 0 if variable
   double *every_time_dump;      // dump every Delta of sim time, 0.0 if variable
@@ -91,6 +93,7 @@ class Output : protected Pointers {
 
   const std::vector<Dump *> &get_dump_list();    // get vector with all dumps
   int check_time_dumps(bigint);                  // check if any time dump is output now
+  void learn_timedump_computes();                // flag computes invoked by a time dump
 
   void set_thermo(int, char **);        // set thermo output freqquency
   void create_thermo(int, char **);     // create a thermo style
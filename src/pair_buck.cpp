@@ -20,6 +20,7 @@
 #include "comm.h"
 #include "force.h"
 #include "neigh_list.h"
+#include "pair_vector_kernel.h"
 #include "math_const.h"
 #include "memory.h"
 #include "error.h"
@@ -70,6 +71,11 @@ void PairBuck::compute(int eflag, int vflag)
   evdwl = 0.0;
   ev_init(eflag,vflag);
 
+  if (!evflag) {
+    compute_blocked();
+    return;
+  }
+
   double **x = atom->x;
   double **f = atom->f;
   int *type = atom->type;
@@ -136,6 +142,79 @@ void PairBuck::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   force-only path: strip-mine each neighbor list into packed blocks so
+   the force law runs branch-free over contiguous data and vectorizes,
+   see pair_vector_kernel.h
+------------------------------------------------------------------------- */
+
+void PairBuck::compute_blocked()
+{
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+  int newton_pair = force->newton_pair;
+
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  typedef PairVector::flt_t flt_t;
+  PairVector::Block blk;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    const int itype = type[i];
+    const int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    const double *cutsq_i = cutsq[itype];
+    const double *rhoinv_i = rhoinv[itype];
+    const double *buck1_i = buck1[itype];
+    const double *buck2_i = buck2[itype];
+
+    double fxtmp = 0.0;
+    double fytmp = 0.0;
+    double fztmp = 0.0;
+
+    for (int jfrom = 0; jfrom < jnum; jfrom += PairVector::BLOCKSIZE) {
+      const int jto = MIN(jfrom + PairVector::BLOCKSIZE, jnum);
+      const int n = PairVector::pack(blk, jlist, jfrom, jto, x, type, xtmp, ytmp, ztmp, cutsq_i,
+                                     special_lj, special_coul);
+
+#if defined(_OPENMP)
+#pragma omp simd reduction(+ : fxtmp, fytmp, fztmp)
+#endif
+      for (int k = 0; k < n; k++) {
+        const int jtype = blk.jtype[k];
+        const flt_t r2inv = (flt_t) 1.0/blk.rsq[k];
+        const flt_t r6inv = r2inv*r2inv*r2inv;
+        const flt_t r = sqrt(blk.rsq[k]);
+        const flt_t rexp = exp(-r*(flt_t) rhoinv_i[jtype]);
+        const flt_t forcebuck = (flt_t) buck1_i[jtype]*r*rexp - (flt_t) buck2_i[jtype]*r6inv;
+        const flt_t fpair = blk.factor_lj[k]*forcebuck*r2inv;
+        blk.fpair[k] = fpair;
+        fxtmp += (double) (blk.delx[k]*fpair);
+        fytmp += (double) (blk.dely[k]*fpair);
+        fztmp += (double) (blk.delz[k]*fpair);
+      }
+
+      PairVector::scatter(blk, n, f, nlocal, newton_pair);
+    }
+
+    f[i][0] += fxtmp;
+    f[i][1] += fytmp;
+    f[i][2] += fztmp;
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -49,6 +49,7 @@ class PairBuck : public Pair {
   double **rhoinv, **buck1, **buck2, **offset;
 
   virtual void allocate();
+  void compute_blocked();
 };
 
 }    // namespace LAMMPS_NS
@@ -23,8 +23,10 @@
 #include "neigh_request.h"
 #include "neighbor.h"
 #include "pair.h"
+#include "platform.h"
 #include "respa.h"
 #include "suffix.h"
+#include "timer.h"
 #include "update.h"
 
 #include <cstring>
@@ -34,7 +36,7 @@ using namespace LAMMPS_NS;
 /* ---------------------------------------------------------------------- */
 
 PairHybrid::PairHybrid(LAMMPS *lmp) :
-    Pair(lmp), styles(nullptr), cutmax_style(nullptr), keywords(nullptr), multiple(nullptr),
+    Pair(lmp), styles(nullptr), cutmax_style(nullptr), styletime(nullptr), keywords(nullptr), multiple(nullptr),
     nmap(nullptr), map(nullptr), special_lj(nullptr), special_coul(nullptr), compute_tally(nullptr)
 {
   nstyles = 0;
@@ -57,6 +59,7 @@ PairHybrid::~PairHybrid()
   }
   delete[] styles;
   delete[] cutmax_style;
+  delete[] styletime;
   delete[] keywords;
   delete[] multiple;
 
@@ -130,9 +133,15 @@ void PairHybrid::compute(int eflag, int vflag)
       // outerflag is set and sub-style has a compute_outer() method
 
       if (styles[m]->compute_flag == 0) continue;
+
+      // tally per sub-style wall time at timer full level
+
+      double tstart = 0.0;
+      if (timer->has_full()) tstart = platform::walltime();
       if (outerflag && styles[m]->respa_enable)
         styles[m]->compute_outer(eflag,vflag_substyle);
       else styles[m]->compute(eflag,vflag_substyle);
+      if (timer->has_full()) styletime[m] += platform::walltime() - tstart;
     }
 
     restore_special(saved_special);
@@ -197,6 +206,22 @@ void PairHybrid::compute(int eflag, int vflag)
 
 void PairHybrid::finish()
 {
+  // print per sub-style timing breakdown, tallied at timer full level
+
+  if (timer->has_full() && nstyles > 0) {
+    double *timeall = new double[nstyles];
+    MPI_Allreduce(styletime,timeall,nstyles,MPI_DOUBLE,MPI_SUM,world);
+    double total = 0.0;
+    for (int m = 0; m < nstyles; m++) total += timeall[m];
+    if (comm->me == 0 && total > 0.0) {
+      utils::logmesg(lmp,"\nPair hybrid sub-style timing breakdown (ave over procs):\n");
+      for (int m = 0; m < nstyles; m++)
+        utils::logmesg(lmp,"  {:<20} | {:<12.4g} secs |{:6.2f}%\n",
+                       keywords[m],timeall[m]/comm->nprocs,100.0*timeall[m]/total);
+    }
+    delete[] timeall;
+  }
+
   for (int m = 0; m < nstyles; m++) styles[m]->finish();
 }
 
@@ -352,6 +377,9 @@ void PairHybrid::settings(int narg, char **arg)
   delete[] cutmax_style;
   cutmax_style = new double[nstyles];
   memset(cutmax_style, 0, nstyles*sizeof(double));
+  delete[] styletime;
+  styletime = new double[nstyles];
+  memset(styletime, 0, nstyles*sizeof(double));
 
   // multiple[i] = 1 to M if sub-style used multiple times, else 0
 
@@ -590,6 +618,7 @@ void PairHybrid::init_style()
   int i,m,itype,jtype,used,istyle,skip;
 
   memset(cutmax_style, 0, nstyles*sizeof(double));
+  memset(styletime, 0, nstyles*sizeof(double));
 
   // error if a sub-style is not used
 
@@ -831,6 +860,9 @@ void PairHybrid::read_restart(FILE *fp)
   delete[] cutmax_style;
   cutmax_style = new double[nstyles];
   memset(cutmax_style, 0, nstyles*sizeof(double));
+  delete[] styletime;
+  styletime = new double[nstyles];
+  memset(styletime, 0, nstyles*sizeof(double));
   keywords = new char*[nstyles];
   multiple = new int[nstyles];
 
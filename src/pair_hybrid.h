@@ -74,6 +74,7 @@ class PairHybrid : public Pair {
   int nstyles;             // # of sub-styles
   Pair **styles;           // list of Pair style classes
   double *cutmax_style;    // max cutoff for each style
+  double *styletime;       // wall time per sub-style, timer full level only
   char **keywords;         // style name of each Pair style
   int *multiple;           // 0 if style used once, else Mth instance
 
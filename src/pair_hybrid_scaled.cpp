@@ -20,8 +20,10 @@
 #include "force.h"
 #include "input.h"
 #include "memory.h"
+#include "platform.h"
 #include "respa.h"
 #include "suffix.h"
+#include "timer.h"
 #include "update.h"
 #include "variable.h"
 
@@ -100,13 +102,16 @@ void PairHybridScaled::compute(int eflag, int vflag)
     if (atom->torque_flag) memory->create(tsum, nmaxfsum, 3, "pair:tsum");
   }
   const int nall = atom->nlocal + atom->nghost;
+  const int tflag = atom->torque_flag;
   auto f = atom->f;
   auto t = atom->torque;
   for (i = 0; i < nall; ++i) {
     fsum[i][0] = f[i][0];
     fsum[i][1] = f[i][1];
     fsum[i][2] = f[i][2];
-    if (atom->torque_flag) {
+  }
+  if (tflag) {
+    for (i = 0; i < nall; ++i) {
       tsum[i][0] = t[i][0];
       tsum[i][1] = t[i][1];
       tsum[i][2] = t[i][2];
@@ -139,7 +144,7 @@ void PairHybridScaled::compute(int eflag, int vflag)
     // clear forces and torques
 
     memset(&f[0][0], 0, nall * 3 * sizeof(double));
-    if (atom->torque_flag) memset(&t[0][0], 0, nall * 3 * sizeof(double));
+    if (tflag) memset(&t[0][0], 0, nall * 3 * sizeof(double));
 
     set_special(m);
 
@@ -149,10 +154,16 @@ void PairHybridScaled::compute(int eflag, int vflag)
       // outerflag is set and sub-style has a compute_outer() method
 
       if (styles[m]->compute_flag == 0) continue;
+
+      // tally per sub-style wall time at timer full level
+
+      double tstart = 0.0;
+      if (timer->has_full()) tstart = platform::walltime();
       if (outerflag && styles[m]->respa_enable)
         styles[m]->compute_outer(eflag, vflag_substyle);
       else
         styles[m]->compute(eflag, vflag_substyle);
+      if (timer->has_full()) styletime[m] += platform::walltime() - tstart;
     }
 
     // add scaled forces to global sum
@@ -161,7 +172,9 @@ void PairHybridScaled::compute(int eflag, int vflag)
       fsum[i][0] += scale * f[i][0];
       fsum[i][1] += scale * f[i][1];
       fsum[i][2] += scale * f[i][2];
-      if (atom->torque_flag) {
+    }
+    if (tflag) {
+      for (i = 0; i < nall; ++i) {
         tsum[i][0] += scale * t[i][0];
         tsum[i][1] += scale * t[i][1];
         tsum[i][2] += scale * t[i][2];
@@ -220,7 +233,9 @@ void PairHybridScaled::compute(int eflag, int vflag)
     f[i][0] = fsum[i][0];
     f[i][1] = fsum[i][1];
     f[i][2] = fsum[i][2];
-    if (atom->torque_flag) {
+  }
+  if (tflag) {
+    for (i = 0; i < nall; ++i) {
       t[i][0] = tsum[i][0];
       t[i][1] = tsum[i][1];
       t[i][2] = tsum[i][2];
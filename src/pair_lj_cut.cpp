@@ -24,6 +24,7 @@
 #include "math_const.h"
 #include "memory.h"
 #include "neigh_list.h"
+#include "pair_vector_kernel.h"
 #include "neighbor.h"
 #include "respa.h"
 #include "update.h"
@@ -41,6 +42,9 @@ PairLJCut::PairLJCut(LAMMPS *lmp) : Pair(lmp)
   respa_enable = 1;
   born_matrix_enable = 1;
   writedata = 1;
+  clusterpair = 0;
+  compresslist = 0;
+  clusterpair_allow = 1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -76,6 +80,39 @@ void PairLJCut::compute(int eflag, int vflag)
   evdwl = 0.0;
   ev_init(eflag, vflag);
 
+  // cluster-pair format operates one-sided on a full list
+  // SIMD kernel tallies no energy/virial terms, so only use it when
+  //   neither is needed on this step, else use scalar full-list loop
+
+  if (clusterpair) {
+    if (evflag) compute_full(eflag, vflag);
+    else {
+      if (!list->clusterflag) list->build_clusters();
+      compute_cluster();
+    }
+    if (vflag_fdotr) virial_fdotr_compute();
+    return;
+  }
+
+  // compressed lists keep half-list semantics, only the storage differs
+
+  if (compresslist) {
+    if (!list->compressflag) list->compress_list();
+    if (list->compressflag) {
+      compute_compressed(eflag, vflag);
+      if (vflag_fdotr) virial_fdotr_compute();
+      return;
+    }
+    compresslist = 0;    // list cannot be compressed, e.g. a copy list
+  }
+
+  // force-only steps use the blocked kernel, see pair_vector_kernel.h
+
+  if (!evflag) {
+    compute_blocked();
+    return;
+  }
+
   double **x = atom->x;
   double **f = atom->f;
   int *type = atom->type;
@@ -99,6 +136,16 @@ void PairLJCut::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    // hoist coefficient rows of atom i's type, so the inner loop
+    //   indexes each row directly instead of chasing row pointers
+
+    const double *cutsq_i = cutsq[itype];
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+    const double *lj3_i = lj3[itype];
+    const double *lj4_i = lj4[itype];
+    const double *offset_i = offset[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -110,10 +157,10 @@ void PairLJCut::compute(int eflag, int vflag)
       rsq = delx * delx + dely * dely + delz * delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
+      if (rsq < cutsq_i[jtype]) {
         r2inv = 1.0 / rsq;
         r6inv = r2inv * r2inv * r2inv;
-        forcelj = r6inv * (lj1[itype][jtype] * r6inv - lj2[itype][jtype]);
+        forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
         fpair = factor_lj * forcelj * r2inv;
 
         f[i][0] += delx * fpair;
@@ -126,7 +173,7 @@ void PairLJCut::compute(int eflag, int vflag)
         }
 
         if (eflag) {
-          evdwl = r6inv * (lj3[itype][jtype] * r6inv - lj4[itype][jtype]) - offset[itype][jtype];
+          evdwl = r6inv * (lj3_i[jtype] * r6inv - lj4_i[jtype]) - offset_i[jtype];
           evdwl *= factor_lj;
         }
 
@@ -138,6 +185,241 @@ void PairLJCut::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   cluster-pair kernel: one shared J list per cluster of CLUSTER_SIZE
+     consecutive I atoms, x[] of the I lanes loaded once into registers
+   one-sided force update on I only, inner lane loop is branch-light and
+     vectorizes without gather/scatter on x[]
+   only reached when no energy/virial tallies are needed this step
+------------------------------------------------------------------------- */
+
+void PairLJCut::compute_cluster()
+{
+  constexpr int CS = NeighList::CLUSTER_SIZE;
+  int c, k, jj, j, jtype;
+  double delx, dely, delz, rsq, r2inv, r6inv, forcelj, fpair;
+  double xi[CS][3], fi[CS][3];
+  int iat[CS], it[CS];
+  int *jlist;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int nclusters = list->nclusters;
+  int *cluster_numneigh = list->cluster_numneigh;
+  int **cluster_firstneigh = list->cluster_firstneigh;
+
+  for (c = 0; c < nclusters; c++) {
+    int ibase = c * CS;
+    int ni = MIN(CS, inum - ibase);
+
+    for (k = 0; k < ni; k++) {
+      iat[k] = ilist[ibase + k];
+      xi[k][0] = x[iat[k]][0];
+      xi[k][1] = x[iat[k]][1];
+      xi[k][2] = x[iat[k]][2];
+      it[k] = type[iat[k]];
+      fi[k][0] = fi[k][1] = fi[k][2] = 0.0;
+    }
+
+    jlist = cluster_firstneigh[c];
+    int jnum = cluster_numneigh[c];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      const double xj = x[j][0];
+      const double yj = x[j][1];
+      const double zj = x[j][2];
+      jtype = type[j];
+
+      for (k = 0; k < ni; k++) {
+        delx = xi[k][0] - xj;
+        dely = xi[k][1] - yj;
+        delz = xi[k][2] - zj;
+        rsq = delx * delx + dely * dely + delz * delz;
+
+        // mask out lanes beyond cutoff and the J == I lane
+
+        if (rsq < cutsq[it[k]][jtype] && j != iat[k]) {
+          r2inv = 1.0 / rsq;
+          r6inv = r2inv * r2inv * r2inv;
+          forcelj = r6inv * (lj1[it[k]][jtype] * r6inv - lj2[it[k]][jtype]);
+          fpair = forcelj * r2inv;
+
+          fi[k][0] += delx * fpair;
+          fi[k][1] += dely * fpair;
+          fi[k][2] += delz * fpair;
+        }
+      }
+    }
+
+    for (k = 0; k < ni; k++) {
+      f[iat[k]][0] += fi[k][0];
+      f[iat[k]][1] += fi[k][1];
+      f[iat[k]][2] += fi[k][2];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same half-list loop as compute(), but with the J indices decoded
+     inline from the sorted 16-bit delta streams of the compressed list
+   only used for atomic systems, so no special-bond factors to unmask
+------------------------------------------------------------------------- */
+
+void PairLJCut::compute_compressed(int eflag, int /*vflag*/)
+{
+  int i, j, ii, jj, inum, jnum, itype, jtype;
+  double xtmp, ytmp, ztmp, delx, dely, delz, evdwl, fpair;
+  double rsq, r2inv, r6inv, forcelj;
+  int *ilist, *numneigh;
+  const unsigned short *sptr;
+
+  evdwl = 0.0;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  int newton_pair = force->newton_pair;
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  unsigned short **firstneigh16 = list->firstneigh16;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    sptr = firstneigh16[i];
+    jnum = numneigh[i];
+
+    const double *cutsq_i = cutsq[itype];
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+    const double *lj3_i = lj3[itype];
+    const double *lj4_i = lj4[itype];
+    const double *offset_i = offset[itype];
+
+    j = 0;
+    for (jj = 0; jj < jnum; jj++) {
+
+      // decode next J index: full value for the first entry or after a
+      //   0 escape code, else a positive delta to the previous index
+
+      if (jj == 0) {
+        j = sptr[0] | ((int) sptr[1] << 16);
+        sptr += 2;
+      } else {
+        unsigned short delta = *sptr++;
+        if (delta == 0) {
+          j = sptr[0] | ((int) sptr[1] << 16);
+          sptr += 2;
+        } else j += delta;
+      }
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx * delx + dely * dely + delz * delz;
+      jtype = type[j];
+
+      if (rsq < cutsq_i[jtype]) {
+        r2inv = 1.0 / rsq;
+        r6inv = r2inv * r2inv * r2inv;
+        forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
+        fpair = forcelj * r2inv;
+
+        f[i][0] += delx * fpair;
+        f[i][1] += dely * fpair;
+        f[i][2] += delz * fpair;
+        if (newton_pair || j < nlocal) {
+          f[j][0] -= delx * fpair;
+          f[j][1] -= dely * fpair;
+          f[j][2] -= delz * fpair;
+        }
+
+        if (eflag)
+          evdwl = r6inv * (lj3_i[jtype] * r6inv - lj4_i[jtype]) - offset_i[jtype];
+
+        if (evflag) ev_tally(i, j, nlocal, newton_pair, evdwl, 0.0, fpair, delx, dely, delz);
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   scalar one-sided loop over the full list, used on energy/virial steps
+     when the cluster-pair format is active
+   each I,J pair is visited from both sides, ev_tally_full halves tallies
+------------------------------------------------------------------------- */
+
+void PairLJCut::compute_full(int /*eflag*/, int /*vflag*/)
+{
+  int i, j, ii, jj, inum, jnum, itype, jtype;
+  double xtmp, ytmp, ztmp, delx, dely, delz, evdwl, fpair;
+  double rsq, r2inv, r6inv, forcelj;
+  int *ilist, *jlist, *numneigh, **firstneigh;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    const double *cutsq_i = cutsq[itype];
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+    const double *lj3_i = lj3[itype];
+    const double *lj4_i = lj4[itype];
+    const double *offset_i = offset[itype];
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx * delx + dely * dely + delz * delz;
+      jtype = type[j];
+
+      if (rsq < cutsq_i[jtype]) {
+        r2inv = 1.0 / rsq;
+        r6inv = r2inv * r2inv * r2inv;
+        forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
+        fpair = forcelj * r2inv;
+
+        f[i][0] += delx * fpair;
+        f[i][1] += dely * fpair;
+        f[i][2] += delz * fpair;
+
+        evdwl = r6inv * (lj3_i[jtype] * r6inv - lj4_i[jtype]) - offset_i[jtype];
+
+        if (evflag) ev_tally_full(i, evdwl, 0.0, fpair, delx, dely, delz);
+      }
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 void PairLJCut::compute_inner()
@@ -177,6 +459,9 @@ void PairLJCut::compute_inner()
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -191,7 +476,7 @@ void PairLJCut::compute_inner()
         r2inv = 1.0 / rsq;
         r6inv = r2inv * r2inv * r2inv;
         jtype = type[j];
-        forcelj = r6inv * (lj1[itype][jtype] * r6inv - lj2[itype][jtype]);
+        forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
         fpair = factor_lj * forcelj * r2inv;
         if (rsq > cut_out_on_sq) {
           rsw = (sqrt(rsq) - cut_out_on) / cut_out_diff;
@@ -255,6 +540,9 @@ void PairLJCut::compute_middle()
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -269,7 +557,7 @@ void PairLJCut::compute_middle()
         r2inv = 1.0 / rsq;
         r6inv = r2inv * r2inv * r2inv;
         jtype = type[j];
-        forcelj = r6inv * (lj1[itype][jtype] * r6inv - lj2[itype][jtype]);
+        forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
         fpair = factor_lj * forcelj * r2inv;
         if (rsq < cut_in_on_sq) {
           rsw = (sqrt(rsq) - cut_in_off) / cut_in_diff;
@@ -335,6 +623,13 @@ void PairLJCut::compute_outer(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    const double *cutsq_i = cutsq[itype];
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+    const double *lj3_i = lj3[itype];
+    const double *lj4_i = lj4[itype];
+    const double *offset_i = offset[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -346,11 +641,11 @@ void PairLJCut::compute_outer(int eflag, int vflag)
       rsq = delx * delx + dely * dely + delz * delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
+      if (rsq < cutsq_i[jtype]) {
         if (rsq > cut_in_off_sq) {
           r2inv = 1.0 / rsq;
           r6inv = r2inv * r2inv * r2inv;
-          forcelj = r6inv * (lj1[itype][jtype] * r6inv - lj2[itype][jtype]);
+          forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
           fpair = factor_lj * forcelj * r2inv;
           if (rsq < cut_in_on_sq) {
             rsw = (sqrt(rsq) - cut_in_off) / cut_in_diff;
@@ -370,7 +665,7 @@ void PairLJCut::compute_outer(int eflag, int vflag)
         if (eflag) {
           r2inv = 1.0 / rsq;
           r6inv = r2inv * r2inv * r2inv;
-          evdwl = r6inv * (lj3[itype][jtype] * r6inv - lj4[itype][jtype]) - offset[itype][jtype];
+          evdwl = r6inv * (lj3_i[jtype] * r6inv - lj4_i[jtype]) - offset_i[jtype];
           evdwl *= factor_lj;
         }
 
@@ -378,7 +673,7 @@ void PairLJCut::compute_outer(int eflag, int vflag)
           if (rsq <= cut_in_off_sq) {
             r2inv = 1.0 / rsq;
             r6inv = r2inv * r2inv * r2inv;
-            forcelj = r6inv * (lj1[itype][jtype] * r6inv - lj2[itype][jtype]);
+            forcelj = r6inv * (lj1_i[jtype] * r6inv - lj2_i[jtype]);
             fpair = factor_lj * forcelj * r2inv;
           } else if (rsq < cut_in_on_sq)
             fpair = factor_lj * forcelj * r2inv;
@@ -390,6 +685,76 @@ void PairLJCut::compute_outer(int eflag, int vflag)
   }
 }
 
+/* ----------------------------------------------------------------------
+   force-only path: strip-mine each neighbor list into packed blocks so
+   the force law runs branch-free over contiguous data and vectorizes,
+   see pair_vector_kernel.h
+------------------------------------------------------------------------- */
+
+void PairLJCut::compute_blocked()
+{
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+  int newton_pair = force->newton_pair;
+
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  typedef PairVector::flt_t flt_t;
+  PairVector::Block blk;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    const int itype = type[i];
+    const int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    const double *cutsq_i = cutsq[itype];
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+
+    double fxtmp = 0.0;
+    double fytmp = 0.0;
+    double fztmp = 0.0;
+
+    for (int jfrom = 0; jfrom < jnum; jfrom += PairVector::BLOCKSIZE) {
+      const int jto = MIN(jfrom + PairVector::BLOCKSIZE, jnum);
+      const int n = PairVector::pack(blk, jlist, jfrom, jto, x, type, xtmp, ytmp, ztmp, cutsq_i,
+                                     special_lj, special_coul);
+
+#if defined(_OPENMP)
+#pragma omp simd reduction(+ : fxtmp, fytmp, fztmp)
+#endif
+      for (int k = 0; k < n; k++) {
+        const int jtype = blk.jtype[k];
+        const flt_t r2inv = (flt_t) 1.0 / blk.rsq[k];
+        const flt_t r6inv = r2inv * r2inv * r2inv;
+        const flt_t forcelj = r6inv * ((flt_t) lj1_i[jtype] * r6inv - (flt_t) lj2_i[jtype]);
+        const flt_t fpair = blk.factor_lj[k] * forcelj * r2inv;
+        blk.fpair[k] = fpair;
+        fxtmp += (double) (blk.delx[k] * fpair);
+        fytmp += (double) (blk.dely[k] * fpair);
+        fztmp += (double) (blk.delz[k] * fpair);
+      }
+
+      PairVector::scatter(blk, n, f, nlocal, newton_pair);
+    }
+
+    f[i][0] += fxtmp;
+    f[i][1] += fytmp;
+    f[i][2] += fztmp;
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -483,6 +848,29 @@ void PairLJCut::init_style()
     if (respa->level_inner >= 0) list_style = NeighConst::REQ_RESPA_INOUT;
     if (respa->level_middle >= 0) list_style = NeighConst::REQ_RESPA_ALL;
   }
+
+  // cluster-pair format needs a full list to operate one-sided
+  // restricted to atomic systems (no special-bond scale factors) and
+  //   plain runs (no rRESPA sub-lists)
+  // derived suffix styles which inherit this method but keep half-list
+  //   compute kernels clear clusterpair_allow in their constructors
+
+  clusterpair = 0;
+  if (clusterpair_allow && neighbor->clusterpair_flag &&
+      (atom->molecular == Atom::ATOMIC) &&
+      (list_style == NeighConst::REQ_DEFAULT))
+    clusterpair = 1;
+
+  // compressed lists also require an atomic system and a plain half list
+  // clusterpair takes precedence since it changes the list type
+
+  compresslist = 0;
+  if (!clusterpair && neighbor->compress_flag &&
+      (atom->molecular == Atom::ATOMIC) &&
+      (list_style == NeighConst::REQ_DEFAULT))
+    compresslist = 1;
+
+  if (clusterpair) list_style = NeighConst::REQ_FULL;
   neighbor->add_request(this, list_style);
 
   // set rRESPA cutoffs
@@ -53,8 +53,16 @@ class PairLJCut : public Pair {
   double **epsilon, **sigma;
   double **lj1, **lj2, **lj3, **lj4, **offset;
   double *cut_respa;
+  int clusterpair;    // 1 if consuming cluster-pair format of a full list
+  int compresslist;   // 1 if consuming compressed 16-bit delta lists
+  int clusterpair_allow;    // 0 if derived style inherits init_style()
+                            // but keeps half-list compute kernels
 
   virtual void allocate();
+  void compute_blocked();
+  void compute_cluster();
+  void compute_full(int, int);
+  void compute_compressed(int, int);
 };
 
 }    // namespace LAMMPS_NS
@@ -21,6 +21,7 @@
 #include "memory.h"
 #include "neigh_list.h"
 #include "neighbor.h"
+#include "pair_vector_kernel.h"
 
 #include <cmath>
 #include <cstring>
@@ -34,6 +35,7 @@ PairLJCutCoulCut::PairLJCutCoulCut(LAMMPS *lmp) : Pair(lmp)
 {
   born_matrix_enable = 1;
   writedata = 1;
+  specialsort = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -72,6 +74,11 @@ void PairLJCutCoulCut::compute(int eflag, int vflag)
   evdwl = ecoul = 0.0;
   ev_init(eflag, vflag);
 
+  if (!evflag) {
+    compute_blocked();
+    return;
+  }
+
   double **x = atom->x;
   double **f = atom->f;
   double *q = atom->q;
@@ -156,6 +163,139 @@ void PairLJCutCoulCut::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   force-only path: strip-mine each neighbor list into packed blocks so
+   the force law runs branch-free over contiguous data and vectorizes,
+   see pair_vector_kernel.h
+------------------------------------------------------------------------- */
+
+void PairLJCutCoulCut::compute_blocked()
+{
+  double **x = atom->x;
+  double **f = atom->f;
+  double *q = atom->q;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+  int newton_pair = force->newton_pair;
+  double qqrd2e = force->qqrd2e;
+
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  // partition each J list so the special-scaled neighbors trail, then the
+  //   main loop needs no sbmask() decode and no scale-factor gathers
+
+  if (specialsort && !list->specialsortflag) {
+    list->sort_special();
+    if (!list->specialsortflag) specialsort = 0;    // e.g. a copy list
+  }
+  int *numplain = list->numplain;
+
+  typedef PairVector::flt_t flt_t;
+  PairVector::Block blk;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    const double qtmp = q[i];
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    const int itype = type[i];
+    const int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    const double *cutsq_i = cutsq[itype];
+    const double *cut_ljsq_i = cut_ljsq[itype];
+    const double *cut_coulsq_i = cut_coulsq[itype];
+    const double *lj1_i = lj1[itype];
+    const double *lj2_i = lj2[itype];
+
+    double fxtmp = 0.0;
+    double fytmp = 0.0;
+    double fztmp = 0.0;
+
+    // leading run of unscaled neighbors: force law without scale factors
+
+    const int jplain = specialsort ? numplain[i] : 0;
+
+    for (int jfrom = 0; jfrom < jplain; jfrom += PairVector::BLOCKSIZE) {
+      const int jto = MIN(jfrom + PairVector::BLOCKSIZE, jplain);
+      const int n =
+          PairVector::pack_plain(blk, jlist, jfrom, jto, x, type, xtmp, ytmp, ztmp, cutsq_i);
+
+#if defined(_OPENMP)
+#pragma omp simd reduction(+ : fxtmp, fytmp, fztmp)
+#endif
+      for (int k = 0; k < n; k++) {
+        const flt_t rsq = blk.rsq[k];
+        const int jtype = blk.jtype[k];
+        const flt_t r2inv = (flt_t) 1.0 / rsq;
+
+        flt_t forcecoul = 0.0;
+        if (rsq < (flt_t) cut_coulsq_i[jtype])
+          forcecoul = (flt_t) (qqrd2e * qtmp) * (flt_t) q[blk.jidx[k]] * sqrt(r2inv);
+
+        flt_t forcelj = 0.0;
+        if (rsq < (flt_t) cut_ljsq_i[jtype]) {
+          const flt_t r6inv = r2inv * r2inv * r2inv;
+          forcelj = r6inv * ((flt_t) lj1_i[jtype] * r6inv - (flt_t) lj2_i[jtype]);
+        }
+
+        const flt_t fpair = (forcecoul + forcelj) * r2inv;
+        blk.fpair[k] = fpair;
+        fxtmp += (double) (blk.delx[k] * fpair);
+        fytmp += (double) (blk.dely[k] * fpair);
+        fztmp += (double) (blk.delz[k] * fpair);
+      }
+
+      PairVector::scatter(blk, n, f, nlocal, newton_pair);
+    }
+
+    // scaled remainder, the whole list when the partition is not in use
+
+    for (int jfrom = jplain; jfrom < jnum; jfrom += PairVector::BLOCKSIZE) {
+      const int jto = MIN(jfrom + PairVector::BLOCKSIZE, jnum);
+      const int n = PairVector::pack(blk, jlist, jfrom, jto, x, type, xtmp, ytmp, ztmp, cutsq_i,
+                                     special_lj, special_coul);
+
+#if defined(_OPENMP)
+#pragma omp simd reduction(+ : fxtmp, fytmp, fztmp)
+#endif
+      for (int k = 0; k < n; k++) {
+        const flt_t rsq = blk.rsq[k];
+        const int jtype = blk.jtype[k];
+        const flt_t r2inv = (flt_t) 1.0 / rsq;
+
+        flt_t forcecoul = 0.0;
+        if (rsq < (flt_t) cut_coulsq_i[jtype])
+          forcecoul = (flt_t) (qqrd2e * qtmp) * (flt_t) q[blk.jidx[k]] * sqrt(r2inv);
+
+        flt_t forcelj = 0.0;
+        if (rsq < (flt_t) cut_ljsq_i[jtype]) {
+          const flt_t r6inv = r2inv * r2inv * r2inv;
+          forcelj = r6inv * ((flt_t) lj1_i[jtype] * r6inv - (flt_t) lj2_i[jtype]);
+        }
+
+        const flt_t fpair = (blk.factor_coul[k] * forcecoul + blk.factor_lj[k] * forcelj) * r2inv;
+        blk.fpair[k] = fpair;
+        fxtmp += (double) (blk.delx[k] * fpair);
+        fytmp += (double) (blk.dely[k] * fpair);
+        fztmp += (double) (blk.delz[k] * fpair);
+      }
+
+      PairVector::scatter(blk, n, f, nlocal, newton_pair);
+    }
+
+    f[i][0] += fxtmp;
+    f[i][1] += fytmp;
+    f[i][2] += fztmp;
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -255,6 +395,11 @@ void PairLJCutCoulCut::init_style()
 {
   if (!atom->q_flag) error->all(FLERR, "Pair style lj/cut/coul/cut requires atom attribute q");
 
+  // special-partitioned lists only pay off when special bonds exist
+
+  specialsort = 0;
+  if (neighbor->specialsort_flag && (atom->molecular != Atom::ATOMIC)) specialsort = 1;
+
   neighbor->add_request(this);
 }
 
@@ -44,6 +44,7 @@ class PairLJCutCoulCut : public Pair {
   void *extract(const char *, int &) override;
 
  protected:
+  int specialsort;    // 1 if consuming special-partitioned lists
   double cut_lj_global, cut_coul_global;
   double **cut_lj, **cut_ljsq;
   double **cut_coul, **cut_coulsq;
@@ -51,6 +52,7 @@ class PairLJCutCoulCut : public Pair {
   double **lj1, **lj2, **lj3, **lj4, **offset;
 
   virtual void allocate();
+  void compute_blocked();
 };
 
 }    // namespace LAMMPS_NS
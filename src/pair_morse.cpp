@@ -19,6 +19,7 @@
 #include "force.h"
 #include "memory.h"
 #include "neigh_list.h"
+#include "pair_vector_kernel.h"
 
 #include <cmath>
 #include <cstring>
@@ -63,6 +64,11 @@ void PairMorse::compute(int eflag, int vflag)
   evdwl = 0.0;
   ev_init(eflag, vflag);
 
+  if (!evflag) {
+    compute_blocked();
+    return;
+  }
+
   double **x = atom->x;
   double **f = atom->f;
   int *type = atom->type;
@@ -125,6 +131,77 @@ void PairMorse::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   force-only path: strip-mine each neighbor list into packed blocks so
+   the force law runs branch-free over contiguous data and vectorizes,
+   see pair_vector_kernel.h
+------------------------------------------------------------------------- */
+
+void PairMorse::compute_blocked()
+{
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+  int newton_pair = force->newton_pair;
+
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  typedef PairVector::flt_t flt_t;
+  PairVector::Block blk;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = ilist[ii];
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    const int itype = type[i];
+    const int *jlist = firstneigh[i];
+    const int jnum = numneigh[i];
+
+    const double *cutsq_i = cutsq[itype];
+    const double *r0_i = r0[itype];
+    const double *alpha_i = alpha[itype];
+    const double *morse1_i = morse1[itype];
+
+    double fxtmp = 0.0;
+    double fytmp = 0.0;
+    double fztmp = 0.0;
+
+    for (int jfrom = 0; jfrom < jnum; jfrom += PairVector::BLOCKSIZE) {
+      const int jto = MIN(jfrom + PairVector::BLOCKSIZE, jnum);
+      const int n = PairVector::pack(blk, jlist, jfrom, jto, x, type, xtmp, ytmp, ztmp, cutsq_i,
+                                     special_lj, special_coul);
+
+#if defined(_OPENMP)
+#pragma omp simd reduction(+ : fxtmp, fytmp, fztmp)
+#endif
+      for (int k = 0; k < n; k++) {
+        const int jtype = blk.jtype[k];
+        const flt_t r = sqrt(blk.rsq[k]);
+        const flt_t dr = r - (flt_t) r0_i[jtype];
+        const flt_t dexp = exp(-(flt_t) alpha_i[jtype] * dr);
+        const flt_t fpair = blk.factor_lj[k] * (flt_t) morse1_i[jtype] * (dexp * dexp - dexp) / r;
+        blk.fpair[k] = fpair;
+        fxtmp += (double) (blk.delx[k] * fpair);
+        fytmp += (double) (blk.dely[k] * fpair);
+        fztmp += (double) (blk.delz[k] * fpair);
+      }
+
+      PairVector::scatter(blk, n, f, nlocal, newton_pair);
+    }
+
+    f[i][0] += fxtmp;
+    f[i][1] += fytmp;
+    f[i][2] += fztmp;
+  }
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -50,6 +50,7 @@ class PairMorse : public Pair {
   double **offset;
 
   virtual void allocate();
+  void compute_blocked();
 };
 
 }    // namespace LAMMPS_NS
@@ -23,8 +23,10 @@
 #include "force.h"
 #include "memory.h"
 #include "neigh_list.h"
+#include "potential_cache.h"
 #include "table_file_reader.h"
 #include "tokenizer.h"
+#include "update.h"
 
 #include <cmath>
 #include <cstring>
@@ -35,6 +37,13 @@ enum { NONE, RLINEAR, RSQ, BMP };
 
 static constexpr double EPSILONR = 1.0e-6;
 
+// header preceding the rfile/efile/ffile arrays in a potential cache blob
+
+struct TableFileData {
+  int ninput, rflag, fpflag, ntablebits;
+  double rlo, rhi, fplo, fphi;
+};
+
 /* ---------------------------------------------------------------------- */
 
 PairTable::PairTable(LAMMPS *lmp) : Pair(lmp)
@@ -63,6 +72,19 @@ PairTable::~PairTable()
 /* ---------------------------------------------------------------------- */
 
 void PairTable::compute(int eflag, int vflag)
+{
+  // dispatch once on the table style so the inner loop below compiles
+  //   into four specialized versions with no per-pair branching
+
+  if (tabstyle == LOOKUP) eval<LOOKUP>(eflag, vflag);
+  else if (tabstyle == LINEAR) eval<LINEAR>(eflag, vflag);
+  else if (tabstyle == SPLINE) eval<SPLINE>(eflag, vflag);
+  else eval<BITMAP>(eflag, vflag);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int TBSTYLE> void PairTable::eval(int eflag, int vflag)
 {
   int i, j, ii, jj, inum, jnum, itype, jtype, itable;
   double xtmp, ytmp, ztmp, delx, dely, delz, evdwl, fpair;
@@ -99,6 +121,9 @@ void PairTable::compute(int eflag, int vflag)
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    const double *cutsq_i = cutsq[itype];
+    const int *tabindex_i = tabindex[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
@@ -110,18 +135,18 @@ void PairTable::compute(int eflag, int vflag)
       rsq = delx * delx + dely * dely + delz * delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
-        tb = &tables[tabindex[itype][jtype]];
+      if (rsq < cutsq_i[jtype]) {
+        tb = &tables[tabindex_i[jtype]];
         if (rsq < tb->innersq)
           error->one(FLERR, "Pair distance < table inner cutoff: ijtype {} {} dist {}", itype,
                      jtype, sqrt(rsq));
-        if (tabstyle == LOOKUP) {
+        if (TBSTYLE == LOOKUP) {
           itable = static_cast<int>((rsq - tb->innersq) * tb->invdelta);
           if (itable >= tlm1)
             error->one(FLERR, "Pair distance > table outer cutoff: ijtype {} {} dist {}", itype,
                        jtype, sqrt(rsq));
           fpair = factor_lj * tb->f[itable];
-        } else if (tabstyle == LINEAR) {
+        } else if (TBSTYLE == LINEAR) {
           itable = static_cast<int>((rsq - tb->innersq) * tb->invdelta);
           if (itable >= tlm1)
             error->one(FLERR, "Pair distance > table outer cutoff: ijtype {} {} dist {}", itype,
@@ -129,7 +154,7 @@ void PairTable::compute(int eflag, int vflag)
           fraction = (rsq - tb->rsq[itable]) * tb->invdelta;
           value = tb->f[itable] + fraction * tb->df[itable];
           fpair = factor_lj * value;
-        } else if (tabstyle == SPLINE) {
+        } else if (TBSTYLE == SPLINE) {
           itable = static_cast<int>((rsq - tb->innersq) * tb->invdelta);
           if (itable >= tlm1)
             error->one(FLERR, "Pair distance > table outer cutoff: ijtype {} {} dist {}", itype,
@@ -159,9 +184,9 @@ void PairTable::compute(int eflag, int vflag)
         }
 
         if (eflag) {
-          if (tabstyle == LOOKUP)
+          if (TBSTYLE == LOOKUP)
             evdwl = tb->e[itable];
-          else if (tabstyle == LINEAR || tabstyle == BITMAP)
+          else if (TBSTYLE == LINEAR || TBSTYLE == BITMAP)
             evdwl = tb->e[itable] + fraction * tb->de[itable];
           else
             evdwl = a * tb->e[itable] + b * tb->e[itable + 1] +
@@ -357,6 +382,34 @@ double PairTable::init_one(int i, int j)
 
 void PairTable::read_table(Table *tb, char *file, char *keyword)
 {
+  // check the process-wide cache for a previously parsed copy of this
+  // section.  parsed values depend on the current unit style through
+  // transparent unit conversion, so the unit style is part of the key.
+
+  const std::string key =
+      PotentialCache::file_key(file, fmt::format("{}:{}", keyword, update->unit_style));
+  if (!key.empty()) {
+    std::size_t nbytes;
+    const void *blob = PotentialCache::acquire(key, nbytes);
+    if (blob) {
+      auto head = (const TableFileData *) blob;
+      tb->ninput = head->ninput;
+      tb->rflag = head->rflag;
+      tb->fpflag = head->fpflag;
+      tb->ntablebits = head->ntablebits;
+      tb->rlo = head->rlo;
+      tb->rhi = head->rhi;
+      tb->fplo = head->fplo;
+      tb->fphi = head->fphi;
+      auto arrays = (double *) (void *) ((char *) blob + sizeof(TableFileData));
+      tb->rfile = arrays;
+      tb->efile = arrays + tb->ninput;
+      tb->ffile = arrays + 2 * tb->ninput;
+      tb->shared = blob;
+      return;
+    }
+  }
+
   TableFileReader reader(lmp, file, "pair", unit_convert_flag);
 
   // transparently convert units for supported conversions
@@ -475,6 +528,39 @@ void PairTable::read_table(Table *tb, char *file, char *keyword)
                    "{} of {} distance values in table {} with relative error\n"
                    "WARNING:  over {} to re-computed values",
                    rerror, tb->ninput, EPSILONR, keyword);
+
+  // store a shared copy in the process-wide cache and attach to it, so
+  // later pair style or LAMMPS instances in this process reuse one
+  // read-only copy of the data instead of parsing the file again
+
+  if (!key.empty()) {
+    const std::size_t nbytes = sizeof(TableFileData) + 3 * tb->ninput * sizeof(double);
+    auto buf = new char[nbytes];
+    auto head = (TableFileData *) (void *) buf;
+    head->ninput = tb->ninput;
+    head->rflag = tb->rflag;
+    head->fpflag = tb->fpflag;
+    head->ntablebits = tb->ntablebits;
+    head->rlo = tb->rlo;
+    head->rhi = tb->rhi;
+    head->fplo = tb->fplo;
+    head->fphi = tb->fphi;
+    auto arrays = (double *) (void *) (buf + sizeof(TableFileData));
+    memcpy(arrays, tb->rfile, tb->ninput * sizeof(double));
+    memcpy(arrays + tb->ninput, tb->efile, tb->ninput * sizeof(double));
+    memcpy(arrays + 2 * tb->ninput, tb->ffile, tb->ninput * sizeof(double));
+
+    tb->shared = PotentialCache::insert(key, buf, nbytes);
+    delete[] buf;
+
+    memory->destroy(tb->rfile);
+    memory->destroy(tb->efile);
+    memory->destroy(tb->ffile);
+    arrays = (double *) (void *) ((char *) tb->shared + sizeof(TableFileData));
+    tb->rfile = arrays;
+    tb->efile = arrays + tb->ninput;
+    tb->ffile = arrays + 2 * tb->ninput;
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -832,6 +918,7 @@ void PairTable::null_table(Table *tb)
 {
   tb->rfile = tb->efile = tb->ffile = nullptr;
   tb->e2file = tb->f2file = nullptr;
+  tb->shared = nullptr;
   tb->rsq = tb->drsq = tb->e = tb->de = nullptr;
   tb->f = tb->df = tb->e2 = tb->f2 = nullptr;
 }
@@ -842,9 +929,15 @@ void PairTable::null_table(Table *tb)
 
 void PairTable::free_table(Table *tb)
 {
-  memory->destroy(tb->rfile);
-  memory->destroy(tb->efile);
-  memory->destroy(tb->ffile);
+  if (tb->shared) {
+    PotentialCache::release(tb->shared);
+    tb->rfile = tb->efile = tb->ffile = nullptr;
+    tb->shared = nullptr;
+  } else {
+    memory->destroy(tb->rfile);
+    memory->destroy(tb->efile);
+    memory->destroy(tb->ffile);
+  }
   memory->destroy(tb->e2file);
   memory->destroy(tb->f2file);
 
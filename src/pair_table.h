@@ -50,6 +50,7 @@ class PairTable : public Pair {
     double rlo, rhi, fplo, fphi, cut;
     double *rfile, *efile, *ffile;
     double *e2file, *f2file;
+    const void *shared;    // cache blob holding rfile/efile/ffile, or null if owned
     double innersq, delta, invdelta, deltasq6;
     double *rsq, *drsq, *e, *de, *f, *df, *e2, *f2;
   };
@@ -59,6 +60,7 @@ class PairTable : public Pair {
   int **tabindex;
 
   virtual void allocate();
+  template <int TBSTYLE> void eval(int, int);
   void read_table(Table *, char *, char *);
   void param_extract(Table *, char *);
   void bcast_table(Table *);
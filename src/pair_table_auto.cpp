@@ -0,0 +1,290 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_table_auto.h"
+
+#include "atom.h"
+#include "error.h"
+#include "force.h"
+#include "memory.h"
+#include "neighbor.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace LAMMPS_NS;
+
+enum { NONE, RLINEAR, RSQ, BMP };
+
+static constexpr double EPSILONQ = 1.0e-12;
+static constexpr double BIG = 1.0e300;
+
+/* ---------------------------------------------------------------------- */
+
+PairTableAuto::PairTableAuto(LAMMPS *lmp) : PairTable(lmp)
+{
+  substyle = nullptr;
+  sub_style = nullptr;
+  qtype = nullptr;
+
+  // tables are rebuilt from the sub-style on every init,
+  //   so both styles must be re-specified after a restart
+
+  restartinfo = 0;
+  unit_convert_flag = utils::NOCONVERT;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairTableAuto::~PairTableAuto()
+{
+  if (copymode) return;
+
+  delete substyle;
+  delete[] sub_style;
+  delete[] qtype;
+}
+
+/* ----------------------------------------------------------------------
+   global settings
+------------------------------------------------------------------------- */
+
+void PairTableAuto::settings(int narg, char **arg)
+{
+  if (narg < 4) utils::missing_cmd_args(FLERR, "pair_style table/auto", error);
+
+  if (strcmp(arg[0], "lookup") == 0)
+    tabstyle = LOOKUP;
+  else if (strcmp(arg[0], "linear") == 0)
+    tabstyle = LINEAR;
+  else if (strcmp(arg[0], "spline") == 0)
+    tabstyle = SPLINE;
+  else
+    error->all(FLERR, "Unknown table style in pair_style command: {}", arg[0]);
+
+  tablength = utils::inumeric(FLERR, arg[1], false, lmp);
+  if (tablength < 2) error->all(FLERR, "Illegal number of pair table entries: {}", tablength);
+
+  inner = utils::numeric(FLERR, arg[2], false, lmp);
+  if (inner <= 0.0) error->all(FLERR, "Invalid pair table lower boundary: {}", inner);
+
+  // create the analytic sub-style and pass it the remaining args
+
+  if (utils::strmatch(arg[3], "^hybrid"))
+    error->all(FLERR, "Pair style table/auto cannot have hybrid as a sub-style");
+  if (utils::strmatch(arg[3], "^table"))
+    error->all(FLERR, "Pair style table/auto cannot have a table style as a sub-style");
+  if (strcmp(arg[3], "none") == 0)
+    error->all(FLERR, "Pair style table/auto cannot have none as a sub-style");
+
+  delete substyle;
+  delete[] sub_style;
+  int dummy;
+  substyle = force->new_pair(arg[3], 1, dummy);
+  sub_style = force->store_style(arg[3], 0);
+  substyle->settings(narg - 4, &arg[4]);
+
+  if (!substyle->single_enable)
+    error->all(FLERR, "Pair table/auto sub-style {} does not support single() calls", sub_style);
+
+  // the tabulated potential inherits the long-range compatibility
+  //   of the analytic form it samples
+
+  ewaldflag = substyle->ewaldflag;
+  pppmflag = substyle->pppmflag;
+  msmflag = substyle->msmflag;
+  dispersionflag = substyle->dispersionflag;
+  tip4pflag = substyle->tip4pflag;
+
+  // delete old tables, since cannot just change settings
+
+  for (int m = 0; m < ntables; m++) free_table(&tables[m]);
+  memory->sfree(tables);
+
+  if (allocated) {
+    memory->destroy(setflag);
+    memory->destroy(cutsq);
+    memory->destroy(tabindex);
+  }
+  allocated = 0;
+
+  ntables = 0;
+  tables = nullptr;
+}
+
+/* ----------------------------------------------------------------------
+   set coeffs for one or more type pairs
+   args are passed through verbatim to the sub-style
+------------------------------------------------------------------------- */
+
+void PairTableAuto::coeff(int narg, char **arg)
+{
+  if (!allocated) allocate();
+
+  substyle->coeff(narg, arg);
+
+  // mirror the sub-style's setflag
+  // type pairs it leaves to mixing are mixed by its init_one()
+
+  for (int i = 1; i <= atom->ntypes; i++)
+    for (int j = i; j <= atom->ntypes; j++)
+      if (substyle->setflag[i][j]) setflag[i][j] = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairTableAuto::init_style()
+{
+  // discard all tables, since sub-style coeffs may have changed since last init
+
+  for (int m = 0; m < ntables; m++) free_table(&tables[m]);
+  memory->sfree(tables);
+  ntables = 0;
+  tables = nullptr;
+
+  // sampling single() evaluates charge-dependent terms via atom->q[0]*atom->q[1],
+  //   so a single table per type pair requires uniform charges within each type
+
+  delete[] qtype;
+  qtype = nullptr;
+
+  if (atom->q_flag) {
+    const int ntypes = atom->ntypes;
+    qtype = new double[ntypes + 1];
+    auto qmin = new double[ntypes + 1];
+    auto qmax = new double[ntypes + 1];
+    for (int m = 0; m <= ntypes; m++) {
+      qmin[m] = BIG;
+      qmax[m] = -BIG;
+    }
+
+    double *q = atom->q;
+    int *type = atom->type;
+    int nlocal = atom->nlocal;
+    for (int i = 0; i < nlocal; i++) {
+      qmin[type[i]] = MIN(qmin[type[i]], q[i]);
+      qmax[type[i]] = MAX(qmax[type[i]], q[i]);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, qmin, ntypes + 1, MPI_DOUBLE, MPI_MIN, world);
+    MPI_Allreduce(MPI_IN_PLACE, qmax, ntypes + 1, MPI_DOUBLE, MPI_MAX, world);
+
+    for (int m = 1; m <= ntypes; m++) {
+      if (qmin[m] > qmax[m])
+        qtype[m] = 0.0;
+      else if (qmax[m] - qmin[m] > EPSILONQ)
+        error->all(FLERR, "Pair style table/auto requires all atoms of type {} to have the same charge", m);
+      else
+        qtype[m] = qmax[m];
+    }
+    delete[] qmin;
+    delete[] qmax;
+  }
+
+  substyle->init_style();
+  neighbor->add_request(this);
+}
+
+/* ----------------------------------------------------------------------
+   init for one type pair i,j and corresponding j,i
+------------------------------------------------------------------------- */
+
+double PairTableAuto::init_one(int i, int j)
+{
+  double cut = substyle->init_one(i, j);
+
+  // set cutsq in sub-style just as Pair::init() would,
+  //   since the sub-style is never initialized directly
+
+  substyle->cutsq[i][j] = substyle->cutsq[j][i] = cut * cut;
+  etail_ij = substyle->etail_ij;
+
+  if (cut <= inner)
+    error->all(FLERR, "Pair table/auto inner cutoff {} >= cutoff {} for types {} {}", inner, cut, i,
+               j);
+
+  tabulate_one(i, j, cut);
+  tabindex[j][i] = tabindex[i][j];
+  setflag[i][j] = 1;
+
+  return cut;
+}
+
+/* ----------------------------------------------------------------------
+   build one table for type pair i,j by sampling the sub-style's single()
+   equivalent to reading an RSQ table with N = tablength and rhi = cut,
+   so tabstyle linear copies the sampled values without re-interpolation
+------------------------------------------------------------------------- */
+
+void PairTableAuto::tabulate_one(int itype, int jtype, double cut)
+{
+  tables = (Table *) memory->srealloc(tables, (ntables + 1) * sizeof(Table), "pair:tables");
+  Table *tb = &tables[ntables];
+  null_table(tb);
+
+  tb->ninput = tablength;
+  tb->rflag = RSQ;
+  tb->fpflag = 0;
+  tb->ntablebits = 0;
+  tb->rlo = inner;
+  tb->rhi = cut;
+  tb->cut = cut;
+
+  memory->create(tb->rfile, tb->ninput, "pair:rfile");
+  memory->create(tb->efile, tb->ninput, "pair:efile");
+  memory->create(tb->ffile, tb->ninput, "pair:ffile");
+
+  // temporarily replace the charge array so single() sees
+  //   the per-type charges as q[0] and q[1], as in Pair::write_file()
+
+  double *q_hold = nullptr;
+  double qij[2];
+  if (atom->q) {
+    q_hold = atom->q;
+    qij[0] = qtype[itype];
+    qij[1] = qtype[jtype];
+    atom->q = qij;
+  }
+
+  const double innersq = inner * inner;
+  const double cutsq_table = cut * cut;
+  double r, rsq, e, f;
+
+  for (int k = 0; k < tb->ninput; k++) {
+    rsq = innersq + (cutsq_table - innersq) * k / (tb->ninput - 1);
+    r = sqrt(rsq);
+    e = substyle->single(0, 1, itype, jtype, rsq, 1.0, 1.0, f);
+    tb->rfile[k] = r;
+    tb->efile[k] = e;
+    tb->ffile[k] = f * r;
+  }
+
+  if (q_hold) atom->q = q_hold;
+
+  // sampled grid matches the final linear table grid exactly
+
+  tb->match = 0;
+  if (tabstyle == LINEAR) tb->match = 1;
+
+  if (tb->match == 0) spline_table(tb);
+  compute_table(tb);
+
+  tabindex[itype][jtype] = ntables;
+  ntables++;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void *PairTableAuto::extract(const char *str, int &dim)
+{
+  return substyle->extract(str, dim);
+}
@@ -0,0 +1,50 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+// clang-format off
+PairStyle(table/auto,PairTableAuto);
+// clang-format on
+#else
+
+#ifndef LMP_PAIR_TABLE_AUTO_H
+#define LMP_PAIR_TABLE_AUTO_H
+
+#include "pair_table.h"
+
+namespace LAMMPS_NS {
+
+class PairTableAuto : public PairTable {
+ public:
+  PairTableAuto(class LAMMPS *);
+  ~PairTableAuto() override;
+
+  void settings(int, char **) override;
+  void coeff(int, char **) override;
+  void init_style() override;
+  double init_one(int, int) override;
+  void *extract(const char *, int &) override;
+
+ protected:
+  Pair *substyle;     // analytic sub-style sampled to build the tables
+  char *sub_style;    // sub-style name for error messages
+  double inner;       // inner cutoff of the tabulation
+  double *qtype;      // per-type charge used when sampling single()
+
+  void tabulate_one(int, int, double);
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
+#endif
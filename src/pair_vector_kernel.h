@@ -0,0 +1,149 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_PAIR_VECTOR_KERNEL_H
+#define LMP_PAIR_VECTOR_KERNEL_H
+
+#include "lmptype.h"    // IWYU pragma: export
+
+// helpers for writing vectorizable inner loops in plain pair styles
+// a style strip-mines each neighbor list into blocks: pack() gathers the
+//   neighbors inside the cutoff into contiguous arrays, the style then runs
+//   its force law over the packed block in a loop free of cutoff branches,
+//   special-bond unmasking and strided loads, which compilers can
+//   auto-vectorize, and scatter() applies the reaction forces
+// only useful on force-only steps: energy/virial tallies need ev_tally()
+//   and should keep using the style's regular scalar loop
+// building with -DLMP_PAIR_MIXED_PRECISION runs the packed pair math in
+//   single precision while the per-atom force accumulation stays double,
+//   doubling the effective SIMD width, the cutoff test in pack() remains
+//   double so list traversal is unaffected
+
+namespace LAMMPS_NS {
+namespace PairVector {
+
+// precision of the packed data and of the force laws operating on it
+
+#ifdef LMP_PAIR_MIXED_PRECISION
+typedef float flt_t;
+#else
+typedef double flt_t;
+#endif
+
+// # of neighbors gathered per block: the scratch block must stay
+//   L1-resident, while larger blocks amortize the strip-mining overhead
+
+static constexpr int BLOCKSIZE = 128;
+
+// per-block scratch filled by pack(), fpair is filled by the caller
+
+struct Block {
+  flt_t delx[BLOCKSIZE], dely[BLOCKSIZE], delz[BLOCKSIZE];
+  flt_t rsq[BLOCKSIZE];
+  flt_t factor_lj[BLOCKSIZE], factor_coul[BLOCKSIZE];
+  flt_t fpair[BLOCKSIZE];
+  int jidx[BLOCKSIZE], jtype[BLOCKSIZE];
+};
+
+/* ----------------------------------------------------------------------
+   gather neighbors jfrom..jto-1 of an atom at (xtmp,ytmp,ztmp) that are
+     inside the cutoff into blk, cutsq_i = cutoff matrix row of its type
+   return # of neighbors packed
+------------------------------------------------------------------------- */
+
+inline int pack(Block &blk, const int *jlist, int jfrom, int jto, const double *const *x,
+                const int *type, double xtmp, double ytmp, double ztmp, const double *cutsq_i,
+                const double *special_lj, const double *special_coul)
+{
+  int n = 0;
+  for (int jj = jfrom; jj < jto; jj++) {
+    int j = jlist[jj];
+    const double factor_lj = special_lj[j >> SBBITS & 3];
+    const double factor_coul = special_coul[j >> SBBITS & 3];
+    j &= NEIGHMASK;
+
+    const double delx = xtmp - x[j][0];
+    const double dely = ytmp - x[j][1];
+    const double delz = ztmp - x[j][2];
+    const double rsq = delx * delx + dely * dely + delz * delz;
+    const int jtype = type[j];
+
+    if (rsq < cutsq_i[jtype]) {
+      blk.delx[n] = (flt_t) delx;
+      blk.dely[n] = (flt_t) dely;
+      blk.delz[n] = (flt_t) delz;
+      blk.rsq[n] = (flt_t) rsq;
+      blk.factor_lj[n] = (flt_t) factor_lj;
+      blk.factor_coul[n] = (flt_t) factor_coul;
+      blk.jidx[n] = j;
+      blk.jtype[n] = jtype;
+      n++;
+    }
+  }
+  return n;
+}
+
+/* ----------------------------------------------------------------------
+   same as pack() for a run of neighbors known to carry no special-bond
+     encoding bits, see NeighList::sort_special(): no sbmask() decode and
+     no scale-factor gathers, blk.factor arrays are left untouched
+------------------------------------------------------------------------- */
+
+inline int pack_plain(Block &blk, const int *jlist, int jfrom, int jto, const double *const *x,
+                      const int *type, double xtmp, double ytmp, double ztmp,
+                      const double *cutsq_i)
+{
+  int n = 0;
+  for (int jj = jfrom; jj < jto; jj++) {
+    const int j = jlist[jj];
+
+    const double delx = xtmp - x[j][0];
+    const double dely = ytmp - x[j][1];
+    const double delz = ztmp - x[j][2];
+    const double rsq = delx * delx + dely * dely + delz * delz;
+    const int jtype = type[j];
+
+    if (rsq < cutsq_i[jtype]) {
+      blk.delx[n] = (flt_t) delx;
+      blk.dely[n] = (flt_t) dely;
+      blk.delz[n] = (flt_t) delz;
+      blk.rsq[n] = (flt_t) rsq;
+      blk.jidx[n] = j;
+      blk.jtype[n] = jtype;
+      n++;
+    }
+  }
+  return n;
+}
+
+/* ----------------------------------------------------------------------
+   scatter the reaction forces of a packed block onto the j atoms
+   the i-atom side is accumulated by the caller inside its force loop
+------------------------------------------------------------------------- */
+
+inline void scatter(const Block &blk, int n, double **f, int nlocal, int newton_pair)
+{
+  for (int k = 0; k < n; k++) {
+    const int j = blk.jidx[k];
+    if (newton_pair || j < nlocal) {
+      f[j][0] -= (double) (blk.delx[k] * blk.fpair[k]);
+      f[j][1] -= (double) (blk.dely[k] * blk.fpair[k]);
+      f[j][2] -= (double) (blk.delz[k] * blk.fpair[k]);
+    }
+  }
+}
+
+}    // namespace PairVector
+}    // namespace LAMMPS_NS
+
+#endif
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "potential_cache.h"
+
+#include "fmt/format.h"
+#include "hashlittle.h"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+using namespace LAMMPS_NS;
+
+namespace {
+struct Entry {
+  char *data;
+  std::size_t nbytes;
+  int nref;
+};
+
+std::map<std::string, Entry> cache;
+std::mutex cache_mutex;
+}    // namespace
+
+/* ----------------------------------------------------------------------
+   build cache key from file path, section name, and file content hash
+------------------------------------------------------------------------- */
+
+std::string PotentialCache::file_key(const std::string &filename, const std::string &section)
+{
+  FILE *fp = fopen(filename.c_str(), "rb");
+  if (!fp) return "";
+
+  char buf[16384];
+  std::size_t n;
+  uint32_t hash = 0;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) hash = hashlittle(buf, n, hash);
+  fclose(fp);
+
+  return fmt::format("{}:{}:{:08x}", filename, section, hash);
+}
+
+/* ---------------------------------------------------------------------- */
+
+const void *PotentialCache::acquire(const std::string &key, std::size_t &nbytes)
+{
+  const std::lock_guard<std::mutex> lock(cache_mutex);
+  auto entry = cache.find(key);
+  if (entry == cache.end()) return nullptr;
+  entry->second.nref++;
+  nbytes = entry->second.nbytes;
+  return entry->second.data;
+}
+
+/* ---------------------------------------------------------------------- */
+
+const void *PotentialCache::insert(const std::string &key, const void *data, std::size_t nbytes)
+{
+  const std::lock_guard<std::mutex> lock(cache_mutex);
+  auto entry = cache.find(key);
+  if (entry != cache.end()) {
+    entry->second.nref++;
+    return entry->second.data;
+  }
+
+  Entry newentry;
+  newentry.data = new char[nbytes];
+  newentry.nbytes = nbytes;
+  newentry.nref = 1;
+  memcpy(newentry.data, data, nbytes);
+  cache[key] = newentry;
+  return newentry.data;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PotentialCache::release(const void *blob)
+{
+  const std::lock_guard<std::mutex> lock(cache_mutex);
+  for (auto entry = cache.begin(); entry != cache.end(); ++entry) {
+    if (entry->second.data == blob) {
+      if (--entry->second.nref == 0) {
+        delete[] entry->second.data;
+        cache.erase(entry);
+      }
+      return;
+    }
+  }
+}
@@ -0,0 +1,57 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_POTENTIAL_CACHE_H
+#define LMP_POTENTIAL_CACHE_H
+
+#include <cstddef>
+#include <string>
+
+namespace LAMMPS_NS {
+
+/* process-wide cache of immutable force field data parsed from files.
+
+   when several pair style or LAMMPS instances in the same process read
+   the same potential file, only the first one parses it; the others
+   attach to a shared read-only copy of the resulting arrays.  entries
+   are reference counted and freed when the last user releases them.
+   all functions are thread safe. */
+
+namespace PotentialCache {
+
+  // cache key for one section of a potential file.  the key includes a
+  // hash of the file contents, so a modified file is never confused
+  // with a cached copy of its old contents.  returns an empty string
+  // (= do not cache) if the file cannot be read.
+
+  std::string file_key(const std::string &filename, const std::string &section);
+
+  // look up a blob.  on a hit the reference count is incremented and
+  // the shared pointer and size are returned; on a miss returns null.
+
+  const void *acquire(const std::string &key, std::size_t &nbytes);
+
+  // insert a copy of *data* under *key* and return the shared pointer
+  // with a reference count of one.  if the key was inserted by another
+  // thread in the meantime, the existing copy is returned instead.
+
+  const void *insert(const std::string &key, const void *data, std::size_t nbytes);
+
+  // drop one reference to a blob returned by acquire() or insert().
+  // the blob is freed when the count reaches zero.
+
+  void release(const void *blob);
+}    // namespace PotentialCache
+}    // namespace LAMMPS_NS
+
+#endif
@@ -145,6 +145,43 @@ void ProcMap::twolevel_grid(int nprocs, int *user_procgrid, int *procgrid,
   memory->destroy(factors);
 }
 
+/* ----------------------------------------------------------------------
+   query MPI for # of procs running on each node
+   procs sharing a processor name are assumed to share a node
+   return count for the first node; caller must check divisibility
+     if uniform counts across nodes are required
+------------------------------------------------------------------------- */
+
+int ProcMap::cores_per_node()
+{
+  int nprocs = comm->nprocs;
+
+  // get names of all nodes
+
+  int name_length;
+  char node_name[MPI_MAX_PROCESSOR_NAME];
+  MPI_Get_processor_name(node_name,&name_length);
+  node_name[name_length] = '\0';
+  auto node_names = new char[MPI_MAX_PROCESSOR_NAME*nprocs];
+  MPI_Allgather(node_name,MPI_MAX_PROCESSOR_NAME,MPI_CHAR,node_names,
+                MPI_MAX_PROCESSOR_NAME,MPI_CHAR,world);
+
+  // get number of procs per node
+  // NOTE: could do this without STL map
+
+  std::map<std::string,int> name_map;
+  std::map<std::string,int>::iterator np;
+  for (int i = 0; i < nprocs; i++) {
+    std::string i_string = std::string(&node_names[i*MPI_MAX_PROCESSOR_NAME]);
+    np = name_map.find(i_string);
+    if (np == name_map.end()) name_map[i_string] = 1;
+    else np->second++;
+  }
+  delete [] node_names;
+
+  return name_map.begin()->second;
+}
+
 /* ----------------------------------------------------------------------
    create a 3d grid of procs that does a 2-level hierarchy within a node
    auto-detects NUMA sockets within a multi-core node
@@ -22,6 +22,7 @@ class ProcMap : protected Pointers {
  public:
   ProcMap(class LAMMPS *);
 
+  int cores_per_node();
   void onelevel_grid(int, int *, int *, int, int, int *, int *);
   void twolevel_grid(int, int *, int *, int, int *, int *, int, int, int *, int *);
   void numa_grid(int, int, int *, int *, int *);
@@ -0,0 +1,137 @@
+// clang-format off
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+// counter-based random number generator using the Threefry-4x64 bijection
+// see Salmon, Moraes, Dror, Shaw, Proc SC'11 (2011), doi:10.1145/2063384.2063405
+//
+// unlike RanMars/RanPark there is no evolving generator state: each random
+// number is a pure function of the seed and a (timestep,atom ID,index)
+// counter.  the same counter always yields the same number, on any proc or
+// thread and in any order of evaluation, so per-atom noise is bitwise
+// reproducible for any processor count, thread count, or restart point.
+// all procs should therefore be seeded identically (no "seed + comm->me")
+
+#include "random_counter.h"
+
+#include "error.h"
+
+#include <cmath>
+
+using namespace LAMMPS_NS;
+
+static constexpr double UINT53_INV = 1.0/9007199254740992.0;    // 2^-53
+static constexpr double MY_2PI = 6.28318530717958647692;
+
+/* ---------------------------------------------------------------------- */
+
+RanCounter::RanCounter(LAMMPS *lmp, int seed) : Pointers(lmp)
+{
+  if (seed <= 0) error->one(FLERR,"Invalid seed for Threefry random # generator");
+
+  key = (uint64_t) seed;
+  cstep = 0;
+  cid = 0;
+  cwhich = 0;
+}
+
+/* ----------------------------------------------------------------------
+   Threefry-4x64 block function with 20 rounds
+   maps the counter (c0,c1,c2,0) keyed on the seed to 4 independent
+   64-bit words, of which the first two are used by the callers below
+------------------------------------------------------------------------- */
+
+void RanCounter::threefry(uint64_t c0, uint64_t c1, uint64_t c2, uint64_t *out) const
+{
+  static const int rot[8][2] =
+    {{14,16},{52,57},{23,40},{5,37},{25,33},{46,12},{58,22},{32,32}};
+
+  uint64_t ks[5];
+  ks[0] = key;
+  ks[1] = ks[2] = ks[3] = 0;
+  ks[4] = 0x1BD11BDAA9FC1A22ULL ^ key;
+
+  uint64_t x0 = c0 + ks[0];
+  uint64_t x1 = c1 + ks[1];
+  uint64_t x2 = c2 + ks[2];
+  uint64_t x3 = ks[3];
+
+  for (int i = 0; i < 20; i++) {
+    const int *r = rot[i % 8];
+    x0 += x1; x1 = (x1 << r[0]) | (x1 >> (64-r[0])); x1 ^= x0;
+    x2 += x3; x3 = (x3 << r[1]) | (x3 >> (64-r[1])); x3 ^= x2;
+    uint64_t tmp = x1; x1 = x3; x3 = tmp;
+    if ((i+1) % 4 == 0) {
+      const uint64_t s = (i+1)/4;
+      x0 += ks[s % 5];
+      x1 += ks[(s+1) % 5];
+      x2 += ks[(s+2) % 5];
+      x3 += ks[(s+3) % 5] + s;
+    }
+  }
+
+  out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+}
+
+/* ----------------------------------------------------------------------
+   uniform RN in (0,1) for counter (step,id,which)
+   which distinguishes multiple numbers drawn for the same atom and step
+------------------------------------------------------------------------- */
+
+double RanCounter::uniform(bigint step, tagint id, int which)
+{
+  uint64_t out[4];
+  threefry((uint64_t) step,(uint64_t) id,(uint64_t) which,out);
+  return ((double) (out[0] >> 11) + 0.5)*UINT53_INV;
+}
+
+/* ----------------------------------------------------------------------
+   gaussian RN with zero mean and unit variance for counter (step,id,which)
+   Box-Muller on two lanes of a single Threefry block
+------------------------------------------------------------------------- */
+
+double RanCounter::gaussian(bigint step, tagint id, int which)
+{
+  uint64_t out[4];
+  threefry((uint64_t) step,(uint64_t) id,(uint64_t) which,out);
+  const double u1 = ((double) (out[0] >> 11) + 0.5)*UINT53_INV;
+  const double u2 = ((double) (out[1] >> 11) + 0.5)*UINT53_INV;
+  return sqrt(-2.0*log(u1)) * cos(MY_2PI*u2);
+}
+
+/* ----------------------------------------------------------------------
+   position the cursor used by the argument-free draws below
+   for serial consumers which draw a variable # of numbers per step,
+   e.g. rejection sampling: call rewind() once per step, then draw
+------------------------------------------------------------------------- */
+
+void RanCounter::rewind(bigint step, tagint id)
+{
+  cstep = step;
+  cid = id;
+  cwhich = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+double RanCounter::uniform()
+{
+  return uniform(cstep,cid,cwhich++);
+}
+
+/* ---------------------------------------------------------------------- */
+
+double RanCounter::gaussian()
+{
+  return gaussian(cstep,cid,cwhich++);
+}
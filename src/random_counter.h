@@ -0,0 +1,43 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_RANCOUNTER_H
+#define LMP_RANCOUNTER_H
+
+#include "pointers.h"
+
+#include <cstdint>
+
+namespace LAMMPS_NS {
+
+class RanCounter : protected Pointers {
+ public:
+  RanCounter(class LAMMPS *, int);
+  double uniform(bigint, tagint, int);
+  double gaussian(bigint, tagint, int);
+  void rewind(bigint, tagint);
+  double uniform();
+  double gaussian();
+
+ private:
+  uint64_t key;
+  bigint cstep;
+  tagint cid;
+  int cwhich;
+
+  void threefry(uint64_t, uint64_t, uint64_t, uint64_t *) const;
+};
+
+}    // namespace LAMMPS_NS
+
+#endif
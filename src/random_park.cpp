@@ -127,6 +127,50 @@ void RanPark::reset(int ibase, double *coord)
   save = 0;
 }
 
+/* ----------------------------------------------------------------------
+   reset the seed based on atom ID and ibase = caller seed
+   use same hash function as for coord-based reset above
+   unlike coords, IDs hash identically across machines
+------------------------------------------------------------------------- */
+
+void RanPark::reset(int ibase, tagint id)
+{
+  int i;
+
+  auto str = (char *) &ibase;
+  int n = sizeof(int);
+
+  unsigned int hash = 0;
+  for (i = 0; i < n; i++) {
+    hash += str[i];
+    hash += (hash << 10);
+    hash ^= (hash >> 6);
+  }
+
+  str = (char *) &id;
+  n = sizeof(tagint);
+  for (i = 0; i < n; i++) {
+    hash += str[i];
+    hash += (hash << 10);
+    hash ^= (hash >> 6);
+  }
+
+  hash += (hash << 3);
+  hash ^= (hash >> 11);
+  hash += (hash << 15);
+
+  // keep 31 bits of unsigned int as new seed
+  // do not allow seed = 0, since will cause hang in gaussian()
+
+  seed = hash & 0x7ffffff;
+  if (!seed) seed = 1;
+
+  // warm up the RNG
+
+  for (i = 0; i < 5; i++) uniform();
+  save = 0;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int RanPark::state()
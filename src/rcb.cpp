@@ -30,8 +30,6 @@ static constexpr int DELTA = 16384;
 void box_merge(void *, void *, int *, MPI_Datatype *);
 void median_merge(void *, void *, int *, MPI_Datatype *);
 
-// NOTE: if want to have reuse flag, need to sum Tree across procs
-
 /* ---------------------------------------------------------------------- */
 
 RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
@@ -51,7 +49,8 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   maxrecv = maxsend = 0;
   recvproc = recvindex = sendproc = sendindex = nullptr;
 
-  tree = nullptr;
+  tree = (Tree *) memory->smalloc(nprocs*sizeof(Tree),"RCB:tree");
+  tree_valid = 0;
   irregular = nullptr;
 
   // create MPI data and function types for box and median AllReduce ops
@@ -161,6 +160,11 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
   cut = 0.0;
   cutdim = -1;
 
+  // warm = 1 if warm-starting cuts from tree of a previous invocation
+  // requires caller request it and a previous compute() filled the tree
+
+  int warm = reuse && tree_valid;
+
   // initialize counters
 
   counters[0] = 0;
@@ -244,11 +248,21 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
     // dotmark_select = dot markings in that dimension
     // initialize largest = -1.0 to ensure a cut in some dim is accepted
     //   e.g. if current recursed box is size 0 in all dims
+    // if warm-starting, only attempt the cut in the dimension this cut
+    //   used in the previous tree, so the hierarchy of cut dimensions is
+    //   preserved and each cut only shifts as far as the weights require
+
+    int dimlo = 0;
+    int dimhi = dimension;
+    if (warm && tree[procmid].dim >= 0) {
+      dimlo = tree[procmid].dim;
+      dimhi = dimlo + 1;
+    }
 
     int dim_select = -1;
     double largest = -1.0;
 
-    for (dim = 0; dim < dimension; dim++) {
+    for (dim = dimlo; dim < dimhi; dim++) {
 
       // create active list and mark array for dots
       // initialize active list to all dots
@@ -292,7 +306,7 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
         // on 2nd option: could push valuehalf towards geometric center
         //   with "1.0-factor" to force overshoot
 
-        if (first_iteration && reuse && dim == tree[procmid].dim) {
+        if (first_iteration && warm && dim == tree[procmid].dim) {
           counters[5]++;
           valuehalf = tree[procmid].cut;
           if (valuehalf < valuemin || valuehalf > valuemax)
@@ -612,6 +626,17 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
 
   MPI_Comm_free(&comm);
 
+  // save tree of cuts for possible warm start on next invocation
+  // proc 0 owns no cut, every other proc owns the cut that split it
+  //   from the lower half of its partition
+  // allgather so all procs have a consistent copy of the full tree
+
+  Tree mytree;
+  mytree.cut = cut;
+  mytree.dim = cutdim;
+  MPI_Allgather(&mytree,sizeof(Tree),MPI_CHAR,tree,sizeof(Tree),MPI_CHAR,world);
+  tree_valid = 1;
+
   // set public variables with results of rebalance
 
   nfinal = ndot;
@@ -698,6 +723,11 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
   cut = 0.0;
   cutdim = -1;
 
+  // warm = 1 if warm-starting cuts from tree of a previous invocation
+  // requires caller request it and a previous compute() filled the tree
+
+  int warm = reuse && tree_valid;
+
   // initialize counters
 
   counters[0] = 0;
@@ -773,6 +803,8 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
 
     // dim = dimension to bisect on
     // do not allow choice of z dimension for 2d system
+    // if warm-starting, keep the dimension this cut used in the
+    //   previous tree so the decomposition stays close to the old one
 
     dim = 0;
     if (hi[1]-lo[1] > hi[0]-lo[0]) dim = 1;
@@ -780,6 +812,7 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
       if (dim == 0 && hi[2]-lo[2] > hi[0]-lo[0]) dim = 2;
       if (dim == 1 && hi[2]-lo[2] > hi[1]-lo[1]) dim = 2;
     }
+    if (warm && tree[procmid].dim >= 0) dim = tree[procmid].dim;
 
     // create active list and mark array for dots
     // initialize active list to all dots
@@ -821,7 +854,7 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
       // on 2nd option: could push valuehalf towards geometric center
       //   with "1.0-factor" to force overshoot
 
-      if (first_iteration && reuse && dim == tree[procmid].dim) {
+      if (first_iteration && warm && dim == tree[procmid].dim) {
         counters[5]++;
         valuehalf = tree[procmid].cut;
         if (valuehalf < valuemin || valuehalf > valuemax)
@@ -1104,6 +1137,17 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
 
   MPI_Comm_free(&comm);
 
+  // save tree of cuts for possible warm start on next invocation
+  // proc 0 owns no cut, every other proc owns the cut that split it
+  //   from the lower half of its partition
+  // allgather so all procs have a consistent copy of the full tree
+
+  Tree mytree;
+  mytree.cut = cut;
+  mytree.dim = cutdim;
+  MPI_Allgather(&mytree,sizeof(Tree),MPI_CHAR,tree,sizeof(Tree),MPI_CHAR,world);
+  tree_valid = 1;
+
   // set public variables with results of rebalance
 
   nfinal = ndot;
@@ -38,6 +38,11 @@ class RCB : protected Pointers {
   int *sendproc;     // proc to send each of my noriginal dots to
   int *sendindex;    // index of dot in receiver's nfinal list
 
+  // set by caller before compute()
+
+  int reuse;    // 1 to warm-start cuts from tree of previous compute()
+                //   0 to compute all cuts from scratch
+
   RCB(class LAMMPS *);
   ~RCB() override;
   void compute(int, int, double **, double *, double *, double *);
@@ -112,11 +117,11 @@ class RCB : protected Pointers {
   MPI_Op box_op, med_op;
   MPI_Datatype box_type, med_type;
 
-  int reuse;           // 1/0 to use/not use previous cuts
   int dottop;          // dots >= this index are new
   double bboxlo[3];    // bounding box of final RCB sub-domain
   double bboxhi[3];
-  Tree *tree;         // tree of RCB cuts, used by reuse()
+  Tree *tree;         // tree of RCB cuts from previous compute()
+  int tree_valid;     // 1 if tree holds cuts from a previous compute()
   int counters[7];    // diagnostic counts
                       // 0 = # of median iterations
                       // 1 = # of points sent
@@ -155,6 +155,9 @@ void ReadData::command(int narg, char **arg)
 
   groupbit = 0;
 
+  parallelflag = 0;
+  indexfile.clear();
+
   nfix = 0;
   fix_index = nullptr;
   fix_header = nullptr;
@@ -295,6 +298,11 @@ void ReadData::command(int narg, char **arg)
         error->all(FLERR, "Illegal read_data extra/special/per/atom value {}",
                    force->special_extra);
       iarg += 2;
+    } else if (strcmp(arg[iarg], "index") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "read_data index", error);
+      parallelflag = 1;
+      indexfile = arg[iarg + 1];
+      iarg += 2;
     } else if (strcmp(arg[iarg], "group") == 0) {
       if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "read_data group", error);
       int igroup = group->find_or_create(arg[iarg + 1]);
@@ -366,6 +374,34 @@ void ReadData::command(int narg, char **arg)
   if (!platform::file_is_readable(arg[0]))
     error->all(FLERR, "Cannot open file {}: {}", arg[0], utils::getsyserror());
 
+  // for parallel reading, get Atoms section byte offsets from the index file
+  // every proc will open the data file itself, so it cannot be compressed
+
+  if (parallelflag) {
+    if (platform::has_compress_extension(arg[0]))
+      error->all(FLERR, "Cannot use read_data index with compressed data file");
+    datafile = arg[0];
+    atoms_offset[0] = atoms_offset[1] = -1;
+    if (me == 0) {
+      FILE *fpidx = fopen(indexfile.c_str(), "r");
+      if (!fpidx)
+        error->one(FLERR, "Cannot open index file {}: {}", indexfile, utils::getsyserror());
+      char idxline[MAXLINE];
+      while (fgets(idxline, MAXLINE, fpidx)) {
+        auto words = utils::split_words(idxline);
+        if ((words.size() < 3) || (words[0][0] == '#')) continue;
+        if (words[0] == "Atoms") {
+          atoms_offset[0] = utils::bnumeric(FLERR, words[1], false, lmp);
+          atoms_offset[1] = utils::bnumeric(FLERR, words[2], false, lmp);
+        }
+      }
+      fclose(fpidx);
+    }
+    MPI_Bcast(atoms_offset, 2, MPI_LMP_BIGINT, 0, world);
+    if ((atoms_offset[0] < 0) || (atoms_offset[1] < atoms_offset[0]))
+      error->all(FLERR, "No valid Atoms section offsets in index file {}", indexfile);
+  }
+
   // reset so we can warn about reset image flags exactly once per data file
 
   atom->reset_image_flag[0] = atom->reset_image_flag[1] = atom->reset_image_flag[2] = false;
@@ -706,8 +742,11 @@ void ReadData::command(int narg, char **arg)
                 FLERR, "Atom style in data file {} differs from currently defined atom style {}",
                 style, atom->atom_style);
           atoms();
-        } else
-          skip_lines(natoms);
+        } else {
+          if (parallelflag) {
+            if (me == 0) platform::fseek(fp, atoms_offset[1]);
+          } else skip_lines(natoms);
+        }
 
       } else if (strcmp(keyword, "Velocities") == 0) {
         if (atomflag == 0) error->all(FLERR, "Must read Atoms before Velocities");
@@ -1520,15 +1559,25 @@ void ReadData::atoms()
 
   bigint nread = 0;
 
-  while (nread < natoms) {
-    nchunk = MIN(natoms - nread, CHUNK);
-    eof = utils::read_lines_from_file(fp, nchunk, MAXLINE, buffer, me, world);
-    if (eof) error->all(FLERR, "Unexpected end of data file");
-    if (tlabelflag && !lmap->is_complete(Atom::ATOM))
-      error->all(FLERR, "Label map is incomplete: all types must be assigned a unique type label");
-    atom->data_atoms(nchunk, buffer, id_offset, mol_offset, toffset, shiftflag, shift, tlabelflag,
-                     lmap->lmap2lmap.atom, triclinic_general);
-    nread += nchunk;
+  if (parallelflag) {
+
+    // all procs read their own byte slice of the section,
+    // proc 0 advances the shared file handle past it
+
+    atoms_parallel();
+    if (me == 0) platform::fseek(fp, atoms_offset[1]);
+
+  } else {
+    while (nread < natoms) {
+      nchunk = MIN(natoms - nread, CHUNK);
+      eof = utils::read_lines_from_file(fp, nchunk, MAXLINE, buffer, me, world);
+      if (eof) error->all(FLERR, "Unexpected end of data file");
+      if (tlabelflag && !lmap->is_complete(Atom::ATOM))
+        error->all(FLERR, "Label map is incomplete: all types must be assigned a unique type label");
+      atom->data_atoms(nchunk, buffer, id_offset, mol_offset, toffset, shiftflag, shift, tlabelflag,
+                       lmap->lmap2lmap.atom, triclinic_general);
+      nread += nchunk;
+    }
   }
 
   // warn if we have read data with non-zero image flags for non-periodic boundaries.
@@ -1577,6 +1626,89 @@ void ReadData::atoms()
   }
 }
 
+/* ----------------------------------------------------------------------
+   read the Atoms section in parallel using byte offsets from index file
+   each proc reads its own slice of the section directly from the file,
+   keeps every atom it parses, then migrates atoms to their owning procs
+------------------------------------------------------------------------- */
+
+void ReadData::atoms_parallel()
+{
+  if (tlabelflag && !lmap->is_complete(Atom::ATOM))
+    error->all(FLERR, "Label map is incomplete: all types must be assigned a unique type label");
+
+  // [mystart,mystop) = my byte slice of the section data lines
+  // lines which begin inside the slice belong to me
+  // read one extra byte before the slice to detect whether it starts mid-line
+
+  int nprocs = comm->nprocs;
+  bigint begin = atoms_offset[0];
+  bigint length = atoms_offset[1] - begin;
+  bigint mystart = begin + length * me / nprocs;
+  bigint mystop = begin + length * (me + 1) / nprocs;
+
+  FILE *fpslice = fopen(datafile.c_str(), "r");
+  if (!fpslice)
+    error->one(FLERR, "Cannot open file {}: {}", datafile, utils::getsyserror());
+
+  bigint offset = mystart;
+  if (me > 0) offset--;
+  platform::fseek(fpslice, offset);
+
+  bigint nbytes = mystop - offset;
+  char *abuf;
+  memory->create(abuf, nbytes + MAXLINE + 1, "read_data:abuf");
+  if ((bigint) fread(abuf, 1, nbytes, fpslice) != nbytes)
+    error->one(FLERR, "Unexpected end of data file");
+
+  // if the slice ends mid-line, that line began inside it: complete it
+
+  while (abuf[nbytes - 1] != '\n') {
+    int c = fgetc(fpslice);
+    if (c == EOF) error->one(FLERR, "Unexpected end of data file");
+    abuf[nbytes++] = (char) c;
+    if (nbytes > mystop - offset + MAXLINE - 1)
+      error->one(FLERR, "Too long line in Atoms section of data file");
+  }
+  fclose(fpslice);
+  abuf[nbytes] = '\0';
+
+  // unless the extra byte shows the slice starting on a line boundary,
+  // the first partial line belongs to the previous proc
+
+  char *ptr = abuf;
+  if (me > 0) {
+    ptr = strchr(abuf, '\n');
+    if (!ptr) ptr = abuf + nbytes;    // slice smaller than one line
+    else ptr++;
+  }
+
+  bigint nlines = 0;
+  for (char *p = ptr; (p = strchr(p, '\n')); p++) nlines++;
+
+  // parse CHUNK lines at a time as in the serial path, keeping all atoms
+
+  bigint nread = 0;
+  while (nread < nlines) {
+    int nchunk = (int) MIN(nlines - nread, (bigint) CHUNK);
+    char *next = ptr;
+    for (int i = 0; i < nchunk; i++) next = strchr(next, '\n') + 1;
+    atom->data_atoms(nchunk, ptr, id_offset, mol_offset, toffset, shiftflag, shift, tlabelflag,
+                     lmap->lmap2lmap.atom, triclinic_general, 1);
+    ptr = next;
+    nread += nchunk;
+  }
+  memory->destroy(abuf);
+
+  // migrate atoms to the procs which own their sub-domain
+
+  if (domain->triclinic) domain->x2lamda(atom->nlocal);
+  auto irregular = new Irregular(lmp);
+  irregular->migrate_atoms(1);
+  delete irregular;
+  if (domain->triclinic) domain->lamda2x(atom->nlocal);
+}
+
 /* ----------------------------------------------------------------------
    read all velocities
    to find atoms, must build atom map if not a molecular system
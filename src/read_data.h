@@ -81,6 +81,11 @@ class ReadData : public Command {
   int extra_dihedral_types, extra_improper_types;
   int groupbit;
 
+  int parallelflag;           // 1 if Atoms section is read in parallel byte slices
+  std::string datafile;       // name of data file for per-proc reopening
+  std::string indexfile;      // name of section byte-offset index file
+  bigint atoms_offset[2];     // begin/end offsets of Atoms section data lines
+
   int nfix;
   Fix **fix_index;
   char **fix_header;
@@ -98,6 +103,7 @@ class ReadData : public Command {
   int style_match(const char *, const char *);
 
   void atoms();
+  void atoms_parallel();
   void velocities();
 
   void bonds(int);
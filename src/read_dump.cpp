@@ -41,7 +41,8 @@ enum { NOADD, YESADD, KEEPADD };
 
 ReadDump::ReadDump(LAMMPS *lmp) :
     Command(lmp), files(nullptr), readerstyle(nullptr), fieldtype(nullptr), fieldlabel(nullptr),
-    fields(nullptr), buf(nullptr), nsnapatoms(nullptr), readers(nullptr)
+    fields(nullptr), buf(nullptr), nsnapatoms(nullptr), readers(nullptr), pthread(nullptr),
+    stagebuf(nullptr)
 {
   nfile = 0;
   nnew = maxnew = 0;
@@ -52,12 +53,22 @@ ReadDump::ReadDump(LAMMPS *lmp) :
   clustercomm = MPI_COMM_NULL;
   filereader = 0;
   parallel = 0;
+
+  prefetchflag = 0;
+  stagevalid = 0;
+  maxstage = 0;
 }
 
 /* ---------------------------------------------------------------------- */
 
 ReadDump::~ReadDump()
 {
+  if (pthread) {
+    pthread->join();
+    delete pthread;
+  }
+  memory->destroy(stagebuf);
+
   for (int i = 0; i < nfile; i++) delete[] files[i];
   delete[] files;
   for (int i = 0; i < nfield; i++) delete[] fieldlabel[i];
@@ -248,6 +259,33 @@ void ReadDump::setup_reader(int narg, char **arg)
       readers[i]->settings(narg, arg);
 }
 
+/* ----------------------------------------------------------------------
+   look up Nrequest in the frame index sidecar of a dump file, if present
+   sidecar = dump file name + ".idx" with one "timestep byte-offset" line
+     per snapshot, written via dump_modify index yes or generated offline
+   if exact = 1, match exactly Nrequest, else find first step >= Nrequest
+   return matching timestep and set its byte offset, -1 if no index/match
+------------------------------------------------------------------------- */
+
+bigint ReadDump::index_find(const std::string &file, bigint nrequest, int exact, bigint &offset)
+{
+  FILE *idxfp = fopen((file + ".idx").c_str(),"r");
+  if (idxfp == nullptr) return -1;
+
+  bigint step,pos,match = -1;
+  while (fscanf(idxfp,BIGINT_FORMAT " " BIGINT_FORMAT,&step,&pos) == 2) {
+    if (step >= nrequest) {
+      match = step;
+      offset = pos;
+      break;
+    }
+  }
+  fclose(idxfp);
+
+  if (exact && match != nrequest) return -1;
+  return match;
+}
+
 /* ----------------------------------------------------------------------
    seek Nrequest timestep in one or more dump files
    if exact = 1, must find exactly Nrequest
@@ -269,17 +307,33 @@ bigint ReadDump::seek(bigint nrequest, int exact)
 
     for (ifile = 0; ifile < nfile; ifile++) {
       ntimestep = -1;
-      if (multiproc) {
-        std::string multiname = files[ifile];
-        multiname.replace(multiname.find('%'),1,"0");
-        readers[0]->open_file(multiname);
-      } else readers[0]->open_file(files[ifile]);
+      std::string firstname = files[ifile];
+      if (multiproc) firstname.replace(firstname.find('%'),1,"0");
+      readers[0]->open_file(firstname);
 
-      while (true) {
+      // if a frame index sidecar exists, jump to the snapshot directly
+      // verify the indexed timestep is really there, else rescan from start
+
+      bigint offset;
+      int indexed = 0;
+      bigint nindex = index_find(firstname,nrequest,exact,offset);
+      if (nindex >= 0 && readers[0]->seek_to(offset) == 0) {
         eofflag = readers[0]->read_time(ntimestep);
-        if (eofflag) break;
-        if (ntimestep >= nrequest) break;
-        readers[0]->skip();
+        if (!eofflag && ntimestep == nindex) indexed = 1;
+        else {
+          readers[0]->close_file();
+          readers[0]->open_file(firstname);
+          ntimestep = -1;
+        }
+      }
+
+      if (!indexed) {
+        while (true) {
+          eofflag = readers[0]->read_time(ntimestep);
+          if (eofflag) break;
+          if (ntimestep >= nrequest) break;
+          readers[0]->skip();
+        }
       }
 
       if (ntimestep >= nrequest) break;
@@ -319,18 +373,33 @@ bigint ReadDump::seek(bigint nrequest, int exact)
       readers[i]->open_file(multiname);
 
       bigint step;
-      while (true) {
+      bigint offset;
+      int indexed = 0;
+      bigint nindex = index_find(multiname,ntimestep,1,offset);
+      if (nindex >= 0 && readers[i]->seek_to(offset) == 0) {
         eofflag = readers[i]->read_time(step);
-        if (eofflag) break;
-        if (step == ntimestep) break;
-        readers[i]->skip();
+        if (!eofflag && step == ntimestep) indexed = 1;
+        else {
+          readers[i]->close_file();
+          readers[i]->open_file(multiname);
+        }
       }
 
-      if (eofflag)
-        error->one(FLERR,"Read dump parallel files do not all have same timestep");
+      if (!indexed) {
+        while (true) {
+          eofflag = readers[i]->read_time(step);
+          if (eofflag) break;
+          if (step == ntimestep) break;
+          readers[i]->skip();
+        }
+
+        if (eofflag)
+          error->one(FLERR,"Read dump parallel files do not all have same timestep");
+      }
     }
   }
 
+  prefetch_current = ntimestep;
   return ntimestep;
 }
 
@@ -348,6 +417,25 @@ bigint ReadDump::next(bigint ncurrent, bigint nlast, int nevery, int nskip)
   int ifile,eofflag;
   bigint ntimestep;
 
+  // if prefetching, the helper thread launched at the end of the previous
+  // read_atoms() has already scanned for and decoded the next snapshot
+
+  if (prefetchflag) {
+    if (filereader) {
+      prefetch_wait();
+      ntimestep = stage_ntimestep;
+      currentfile = stage_currentfile;
+    }
+
+    MPI_Bcast(&ntimestep,1,MPI_LMP_BIGINT,0,world);
+    MPI_Bcast(&currentfile,1,MPI_INT,0,world);
+
+    if (ntimestep < 0) {
+      if (filereader) readers[0]->close_file();
+    } else prefetch_current = ntimestep;
+    return ntimestep;
+  }
+
   // proc 0 finds the timestep in its first reader
 
   if (comm->me == 0 || parallel) {
@@ -432,6 +520,7 @@ bigint ReadDump::next(bigint ncurrent, bigint nlast, int nevery, int nskip)
     }
   }
 
+  prefetch_current = ntimestep;
   return ntimestep;
 }
 
@@ -446,10 +535,21 @@ void ReadDump::header(int fieldinfo)
   int fieldflag,xflag,yflag,zflag;
 
   if (filereader) {
-    for (int i = 0; i < nreader; i++)
-      nsnapatoms[i]
-        = readers[i]->read_header(box, boxinfo, triclinic_snap, fieldinfo, nfield, fieldtype,
-                                  fieldlabel, scaleflag, wrapflag, fieldflag, xflag, yflag, zflag);
+    if (stagevalid && !fieldinfo) {
+
+      // header of the staged snapshot was already decoded by the helper thread
+
+      nsnapatoms[0] = stage_nsnap;
+      boxinfo = stage_boxinfo;
+      triclinic_snap = stage_triclinic;
+      memcpy(&box[0][0],&stage_box[0][0],9*sizeof(double));
+
+    } else {
+      for (int i = 0; i < nreader; i++)
+        nsnapatoms[i]
+          = readers[i]->read_header(box, boxinfo, triclinic_snap, fieldinfo, nfield, fieldtype,
+                                    fieldlabel, scaleflag, wrapflag, fieldflag, xflag, yflag, zflag);
+    }
   }
 
   if (!parallel) {
@@ -702,7 +802,8 @@ void ReadDump::read_atoms()
       ntotal = 0;
       while (ntotal < nsnap) {
         nread = MIN(CHUNK,nsnap-ntotal);
-        readers[0]->read_atoms(nread,nfield,buf);
+        if (stagevalid) memcpy(&buf[0][0],&stagebuf[ntotal][0],nread*nfield*sizeof(double));
+        else readers[0]->read_atoms(nread,nfield,buf);
         rfirst = ntotal;
         rlast = ntotal + nread;
 
@@ -727,6 +828,11 @@ void ReadDump::read_atoms()
         ntotal += nread;
       }
 
+      // the snapshot is fully consumed: hand the file to a helper thread
+      // which decodes the next matching snapshot while this one is analyzed
+
+      if (prefetchflag) prefetch_start();
+
     } else {
       ofirst = (bigint) me_cluster * nsnap/nprocs_cluster;
       olast = (bigint) (me_cluster+1) * nsnap/nprocs_cluster;
@@ -784,6 +890,130 @@ void ReadDump::read_atoms()
   }
 }
 
+/* ----------------------------------------------------------------------
+   enable prefetching of snapshots on a helper thread, called by rerun
+   store the snapshot selection criteria rerun will pass to next()
+   only supported for the simple case of one dump file read by proc 0,
+   silently ignored otherwise
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_settings(bigint nlast, int nevery, int nskip)
+{
+  if (parallel || multiproc) return;
+
+  prefetchflag = 1;
+  prefetch_last = nlast;
+  prefetch_every = nevery;
+  prefetch_skip = nskip;
+}
+
+/* ----------------------------------------------------------------------
+   launch the helper thread which decodes the next snapshot
+   called by proc 0 when the current snapshot is fully consumed
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_start()
+{
+  stagevalid = 0;
+  stage_error.clear();
+  pthread = new std::thread(&ReadDump::prefetch_snapshot, this);
+}
+
+/* ----------------------------------------------------------------------
+   wait for the helper thread decoding the next snapshot, if any
+   then re-raise any error the thread could not report itself
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_wait()
+{
+  if (!pthread) return;
+  pthread->join();
+  delete pthread;
+  pthread = nullptr;
+  if (!stage_error.empty()) error->one(FLERR,"{}",stage_error);
+}
+
+/* ----------------------------------------------------------------------
+   scan for the next matching snapshot and decode its header and atoms
+   into staging storage, same criteria as the synchronous path in next()
+   runs on the helper thread, overlapped with analysis of current snapshot
+   no MPI calls are allowed here; errors are deferred to prefetch_wait()
+------------------------------------------------------------------------- */
+
+void ReadDump::prefetch_snapshot()
+{
+  try {
+    int ifile,eofflag = 0;
+    bigint ntimestep = -1;
+    int iskip = 0;
+
+    for (ifile = currentfile; ifile < nfile; ifile++) {
+      ntimestep = -1;
+      if (ifile != currentfile) readers[0]->open_file(files[ifile]);
+
+      while (true) {
+        eofflag = readers[0]->read_time(ntimestep);
+        if (eofflag) break;
+        if (ntimestep > prefetch_last) break;
+        if (ntimestep <= prefetch_current) {
+          readers[0]->skip();
+          continue;
+        }
+        if (iskip == prefetch_skip) iskip = 0;
+        iskip++;
+        if (prefetch_every && ntimestep % prefetch_every) readers[0]->skip();
+        else if (iskip < prefetch_skip) readers[0]->skip();
+        else break;
+      }
+
+      if (eofflag) readers[0]->close_file();
+      else break;
+    }
+
+    stage_currentfile = ifile;
+    if (eofflag) ntimestep = -1;
+    if (ntimestep <= prefetch_current) ntimestep = -1;
+    if (ntimestep > prefetch_last) ntimestep = -1;
+    stage_ntimestep = ntimestep;
+    if (ntimestep < 0) return;
+
+    // decode header of the staged snapshot
+    // no field checks, those were done on the first snapshot
+
+    int fieldflag,xflag,yflag,zflag;
+    stage_nsnap
+      = readers[0]->read_header(stage_box, stage_boxinfo, stage_triclinic, 0, nfield, fieldtype,
+                                fieldlabel, scaleflag, wrapflag, fieldflag, xflag, yflag, zflag);
+
+    if (stage_nsnap > MAXSMALLINT) {
+      stage_error = "Read dump snapshot is too large to prefetch";
+      return;
+    }
+
+    // decode all atom lines of the staged snapshot
+
+    int nsnap = static_cast<int> (stage_nsnap);
+    if (nsnap > maxstage || maxstage == 0) {
+      memory->destroy(stagebuf);
+      maxstage = MAX(nsnap,1);    // avoid null pointer
+      memory->create(stagebuf,maxstage,nfield,"read_dump:stagebuf");
+    }
+
+    int ntotal = 0;
+    while (ntotal < nsnap) {
+      int nread = MIN(CHUNK,nsnap-ntotal);
+      readers[0]->read_atoms(nread,nfield,&stagebuf[ntotal]);
+      ntotal += nread;
+    }
+
+    stagevalid = 1;
+
+  } catch (std::exception &e) {
+    stagevalid = 0;
+    stage_error = e.what();
+  }
+}
+
 /* ----------------------------------------------------------------------
    update info for each old atom I own based on snapshot info
    if in replace mode and atom ID matches current atom,
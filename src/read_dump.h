@@ -24,6 +24,9 @@ CommandStyle(read_dump,ReadDump);
 
 #include "command.h"
 
+#include <string>
+#include <thread>
+
 namespace LAMMPS_NS {
 
 class ReadDump : public Command {
@@ -39,6 +42,7 @@ class ReadDump : public Command {
   bigint next(bigint, bigint, int, int);
   void atoms();
   int fields_and_keywords(int, char **);
+  void prefetch_settings(bigint, int, int);
 
  private:
   char **files;       // list of input dump files to process
@@ -93,7 +97,27 @@ class ReadDump : public Command {
                              // nreader-length list of readers if proc reads
                              //   from multiple parallel dump files
 
+  int prefetchflag;            // 1 if helper thread decodes next snapshot (rerun)
+  bigint prefetch_current;     // timestep of most recently read snapshot
+  bigint prefetch_last;        // snapshot selection criteria, copied from rerun
+  int prefetch_every, prefetch_skip;
+
+  std::thread *pthread;        // thread decoding the next snapshot, null if idle
+  int stagevalid;              // 1 if a staged snapshot is ready to consume
+  bigint stage_ntimestep;      // timestep of staged snapshot, -1 if none found
+  int stage_currentfile;       // file index the staged snapshot was found in
+  bigint stage_nsnap;          // # of atoms in staged snapshot
+  int stage_boxinfo, stage_triclinic;
+  double stage_box[3][3];
+  double **stagebuf;           // staged atom fields, stage_nsnap x nfield
+  int maxstage;                // allocated rows of stagebuf
+  std::string stage_error;     // error message deferred by the helper thread
+
+  bigint index_find(const std::string &, bigint, int, bigint &);
   void read_atoms();
+  void prefetch_start();
+  void prefetch_wait();
+  void prefetch_snapshot();
   void process_atoms();
   void migrate_old_atoms();
   void migrate_new_atoms();
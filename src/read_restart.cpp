@@ -39,6 +39,10 @@
 
 #include "lmprestart.h"
 
+#if defined(LMP_MPIIO)
+#include "restart_mpiio.h"
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -88,8 +92,15 @@ void ReadRestart::command(int narg, char **arg)
 
   if (strchr(arg[0],'%')) multiproc = 1;
   else multiproc = 0;
-  if (utils::strmatch(arg[0],"\\.mpiio"))
-    error->all(FLERR,"MPI-IO files are no longer supported by LAMMPS");
+  if (utils::strmatch(arg[0],"\\.mpiio")) mpiioflag = 1;
+  else mpiioflag = 0;
+  if (multiproc && mpiioflag)
+    error->all(FLERR,"Cannot use both '%' and '.mpiio' in restart file name");
+
+#if !defined(LMP_MPIIO)
+  if (mpiioflag)
+    error->all(FLERR,"Reading from MPI-IO filename when MPIIO package is not installed");
+#endif
 
   // open single restart file or base file for multiproc case
 
@@ -173,6 +184,35 @@ void ReadRestart::command(int narg, char **arg)
   double *buf = nullptr;
   int m,flag;
 
+  // input of single MPI-IO file
+  // all procs collectively read their assigned chunks, which are the
+  //   consecutive per-proc chunks of one or more procs that wrote the file
+  // each proc keeps all atoms in its chunks; they are migrated to the
+  //   procs owning their sub-domain below, same as for multiproc files
+
+  if (mpiioflag) {
+#if defined(LMP_MPIIO)
+    if (me == 0) {
+      fclose(fp);
+      fp = nullptr;
+    }
+
+    buf = (double *) memory->smalloc(assigned_chunk_size*sizeof(double),"read_restart:buf");
+
+    auto mpiio = new RestartMPIIO(lmp);
+    mpiio->openForRead(file);
+    mpiio->read(assigned_chunk_offset,assigned_chunk_size,buf);
+    mpiio->close();
+    delete mpiio;
+
+    bigint mbig = 0;
+    while (mbig < assigned_chunk_size) mbig += avec->unpack_restart(&buf[mbig]);
+
+    memory->sfree(buf);
+    buf = nullptr;
+#endif
+  }
+
   // input of single native file
   // nprocs_file = # of chunks in file
   // proc 0 reads a chunk and bcasts it to other procs
@@ -180,7 +220,7 @@ void ReadRestart::command(int narg, char **arg)
   // if remapflag set, remap the atom to box before checking sub-domain
   // check for atom in sub-domain differs for orthogonal vs triclinic box
 
-  if (multiproc == 0) {
+  else if (multiproc == 0) {
 
     int triclinic = domain->triclinic;
     imageint *iptr;
@@ -379,7 +419,7 @@ void ReadRestart::command(int narg, char **arg)
   // for multiproc or MPI-IO files:
   // perform irregular comm to migrate atoms to correct procs
 
-  if (multiproc) {
+  if (multiproc || mpiioflag) {
 
     // if remapflag set, remap all atoms I read back to box before migrating
 
@@ -965,9 +1005,45 @@ void ReadRestart::file_layout()
         error->all(FLERR,"Restart file is not a multi-proc file");
       if (multiproc && multiproc_file == 0)
         error->all(FLERR,"Restart file is a multi-proc file");
+
+    } else if (flag == MPIIO) {
+      int mpiioflag_file = read_int();
+      if (mpiioflag == 0 && mpiioflag_file)
+        error->all(FLERR,"Restart file is a MPI-IO file");
+      if (mpiioflag && mpiioflag_file == 0)
+        error->all(FLERR,"Restart file is not a MPI-IO file");
+
+      // read per-proc chunk sizes recorded by the nprocs_file writers
+      // assign a consecutive block of chunks to each reading proc and
+      // compute its total size and offset (in doubles) within the section
+
+      int *all_written_send_sizes;
+      memory->create(all_written_send_sizes,nprocs_file,"read_restart:all_written_send_sizes");
+      if (me == 0)
+        utils::sfread(FLERR,all_written_send_sizes,sizeof(int),nprocs_file,fp,nullptr,error);
+      MPI_Bcast(all_written_send_sizes,nprocs_file,MPI_INT,0,world);
+
+      int ifirst = static_cast<int> ((bigint) me * nprocs_file/nprocs);
+      int inext = static_cast<int> ((bigint) (me+1) * nprocs_file/nprocs);
+
+      assigned_chunk_offset = 0;
+      assigned_chunk_size = 0;
+      for (int i = 0; i < ifirst; i++) assigned_chunk_offset += all_written_send_sizes[i];
+      for (int i = ifirst; i < inext; i++) assigned_chunk_size += all_written_send_sizes[i];
+      memory->destroy(all_written_send_sizes);
     }
     flag = read_int();
   }
+
+  // for MPI-IO files, convert my chunk assignment into a byte offset
+  // relative to the end-of-header position, where the chunk section starts
+
+  if (mpiioflag) {
+    bigint headeroffset = 0;
+    if (me == 0) headeroffset = platform::ftell(fp);
+    MPI_Bcast(&headeroffset,1,MPI_LMP_BIGINT,0,world);
+    assigned_chunk_offset = headeroffset + assigned_chunk_offset*sizeof(double);
+  }
 }
 
 // ----------------------------------------------------------------------
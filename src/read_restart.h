@@ -39,6 +39,10 @@ class ReadRestart : public Command {
   int nprocs_file;       // total # of procs that wrote restart file
   int revision;          // revision number of the restart file format
 
+  int mpiioflag;                   // 1 for collective input from a ".mpiio" file
+  bigint assigned_chunk_offset;    // byte offset of chunks I read collectively
+  bigint assigned_chunk_size;      // # of doubles in my assigned chunks
+
   std::string file_search(const std::string &);
   void header();
   void type_arrays();
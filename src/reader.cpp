@@ -76,6 +76,18 @@ void Reader::close_file()
   fp = nullptr;
 }
 
+/* ----------------------------------------------------------------------
+   position the file at a byte offset obtained from a dump frame index
+   return 0 if successful, -1 if not supported for this file type
+------------------------------------------------------------------------- */
+
+int Reader::seek_to(bigint offset)
+{
+  if ((fp == nullptr) || compressed) return -1;
+  if (platform::fseek(fp, offset) < 0) return -1;
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    detect unused arguments
 ------------------------------------------------------------------------- */
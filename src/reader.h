@@ -38,6 +38,7 @@ class Reader : protected Pointers {
 
   virtual void open_file(const std::string &);
   virtual void close_file();
+  virtual int seek_to(bigint);
 
  protected:
   FILE *fp;           // pointer to opened file or pipe
@@ -132,6 +132,20 @@ int Region::match(double x, double y, double z)
 {
   if (dynamic) inverse_transform(x, y, z);
   if (openflag) return 1;
+
+  // quick rejection test against bounding box of region interior
+  // a point outside the box cannot be inside the region, so the
+  //   expensive style-specific inside() test can be skipped
+  // for union/intersect regions this also prunes the recursive
+  //   sub-region tests, since those are made via sub-region match()
+  // skip for variable-shape regions: extents are set at creation time
+  //   and not refreshed by shape_update()
+
+  if (bboxflag && !varshape &&
+      (x < extent_xlo || x > extent_xhi || y < extent_ylo || y > extent_yhi || z < extent_zlo ||
+       z > extent_zhi))
+    return !interior;
+
   return !(inside(x, y, z) ^ interior);
 }
 
@@ -190,6 +204,27 @@ int Region::surface(double x, double y, double z, double cutoff)
   return ncontact;
 }
 
+/* ----------------------------------------------------------------------
+   lower bound on distance from x to the region surface, capped at cutoff
+   unlike surface(), picks surface_interior/exterior from the side of the
+     surface x is actually on, so it is valid for points on either side
+   only meaningful for static closed regions:
+     caller must exclude dynamic, varshape and open regions
+------------------------------------------------------------------------- */
+
+double Region::boundary_distance(double *x, double cutoff)
+{
+  int ncontact;
+  if (inside(x[0], x[1], x[2]))
+    ncontact = surface_interior(x, cutoff);
+  else
+    ncontact = surface_exterior(x, cutoff);
+
+  double dist = cutoff;
+  for (int i = 0; i < ncontact; i++) dist = MIN(dist, contact[i].r);
+  return dist;
+}
+
 /* ----------------------------------------------------------------------
    add a single contact at Nth location in contact array
    x = particle position
@@ -78,6 +78,7 @@ class Region : protected Pointers {
   void prematch();
   int match(double, double, double);
   int surface(double, double, double, double);
+  double boundary_distance(double *, double);
 
   virtual void set_velocity();
   void velocity_contact(double *, double *, int);
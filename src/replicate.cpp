@@ -575,67 +575,23 @@ void Replicate::replicate_by_proc(int nx, int ny, int nz,
    uses bounding box of each proc's subdomain to avoid checking individual atoms
    faster for large processor counts
    required for bond/periodic option
+   without bond/periodic, atom data is streamed one source proc at a time,
+     so extra memory stays bounded by the largest single-proc buffer
 ------------------------------------------------------------------------- */
 
 void Replicate::replicate_by_bbox(int nx, int ny, int nz,
                                   double *sublo, double *subhi, double *buf)
 {
-  int i,j,m,n;
   int ix,iy,iz;
 
   int me = comm->me;
   int nprocs = comm->nprocs;
   int triclinic = domain->triclinic;
-  int tag_enable = atom->tag_enable;
-
-  AtomVec *old_avec = old->avec;
-  AtomVec *avec = atom->avec;
-
-  tagint atom_offset,mol_offset,atom0tag;
-  imageint image;
-  double x[3],lamda[3];
-  double *coord;
-
-  // allgather size of buf on each proc
-
-  n = 0;
-  for (i = 0; i < old->nlocal; i++) n += old_avec->pack_restart(i,&buf[n]);
-
-  int * size_buf_rnk;
-  memory->create(size_buf_rnk, nprocs, "replicate:size_buf_rnk");
-
-  MPI_Allgather(&n, 1, MPI_INT, size_buf_rnk, 1, MPI_INT, world);
-
-  // size of buf_all
-
-  int size_buf_all = 0;
-  MPI_Allreduce(&n, &size_buf_all, 1, MPI_INT, MPI_SUM, world);
-
-  if (me == 0) {
-    auto mesg = fmt::format("  bounding box image = ({} {} {}) "
-                            "to ({} {} {})\n",
-                            _imagelo[0],_imagelo[1],_imagelo[2],
-                            _imagehi[0],_imagehi[1],_imagehi[2]);
-    mesg += fmt::format("  bounding box extra memory = {:.2f} MB\n",
-                        (double)size_buf_all*sizeof(double)/1024/1024);
-    utils::logmesg(lmp,mesg);
-  }
-
-  // rnk offsets
-
-  int *disp_buf_rnk;
-  memory->create(disp_buf_rnk, nprocs, "replicate:disp_buf_rnk");
-  disp_buf_rnk[0] = 0;
-  for (i = 1; i < nprocs; i++)
-    disp_buf_rnk[i] = disp_buf_rnk[i-1] + size_buf_rnk[i-1];
-
-  // allgather buf_all
-
-  double *buf_all;
-  memory->create(buf_all, size_buf_all, "replicate:buf_all");
 
-  MPI_Allgatherv(buf,n,MPI_DOUBLE,buf_all,size_buf_rnk,disp_buf_rnk,
-                 MPI_DOUBLE,world);
+  if (me == 0)
+    utils::logmesg(lmp,"  bounding box image = ({} {} {}) to ({} {} {})\n",
+                   _imagelo[0],_imagelo[1],_imagelo[2],
+                   _imagehi[0],_imagehi[1],_imagehi[2]);
 
   // bounding box of original unwrapped system
 
@@ -665,37 +621,18 @@ void Replicate::replicate_by_bbox(int nx, int ny, int nz,
 
   double _lo[3], _hi[3];
 
-  int num_replicas_added = 0;
+  // flag each replica whose shifted bounding box overlaps my new subdomain
+  // all later loops over atom data only visit flagged replicas
 
-  // if bond/periodic option
-  // store old_x and old_tag for the entire original system
+  int *overlap_rep;
+  memory->create(overlap_rep,nx*ny*nz,"replicate:overlap_rep");
 
-  if (bond_flag) {
-    memory->create(old_x,old->natoms,3,"replicate:old_x");
-    memory->create(old_tag,old->natoms,"replicate:old_tag");
-
-    i = m = 0;
-    while (m < size_buf_all) {
-      old_x[i][0] = buf_all[m+1];
-      old_x[i][1] = buf_all[m+2];
-      old_x[i][2] = buf_all[m+3];
-      old_tag[i] = (tagint) ubuf(buf_all[m+4]).i;
-      old_map.insert({old_tag[i],i});
-      m += static_cast<int> (buf_all[m]);
-      i++;
-    }
-  }
-
-  // replication loop
+  int num_replicas_added = 0;
 
   for (ix = 0; ix < nx; ix++) {
     for (iy = 0; iy < ny; iy++) {
       for (iz = 0; iz < nz; iz++) {
 
-        thisrep[0] = ix;
-        thisrep[1] = iy;
-        thisrep[2] = iz;
-
         // domain->remap() overwrites coordinates, so always recompute here
 
         if (triclinic) {
@@ -834,23 +771,292 @@ void Replicate::replicate_by_bbox(int nx, int ny, int nz,
           if (xoverlap && yoverlap && zoverlap) overlap = 1;
         }
 
+        overlap_rep[(ix*ny + iy)*nz + iz] = overlap;
+        if (overlap) num_replicas_added++;
+      }
+    }
+  }
+
+  if (bond_flag) replicate_bbox_gathered(nx,ny,nz,sublo,subhi,buf,overlap_rep);
+  else replicate_bbox_streamed(nx,ny,nz,sublo,subhi,buf,overlap_rep);
+
+  memory->destroy(overlap_rep);
+
+  int sum = 0;
+  MPI_Reduce(&num_replicas_added, &sum, 1, MPI_INT, MPI_SUM, 0, world);
+  double avg = (double) sum / nprocs;
+  if (me == 0)
+    utils::logmesg(lmp,"  average # of replicas added to proc = {:.2f} out "
+                   "of {} ({:.2f}%)\n",avg,nx*ny*nz,avg/(nx*ny*nz)*100.0);
+}
+
+/* ----------------------------------------------------------------------
+   bbox replication from a copy of the entire original system
+   allgathers all atom data, then unpacks from overlapping replicas only
+   required for bond/periodic option, which needs the coords and tags
+     of the entire original system to re-wire periodic bond loops
+------------------------------------------------------------------------- */
+
+void Replicate::replicate_bbox_gathered(int nx, int ny, int nz,
+                                        double *sublo, double *subhi, double *buf,
+                                        int *overlap_rep)
+{
+  int i,j,m,n;
+  int ix,iy,iz;
+
+  int me = comm->me;
+  int nprocs = comm->nprocs;
+  int triclinic = domain->triclinic;
+  int tag_enable = atom->tag_enable;
+
+  AtomVec *old_avec = old->avec;
+  AtomVec *avec = atom->avec;
+
+  tagint atom_offset,mol_offset,atom0tag;
+  imageint image;
+  double x[3],lamda[3];
+  double *coord;
+
+  // allgather size of buf on each proc
+
+  n = 0;
+  for (i = 0; i < old->nlocal; i++) n += old_avec->pack_restart(i,&buf[n]);
+
+  int * size_buf_rnk;
+  memory->create(size_buf_rnk, nprocs, "replicate:size_buf_rnk");
+
+  MPI_Allgather(&n, 1, MPI_INT, size_buf_rnk, 1, MPI_INT, world);
+
+  // size of buf_all
+
+  int size_buf_all = 0;
+  MPI_Allreduce(&n, &size_buf_all, 1, MPI_INT, MPI_SUM, world);
+
+  if (me == 0)
+    utils::logmesg(lmp,"  bounding box extra memory = {:.2f} MB\n",
+                   (double)size_buf_all*sizeof(double)/1024/1024);
+
+  // rnk offsets
+
+  int *disp_buf_rnk;
+  memory->create(disp_buf_rnk, nprocs, "replicate:disp_buf_rnk");
+  disp_buf_rnk[0] = 0;
+  for (i = 1; i < nprocs; i++)
+    disp_buf_rnk[i] = disp_buf_rnk[i-1] + size_buf_rnk[i-1];
+
+  // allgather buf_all
+
+  double *buf_all;
+  memory->create(buf_all, size_buf_all, "replicate:buf_all");
+
+  MPI_Allgatherv(buf,n,MPI_DOUBLE,buf_all,size_buf_rnk,disp_buf_rnk,
+                 MPI_DOUBLE,world);
+
+  // store old_x and old_tag for the entire original system
+
+  memory->create(old_x,old->natoms,3,"replicate:old_x");
+  memory->create(old_tag,old->natoms,"replicate:old_tag");
+
+  i = m = 0;
+  while (m < size_buf_all) {
+    old_x[i][0] = buf_all[m+1];
+    old_x[i][1] = buf_all[m+2];
+    old_x[i][2] = buf_all[m+3];
+    old_tag[i] = (tagint) ubuf(buf_all[m+4]).i;
+    old_map.insert({old_tag[i],i});
+    m += static_cast<int> (buf_all[m]);
+    i++;
+  }
+
+  // replication loop
+
+  for (ix = 0; ix < nx; ix++) {
+    for (iy = 0; iy < ny; iy++) {
+      for (iz = 0; iz < nz; iz++) {
+
+        if (!overlap_rep[(ix*ny + iy)*nz + iz]) continue;
+
+        thisrep[0] = ix;
+        thisrep[1] = iy;
+        thisrep[2] = iz;
+
         // while loop over one proc's atom list
 
-        if (overlap) {
-          num_replicas_added++;
+        m = 0;
+        while (m < size_buf_all) {
+          image = ((imageint) IMGMAX << IMG2BITS) |
+            ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+          if (triclinic == 0) {
+            x[0] = buf_all[m+1] + ix*old_xprd;
+            x[1] = buf_all[m+2] + iy*old_yprd;
+            x[2] = buf_all[m+3] + iz*old_zprd;
+          } else {
+            x[0] = buf_all[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
+            x[1] = buf_all[m+2] + iy*old_yprd + iz*old_yz;
+            x[2] = buf_all[m+3] + iz*old_zprd;
+          }
+          domain->remap(x,image);
+          if (triclinic) {
+            domain->x2lamda(x,lamda);
+            coord = lamda;
+          } else coord = x;
+
+          if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
+              coord[1] >= sublo[1] && coord[1] < subhi[1] &&
+              coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+
+            m += avec->unpack_restart(&buf_all[m]);
+
+            i = atom->nlocal - 1;
+            if (tag_enable)
+              atom_offset = iz*ny*nx*maxtag + iy*nx*maxtag + ix*maxtag;
+            else atom_offset = 0;
+            mol_offset = iz*ny*nx*maxmol + iy*nx*maxmol + ix*maxmol;
+
+            atom->x[i][0] = x[0];
+            atom->x[i][1] = x[1];
+            atom->x[i][2] = x[2];
+
+            atom0tag = atom->tag[i];
+            atom->tag[i] += atom_offset;
+            atom->image[i] = image;
+
+            if (atom->molecular != Atom::ATOMIC) {
+              if (atom->molecule[i] > 0)
+                atom->molecule[i] += mol_offset;
+              if (atom->molecular == Atom::MOLECULAR) {
+                if (atom->avec->bonds_allow)
+                  for (j = 0; j < atom->num_bond[i]; j++) {
+                    if (bond_flag)
+                      newtag(atom0tag,atom->bond_atom[i][j]);
+                    else atom->bond_atom[i][j] += atom_offset;
+                  }
+                if (atom->avec->angles_allow)
+                  for (j = 0; j < atom->num_angle[i]; j++) {
+                    if (bond_flag) {
+                      newtag(atom0tag,atom->angle_atom1[i][j]);
+                      newtag(atom0tag,atom->angle_atom2[i][j]);
+                      newtag(atom0tag,atom->angle_atom3[i][j]);
+                    } else {
+                      atom->angle_atom1[i][j] += atom_offset;
+                      atom->angle_atom2[i][j] += atom_offset;
+                      atom->angle_atom3[i][j] += atom_offset;
+                    }
+                  }
+                if (atom->avec->dihedrals_allow)
+                  for (j = 0; j < atom->num_dihedral[i]; j++) {
+                    if (bond_flag) {
+                      newtag(atom0tag,atom->dihedral_atom1[i][j]);
+                      newtag(atom0tag,atom->dihedral_atom2[i][j]);
+                      newtag(atom0tag,atom->dihedral_atom3[i][j]);
+                      newtag(atom0tag,atom->dihedral_atom4[i][j]);
+                    } else {
+                      atom->dihedral_atom1[i][j] += atom_offset;
+                      atom->dihedral_atom2[i][j] += atom_offset;
+                      atom->dihedral_atom3[i][j] += atom_offset;
+                      atom->dihedral_atom4[i][j] += atom_offset;
+                    }
+                  }
+                if (atom->avec->impropers_allow)
+                  for (j = 0; j < atom->num_improper[i]; j++) {
+                    if (bond_flag) {
+                      newtag(atom0tag,atom->improper_atom1[i][j]);
+                      newtag(atom0tag,atom->improper_atom2[i][j]);
+                      newtag(atom0tag,atom->improper_atom3[i][j]);
+                      newtag(atom0tag,atom->improper_atom4[i][j]);
+                    } else {
+                      atom->improper_atom1[i][j] += atom_offset;
+                      atom->improper_atom2[i][j] += atom_offset;
+                      atom->improper_atom3[i][j] += atom_offset;
+                      atom->improper_atom4[i][j] += atom_offset;
+                    }
+                  }
+              }
+            }
+          } else m += static_cast<int> (buf_all[m]);
+        }
+      }
+    }
+  }
+
+  memory->destroy(size_buf_rnk);
+  memory->destroy(disp_buf_rnk);
+  memory->destroy(buf_all);
+  memory->destroy(old_x);
+  memory->destroy(old_tag);
+}
+
+/* ----------------------------------------------------------------------
+   bbox replication streamed one source proc at a time
+   each proc bcasts its atom data in turn, as in replicate_by_proc,
+     but atoms are only unpacked from replicas overlapping my subdomain
+   extra memory stays bounded by the largest single-proc buffer,
+     independent of total system size
+------------------------------------------------------------------------- */
+
+void Replicate::replicate_bbox_streamed(int nx, int ny, int nz,
+                                        double *sublo, double *subhi, double *buf,
+                                        int *overlap_rep)
+{
+  int i,j,m,n;
+  int ix,iy,iz;
+
+  int me = comm->me;
+  int nprocs = comm->nprocs;
+  int triclinic = domain->triclinic;
+  int tag_enable = atom->tag_enable;
+
+  AtomVec *old_avec = old->avec;
+  AtomVec *avec = atom->avec;
+
+  tagint atom_offset,mol_offset;
+  imageint image;
+  double x[3],lamda[3];
+  double *coord;
+
+  n = 0;
+  for (i = 0; i < old->nlocal; i++) n += old_avec->pack_restart(i,&buf[n]);
+
+  int max_size;
+  MPI_Allreduce(&n,&max_size,1,MPI_INT,MPI_MAX,world);
+
+  if (me == 0)
+    utils::logmesg(lmp,"  bounding box extra memory = {:.2f} MB\n",
+                   (double)max_size*sizeof(double)/1024/1024);
+
+  // loop over all procs
+  // if this iteration of loop is me:
+  //   pack my unmapped atom data into buf
+  //   bcast it to all other procs
+
+  for (int iproc = 0; iproc < nprocs; iproc++) {
+    if (me == iproc) {
+      n = 0;
+      for (i = 0; i < old->nlocal; i++) n += old_avec->pack_restart(i,&buf[n]);
+    }
+    MPI_Bcast(&n,1,MPI_INT,iproc,world);
+    MPI_Bcast(buf,n,MPI_DOUBLE,iproc,world);
+
+    for (ix = 0; ix < nx; ix++) {
+      for (iy = 0; iy < ny; iy++) {
+        for (iz = 0; iz < nz; iz++) {
+
+          if (!overlap_rep[(ix*ny + iy)*nz + iz]) continue;
+
+          // while loop over one proc's atom list
 
           m = 0;
-          while (m < size_buf_all) {
+          while (m < n) {
             image = ((imageint) IMGMAX << IMG2BITS) |
               ((imageint) IMGMAX << IMGBITS) | IMGMAX;
             if (triclinic == 0) {
-              x[0] = buf_all[m+1] + ix*old_xprd;
-              x[1] = buf_all[m+2] + iy*old_yprd;
-              x[2] = buf_all[m+3] + iz*old_zprd;
+              x[0] = buf[m+1] + ix*old_xprd;
+              x[1] = buf[m+2] + iy*old_yprd;
+              x[2] = buf[m+3] + iz*old_zprd;
             } else {
-              x[0] = buf_all[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
-              x[1] = buf_all[m+2] + iy*old_yprd + iz*old_yz;
-              x[2] = buf_all[m+3] + iz*old_zprd;
+              x[0] = buf[m+1] + ix*old_xprd + iy*old_xy + iz*old_xz;
+              x[1] = buf[m+2] + iy*old_yprd + iz*old_yz;
+              x[2] = buf[m+3] + iz*old_zprd;
             }
             domain->remap(x,image);
             if (triclinic) {
@@ -862,7 +1068,7 @@ void Replicate::replicate_by_bbox(int nx, int ny, int nz,
                 coord[1] >= sublo[1] && coord[1] < subhi[1] &&
                 coord[2] >= sublo[2] && coord[2] < subhi[2]) {
 
-              m += avec->unpack_restart(&buf_all[m]);
+              m += avec->unpack_restart(&buf[m]);
 
               i = atom->nlocal - 1;
               if (tag_enable)
@@ -874,7 +1080,6 @@ void Replicate::replicate_by_bbox(int nx, int ny, int nz,
               atom->x[i][1] = x[1];
               atom->x[i][2] = x[2];
 
-              atom0tag = atom->tag[i];
               atom->tag[i] += atom_offset;
               atom->image[i] = image;
 
@@ -883,74 +1088,36 @@ void Replicate::replicate_by_bbox(int nx, int ny, int nz,
                   atom->molecule[i] += mol_offset;
                 if (atom->molecular == Atom::MOLECULAR) {
                   if (atom->avec->bonds_allow)
-                    for (j = 0; j < atom->num_bond[i]; j++) {
-                      if (bond_flag)
-                        newtag(atom0tag,atom->bond_atom[i][j]);
-                      else atom->bond_atom[i][j] += atom_offset;
-                    }
+                    for (j = 0; j < atom->num_bond[i]; j++)
+                      atom->bond_atom[i][j] += atom_offset;
                   if (atom->avec->angles_allow)
                     for (j = 0; j < atom->num_angle[i]; j++) {
-                      if (bond_flag) {
-                        newtag(atom0tag,atom->angle_atom1[i][j]);
-                        newtag(atom0tag,atom->angle_atom2[i][j]);
-                        newtag(atom0tag,atom->angle_atom3[i][j]);
-                      } else {
-                        atom->angle_atom1[i][j] += atom_offset;
-                        atom->angle_atom2[i][j] += atom_offset;
-                        atom->angle_atom3[i][j] += atom_offset;
-                      }
+                      atom->angle_atom1[i][j] += atom_offset;
+                      atom->angle_atom2[i][j] += atom_offset;
+                      atom->angle_atom3[i][j] += atom_offset;
                     }
                   if (atom->avec->dihedrals_allow)
                     for (j = 0; j < atom->num_dihedral[i]; j++) {
-                      if (bond_flag) {
-                        newtag(atom0tag,atom->dihedral_atom1[i][j]);
-                        newtag(atom0tag,atom->dihedral_atom2[i][j]);
-                        newtag(atom0tag,atom->dihedral_atom3[i][j]);
-                        newtag(atom0tag,atom->dihedral_atom4[i][j]);
-                      } else {
-                        atom->dihedral_atom1[i][j] += atom_offset;
-                        atom->dihedral_atom2[i][j] += atom_offset;
-                        atom->dihedral_atom3[i][j] += atom_offset;
-                        atom->dihedral_atom4[i][j] += atom_offset;
-                      }
+                      atom->dihedral_atom1[i][j] += atom_offset;
+                      atom->dihedral_atom2[i][j] += atom_offset;
+                      atom->dihedral_atom3[i][j] += atom_offset;
+                      atom->dihedral_atom4[i][j] += atom_offset;
                     }
                   if (atom->avec->impropers_allow)
                     for (j = 0; j < atom->num_improper[i]; j++) {
-                      if (bond_flag) {
-                        newtag(atom0tag,atom->improper_atom1[i][j]);
-                        newtag(atom0tag,atom->improper_atom2[i][j]);
-                        newtag(atom0tag,atom->improper_atom3[i][j]);
-                        newtag(atom0tag,atom->improper_atom4[i][j]);
-                      } else {
-                        atom->improper_atom1[i][j] += atom_offset;
-                        atom->improper_atom2[i][j] += atom_offset;
-                        atom->improper_atom3[i][j] += atom_offset;
-                        atom->improper_atom4[i][j] += atom_offset;
-                      }
+                      atom->improper_atom1[i][j] += atom_offset;
+                      atom->improper_atom2[i][j] += atom_offset;
+                      atom->improper_atom3[i][j] += atom_offset;
+                      atom->improper_atom4[i][j] += atom_offset;
                     }
                 }
               }
-            } else m += static_cast<int> (buf_all[m]);
+            } else m += static_cast<int> (buf[m]);
           }
         }
       }
     }
   }
-
-  memory->destroy(size_buf_rnk);
-  memory->destroy(disp_buf_rnk);
-  memory->destroy(buf_all);
-  if (bond_flag) {
-    memory->destroy(old_x);
-    memory->destroy(old_tag);
-  }
-
-  int sum = 0;
-  MPI_Reduce(&num_replicas_added, &sum, 1, MPI_INT, MPI_SUM, 0, world);
-  double avg = (double) sum / nprocs;
-  if (me == 0)
-    utils::logmesg(lmp,"  average # of replicas added to proc = {:.2f} out "
-                   "of {} ({:.2f}%)\n",avg,nx*ny*nz,avg/(nx*ny*nz)*100.0);
 }
 
 /* ----------------------------------------------------------------------
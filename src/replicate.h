@@ -51,6 +51,8 @@ class Replicate : public Command {
 
   void replicate_by_proc(int, int, int, double *, double *, double *);
   void replicate_by_bbox(int, int, int, double *, double *, double *);
+  void replicate_bbox_gathered(int, int, int, double *, double *, double *, int *);
+  void replicate_bbox_streamed(int, int, int, double *, double *, double *, int *);
 
   void newtag(tagint, tagint &);
 };
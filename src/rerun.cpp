@@ -57,6 +57,7 @@ void Rerun::command(int narg, char **arg)
     if (strcmp(arg[iarg],"stop") == 0) break;
     if (strcmp(arg[iarg],"dump") == 0) break;
     if (strcmp(arg[iarg],"post") == 0) break;
+    if (strcmp(arg[iarg],"prefetch") == 0) break;
     iarg++;
   }
   int nfile = iarg;
@@ -72,6 +73,7 @@ void Rerun::command(int narg, char **arg)
   int startflag = 0;
   int stopflag = 0;
   int postflag = 0;
+  int prefetchflag = 0;
   bigint start = -1;
   bigint stop = -1;
 
@@ -112,6 +114,10 @@ void Rerun::command(int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal rerun command");
       postflag = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"prefetch") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal rerun command");
+      prefetchflag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      iarg += 2;
     } else if (strcmp(arg[iarg],"dump") == 0) {
       break;
     } else error->all(FLERR,"Illegal rerun command");
@@ -135,6 +141,11 @@ void Rerun::command(int narg, char **arg)
   if (nremain) rd->setup_reader(nremain,&arg[narg-nremain]);
   else rd->setup_reader(0,nullptr);
 
+  // if requested, a helper thread decodes the next snapshot while the
+  // current one is analyzed, so ReadDump needs the selection criteria
+
+  if (prefetchflag) rd->prefetch_settings(last,nevery,nskip);
+
   // perform the pseudo run
   // invoke lmp->init() only once
   // read all relevant snapshots
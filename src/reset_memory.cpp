@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "reset_memory.h"
+
+#include "comm.h"
+#include "dump.h"
+#include "error.h"
+#include "output.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+ResetMemory::ResetMemory(LAMMPS *lmp) : Command(lmp) {}
+
+/* ----------------------------------------------------------------------
+   called as reset_memory command in input script
+   free high-water buffers that are regrown on demand,
+     so long runs do not keep worst-case allocations forever
+   all trimmed buffers are owned by classes which resize them
+     before each use, so this is safe between run commands
+     and between bursts of a "run every" command
+------------------------------------------------------------------------- */
+
+void ResetMemory::command(int narg, char **arg)
+{
+  if (narg > 0) error->all(FLERR, "Unknown reset_memory keyword: {}", arg[0]);
+
+  // trim per-dump output, sort, and staging buffers
+  // these are sized to the largest snapshot written so far
+
+  double bytes = 0.0;
+  for (int i = 0; i < output->ndump; i++) bytes += output->dump[i]->trim_memory();
+
+  // report min/avg/max reclaimed bytes across procs
+
+  double mbytes = bytes / 1024.0 / 1024.0;
+  double mbmin, mbavg, mbmax;
+  MPI_Allreduce(&mbytes, &mbavg, 1, MPI_DOUBLE, MPI_SUM, world);
+  mbavg /= comm->nprocs;
+  MPI_Allreduce(&mbytes, &mbmin, 1, MPI_DOUBLE, MPI_MIN, world);
+  MPI_Allreduce(&mbytes, &mbmax, 1, MPI_DOUBLE, MPI_MAX, world);
+
+  if (comm->me == 0)
+    utils::logmesg(lmp, "Reset_memory reclaimed {:.4g} Mbytes per proc (min {:.4g}, max {:.4g})\n",
+                   mbavg, mbmin, mbmax);
+}
@@ -75,6 +75,12 @@ Respa::Respa(LAMMPS *lmp, int narg, char **arg) :
   tally_global = 1;
   pair_compute = 1;
 
+  // per-level force stiffness monitoring is off by default
+
+  monitor_every = 0;
+  monitor_fsq = monitor_dfsq = nullptr;
+  monitor_count = nullptr;
+
   int iarg = nlevels;
   while (iarg < narg) {
     if (strcmp(arg[iarg], "bond") == 0) {
@@ -132,6 +138,11 @@ Respa::Respa(LAMMPS *lmp, int narg, char **arg) :
         hybrid_level[i] = utils::inumeric(FLERR, arg[iarg], false, lmp) - 1;
       }
       ++iarg;
+    } else if (strcmp(arg[iarg], "monitor") == 0) {
+      if (iarg + 2 > narg) error->all(FLERR, "Illegal run_style respa command");
+      monitor_every = utils::inumeric(FLERR, arg[iarg + 1], false, lmp);
+      if (monitor_every < 0) error->all(FLERR, "Illegal run_style respa command");
+      iarg += 2;
     } else
       error->all(FLERR, "Illegal run_style respa command");
   }
@@ -262,6 +273,16 @@ Respa::Respa(LAMMPS *lmp, int narg, char **arg) :
 
   newton = new int[nlevels];
   step = new double[nlevels];
+
+  if (monitor_every) {
+    monitor_fsq = new double[nlevels];
+    monitor_dfsq = new double[nlevels];
+    monitor_count = new bigint[nlevels];
+    for (int i = 0; i < nlevels; i++) {
+      monitor_fsq[i] = monitor_dfsq[i] = 0.0;
+      monitor_count[i] = 0;
+    }
+  }
 }
 
 /* ---------------------------------------------------------------------- */
@@ -271,6 +292,9 @@ Respa::~Respa()
   delete[] loop;
   delete[] newton;
   delete[] step;
+  delete[] monitor_fsq;
+  delete[] monitor_dfsq;
+  delete[] monitor_count;
   if (nhybrid_styles > 0) {
     delete[] hybrid_level;
     delete[] hybrid_compute;
@@ -529,6 +553,12 @@ void Respa::run(int n)
     ntimestep = ++update->ntimestep;
     ev_set(ntimestep);
 
+    // sample per-level force stiffness on monitored steps
+    // a sample is discarded if reneighboring reorders atoms mid-step
+
+    monitor_active = monitor_every && (ntimestep % monitor_every == 0);
+    monitor_skip = 0;
+
     recurse(nlevels - 1);
 
     // needed in case end_of_step() or output() use total force
@@ -555,6 +585,7 @@ void Respa::run(int n)
 
 void Respa::cleanup()
 {
+  if (monitor_every) monitor_report();
   modify->post_run();
   modify->delete_fix("RESPA");
   domain->box_too_small_check();
@@ -618,6 +649,7 @@ void Respa::recurse(int ilevel)
           modify->post_neighbor();
           timer->stamp(Timer::MODIFY);
         }
+        monitor_skip = 1;
 
       } else if (ilevel == 0) {
         timer->stamp();
@@ -705,6 +737,12 @@ void Respa::recurse(int ilevel)
     }
     timer->stamp();
     if (modify->n_post_force_respa_any) modify->post_force_respa(vflag, ilevel, iloop);
+
+    // on the first iteration of a monitored step, f_level still holds the
+    //   force of the previous evaluation of this level, one level interval ago
+
+    if (monitor_active && !monitor_skip && iloop == 0) monitor_level(ilevel);
+
     modify->final_integrate_respa(ilevel, iloop);
     timer->stamp(Timer::MODIFY);
   }
@@ -826,3 +864,127 @@ void Respa::set_compute_flags(int ilevel)
   }
   tally_global = (ilevel == nlevels - 1) ? 1 : 0;
 }
+
+/* ----------------------------------------------------------------------
+   accumulate force stiffness stats for one level
+   atom->f holds the just-computed level force, f_level the force of the
+     previous evaluation of this level, one level interval earlier
+   the relative force change per interval measures how well the level
+     timestep resolves the fastest motion the level force acts on
+------------------------------------------------------------------------- */
+
+void Respa::monitor_level(int ilevel)
+{
+  double ***f_level = fix_respa->f_level;
+  double **f = atom->f;
+  int n = atom->nlocal;
+
+  double fsq = 0.0;
+  double dfsq = 0.0;
+
+  for (int i = 0; i < n; i++) {
+    fsq += f[i][0] * f[i][0] + f[i][1] * f[i][1] + f[i][2] * f[i][2];
+    double dfx = f[i][0] - f_level[i][ilevel][0];
+    double dfy = f[i][1] - f_level[i][ilevel][1];
+    double dfz = f[i][2] - f_level[i][ilevel][2];
+    dfsq += dfx * dfx + dfy * dfy + dfz * dfz;
+  }
+
+  monitor_fsq[ilevel] += fsq;
+  monitor_dfsq[ilevel] += dfsq;
+  monitor_count[ilevel] += n;
+}
+
+/* ----------------------------------------------------------------------
+   report accumulated per-level force stiffness stats at end of run
+   for each level print the RMS level force, its relative change per
+     level interval, the largest interval that would keep the relative
+     change below MONITOR_TARGET, and the loop factors implied by the
+     measured intervals
+   warn if the relative change indicates an under-resolved level
+------------------------------------------------------------------------- */
+
+void Respa::monitor_report()
+{
+  const double MONITOR_TARGET = 0.1;    // target relative force change per interval
+  const double MONITOR_WARN = 0.5;      // warn above this relative change
+
+  double *fsq_all = new double[nlevels];
+  double *dfsq_all = new double[nlevels];
+  bigint *count_all = new bigint[nlevels];
+
+  MPI_Allreduce(monitor_fsq, fsq_all, nlevels, MPI_DOUBLE, MPI_SUM, world);
+  MPI_Allreduce(monitor_dfsq, dfsq_all, nlevels, MPI_DOUBLE, MPI_SUM, world);
+  MPI_Allreduce(monitor_count, count_all, nlevels, MPI_LMP_BIGINT, MPI_SUM, world);
+
+  // dtmax[i] = largest interval keeping the relative change at the target,
+  //   assuming the force change grows linearly with the interval
+
+  double *dtmax = new double[nlevels];
+  int warnflag = 0;
+
+  for (int i = 0; i < nlevels; i++) {
+    dtmax[i] = 0.0;
+    if (count_all[i] == 0 || dfsq_all[i] == 0.0 || fsq_all[i] == 0.0) continue;
+    double rel = sqrt(dfsq_all[i] / fsq_all[i]);
+    dtmax[i] = step[i] * MONITOR_TARGET / rel;
+    if (rel > MONITOR_WARN) warnflag = 1;
+  }
+
+  if (comm->me == 0) {
+    std::string mesg = "Respa level force monitoring:\n";
+    for (int i = 0; i < nlevels; i++) {
+      if (count_all[i] == 0 || fsq_all[i] == 0.0) {
+        mesg += fmt::format("  {}: no level forces sampled\n", i + 1);
+        continue;
+      }
+      double rmsf = sqrt(fsq_all[i] / (3.0 * count_all[i]));
+      double rel = sqrt(dfsq_all[i] / fsq_all[i]);
+      mesg += fmt::format("  {}: timestep {:.6g}, rms force {:.6g}, "
+                          "rel change/interval {:.4g}", i + 1, step[i], rmsf, rel);
+      if (dtmax[i] > 0.0) mesg += fmt::format(", est. max timestep {:.6g}", dtmax[i]);
+      mesg += "\n";
+    }
+
+    // suggested loop factors, walking from the outermost level inward
+    // the outermost timestep is capped by its own estimated maximum
+
+    int suggestflag = 0;
+    for (int i = 0; i < nlevels; i++)
+      if (dtmax[i] > 0.0) suggestflag = 1;
+
+    if (suggestflag) {
+      double dteff = step[nlevels - 1];
+      if (dtmax[nlevels - 1] > 0.0 && dtmax[nlevels - 1] < dteff) {
+        dteff = dtmax[nlevels - 1];
+        mesg += fmt::format("  outermost timestep exceeds estimate, "
+                            "consider reducing it to {:.6g}\n", dteff);
+      }
+      mesg += "  suggested loop factors:";
+      for (int i = nlevels - 2; i >= 0; i--) {
+        int nloop = loop[i];
+        if (dtmax[i] > 0.0) nloop = MAX(1, (int) ceil(dteff / dtmax[i]));
+        dteff /= nloop;
+        mesg += fmt::format(" {}:{}", i + 1, nloop);
+      }
+      mesg += "\n";
+    }
+    utils::logmesg(lmp, mesg);
+
+    if (warnflag)
+      error->warning(FLERR, "One or more respa levels resolve their forces poorly - "
+                     "increase their loop factors or lower the timestep");
+  }
+
+  // reset stats so a subsequent run reports its own sample
+
+  for (int i = 0; i < nlevels; i++) {
+    monitor_fsq[i] = monitor_dfsq[i] = 0.0;
+    monitor_count[i] = 0;
+  }
+
+  delete[] fsq_all;
+  delete[] dfsq_all;
+  delete[] count_all;
+  delete[] dtmax;
+}
@@ -65,9 +65,18 @@ class Respa : public Integrate {
   int *newton;                  // newton flag at each level
   class FixRespa *fix_respa;    // Fix to store the force level array
 
+  int monitor_every;      // sample force stiffness every this many steps, 0 = off
+  int monitor_active;     // 1 if stats are sampled on current timestep
+  int monitor_skip;       // 1 if reneighboring invalidated current sample
+  double *monitor_fsq;    // accumulated squared level force, per level
+  double *monitor_dfsq;   // accumulated squared level force change, per level
+  bigint *monitor_count;  // # of accumulated atom samples, per level
+
   virtual void recurse(int);
   void sum_flevel_f();
   void set_compute_flags(int ilevel);
+  void monitor_level(int ilevel);
+  void monitor_report();
 };
 
 }    // namespace LAMMPS_NS
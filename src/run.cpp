@@ -77,7 +77,8 @@ void Run::command(int narg, char **arg)
       iarg += 2;
     } else if (strcmp(arg[iarg],"pre") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "run pre", error);
-      preflag = utils::logical(FLERR,arg[iarg+1],false,lmp);
+      if (strcmp(arg[iarg+1],"auto") == 0) preflag = 2;
+      else preflag = utils::logical(FLERR,arg[iarg+1],false,lmp);
       iarg += 2;
     } else if (strcmp(arg[iarg],"post") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "run post", error);
@@ -129,9 +130,15 @@ void Run::command(int narg, char **arg)
       error->all(FLERR,"Run command stop value is before end of run");
   }
 
-  if (!preflag && utils::strmatch(update->integrate_style,"^respa"))
+  if (preflag != 1 && utils::strmatch(update->integrate_style,"^respa"))
     error->all(FLERR,"Run flag 'pre no' not compatible with r-RESPA");
 
+  // pre auto: skip the setup only if no command since the last run may
+  //   have perturbed system state, tracked by Input::execute_command()
+
+  int do_pre = preflag;
+  if (preflag == 2) do_pre = update->post_run_valid ? 0 : 1;
+
   // if nevery, make copies of arg strings that are commands
   // required because re-parsing commands via input->one() will wipe out args
 
@@ -166,7 +173,7 @@ void Run::command(int narg, char **arg)
     if (stopflag) update->endstep = stop;
     else update->endstep = update->laststep;
 
-    if (preflag || update->first_update == 0) {
+    if (do_pre || update->first_update == 0) {
       lmp->init();
       update->integrate->setup(1);
     } else output->setup(0);
@@ -178,6 +185,8 @@ void Run::command(int narg, char **arg)
 
     update->integrate->cleanup();
 
+    update->post_run_valid = 1;
+
     Finish finish(lmp);
     finish.end(postflag);
 
@@ -207,7 +216,10 @@ void Run::command(int narg, char **arg)
       if (stopflag) update->endstep = stop;
       else update->endstep = update->laststep;
 
-      if (preflag || iter == 0) {
+      int do_pre_iter = preflag;
+      if (preflag == 2) do_pre_iter = update->post_run_valid ? 0 : 1;
+
+      if (do_pre_iter || iter == 0) {
         lmp->init();
         update->integrate->setup(1);
       } else output->setup(0);
@@ -219,6 +231,8 @@ void Run::command(int narg, char **arg)
 
       update->integrate->cleanup();
 
+      update->post_run_valid = 1;
+
       Finish finish(lmp);
       if (postflag || nleft <= nsteps) finish.end(1);
       else finish.end(0);
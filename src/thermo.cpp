@@ -17,6 +17,7 @@
 
 #include "thermo.h"
 
+#include "alloc_count.h"
 #include "angle.h"
 #include "arg_info.h"
 #include "atom.h"
@@ -57,6 +58,7 @@ using namespace MathExtra;
 // CUSTOMIZATION: add a new keyword by adding it to this list:
 
 // step, elapsed, elaplong, dt, time, cpu, tpcpu, spcpu, cpuremain, part, timeremain
+// instr, cachemiss, imbalance
 // atoms, temp, press, pe, ke, etotal
 // evdwl, ecoul, epair, ebond, eangle, edihed, eimp, emol, elong, etail
 // enthalpy, ecouple, econserve
@@ -90,11 +92,25 @@ static constexpr char YAML[] = "step temp ke pe ebond eangle edihed eimp evdwl e
 #define FORMAT_MULTI_HEADER "------------ Step {:14} ----- CPU = {:12.7g} (sec) -------------"
 
 enum { SCALAR, VECTOR, ARRAY };
+enum { REDUCE_SINGLE, REDUCE_COLLECT, REDUCE_FETCH };    // modes of reduce_sum()
 
 static constexpr char id_temp[] = "thermo_temp";
 static constexpr char id_press[] = "thermo_press";
 static constexpr char id_pe[] = "thermo_pe";
 
+// binary thermo log file format, same magic/endian/revision
+//   conventions as the binary dump files
+// after the file header, the file is a stream of int-tagged items:
+//   BIN_SCHEMA followed by nfield and per-field type + keyword,
+//   BIN_RECORD followed by nfield 8-byte values (double or bigint)
+// must match the reader in tools/thermobin2txt.cpp
+
+static constexpr char BIN_MAGIC_STRING[] = "THERMOBIN";
+static constexpr int BIN_ENDIAN = 0x0001;
+static constexpr int BIN_FORMAT_REVISION = 0x0001;
+static constexpr int BIN_RECORD = 0;
+static constexpr int BIN_SCHEMA = 1;
+
 static char fmtbuf[512];
 
 /* ---------------------------------------------------------------------- */
@@ -112,11 +128,16 @@ Thermo::Thermo(LAMMPS *_lmp, int narg, char **arg) :
   normuserflag = 0;
   lostflag = lostbond = Thermo::ERROR;
   lostbefore = warnbefore = 0;
+  alloc_warm = 0;
   flushflag = 0;
   triclinic_general = 0;
+  binfp = nullptr;
+  bin_nfield = 0;
   firststep = 0;
   ntimestep = -1;
   nline = -1;
+  reduce_flag = REDUCE_SINGLE;
+  nreduce = ireduce = 0;
   image_fname.clear();
 
   // set style and corresponding lineflag
@@ -175,6 +196,7 @@ Thermo::Thermo(LAMMPS *_lmp, int narg, char **arg) :
 
 Thermo::~Thermo()
 {
+  if (binfp) fclose(binfp);
   delete[] style;
   deallocate();
 }
@@ -199,6 +221,16 @@ void Thermo::init()
   if (domain->box_change && strcmp(style, "custom") != 0)
     addfield("Volume", &Thermo::compute_vol, FLOAT);
 
+  // flag fields whose keyword routine reduces a single local energy sum
+  //   via reduce_sum(), so compute() can batch them into one allreduce
+
+  for (int i = 0; i < nfield; i++)
+    reduce_field[i] =
+      (vfunc[i] == &Thermo::compute_evdwl) || (vfunc[i] == &Thermo::compute_ecoul) ||
+      (vfunc[i] == &Thermo::compute_epair) || (vfunc[i] == &Thermo::compute_ebond) ||
+      (vfunc[i] == &Thermo::compute_eangle) || (vfunc[i] == &Thermo::compute_edihed) ||
+      (vfunc[i] == &Thermo::compute_eimp) || (vfunc[i] == &Thermo::compute_emol);
+
   // set format string for each field
   // include keyword if lineflag = MULTILINE
   // add '/n' every 3 values if lineflag = MULTILINE
@@ -377,6 +409,10 @@ void Thermo::compute(int flag)
 {
   int i;
 
+#if defined(LMP_DEBUG_ALLOC)
+  const uint64_t nalloc_start = AllocCount::count();
+#endif
+
   firststep = flag;
   ntimestep = update->ntimestep;
 
@@ -411,6 +447,9 @@ void Thermo::compute(int flag)
 
   // if lineflag = MULTILINE, prepend step/cpu header line
 
+  // append in place: line keeps its capacity from step to step,
+  // so steady-state thermo output does not touch the heap
+
   line.clear();
   if (lineflag == MULTILINE) {
     double cpu;
@@ -418,9 +457,22 @@ void Thermo::compute(int flag)
       cpu = timer->elapsed(Timer::TOTAL);
     else
       cpu = 0.0;
-    line += fmt::format(FORMAT_MULTI_HEADER, ntimestep, cpu);
+    fmt::format_to(std::back_inserter(line), FORMAT_MULTI_HEADER, ntimestep, cpu);
   }
 
+  // batch the allreduces of simple energy keywords into one reduction
+  // collection pass invokes only those fields so reduce_sum() records
+  //   their local sums, a single allreduce then sums them all, and the
+  //   output loop below fetches the results in the same order
+
+  nreduce = 0;
+  reduce_flag = REDUCE_COLLECT;
+  for (ifield = 0; ifield < nfield; ifield++)
+    if (reduce_field[ifield]) (this->*vfunc[ifield])();
+  if (nreduce) MPI_Allreduce(reduce_local, reduce_global, nreduce, MPI_DOUBLE, MPI_SUM, world);
+  ireduce = 0;
+  reduce_flag = REDUCE_FETCH;
+
   // add each thermo value to line with its specific format
   field_data.clear();
   field_data.resize(nfield);
@@ -442,6 +494,12 @@ void Thermo::compute(int flag)
     }
   }
 
+  reduce_flag = REDUCE_SINGLE;
+
+  // append fixed-width record to binary log file, only opened on proc 0
+
+  if (binfp) write_binary();
+
   // print line to screen and logfile
 
   if (comm->me == 0) {
@@ -453,6 +511,62 @@ void Thermo::compute(int flag)
   // e.g. via variables in print command
 
   firststep = 1;
+
+  // steady-state thermo output must stay off the heap
+  // the first invocation may allocate to warm up buffer capacities
+
+#if defined(LMP_DEBUG_ALLOC)
+  const uint64_t nalloc = AllocCount::count() - nalloc_start;
+  if (nalloc && alloc_warm)
+    error->warning(FLERR, "Thermo step performed {} heap allocation(s)", nalloc);
+  alloc_warm = 1;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   append one fixed-width record of the current field values to the
+     binary log file enabled via thermo_modify binary
+   a schema item is emitted first whenever the field layout changed,
+     e.g. when the Volume field is added for a box-changing run
+------------------------------------------------------------------------- */
+
+void Thermo::write_binary()
+{
+  if ((bin_nfield != nfield) || (binkeyword != keyword)) write_binary_schema();
+
+  int tag = BIN_RECORD;
+  fwrite(&tag, sizeof(int), 1, binfp);
+  for (int i = 0; i < nfield; i++) {
+    if (vtype[i] == FLOAT) {
+      fwrite(&field_data[i].data.d, sizeof(double), 1, binfp);
+    } else if (vtype[i] == INT) {
+      bigint b = field_data[i].data.i;
+      fwrite(&b, sizeof(bigint), 1, binfp);
+    } else if (vtype[i] == BIGINT) {
+      fwrite(&field_data[i].data.b, sizeof(bigint), 1, binfp);
+    }
+  }
+  if (flushflag) fflush(binfp);
+}
+
+/* ----------------------------------------------------------------------
+   emit schema item describing the current field layout: # of fields,
+     and per-field value type and keyword string
+------------------------------------------------------------------------- */
+
+void Thermo::write_binary_schema()
+{
+  int tag = BIN_SCHEMA;
+  fwrite(&tag, sizeof(int), 1, binfp);
+  fwrite(&nfield, sizeof(int), 1, binfp);
+  for (int i = 0; i < nfield; i++) {
+    fwrite(&vtype[i], sizeof(int), 1, binfp);
+    int klen = keyword[i].size();
+    fwrite(&klen, sizeof(int), 1, binfp);
+    fwrite(keyword[i].c_str(), sizeof(char), klen, binfp);
+  }
+  bin_nfield = nfield;
+  binkeyword = keyword;
 }
 
 /* ----------------------------------------------------------------------
@@ -635,6 +749,33 @@ void Thermo::modify_params(int narg, char **arg)
       flushflag = utils::logical(FLERR, arg[iarg + 1], false, lmp);
       iarg += 2;
 
+    } else if (strcmp(arg[iarg], "binary") == 0) {
+      if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "thermo_modify binary", error);
+      if (comm->me == 0) {
+        if (binfp) fclose(binfp);
+        binfp = nullptr;
+        bin_nfield = 0;
+        binkeyword.clear();
+        if (strcmp(arg[iarg + 1], "none") != 0) {
+          binfp = fopen(arg[iarg + 1], "wb");
+          if (!binfp)
+            error->one(FLERR, "Cannot open thermo binary file {}: {}", arg[iarg + 1],
+                       utils::getsyserror());
+
+          // write file header, same conventions as binary dump files
+
+          bigint fmtlen = strlen(BIN_MAGIC_STRING);
+          bigint marker = -fmtlen;
+          fwrite(&marker, sizeof(bigint), 1, binfp);
+          fwrite(BIN_MAGIC_STRING, sizeof(char), fmtlen, binfp);
+          int endian = BIN_ENDIAN;
+          fwrite(&endian, sizeof(int), 1, binfp);
+          int revision = BIN_FORMAT_REVISION;
+          fwrite(&revision, sizeof(int), 1, binfp);
+        }
+      }
+      iarg += 2;
+
     } else if (strcmp(arg[iarg], "line") == 0) {
       if (iarg + 2 > narg) utils::missing_cmd_args(FLERR, "thermo_modify line", error);
       if (strcmp(arg[iarg + 1], "one") == 0)
@@ -761,6 +902,11 @@ void Thermo::allocate()
   vfunc = new FnPtr[n];
   vtype = new int[n];
 
+  reduce_field = new int[n];
+  reduce_local = new double[n];
+  reduce_global = new double[n];
+  for (int i = 0; i < n; i++) reduce_field[i] = 0;
+
   field2index = new int[n];
   argindex1 = new int[n];
   argindex2 = new int[n];
@@ -794,6 +940,10 @@ void Thermo::deallocate()
   delete[] vfunc;
   delete[] vtype;
 
+  delete[] reduce_field;
+  delete[] reduce_local;
+  delete[] reduce_global;
+
   delete[] field2index;
   delete[] argindex1;
   delete[] argindex2;
@@ -849,6 +999,12 @@ void Thermo::parse_fields(const std::string &str)
       addfield("Part", &Thermo::compute_part, INT);
     } else if (word == "timeremain") {
       addfield("TimeoutLeft", &Thermo::compute_timeremain, FLOAT);
+    } else if (word == "instr") {
+      addfield("Instr", &Thermo::compute_instr, FLOAT);
+    } else if (word == "cachemiss") {
+      addfield("CacheMiss", &Thermo::compute_cachemiss, FLOAT);
+    } else if (word == "imbalance") {
+      addfield("Imbal", &Thermo::compute_imbalance, FLOAT);
 
     } else if (word == "atoms") {
       addfield("Atoms", &Thermo::compute_atoms, BIGINT);
@@ -1278,6 +1434,12 @@ int Thermo::evaluate_keyword(const std::string &word, double *answer)
   else
     normflag = normvalue;
 
+  // keywords invoked via a variable must reduce immediately, even when
+  //   called re-entrantly during the batched output loop of compute()
+
+  int reduce_hold = reduce_flag;
+  reduce_flag = REDUCE_SINGLE;
+
   // invoke a lo-level thermo routine to compute the variable value
   // if keyword requires a compute, error if thermo doesn't use the compute
   // for keywords that use energy (evdwl, ebond, etc):
@@ -1337,6 +1499,17 @@ int Thermo::evaluate_keyword(const std::string &word, double *answer)
   } else if (word == "timeremain") {
     compute_timeremain();
 
+  } else if (word == "instr") {
+    compute_instr();
+
+  } else if (word == "cachemiss") {
+    compute_cachemiss();
+
+  } else if (word == "imbalance") {
+    if (update->whichflag == 0)
+      error->all(FLERR, "The variable thermo keyword imbalance cannot be used between runs");
+    compute_imbalance();
+
   } else if (word == "atoms") {
     compute_atoms();
     dvalue = bivalue;
@@ -1559,9 +1732,12 @@ int Thermo::evaluate_keyword(const std::string &word, double *answer)
     dvalue = bivalue;
   }
 
-  else
+  else {
+    reduce_flag = reduce_hold;
     return 1;
+  }
 
+  reduce_flag = reduce_hold;
   *answer = dvalue;
   return 0;
 }
@@ -1790,6 +1966,52 @@ void Thermo::compute_timeremain()
   dvalue = timer->get_timeout_remain();
 }
 
+/* ----------------------------------------------------------------------
+   hardware instructions retired on this rank since start of run
+   requires the timer counters setting, otherwise 0.0
+------------------------------------------------------------------------- */
+
+void Thermo::compute_instr()
+{
+  dvalue = timer->get_instr(Timer::ALL);
+}
+
+/* ----------------------------------------------------------------------
+   last-level cache misses on this rank since start of run
+   requires the timer counters setting, otherwise 0.0
+------------------------------------------------------------------------- */
+
+void Thermo::compute_cachemiss()
+{
+  dvalue = timer->get_cachemiss(Timer::ALL);
+}
+
+/* ----------------------------------------------------------------------
+   current load imbalance = max/ave of per-rank pair+neigh time
+   accumulated since the previous evaluation of this keyword
+------------------------------------------------------------------------- */
+
+void Thermo::compute_imbalance()
+{
+  double new_time = timer->get_wall(Timer::PAIR) + timer->get_wall(Timer::NEIGH);
+
+  if (firststep == 0) {
+    dvalue = 0.0;
+  } else {
+    double mine = new_time - last_imbtime;
+    double maxtime, avetime;
+    MPI_Allreduce(&mine, &maxtime, 1, MPI_DOUBLE, MPI_MAX, world);
+    MPI_Allreduce(&mine, &avetime, 1, MPI_DOUBLE, MPI_SUM, world);
+    avetime /= comm->nprocs;
+    if (avetime > 0.0)
+      dvalue = maxtime / avetime;
+    else
+      dvalue = 1.0;
+  }
+
+  last_imbtime = new_time;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void Thermo::compute_atoms()
@@ -1838,13 +2060,35 @@ void Thermo::compute_etotal()
   dvalue += dvalue_pe;
 }
 
+/* ----------------------------------------------------------------------
+   sum one local energy contribution across all procs
+   during the collection pass of Thermo::compute() just record the local
+     value, so all fields are summed by one fused allreduce, then return
+     the results in the same order during the output pass
+   outside of compute(), e.g. for a thermo keyword in a variable,
+     perform the allreduce immediately
+------------------------------------------------------------------------- */
+
+double Thermo::reduce_sum(double local)
+{
+  if (reduce_flag == REDUCE_COLLECT) {
+    reduce_local[nreduce++] = local;
+    return 0.0;
+  }
+  if (reduce_flag == REDUCE_FETCH) return reduce_global[ireduce++];
+
+  double global;
+  MPI_Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, world);
+  return global;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void Thermo::compute_evdwl()
 {
   double tmp = 0.0;
   if (force->pair) tmp += force->pair->eng_vdwl;
-  MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+  dvalue = reduce_sum(tmp);
 
   if (force->pair && force->pair->tail_flag) {
     double volume = domain->xprd * domain->yprd * domain->zprd;
@@ -1860,7 +2104,7 @@ void Thermo::compute_ecoul()
 {
   double tmp = 0.0;
   if (force->pair) tmp += force->pair->eng_coul;
-  MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+  dvalue = reduce_sum(tmp);
   if (normflag) dvalue /= natoms;
 }
 
@@ -1870,7 +2114,7 @@ void Thermo::compute_epair()
 {
   double tmp = 0.0;
   if (force->pair) tmp += force->pair->eng_vdwl + force->pair->eng_coul;
-  MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+  dvalue = reduce_sum(tmp);
 
   if (force->kspace) dvalue += force->kspace->energy;
   if (force->pair && force->pair->tail_flag) {
@@ -1886,8 +2130,7 @@ void Thermo::compute_epair()
 void Thermo::compute_ebond()
 {
   if (force->bond) {
-    double tmp = force->bond->energy;
-    MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+    dvalue = reduce_sum(force->bond->energy);
     if (normflag) dvalue /= natoms;
   } else
     dvalue = 0.0;
@@ -1898,8 +2141,7 @@ void Thermo::compute_ebond()
 void Thermo::compute_eangle()
 {
   if (force->angle) {
-    double tmp = force->angle->energy;
-    MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+    dvalue = reduce_sum(force->angle->energy);
     if (normflag) dvalue /= natoms;
   } else
     dvalue = 0.0;
@@ -1910,8 +2152,7 @@ void Thermo::compute_eangle()
 void Thermo::compute_edihed()
 {
   if (force->dihedral) {
-    double tmp = force->dihedral->energy;
-    MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+    dvalue = reduce_sum(force->dihedral->energy);
     if (normflag) dvalue /= natoms;
   } else
     dvalue = 0.0;
@@ -1922,8 +2163,7 @@ void Thermo::compute_edihed()
 void Thermo::compute_eimp()
 {
   if (force->improper) {
-    double tmp = force->improper->energy;
-    MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+    dvalue = reduce_sum(force->improper->energy);
     if (normflag) dvalue /= natoms;
   } else
     dvalue = 0.0;
@@ -1939,7 +2179,7 @@ void Thermo::compute_emol()
     if (force->angle) tmp += force->angle->energy;
     if (force->dihedral) tmp += force->dihedral->energy;
     if (force->improper) tmp += force->improper->energy;
-    MPI_Allreduce(&tmp, &dvalue, 1, MPI_DOUBLE, MPI_SUM, world);
+    dvalue = reduce_sum(tmp);
     if (normflag) dvalue /= natoms;
   } else
     dvalue = 0.0;
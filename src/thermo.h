@@ -69,12 +69,18 @@ class Thermo : protected Pointers {
   int normuserflag;    // 0 if user has not set, 1 if has
   int normuser;
 
+  FILE *binfp;                           // binary thermo log file, opened on proc 0 only
+  int bin_nfield;                        // # of fields in last binary schema written
+  std::vector<std::string> binkeyword;    // keywords in last binary schema written
+
   int firststep;
   int lostbefore, warnbefore;
+  int alloc_warm;    // 1 once buffer capacities have warmed up, for LMP_DEBUG_ALLOC
   int flushflag, lineflag;
 
   double last_tpcpu, last_spcpu;
   double last_time;
+  double last_imbtime;
   bigint last_step;
 
   bigint natoms;
@@ -124,6 +130,9 @@ class Thermo : protected Pointers {
   int add_fix(const char *);
   int add_variable(const char *);
 
+  void write_binary();
+  void write_binary_schema();
+
   void check_temp(const std::string &);
   void check_pe(const std::string &);
   void check_press_scalar(const std::string &);
@@ -133,6 +142,16 @@ class Thermo : protected Pointers {
   void addfield(const char *, FnPtr, int);
   FnPtr *vfunc;    // list of ptrs to functions
 
+  // batching of per-keyword energy allreduces, see reduce_sum()
+
+  int reduce_flag;          // current mode of reduce_sum()
+  int nreduce, ireduce;     // # of collected local sums, fetch position
+  int *reduce_field;        // 1 if a field reduces via reduce_sum(), 0 if not
+  double *reduce_local;     // collected local sums, one allreduce for all
+  double *reduce_global;    // reduced results fetched by the output loop
+
+  double reduce_sum(double);
+
   void compute_compute();    // functions that compute a single value
   void compute_fix();        // via calls to  Compute,Fix,Variable classes
   void compute_variable();
@@ -151,6 +170,9 @@ class Thermo : protected Pointers {
   void compute_cpuremain();
   void compute_part();
   void compute_timeremain();
+  void compute_instr();
+  void compute_cachemiss();
+  void compute_imbalance();
 
   void compute_atoms();
   void compute_temp();
@@ -20,6 +20,13 @@
 #include <cstring>
 #include <ctime>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -32,6 +39,8 @@ Timer::Timer(LAMMPS *_lmp) : Pointers(_lmp)
   _s_timeout = -1.0;
   _checkfreq = 10;
   _nextcheck = -1;
+  _counters = 0;
+  _instrfd = _missfd = -1;
   this->_stamp(RESET);
 }
 
@@ -42,7 +51,10 @@ void Timer::init()
   for (int i = 0; i < NUM_TIMER; i++) {
     cpu_array[i] = 0.0;
     wall_array[i] = 0.0;
+    instr_array[i] = 0.0;
+    miss_array[i] = 0.0;
   }
+  if (_counters) counters_read(previous_instr, previous_miss);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -50,9 +62,11 @@ void Timer::init()
 void Timer::_stamp(enum ttype which)
 {
   double current_cpu = 0.0, current_wall = 0.0;
+  double current_instr = 0.0, current_miss = 0.0;
 
   if (_level > NORMAL) current_cpu = platform::cputime();
   current_wall = platform::walltime();
+  if (_counters) counters_read(current_instr, current_miss);
 
   if ((which > TOTAL) && (which < NUM_TIMER)) {
     const double delta_cpu = current_cpu - previous_cpu;
@@ -62,10 +76,19 @@ void Timer::_stamp(enum ttype which)
     wall_array[which] += delta_wall;
     cpu_array[ALL] += delta_cpu;
     wall_array[ALL] += delta_wall;
+
+    if (_counters) {
+      instr_array[which] += current_instr - previous_instr;
+      miss_array[which] += current_miss - previous_miss;
+      instr_array[ALL] += current_instr - previous_instr;
+      miss_array[ALL] += current_miss - previous_miss;
+    }
   }
 
   previous_cpu = current_cpu;
   previous_wall = current_wall;
+  previous_instr = current_instr;
+  previous_miss = current_miss;
 
   if (which == RESET) {
     this->init();
@@ -82,7 +105,71 @@ void Timer::_stamp(enum ttype which)
     wall_array[SYNC] += current_wall - previous_wall;
     previous_cpu = current_cpu;
     previous_wall = current_wall;
+    if (_counters) counters_read(previous_instr, previous_miss);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   hardware counter collection via perf_event, Linux only
+   two per-thread counters: retired instructions, last-level cache misses
+   read as cumulative counts, attributed to sections like the time arrays
+------------------------------------------------------------------------- */
+
+void Timer::counters_open()
+{
+#if defined(__linux__)
+  if (_instrfd >= 0) return;
+
+  struct perf_event_attr pe;
+  memset(&pe, 0, sizeof(pe));
+  pe.type = PERF_TYPE_HARDWARE;
+  pe.size = sizeof(pe);
+  pe.disabled = 0;
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+
+  pe.config = PERF_COUNT_HW_INSTRUCTIONS;
+  _instrfd = (int) syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+  pe.config = PERF_COUNT_HW_CACHE_MISSES;
+  if (_instrfd >= 0) _missfd = (int) syscall(SYS_perf_event_open, &pe, 0, -1, -1, 0);
+
+  if (_instrfd < 0 || _missfd < 0) {
+    counters_close();
+    _counters = 0;
+    if (comm->me == 0)
+      error->warning(FLERR, "Cannot open hardware counters (perf_event access may be "
+                     "restricted); timer counters disabled");
   }
+#else
+  _counters = 0;
+  if (comm->me == 0)
+    error->warning(FLERR, "Timer hardware counters are only supported on Linux");
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Timer::counters_close()
+{
+#if defined(__linux__)
+  if (_instrfd >= 0) close(_instrfd);
+  if (_missfd >= 0) close(_missfd);
+#endif
+  _instrfd = _missfd = -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void Timer::counters_read(double &instr, double &miss)
+{
+  instr = miss = 0.0;
+#if defined(__linux__)
+  uint64_t count;
+  if (_instrfd >= 0 && read(_instrfd, &count, sizeof(count)) == sizeof(count))
+    instr = (double) count;
+  if (_missfd >= 0 && read(_missfd, &count, sizeof(count)) == sizeof(count))
+    miss = (double) count;
+#endif
 }
 
 /* ---------------------------------------------------------------------- */
@@ -234,6 +321,13 @@ void Timer::modify_params(int narg, char **arg)
         _timeout = utils::timespec2seconds(arg[iarg]);
       } else
         error->all(FLERR, "Illegal timer command");
+    } else if (strcmp(arg[iarg], "counters") == 0) {
+      _counters = 1;
+      counters_open();
+      if (_counters) counters_read(previous_instr, previous_miss);
+    } else if (strcmp(arg[iarg], "nocounters") == 0) {
+      _counters = 0;
+      counters_close();
     } else if (strcmp(arg[iarg], "every") == 0) {
       ++iarg;
       if (iarg < narg) {
@@ -256,7 +350,7 @@ void Timer::modify_params(int narg, char **arg)
       timeout = fmt::format("{:02d}:{:%M:%S}", tv.tm_yday * 24 + tv.tm_hour, tv);
     }
 
-    utils::logmesg(lmp, "New timer settings: style={}  mode={}  timeout={}\n", timer_style[_level],
-                   timer_mode[_sync], timeout);
+    utils::logmesg(lmp, "New timer settings: style={}  mode={}  timeout={}  counters={}\n",
+                   timer_style[_level], timer_mode[_sync], timeout, _counters ? "on" : "off");
   }
 }
@@ -74,6 +74,12 @@ class Timer : protected Pointers {
   double get_cpu(enum ttype which) const { return cpu_array[which]; };
   double get_wall(enum ttype which) const { return wall_array[which]; };
 
+  // hardware counter support (perf_event on Linux)
+
+  bool has_counters() const { return _counters != 0; }
+  double get_instr(enum ttype which) const { return instr_array[which]; };
+  double get_cachemiss(enum ttype which) const { return miss_array[which]; };
+
   void set_wall(enum ttype, double);
 
   // initialize timeout timer
@@ -107,8 +113,12 @@ class Timer : protected Pointers {
  private:
   double cpu_array[NUM_TIMER];
   double wall_array[NUM_TIMER];
+  double instr_array[NUM_TIMER];    // hardware instructions per section
+  double miss_array[NUM_TIMER];     // last-level cache misses per section
   double previous_cpu;
   double previous_wall;
+  double previous_instr;
+  double previous_miss;
   double timeout_start;
   double _timeout;      // max allowed wall time in seconds. infinity if negative
   double _s_timeout;    // copy of timeout for restoring after a forced timeout
@@ -116,10 +126,18 @@ class Timer : protected Pointers {
   int _sync;            // if nonzero, synchronize tasks before setting the timer
   int _checkfreq;       // frequency of timeout checking
   int _nextcheck;       // loop number of next timeout check
+  int _counters;        // 1 if hardware counter collection is enabled
+  int _instrfd;         // perf event fd for instructions, -1 if closed
+  int _missfd;          // perf event fd for cache misses, -1 if closed
 
   // update one specific timer array
   void _stamp(enum ttype);
 
+  // open/close/read hardware counters
+  void counters_open();
+  void counters_close();
+  void counters_read(double &, double &);
+
   // check for timeout
   bool _check_timeout();
 };
@@ -56,6 +56,7 @@ Update::Update(LAMMPS *lmp) :
   atime = 0.0;
   atimestep = 0;
   first_update = 0;
+  post_run_valid = 0;
 
   whichflag = 0;
   firststep = laststep = 0;
@@ -489,6 +490,8 @@ void Update::reset_timestep(bigint newstep, bool do_check)
 {
   if (newstep < 0) error->all(FLERR, "Timestep must be >= 0");
 
+  post_run_valid = 0;
+
   bigint oldstep = ntimestep;
   ntimestep = newstep;
 
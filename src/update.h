@@ -43,6 +43,9 @@ class Update : protected Pointers {
   bigint firststep, laststep;    // 1st & last step of this run
   bigint beginstep, endstep;     // 1st and last step of multiple runs
   int first_update;              // 0 before initial update, 1 after
+  int post_run_valid;            // 1 if no command since the last run may
+                                 // have perturbed system state, so the next
+                                 // run with "pre auto" can skip setup
   int max_eval;                  // max force evaluations for minimizer
   int restrict_output;           // 1 if output should not write dump/restart
   int setupflag;                 // set when setup() is computing forces
@@ -87,6 +87,10 @@ enum{SUM,XMIN,XMAX,AVE,TRAP,SLOPE,SORT,RSORT,NOVECTOR};
 
 static constexpr double BIG = 1.0e20;
 
+// block length for blocked evaluation of atom-style variable trees
+
+static constexpr int ATOMBLOCK = 1024;
+
 // INT64_MAX cannot be represented with a double. reduce to avoid overflow when casting back
 
 #if defined(LAMMPS_SMALLBIG) || defined(LAMMPS_BIGBIG)
@@ -1180,7 +1184,42 @@ void Variable::compute_atom(int ivar, int igroup, double *result, int stride, in
   int nlocal = atom->nlocal;
 
   if (style[ivar] == ATOM) {
-    if (sumflag == 0) {
+
+    // if every node of the collapsed tree supports it, evaluate the group
+    // atoms in blocks: the recursive tree walk per atom is replaced by one
+    // tight loop per tree node over each block of gathered atom indices
+
+    if (blockable_tree(tree)) {
+      int idx[ATOMBLOCK],midx[ATOMBLOCK];
+      double out[ATOMBLOCK];
+
+      int m = 0;
+      int nblock = 0;
+      for (int i = 0; i < nlocal; i++) {
+        if (mask[i] & groupbit) {
+          idx[nblock] = i;
+          midx[nblock] = m;
+          nblock++;
+          if (nblock == ATOMBLOCK) {
+            eval_tree_block(tree,idx,nblock,out);
+            if (sumflag == 0)
+              for (int k = 0; k < nblock; k++) result[midx[k]] = out[k];
+            else
+              for (int k = 0; k < nblock; k++) result[midx[k]] += out[k];
+            nblock = 0;
+          }
+        } else if (sumflag == 0) result[m] = 0.0;
+        m += stride;
+      }
+      if (nblock) {
+        eval_tree_block(tree,idx,nblock,out);
+        if (sumflag == 0)
+          for (int k = 0; k < nblock; k++) result[midx[k]] = out[k];
+        else
+          for (int k = 0; k < nblock; k++) result[midx[k]] += out[k];
+      }
+
+    } else if (sumflag == 0) {
       int m = 0;
       for (int i = 0; i < nlocal; i++) {
         if (mask[i] & groupbit) result[m] = eval_tree(tree,i);
@@ -3457,6 +3496,268 @@ double Variable::eval_tree(Tree *tree, int i)
   return 0.0;
 }
 
+/* ----------------------------------------------------------------------
+   check if every node of an atom-style tree is supported by
+   eval_tree_block(), i.e. has no per-atom evaluation order dependence
+   excluded: random/normal (RNG stream order), vectorarray, and the
+   timestep-scheduling functions, which collapse to VALUE anyway
+   when their arguments are constants
+------------------------------------------------------------------------- */
+
+int Variable::blockable_tree(Tree *tree)
+{
+  switch (tree->type) {
+  case VALUE:
+  case ATOMARRAY:
+  case TYPEARRAY:
+  case INTARRAY:
+  case BIGINTARRAY:
+  case GMASK:
+  case RMASK:
+  case GRMASK:
+    return 1;
+  case ADD:
+  case SUBTRACT:
+  case MULTIPLY:
+  case DIVIDE:
+  case MODULO:
+  case CARAT:
+  case UNARY:
+  case NOT:
+  case EQ:
+  case NE:
+  case LT:
+  case LE:
+  case GT:
+  case GE:
+  case AND:
+  case OR:
+  case XOR:
+  case SQRT:
+  case EXP:
+  case LN:
+  case LOG:
+  case ABS:
+  case SIN:
+  case COS:
+  case TAN:
+  case ASIN:
+  case ACOS:
+  case ATAN:
+  case ATAN2:
+  case CEIL:
+  case FLOOR:
+  case ROUND:
+  case TERNARY:
+    break;
+  default:
+    return 0;
+  }
+
+  if (tree->first && !blockable_tree(tree->first)) return 0;
+  if (tree->second && !blockable_tree(tree->second)) return 0;
+  for (int i = 0; i < tree->nextra; i++)
+    if (!blockable_tree(tree->extra[i])) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   evaluate an atom-style tree for a block of gathered atom indices
+   idx = list of N atom indices, out = N result values
+   same per-atom semantics and error checks as eval_tree(),
+   only node types accepted by blockable_tree() are handled
+------------------------------------------------------------------------- */
+
+void Variable::eval_tree_block(Tree *tree, const int *idx, int n, double *out)
+{
+  int k;
+  double tmp[ATOMBLOCK];
+
+  // leaf nodes
+
+  switch (tree->type) {
+  case VALUE:
+    for (k = 0; k < n; k++) out[k] = tree->value;
+    return;
+  case ATOMARRAY:
+    for (k = 0; k < n; k++) out[k] = tree->array[idx[k]*tree->nstride];
+    return;
+  case TYPEARRAY:
+    for (k = 0; k < n; k++) out[k] = tree->array[atom->type[idx[k]]];
+    return;
+  case INTARRAY:
+    for (k = 0; k < n; k++) out[k] = (double) tree->iarray[idx[k]*tree->nstride];
+    return;
+  case BIGINTARRAY:
+    for (k = 0; k < n; k++) out[k] = (double) tree->barray[idx[k]*tree->nstride];
+    return;
+  case GMASK:
+    for (k = 0; k < n; k++)
+      out[k] = (atom->mask[idx[k]] & tree->ivalue) ? 1.0 : 0.0;
+    return;
+  case RMASK:
+    for (k = 0; k < n; k++)
+      out[k] = tree->region->match(atom->x[idx[k]][0],atom->x[idx[k]][1],
+                                   atom->x[idx[k]][2]) ? 1.0 : 0.0;
+    return;
+  case GRMASK:
+    for (k = 0; k < n; k++)
+      out[k] = ((atom->mask[idx[k]] & tree->ivalue) &&
+                tree->region->match(atom->x[idx[k]][0],atom->x[idx[k]][1],
+                                    atom->x[idx[k]][2])) ? 1.0 : 0.0;
+    return;
+  }
+
+  // unary operations and functions, evaluate first argument in place
+
+  eval_tree_block(tree->first,idx,n,out);
+
+  switch (tree->type) {
+  case UNARY:
+    for (k = 0; k < n; k++) out[k] = -out[k];
+    return;
+  case NOT:
+    for (k = 0; k < n; k++) out[k] = (out[k] == 0.0) ? 1.0 : 0.0;
+    return;
+  case SQRT:
+    for (k = 0; k < n; k++) {
+      if (out[k] < 0.0)
+        error->one(FLERR,"Sqrt of negative value in variable formula");
+      out[k] = sqrt(out[k]);
+    }
+    return;
+  case EXP:
+    for (k = 0; k < n; k++) out[k] = exp(out[k]);
+    return;
+  case LN:
+    for (k = 0; k < n; k++) {
+      if (out[k] <= 0.0)
+        error->one(FLERR,"Log of zero/negative value in variable formula");
+      out[k] = log(out[k]);
+    }
+    return;
+  case LOG:
+    for (k = 0; k < n; k++) {
+      if (out[k] <= 0.0)
+        error->one(FLERR,"Log of zero/negative value in variable formula");
+      out[k] = log10(out[k]);
+    }
+    return;
+  case ABS:
+    for (k = 0; k < n; k++) out[k] = fabs(out[k]);
+    return;
+  case SIN:
+    for (k = 0; k < n; k++) out[k] = sin(out[k]);
+    return;
+  case COS:
+    for (k = 0; k < n; k++) out[k] = cos(out[k]);
+    return;
+  case TAN:
+    for (k = 0; k < n; k++) out[k] = tan(out[k]);
+    return;
+  case ASIN:
+    for (k = 0; k < n; k++) {
+      if (out[k] < -1.0 || out[k] > 1.0)
+        error->one(FLERR,"Arcsin of invalid value in variable formula");
+      out[k] = asin(out[k]);
+    }
+    return;
+  case ACOS:
+    for (k = 0; k < n; k++) {
+      if (out[k] < -1.0 || out[k] > 1.0)
+        error->one(FLERR,"Arccos of invalid value in variable formula");
+      out[k] = acos(out[k]);
+    }
+    return;
+  case ATAN:
+    for (k = 0; k < n; k++) out[k] = atan(out[k]);
+    return;
+  case CEIL:
+    for (k = 0; k < n; k++) out[k] = ceil(out[k]);
+    return;
+  case FLOOR:
+    for (k = 0; k < n; k++) out[k] = floor(out[k]);
+    return;
+  case ROUND:
+    for (k = 0; k < n; k++) out[k] = MYROUND(out[k]);
+    return;
+  }
+
+  // binary operations, evaluate second argument into scratch
+
+  eval_tree_block(tree->second,idx,n,tmp);
+
+  switch (tree->type) {
+  case ADD:
+    for (k = 0; k < n; k++) out[k] += tmp[k];
+    return;
+  case SUBTRACT:
+    for (k = 0; k < n; k++) out[k] -= tmp[k];
+    return;
+  case MULTIPLY:
+    for (k = 0; k < n; k++) out[k] *= tmp[k];
+    return;
+  case DIVIDE:
+    for (k = 0; k < n; k++) {
+      if (tmp[k] == 0.0) error->one(FLERR,"Divide by 0 in variable formula");
+      out[k] /= tmp[k];
+    }
+    return;
+  case MODULO:
+    for (k = 0; k < n; k++) {
+      if (tmp[k] == 0.0) error->one(FLERR,"Modulo 0 in variable formula");
+      out[k] = fmod(out[k],tmp[k]);
+    }
+    return;
+  case CARAT:
+    for (k = 0; k < n; k++) {
+      if (tmp[k] == 0.0) error->one(FLERR,"Power by 0 in variable formula");
+      out[k] = pow(out[k],tmp[k]);
+    }
+    return;
+  case EQ:
+    for (k = 0; k < n; k++) out[k] = (out[k] == tmp[k]) ? 1.0 : 0.0;
+    return;
+  case NE:
+    for (k = 0; k < n; k++) out[k] = (out[k] != tmp[k]) ? 1.0 : 0.0;
+    return;
+  case LT:
+    for (k = 0; k < n; k++) out[k] = (out[k] < tmp[k]) ? 1.0 : 0.0;
+    return;
+  case LE:
+    for (k = 0; k < n; k++) out[k] = (out[k] <= tmp[k]) ? 1.0 : 0.0;
+    return;
+  case GT:
+    for (k = 0; k < n; k++) out[k] = (out[k] > tmp[k]) ? 1.0 : 0.0;
+    return;
+  case GE:
+    for (k = 0; k < n; k++) out[k] = (out[k] >= tmp[k]) ? 1.0 : 0.0;
+    return;
+  case AND:
+    for (k = 0; k < n; k++)
+      out[k] = (out[k] != 0.0 && tmp[k] != 0.0) ? 1.0 : 0.0;
+    return;
+  case OR:
+    for (k = 0; k < n; k++)
+      out[k] = (out[k] != 0.0 || tmp[k] != 0.0) ? 1.0 : 0.0;
+    return;
+  case XOR:
+    for (k = 0; k < n; k++)
+      out[k] = ((out[k] == 0.0 && tmp[k] != 0.0) ||
+                (out[k] != 0.0 && tmp[k] == 0.0)) ? 1.0 : 0.0;
+    return;
+  case ATAN2:
+    for (k = 0; k < n; k++) out[k] = atan2(out[k],tmp[k]);
+    return;
+  case TERNARY: {
+    double tmp2[ATOMBLOCK];
+    eval_tree_block(tree->extra[0],idx,n,tmp2);
+    for (k = 0; k < n; k++) out[k] = (out[k] != 0.0) ? tmp[k] : tmp2[k];
+    return;
+  }
+  }
+}
+
 /* ----------------------------------------------------------------------
    scan entire tree, find size of vectors for vector-style variable
    return N for consistent vector size
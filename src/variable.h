@@ -137,6 +137,8 @@ class Variable : protected Pointers {
   double evaluate(char *, Tree **, int);
   double collapse_tree(Tree *);
   double eval_tree(Tree *, int);
+  int blockable_tree(Tree *);
+  void eval_tree_block(Tree *, const int *, int, double *);
   int size_tree_vector(Tree *);
   int compare_tree_vector(int, int);
   void free_tree(Tree *);
@@ -34,7 +34,7 @@
 using namespace LAMMPS_NS;
 
 enum { CREATE, SET, SCALE, RAMP, ZERO };
-enum { ALL, LOCAL, GEOM };
+enum { ALL, LOCAL, GEOM, IDHASH };
 enum { UNIFORM, GAUSSIAN };
 enum { NONE, CONSTANT, EQUAL, ATOM };
 
@@ -223,6 +223,10 @@ void Velocity::create(double t_desired, int seed)
   //    choose RNG for each atom based on its xyz coord (geometry)
   //      via random->reset()
   //    will always produce same V, independent of P
+  //   IDHASH = only loop over my atoms
+  //    choose RNG for each atom based on hash of its ID
+  //    same V, independent of P, under same conditions as ALL,
+  //      but at O(nlocal) cost and without consecutive ID requirement
   // adjust by factor for atom mass
   // set xdim,ydim,zdim = 1/0 for whether to create velocity in those dims
   //   zdim = 0 for 2d
@@ -342,6 +346,35 @@ void Velocity::create(double t_desired, int seed)
           vz = random->gaussian();
         }
 
+        if (rmass) factor = 1.0/sqrt(rmass[i]);
+        else factor = 1.0/sqrt(mass[type[i]]);
+        v[i][0] = vx * factor;
+        v[i][1] = vy * factor;
+        if (dim == 3) v[i][2] = vz * factor;
+        else v[i][2] = 0.0;
+      }
+    }
+
+  } else if (loop_flag == IDHASH) {
+    if (atom->tag_enable == 0)
+      error->all(FLERR,"Cannot use velocity create loop id unless atoms have IDs");
+
+    random = new RanPark(lmp,1);
+    tagint *tag = atom->tag;
+
+    for (i = 0; i < nlocal; i++) {
+      if (mask[i] & groupbit) {
+        random->reset(seed,tag[i]);
+        if (dist_flag == UNIFORM) {
+          vx = random->uniform() - 0.5;
+          vy = random->uniform() - 0.5;
+          vz = random->uniform() - 0.5;
+        } else { // GAUSSIAN
+          vx = random->gaussian();
+          vy = random->gaussian();
+          vz = random->gaussian();
+        }
+
         if (rmass) factor = 1.0/sqrt(rmass[i]);
         else factor = 1.0/sqrt(mass[type[i]]);
         v[i][0] = vx * factor;
@@ -853,6 +886,7 @@ void Velocity::options(int narg, char **arg)
       if (strcmp(arg[iarg+1],"all") == 0) loop_flag = ALL;
       else if (strcmp(arg[iarg+1],"local") == 0) loop_flag = LOCAL;
       else if (strcmp(arg[iarg+1],"geom") == 0) loop_flag = GEOM;
+      else if (strcmp(arg[iarg+1],"id") == 0) loop_flag = IDHASH;
       else error->all(FLERR,"Unknown velocity loop argument: {}", arg[iarg+1]);
       iarg += 2;
     } else if (strcmp(arg[iarg],"rigid") == 0) {
@@ -33,12 +33,38 @@
 #include "thermo.h"
 #include "update.h"
 
+#include <cstdint>
 #include <cstring>
 
 using namespace LAMMPS_NS;
 
 enum{II,IJ};
 enum{ELLIPSOID,LINE,TRIANGLE,BODY};   // also in AtomVecHybrid
+enum{BONDS,ANGLES,DIHEDRALS,IMPROPERS};
+
+// names and order of the topology sections eligible for reuse
+
+static const char *reuse_names[4] = {"Bonds","Angles","Dihedrals","Impropers"};
+
+// size of I/O buffer for copying and checksumming section bytes
+
+static constexpr int COPYCHUNK = 1048576;
+
+/* ----------------------------------------------------------------------
+   streaming CRC-32 (polynomial 0xEDB88320) used to verify that sections
+   copied from a previous data file still match their index entries
+------------------------------------------------------------------------- */
+
+static uint32_t crc32_update(uint32_t crc, const char *buf, size_t len)
+{
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (unsigned char) buf[i];
+    for (int k = 0; k < 8; k++)
+      crc = (crc >> 1) ^ ((crc & 1U) ? 0xEDB88320U : 0U);
+  }
+  return ~crc;
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -71,6 +97,13 @@ void WriteData::command(int narg, char **arg)
   triclinic_general = 0;
   lmapflag = 1;
   noinitflag = 0;
+  indexflag = 0;
+  indexfile.clear();
+  index_entries.clear();
+  reuseflag = 0;
+  reusedata.clear();
+  reuseindex.clear();
+  fpreuse = nullptr;
 
   // store current (default) setting since we may change it
 
@@ -100,6 +133,17 @@ void WriteData::command(int narg, char **arg)
     } else if (strcmp(arg[iarg],"nolabelmap") == 0) {
       lmapflag = 0;
       iarg++;
+    } else if (strcmp(arg[iarg],"index") == 0) {
+      if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "write_data index", error);
+      indexflag = 1;
+      indexfile = arg[iarg+1];
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"reuse") == 0) {
+      if (iarg+3 > narg) utils::missing_cmd_args(FLERR, "write_data reuse", error);
+      reuseflag = 1;
+      reusedata = arg[iarg+1];
+      reuseindex = arg[iarg+2];
+      iarg += 3;
     } else if (strcmp(arg[iarg],"types") == 0) {
       if (iarg+2 > narg) utils::missing_cmd_args(FLERR, "write_data types", error);
       if (strcmp(arg[iarg+1],"numeric") == 0) atom->types_style = Atom::NUMERIC;
@@ -200,6 +244,11 @@ void WriteData::write(const std::string &file)
     MPI_Allreduce(&nimpropers_local,&nimpropers,1,MPI_LMP_BIGINT,MPI_SUM,world);
   }
 
+  // get offsets, counts, and checksums of reusable topology sections
+  // from the index file of a previous data file
+
+  if (reuseflag) parse_reuse_index();
+
   // open data file
 
   if (comm->me == 0) {
@@ -263,9 +312,125 @@ void WriteData::write(const std::string &file)
 
   if (domain->triclinic_general) atom->avec->write_data_restore_restricted();
 
-  // close data file
+  // close data file and previous data file if sections were reused
+  // write companion section index file if requested
+  // re-read each indexed section to compute its checksum
+
+  if (comm->me == 0) {
+    fclose(fp);
+    if (fpreuse) {
+      fclose(fpreuse);
+      fpreuse = nullptr;
+    }
+    if (indexflag) {
+      FILE *fpdata = fopen(file.c_str(),"rb");
+      if (fpdata == nullptr)
+        error->one(FLERR,"Cannot re-open data file {}: {}", file, utils::getsyserror());
+      FILE *fpidx = fopen(indexfile.c_str(),"w");
+      if (fpidx == nullptr)
+        error->one(FLERR,"Cannot open index file {}: {}", indexfile, utils::getsyserror());
+      fmt::print(fpidx,"# LAMMPS data file section index for {}: "
+                 "section begin end nlines crc32\n",file);
+      auto copybuf = new char[COPYCHUNK];
+      for (const auto &entry : index_entries) {
+        (void) platform::fseek(fpdata,entry.begin);
+        bigint nremain = entry.end - entry.begin;
+        uint32_t crc = 0;
+        while (nremain > 0) {
+          auto nbytes = (size_t) MIN(nremain,(bigint) COPYCHUNK);
+          utils::sfread(FLERR,copybuf,1,nbytes,fpdata,file.c_str(),error);
+          crc = crc32_update(crc,copybuf,nbytes);
+          nremain -= (bigint) nbytes;
+        }
+        fmt::print(fpidx,"{} {} {} {} {}\n",entry.name,entry.begin,entry.end,entry.nlines,crc);
+      }
+      delete[] copybuf;
+      fclose(fpdata);
+      fclose(fpidx);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   proc 0 parses the index file of a previous data file and broadcasts
+   begin/end offsets, line counts, and checksums of its topology sections
+------------------------------------------------------------------------- */
+
+void WriteData::parse_reuse_index()
+{
+  for (int isec = 0; isec < 4; isec++)
+    reuse_info[isec][0] = reuse_info[isec][1] = reuse_info[isec][2] = reuse_info[isec][3] = -1;
+
+  if (comm->me == 0) {
+    FILE *fpidx = fopen(reuseindex.c_str(),"r");
+    if (fpidx == nullptr)
+      error->one(FLERR,"Cannot open index file {}: {}", reuseindex, utils::getsyserror());
+    char idxline[1024];
+    while (fgets(idxline,1024,fpidx)) {
+      auto words = utils::split_words(idxline);
+      if ((words.size() != 5) || (words[0][0] == '#')) continue;
+      for (int isec = 0; isec < 4; isec++) {
+        if (words[0] != reuse_names[isec]) continue;
+        reuse_info[isec][0] = utils::bnumeric(FLERR,words[1],false,lmp);
+        reuse_info[isec][1] = utils::bnumeric(FLERR,words[2],false,lmp);
+        reuse_info[isec][2] = utils::bnumeric(FLERR,words[3],false,lmp);
+        reuse_info[isec][3] = utils::bnumeric(FLERR,words[4],false,lmp);
+      }
+    }
+    fclose(fpidx);
+  }
+  MPI_Bcast(&reuse_info[0][0],16,MPI_LMP_BIGINT,0,world);
+}
+
+/* ----------------------------------------------------------------------
+   if the topology section isec is unchanged since the previous data
+   file, proc 0 copies its bytes verbatim instead of re-gathering and
+   re-formatting it, verifying the checksum from the index file
+   return 1 if the section was copied, 0 if it must be written anew
+------------------------------------------------------------------------- */
+
+int WriteData::reuse_section(int isec, bigint nlines)
+{
+  if (!reuseflag) return 0;
+  if (reuse_info[isec][0] < 0) return 0;
+  if (reuse_info[isec][2] != nlines) {
+    if (comm->me == 0)
+      error->warning(FLERR,"Cannot reuse {} section: count changed from {} to {}",
+                     reuse_names[isec],reuse_info[isec][2],nlines);
+    return 0;
+  }
+
+  if (comm->me == 0) {
+    fmt::print(fp,"\n{}\n\n",reuse_names[isec]);
+    bigint begin = platform::ftell(fp);
 
-  if (comm->me == 0) fclose(fp);
+    if (fpreuse == nullptr) {
+      fpreuse = fopen(reusedata.c_str(),"rb");
+      if (fpreuse == nullptr)
+        error->one(FLERR,"Cannot open data file {}: {}", reusedata, utils::getsyserror());
+    }
+    (void) platform::fseek(fpreuse,reuse_info[isec][0]);
+
+    auto copybuf = new char[COPYCHUNK];
+    bigint nremain = reuse_info[isec][1] - reuse_info[isec][0];
+    uint32_t crc = 0;
+    while (nremain > 0) {
+      auto nbytes = (size_t) MIN(nremain,(bigint) COPYCHUNK);
+      utils::sfread(FLERR,copybuf,1,nbytes,fpreuse,reusedata.c_str(),error);
+      crc = crc32_update(crc,copybuf,nbytes);
+      fwrite(copybuf,1,nbytes,fp);
+      nremain -= (bigint) nbytes;
+    }
+    delete[] copybuf;
+
+    if ((bigint) crc != reuse_info[isec][3])
+      error->one(FLERR,"Checksum mismatch for {} section of data file {}",
+                 reuse_names[isec],reusedata);
+
+    if (indexflag)
+      index_entries.push_back({reuse_names[isec],begin,platform::ftell(fp),nlines});
+  }
+  return 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -430,6 +595,7 @@ void WriteData::atoms()
     MPI_Request request;
 
     fmt::print(fp,"\nAtoms # {}\n\n",atom->atom_style);
+    bigint begin = platform::ftell(fp);
     for (int iproc = 0; iproc < comm->nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_DOUBLE,iproc,0,world,&request);
@@ -441,6 +607,8 @@ void WriteData::atoms()
 
       atom->avec->write_data(fp,recvrow,buf);
     }
+    if (indexflag)
+      index_entries.push_back({"Atoms",begin,platform::ftell(fp),atom->natoms});
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -483,6 +651,7 @@ void WriteData::velocities()
     MPI_Request request;
 
     fputs("\nVelocities\n\n",fp);
+    bigint begin = platform::ftell(fp);
     for (int iproc = 0; iproc < comm->nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_DOUBLE,iproc,0,world,&request);
@@ -494,6 +663,8 @@ void WriteData::velocities()
 
       atom->avec->write_vel(fp,recvrow,buf);
     }
+    if (indexflag)
+      index_entries.push_back({"Velocities",begin,platform::ftell(fp),atom->natoms});
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -509,6 +680,10 @@ void WriteData::velocities()
 
 void WriteData::bonds()
 {
+  // copy section verbatim from previous data file if topology is unchanged
+
+  if (reuse_section(BONDS,nbonds)) return;
+
   // communication buffer for all my Bond info
   // maxrow X ncol = largest buffer needed by any proc
 
@@ -537,6 +712,7 @@ void WriteData::bonds()
     MPI_Request request;
 
     fputs("\nBonds\n\n",fp);
+    bigint begin = platform::ftell(fp);
     for (int iproc = 0; iproc < comm->nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -549,6 +725,8 @@ void WriteData::bonds()
       atom->avec->write_bond(fp,recvrow,buf,index);
       index += recvrow;
     }
+    if (indexflag)
+      index_entries.push_back({"Bonds",begin,platform::ftell(fp),nbonds});
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -564,6 +742,10 @@ void WriteData::bonds()
 
 void WriteData::angles()
 {
+  // copy section verbatim from previous data file if topology is unchanged
+
+  if (reuse_section(ANGLES,nangles)) return;
+
   // communication buffer for all my Angle info
   // maxrow X ncol = largest buffer needed by any proc
 
@@ -592,6 +774,7 @@ void WriteData::angles()
     MPI_Request request;
 
     fputs("\nAngles\n\n",fp);
+    bigint begin = platform::ftell(fp);
     for (int iproc = 0; iproc < comm->nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -604,6 +787,8 @@ void WriteData::angles()
       atom->avec->write_angle(fp,recvrow,buf,index);
       index += recvrow;
     }
+    if (indexflag)
+      index_entries.push_back({"Angles",begin,platform::ftell(fp),nangles});
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -619,6 +804,10 @@ void WriteData::angles()
 
 void WriteData::dihedrals()
 {
+  // copy section verbatim from previous data file if topology is unchanged
+
+  if (reuse_section(DIHEDRALS,ndihedrals)) return;
+
   // communication buffer for all my Dihedral info
   // maxrow X ncol = largest buffer needed by any proc
 
@@ -647,6 +836,7 @@ void WriteData::dihedrals()
     MPI_Request request;
 
     fputs("\nDihedrals\n\n",fp);
+    bigint begin = platform::ftell(fp);
     for (int iproc = 0; iproc < comm->nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -659,6 +849,8 @@ void WriteData::dihedrals()
       atom->avec->write_dihedral(fp,recvrow,buf,index);
       index += recvrow;
     }
+    if (indexflag)
+      index_entries.push_back({"Dihedrals",begin,platform::ftell(fp),ndihedrals});
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -674,6 +866,10 @@ void WriteData::dihedrals()
 
 void WriteData::impropers()
 {
+  // copy section verbatim from previous data file if topology is unchanged
+
+  if (reuse_section(IMPROPERS,nimpropers)) return;
+
   // communication buffer for all my Improper info
   // maxrow X ncol = largest buffer needed by any proc
 
@@ -702,6 +898,7 @@ void WriteData::impropers()
     MPI_Request request;
 
     fputs("\nImpropers\n\n",fp);
+    bigint begin = platform::ftell(fp);
     for (int iproc = 0; iproc < comm->nprocs; iproc++) {
       if (iproc) {
         MPI_Irecv(&buf[0][0],maxrow*ncol,MPI_LMP_TAGINT,iproc,0,world,&request);
@@ -714,6 +911,8 @@ void WriteData::impropers()
       atom->avec->write_improper(fp,recvrow,buf,index);
       index += recvrow;
     }
+    if (indexflag)
+      index_entries.push_back({"Impropers",begin,platform::ftell(fp),nimpropers});
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -43,6 +43,20 @@ class WriteData : public Command {
   bigint ndihedrals_local, ndihedrals;
   bigint nimpropers_local, nimpropers;
 
+  int indexflag;    // 1 if also writing a section byte-offset index file
+  std::string indexfile;
+
+  struct IndexEntry {
+    std::string name;
+    bigint begin, end, nlines;
+  };
+  std::vector<IndexEntry> index_entries;
+
+  int reuseflag;    // 1 if copying unchanged topology sections from a previous data file
+  std::string reusedata, reuseindex;
+  FILE *fpreuse;
+  bigint reuse_info[4][4];    // begin, end, nlines, checksum per topology section
+
   void header();
   void type_arrays();
   void force_fields();
@@ -54,6 +68,8 @@ class WriteData : public Command {
   void impropers();
   void bonus(int);
   void fix(class Fix *, int);
+  void parse_reuse_index();
+  int reuse_section(int, bigint);
 };
 
 }    // namespace LAMMPS_NS
@@ -32,6 +32,7 @@
 #include "neighbor.h"
 #include "output.h"
 #include "pair.h"
+#include "platform.h"
 #include "thermo.h"
 #include "update.h"
 
@@ -39,6 +40,10 @@
 
 #include "lmprestart.h"
 
+#if defined(LMP_MPIIO)
+#include "restart_mpiio.h"
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -48,6 +53,7 @@ WriteRestart::WriteRestart(LAMMPS *lmp) : Command(lmp)
   MPI_Comm_rank(world,&me);
   MPI_Comm_size(world,&nprocs);
   multiproc = 0;
+  mpiioflag = 0;
   noinit = 0;
   fp = nullptr;
 }
@@ -73,13 +79,15 @@ void WriteRestart::command(int narg, char **arg)
 
   if (strchr(arg[0],'%')) multiproc = nprocs;
   else multiproc = 0;
-  if (utils::strmatch(arg[0],"\\.mpiio$"))
-    error->all(FLERR,"MPI-IO files are no longer supported by LAMMPS");
+  if (utils::strmatch(arg[0],"\\.mpiio$")) mpiioflag = 1;
+  else mpiioflag = 0;
+  if (multiproc && mpiioflag)
+    error->all(FLERR,"Cannot use both '%' and '.mpiio' in restart file name");
 
   // setup output style and process optional args
   // also called by Output class for periodic restart files
 
-  multiproc_options(multiproc,narg-1,&arg[1]);
+  multiproc_options(multiproc,mpiioflag,narg-1,&arg[1]);
 
   // init entire system since comm->exchange is done
   // comm::init needs neighbor::init needs pair::init needs kspace::init, etc
@@ -115,9 +123,16 @@ void WriteRestart::command(int narg, char **arg)
 
 /* ---------------------------------------------------------------------- */
 
-void WriteRestart::multiproc_options(int multiproc_caller, int narg, char **arg)
+void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
+                                     int narg, char **arg)
 {
   multiproc = multiproc_caller;
+  mpiioflag = mpiioflag_caller;
+
+#if !defined(LMP_MPIIO)
+  if (mpiioflag)
+    error->all(FLERR,"Writing to MPI-IO filename when MPIIO package is not installed");
+#endif
 
   // defaults for multiproc file writing
 
@@ -338,26 +353,70 @@ void WriteRestart::write(const std::string &file)
     }
   }
 
+  // MPI-IO output of a single file
+  // all procs collectively write their chunk at its rank-ordered offset,
+  //   past the header that proc 0 has already written with stdio
+  // proc 0 then re-opens the file to append the ending magic string
+
+  int tmp,recv_size;
+
+  if (mpiioflag) {
+#if defined(LMP_MPIIO)
+    if (me == 0) {
+      if (ferror(fp)) io_error = 1;
+      fclose(fp);
+      fp = nullptr;
+    }
+
+    auto mpiio = new RestartMPIIO(lmp);
+    mpiio->openForWrite(file.c_str());
+    mpiio->write(headeroffset,send_size,buf);
+    mpiio->close();
+    delete mpiio;
+
+    if (me == 0) {
+      fp = fopen(file.c_str(),"ab");
+      if (fp == nullptr)
+        error->one(FLERR, "Cannot open restart file {}: {}", file, utils::getsyserror());
+      magic_string();
+      if (ferror(fp)) io_error = 1;
+      fclose(fp);
+      fp = nullptr;
+    }
+#endif
+
   // output of one or more native files
   // filewriter = 1 = this proc writes to file
   // ping each proc in my cluster, receive its data, write data to file
+  // double buffering: the receive of the next proc's chunk is posted
+  //   before the current chunk is written, so communication overlaps
+  //   with disk I/O
   // else wait for ping from fileproc, send my data to fileproc
 
-  int tmp,recv_size;
-
-  if (filewriter) {
+  } else if (filewriter) {
     MPI_Status status;
     MPI_Request request;
+
+    double *bufs[2];
+    bufs[0] = buf;
+    bufs[1] = nullptr;
+    if (nclusterprocs > 1) memory->create(bufs[1],max_size,"write_restart:buf2");
+
     for (int iproc = 0; iproc < nclusterprocs; iproc++) {
       if (iproc) {
-        MPI_Irecv(buf,max_size,MPI_DOUBLE,me+iproc,0,world,&request);
-        MPI_Send(&tmp,0,MPI_INT,me+iproc,0,world);
         MPI_Wait(&request,&status);
         MPI_Get_count(&status,MPI_DOUBLE,&recv_size);
       } else recv_size = send_size;
 
-      write_double_vec(PERPROC,recv_size,buf);
+      if (iproc+1 < nclusterprocs) {
+        MPI_Irecv(bufs[(iproc+1) % 2],max_size,MPI_DOUBLE,me+iproc+1,0,world,&request);
+        MPI_Send(&tmp,0,MPI_INT,me+iproc+1,0,world);
+      }
+
+      write_double_vec(PERPROC,recv_size,bufs[iproc % 2]);
     }
+
+    memory->destroy(bufs[1]);
     magic_string();
     if (ferror(fp)) io_error = 1;
     fclose(fp);
@@ -549,9 +608,25 @@ void WriteRestart::force_fields()
    all procs call this method, only proc 0 writes to file
 ------------------------------------------------------------------------- */
 
-void WriteRestart::file_layout(int /*send_size*/)
+void WriteRestart::file_layout(int send_size)
 {
-  if (me == 0) write_int(MULTIPROC,multiproc);
+  if (me == 0) {
+    write_int(MULTIPROC,multiproc);
+    if (mpiioflag) write_int(MPIIO,mpiioflag);
+  }
+
+  // for MPI-IO output, record the chunk size of every proc
+  // so a reader can compute the extent of each rank's chunk in the file
+
+  if (mpiioflag) {
+    int *all_send_sizes = nullptr;
+    if (me == 0) memory->create(all_send_sizes,nprocs,"write_restart:all_send_sizes");
+    MPI_Gather(&send_size,1,MPI_INT,all_send_sizes,1,MPI_INT,0,world);
+    if (me == 0) {
+      fwrite(all_send_sizes,sizeof(int),nprocs,fp);
+      memory->destroy(all_send_sizes);
+    }
+  }
 
   // -1 flag signals end of file layout info
 
@@ -559,6 +634,14 @@ void WriteRestart::file_layout(int /*send_size*/)
     int flag = -1;
     fwrite(&flag,sizeof(int),1,fp);
   }
+
+  // for MPI-IO output, all procs need the end-of-header offset
+  // where the collective write of the per-proc chunks will start
+
+  if (mpiioflag) {
+    if (me == 0) headeroffset = platform::ftell(fp);
+    MPI_Bcast(&headeroffset,1,MPI_LMP_BIGINT,0,world);
+  }
 }
 
 // ----------------------------------------------------------------------
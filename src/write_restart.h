@@ -28,7 +28,7 @@ class WriteRestart : public Command {
  public:
   WriteRestart(class LAMMPS *);
   void command(int, char **) override;
-  void multiproc_options(int, int, char **);
+  void multiproc_options(int, int, int, char **);
   void write(const std::string &);
 
  private:
@@ -44,6 +44,9 @@ class WriteRestart : public Command {
   int fileproc;         // ID of proc in my cluster who writes to file
   int icluster;         // which cluster I am in
 
+  int mpiioflag;          // 1 for collective output to a ".mpiio" file
+  bigint headeroffset;    // file offset where per-proc chunks start
+
   void header();
   void type_arrays();
   void force_fields();
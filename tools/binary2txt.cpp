@@ -40,6 +40,12 @@
 #define LAMMPS_SMALLBIG
 #endif
 
+// marker bracketing the per-frame index footer written by the
+// MPI-IO dump styles, spells "LMPINDEX" as 8 ASCII chars
+// must match INDEX_MAGIC in src/MPIIO/dump_custom_mpiio.h
+
+#define INDEX_MAGIC 0x4C4D50494E444558
+
 #if defined(LAMMPS_SMALLBIG)
 typedef int tagint;
 typedef int64_t bigint;
@@ -276,6 +282,21 @@ int main(int narg, char **arg)
         }
       }
 
+      // skip optional per-frame index footer written by MPI-IO dumps:
+      // magic, prev footer offset, nchunk chunk offsets, nchunk, magic
+      // footer entries are always int64_t, independent of the bigint size
+
+      int64_t peek;
+      fread(&peek, sizeof(int64_t), 1, fp);
+      if (feof(fp)) {
+        clearerr(fp);
+        fseek(fp, 0, SEEK_END);
+      } else if (peek == (int64_t) INDEX_MAGIC) {
+        fseek(fp, (long) (nchunk + 3) * (long) sizeof(int64_t), SEEK_CUR);
+      } else {
+        fseek(fp, -(long) sizeof(int64_t), SEEK_CUR);
+      }
+
       printf(" " BIGINT_FORMAT, ntimestep);
       fflush(stdout);
     }
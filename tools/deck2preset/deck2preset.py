@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+# Generate a CMake preset which enables only the LAMMPS packages that
+# provide the styles used in one or more input scripts.
+#
+# The style-to-package mapping is derived from the *Style() macros in
+# the package header files, so it is always consistent with the LAMMPS
+# source tree the preset is generated from.
+
+import sys
+
+if sys.version_info.major < 3 or sys.version_info.minor < 5:
+    sys.exit('This script must be run with Python 3.5 or later')
+
+import os
+import re
+import argparse
+
+# categories of styles and the input script commands selecting them
+# for fix/compute/dump the style name is the 3rd argument
+
+STYLE_MACROS = ('AngleStyle', 'AtomStyle', 'BodyStyle', 'BondStyle',
+                'CommandStyle', 'ComputeStyle', 'DihedralStyle', 'DumpStyle',
+                'FixStyle', 'ImproperStyle', 'IntegrateStyle', 'KSpaceStyle',
+                'MinimizeStyle', 'PairStyle', 'ReaderStyle', 'RegionStyle')
+
+STYLE_COMMANDS = {'angle_style': 'AngleStyle',
+                  'atom_style': 'AtomStyle',
+                  'bond_style': 'BondStyle',
+                  'dihedral_style': 'DihedralStyle',
+                  'improper_style': 'ImproperStyle',
+                  'kspace_style': 'KSpaceStyle',
+                  'min_style': 'MinimizeStyle',
+                  'pair_style': 'PairStyle',
+                  'run_style': 'IntegrateStyle',
+                  'region': 'RegionStyle'}
+
+ARG3_COMMANDS = {'compute': 'ComputeStyle',
+                 'dump': 'DumpStyle',
+                 'fix': 'FixStyle'}
+
+# accelerator suffixes and the packages providing them
+
+SUFFIX_TO_PKG = {'gpu': 'GPU', 'intel': 'INTEL', 'kk': 'KOKKOS',
+                 'omp': 'OPENMP', 'opt': 'OPT'}
+
+STYLE_PATTERN = re.compile(r'(' + '|'.join(STYLE_MACROS) + r')\(\s*([^,\s]+)\s*,')
+
+def get_packages(cmakelists):
+    """extract STANDARD_PACKAGES and SUFFIX_PACKAGES lists from CMakeLists.txt"""
+    with open(cmakelists) as f:
+        text = f.read()
+    packages = []
+    for var in ('STANDARD_PACKAGES', 'SUFFIX_PACKAGES'):
+        match = re.search(r'set\(' + var + r'([^)]+)\)', text)
+        if not match:
+            sys.exit('Cannot find %s list in %s' % (var, cmakelists))
+        packages += match.group(1).split()
+    return packages
+
+def get_style_map(srcdir, packages):
+    """map (category, style name) -> package name from *Style() macros
+       styles in the src directory itself are part of the core code
+       and mapped to the pseudo-package None"""
+    style_map = {}
+    folders = [('', None)]
+    for pkg in packages:
+        folders.append((pkg, pkg))
+    for folder, pkg in folders:
+        headers = os.path.join(srcdir, folder)
+        if not os.path.isdir(headers):
+            continue
+        for header in os.listdir(headers):
+            if not header.endswith('.h'):
+                continue
+            with open(os.path.join(headers, header)) as f:
+                text = f.read()
+            for macro, style in STYLE_PATTERN.findall(text):
+                style_map[(macro, style)] = pkg
+    return style_map
+
+def read_lines(deck):
+    """return logical lines of an input script with comments stripped
+       and '&' line continuations resolved"""
+    lines = []
+    previous = ''
+    with open(deck) as f:
+        for line in f:
+            line = previous + line.split('#')[0].strip()
+            if line.endswith('&'):
+                previous = line[:-1]
+                continue
+            previous = ''
+            if line:
+                lines.append(line)
+    return lines
+
+def lookup(style_map, category, style, found, unknown):
+    """look up one style name, stripping an accelerator suffix if needed
+       record the providing package(s) in found, else record in unknown"""
+    if '$' in style:
+        unknown.add('%s (unresolved variable)' % style)
+        return
+    if (category, style) in style_map:
+        found.add(style_map[(category, style)])
+        return
+    suffix = style.rpartition('/')[2]
+    if suffix in SUFFIX_TO_PKG:
+        base = style[:-len(suffix) - 1]
+        if (category, base) in style_map:
+            found.add(style_map[(category, base)])
+            found.add(SUFFIX_TO_PKG[suffix])
+            return
+    unknown.add(style)
+
+def scan_deck(deck, style_map, found, unknown, seen):
+    """record packages providing the styles used in one input script
+       follows include commands, checks hybrid sub-style arguments"""
+    if deck in seen:
+        return
+    seen.add(deck)
+    for line in read_lines(deck):
+        words = line.split()
+        command = words[0]
+        if command == 'include' and len(words) > 1:
+            nested = words[1]
+            if not os.path.isabs(nested):
+                nested = os.path.join(os.path.dirname(deck), nested)
+            if os.path.isfile(nested):
+                scan_deck(nested, style_map, found, unknown, seen)
+            continue
+        if command in STYLE_COMMANDS and len(words) > 1:
+            category = STYLE_COMMANDS[command]
+            lookup(style_map, category, words[1], found, unknown)
+            # remaining arguments may be sub-styles of a hybrid style,
+            # only flag exact matches and ignore everything else
+            for word in words[2:]:
+                if (category, word) in style_map:
+                    found.add(style_map[(category, word)])
+        elif command in ARG3_COMMANDS and len(words) > 3:
+            lookup(style_map, ARG3_COMMANDS[command], words[3], found, unknown)
+        elif ('CommandStyle', command) in style_map:
+            found.add(style_map[('CommandStyle', command)])
+
+def write_preset(preset, packages, enabled, decks):
+    with open(preset, 'w') as f:
+        f.write('# Preset generated by tools/deck2preset/deck2preset.py from:\n')
+        for deck in decks:
+            f.write('#   %s\n' % deck)
+        f.write('# Enables only the packages providing the styles used in the\n'
+                '# input script(s) above. All other packages are turned off.\n\n')
+        f.write('set(ALL_PACKAGES\n')
+        for pkg in packages:
+            f.write('  %s\n' % pkg)
+        f.write(')\n\nforeach(PKG ${ALL_PACKAGES})\n'
+                '  set(PKG_${PKG} OFF CACHE BOOL "" FORCE)\n'
+                'endforeach()\n\n')
+        f.write('set(DECK_PACKAGES\n')
+        for pkg in enabled:
+            f.write('  %s\n' % pkg)
+        f.write(')\n\nforeach(PKG ${DECK_PACKAGES})\n'
+                '  set(PKG_${PKG} ON CACHE BOOL "" FORCE)\n'
+                'endforeach()\n')
+
+def main():
+    topdir = os.path.dirname(os.path.dirname(
+        os.path.dirname(os.path.abspath(__file__))))
+    parser = argparse.ArgumentParser(
+        description='Generate a CMake preset enabling only the LAMMPS '
+        'packages required by the styles used in the given input script(s)')
+    parser.add_argument('decks', metavar='INPUT_SCRIPT', nargs='+',
+                        help='LAMMPS input script(s) to scan')
+    parser.add_argument('-l', '--lammps', default=topdir,
+                        help='path to LAMMPS source distribution '
+                        '(default: distribution containing this script)')
+    parser.add_argument('-o', '--output', default='deck.cmake',
+                        help='preset file to write (default: deck.cmake)')
+    args = parser.parse_args()
+
+    srcdir = os.path.join(args.lammps, 'src')
+    cmakelists = os.path.join(args.lammps, 'cmake', 'CMakeLists.txt')
+    if not os.path.isdir(srcdir) or not os.path.isfile(cmakelists):
+        sys.exit('%s is not a LAMMPS source distribution' % args.lammps)
+
+    packages = get_packages(cmakelists)
+    style_map = get_style_map(srcdir, packages)
+
+    found = set()
+    unknown = set()
+    seen = set()
+    for deck in args.decks:
+        if not os.path.isfile(deck):
+            sys.exit('Input script %s does not exist' % deck)
+        scan_deck(deck, style_map, found, unknown, seen)
+
+    found.discard(None)
+    enabled = sorted(found)
+    write_preset(args.output, packages, enabled, args.decks)
+
+    print('Enabled packages: %s' % (' '.join(enabled) if enabled else '(none)'))
+    for style in sorted(unknown):
+        print('WARNING: unknown style %s, may need additional packages '
+              'or a plugin' % style, file=sys.stderr)
+    print('Configure with: cmake -C %s [OPTIONS] %s'
+          % (args.output, os.path.join(args.lammps, 'cmake')))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,268 @@
+/* -----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/
+   LAMMPS development team: developers@lammps.org, Sandia National Laboratories
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------ */
+
+// Convert one or more LAMMPS delta-encoded binary dump files, written by
+//   the "dump delta" style, to ASCII text dump files
+//
+// this serial code must be compiled on a platform that can read the binary
+//   dump files since binary formats are not compatible across all platforms
+//
+// delta records store the displacement of an atom since its previous
+//   record, so snapshots must be processed front to back and each file
+//   must start with a keyframe (dump delta always writes one)
+//
+// Syntax: delta2txt file1 file2 ...
+// Creates:          file1.txt file2.txt ...
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <map>
+
+// these must match settings in src/lmptype.h which builds LAMMPS with
+//   -DLAMMPS_SMALLBIG (the default), -DLAMMPS_BIGBIG, or -DLAMMPS_SMALLSMALL
+// you can edit the tools/Makefile to enforce the same setting
+//   for the build of delta2txt, e.g.
+//   g++ -g -DLAMMPS_BIGBIG delta2txt.o -o delta2txt
+//   again -DLAMMPS_SMALLBIG is the default
+
+#define __STDC_FORMAT_MACROS
+#include <cinttypes>
+
+#ifndef PRId64
+#define PRId64 "ld"
+#endif
+
+#if !defined(LAMMPS_SMALLSMALL) && !defined(LAMMPS_BIGBIG) && !defined(LAMMPS_SMALLBIG)
+#define LAMMPS_SMALLBIG
+#endif
+
+#if defined(LAMMPS_SMALLBIG)
+typedef int tagint;
+typedef int64_t bigint;
+#define TAGINT_FORMAT "%d"
+#define BIGINT_FORMAT "%" PRId64
+#elif defined(LAMMPS_SMALLSMALL)
+typedef int tagint;
+typedef int bigint;
+#define TAGINT_FORMAT "%d"
+#define BIGINT_FORMAT "%d"
+#else /* LAMMPS_BIGBIG */
+typedef int64_t tagint;
+typedef int64_t bigint;
+#define TAGINT_FORMAT "%" PRId64
+#define BIGINT_FORMAT "%" PRId64
+#endif
+
+// last absolute quantized position of each atom seen so far
+
+struct AtomState {
+  int32_t q[3];
+};
+
+int main(int narg, char **arg)
+{
+  int i, k, m, n;
+  bigint ntimestep, natoms;
+  int nchunk, triclinic;
+  double xlo, xhi, ylo, yhi, zlo, zhi, xy, xz, yz;
+  double prec;
+  char keyflag;
+  int boundary[3][2];
+  char boundstr[9];
+
+  int maxbuf = 0;
+  char *buf = nullptr;
+
+  if (narg == 1) {
+    printf("Syntax: delta2txt file1 file2 ...\n");
+    return 1;
+  }
+
+  // loop over files
+
+  for (int iarg = 1; iarg < narg; iarg++) {
+    printf("%s:", arg[iarg]);
+    fflush(stdout);
+    FILE *fp = fopen(arg[iarg], "rb");
+    if (!fp) {
+      printf("ERROR: Could not open %s\n", arg[iarg]);
+      return 1;
+    }
+
+    n = strlen(arg[iarg]) + 1 + 4;
+    char *filetxt = new char[n];
+    strcpy(filetxt, arg[iarg]);
+    strcat(filetxt, ".txt");
+    FILE *fptxt = fopen(filetxt, "w");
+    if (!fptxt) {
+      printf("ERROR: Could not open %s\n", filetxt);
+      return 1;
+    }
+    delete[] filetxt;
+
+    std::map<tagint, AtomState> atoms;
+
+    // loop over snapshots in file
+
+    while (true) {
+      fread(&ntimestep, sizeof(bigint), 1, fp);
+
+      // detect end-of-file
+
+      if (feof(fp)) {
+        fclose(fp);
+        fclose(fptxt);
+        break;
+      }
+
+      // check magic string, endianness and format revision
+
+      if (ntimestep >= 0) {
+        printf("ERROR: file does not start with a dump delta magic string\n");
+        return 1;
+      }
+
+      int magiclen = -ntimestep;
+      char magic[16];
+      if (magiclen >= (int) sizeof(magic)) {
+        printf("ERROR: file is not a dump delta file\n");
+        return 1;
+      }
+      fread(magic, sizeof(char), magiclen, fp);
+      magic[magiclen] = '\0';
+      if (strcmp(magic, "DUMPDELTA") != 0) {
+        printf("ERROR: file is not a dump delta file\n");
+        return 1;
+      }
+      int endian, revision;
+      fread(&endian, sizeof(int), 1, fp);
+      if (endian != 0x0001) {
+        printf("ERROR: file was written with different endianness\n");
+        return 1;
+      }
+      fread(&revision, sizeof(int), 1, fp);
+      if (revision != 0x0001) {
+        printf("ERROR: unsupported dump delta format revision\n");
+        return 1;
+      }
+
+      fread(&ntimestep, sizeof(bigint), 1, fp);
+      fread(&natoms, sizeof(bigint), 1, fp);
+      fread(&triclinic, sizeof(int), 1, fp);
+      fread(&boundary[0][0], 6 * sizeof(int), 1, fp);
+      fread(&xlo, sizeof(double), 1, fp);
+      fread(&xhi, sizeof(double), 1, fp);
+      fread(&ylo, sizeof(double), 1, fp);
+      fread(&yhi, sizeof(double), 1, fp);
+      fread(&zlo, sizeof(double), 1, fp);
+      fread(&zhi, sizeof(double), 1, fp);
+      if (triclinic) {
+        fread(&xy, sizeof(double), 1, fp);
+        fread(&xz, sizeof(double), 1, fp);
+        fread(&yz, sizeof(double), 1, fp);
+      }
+      fread(&prec, sizeof(double), 1, fp);
+      fread(&keyflag, sizeof(char), 1, fp);
+      fread(&nchunk, sizeof(int), 1, fp);
+
+      m = 0;
+      for (int idim = 0; idim < 3; idim++) {
+        for (int iside = 0; iside < 2; iside++) {
+          if (boundary[idim][iside] == 0)
+            boundstr[m++] = 'p';
+          else if (boundary[idim][iside] == 1)
+            boundstr[m++] = 'f';
+          else if (boundary[idim][iside] == 2)
+            boundstr[m++] = 's';
+          else if (boundary[idim][iside] == 3)
+            boundstr[m++] = 'm';
+        }
+        boundstr[m++] = ' ';
+      }
+      boundstr[8] = '\0';
+
+      fprintf(fptxt, "ITEM: TIMESTEP\n");
+      fprintf(fptxt, BIGINT_FORMAT "\n", ntimestep);
+      fprintf(fptxt, "ITEM: NUMBER OF ATOMS\n");
+      fprintf(fptxt, BIGINT_FORMAT "\n", natoms);
+      if (!triclinic) {
+        fprintf(fptxt, "ITEM: BOX BOUNDS %s\n", boundstr);
+        fprintf(fptxt, "%-1.16e %-1.16e\n", xlo, xhi);
+        fprintf(fptxt, "%-1.16e %-1.16e\n", ylo, yhi);
+        fprintf(fptxt, "%-1.16e %-1.16e\n", zlo, zhi);
+      } else {
+        fprintf(fptxt, "ITEM: BOX BOUNDS xy xz yz %s\n", boundstr);
+        fprintf(fptxt, "%-1.16e %-1.16e %-1.16e\n", xlo, xhi, xy);
+        fprintf(fptxt, "%-1.16e %-1.16e %-1.16e\n", ylo, yhi, xz);
+        fprintf(fptxt, "%-1.16e %-1.16e %-1.16e\n", zlo, zhi, yz);
+      }
+      fprintf(fptxt, "ITEM: ATOMS id type x y z\n");
+
+      // loop over processor chunks in snapshot
+
+      for (i = 0; i < nchunk; i++) {
+        int nrecord, nbytes;
+        fread(&nrecord, sizeof(int), 1, fp);
+        fread(&nbytes, sizeof(int), 1, fp);
+
+        if (nbytes > maxbuf) {
+          delete[] buf;
+          buf = new char[nbytes];
+          maxbuf = nbytes;
+        }
+        fread(buf, 1, nbytes, fp);
+
+        // reconstruct absolute coords from absolute or delta records
+
+        char *ptr = buf;
+        for (int irec = 0; irec < nrecord; irec++) {
+          tagint id;
+          int16_t itype;
+          memcpy(&id, ptr, sizeof(tagint));
+          ptr += sizeof(tagint);
+          memcpy(&itype, ptr, sizeof(int16_t));
+          ptr += sizeof(int16_t);
+          char absflag = *ptr++;
+
+          AtomState &state = atoms[id];
+          if (absflag) {
+            int32_t v;
+            for (k = 0; k < 3; k++) {
+              memcpy(&v, ptr, sizeof(int32_t));
+              ptr += sizeof(int32_t);
+              state.q[k] = v;
+            }
+          } else {
+            int16_t v;
+            for (k = 0; k < 3; k++) {
+              memcpy(&v, ptr, sizeof(int16_t));
+              ptr += sizeof(int16_t);
+              state.q[k] += v;
+            }
+          }
+
+          fprintf(fptxt, TAGINT_FORMAT " %d %g %g %g\n", id, (int) itype,
+                  state.q[0] / prec, state.q[1] / prec, state.q[2] / prec);
+        }
+      }
+
+      printf(" " BIGINT_FORMAT, ntimestep);
+      fflush(stdout);
+    }
+    printf("\n");
+  }
+
+  delete[] buf;
+  return 0;
+}
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+# Reader for the shared-memory ring buffer written by "dump shmem".
+#
+# The segment begins with a 4096 byte header:
+#   char     magic[8]        "LMPSHM01"
+#   int32    headersize      byte offset of the first frame slot
+#   int32    nslots          number of frame slots
+#   int64    slotsize        size of one frame slot in bytes
+#   int32    size_one        number of values per atom
+#   int32    pad
+#   char     columns[1024]   space separated column labels
+#   uint64   head            number of published frames
+#
+# Frame N lives in slot N % nslots and starts with a frame header:
+#   uint64   seq             2*N+1 while writing, 2*N+2 when complete
+#   int64    ntimestep
+#   int64    natoms
+#   int32    triclinic
+#   int32    size_one
+#   double   boxlo[3], boxhi[3], xy, xz, yz
+# followed by natoms*size_one packed doubles, one row per atom in the
+# same column order as a text dump file.
+#
+# A frame must be copied out and its seq field re-checked afterwards;
+# if seq changed, the producer overwrote the slot during the copy and
+# the frame must be discarded.  Frames older than head - nslots + 1 are
+# no longer available; a reader that cannot keep up loses frames.
+
+import mmap
+import struct
+import time
+from collections import namedtuple
+
+_SEG_HEADER = struct.Struct('<8sii q ii 1024s Q')
+_FRAME_HEADER = struct.Struct('<Q qq ii 9d')
+
+Frame = namedtuple('Frame', 'index ntimestep natoms triclinic boxlo boxhi tilt columns data')
+
+
+class DumpShmemReader:
+    """Attach to a 'dump shmem' segment and iterate over trajectory frames."""
+
+    def __init__(self, name):
+        # import here so the layout documentation above works without posix_ipc
+        path = '/dev/shm' + name if name.startswith('/') else '/dev/shm/' + name
+        self._file = open(path, 'rb')
+        self._map = mmap.mmap(self._file.fileno(), 0, prot=mmap.PROT_READ)
+
+        (magic, self.headersize, self.nslots, self.slotsize, self.size_one, _pad,
+         columns, _head) = _SEG_HEADER.unpack_from(self._map, 0)
+        if magic != b'LMPSHM01':
+            raise IOError('%s is not a LAMMPS dump shmem segment' % name)
+        self.columns = columns.split(b'\0', 1)[0].decode().split()
+        self._next = 0
+
+    def close(self):
+        self._map.close()
+        self._file.close()
+
+    @property
+    def head(self):
+        """Number of frames published by the producer so far."""
+        return _SEG_HEADER.unpack_from(self._map, 0)[-1]
+
+    def _read_frame(self, index):
+        offset = self.headersize + (index % self.nslots) * self.slotsize
+        header = _FRAME_HEADER.unpack_from(self._map, offset)
+        seq, ntimestep, natoms, triclinic, size_one = header[:5]
+        box = header[5:]
+        if seq != 2 * index + 2:
+            return None
+        nvalues = natoms * size_one
+        data = struct.unpack_from('<%dd' % nvalues, self._map, offset + _FRAME_HEADER.size)
+        # re-check the sequence number to detect a torn read
+        if _FRAME_HEADER.unpack_from(self._map, offset)[0] != 2 * index + 2:
+            return None
+        rows = [data[i * size_one:(i + 1) * size_one] for i in range(natoms)]
+        return Frame(index, ntimestep, natoms, triclinic, box[0:3], box[3:6], box[6:9],
+                     self.columns, rows)
+
+    def poll(self):
+        """Return the next unread frame or None if no new frame is complete."""
+        head = self.head
+        if self._next >= head:
+            return None
+        # skip frames that were already overwritten
+        if self._next <= head - self.nslots:
+            self._next = head - self.nslots + 1
+        frame = self._read_frame(self._next)
+        if frame is None:    # torn read: producer lapped us, try the next one
+            self._next += 1
+            return self.poll()
+        self._next += 1
+        return frame
+
+    def frames(self, interval=0.001):
+        """Generator yielding frames as they are published, polling forever."""
+        while True:
+            frame = self.poll()
+            if frame is None:
+                time.sleep(interval)
+                continue
+            yield frame
+
+
+if __name__ == '__main__':
+    import sys
+
+    if len(sys.argv) != 2:
+        sys.exit('usage: dump_shmem.py /segment-name')
+    reader = DumpShmemReader(sys.argv[1])
+    print('columns:', ' '.join(reader.columns))
+    for frame in reader.frames():
+        print('frame %d: step %d, %d atoms' % (frame.index, frame.ntimestep, frame.natoms))
@@ -0,0 +1,194 @@
+/* -----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/
+   LAMMPS development team: developers@lammps.org, Sandia National Laboratories
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------ */
+
+// Convert one or more LAMMPS binary thermo log files, written via
+//   "thermo_modify binary <file>", to ASCII text files
+//
+// this serial code must be compiled on a platform that can read the binary
+//   thermo files since binary formats are not compatible across all platforms
+//
+// after the file header the file is a stream of int-tagged items:
+//   a schema item describes the fields of the records which follow it,
+//   a record item holds one fixed-width value per field
+// a column header line is printed whenever a new schema is read
+//
+// Syntax: thermobin2txt file1 file2 ...
+// Creates:              file1.txt file2.txt ...
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+// these must match settings in src/lmptype.h which builds LAMMPS with
+//   -DLAMMPS_SMALLBIG (the default), -DLAMMPS_BIGBIG, or -DLAMMPS_SMALLSMALL
+// you can edit the tools/Makefile to enforce the same setting
+//   for the build of thermobin2txt, e.g.
+//   g++ -g -DLAMMPS_BIGBIG thermobin2txt.o -o thermobin2txt
+//   again -DLAMMPS_SMALLBIG is the default
+
+#define __STDC_FORMAT_MACROS
+#include <cinttypes>
+
+#ifndef PRId64
+#define PRId64 "ld"
+#endif
+
+#if !defined(LAMMPS_SMALLSMALL) && !defined(LAMMPS_BIGBIG) && !defined(LAMMPS_SMALLBIG)
+#define LAMMPS_SMALLBIG
+#endif
+
+#if defined(LAMMPS_SMALLSMALL)
+typedef int bigint;
+#define BIGINT_FORMAT "%d"
+#else
+typedef int64_t bigint;
+#define BIGINT_FORMAT "%" PRId64
+#endif
+
+// these must match the constants and the Thermo::INT/FLOAT/BIGINT enum
+//   in src/thermo.cpp and src/thermo.h
+
+#define BIN_MAGIC_STRING "THERMOBIN"
+#define BIN_ENDIAN 0x0001
+#define BIN_FORMAT_REVISION 0x0001
+#define BIN_RECORD 0
+#define BIN_SCHEMA 1
+
+#define TYPE_INT 0
+#define TYPE_FLOAT 1
+#define TYPE_BIGINT 2
+
+#define MAXFIELD 256
+#define MAXKEYWORD 64
+
+int main(int narg, char **arg)
+{
+  int i, n;
+
+  if (narg == 1) {
+    printf("Syntax: thermobin2txt file1 file2 ...\n");
+    return 1;
+  }
+
+  // loop over files
+
+  for (int iarg = 1; iarg < narg; iarg++) {
+    printf("%s:", arg[iarg]);
+    fflush(stdout);
+    FILE *fp = fopen(arg[iarg], "rb");
+    if (!fp) {
+      printf("ERROR: Could not open %s\n", arg[iarg]);
+      return 1;
+    }
+
+    n = strlen(arg[iarg]) + 1 + 4;
+    auto filetxt = new char[n];
+    strcpy(filetxt, arg[iarg]);
+    strcat(filetxt, ".txt");
+    FILE *fptxt = fopen(filetxt, "w");
+    delete[] filetxt;
+
+    // check file header: magic string, endianness, format revision
+
+    bigint marker;
+    char magic[32];
+    int endian, revision;
+
+    if (fread(&marker, sizeof(bigint), 1, fp) != 1 || marker >= 0 ||
+        -marker >= (bigint) sizeof(magic)) {
+      printf("ERROR: %s is not a binary thermo file\n", arg[iarg]);
+      return 1;
+    }
+    n = (int) -marker;
+    if (fread(magic, sizeof(char), n, fp) != (size_t) n) {
+      printf("ERROR: Truncated file header in %s\n", arg[iarg]);
+      return 1;
+    }
+    magic[n] = '\0';
+    if (strcmp(magic, BIN_MAGIC_STRING) != 0) {
+      printf("ERROR: %s is not a binary thermo file\n", arg[iarg]);
+      return 1;
+    }
+    if (fread(&endian, sizeof(int), 1, fp) != 1 || endian != BIN_ENDIAN) {
+      printf("ERROR: %s was written with different endianness\n", arg[iarg]);
+      return 1;
+    }
+    if (fread(&revision, sizeof(int), 1, fp) != 1 || revision > BIN_FORMAT_REVISION) {
+      printf("ERROR: %s was written in a newer format revision\n", arg[iarg]);
+      return 1;
+    }
+
+    // loop over tagged schema and record items until EOF
+
+    int nfield = 0;
+    int vtype[MAXFIELD];
+    char keyword[MAXFIELD][MAXKEYWORD];
+    bigint nrecord = 0;
+    int tag;
+
+    while (fread(&tag, sizeof(int), 1, fp) == 1) {
+
+      if (tag == BIN_SCHEMA) {
+        if (fread(&nfield, sizeof(int), 1, fp) != 1 || nfield <= 0 || nfield > MAXFIELD) {
+          printf("ERROR: Invalid schema in %s\n", arg[iarg]);
+          return 1;
+        }
+        for (i = 0; i < nfield; i++) {
+          int klen;
+          if (fread(&vtype[i], sizeof(int), 1, fp) != 1 ||
+              fread(&klen, sizeof(int), 1, fp) != 1 || klen < 0 || klen >= MAXKEYWORD ||
+              fread(keyword[i], sizeof(char), klen, fp) != (size_t) klen) {
+            printf("ERROR: Invalid schema in %s\n", arg[iarg]);
+            return 1;
+          }
+          keyword[i][klen] = '\0';
+        }
+        for (i = 0; i < nfield; i++) fprintf(fptxt, i ? " %s" : "%s", keyword[i]);
+        fprintf(fptxt, "\n");
+
+      } else if (tag == BIN_RECORD) {
+        if (nfield == 0) {
+          printf("ERROR: Record before schema in %s\n", arg[iarg]);
+          return 1;
+        }
+        for (i = 0; i < nfield; i++) {
+          if (vtype[i] == TYPE_FLOAT) {
+            double d;
+            if (fread(&d, sizeof(double), 1, fp) != 1) break;
+            fprintf(fptxt, i ? " %.15g" : "%.15g", d);
+          } else {
+            bigint b;
+            if (fread(&b, sizeof(bigint), 1, fp) != 1) break;
+            fprintf(fptxt, i ? " " BIGINT_FORMAT : BIGINT_FORMAT, b);
+          }
+        }
+        if (i < nfield) {
+          printf("WARNING: Truncated record at end of %s\n", arg[iarg]);
+          break;
+        }
+        fprintf(fptxt, "\n");
+        nrecord++;
+
+      } else {
+        printf("ERROR: Unknown item tag %d in %s\n", tag, arg[iarg]);
+        return 1;
+      }
+    }
+
+    printf(" " BIGINT_FORMAT " records\n", nrecord);
+    fclose(fp);
+    fclose(fptxt);
+  }
+
+  return 0;
+}
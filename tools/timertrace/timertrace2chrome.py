@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# convert a binary trace file written by the LAMMPS "fix timer/trace"
+# command into Chrome trace event format (JSON), viewable in
+# chrome://tracing, Perfetto (ui.perfetto.dev), or speedscope
+#
+# usage: timertrace2chrome.py tracefile > trace.json
+#
+# each MPI rank becomes one trace thread; within a rank the recorded
+# per-step phase durations are laid out back to back on a per-rank
+# time axis, so rank-to-rank offsets from untraced sections are not
+# represented, but relative phase durations and per-step jitter are
+
+import json
+import struct
+import sys
+
+NAMELEN = 16
+
+
+def read_trace(fname):
+    with open(fname, 'rb') as f:
+        magic = f.read(8)
+        if magic != b'LMPTRACE':
+            raise ValueError(f"{fname} is not a fix timer/trace file")
+        version, nprocs, nphases = struct.unpack('3i', f.read(12))
+        if version != 1:
+            raise ValueError(f"unsupported trace file version {version}")
+        names = []
+        for _ in range(nphases):
+            raw = f.read(NAMELEN)
+            names.append(raw.split(b'\0', 1)[0].decode())
+
+        stride = 1 + nphases
+        records = [[] for _ in range(nprocs)]
+        while True:
+            raw = f.read(4)
+            if len(raw) < 4:
+                break
+            nrec, = struct.unpack('i', raw)
+            for rank in range(nprocs):
+                data = struct.unpack(f'{nrec * stride}d',
+                                     f.read(8 * nrec * stride))
+                for i in range(nrec):
+                    records[rank].append(data[i * stride:(i + 1) * stride])
+        return names, records
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(f"usage: {sys.argv[0]} tracefile > trace.json")
+
+    names, records = read_trace(sys.argv[1])
+    events = []
+    for rank, recs in enumerate(records):
+        ts = 0.0
+        for rec in recs:
+            step = int(rec[0])
+            for k, name in enumerate(names):
+                dur = rec[1 + k] * 1.0e6    # seconds -> microseconds
+                if dur <= 0.0:
+                    continue
+                events.append({
+                    'name': name,
+                    'cat': 'lammps',
+                    'ph': 'X',
+                    'pid': 0,
+                    'tid': rank,
+                    'ts': ts,
+                    'dur': dur,
+                    'args': {'step': step},
+                })
+                ts += dur
+
+    json.dump({'traceEvents': events,
+               'displayTimeUnit': 'ms'}, sys.stdout)
+    sys.stdout.write('\n')
+
+
+if __name__ == '__main__':
+    main()
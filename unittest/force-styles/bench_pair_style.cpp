@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS Development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+// microbenchmark for pair style compute kernels
+//
+// builds a reproducible system and neighbor list once via setup, then
+// times repeated calls of Pair::compute() on the warm list and reports
+// the cost in ns per stored neighbor.  this isolates the pair kernel
+// from neighboring, communication and time integration, so kernel
+// regressions can be tracked across releases and compilers.
+//
+// by default an fcc Lennard-Jones melt in reduced units is measured:
+//
+//   bench_pair_style
+//
+// any other pair style can be measured by handing over the setup
+// commands, e.g.:
+//
+//   bench_pair_style -u metal -l "lattice fcc 3.615" -m 63.55 \
+//     -s "pair_style eam" -c "pair_coeff * * Cu_u3.eam" -n 10 -r 500
+
+#include "atom.h"
+#include "force.h"
+#include "input.h"
+#include "lammps.h"
+#include "neigh_list.h"
+#include "neighbor.h"
+#include "pair.h"
+#include "platform.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+using namespace LAMMPS_NS;
+
+static void print_usage()
+{
+    printf("usage: bench_pair_style [options]\n");
+    printf("  -s <pair_style command>  (default: pair_style lj/cut 2.5)\n");
+    printf("  -c <pair_coeff command>  (may be repeated, default: pair_coeff * * 1.0 1.0)\n");
+    printf("  -u <units>               (default: lj)\n");
+    printf("  -l <lattice command>     (default: lattice fcc 0.8442)\n");
+    printf("  -m <mass>                (default: 1.0)\n");
+    printf("  -n <cells>               cells per box edge (default: 10)\n");
+    printf("  -r <repeats>             timed compute calls (default: 100)\n");
+    printf("  -e                       compute with energy/virial tallying enabled\n");
+}
+
+int main(int argc, char **argv)
+{
+    std::string style_cmd = "pair_style lj/cut 2.5";
+    std::vector<std::string> coeff_cmds;
+    std::string units = "lj";
+    std::string lattice_cmd = "lattice fcc 0.8442";
+    std::string mass = "1.0";
+    int ncells = 10;
+    int nrepeat = 100;
+    int evflag = 0;
+
+    for (int iarg = 1; iarg < argc; ++iarg) {
+        if (strcmp(argv[iarg], "-s") == 0 && iarg + 1 < argc) {
+            style_cmd = argv[++iarg];
+        } else if (strcmp(argv[iarg], "-c") == 0 && iarg + 1 < argc) {
+            coeff_cmds.emplace_back(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-u") == 0 && iarg + 1 < argc) {
+            units = argv[++iarg];
+        } else if (strcmp(argv[iarg], "-l") == 0 && iarg + 1 < argc) {
+            lattice_cmd = argv[++iarg];
+        } else if (strcmp(argv[iarg], "-m") == 0 && iarg + 1 < argc) {
+            mass = argv[++iarg];
+        } else if (strcmp(argv[iarg], "-n") == 0 && iarg + 1 < argc) {
+            ncells = atoi(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-r") == 0 && iarg + 1 < argc) {
+            nrepeat = atoi(argv[++iarg]);
+        } else if (strcmp(argv[iarg], "-e") == 0) {
+            evflag = 1;
+        } else {
+            print_usage();
+            return 1;
+        }
+    }
+    if (coeff_cmds.empty()) coeff_cmds.emplace_back("pair_coeff * * 1.0 1.0");
+    if ((ncells < 1) || (nrepeat < 1)) {
+        print_usage();
+        return 1;
+    }
+
+    MPI_Init(&argc, &argv);
+    {
+        LAMMPS::argv args = {"bench_pair_style", "-log", "none", "-echo", "none", "-nocite"};
+        LAMMPS lmp(args, MPI_COMM_WORLD);
+
+        // reproducible system: perfect lattice, slightly perturbed with a
+        // fixed seed so the neighbor lists are not artificially uniform
+
+        lmp.input->one("units " + units);
+        lmp.input->one("atom_modify map array");
+        lmp.input->one(lattice_cmd);
+        lmp.input->one("region box block 0 " + std::to_string(ncells) + " 0 " +
+                       std::to_string(ncells) + " 0 " + std::to_string(ncells));
+        lmp.input->one("create_box 1 box");
+        lmp.input->one("create_atoms 1 box");
+        lmp.input->one("mass 1 " + mass);
+        lmp.input->one("displace_atoms all random 0.01 0.01 0.01 87287 units box");
+        lmp.input->one(style_cmd);
+        for (const auto &cmd : coeff_cmds)
+            lmp.input->one(cmd);
+
+        // build the neighbor list and warm up the kernel once
+
+        lmp.input->one("run 0 post no");
+
+        Pair *pair = lmp.force->pair;
+        if (!pair) {
+            fprintf(stderr, "ERROR: no pair style defined\n");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+        pair->compute(evflag, evflag);
+
+        // time repeated computes on the warm list, zeroing the forces
+        // before each call as a timestep would
+
+        double **f = lmp.atom->f;
+        const int nall = lmp.atom->nlocal + lmp.atom->nghost;
+
+        double start = platform::walltime();
+        for (int i = 0; i < nrepeat; ++i) {
+            memset(&f[0][0], 0, 3 * nall * sizeof(double));
+            pair->compute(evflag, evflag);
+        }
+        double elapsed = platform::walltime() - start;
+
+        // count the stored neighbors of the perpetual pair list
+
+        bigint nneigh = 0;
+        int inum = 0;
+        for (int ilist = 0; ilist < lmp.neighbor->nlist; ++ilist) {
+            NeighList *list = lmp.neighbor->lists[ilist];
+            if (list->pair_method && !list->occasional) {
+                inum = list->inum;
+                for (int ii = 0; ii < inum; ++ii)
+                    nneigh += list->numneigh[list->ilist[ii]];
+                break;
+            }
+        }
+
+        printf("Pair style:         %s\n", style_cmd.c_str() + strlen("pair_style "));
+        printf("Atoms:              %d\n", lmp.atom->nlocal);
+        printf("Neighbors/atom:     %.2f\n", inum ? (double) nneigh / inum : 0.0);
+        printf("Compute calls:      %d\n", nrepeat);
+        printf("Time/call:          %.6f ms\n", 1.0e3 * elapsed / nrepeat);
+        if (nneigh > 0)
+            printf("Time/neighbor:      %.3f ns\n", 1.0e9 * elapsed / nrepeat / (double) nneigh);
+    }
+    MPI_Finalize();
+    return 0;
+}
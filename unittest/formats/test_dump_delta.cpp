@@ -0,0 +1,320 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS Development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "../testing/core.h"
+#include "../testing/systems/melt.h"
+#include "../testing/utils.h"
+#include "fmt/format.h"
+#include "lmptype.h"
+#include "utils.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+bool verbose = false;
+
+namespace LAMMPS_NS {
+
+// one decoded snapshot: reconstructed quantized coords per atom ID
+
+struct DeltaFrame {
+    bigint timestep;
+    double prec;
+    bool keyframe;
+    std::map<tagint, int16_t> types;
+    std::map<tagint, std::array<int32_t, 3>> coords;
+    std::map<tagint, bool> absolute;
+};
+
+// decode a dump delta file per the layout documented in src/dump_delta.cpp,
+// applying delta records to the atom's previous reconstructed coords
+
+static std::vector<DeltaFrame> decode_delta_file(const std::string &file)
+{
+    std::vector<DeltaFrame> frames;
+    std::map<tagint, std::array<int32_t, 3>> prev;
+
+    std::ifstream in(file, std::ios::binary);
+    EXPECT_TRUE(in.good()) << "cannot open " << file;
+
+    while (true) {
+        bigint marker;
+        in.read((char *)&marker, sizeof(bigint));
+        if (in.eof()) break;
+        EXPECT_EQ(marker, -9);
+
+        char magic[10] = {0};
+        in.read(magic, 9);
+        EXPECT_STREQ(magic, "DUMPDELTA");
+        int endian, revision;
+        in.read((char *)&endian, sizeof(int));
+        in.read((char *)&revision, sizeof(int));
+        EXPECT_EQ(endian, 0x0001);
+        EXPECT_EQ(revision, 0x0001);
+
+        DeltaFrame frame;
+        bigint natoms;
+        int triclinic, boundary[6];
+        double bounds[6];
+        in.read((char *)&frame.timestep, sizeof(bigint));
+        in.read((char *)&natoms, sizeof(bigint));
+        in.read((char *)&triclinic, sizeof(int));
+        in.read((char *)boundary, 6 * sizeof(int));
+        in.read((char *)bounds, 6 * sizeof(double));
+        if (triclinic) {
+            double tilt[3];
+            in.read((char *)tilt, 3 * sizeof(double));
+        }
+        in.read((char *)&frame.prec, sizeof(double));
+        char key;
+        in.read((char *)&key, sizeof(char));
+        frame.keyframe = (key != 0);
+        int nchunks;
+        in.read((char *)&nchunks, sizeof(int));
+
+        for (int ichunk = 0; ichunk < nchunks; ichunk++) {
+            int nrecords, nbytes;
+            in.read((char *)&nrecords, sizeof(int));
+            in.read((char *)&nbytes, sizeof(int));
+            std::vector<char> payload(nbytes);
+            in.read(payload.data(), nbytes);
+            EXPECT_TRUE(in.good());
+
+            const char *ptr = payload.data();
+            for (int i = 0; i < nrecords; i++) {
+                tagint id;
+                int16_t type;
+                memcpy(&id, ptr, sizeof(tagint));
+                ptr += sizeof(tagint);
+                memcpy(&type, ptr, sizeof(int16_t));
+                ptr += sizeof(int16_t);
+                char absflag = *ptr++;
+
+                std::array<int32_t, 3> q;
+                if (absflag) {
+                    for (int k = 0; k < 3; k++) {
+                        int32_t v;
+                        memcpy(&v, ptr, sizeof(int32_t));
+                        ptr += sizeof(int32_t);
+                        q[k] = v;
+                    }
+                } else {
+                    EXPECT_FALSE(frame.keyframe);
+                    EXPECT_EQ(prev.count(id), 1) << "delta record without previous record";
+                    for (int k = 0; k < 3; k++) {
+                        int16_t v;
+                        memcpy(&v, ptr, sizeof(int16_t));
+                        ptr += sizeof(int16_t);
+                        q[k] = prev[id][k] + v;
+                    }
+                }
+                frame.types[id] = type;
+                frame.coords[id] = q;
+                frame.absolute[id] = (absflag != 0);
+                prev[id] = q;
+            }
+            EXPECT_EQ(ptr - payload.data(), nbytes);
+        }
+        EXPECT_EQ((bigint)frame.coords.size(), natoms);
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+// one reference snapshot from a parallel full-precision text dump
+
+struct TextFrame {
+    bigint timestep;
+    std::map<tagint, int> types;
+    std::map<tagint, std::array<double, 3>> coords;
+};
+
+static std::vector<TextFrame> read_text_frames(const std::string &file)
+{
+    std::vector<TextFrame> frames;
+    std::ifstream in(file);
+    for (std::string line; std::getline(in, line); /* */) {
+        if (utils::strmatch(line, "^ITEM: TIMESTEP")) {
+            TextFrame frame;
+            std::getline(in, line);
+            frame.timestep = std::stoll(utils::trim(line));
+            frames.push_back(frame);
+        } else if (!frames.empty() && !utils::strmatch(line, "^ITEM:")) {
+            auto words = utils::split_words(line);
+            if (words.size() != 5) continue;
+            tagint id = (tagint)std::stoll(words[0]);
+            frames.back().types[id] = std::stoi(words[1]);
+            for (int k = 0; k < 3; k++)
+                frames.back().coords[id][k] = std::stod(words[k + 2]);
+        }
+    }
+    return frames;
+}
+
+class DumpDeltaTest : public MeltTest {
+public:
+    void run_dumps(const std::string &binary_file, const std::string &text_file)
+    {
+        BEGIN_HIDE_OUTPUT();
+        command("dump bin all delta 1 " + binary_file);
+        command("dump_modify bin precision 100000 keyframe 3");
+        command("dump txt all custom 1 " + text_file + " id type x y z");
+        command("dump_modify txt format line \"%d %d %.17g %.17g %.17g\"");
+        command("run 4 post no");
+
+        // teleport one atom: at precision 100000 the quantized displacement
+        // of 50000 exceeds 16 bits and must escape to an absolute record
+        // in the next (non-keyframe) snapshot
+
+        command("group one id 1");
+        command("displace_atoms one move 0.0 0.5 0.0 units box");
+        command("run 3 post no");
+        command("undump bin");
+        command("undump txt");
+        END_HIDE_OUTPUT();
+    }
+};
+
+TEST_F(DumpDeltaTest, round_trip)
+{
+    const std::string binary_file = "dump_delta_round_trip.melt.bin";
+    const std::string text_file = "dump_delta_round_trip.melt";
+    run_dumps(binary_file, text_file);
+
+    ASSERT_FILE_EXISTS(binary_file);
+    ASSERT_FILE_EXISTS(text_file);
+
+    auto frames = decode_delta_file(binary_file);
+    auto reference = read_text_frames(text_file);
+    ASSERT_EQ(frames.size(), reference.size());
+    ASSERT_GE(frames.size(), 8);
+
+    int nkey = 0, ndelta = 0;
+    bool escaped = false;
+    for (std::size_t i = 0; i < frames.size(); i++) {
+        const auto &frame = frames[i];
+        const auto &ref = reference[i];
+        ASSERT_EQ(frame.timestep, ref.timestep);
+        ASSERT_EQ(frame.coords.size(), 32);
+        ASSERT_EQ(frame.coords.size(), ref.coords.size());
+
+        // every 3rd snapshot was forced to a keyframe with all-absolute records
+
+        if (i % 3 == 0) { ASSERT_TRUE(frame.keyframe); }
+        if (frame.keyframe) nkey++;
+
+        for (const auto &atom : frame.coords) {
+            const tagint id = atom.first;
+            ASSERT_EQ(ref.coords.count(id), 1);
+            ASSERT_EQ(frame.types.at(id), ref.types.at(id));
+            for (int k = 0; k < 3; k++) {
+                const auto q = (int32_t)std::round(ref.coords.at(id)[k] * frame.prec);
+                ASSERT_EQ(atom.second[k], q)
+                    << "atom " << id << " dim " << k << " at step " << frame.timestep;
+            }
+            if (frame.keyframe) {
+                ASSERT_TRUE(frame.absolute.at(id));
+            } else if (frame.absolute.at(id)) {
+                if (id == 1) escaped = true;
+            } else {
+                ndelta++;
+            }
+        }
+    }
+
+    // the file must contain genuine delta records and the teleported
+    // atom's escape to an absolute record outside a keyframe
+
+    ASSERT_GE(nkey, 3);
+    ASSERT_GT(ndelta, 0);
+    ASSERT_TRUE(escaped);
+
+    delete_file(binary_file);
+    delete_file(text_file);
+}
+
+TEST_F(DumpDeltaTest, multifile_keyframes)
+{
+    const std::string binary_file = "dump_delta_multi_*.melt.bin";
+    const std::string text_file = "dump_delta_multi.melt";
+    run_dumps(binary_file, text_file);
+
+    auto reference = read_text_frames(text_file);
+
+    // every snapshot of a multifile dump is a keyframe, so each file
+    // must decode standalone without any previous state
+
+    for (const auto &ref : reference) {
+        std::string file = fmt::format("dump_delta_multi_{}.melt.bin", ref.timestep);
+        ASSERT_FILE_EXISTS(file);
+        auto frames = decode_delta_file(file);
+        ASSERT_EQ(frames.size(), 1);
+        const auto &frame = frames[0];
+        ASSERT_TRUE(frame.keyframe);
+        ASSERT_EQ(frame.timestep, ref.timestep);
+        ASSERT_EQ(frame.coords.size(), ref.coords.size());
+        for (const auto &atom : frame.coords) {
+            ASSERT_TRUE(frame.absolute.at(atom.first));
+            for (int k = 0; k < 3; k++) {
+                const auto q =
+                    (int32_t)std::round(ref.coords.at(atom.first)[k] * frame.prec);
+                ASSERT_EQ(atom.second[k], q);
+            }
+        }
+        delete_file(file);
+    }
+    delete_file(text_file);
+}
+
+TEST_F(DumpDeltaTest, bad_arguments)
+{
+    TEST_FAILURE(".*ERROR: Dump delta requires a binary filename.*",
+                 command("dump bad all delta 1 dump_delta.melt"););
+    TEST_FAILURE(".*ERROR: Dump delta cannot use '%' in the dump filename.*",
+                 command("dump bad all delta 1 dump_delta_%.melt.bin"););
+    TEST_FAILURE(".*ERROR: Illegal dump_modify command.*",
+                 command("dump good all delta 1 dump_delta.melt.bin");
+                 command("dump_modify good precision -1.0"););
+}
+
+} // namespace LAMMPS_NS
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleMock(&argc, argv);
+
+    // handle arguments passed via environment variable
+    if (const char *var = getenv("TEST_ARGS")) {
+        std::vector<std::string> env = LAMMPS_NS::utils::split_words(var);
+        for (auto arg : env) {
+            if (arg == "-v") {
+                verbose = true;
+            }
+        }
+    }
+
+    if ((argc > 1) && (strcmp(argv[1], "-v") == 0)) verbose = true;
+
+    int rv = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return rv;
+}
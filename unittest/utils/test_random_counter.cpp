@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   https://www.lammps.org/, Sandia National Laboratories
+   LAMMPS Development team: developers@lammps.org
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+// unit tests for the RanCounter counter-based random number generator
+
+#include "lammps.h"
+#include "random_counter.h"
+#include "utils.h"
+
+#include "../testing/core.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// whether to print verbose output (i.e. not capturing LAMMPS screen output).
+bool verbose = false;
+
+namespace LAMMPS_NS {
+
+class RanCounterTest : public LAMMPSTest {
+protected:
+    void SetUp() override
+    {
+        testbinary = "RanCounterTest";
+        LAMMPSTest::SetUp();
+    }
+};
+
+// expected values below were computed with the reference Threefry-4x64-20
+// implementation of Salmon et al. (Random123), which reproduces the
+// published known-answer vector for all-zero key and counter
+// (first output word 0x09218ebde6c85537).  RanCounter keys the bijection
+// on (seed,0,0,0) with counter (step,id,which,0) and maps the upper
+// 53 bits of the first output word to (0,1), so these values pin the
+// generator bitwise.  uniform() is pure integer/double arithmetic and
+// must match exactly; gaussian() goes through libm log/cos and gets a
+// small tolerance.
+
+TEST_F(RanCounterTest, threefry_vectors)
+{
+    RanCounter one(lmp, 1);
+    EXPECT_DOUBLE_EQ(one.uniform(0, 1, 0), 0.59441213913404822);
+
+    RanCounter rng(lmp, 12345);
+    EXPECT_DOUBLE_EQ(rng.uniform(0, 1, 0), 0.013356876402453588);
+    EXPECT_DOUBLE_EQ(rng.uniform(100, 42, 0), 0.10556008511050746);
+    EXPECT_DOUBLE_EQ(rng.uniform(100, 42, 1), 0.23389705319825776);
+    EXPECT_DOUBLE_EQ(rng.uniform(100, 42, 2), 0.89292417887847919);
+    EXPECT_DOUBLE_EQ(rng.uniform(100, 43, 0), 0.95194599348430575);
+    EXPECT_DOUBLE_EQ(rng.uniform(101, 42, 0), 0.33002697001721598);
+
+    RanCounter other(lmp, 54321);
+    EXPECT_DOUBLE_EQ(other.uniform(100, 42, 0), 0.86096416688530653);
+
+    // large step and id exercise the full 64-bit counter words
+
+    RanCounter big(lmp, 902384094);
+    EXPECT_DOUBLE_EQ(big.uniform((bigint) 5000000000, (tagint) 2000000000, 3),
+                     0.96311294412356108);
+
+    EXPECT_NEAR(rng.gaussian(0, 1, 0), -2.2686105799341987, 1.0e-12);
+    EXPECT_NEAR(rng.gaussian(100, 42, 0), -1.3479286006380824, 1.0e-12);
+    EXPECT_NEAR(rng.gaussian(100, 42, 1), -1.1098224692519048, 1.0e-12);
+    EXPECT_NEAR(other.gaussian(100, 42, 0), 0.056400118566138496, 1.0e-12);
+}
+
+TEST_F(RanCounterTest, determinism)
+{
+    RanCounter rng1(lmp, 12345);
+    RanCounter rng2(lmp, 12345);
+
+    // same (step,id,which) yields the same value, in any order
+
+    EXPECT_EQ(rng1.uniform(7, 19, 3), rng2.uniform(7, 19, 3));
+    EXPECT_EQ(rng1.gaussian(7, 19, 3), rng2.gaussian(7, 19, 3));
+    EXPECT_EQ(rng2.uniform(1, 1, 0), rng1.uniform(1, 1, 0));
+
+    // repeated evaluation does not advance any state
+
+    const double first = rng1.uniform(7, 19, 3);
+    EXPECT_EQ(rng1.uniform(7, 19, 3), first);
+
+    // any single counter change yields a different value
+
+    EXPECT_NE(rng1.uniform(7, 19, 3), rng1.uniform(8, 19, 3));
+    EXPECT_NE(rng1.uniform(7, 19, 3), rng1.uniform(7, 20, 3));
+    EXPECT_NE(rng1.uniform(7, 19, 3), rng1.uniform(7, 19, 4));
+
+    RanCounter rng3(lmp, 12346);
+    EXPECT_NE(rng1.uniform(7, 19, 3), rng3.uniform(7, 19, 3));
+}
+
+TEST_F(RanCounterTest, rewind)
+{
+    RanCounter rng(lmp, 12345);
+
+    // argument-free draws auto-increment the which counter
+
+    rng.rewind(100, 42);
+    EXPECT_EQ(rng.uniform(), rng.uniform(100, 42, 0));
+    EXPECT_EQ(rng.uniform(), rng.uniform(100, 42, 1));
+    EXPECT_EQ(rng.gaussian(), rng.gaussian(100, 42, 2));
+
+    // rewinding replays the same sequence
+
+    std::vector<double> seq1, seq2;
+    rng.rewind(100, 42);
+    for (int i = 0; i < 8; i++)
+        seq1.push_back(rng.uniform());
+    rng.rewind(100, 42);
+    for (int i = 0; i < 8; i++)
+        seq2.push_back(rng.uniform());
+    EXPECT_EQ(seq1, seq2);
+}
+
+TEST_F(RanCounterTest, moments)
+{
+    constexpr int NSAMPLE = 40000;
+    RanCounter rng(lmp, 2349085);
+
+    double usum = 0.0, usumsq = 0.0, gsum = 0.0, gsumsq = 0.0;
+    for (int i = 0; i < NSAMPLE; i++) {
+        const double u = rng.uniform(i, i % 1000 + 1, i % 3);
+        ASSERT_GT(u, 0.0);
+        ASSERT_LT(u, 1.0);
+        usum += u;
+        usumsq += u * u;
+        const double g = rng.gaussian(i, i % 1000 + 1, i % 3);
+        gsum += g;
+        gsumsq += g * g;
+    }
+
+    EXPECT_NEAR(usum / NSAMPLE, 0.5, 0.01);
+    EXPECT_NEAR(usumsq / NSAMPLE - pow(usum / NSAMPLE, 2.0), 1.0 / 12.0, 0.005);
+    EXPECT_NEAR(gsum / NSAMPLE, 0.0, 0.02);
+    EXPECT_NEAR(gsumsq / NSAMPLE - pow(gsum / NSAMPLE, 2.0), 1.0, 0.03);
+}
+
+TEST_F(RanCounterTest, bad_seed)
+{
+    TEST_FAILURE(".*ERROR on proc 0: Invalid seed for Threefry random # generator.*",
+                 RanCounter bad(lmp, 0););
+}
+
+} // namespace LAMMPS_NS
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleMock(&argc, argv);
+
+    // handle arguments passed via environment variable
+    if (const char *var = getenv("TEST_ARGS")) {
+        std::vector<std::string> env = LAMMPS_NS::utils::split_words(var);
+        for (auto arg : env) {
+            if (arg == "-v") {
+                verbose = true;
+            }
+        }
+    }
+
+    if ((argc > 1) && (strcmp(argv[1], "-v") == 0)) verbose = true;
+
+    int rv = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return rv;
+}